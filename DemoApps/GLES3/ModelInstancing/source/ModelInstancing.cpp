@@ -105,6 +105,7 @@ namespace Fsl
     {
       MeshUtil::DemoMeshRecord meshRecord = MeshUtil::ToSingleMesh(*scene);
       m_shared.SetStats(ModelRenderStats(NumericCast<uint32_t>(meshRecord.Vertices.size()), NumericCast<uint32_t>(meshRecord.Indices.size())));
+      m_shared.SetMeshBounds(MeshUtil::CalcBounds(meshRecord));
 
       std::size_t vertexCount = 0;
       std::size_t indexCount = 0;
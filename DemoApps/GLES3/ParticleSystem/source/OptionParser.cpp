@@ -34,6 +34,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Getopt/OptionBaseValues.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Log/String/FmtStringViewLite.hpp>
 #include <FslBase/Math/MathHelper.hpp>
 #include <FslBase/String/StringParseUtil.hpp>
 #include <algorithm>
@@ -49,13 +50,17 @@ namespace Fsl
       {
         Scene = DEMO_APP_OPTION_BASE,
         Model,
-        Texture
+        Texture,
+        Backend,
+        CpuBenchmark
       };
     };
   }
 
   OptionParser::OptionParser()
     : m_scene(DemoScene::Default)
+    , m_backend(CpuParticleBackend::OneArray)
+    , m_cpuBenchmark(false)
   {
   }
 
@@ -66,6 +71,10 @@ namespace Fsl
   void OptionParser::OnArgumentSetup(std::deque<Option>& rOptions)
   {
     rOptions.emplace_back("s", "Scene", OptionArgument::OptionRequired, CommandId::Scene, "Select the scene to run (0 to 0 or basic)");
+    rOptions.emplace_back("Backend", OptionArgument::OptionRequired, CommandId::Backend,
+                          "Select the CPU particle system implementation: aos (default) or soa");
+    rOptions.emplace_back("CpuBenchmark", OptionArgument::OptionNone, CommandId::CpuBenchmark,
+                          "Benchmark the CPU particle system update at 100k to 2M particles, log the results and exit");
   }
 
 
@@ -89,6 +98,24 @@ namespace Fsl
         m_scene = static_cast<DemoScene>(intValue);
       }
       return OptionParseResult::Parsed;
+    case CommandId::Backend:
+      if (strOptArg == "aos")
+      {
+        m_backend = CpuParticleBackend::OneArray;
+      }
+      else if (strOptArg == "soa")
+      {
+        m_backend = CpuParticleBackend::SoA;
+      }
+      else
+      {
+        FSLLOG3_ERROR("Unknown backend '{}'", strOptArg);
+        return OptionParseResult::Failed;
+      }
+      return OptionParseResult::Parsed;
+    case CommandId::CpuBenchmark:
+      m_cpuBenchmark = true;
+      return OptionParseResult::Parsed;
     default:
       return OptionParseResult::NotHandled;
     }
@@ -41,9 +41,19 @@ namespace Fsl
     Basic = 255
   };
 
+  enum class CpuParticleBackend
+  {
+    //! Array of structures
+    OneArray,
+    //! Structure of arrays with SIMD and a multithreaded update
+    SoA
+  };
+
   class OptionParser : public ADemoOptionParser
   {
     DemoScene m_scene;
+    CpuParticleBackend m_backend;
+    bool m_cpuBenchmark;
 
   public:
     OptionParser();
@@ -54,6 +64,16 @@ namespace Fsl
       return m_scene;
     }
 
+    CpuParticleBackend GetBackend() const
+    {
+      return m_backend;
+    }
+
+    bool IsCpuBenchmarkEnabled() const
+    {
+      return m_cpuBenchmark;
+    }
+
   protected:
     void OnArgumentSetup(std::deque<Option>& rOptions) override;
     OptionParseResult OnParse(const int32_t cmdId, const StringViewLite& strOptArg) override;
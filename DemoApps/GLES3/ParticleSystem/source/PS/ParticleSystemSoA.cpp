@@ -0,0 +1,487 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "ParticleSystemSoA.hpp"
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslDemoApp/Base/DemoTime.hpp>
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+// Define FSL_PARTICLE_SIMD_DISABLED to force the scalar code path
+#if !defined(FSL_PARTICLE_SIMD_DISABLED)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOCAL_PARTICLE_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define LOCAL_PARTICLE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    constexpr uint32_t SimdLanes = 4;
+    constexpr uint32_t AllLanesAlive = 0xF;
+
+    static_assert((ParticleSystemSoA::ChunkSize % SimdLanes) == 0, "ChunkSize must be a multiple of the lane count");
+
+#if defined(LOCAL_PARTICLE_SIMD_SSE2)
+    using SimdValue = __m128;
+
+    inline SimdValue SimdLoad(const float* const pSrc) noexcept
+    {
+      return _mm_loadu_ps(pSrc);
+    }
+
+    inline void SimdStore(float* const pDst, const SimdValue value) noexcept
+    {
+      _mm_storeu_ps(pDst, value);
+    }
+
+    inline SimdValue SimdSplat(const float value) noexcept
+    {
+      return _mm_set1_ps(value);
+    }
+
+    inline SimdValue SimdAdd(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return _mm_add_ps(lhs, rhs);
+    }
+
+    inline SimdValue SimdSub(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return _mm_sub_ps(lhs, rhs);
+    }
+
+    inline SimdValue SimdMul(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return _mm_mul_ps(lhs, rhs);
+    }
+
+    //! @brief Get a bit mask with one bit per lane that is set if the lane is greater than zero
+    inline uint32_t SimdGreaterThanZeroMask(const SimdValue value) noexcept
+    {
+      return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpgt_ps(value, _mm_setzero_ps())));
+    }
+#elif defined(LOCAL_PARTICLE_SIMD_NEON)
+    using SimdValue = float32x4_t;
+
+    inline SimdValue SimdLoad(const float* const pSrc) noexcept
+    {
+      return vld1q_f32(pSrc);
+    }
+
+    inline void SimdStore(float* const pDst, const SimdValue value) noexcept
+    {
+      vst1q_f32(pDst, value);
+    }
+
+    inline SimdValue SimdSplat(const float value) noexcept
+    {
+      return vdupq_n_f32(value);
+    }
+
+    inline SimdValue SimdAdd(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return vaddq_f32(lhs, rhs);
+    }
+
+    inline SimdValue SimdSub(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return vsubq_f32(lhs, rhs);
+    }
+
+    inline SimdValue SimdMul(const SimdValue lhs, const SimdValue rhs) noexcept
+    {
+      return vmulq_f32(lhs, rhs);
+    }
+
+    //! @brief Get a bit mask with one bit per lane that is set if the lane is greater than zero
+    inline uint32_t SimdGreaterThanZeroMask(const SimdValue value) noexcept
+    {
+      const uint32x4_t laneBits = {1u, 2u, 4u, 8u};
+      const uint32x4_t masked = vandq_u32(vcgtq_f32(value, vdupq_n_f32(0.0f)), laneBits);
+      const uint32x2_t sum2 = vorr_u32(vget_low_u32(masked), vget_high_u32(masked));
+      return vget_lane_u32(sum2, 0) | vget_lane_u32(sum2, 1);
+    }
+#endif
+
+
+    template <typename T>
+    inline void MoveEntry(std::vector<T>& rStream, const uint32_t srcIndex, const uint32_t dstIndex) noexcept
+    {
+      rStream[dstIndex] = rStream[srcIndex];
+    }
+
+
+    template <typename T>
+    inline void MoveRange(std::vector<T>& rStream, const uint32_t srcIndex, const uint32_t dstIndex, const uint32_t count) noexcept
+    {
+      // The destination is always before the source so a forward copy is safe
+      assert((dstIndex + count) <= srcIndex);
+      std::copy(rStream.begin() + srcIndex, rStream.begin() + srcIndex + count, rStream.begin() + dstIndex);
+    }
+
+
+    template <typename TStreams>
+    inline void MoveParticle(TStreams& rStreams, const uint32_t srcIndex, const uint32_t dstIndex) noexcept
+    {
+      MoveEntry(rStreams.PositionX, srcIndex, dstIndex);
+      MoveEntry(rStreams.PositionY, srcIndex, dstIndex);
+      MoveEntry(rStreams.PositionZ, srcIndex, dstIndex);
+      MoveEntry(rStreams.VelocityX, srcIndex, dstIndex);
+      MoveEntry(rStreams.VelocityY, srcIndex, dstIndex);
+      MoveEntry(rStreams.VelocityZ, srcIndex, dstIndex);
+      MoveEntry(rStreams.Energy, srcIndex, dstIndex);
+      MoveEntry(rStreams.Size, srcIndex, dstIndex);
+      MoveEntry(rStreams.StartSize, srcIndex, dstIndex);
+      MoveEntry(rStreams.SizeDelta, srcIndex, dstIndex);
+      MoveEntry(rStreams.InvStartEnergy, srcIndex, dstIndex);
+      MoveEntry(rStreams.TextureId, srcIndex, dstIndex);
+    }
+
+
+    template <typename TStreams>
+    inline void MoveParticles(TStreams& rStreams, const uint32_t srcIndex, const uint32_t dstIndex, const uint32_t count) noexcept
+    {
+      MoveRange(rStreams.PositionX, srcIndex, dstIndex, count);
+      MoveRange(rStreams.PositionY, srcIndex, dstIndex, count);
+      MoveRange(rStreams.PositionZ, srcIndex, dstIndex, count);
+      MoveRange(rStreams.VelocityX, srcIndex, dstIndex, count);
+      MoveRange(rStreams.VelocityY, srcIndex, dstIndex, count);
+      MoveRange(rStreams.VelocityZ, srcIndex, dstIndex, count);
+      MoveRange(rStreams.Energy, srcIndex, dstIndex, count);
+      MoveRange(rStreams.Size, srcIndex, dstIndex, count);
+      MoveRange(rStreams.StartSize, srcIndex, dstIndex, count);
+      MoveRange(rStreams.SizeDelta, srcIndex, dstIndex, count);
+      MoveRange(rStreams.InvStartEnergy, srcIndex, dstIndex, count);
+      MoveRange(rStreams.TextureId, srcIndex, dstIndex, count);
+    }
+  }
+
+
+  ParticleSystemSoA::ParticleStreams::ParticleStreams(const std::size_t capacity)
+    : PositionX(capacity)
+    , PositionY(capacity)
+    , PositionZ(capacity)
+    , VelocityX(capacity)
+    , VelocityY(capacity)
+    , VelocityZ(capacity)
+    , Energy(capacity)
+    , Size(capacity)
+    , StartSize(capacity)
+    , SizeDelta(capacity)
+    , InvStartEnergy(capacity)
+    , TextureId(capacity)
+  {
+  }
+
+
+  ParticleSystemSoA::ParticleSystemSoA(std::shared_ptr<IParticleDraw> particleDraw, const std::size_t capacity, std::shared_ptr<JobSystem> jobSystem)
+    : m_streams(capacity)
+    , m_drawParticles(capacity)
+    , m_chunkAliveCount((capacity + ChunkSize - 1) / ChunkSize)
+    , m_particleDraw(std::move(particleDraw))
+    , m_jobSystem(std::move(jobSystem))
+    , m_capacity(static_cast<uint32_t>(capacity))
+  {
+  }
+
+
+  uint32_t ParticleSystemSoA::GetParticleCount() const
+  {
+    return m_particleCount;
+  }
+
+
+  void ParticleSystemSoA::AddEmitter(const std::shared_ptr<IParticleEmitter>& emitter)
+  {
+    m_emitters.push_back(emitter);
+  }
+
+
+  void ParticleSystemSoA::Update(const DemoTime& demoTime)
+  {
+    // Allow the emitters to create new particles
+    // BEWARE that this allows the emitters to call the 'AddParticles' functions
+    for (auto itr = m_emitters.begin(); itr != m_emitters.end(); ++itr)
+    {
+      (*itr)->Update(*this, demoTime);
+    }
+
+    if (m_particleCount <= 0u)
+    {
+      return;
+    }
+
+    const float deltaTime = demoTime.DeltaTime;
+    const Vector3 gravityVelocity = m_gravity * deltaTime;
+    const uint32_t particleCount = m_particleCount;
+    const uint32_t chunkCount = (particleCount + ChunkSize - 1) / ChunkSize;
+    assert(chunkCount <= m_chunkAliveCount.size());
+
+    // Update each chunk and move its live particles to the start of the chunk, the chunks are independent so they can be processed in parallel
+    auto fnUpdateChunks = [this, particleCount, deltaTime, gravityVelocity](const std::size_t startChunk, const std::size_t count)
+    {
+      for (std::size_t chunkIndex = startChunk; chunkIndex < (startChunk + count); ++chunkIndex)
+      {
+        const auto startIndex = static_cast<uint32_t>(chunkIndex * ChunkSize);
+        const uint32_t endIndex = std::min(startIndex + ChunkSize, particleCount);
+        m_chunkAliveCount[chunkIndex] = UpdateChunk(m_streams, startIndex, endIndex, deltaTime, gravityVelocity);
+      }
+    };
+    if (m_jobSystem && chunkCount > 1u)
+    {
+      m_jobSystem->ParallelForRange(chunkCount, 1u, fnUpdateChunks);
+    }
+    else
+    {
+      fnUpdateChunks(0u, chunkCount);
+    }
+
+    // Close the gaps left at the end of the chunks
+    CompactChunks(m_streams, ReadOnlySpan<uint32_t>(m_chunkAliveCount.data(), chunkCount), m_particleCount);
+  }
+
+
+  void ParticleSystemSoA::Draw(const ParticleDrawContext& context)
+  {
+    const uint32_t particleCount = m_particleCount;
+    auto fnGather = [this](Span<Particle> batch, const std::size_t offset)
+    { GatherParticles(batch, m_streams, static_cast<uint32_t>(offset)); };
+
+    Span<Particle> dst(m_drawParticles.data(), particleCount);
+    if (m_jobSystem)
+    {
+      m_jobSystem->ParallelFor(dst, ChunkSize, fnGather);
+    }
+    else
+    {
+      fnGather(dst, 0u);
+    }
+
+    const auto* const pSrcParticles = reinterpret_cast<const uint8_t*>(m_drawParticles.data());
+    m_particleDraw->Draw(context, pSrcParticles, particleCount, ParticleRecordSize());
+  }
+
+
+  void ParticleSystemSoA::AddParticles(const Particle* pParticles, const std::size_t& count)
+  {
+    // Silently ignore a attempt to add too many particles.
+    const auto actualCount = static_cast<uint32_t>(std::min(count, static_cast<std::size_t>(m_capacity - m_particleCount)));
+    ParticleStreams& rStreams = m_streams;
+    for (uint32_t i = 0; i < actualCount; ++i)
+    {
+      const Particle& particle = pParticles[i];
+      const uint32_t dstIndex = m_particleCount + i;
+      rStreams.PositionX[dstIndex] = particle.Position.X;
+      rStreams.PositionY[dstIndex] = particle.Position.Y;
+      rStreams.PositionZ[dstIndex] = particle.Position.Z;
+      rStreams.VelocityX[dstIndex] = particle.Velocity.X;
+      rStreams.VelocityY[dstIndex] = particle.Velocity.Y;
+      rStreams.VelocityZ[dstIndex] = particle.Velocity.Z;
+      rStreams.Energy[dstIndex] = particle.Energy;
+      rStreams.Size[dstIndex] = particle.Size;
+      rStreams.StartSize[dstIndex] = particle.StartSize;
+      rStreams.SizeDelta[dstIndex] = particle.EndSize - particle.StartSize;
+      rStreams.InvStartEnergy[dstIndex] = particle.StartEnergy > 0.0f ? 1.0f / particle.StartEnergy : 0.0f;
+      rStreams.TextureId[dstIndex] = particle.TextureId;
+    }
+    m_particleCount += actualCount;
+  }
+
+
+  uint32_t ParticleSystemSoA::UpdateChunk(ParticleStreams& rStreams, const uint32_t startIndex, const uint32_t endIndex, const float deltaTime,
+                                          const Vector3 gravityVelocity) noexcept
+  {
+    float* const pPositionX = rStreams.PositionX.data();
+    float* const pPositionY = rStreams.PositionY.data();
+    float* const pPositionZ = rStreams.PositionZ.data();
+    float* const pVelocityX = rStreams.VelocityX.data();
+    float* const pVelocityY = rStreams.VelocityY.data();
+    float* const pVelocityZ = rStreams.VelocityZ.data();
+    float* const pEnergy = rStreams.Energy.data();
+    float* const pSize = rStreams.Size.data();
+    const float* const pStartSize = rStreams.StartSize.data();
+    const float* const pSizeDelta = rStreams.SizeDelta.data();
+    const float* const pInvStartEnergy = rStreams.InvStartEnergy.data();
+
+    bool hasDeadParticles = false;
+    uint32_t i = startIndex;
+#if defined(LOCAL_PARTICLE_SIMD_SSE2) || defined(LOCAL_PARTICLE_SIMD_NEON)
+    {
+      const SimdValue vDeltaTime = SimdSplat(deltaTime);
+      const SimdValue vOne = SimdSplat(1.0f);
+      const SimdValue vGravityX = SimdSplat(gravityVelocity.X);
+      const SimdValue vGravityY = SimdSplat(gravityVelocity.Y);
+      const SimdValue vGravityZ = SimdSplat(gravityVelocity.Z);
+      uint32_t aliveMask = AllLanesAlive;
+      for (; (i + SimdLanes) <= endIndex; i += SimdLanes)
+      {
+        const SimdValue energy = SimdSub(SimdLoad(pEnergy + i), vDeltaTime);
+        SimdStore(pEnergy + i, energy);
+
+        // Interpolate the size
+        const SimdValue t = SimdSub(vOne, SimdMul(energy, SimdLoad(pInvStartEnergy + i)));
+        SimdStore(pSize + i, SimdAdd(SimdLoad(pStartSize + i), SimdMul(SimdLoad(pSizeDelta + i), t)));
+
+        // Add gravity to velocity and then add the velocity
+        const SimdValue velocityX = SimdAdd(SimdLoad(pVelocityX + i), vGravityX);
+        const SimdValue velocityY = SimdAdd(SimdLoad(pVelocityY + i), vGravityY);
+        const SimdValue velocityZ = SimdAdd(SimdLoad(pVelocityZ + i), vGravityZ);
+        SimdStore(pVelocityX + i, velocityX);
+        SimdStore(pVelocityY + i, velocityY);
+        SimdStore(pVelocityZ + i, velocityZ);
+        SimdStore(pPositionX + i, SimdAdd(SimdLoad(pPositionX + i), SimdMul(velocityX, vDeltaTime)));
+        SimdStore(pPositionY + i, SimdAdd(SimdLoad(pPositionY + i), SimdMul(velocityY, vDeltaTime)));
+        SimdStore(pPositionZ + i, SimdAdd(SimdLoad(pPositionZ + i), SimdMul(velocityZ, vDeltaTime)));
+
+        aliveMask &= SimdGreaterThanZeroMask(energy);
+      }
+      hasDeadParticles = aliveMask != AllLanesAlive;
+    }
+#endif
+    for (; i < endIndex; ++i)
+    {
+      const float energy = pEnergy[i] - deltaTime;
+      pEnergy[i] = energy;
+
+      // Interpolate the size
+      pSize[i] = pStartSize[i] + (pSizeDelta[i] * (1.0f - (energy * pInvStartEnergy[i])));
+
+      // Add gravity to velocity and then add the velocity
+      pVelocityX[i] += gravityVelocity.X;
+      pVelocityY[i] += gravityVelocity.Y;
+      pVelocityZ[i] += gravityVelocity.Z;
+      pPositionX[i] += pVelocityX[i] * deltaTime;
+      pPositionY[i] += pVelocityY[i] * deltaTime;
+      pPositionZ[i] += pVelocityZ[i] * deltaTime;
+      hasDeadParticles |= !(energy > 0.0f);
+    }
+
+    if (!hasDeadParticles)
+    {
+      return endIndex - startIndex;
+    }
+
+    // Fill the holes left by the dead particles with the live particles from the end of the chunk.
+    // Like ParticleSystemGCFast this does not keep the particles in order, but it only moves one particle per dead particle.
+    uint32_t lowIndex = startIndex;
+    uint32_t highIndex = endIndex;
+    while (lowIndex < highIndex)
+    {
+      if (pEnergy[lowIndex] > 0.0f)
+      {
+        ++lowIndex;
+      }
+      else
+      {
+        // Find the last live particle
+        --highIndex;
+        while (highIndex > lowIndex && !(pEnergy[highIndex] > 0.0f))
+        {
+          --highIndex;
+        }
+        if (highIndex > lowIndex)
+        {
+          MoveParticle(rStreams, highIndex, lowIndex);
+          ++lowIndex;
+        }
+      }
+    }
+    return lowIndex - startIndex;
+  }
+
+
+  void ParticleSystemSoA::CompactChunks(ParticleStreams& rStreams, const ReadOnlySpan<uint32_t> chunkAliveCount, uint32_t& rParticleCount) noexcept
+  {
+    // Each chunk has its live particles at the start of the chunk.
+    // The gaps at the end of the chunks that lie inside the final live range are filled with the live particles that lie outside of it,
+    // so we only move as many particles as there are gaps.
+    uint32_t totalAlive = 0;
+    for (const uint32_t aliveCount : chunkAliveCount)
+    {
+      totalAlive += aliveCount;
+    }
+
+    std::size_t srcChunkIndex = chunkAliveCount.size();
+    uint32_t srcEnd = 0;
+    uint32_t srcBegin = 0;
+    for (std::size_t chunkIndex = 0; chunkIndex < chunkAliveCount.size(); ++chunkIndex)
+    {
+      const auto chunkStart = static_cast<uint32_t>(chunkIndex * ChunkSize);
+      if (chunkStart >= totalAlive)
+      {
+        break;
+      }
+      uint32_t gapBegin = chunkStart + chunkAliveCount[chunkIndex];
+      const uint32_t gapEnd = std::min(chunkStart + ChunkSize, totalAlive);
+      while (gapBegin < gapEnd)
+      {
+        // Find the next range of live particles outside of the final live range (searching backwards from the last chunk)
+        while (srcBegin >= srcEnd)
+        {
+          assert(srcChunkIndex > 0u);
+          --srcChunkIndex;
+          const auto srcChunkStart = static_cast<uint32_t>(srcChunkIndex * ChunkSize);
+          srcBegin = std::max(srcChunkStart, totalAlive);
+          srcEnd = std::max(srcChunkStart + chunkAliveCount[srcChunkIndex], srcBegin);
+        }
+        const uint32_t count = std::min(gapEnd - gapBegin, srcEnd - srcBegin);
+        MoveParticles(rStreams, srcEnd - count, gapBegin, count);
+        srcEnd -= count;
+        gapBegin += count;
+      }
+    }
+    assert(totalAlive <= rParticleCount);
+    rParticleCount = totalAlive;
+  }
+
+
+  void ParticleSystemSoA::GatherParticles(Span<Particle> dst, const ParticleStreams& streams, const uint32_t startIndex) noexcept
+  {
+    // Only the fields used by the particle draw implementations are written
+    for (std::size_t i = 0; i < dst.size(); ++i)
+    {
+      const std::size_t srcIndex = startIndex + i;
+      Particle& rParticle = dst[i];
+      rParticle.Position = Vector3(streams.PositionX[srcIndex], streams.PositionY[srcIndex], streams.PositionZ[srcIndex]);
+      rParticle.Velocity = Vector3(streams.VelocityX[srcIndex], streams.VelocityY[srcIndex], streams.VelocityZ[srcIndex]);
+      rParticle.Energy = streams.Energy[srcIndex];
+      rParticle.Size = streams.Size[srcIndex];
+      rParticle.TextureId = streams.TextureId[srcIndex];
+    }
+  }
+}
@@ -0,0 +1,120 @@
+#ifndef PS_GLES3_PARTICLESYSTEM_PARTICLESYSTEMSOA_HPP
+#define PS_GLES3_PARTICLESYSTEM_PARTICLESYSTEMSOA_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "Draw/IParticleDraw.hpp"
+#include "Emit/IParticleEmitter.hpp"
+#include "IParticleContainer.hpp"
+#include "IParticleSystem.hpp"
+#include "Particle.hpp"
+
+namespace Fsl
+{
+  struct DemoTime;
+  class JobSystem;
+
+  //! @brief A particle system that stores the particles as a structure of arrays.
+  //!        - The update is done with 4 wide SIMD (SSE2/NEON) with a scalar fallback.
+  //!        - The particles are split into fixed size chunks that can be updated in parallel using a JobSystem.
+  //!        - Dead particles are removed in two steps, first the holes inside each chunk are filled in parallel and then the gaps left at the
+  //!          end of the chunks are filled with particles from the end of the live range. Like ParticleSystemGCFast the order is not kept.
+  //!        - The draw call gathers the live particles into a array of Particle so the existing IParticleDraw implementations can be used.
+  class ParticleSystemSoA
+    : public IParticleSystem
+    , public IParticleContainer
+  {
+    struct ParticleStreams
+    {
+      std::vector<float> PositionX;
+      std::vector<float> PositionY;
+      std::vector<float> PositionZ;
+      std::vector<float> VelocityX;
+      std::vector<float> VelocityY;
+      std::vector<float> VelocityZ;
+      std::vector<float> Energy;
+      std::vector<float> Size;
+      std::vector<float> StartSize;
+      //! EndSize - StartSize
+      std::vector<float> SizeDelta;
+      //! 1.0 / StartEnergy
+      std::vector<float> InvStartEnergy;
+      std::vector<uint8_t> TextureId;
+
+      explicit ParticleStreams(const std::size_t capacity);
+    };
+
+    ParticleStreams m_streams;
+    std::vector<Particle> m_drawParticles;
+    std::vector<uint32_t> m_chunkAliveCount;
+
+    std::deque<std::shared_ptr<IParticleEmitter>> m_emitters;
+    std::shared_ptr<IParticleDraw> m_particleDraw;
+    std::shared_ptr<JobSystem> m_jobSystem;
+    Vector3 m_gravity;
+    uint32_t m_capacity;
+    uint32_t m_particleCount{0};
+
+  public:
+    //! The number of particles in one update chunk (a multiple of the SIMD lane count)
+    static constexpr uint32_t ChunkSize = 16 * 1024;
+
+    static constexpr uint32_t ParticleRecordSize()
+    {
+      return static_cast<uint32_t>(sizeof(Particle));
+    }
+
+    //! @param jobSystem if null the update runs on the calling thread
+    ParticleSystemSoA(std::shared_ptr<IParticleDraw> particleDraw, const std::size_t capacity, std::shared_ptr<JobSystem> jobSystem);
+
+    uint32_t GetParticleCount() const override;
+    void AddEmitter(const std::shared_ptr<IParticleEmitter>& emitter) override;
+    void Update(const DemoTime& demoTime) override;
+    void Draw(const ParticleDrawContext& context) override;
+
+    //! Added by IParticleContainer
+    void AddParticles(const Particle* pParticles, const std::size_t& count) override;
+
+  private:
+    static uint32_t UpdateChunk(ParticleStreams& rStreams, const uint32_t startIndex, const uint32_t endIndex, const float deltaTime,
+                                const Vector3 gravityVelocity) noexcept;
+    static void CompactChunks(ParticleStreams& rStreams, const ReadOnlySpan<uint32_t> chunkAliveCount, uint32_t& rParticleCount) noexcept;
+    static void GatherParticles(Span<Particle> dst, const ParticleStreams& streams, const uint32_t startIndex) noexcept;
+  };
+}
+
+#endif
@@ -37,7 +37,9 @@
 #include <FslUtil/OpenGLES3/GLUtil.hpp>
 #include <GLES3/gl3.h>
 #include <iostream>
+#include "OptionParser.hpp"
 #include "ParticleSystemBasicScene.hpp"
+#include "ParticleSystemCpuBenchmark.hpp"
 #include "ParticleSystemScene.hpp"
 
 namespace Fsl
@@ -54,7 +56,12 @@ namespace Fsl
     RegisterExtension(m_uiExtension);
 
     auto optionParser = config.GetOptions<OptionParser>();
-
+    if (optionParser->IsCpuBenchmarkEnabled())
+    {
+      ParticleSystemCpuBenchmark::Run();
+      GetDemoAppControl()->RequestExit();
+      return;
+    }
 
     switch (optionParser->GetScene())
     {
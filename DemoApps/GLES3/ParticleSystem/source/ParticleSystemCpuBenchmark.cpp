@@ -0,0 +1,149 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "ParticleSystemCpuBenchmark.hpp"
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/HighResolutionTimer.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/Time/TimeSpanUtil.hpp>
+#include <FslDemoApp/Base/DemoTime.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+#include "PS/ParticleSystemOneArray.hpp"
+#include "PS/ParticleSystemSoA.hpp"
+#include "PS/ParticleSystemTwoArrays.hpp"
+
+namespace Fsl::ParticleSystemCpuBenchmark
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr std::array<uint32_t, 5> ParticleCounts = {100000, 250000, 500000, 1000000, 2000000};
+      constexpr uint32_t WarmupFrames = 5;
+      constexpr uint32_t MeasureFrames = 60;
+      constexpr int32_t FrameTimeMicroseconds = 16667;
+    }
+
+    struct BenchmarkResult
+    {
+      uint64_t ProcessedParticles{0};
+      TimeSpan Time;
+
+      double ParticlesPerMillisecond() const
+      {
+        const double milliseconds = Time.TotalMilliseconds();
+        return milliseconds > 0.0 ? static_cast<double>(ProcessedParticles) / milliseconds : 0.0;
+      }
+    };
+
+
+    std::vector<Particle> CreateParticles(const uint32_t count)
+    {
+      // Use a fixed seed so all implementations see the same particles
+      std::mt19937 random(1234);
+      std::uniform_real_distribution<float> positionDist(-1.0f, 1.0f);
+      std::uniform_real_distribution<float> velocityDist(-4.0f, 4.0f);
+      std::uniform_real_distribution<float> sizeDist(0.7f, 1.0f);
+      // The short lifetimes ensure that the garbage collection is part of the measurement
+      std::uniform_real_distribution<float> energyDist(0.1f, 2.0f);
+
+      std::vector<Particle> particles;
+      particles.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        particles.emplace_back(Vector3(positionDist(random), positionDist(random), positionDist(random)),
+                               Vector3(velocityDist(random), velocityDist(random), velocityDist(random)), sizeDist(random), 0.0f,
+                               energyDist(random), uint8_t(0));
+      }
+      return particles;
+    }
+
+
+    template <typename TParticleSystem>
+    BenchmarkResult Measure(TParticleSystem& rParticleSystem, const std::vector<Particle>& particles)
+    {
+      const auto particleCount = static_cast<uint32_t>(particles.size());
+      const TimeSpan frameTime = TimeSpanUtil::FromMicroseconds(LocalConfig::FrameTimeMicroseconds);
+      HighResolutionTimer timer;
+      BenchmarkResult result;
+      std::size_t sourceIndex = 0;
+      for (uint32_t frame = 0; frame < (LocalConfig::WarmupFrames + LocalConfig::MeasureFrames); ++frame)
+      {
+        // Top up the particle system so every frame processes the requested amount of particles
+        uint32_t missing = particleCount - rParticleSystem.GetParticleCount();
+        while (missing > 0u)
+        {
+          const auto count = static_cast<uint32_t>(std::min(static_cast<std::size_t>(missing), particles.size() - sourceIndex));
+          rParticleSystem.AddParticles(particles.data() + sourceIndex, count);
+          sourceIndex = (sourceIndex + count) % particles.size();
+          missing -= count;
+        }
+
+        const DemoTime demoTime(TickCount(frameTime.Ticks() * (frame + 1)), frameTime);
+        const auto startTime = timer.GetTimestamp();
+        rParticleSystem.Update(demoTime);
+        const auto endTime = timer.GetTimestamp();
+        if (frame >= LocalConfig::WarmupFrames)
+        {
+          result.ProcessedParticles += particleCount;
+          result.Time += endTime - startTime;
+        }
+      }
+      return result;
+    }
+  }
+
+
+  void Run()
+  {
+    auto jobSystem = std::make_shared<JobSystem>();
+    FSLLOG3_INFO("Particle system CPU benchmark, frames: {}, worker threads: {}", LocalConfig::MeasureFrames, jobSystem->GetWorkerThreadCount());
+    for (const uint32_t particleCount : LocalConfig::ParticleCounts)
+    {
+      const std::vector<Particle> particles = CreateParticles(particleCount);
+      // The particle systems are only updated so no draw implementation is needed
+      ParticleSystemOneArray oneArray(nullptr, particleCount);
+      ParticleSystemTwoArrays twoArrays(nullptr, particleCount);
+      ParticleSystemSoA soa(nullptr, particleCount, nullptr);
+      ParticleSystemSoA soaParallel(nullptr, particleCount, jobSystem);
+
+      FSLLOG3_INFO("Particles: {}", particleCount);
+      FSLLOG3_INFO("- OneArray:        {:.0f} particles/ms", Measure(oneArray, particles).ParticlesPerMillisecond());
+      FSLLOG3_INFO("- TwoArrays:       {:.0f} particles/ms", Measure(twoArrays, particles).ParticlesPerMillisecond());
+      FSLLOG3_INFO("- SoA:             {:.0f} particles/ms", Measure(soa, particles).ParticlesPerMillisecond());
+      FSLLOG3_INFO("- SoA (parallel):  {:.0f} particles/ms", Measure(soaParallel, particles).ParticlesPerMillisecond());
+    }
+  }
+}
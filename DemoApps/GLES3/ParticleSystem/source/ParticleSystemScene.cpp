@@ -31,6 +31,7 @@
 
 #include "ParticleSystemScene.hpp"
 #include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoService/Graphics/IGraphicsService.hpp>
 #include <FslGraphics/Colors.hpp>
@@ -54,6 +55,7 @@
 #include "PS/Draw/ParticleDrawQuadsGLES3.hpp"
 #include "PS/Emit/BoxEmitter.hpp"
 #include "PS/ParticleSystemOneArray.hpp"
+#include "PS/ParticleSystemSoA.hpp"
 #include "PS/ParticleSystemTwoArrays.hpp"
 #include "PSGpu/ParticleSystemGLES3.hpp"
 #include "PSGpu/ParticleSystemSnow.hpp"
@@ -148,9 +150,15 @@ namespace Fsl
     , m_rotationSpeed(0.0f, 0.5f, 0.0f)
     , m_rotate(false)
     , m_particleSystemType(ParticleSystemType::GeometryShader)
+    , m_backend(config.GetOptions<OptionParser>()->GetBackend())
   {
     m_camera.SetZoom(DefaultZoom);
 
+    if (m_backend == CpuParticleBackend::SoA)
+    {
+      m_jobSystem = std::make_shared<JobSystem>();
+    }
+
     SetParticleSystem(m_particleSystemType, true);
 
     m_allowAdvancedTechniques = GLUtil::HasExtension("GL_EXT_geometry_shader");
@@ -630,17 +638,16 @@ namespace Fsl
       typeEx = ParticleSystemType::Instancing;
     }
 
-    using particle_system_type = ParticleSystemOneArray;
-    // using particle_system_type = ParticleSystemTwoArrays;
+    const uint32_t particleRecordSize =
+      m_backend == CpuParticleBackend::SoA ? ParticleSystemSoA::ParticleRecordSize() : ParticleSystemOneArray::ParticleRecordSize();
 
     switch (typeEx)
     {
     case ParticleSystemType::Points:
-      particleDraw = std::make_shared<ParticleDrawPointsGLES3>(GetContentManager(), ParticleCapacity, particle_system_type::ParticleRecordSize());
+      particleDraw = std::make_shared<ParticleDrawPointsGLES3>(GetContentManager(), ParticleCapacity, particleRecordSize);
       break;
     case ParticleSystemType::GeometryShader:
-      particleDraw =
-        std::make_shared<ParticleDrawGeometryShaderGLES3>(GetContentManager(), ParticleCapacity, particle_system_type::ParticleRecordSize());
+      particleDraw = std::make_shared<ParticleDrawGeometryShaderGLES3>(GetContentManager(), ParticleCapacity, particleRecordSize);
       break;
     case ParticleSystemType::Quads:
     default:
@@ -649,7 +656,14 @@ namespace Fsl
     }
     if (particleDraw)
     {
-      m_particleSystem = std::make_shared<particle_system_type>(particleDraw, ParticleCapacity);
+      if (m_backend == CpuParticleBackend::SoA)
+      {
+        m_particleSystem = std::make_shared<ParticleSystemSoA>(particleDraw, ParticleCapacity, m_jobSystem);
+      }
+      else
+      {
+        m_particleSystem = std::make_shared<ParticleSystemOneArray>(particleDraw, ParticleCapacity);
+      }
 
       m_boxEmitter = std::make_shared<BoxEmitter>();
       m_particleSystem->AddEmitter(m_boxEmitter);
@@ -41,6 +41,7 @@
 #include <FslUtil/OpenGLES3/GLVertexBuffer.hpp>
 #include <array>
 #include "AScene.hpp"
+#include "OptionParser.hpp"
 #include "PS/ParticleDrawContext.hpp"
 
 namespace Fsl
@@ -48,6 +49,7 @@ namespace Fsl
   class BoxEmitter;
   class IGraphicsService;
   class IParticleSystem;
+  class JobSystem;
   class ParticleSystemGLES3;
   class ParticleSystemSnow;
 
@@ -101,6 +103,9 @@ namespace Fsl
     bool m_rotate;
 
     ParticleSystemType m_particleSystemType;
+    CpuParticleBackend m_backend;
+    //! Only created for the SoA backend
+    std::shared_ptr<JobSystem> m_jobSystem;
 
   public:
     ParticleSystemScene(const DemoAppConfig& config, const std::shared_ptr<UIDemoAppExtension>& uiExtension);
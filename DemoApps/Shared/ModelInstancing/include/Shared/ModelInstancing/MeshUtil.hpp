@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Math/BoundingBox.hpp>
 #include <FslGraphics/Vertices/ReadOnlyFlexVertexSpanUtil_Vector.hpp>
 #include <FslGraphics/Vertices/VertexPositionColorNormalTexture.hpp>
 #include <FslGraphics3D/BasicScene/GenericMesh.hpp>
@@ -57,6 +58,9 @@ namespace Fsl::MeshUtil
 
 
   DemoMeshRecord ToSingleMesh(const DemoScene& scene);
+
+  //! @brief Calculate the axis aligned bounding box of the mesh vertices
+  BoundingBox CalcBounds(const DemoMeshRecord& mesh);
 }
 
 #endif
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Math/BoundingBox.hpp>
 #include <FslBase/NumericCast.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
@@ -45,6 +46,7 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace Fsl
 {
@@ -98,18 +100,21 @@ namespace Fsl
       std::shared_ptr<UI::FmtValueLabel<uint32_t>> LabelInstanceCount;
       std::shared_ptr<UI::FmtValueLabel<uint32_t>> LabelTotalVertices;
       std::shared_ptr<UI::FmtValueLabel<uint32_t>> LabelTotalIndices;
+      std::shared_ptr<UI::FmtValueLabel<uint32_t>> LabelVisibleInstances;
 
       StatsOverlayUI() = default;
 
       StatsOverlayUI(std::shared_ptr<UI::BaseWindow> mainOverlay, std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelVertices,
                      std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelIndices, std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelInstanceCount,
-                     std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelTotalVertices, std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelTotalIndices)
+                     std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelTotalVertices, std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelTotalIndices,
+                     std::shared_ptr<UI::FmtValueLabel<uint32_t>> labelVisibleInstances)
         : MainOverlay(std::move(mainOverlay))
         , LabelVertices(std::move(labelVertices))
         , LabelIndices(std::move(labelIndices))
         , LabelInstanceCount(std::move(labelInstanceCount))
         , LabelTotalVertices(std::move(labelTotalVertices))
         , LabelTotalIndices(std::move(labelTotalIndices))
+        , LabelVisibleInstances(std::move(labelVisibleInstances))
       {
       }
     };
@@ -119,11 +124,33 @@ namespace Fsl
       std::shared_ptr<UI::BaseWindow> MainWindow;
       std::shared_ptr<UI::SliderAndFmtValueLabel<uint32_t>> Instances;
       std::shared_ptr<UI::Switch> SwitchRotate;
+      std::shared_ptr<UI::Switch> SwitchCull;
       std::shared_ptr<UI::BackgroundLabelButton> ButtonDefault;
 
       StatsOverlayUI Stats;
     };
 
+    //! The instance bounding boxes stored as structure of arrays so they can be frustum culled in batches
+    struct InstanceBoundsRecord
+    {
+      std::vector<float> MinX;
+      std::vector<float> MinY;
+      std::vector<float> MinZ;
+      std::vector<float> MaxX;
+      std::vector<float> MaxY;
+      std::vector<float> MaxZ;
+    };
+
+    struct CullRecord
+    {
+      bool IsValid{false};
+      InstanceBoundsRecord InstanceBounds;
+      std::vector<uint8_t> PlaneCache;
+      std::vector<uint32_t> VisibleMask;
+      std::vector<MeshInstanceData> VisibleInstanceData;
+      uint32_t VisibleInstanceCount{0};
+    };
+
 
     // The UI event listener is responsible for forwarding events to this classes implementation of the UI::EventListener (while its still alive).
     UI::CallbackEventListenerScope m_uiEventListener;
@@ -138,6 +165,7 @@ namespace Fsl
     Vector3 m_rotation;
     MatrixInfo m_matrices;
     std::vector<MeshInstanceData> m_instanceData;
+    CullRecord m_cull;
 
   public:
     explicit ModelInstancingShared(const DemoAppConfig& config);
@@ -173,11 +201,17 @@ namespace Fsl
     }
     void SetStats(const ModelRenderStats& stats);
 
+    //! @brief Set the bounds of the mesh, this enables frustum culling of the instances.
+    void SetMeshBounds(const BoundingBox& meshBounds);
+
     ReadOnlySpan<MeshInstanceData> GetInstanceSpan();
 
   private:
     void SetDefaultValues();
     void ToggleRotate();
+    void ToggleCull();
+    bool IsCullEnabled() const;
+    void UpdateVisibleInstances();
 
     static UIRecord CreateUI(UI::Theme::IThemeControlFactory& uiFactory, const MeshInstanceSetup instanceSetup);
     static StatsOverlayUI CreateStatsOverlayUI(UI::Theme::IThemeControlFactory& uiFactory, const std::shared_ptr<UI::WindowContext>& context);
@@ -73,4 +73,20 @@ namespace Fsl::MeshUtil
     }
     return meshRecord;
   }
+
+
+  BoundingBox CalcBounds(const DemoMeshRecord& mesh)
+  {
+    if (mesh.Vertices.empty())
+    {
+      return {};
+    }
+    BoundingBox bounds(mesh.Vertices.front().Position, mesh.Vertices.front().Position);
+    for (const auto& vertex : mesh.Vertices)
+    {
+      bounds.Min = Vector3::Min(bounds.Min, vertex.Position);
+      bounds.Max = Vector3::Max(bounds.Max, vertex.Position);
+    }
+    return bounds;
+  }
 }
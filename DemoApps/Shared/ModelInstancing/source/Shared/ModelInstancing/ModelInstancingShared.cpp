@@ -31,6 +31,8 @@
 
 #include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/FrustumCullUtil.hpp>
 #include <FslBase/Math/MathHelper.hpp>
 #include <FslBase/Math/MathHelper_Clamp.hpp>
 #include <FslBase/NumericCast.hpp>
@@ -55,6 +57,8 @@
 #include <FslSimpleUI/Theme/Base/IThemeResources.hpp>
 #include <Shared/ModelInstancing/ModelInstancingShared.hpp>
 #include <Shared/ModelInstancing/OptionParser.hpp>
+#include <array>
+#include <bit>
 #include <cassert>
 
 namespace Fsl
@@ -67,6 +71,7 @@ namespace Fsl
 
       constexpr float DefaultZoom = 14.0f;
       constexpr bool RotateDefault = true;
+      constexpr bool CullDefault = true;
 
       constexpr float SpeedX = -0.6f;
       constexpr float SpeedY = -0.3f;
@@ -164,6 +169,9 @@ namespace Fsl
     case VirtualKey::R:
       ToggleRotate();
       break;
+    case VirtualKey::C:
+      ToggleCull();
+      break;
     case VirtualKey::Space:
       SetDefaultValues();
       break;
@@ -205,6 +213,7 @@ namespace Fsl
       m_rotation.Z = MathHelper::WrapAngle(m_rotation.Z + (m_rotationSpeed.Z * demoTime.DeltaTime));
     }
     m_matrices.Model = Matrix::CreateRotationX(m_rotation.X) * Matrix::CreateRotationY(m_rotation.Y) * Matrix::CreateRotationZ(m_rotation.Z);
+    UpdateVisibleInstances();
   }
 
 
@@ -235,8 +244,51 @@ namespace Fsl
   }
 
 
+  void ModelInstancingShared::SetMeshBounds(const BoundingBox& meshBounds)
+  {
+    std::array<Vector3, BoundingBox::CornerCount> corners{};
+    meshBounds.GetCorners(corners);
+
+    InstanceBoundsRecord& rBounds = m_cull.InstanceBounds;
+    const std::size_t instanceCount = m_instanceData.size();
+    rBounds.MinX.resize(instanceCount);
+    rBounds.MinY.resize(instanceCount);
+    rBounds.MinZ.resize(instanceCount);
+    rBounds.MaxX.resize(instanceCount);
+    rBounds.MaxY.resize(instanceCount);
+    rBounds.MaxZ.resize(instanceCount);
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+      const Matrix& matWorld = m_instanceData[i].MatWorld;
+      Vector3 min = Vector3::Transform(corners[0], matWorld);
+      Vector3 max = min;
+      for (std::size_t cornerIndex = 1; cornerIndex < corners.size(); ++cornerIndex)
+      {
+        const Vector3 corner = Vector3::Transform(corners[cornerIndex], matWorld);
+        min = Vector3::Min(min, corner);
+        max = Vector3::Max(max, corner);
+      }
+      rBounds.MinX[i] = min.X;
+      rBounds.MinY[i] = min.Y;
+      rBounds.MinZ[i] = min.Z;
+      rBounds.MaxX[i] = max.X;
+      rBounds.MaxY[i] = max.Y;
+      rBounds.MaxZ[i] = max.Z;
+    }
+    m_cull.PlaneCache.assign(FrustumCullUtil::CalcPlaneCacheSize(instanceCount), FrustumCullUtil::InvalidPlaneIndex);
+    m_cull.VisibleMask.resize(FrustumCullUtil::CalcMaskWordCount(instanceCount));
+    m_cull.VisibleInstanceData.resize(instanceCount);
+    m_cull.IsValid = true;
+    UpdateVisibleInstances();
+  }
+
+
   ReadOnlySpan<MeshInstanceData> ModelInstancingShared::GetInstanceSpan()
   {
+    if (IsCullEnabled())
+    {
+      return SpanUtil::AsReadOnlySpan(m_cull.VisibleInstanceData, 0, m_cull.VisibleInstanceCount);
+    }
     return SpanUtil::AsReadOnlySpan(m_instanceData, 0, GetInstanceCount());
   }
 
@@ -244,6 +296,7 @@ namespace Fsl
   void ModelInstancingShared::SetDefaultValues()
   {
     m_ui.SwitchRotate->SetIsChecked(LocalConfig::RotateDefault);
+    m_ui.SwitchCull->SetIsChecked(LocalConfig::CullDefault);
     m_ui.Instances->SetValue(m_instanceSetup.MaxInstances);
     m_rotation = {LocalConfig::SpeedX * LocalConfig::StartMod, LocalConfig::SpeedY * LocalConfig::StartMod,
                   LocalConfig::SpeedZ * LocalConfig::StartMod};
@@ -256,6 +309,58 @@ namespace Fsl
   }
 
 
+  void ModelInstancingShared::ToggleCull()
+  {
+    m_ui.SwitchCull->Toggle();
+  }
+
+
+  bool ModelInstancingShared::IsCullEnabled() const
+  {
+    return m_cull.IsValid && m_ui.SwitchCull->IsChecked();
+  }
+
+
+  void ModelInstancingShared::UpdateVisibleInstances()
+  {
+    const uint32_t instanceCount = GetInstanceCount();
+    if (!IsCullEnabled())
+    {
+      m_cull.VisibleInstanceCount = instanceCount;
+      m_ui.Stats.LabelVisibleInstances->SetContent(instanceCount);
+      return;
+    }
+
+    // The shader applies the instance matrix before the model and view matrix, so the frustum of the combined model view projection
+    // matrix is in instance space which is where the instance bounds are stored.
+    const BoundingFrustum frustum(m_matrices.Model * m_matrices.View * m_matrices.Proj);
+    const InstanceBoundsRecord& bounds = m_cull.InstanceBounds;
+    const FrustumCullUtil::BoundingBoxSpans boxes{
+      SpanUtil::AsReadOnlySpan(bounds.MinX, 0, instanceCount), SpanUtil::AsReadOnlySpan(bounds.MinY, 0, instanceCount),
+      SpanUtil::AsReadOnlySpan(bounds.MinZ, 0, instanceCount), SpanUtil::AsReadOnlySpan(bounds.MaxX, 0, instanceCount),
+      SpanUtil::AsReadOnlySpan(bounds.MaxY, 0, instanceCount), SpanUtil::AsReadOnlySpan(bounds.MaxZ, 0, instanceCount)};
+    FrustumCullUtil::Cull(frustum, boxes, SpanUtil::AsSpan(m_cull.PlaneCache, 0, FrustumCullUtil::CalcPlaneCacheSize(instanceCount)),
+                          SpanUtil::AsSpan(m_cull.VisibleMask));
+
+    // Compact the visible instances
+    uint32_t dstIndex = 0;
+    const std::size_t wordCount = FrustumCullUtil::CalcMaskWordCount(instanceCount);
+    for (std::size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+    {
+      uint32_t bits = m_cull.VisibleMask[wordIndex];
+      while (bits != 0u)
+      {
+        const auto bitIndex = static_cast<std::size_t>(std::countr_zero(bits));
+        m_cull.VisibleInstanceData[dstIndex] = m_instanceData[(wordIndex * 32u) + bitIndex];
+        ++dstIndex;
+        bits &= bits - 1u;
+      }
+    }
+    m_cull.VisibleInstanceCount = dstIndex;
+    m_ui.Stats.LabelVisibleInstances->SetContent(dstIndex);
+  }
+
+
   ModelInstancingShared::UIRecord ModelInstancingShared::CreateUI(UI::Theme::IThemeControlFactory& uiFactory, const MeshInstanceSetup instanceSetup)
   {
     auto context = uiFactory.GetContext();
@@ -274,12 +379,17 @@ namespace Fsl
     switchRotate->SetAlignmentX(UI::ItemAlignment::Stretch);
     switchRotate->SetAlignmentY(UI::ItemAlignment::Stretch);
 
+    auto switchCull = uiFactory.CreateSwitch("Frustum cull", LocalConfig::CullDefault);
+    switchCull->SetAlignmentX(UI::ItemAlignment::Stretch);
+    switchCull->SetAlignmentY(UI::ItemAlignment::Stretch);
+
     auto stack = std::make_shared<UI::StackLayout>(context);
     stack->SetAlignmentX(UI::ItemAlignment::Stretch);
     stack->SetAlignmentY(UI::ItemAlignment::Center);
     stack->AddChild(lblInstances);
     stack->AddChild(sliderInstances);
     stack->AddChild(switchRotate);
+    stack->AddChild(switchCull);
 
     auto stats = CreateStatsOverlayUI(uiFactory, context);
 
@@ -300,7 +410,7 @@ namespace Fsl
       stats.LabelInstanceCount->SetBinding(UI::FmtValueLabel<uint32_t>::PropertyContent, binding);
     }
 
-    return {fillLayout, sliderInstances, switchRotate, btnDefault, stats};
+    return {fillLayout, sliderInstances, switchRotate, switchCull, btnDefault, stats};
   }
 
 
@@ -312,17 +422,20 @@ namespace Fsl
     auto lblDesc2 = uiFactory.CreateLabel("Instances:");
     auto lblDesc3 = uiFactory.CreateLabel("Total vertices:");
     auto lblDesc4 = uiFactory.CreateLabel("Total indices:");
+    auto lblDesc5 = uiFactory.CreateLabel("Visible instances:");
 
     auto lbl0 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl1 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl2 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(1));
     auto lbl3 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl4 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
+    auto lbl5 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     lbl0->SetAlignmentX(UI::ItemAlignment::Far);
     lbl1->SetAlignmentX(UI::ItemAlignment::Far);
     lbl2->SetAlignmentX(UI::ItemAlignment::Far);
     lbl3->SetAlignmentX(UI::ItemAlignment::Far);
     lbl4->SetAlignmentX(UI::ItemAlignment::Far);
+    lbl5->SetAlignmentX(UI::ItemAlignment::Far);
 
     auto layout = std::make_shared<UI::GridLayout>(context);
     layout->AddColumnDefinition(UI::GridColumnDefinition(UI::GridUnitType::Auto));
@@ -333,22 +446,25 @@ namespace Fsl
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
+    layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
 
     layout->AddChild(lblDesc0, 0, 0);
     layout->AddChild(lblDesc1, 0, 1);
     layout->AddChild(lblDesc2, 0, 2);
     layout->AddChild(lblDesc3, 0, 3);
     layout->AddChild(lblDesc4, 0, 4);
+    layout->AddChild(lblDesc5, 0, 5);
 
     layout->AddChild(lbl0, 1, 0);
     layout->AddChild(lbl1, 1, 1);
     layout->AddChild(lbl2, 1, 2);
     layout->AddChild(lbl3, 1, 3);
     layout->AddChild(lbl4, 1, 4);
+    layout->AddChild(lbl5, 1, 5);
 
     std::shared_ptr<UI::Background> mainLayout = uiFactory.CreateBackgroundWindow(UI::Theme::WindowType::Transparent, layout);
     mainLayout->SetAlignmentX(UI::ItemAlignment::Far);
-    return {mainLayout, lbl0, lbl1, lbl2, lbl3, lbl4};
+    return {mainLayout, lbl0, lbl1, lbl2, lbl3, lbl4, lbl5};
   }
 
 }
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/Path.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
 #include <FslSimpleUI/App/UIDemoAppExtension.hpp>
 #include <FslSimpleUI/Base/System/CallbackEventListenerScope.hpp>
@@ -39,6 +40,7 @@
 namespace Fsl
 {
   class IContentManager;
+  class OptionParser;
   namespace UI::Theme
   {
     class IThemeControlFactory;
@@ -78,7 +80,10 @@ namespace Fsl
     void Draw();
 
   private:
-    UIRecord CreateUI(const IContentManager& contentManager, const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory);
+    UIRecord CreateUI(const IContentManager& contentManager, const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory,
+                      const OptionParser& options);
+    void RunLoadBenchmark(const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory, const IO::Path& xmlPath, const IO::Path& binaryPath,
+                          const uint32_t iterations);
   };
 }
 
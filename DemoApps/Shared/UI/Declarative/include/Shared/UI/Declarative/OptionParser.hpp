@@ -39,6 +39,8 @@ namespace Fsl
   class OptionParser final : public ADemoOptionParser
   {
     IO::Path m_saveFilename;
+    IO::Path m_saveCompiledFilename;
+    uint32_t m_loadBenchmarkIterations{0};
 
   public:
     OptionParser() = default;
@@ -49,6 +51,17 @@ namespace Fsl
       return m_saveFilename;
     }
 
+    IO::Path TryGetCompiledUISaveFilename() const
+    {
+      return m_saveCompiledFilename;
+    }
+
+    //! @brief The number of times the UI should be loaded from xml and binary when benchmarking (0 = disabled)
+    uint32_t GetLoadBenchmarkIterations() const
+    {
+      return m_loadBenchmarkIterations;
+    }
+
   protected:
     void OnArgumentSetup(std::deque<Option>& rOptions) override;
     OptionParseResult OnParse(const int32_t cmdId, const StringViewLite& strOptArg) override;
@@ -29,19 +29,27 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/File.hpp>
 #include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/IO/FmtPathView.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/HighResolutionTimer.hpp>
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslSimpleUI/App/Theme/ThemeSelector.hpp>
 #include <FslSimpleUI/Base/IWindowManager.hpp>
 #include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryReader.hpp>
+#include <FslSimpleUI/Declarative/UICompiler.hpp>
 #include <FslSimpleUI/Declarative/UIReader.hpp>
 #include <FslSimpleUI/Declarative/UIXsdWriter.hpp>
 #include <FslSimpleUI/Theme/Base/IThemeControlFactory.hpp>
 #include <FslSimpleUI/Theme/Base/IThemeResources.hpp>
 #include <Shared/UI/Declarative/DeclarativeShared.hpp>
 #include <Shared/UI/Declarative/OptionParser.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 namespace Fsl
 {
@@ -51,6 +59,26 @@ namespace Fsl
     constexpr IO::PathView DeclarativeUI("DeclarativeUI.xml");
   }
 
+  namespace
+  {
+    struct LoadTimings
+    {
+      TimeSpan Total;
+      TimeSpan Min{std::numeric_limits<int64_t>::max()};
+
+      void Add(const TimeSpan time)
+      {
+        Total += time;
+        Min = std::min(Min, time);
+      }
+
+      double AverageMilliseconds(const uint32_t iterations) const
+      {
+        return iterations > 0 ? Total.TotalMilliseconds() / static_cast<double>(iterations) : 0.0;
+      }
+    };
+  }
+
   DeclarativeShared::DeclarativeShared(const DemoAppConfig& config)
     : m_uiEventListener(this)
     , m_uiExtension(std::make_shared<UIDemoAppExtension>(config, m_uiEventListener.GetListener(), LocalConfig::MainUIAtlas))
@@ -75,7 +103,7 @@ namespace Fsl
       }
 
 
-      m_uiRecord = CreateUI(*contentManager, uiFactory);
+      m_uiRecord = CreateUI(*contentManager, uiFactory, *config.GetOptions<OptionParser>());
 
       // Register the root layout with the window manager
       m_uiExtension->GetWindowManager()->Add(m_uiRecord.Main);
@@ -121,7 +149,8 @@ namespace Fsl
 
 
   DeclarativeShared::UIRecord DeclarativeShared::CreateUI(const IContentManager& contentManager,
-                                                          const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory)
+                                                          const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory,
+                                                          const OptionParser& options)
   {
     UI::Declarative::ControlFactory factory(uiFactory);
 
@@ -131,8 +160,56 @@ namespace Fsl
 
     FSLLOG3_INFO("Loading UI from '{}'", LocalConfig::DeclarativeUI);
     auto fullPath = IO::Path::Combine(contentManager.GetContentPath(), LocalConfig::DeclarativeUI);
+
+    const IO::Path saveCompiledFilename = options.TryGetCompiledUISaveFilename();
+    if (!saveCompiledFilename.IsEmpty())
+    {
+      FSLLOG3_INFO("Saving compiled UI to '{}'", saveCompiledFilename);
+      IO::File::WriteAllBytes(saveCompiledFilename, UI::Declarative::UICompiler::Compile(factory, fullPath));
+    }
+    if (options.GetLoadBenchmarkIterations() > 0)
+    {
+      RunLoadBenchmark(uiFactory, fullPath, saveCompiledFilename, options.GetLoadBenchmarkIterations());
+    }
+
     std::shared_ptr<UI::BaseWindow> main = UI::Declarative::UIReader::Load(factory, uiFactory->GetContext()->UIDataBindingService, fullPath);
     return {main};
   }
 
+
+  void DeclarativeShared::RunLoadBenchmark(const std::shared_ptr<UI::Theme::IThemeControlFactory>& uiFactory, const IO::Path& xmlPath,
+                                           const IO::Path& binaryPath, const uint32_t iterations)
+  {
+    UI::Declarative::ControlFactory factory(uiFactory);
+    const auto& dataBinding = uiFactory->GetContext()->UIDataBindingService;
+
+    // If the compiled UI was saved we include the file read in the binary timings, otherwise we load it from memory
+    const bool binaryFromFile = !binaryPath.IsEmpty();
+    const std::vector<uint8_t> compiled = UI::Declarative::UICompiler::Compile(factory, xmlPath);
+    const ReadOnlySpan<uint8_t> compiledSpan = SpanUtil::AsReadOnlySpan(compiled);
+
+    FSLLOG3_INFO("Benchmarking UI load, iterations: {}", iterations);
+    HighResolutionTimer timer;
+    LoadTimings xmlTimings;
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+      const auto startTime = timer.GetTimestamp();
+      std::shared_ptr<UI::BaseWindow> main = UI::Declarative::UIReader::Load(factory, dataBinding, xmlPath);
+      xmlTimings.Add(timer.GetTimestamp() - startTime);
+    }
+
+    LoadTimings binaryTimings;
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+      const auto startTime = timer.GetTimestamp();
+      std::shared_ptr<UI::BaseWindow> main = binaryFromFile ? UI::Declarative::UIBinaryReader::Load(factory, dataBinding, binaryPath)
+                                                            : UI::Declarative::UIBinaryReader::Load(factory, dataBinding, compiledSpan);
+      binaryTimings.Add(timer.GetTimestamp() - startTime);
+    }
+
+    FSLLOG3_INFO("- xml: {} bytes, average {:.3f}ms, min {:.3f}ms", IO::File::GetLength(xmlPath), xmlTimings.AverageMilliseconds(iterations),
+                 xmlTimings.Min.TotalMilliseconds());
+    FSLLOG3_INFO("- binary: {} bytes, average {:.3f}ms, min {:.3f}ms{}", compiled.size(), binaryTimings.AverageMilliseconds(iterations),
+                 binaryTimings.Min.TotalMilliseconds(), binaryFromFile ? "" : " (excluding file io)");
+  }
 }
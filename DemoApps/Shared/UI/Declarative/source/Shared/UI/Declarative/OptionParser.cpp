@@ -43,6 +43,8 @@ namespace Fsl
       enum Enum
       {
         SaveXsd = DEMO_APP_OPTION_BASE,
+        SaveCompiledUI,
+        LoadBenchmark,
       };
     };
   }
@@ -50,6 +52,9 @@ namespace Fsl
   void OptionParser::OnArgumentSetup(std::deque<Option>& rOptions)
   {
     rOptions.emplace_back("SaveXsd", OptionArgument::OptionRequired, CommandId::SaveXsd, "Save the current UI XSD file");
+    rOptions.emplace_back("SaveCompiledUI", OptionArgument::OptionRequired, CommandId::SaveCompiledUI, "Compile the UI and save it as a binary file");
+    rOptions.emplace_back("LoadBenchmark", OptionArgument::OptionRequired, CommandId::LoadBenchmark,
+                          "Load the UI the given number of times from both xml and binary and log the timings");
   }
 
 
@@ -60,6 +65,15 @@ namespace Fsl
     case CommandId::SaveXsd:
       m_saveFilename = strOptArg;
       return OptionParseResult::Parsed;
+    case CommandId::SaveCompiledUI:
+      m_saveCompiledFilename = strOptArg;
+      return OptionParseResult::Parsed;
+    case CommandId::LoadBenchmark:
+      if (StringParseUtil::Parse(m_loadBenchmarkIterations, strOptArg) <= 0)
+      {
+        return OptionParseResult::Failed;
+      }
+      return OptionParseResult::Parsed;
     default:
       return OptionParseResult::NotHandled;
     }
@@ -393,6 +393,7 @@ namespace Fsl
       MeshUtil::DemoMeshRecord meshRecord = MeshUtil::ToSingleMesh(*scene);
       FSLLOG3_INFO("Total vertex count: {}, Total index count: {}", meshRecord.Vertices.size(), meshRecord.Indices.size());
       m_shared.SetStats(ModelRenderStats(NumericCast<uint32_t>(meshRecord.Vertices.size()), NumericCast<uint32_t>(meshRecord.Indices.size())));
+      m_shared.SetMeshBounds(MeshUtil::CalcBounds(meshRecord));
 
       m_resources.BufferManager =
         std::make_shared<Vulkan::VMBufferManager>(m_physicalDevice, m_device.Get(), m_deviceQueue.Queue, m_deviceQueue.QueueFamilyIndex);
@@ -0,0 +1,158 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/Archive/ContentArchive.hpp>
+#include <FslBase/IO/Archive/ContentArchiveWriter.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/PathDeque.hpp>
+#include <FslBase/String/StringParseUtil.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  struct Arguments
+  {
+    IO::Path ContentPath;
+    IO::Path ArchivePath;
+    IO::ContentArchiveCompression Compression{IO::ContentArchiveCompression::None};
+    uint32_t Alignment{IO::ContentArchiveWriter::DefaultAlignment};
+  };
+
+  void PrintUsage()
+  {
+    fmt::print("Usage: FslBase.ContentArchivePacker <contentDirectory> <archiveFile> [--lz4] [--alignment <bytes>]\n");
+    fmt::print("Packs all files below contentDirectory into a single archive.\n");
+    fmt::print("The demo host uses the archive '<ContentPath>{}' instead of the loose files when it exists.\n", IO::ContentArchive::FileExtension);
+    fmt::print("  --lz4                Compress the entries that get smaller using LZ4.\n");
+    fmt::print("  --alignment <bytes>  The alignment of each entry (power of two, default {}).\n", IO::ContentArchiveWriter::DefaultAlignment);
+  }
+
+  bool TryParseArguments(Arguments& rArguments, const std::vector<std::string>& args)
+  {
+    std::vector<std::string> positional;
+    for (std::size_t i = 0; i < args.size(); ++i)
+    {
+      if (args[i] == "--lz4")
+      {
+        rArguments.Compression = IO::ContentArchiveCompression::Lz4;
+      }
+      else if (args[i] == "--alignment" && (i + 1) < args.size())
+      {
+        ++i;
+        StringParseUtil::Parse(rArguments.Alignment, args[i].c_str());
+      }
+      else if (args[i].starts_with("--"))
+      {
+        return false;
+      }
+      else
+      {
+        positional.push_back(args[i]);
+      }
+    }
+    if (positional.size() != 2)
+    {
+      return false;
+    }
+    rArguments.ContentPath = IO::Path::GetFullPath(IO::Path(positional[0]));
+    // The archive does not have to exist yet so we can't use GetFullPath
+    const IO::Path archivePath(positional[1]);
+    rArguments.ArchivePath =
+      IO::Path::IsPathRooted(archivePath) ? archivePath : IO::Path::Combine(IO::Directory::GetCurrentWorkingDirectory(), archivePath);
+    return true;
+  }
+
+  int Pack(const Arguments& arguments)
+  {
+    IO::PathDeque files;
+    IO::Directory::GetFiles(files, arguments.ContentPath, IO::SearchOptions::AllDirectories);
+
+    // Sort the files so the data layout is deterministic
+    std::vector<IO::Path> sortedFiles;
+    for (const auto& file : files)
+    {
+      if (*file != arguments.ArchivePath)
+      {
+        sortedFiles.push_back(*file);
+      }
+    }
+    std::sort(sortedFiles.begin(), sortedFiles.end(),
+              [](const IO::Path& lhs, const IO::Path& rhs) { return lhs.ToUTF8String() < rhs.ToUTF8String(); });
+
+    const std::string& contentPathString = arguments.ContentPath.ToUTF8String();
+    IO::ContentArchiveWriter writer(arguments.Alignment);
+    uint64_t totalSize = 0;
+    for (const IO::Path& file : sortedFiles)
+    {
+      // Strip the content path and the separator
+      const std::string& fileString = file.ToUTF8String();
+      const IO::Path relativePath(fileString.substr(contentPathString.size() + 1));
+
+      const std::vector<uint8_t> content = IO::File::ReadAllBytes(file);
+      writer.Add(relativePath, ReadOnlySpan<uint8_t>(content.data(), content.size()), arguments.Compression);
+      totalSize += content.size();
+    }
+
+    writer.Write(arguments.ArchivePath);
+    fmt::print("Packed {} files ({} bytes) into '{}' ({} bytes)\n", writer.GetEntryCount(), totalSize, arguments.ArchivePath.ToUTF8String(),
+               IO::File::GetLength(arguments.ArchivePath));
+    return EXIT_SUCCESS;
+  }
+}
+
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    Arguments arguments;
+    if (!TryParseArguments(arguments, std::vector<std::string>(argv + 1, argv + argc)))
+    {
+      PrintUsage();
+      return EXIT_FAILURE;
+    }
+    return Pack(arguments);
+  }
+  catch (const std::exception& ex)
+  {
+    fmt::print(stderr, "ERROR: {}\n", ex.what());
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,223 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/BoundedMPMCQueue.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_Concurrent_BoundedMPMCQueue = TestFixtureFslBase;
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, Construct)
+{
+  BoundedMPMCQueue<uint32_t> queue(16u);
+  EXPECT_EQ(16u, queue.Capacity());
+  EXPECT_EQ(0u, queue.ApproximateSize());
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, Construct_InvalidCapacity)
+{
+  EXPECT_THROW(BoundedMPMCQueue<uint32_t>(0u), std::invalid_argument);
+  EXPECT_THROW(BoundedMPMCQueue<uint32_t>(1u), std::invalid_argument);
+  EXPECT_THROW(BoundedMPMCQueue<uint32_t>(15u), std::invalid_argument);
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryDequeue_Empty)
+{
+  BoundedMPMCQueue<uint32_t> queue(16u);
+  uint32_t value = 0u;
+  EXPECT_FALSE(queue.TryDequeue(value));
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryEnqueue_TryDequeue_IsFIFO)
+{
+  BoundedMPMCQueue<uint32_t> queue(4u);
+  EXPECT_TRUE(queue.TryEnqueue(1u));
+  EXPECT_TRUE(queue.TryEnqueue(2u));
+  EXPECT_TRUE(queue.TryEnqueue(3u));
+  EXPECT_EQ(3u, queue.ApproximateSize());
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(1u, value);
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(2u, value);
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(3u, value);
+  EXPECT_FALSE(queue.TryDequeue(value));
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryEnqueue_Full)
+{
+  BoundedMPMCQueue<uint32_t> queue(2u);
+  EXPECT_TRUE(queue.TryEnqueue(1u));
+  EXPECT_TRUE(queue.TryEnqueue(2u));
+  EXPECT_FALSE(queue.TryEnqueue(3u));
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(1u, value);
+  EXPECT_TRUE(queue.TryEnqueue(3u));
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(2u, value);
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(3u, value);
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryEnqueue_MoveOnly)
+{
+  BoundedMPMCQueue<std::unique_ptr<uint32_t>> queue(2u);
+  auto value = std::make_unique<uint32_t>(42u);
+  EXPECT_TRUE(queue.TryEnqueue(std::move(value)));
+  EXPECT_EQ(nullptr, value);
+
+  std::unique_ptr<uint32_t> result;
+  EXPECT_TRUE(queue.TryDequeue(result));
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(42u, *result);
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryEnqueue_Full_ValueIsNotMoved)
+{
+  BoundedMPMCQueue<std::unique_ptr<uint32_t>> queue(2u);
+  EXPECT_TRUE(queue.TryEnqueue(std::make_unique<uint32_t>(1u)));
+  EXPECT_TRUE(queue.TryEnqueue(std::make_unique<uint32_t>(2u)));
+
+  auto value = std::make_unique<uint32_t>(3u);
+  EXPECT_FALSE(queue.TryEnqueue(std::move(value)));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(3u, *value);
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryDequeue_ReleasesEntry)
+{
+  BoundedMPMCQueue<std::shared_ptr<uint32_t>> queue(2u);
+  auto value = std::make_shared<uint32_t>(42u);
+  EXPECT_TRUE(queue.TryEnqueue(value));
+  EXPECT_EQ(2, value.use_count());
+  {
+    std::shared_ptr<uint32_t> result;
+    EXPECT_TRUE(queue.TryDequeue(result));
+  }
+  EXPECT_EQ(1, value.use_count());
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, TryDequeue_Span)
+{
+  BoundedMPMCQueue<uint32_t> queue(8u);
+  for (uint32_t i = 0; i < 5u; ++i)
+  {
+    EXPECT_TRUE(queue.TryEnqueue(i));
+  }
+
+  std::array<uint32_t, 3> dst{};
+  EXPECT_EQ(3u, queue.TryDequeue(SpanUtil::AsSpan(dst)));
+  EXPECT_EQ(0u, dst[0]);
+  EXPECT_EQ(1u, dst[1]);
+  EXPECT_EQ(2u, dst[2]);
+  EXPECT_EQ(2u, queue.TryDequeue(SpanUtil::AsSpan(dst)));
+  EXPECT_EQ(3u, dst[0]);
+  EXPECT_EQ(4u, dst[1]);
+  EXPECT_EQ(0u, queue.TryDequeue(SpanUtil::AsSpan(dst)));
+}
+
+
+TEST(TestCollections_Concurrent_BoundedMPMCQueue, MultipleProducersMultipleConsumers_EveryEntryIsReturnedOnce)
+{
+  constexpr uint32_t ProducerCount = 4u;
+  constexpr uint32_t ConsumerCount = 3u;
+  constexpr uint32_t EntriesPerProducer = 5000u;
+  constexpr uint32_t TotalEntries = ProducerCount * EntriesPerProducer;
+  BoundedMPMCQueue<uint32_t> queue(256u);
+
+  std::vector<std::atomic<uint32_t>> seen(TotalEntries);
+  std::atomic<uint32_t> consumed{0u};
+
+  std::vector<std::thread> threads;
+  for (uint32_t producerIndex = 0; producerIndex < ProducerCount; ++producerIndex)
+  {
+    threads.emplace_back(
+      [&queue, producerIndex]()
+      {
+        for (uint32_t i = 0; i < EntriesPerProducer; ++i)
+        {
+          while (!queue.TryEnqueue((producerIndex * EntriesPerProducer) + i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+  }
+  for (uint32_t consumerIndex = 0; consumerIndex < ConsumerCount; ++consumerIndex)
+  {
+    threads.emplace_back(
+      [&]()
+      {
+        uint32_t value = 0u;
+        while (consumed.load() < TotalEntries)
+        {
+          if (queue.TryDequeue(value))
+          {
+            seen[value].fetch_add(1u);
+            consumed.fetch_add(1u);
+          }
+        }
+      });
+  }
+  for (auto& rThread : threads)
+  {
+    rThread.join();
+  }
+
+  for (uint32_t i = 0; i < TotalEntries; ++i)
+  {
+    EXPECT_EQ(1u, seen[i].load());
+  }
+}
@@ -0,0 +1,178 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/WorkStealingDeque.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_Concurrent_WorkStealingDeque = TestFixtureFslBase;
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, Construct)
+{
+  WorkStealingDeque<uint32_t> deque(16u);
+  EXPECT_EQ(16u, deque.Capacity());
+  EXPECT_EQ(0u, deque.ApproximateSize());
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, Construct_InvalidCapacity)
+{
+  EXPECT_THROW(WorkStealingDeque<uint32_t>(0u), std::invalid_argument);
+  EXPECT_THROW(WorkStealingDeque<uint32_t>(15u), std::invalid_argument);
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, TryPop_Empty)
+{
+  WorkStealingDeque<uint32_t> deque(16u);
+  uint32_t value = 0u;
+  EXPECT_FALSE(deque.TryPop(value));
+  EXPECT_EQ(0u, deque.ApproximateSize());
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, TrySteal_Empty)
+{
+  WorkStealingDeque<uint32_t> deque(16u);
+  uint32_t value = 0u;
+  EXPECT_FALSE(deque.TrySteal(value));
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, TryPush_TryPop_IsLIFO)
+{
+  WorkStealingDeque<uint32_t> deque(4u);
+  EXPECT_TRUE(deque.TryPush(1u));
+  EXPECT_TRUE(deque.TryPush(2u));
+  EXPECT_TRUE(deque.TryPush(3u));
+  EXPECT_EQ(3u, deque.ApproximateSize());
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(deque.TryPop(value));
+  EXPECT_EQ(3u, value);
+  EXPECT_TRUE(deque.TryPop(value));
+  EXPECT_EQ(2u, value);
+  EXPECT_TRUE(deque.TryPop(value));
+  EXPECT_EQ(1u, value);
+  EXPECT_FALSE(deque.TryPop(value));
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, TryPush_TrySteal_IsFIFO)
+{
+  WorkStealingDeque<uint32_t> deque(4u);
+  EXPECT_TRUE(deque.TryPush(1u));
+  EXPECT_TRUE(deque.TryPush(2u));
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(deque.TrySteal(value));
+  EXPECT_EQ(1u, value);
+  EXPECT_TRUE(deque.TrySteal(value));
+  EXPECT_EQ(2u, value);
+  EXPECT_FALSE(deque.TrySteal(value));
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, TryPush_Full)
+{
+  WorkStealingDeque<uint32_t> deque(2u);
+  EXPECT_TRUE(deque.TryPush(1u));
+  EXPECT_TRUE(deque.TryPush(2u));
+  EXPECT_FALSE(deque.TryPush(3u));
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(deque.TrySteal(value));
+  EXPECT_TRUE(deque.TryPush(3u));
+  EXPECT_EQ(2u, deque.ApproximateSize());
+}
+
+
+TEST(TestCollections_Concurrent_WorkStealingDeque, ConcurrentSteal_EveryEntryIsReturnedOnce)
+{
+  constexpr uint32_t EntryCount = 20000u;
+  constexpr uint32_t ThiefCount = 3u;
+  WorkStealingDeque<uint32_t> deque(1024u);
+
+  std::vector<std::atomic<uint32_t>> seen(EntryCount);
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> thieves;
+  for (uint32_t i = 0; i < ThiefCount; ++i)
+  {
+    thieves.emplace_back(
+      [&]()
+      {
+        uint32_t value = 0u;
+        while (!done.load())
+        {
+          if (deque.TrySteal(value))
+          {
+            seen[value].fetch_add(1u);
+          }
+        }
+      });
+  }
+
+  uint32_t value = 0u;
+  for (uint32_t i = 0; i < EntryCount; ++i)
+  {
+    while (!deque.TryPush(i))
+    {
+      if (deque.TryPop(value))
+      {
+        seen[value].fetch_add(1u);
+      }
+    }
+  }
+  while (deque.TryPop(value))
+  {
+    seen[value].fetch_add(1u);
+  }
+  done.store(true);
+  for (auto& rThread : thieves)
+  {
+    rThread.join();
+  }
+
+  for (uint32_t i = 0; i < EntryCount; ++i)
+  {
+    EXPECT_EQ(1u, seen[i].load());
+  }
+}
@@ -0,0 +1,196 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/OrderStatisticTree.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_OrderStatisticTree = TestFixtureFslBase;
+
+  std::vector<uint32_t> ToVector(const OrderStatisticTree<uint32_t>& tree)
+  {
+    std::vector<uint32_t> result;
+    tree.for_each([&result](const uint32_t value) { result.push_back(value); });
+    return result;
+  }
+}
+
+
+TEST(TestCollections_OrderStatisticTree, Construct)
+{
+  OrderStatisticTree<uint32_t> tree;
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(0u, tree.size());
+  EXPECT_EQ(0u, tree.lower_bound_index(10u));
+  EXPECT_EQ(0u, tree.upper_bound_index(10u));
+}
+
+
+TEST(TestCollections_OrderStatisticTree, Insert)
+{
+  OrderStatisticTree<uint32_t> tree;
+  tree.insert(5);
+  tree.insert(1);
+  tree.insert(3);
+
+  EXPECT_FALSE(tree.empty());
+  ASSERT_EQ(3u, tree.size());
+  EXPECT_EQ(1u, tree[0]);
+  EXPECT_EQ(3u, tree[1]);
+  EXPECT_EQ(5u, tree[2]);
+  EXPECT_EQ(1u, tree.front());
+  EXPECT_EQ(5u, tree.back());
+}
+
+
+TEST(TestCollections_OrderStatisticTree, Insert_Duplicates)
+{
+  OrderStatisticTree<uint32_t> tree;
+  tree.insert(2);
+  tree.insert(2);
+  tree.insert(1);
+  tree.insert(2);
+
+  ASSERT_EQ(4u, tree.size());
+  EXPECT_EQ(1u, tree[0]);
+  EXPECT_EQ(2u, tree[1]);
+  EXPECT_EQ(2u, tree[2]);
+  EXPECT_EQ(2u, tree[3]);
+  EXPECT_EQ(1u, tree.lower_bound_index(2u));
+  EXPECT_EQ(4u, tree.upper_bound_index(2u));
+}
+
+
+TEST(TestCollections_OrderStatisticTree, Erase)
+{
+  OrderStatisticTree<uint32_t> tree;
+  tree.insert(2);
+  tree.insert(2);
+  tree.insert(7);
+
+  EXPECT_FALSE(tree.erase(3));
+  EXPECT_TRUE(tree.erase(2));
+  ASSERT_EQ(2u, tree.size());
+  EXPECT_EQ(2u, tree[0]);
+  EXPECT_EQ(7u, tree[1]);
+
+  EXPECT_TRUE(tree.erase(2));
+  EXPECT_FALSE(tree.erase(2));
+  ASSERT_EQ(1u, tree.size());
+  EXPECT_EQ(7u, tree.front());
+
+  EXPECT_TRUE(tree.erase(7));
+  EXPECT_TRUE(tree.empty());
+}
+
+
+TEST(TestCollections_OrderStatisticTree, At_OutOfRange)
+{
+  OrderStatisticTree<uint32_t> tree;
+  EXPECT_THROW(tree.at(0), std::out_of_range);
+  tree.insert(1);
+  EXPECT_EQ(1u, tree.at(0));
+  EXPECT_THROW(tree.at(1), std::out_of_range);
+}
+
+
+TEST(TestCollections_OrderStatisticTree, BoundIndex_MixedKeyType)
+{
+  OrderStatisticTree<uint32_t> tree;
+  tree.insert(1);
+  tree.insert(3);
+  tree.insert(5);
+
+  EXPECT_EQ(1u, tree.lower_bound_index(2.5));
+  EXPECT_EQ(1u, tree.upper_bound_index(2.5));
+  EXPECT_EQ(1u, tree.lower_bound_index(3.0));
+  EXPECT_EQ(2u, tree.upper_bound_index(3.0));
+  EXPECT_EQ(0u, tree.lower_bound_index(-1.0));
+  EXPECT_EQ(3u, tree.upper_bound_index(10.0));
+}
+
+
+TEST(TestCollections_OrderStatisticTree, Clear)
+{
+  OrderStatisticTree<uint32_t> tree;
+  tree.insert(1);
+  tree.insert(2);
+  tree.clear();
+  EXPECT_TRUE(tree.empty());
+  tree.insert(3);
+  ASSERT_EQ(1u, tree.size());
+  EXPECT_EQ(3u, tree[0]);
+}
+
+
+TEST(TestCollections_OrderStatisticTree, SlidingWindow_MatchesSortedReference)
+{
+  constexpr std::size_t WindowSize = 257;
+  std::mt19937 random(1234);
+  std::uniform_int_distribution<uint32_t> distribution(0, 100);
+
+  OrderStatisticTree<uint32_t> tree;
+  std::deque<uint32_t> window;
+  for (std::size_t i = 0; i < 2000; ++i)
+  {
+    const uint32_t value = distribution(random);
+    window.push_back(value);
+    tree.insert(value);
+    if (window.size() > WindowSize)
+    {
+      EXPECT_TRUE(tree.erase(window.front()));
+      window.pop_front();
+    }
+
+    if ((i % 97) == 0 || i == 1999)
+    {
+      std::vector<uint32_t> expected(window.begin(), window.end());
+      std::sort(expected.begin(), expected.end());
+      ASSERT_EQ(expected, ToVector(tree));
+      ASSERT_EQ(expected.size(), tree.size());
+      for (std::size_t index = 0; index < expected.size(); ++index)
+      {
+        ASSERT_EQ(expected[index], tree[index]);
+      }
+      const uint32_t key = distribution(random);
+      EXPECT_EQ(static_cast<std::size_t>(std::lower_bound(expected.begin(), expected.end(), key) - expected.begin()), tree.lower_bound_index(key));
+      EXPECT_EQ(static_cast<std::size_t>(std::upper_bound(expected.begin(), expected.end(), key) - expected.begin()), tree.upper_bound_index(key));
+    }
+  }
+}
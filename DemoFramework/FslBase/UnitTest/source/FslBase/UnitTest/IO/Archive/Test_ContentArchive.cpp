@@ -0,0 +1,312 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Archive/ContentArchive.hpp>
+#include <FslBase/IO/Archive/ContentArchiveWriter.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestIoArchiveContentArchive = TestFixtureFslBase;
+
+  std::vector<uint8_t> ToBytes(const std::string& str)
+  {
+    return {str.begin(), str.end()};
+  }
+
+  std::vector<uint8_t> CreateRepeatingContent(const std::size_t size)
+  {
+    std::vector<uint8_t> content(size);
+    for (std::size_t i = 0; i < content.size(); ++i)
+    {
+      content[i] = static_cast<uint8_t>((i % 37) + (i / 1024));
+    }
+    return content;
+  }
+
+  std::vector<uint8_t> CreateNoise(const std::size_t size)
+  {
+    std::vector<uint8_t> content(size);
+    uint32_t seed = 0x12345678;
+    for (auto& rEntry : content)
+    {
+      seed = (seed * 1664525u) + 1013904223u;
+      rEntry = static_cast<uint8_t>(seed >> 24);
+    }
+    return content;
+  }
+
+  IO::ContentArchive Open(const IO::ContentArchiveWriter& writer)
+  {
+    return IO::ContentArchive(IO::MemoryMappedFile(writer.ToBytes()));
+  }
+
+  std::vector<uint8_t> ToVector(const ReadOnlySpan<uint8_t> span)
+  {
+    return {span.begin(), span.end()};
+  }
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Construct_Default)
+{
+  IO::ContentArchive archive;
+  EXPECT_FALSE(archive.IsValid());
+  EXPECT_EQ(0u, archive.GetEntryCount());
+  EXPECT_FALSE(archive.Contains("Hello.txt"));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Construct_Empty)
+{
+  IO::ContentArchiveWriter writer;
+  IO::ContentArchive archive = Open(writer);
+  EXPECT_TRUE(archive.IsValid());
+  EXPECT_EQ(0u, archive.GetEntryCount());
+  EXPECT_FALSE(archive.Contains("Hello.txt"));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Construct_InvalidContent)
+{
+  EXPECT_THROW(IO::ContentArchive(IO::MemoryMappedFile(ToBytes("Not a archive"))), FormatException);
+  EXPECT_THROW(IO::ContentArchive(IO::MemoryMappedFile(std::vector<uint8_t>(128))), FormatException);
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Construct_Truncated)
+{
+  IO::ContentArchiveWriter writer;
+  writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(ToBytes("Hello world")));
+  std::vector<uint8_t> content = writer.ToBytes();
+  content.resize(content.size() / 2);
+  EXPECT_THROW(IO::ContentArchive(IO::MemoryMappedFile(std::move(content))), FormatException);
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Writer_InvalidAlignment)
+{
+  EXPECT_THROW(IO::ContentArchiveWriter(0), std::invalid_argument);
+  EXPECT_THROW(IO::ContentArchiveWriter(3), std::invalid_argument);
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Writer_InvalidPath)
+{
+  IO::ContentArchiveWriter writer;
+  const std::vector<uint8_t> content = ToBytes("Hello");
+  EXPECT_THROW(writer.Add("", ReadOnlySpan<uint8_t>(content)), std::invalid_argument);
+  EXPECT_THROW(writer.Add("/Hello.txt", ReadOnlySpan<uint8_t>(content)), std::invalid_argument);
+  EXPECT_THROW(writer.Add("../Hello.txt", ReadOnlySpan<uint8_t>(content)), std::invalid_argument);
+
+  writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(content));
+  EXPECT_THROW(writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(content)), std::invalid_argument);
+  EXPECT_EQ(1u, writer.GetEntryCount());
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Find)
+{
+  const std::vector<uint8_t> content0 = ToBytes("Hello world");
+  const std::vector<uint8_t> content1 = CreateNoise(1000);
+  const std::vector<uint8_t> content2;
+
+  IO::ContentArchiveWriter writer;
+  writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(content0));
+  writer.Add("Textures/Noise.bin", ReadOnlySpan<uint8_t>(content1));
+  writer.Add("Empty.bin", ReadOnlySpan<uint8_t>(content2));
+
+  IO::ContentArchive archive = Open(writer);
+  ASSERT_EQ(3u, archive.GetEntryCount());
+  EXPECT_FALSE(archive.Contains("hello.txt"));
+  EXPECT_FALSE(archive.Contains("Textures"));
+
+  const auto entry0 = archive.TryFind("Hello.txt");
+  const auto entry1 = archive.TryFind("Textures/Noise.bin");
+  const auto entry2 = archive.TryFind("Empty.bin");
+  ASSERT_TRUE(entry0.has_value());
+  ASSERT_TRUE(entry1.has_value());
+  ASSERT_TRUE(entry2.has_value());
+
+  EXPECT_EQ(content0, archive.ReadAllBytes(*entry0));
+  EXPECT_EQ(content1, archive.ReadAllBytes(*entry1));
+  EXPECT_EQ(content2, archive.ReadAllBytes(*entry2));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Find_Many)
+{
+  IO::ContentArchiveWriter writer;
+  constexpr uint32_t EntryCount = 500;
+  for (uint32_t i = 0; i < EntryCount; ++i)
+  {
+    const std::vector<uint8_t> content = ToBytes(std::to_string(i));
+    writer.Add(IO::Path("Dir/File" + std::to_string(i) + ".txt"), ReadOnlySpan<uint8_t>(content));
+  }
+
+  IO::ContentArchive archive = Open(writer);
+  ASSERT_EQ(EntryCount, archive.GetEntryCount());
+  for (uint32_t i = 0; i < EntryCount; ++i)
+  {
+    const auto entry = archive.TryFind(IO::Path("Dir/File" + std::to_string(i) + ".txt"));
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(ToBytes(std::to_string(i)), archive.ReadAllBytes(*entry));
+  }
+  EXPECT_FALSE(archive.Contains(IO::Path("Dir/File" + std::to_string(EntryCount) + ".txt")));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Alignment)
+{
+  IO::ContentArchiveWriter writer(256);
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    const std::vector<uint8_t> content = CreateNoise(i * 7);
+    writer.Add(IO::Path("File" + std::to_string(i)), ReadOnlySpan<uint8_t>(content));
+  }
+
+  IO::ContentArchive archive = Open(writer);
+  ASSERT_EQ(10u, archive.GetEntryCount());
+  for (uint32_t i = 0; i < archive.GetEntryCount(); ++i)
+  {
+    EXPECT_EQ(0u, archive.GetEntry(i).Offset % 256u);
+  }
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Compression_Lz4)
+{
+  const std::vector<uint8_t> content = CreateRepeatingContent(100000);
+
+  IO::ContentArchiveWriter writer;
+  writer.Add("Repeat.bin", ReadOnlySpan<uint8_t>(content), IO::ContentArchiveCompression::Lz4);
+
+  IO::ContentArchive archive = Open(writer);
+  const auto entry = archive.TryFind("Repeat.bin");
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(IO::ContentArchiveCompression::Lz4, entry->Compression);
+  EXPECT_EQ(content.size(), entry->Size);
+  EXPECT_LT(entry->StoredSize, entry->Size);
+  EXPECT_EQ(content, archive.ReadAllBytes(*entry));
+
+  IO::MemoryMappedFile mapped = archive.MapAllBytes(*entry);
+  EXPECT_EQ(content, ToVector(mapped.AsReadOnlySpan()));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Compression_Lz4_SmallAndLongRuns)
+{
+  IO::ContentArchiveWriter writer;
+  const std::vector<std::vector<uint8_t>> contents = {ToBytes("abcabcabcabcabcabcabcabcabcabc"), std::vector<uint8_t>(70000, 42),
+                                                      ToBytes("0123456789012"), std::vector<uint8_t>(5, 1)};
+  for (std::size_t i = 0; i < contents.size(); ++i)
+  {
+    writer.Add(IO::Path("File" + std::to_string(i)), ReadOnlySpan<uint8_t>(contents[i]), IO::ContentArchiveCompression::Lz4);
+  }
+
+  IO::ContentArchive archive = Open(writer);
+  for (std::size_t i = 0; i < contents.size(); ++i)
+  {
+    const auto entry = archive.TryFind(IO::Path("File" + std::to_string(i)));
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(contents[i], archive.ReadAllBytes(*entry));
+  }
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Compression_Lz4_FallbackToStored)
+{
+  const std::vector<uint8_t> content = CreateNoise(4096);
+
+  IO::ContentArchiveWriter writer;
+  writer.Add("Noise.bin", ReadOnlySpan<uint8_t>(content), IO::ContentArchiveCompression::Lz4);
+
+  IO::ContentArchive archive = Open(writer);
+  const auto entry = archive.TryFind("Noise.bin");
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(IO::ContentArchiveCompression::None, entry->Compression);
+  EXPECT_EQ(content, archive.ReadAllBytes(*entry));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Compression_Lz4_Corrupt)
+{
+  const std::vector<uint8_t> content = CreateRepeatingContent(10000);
+
+  IO::ContentArchiveWriter writer;
+  writer.Add("Repeat.bin", ReadOnlySpan<uint8_t>(content), IO::ContentArchiveCompression::Lz4);
+
+  IO::ContentArchive archive = Open(writer);
+  auto entry = archive.TryFind("Repeat.bin");
+  ASSERT_TRUE(entry.has_value());
+  entry->Size += 1;
+  EXPECT_THROW(archive.ReadAllBytes(*entry), FormatException);
+}
+
+
+TEST_F(TestIoArchiveContentArchive, MapAllBytes_Stored)
+{
+  const std::vector<uint8_t> content = ToBytes("Hello world");
+
+  IO::ContentArchiveWriter writer;
+  writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(content));
+
+  IO::ContentArchive archive = Open(writer);
+  const auto entry = archive.TryFind("Hello.txt");
+  ASSERT_TRUE(entry.has_value());
+
+  // Stored entries are kept as is
+  EXPECT_EQ(IO::ContentArchiveCompression::None, entry->Compression);
+  EXPECT_EQ(content, ToVector(archive.GetStoredContent(*entry)));
+
+  IO::MemoryMappedFile mapped = archive.MapAllBytes(*entry);
+  EXPECT_EQ(content, ToVector(mapped.AsReadOnlySpan()));
+}
+
+
+TEST_F(TestIoArchiveContentArchive, Move)
+{
+  const std::vector<uint8_t> content = ToBytes("Hello world");
+  IO::ContentArchiveWriter writer;
+  writer.Add("Hello.txt", ReadOnlySpan<uint8_t>(content));
+
+  IO::ContentArchive archive = Open(writer);
+  IO::ContentArchive archive2(std::move(archive));
+  EXPECT_FALSE(archive.IsValid());    // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+  EXPECT_EQ(0u, archive.GetEntryCount());
+  EXPECT_TRUE(archive2.Contains("Hello.txt"));
+}
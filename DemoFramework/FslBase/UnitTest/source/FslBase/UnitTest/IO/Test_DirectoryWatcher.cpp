@@ -0,0 +1,245 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/DirectoryWatcher.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/IO/LogPath.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBaseContent.hpp>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <ftw.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#endif
+
+using namespace Fsl;
+
+namespace
+{
+  using TestIO_DirectoryWatcher = TestFixtureFslBaseContent;
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+  //! Creates a unique temporary directory that is removed (including its content) on destruction
+  class ScopedTempDirectory
+  {
+    IO::Path m_path;
+
+  public:
+    ScopedTempDirectory()
+    {
+      std::string pathTemplate("/tmp/FslBaseDirectoryWatcherXXXXXX");
+      if (mkdtemp(pathTemplate.data()) == nullptr)
+      {
+        throw IOException("Failed to create temp directory");
+      }
+      m_path = IO::Path(pathTemplate);
+    }
+
+    ~ScopedTempDirectory()
+    {
+      // Best effort cleanup of the directory and its content (children are visited first due to FTW_DEPTH)
+      nftw(
+        m_path.ToUTF8String().c_str(), [](const char* pszPath, const struct stat*, int, struct FTW*) { return std::remove(pszPath); }, 16,
+        FTW_DEPTH | FTW_PHYS);
+    }
+
+    ScopedTempDirectory(const ScopedTempDirectory&) = delete;
+    ScopedTempDirectory& operator=(const ScopedTempDirectory&) = delete;
+
+    const IO::Path& GetPath() const
+    {
+      return m_path;
+    }
+  };
+
+  bool Contains(const std::vector<IO::Path>& paths, const IO::Path& path)
+  {
+    return std::find(paths.begin(), paths.end(), path) != paths.end();
+  }
+
+  constexpr std::chrono::milliseconds MaxWait(2000);
+#endif
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Construct_NotRooted)
+{
+  EXPECT_THROW(IO::DirectoryWatcher(IO::Path("not/rooted")), std::invalid_argument);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Construct_DirectoryNotFound)
+{
+  const IO::Path path(GetContentPath("ThisDirectoryDoesNotExist"));
+  EXPECT_THROW(IO::DirectoryWatcher(path, IO::SearchOptions::AllDirectories, IO::DirectoryWatcherBackend::Polling), DirectoryNotFoundException);
+  EXPECT_THROW(IO::DirectoryWatcher(path, IO::SearchOptions::AllDirectories, IO::DirectoryWatcherBackend::Platform), DirectoryNotFoundException);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Polling_NoChanges)
+{
+  IO::DirectoryWatcher watcher(GetContentPath(), IO::SearchOptions::AllDirectories, IO::DirectoryWatcherBackend::Polling);
+  EXPECT_EQ(IO::DirectoryWatcherBackend::Polling, watcher.GetBackend());
+  EXPECT_EQ(GetContentPath(), watcher.GetPath());
+
+  // There should not be any changes to the content directory during testing
+  std::vector<IO::Path> changedPaths;
+  EXPECT_FALSE(watcher.TryGetChanges(changedPaths));
+  EXPECT_TRUE(changedPaths.empty());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Platform_NoChanges)
+{
+  // This falls back to polling on platforms without change notification support
+  IO::DirectoryWatcher watcher(GetContentPath());
+
+  // There should not be any changes to the content directory during testing
+  std::vector<IO::Path> changedPaths;
+  EXPECT_FALSE(watcher.TryGetChanges(changedPaths, std::chrono::milliseconds(10)));
+  EXPECT_TRUE(changedPaths.empty());
+}
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+TEST_F(TestIO_DirectoryWatcher, Platform_Linux_IsSupported)
+{
+  ScopedTempDirectory tempDir;
+  IO::DirectoryWatcher watcher(tempDir.GetPath());
+  EXPECT_EQ(IO::DirectoryWatcherBackend::Platform, watcher.GetBackend());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Platform_Linux_FileCreated)
+{
+  ScopedTempDirectory tempDir;
+  IO::DirectoryWatcher watcher(tempDir.GetPath());
+  ASSERT_EQ(IO::DirectoryWatcherBackend::Platform, watcher.GetBackend());
+
+  const IO::Path filePath(IO::Path::Combine(tempDir.GetPath(), "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+
+  std::vector<IO::Path> changedPaths;
+  EXPECT_TRUE(watcher.TryGetChanges(changedPaths, MaxWait));
+  EXPECT_TRUE(Contains(changedPaths, filePath));
+  // The events belonging to the write are coalesced so the path should only be reported once
+  EXPECT_EQ(1, std::count(changedPaths.begin(), changedPaths.end(), filePath));
+
+  changedPaths.clear();
+  EXPECT_FALSE(watcher.TryGetChanges(changedPaths));
+  EXPECT_TRUE(changedPaths.empty());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Platform_Linux_FileModifiedInSubDirectory)
+{
+  ScopedTempDirectory tempDir;
+  const IO::Path subDirPath(IO::Path::Combine(tempDir.GetPath(), "sub"));
+  ASSERT_EQ(0, mkdir(subDirPath.ToUTF8String().c_str(), S_IRWXU));
+  const IO::Path filePath(IO::Path::Combine(subDirPath, "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath());
+  ASSERT_EQ(IO::DirectoryWatcherBackend::Platform, watcher.GetBackend());
+
+  IO::File::WriteAllText(filePath, "world");
+
+  std::vector<IO::Path> changedPaths;
+  EXPECT_TRUE(watcher.TryGetChanges(changedPaths, MaxWait));
+  EXPECT_TRUE(Contains(changedPaths, filePath));
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Platform_Linux_FileCreatedInNewSubDirectory)
+{
+  ScopedTempDirectory tempDir;
+  IO::DirectoryWatcher watcher(tempDir.GetPath());
+  ASSERT_EQ(IO::DirectoryWatcherBackend::Platform, watcher.GetBackend());
+
+  const IO::Path subDirPath(IO::Path::Combine(tempDir.GetPath(), "sub"));
+  ASSERT_EQ(0, mkdir(subDirPath.ToUTF8String().c_str(), S_IRWXU));
+  const IO::Path filePath(IO::Path::Combine(subDirPath, "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+
+  // The file might be created before the watch on the new directory is added, but it should be reported either way
+  std::vector<IO::Path> changedPaths;
+  EXPECT_TRUE(watcher.TryGetChanges(changedPaths, MaxWait));
+  EXPECT_TRUE(Contains(changedPaths, subDirPath));
+  EXPECT_TRUE(Contains(changedPaths, filePath));
+
+  // Changes to the new directory should now be monitored as well
+  IO::File::WriteAllText(filePath, "world");
+  changedPaths.clear();
+  EXPECT_TRUE(watcher.TryGetChanges(changedPaths, MaxWait));
+  EXPECT_TRUE(Contains(changedPaths, filePath));
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Platform_Linux_TopDirectoryOnly)
+{
+  ScopedTempDirectory tempDir;
+  const IO::Path subDirPath(IO::Path::Combine(tempDir.GetPath(), "sub"));
+  ASSERT_EQ(0, mkdir(subDirPath.ToUTF8String().c_str(), S_IRWXU));
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath(), IO::SearchOptions::TopDirectoryOnly);
+  ASSERT_EQ(IO::DirectoryWatcherBackend::Platform, watcher.GetBackend());
+
+  IO::File::WriteAllText(IO::Path::Combine(subDirPath, "test.txt"), "hello");
+
+  std::vector<IO::Path> changedPaths;
+  EXPECT_FALSE(watcher.TryGetChanges(changedPaths, std::chrono::milliseconds(50)));
+  EXPECT_TRUE(changedPaths.empty());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Polling_Linux_FileDeleted)
+{
+  ScopedTempDirectory tempDir;
+  const IO::Path filePath(IO::Path::Combine(tempDir.GetPath(), "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath(), IO::SearchOptions::AllDirectories, IO::DirectoryWatcherBackend::Polling);
+  ASSERT_EQ(IO::DirectoryWatcherBackend::Polling, watcher.GetBackend());
+
+  ASSERT_EQ(0, unlink(filePath.ToUTF8String().c_str()));
+
+  std::vector<IO::Path> changedPaths;
+  EXPECT_TRUE(watcher.TryGetChanges(changedPaths));
+  ASSERT_EQ(1u, changedPaths.size());
+  EXPECT_EQ(filePath, changedPaths[0]);
+}
+
+#endif
@@ -0,0 +1,155 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBaseContent.hpp>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestIoMemoryMappedFile : public TestFixtureFslBaseContent
+  {
+  protected:
+    IO::Path m_helloWorldFilename;
+    IO::Path m_testFileFilename;
+    IO::Path m_notExistingFilename;
+
+  public:
+    TestIoMemoryMappedFile()
+      : m_helloWorldFilename(IO::Path::Combine(GetContentPath(), "HelloWorld.txt"))
+      , m_testFileFilename(IO::Path::Combine(GetContentPath(), "Test/TestFile.txt"))
+      , m_notExistingFilename(IO::Path::Combine(GetContentPath(), "ThisIsNotAFile.txt"))
+    {
+    }
+  };
+
+  void ExpectEq(const std::vector<uint8_t>& expectedContent, const ReadOnlySpan<uint8_t> content)
+  {
+    ASSERT_EQ(expectedContent.size(), content.size());
+    for (std::size_t i = 0; i < expectedContent.size(); ++i)
+    {
+      EXPECT_EQ(expectedContent[i], content[i]);
+    }
+  }
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_Default)
+{
+  IO::MemoryMappedFile file;
+  EXPECT_TRUE(file.empty());
+  EXPECT_EQ(0u, file.size());
+  EXPECT_FALSE(file.IsMemoryMapped());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  ExpectEq(IO::File::ReadAllBytes(m_helloWorldFilename), file.AsReadOnlySpan());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_NotExisting)
+{
+  EXPECT_THROW(IO::MemoryMappedFile file(m_notExistingFilename), IOException);
+}
+
+
+TEST_F(TestIoMemoryMappedFile, MoveConstruct)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  const uint8_t* const pContent = file.data();
+
+  IO::MemoryMappedFile file2(std::move(file));
+  EXPECT_TRUE(file.empty());    // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(pContent, file2.data());
+  ExpectEq(IO::File::ReadAllBytes(m_helloWorldFilename), file2.AsReadOnlySpan());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, MoveAssign)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  IO::MemoryMappedFile file2(m_testFileFilename);
+
+  file2 = std::move(file);
+  EXPECT_TRUE(file.empty());    // NOLINT(bugprone-use-after-move)
+  ExpectEq(IO::File::ReadAllBytes(m_helloWorldFilename), file2.AsReadOnlySpan());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Reset)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  file.Reset();
+  EXPECT_TRUE(file.empty());
+  EXPECT_FALSE(file.IsMemoryMapped());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_Vector)
+{
+  const std::vector<uint8_t> expected = {1, 2, 3, 4};
+  IO::MemoryMappedFile file{std::vector<uint8_t>(expected)};
+  EXPECT_FALSE(file.IsMemoryMapped());
+  ExpectEq(expected, file.AsReadOnlySpan());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Slice)
+{
+  const std::vector<uint8_t> expected = IO::File::ReadAllBytes(m_helloWorldFilename);
+  ASSERT_GE(expected.size(), 4u);
+
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  IO::MemoryMappedFile slice = file.Slice(1, 3);
+  EXPECT_EQ(file.IsMemoryMapped(), slice.IsMemoryMapped());
+  ExpectEq(std::vector<uint8_t>(expected.begin() + 1, expected.begin() + 4), slice.AsReadOnlySpan());
+
+  // The slice keeps the content alive
+  file.Reset();
+  ExpectEq(std::vector<uint8_t>(expected.begin() + 1, expected.begin() + 4), slice.AsReadOnlySpan());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Slice_OutOfRange)
+{
+  IO::MemoryMappedFile file(std::vector<uint8_t>{1, 2, 3, 4});
+  EXPECT_THROW(file.Slice(5, 0), std::invalid_argument);
+  EXPECT_THROW(file.Slice(2, 3), std::invalid_argument);
+}
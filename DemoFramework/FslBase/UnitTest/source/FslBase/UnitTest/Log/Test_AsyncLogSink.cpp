@@ -0,0 +1,239 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/AsyncLogSink.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBaseContent.hpp>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestLog_AsyncLogSink : public TestFixtureFslBaseContent
+  {
+  protected:
+    IO::Path m_logFile;
+
+  public:
+    TestLog_AsyncLogSink()
+      : m_logFile(GetTestPath("TestLog_AsyncLogSink.log"))
+    {
+    }
+
+    ~TestLog_AsyncLogSink() override
+    {
+      std::remove(m_logFile.ToUTF8String().c_str());
+    }
+
+    std::vector<std::string> ReadLogLines() const
+    {
+      const std::string content = IO::File::ReadAllText(m_logFile);
+      std::vector<std::string> lines;
+      std::size_t start = 0;
+      std::size_t end = 0;
+      while ((end = content.find('\n', start)) != std::string::npos)
+      {
+        lines.push_back(content.substr(start, end - start));
+        start = end + 1;
+      }
+      EXPECT_EQ(content.size(), start);
+      return lines;
+    }
+  };
+}
+
+
+TEST_F(TestLog_AsyncLogSink, Construct_InvalidConfig)
+{
+  AsyncLogSinkConfig config(m_logFile);
+  config.ThreadBufferCapacity = 1000;
+  EXPECT_THROW(AsyncLogSink sink(config), std::invalid_argument);
+  config.ThreadBufferCapacity = 512;
+  EXPECT_THROW(AsyncLogSink sink(config), std::invalid_argument);
+  config.ThreadBufferCapacity = 1024;
+  config.FlushInterval = std::chrono::milliseconds(0);
+  EXPECT_THROW(AsyncLogSink sink(config), std::invalid_argument);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, Construct_OnlyOneActive)
+{
+  AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+  EXPECT_THROW(AsyncLogSink sink2(AsyncLogSinkConfig{m_logFile}), UsageErrorException);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, Construct_Sequential)
+{
+  {
+    AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+    FSLLOG3_INFO("first");
+  }
+  {
+    AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+    FSLLOG3_INFO("second");
+  }
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ("second", lines[0]);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, WriteLine)
+{
+  {
+    AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+    for (int i = 0; i < 100; ++i)
+    {
+      FSLLOG3_INFO("Hello {}", i);
+    }
+    FSLLOG3_WARNING("careful");
+    FSLLOG3_ERROR("failed");
+    sink.Flush();
+    EXPECT_EQ(102u, sink.GetStats().WrittenMessages);
+    EXPECT_EQ(0u, sink.GetStats().DroppedMessages);
+  }
+
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(102u, lines.size());
+  for (std::size_t i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(fmt::format("Hello {}", i), lines[i]);
+  }
+  EXPECT_EQ("WARNING: careful", lines[100]);
+  EXPECT_EQ("ERROR: failed", lines[101]);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, Flush)
+{
+  AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+  FSLLOG3_INFO("Hello");
+  sink.Flush();
+
+  // The file is still open, but the message should have been written
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ("Hello", lines[0]);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, LoggerFlush)
+{
+  // No sink active so this just flushes stdout
+  Logger::Flush();
+
+  AsyncLogSink sink(AsyncLogSinkConfig{m_logFile});
+  FSLLOG3_INFO("Hello");
+  Logger::Flush();
+
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ("Hello", lines[0]);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, Oversized_WrittenSynchronously)
+{
+  AsyncLogSinkConfig config(m_logFile);
+  config.ThreadBufferCapacity = 1024;
+  AsyncLogSink sink(config);
+
+  // A message that can never fit in the buffer is written directly after the messages logged before it
+  const std::string largeMessage(2000, 'x');
+  FSLLOG3_INFO("first");
+  FSLLOG3_ERROR(largeMessage);
+  FSLLOG3_INFO("last");
+  sink.Flush();
+
+  const auto stats = sink.GetStats();
+  EXPECT_EQ(3u, stats.WrittenMessages);
+  EXPECT_EQ(0u, stats.DroppedMessages);
+  EXPECT_EQ(0u, stats.DroppedBytes);
+
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(3u, lines.size());
+  EXPECT_EQ("first", lines[0]);
+  EXPECT_EQ("ERROR: " + largeMessage, lines[1]);
+  EXPECT_EQ("last", lines[2]);
+}
+
+
+TEST_F(TestLog_AsyncLogSink, WriteLine_MultipleThreads)
+{
+  constexpr uint32_t ThreadCount = 4;
+  constexpr uint32_t MessagesPerThread = 1000;
+  {
+    AsyncLogSinkConfig config(m_logFile);
+    config.ThreadBufferCapacity = 256 * 1024;
+    AsyncLogSink sink(config);
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+    {
+      threads.emplace_back(
+        [threadIndex]()
+        {
+          for (uint32_t i = 0; i < MessagesPerThread; ++i)
+          {
+            FSLLOG3_INFO("{}:{}", threadIndex, i);
+          }
+        });
+    }
+    for (auto& rThread : threads)
+    {
+      rThread.join();
+    }
+    sink.Flush();
+    EXPECT_EQ(0u, sink.GetStats().DroppedMessages);
+  }
+
+  // Every message should be written exactly once and in order for each thread
+  const auto lines = ReadLogLines();
+  ASSERT_EQ(ThreadCount * MessagesPerThread, lines.size());
+  std::vector<uint32_t> nextMessage(ThreadCount, 0);
+  for (const auto& line : lines)
+  {
+    const auto separatorIndex = line.find(':');
+    ASSERT_NE(std::string::npos, separatorIndex);
+    const auto threadIndex = static_cast<uint32_t>(std::stoul(line.substr(0, separatorIndex)));
+    const auto messageIndex = static_cast<uint32_t>(std::stoul(line.substr(separatorIndex + 1)));
+    ASSERT_LT(threadIndex, ThreadCount);
+    EXPECT_EQ(nextMessage[threadIndex], messageIndex);
+    nextMessage[threadIndex] = messageIndex + 1;
+  }
+}
@@ -0,0 +1,263 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingBox.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/BoundingSphere.hpp>
+#include <FslBase/Math/FrustumCullUtil.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestMath_FrustumCullUtil = TestFixtureFslBase;
+
+  BoundingFrustum CreateTestFrustum()
+  {
+    return BoundingFrustum(Matrix::CreateRotationY(0.4f) * Matrix::CreateTranslation(0.0f, 0.0f, -20.0f) *
+                           Matrix::CreatePerspectiveFieldOfView(0.8f, 1.5f, 1.0f, 60.0f));
+  }
+
+  //! Spread the entries over a volume that is larger than the frustum so we get a mix of visible, partial and culled entries.
+  Vector3 CreatePosition(const std::size_t index)
+  {
+    const auto value = static_cast<float>(index);
+    return {static_cast<float>(static_cast<int32_t>(index % 17) - 8) * 4.0f, static_cast<float>(static_cast<int32_t>(index % 11) - 5) * 3.0f,
+            -value * 0.75f};
+  }
+
+  struct BoxRecord
+  {
+    std::vector<BoundingBox> Boxes;
+    std::vector<float> MinX;
+    std::vector<float> MinY;
+    std::vector<float> MinZ;
+    std::vector<float> MaxX;
+    std::vector<float> MaxY;
+    std::vector<float> MaxZ;
+
+    explicit BoxRecord(const std::size_t count)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const Vector3 position = CreatePosition(i);
+        const float size = 0.5f + static_cast<float>(i % 5);
+        const BoundingBox box(position - Vector3(size, size, size), position + Vector3(size, size, size));
+        Boxes.push_back(box);
+        MinX.push_back(box.Min.X);
+        MinY.push_back(box.Min.Y);
+        MinZ.push_back(box.Min.Z);
+        MaxX.push_back(box.Max.X);
+        MaxY.push_back(box.Max.Y);
+        MaxZ.push_back(box.Max.Z);
+      }
+    }
+
+    FrustumCullUtil::BoundingBoxSpans AsSpans() const
+    {
+      return {SpanUtil::AsReadOnlySpan(MinX), SpanUtil::AsReadOnlySpan(MinY), SpanUtil::AsReadOnlySpan(MinZ),
+              SpanUtil::AsReadOnlySpan(MaxX), SpanUtil::AsReadOnlySpan(MaxY), SpanUtil::AsReadOnlySpan(MaxZ)};
+    }
+  };
+
+  struct SphereRecord
+  {
+    std::vector<BoundingSphere> Spheres;
+    std::vector<float> CenterX;
+    std::vector<float> CenterY;
+    std::vector<float> CenterZ;
+    std::vector<float> Radius;
+
+    explicit SphereRecord(const std::size_t count)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const BoundingSphere sphere(CreatePosition(i), 0.5f + static_cast<float>(i % 5));
+        Spheres.push_back(sphere);
+        CenterX.push_back(sphere.Center.X);
+        CenterY.push_back(sphere.Center.Y);
+        CenterZ.push_back(sphere.Center.Z);
+        Radius.push_back(sphere.Radius);
+      }
+    }
+
+    FrustumCullUtil::BoundingSphereSpans AsSpans() const
+    {
+      return {SpanUtil::AsReadOnlySpan(CenterX), SpanUtil::AsReadOnlySpan(CenterY), SpanUtil::AsReadOnlySpan(CenterZ),
+              SpanUtil::AsReadOnlySpan(Radius)};
+    }
+  };
+
+  // Counts that cover empty input, partial groups and partial mask words
+  constexpr std::array<std::size_t, 7> TestCounts = {0, 1, 3, 4, 5, 33, 250};
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_Boxes)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  for (const std::size_t count : TestCounts)
+  {
+    const BoxRecord record(count);
+    std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count), 0xFFFFFFFF);
+    const std::size_t visibleCount = FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(mask));
+
+    std::size_t expectedVisibleCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const bool expected = frustum.Intersects(record.Boxes[i]);
+      EXPECT_EQ(expected, FrustumCullUtil::IsVisible(SpanUtil::AsReadOnlySpan(mask), i));
+      expectedVisibleCount += expected ? 1u : 0u;
+    }
+    EXPECT_EQ(expectedVisibleCount, visibleCount);
+    // unused bits in the last word are cleared
+    if ((count % 32u) != 0u)
+    {
+      EXPECT_EQ(0u, mask.back() >> (count % 32u));
+    }
+  }
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_Boxes_SomeVisibleSomeCulled)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  const BoxRecord record(250);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(250));
+  const std::size_t visibleCount = FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(mask));
+  EXPECT_GT(visibleCount, 0u);
+  EXPECT_LT(visibleCount, 250u);
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_Boxes_PlaneCache)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  const BoundingFrustum movedFrustum(Matrix::CreateRotationY(-0.9f) * Matrix::CreateTranslation(5.0f, 0.0f, -40.0f) *
+                                     Matrix::CreatePerspectiveFieldOfView(0.8f, 1.5f, 1.0f, 60.0f));
+  for (const std::size_t count : TestCounts)
+  {
+    const BoxRecord record(count);
+    std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(count), FrustumCullUtil::InvalidPlaneIndex);
+    std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+
+    // The cache content from the previous frustum must not change the result
+    for (const BoundingFrustum& currentFrustum : {frustum, frustum, movedFrustum})
+    {
+      const std::size_t visibleCount = FrustumCullUtil::Cull(currentFrustum, record.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(mask));
+      std::size_t expectedVisibleCount = 0;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const bool expected = currentFrustum.Intersects(record.Boxes[i]);
+        EXPECT_EQ(expected, FrustumCullUtil::IsVisible(SpanUtil::AsReadOnlySpan(mask), i));
+        expectedVisibleCount += expected ? 1u : 0u;
+      }
+      EXPECT_EQ(expectedVisibleCount, visibleCount);
+    }
+  }
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_Boxes_PlaneCache_RecordsRejectingPlane)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  const BoxRecord record(250);
+  std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(250), FrustumCullUtil::InvalidPlaneIndex);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(250));
+  FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(mask));
+
+  for (std::size_t group = 0; group < planeCache.size(); ++group)
+  {
+    const uint32_t groupMask = (mask[(group * 4u) / 32u] >> ((group * 4u) % 32u)) & 0xF;
+    if (groupMask == 0u)
+    {
+      EXPECT_LT(planeCache[group], static_cast<uint8_t>(BoundingFrustum::PlaneCount));
+    }
+    else
+    {
+      EXPECT_EQ(FrustumCullUtil::InvalidPlaneIndex, planeCache[group]);
+    }
+  }
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_Spheres)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  for (const std::size_t count : TestCounts)
+  {
+    const SphereRecord record(count);
+    std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(count), FrustumCullUtil::InvalidPlaneIndex);
+    std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+    std::vector<uint32_t> cachedMask(FrustumCullUtil::CalcMaskWordCount(count));
+    const std::size_t visibleCount = FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(mask));
+    FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(cachedMask));
+    const std::size_t cachedVisibleCount =
+      FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(cachedMask));
+
+    std::size_t expectedVisibleCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const bool expected = frustum.Intersects(record.Spheres[i]);
+      EXPECT_EQ(expected, FrustumCullUtil::IsVisible(SpanUtil::AsReadOnlySpan(mask), i));
+      expectedVisibleCount += expected ? 1u : 0u;
+    }
+    EXPECT_EQ(expectedVisibleCount, visibleCount);
+    EXPECT_EQ(expectedVisibleCount, cachedVisibleCount);
+    EXPECT_EQ(mask, cachedMask);
+  }
+}
+
+
+TEST(TestMath_FrustumCullUtil, Cull_InvalidArguments)
+{
+  const BoundingFrustum frustum = CreateTestFrustum();
+  BoxRecord record(5);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(5));
+  std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(5));
+  std::vector<uint8_t> smallPlaneCache(1);
+  std::vector<uint32_t> emptyMask;
+
+  EXPECT_THROW(FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(emptyMask)), std::invalid_argument);
+  EXPECT_THROW(FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(smallPlaneCache), SpanUtil::AsSpan(mask)),
+               std::invalid_argument);
+  EXPECT_NO_THROW(FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(mask)));
+
+  record.MaxZ.pop_back();
+  EXPECT_THROW(FrustumCullUtil::Cull(frustum, record.AsSpans(), SpanUtil::AsSpan(mask)), std::invalid_argument);
+}
@@ -34,7 +34,9 @@
 #include <FslBase/Math/MathHelper.hpp>
 #include <FslBase/Math/Matrix.hpp>
 #include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -311,6 +313,41 @@ TEST(TestMath_Matrix, Invert_Identity)
 }
 
 
+TEST(TestMath_Matrix, Invert)
+{
+  const Matrix value = Matrix::CreateScale(2.0f, 3.0f, 4.0f) * Matrix::CreateRotationX(0.3f) * Matrix::CreateRotationY(-1.2f) *
+                       Matrix::CreateTranslation(10.0f, -20.0f, 30.0f);
+  const Matrix res = Matrix::Invert(value);
+  const Matrix identity = value * res;
+
+  const Matrix expected = Matrix::GetIdentity();
+  const float* const pIdentity = identity.DirectAccess();
+  const float* const pExpected = expected.DirectAccess();
+  for (uint32_t i = 0; i < (4 * 4); ++i)
+  {
+    EXPECT_NEAR(pExpected[i], pIdentity[i], 0.00001f) << " at index: " << i;
+  }
+}
+
+
+TEST(TestMath_Matrix, Invert_Perspective)
+{
+  const Matrix value = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 1.5f, 0.1f, 1000.0f);
+  const Matrix res = Matrix::Invert(value);
+
+  // The inverse of the perspective projection can be calculated directly
+  const float* const pValue = value.DirectAccess();
+  const Matrix expected(1.0f / pValue[0], 0.0f, 0.0f, 0.0f, 0.0f, 1.0f / pValue[5], 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f / pValue[14], 0.0f, 0.0f,
+                        -1.0f, pValue[10] / pValue[14]);
+  const float* const pExpected = expected.DirectAccess();
+  const float* const pRes = res.DirectAccess();
+  for (uint32_t i = 0; i < (4 * 4); ++i)
+  {
+    EXPECT_NEAR(pExpected[i], pRes[i], std::max(std::abs(pExpected[i]) * 0.00001f, 0.0000001f)) << " at index: " << i;
+  }
+}
+
+
 TEST(TestMath_Matrix, Transpose_Identity)
 {
   const auto identity = Matrix::GetIdentity();
@@ -706,6 +743,40 @@ TEST(TestMath_Matrix, Lerp_Ref)
 }
 
 
+TEST(TestMath_Matrix, Multiply_MatchesConstexpr)
+{
+  constexpr Matrix Value1(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+  constexpr Matrix Value2(0.5f, -1.5f, 2.25f, 3.0f, -4.0f, 5.5f, 6.0f, -7.25f, 8.0f, 9.5f, -10.0f, 11.0f, 12.5f, -13.0f, 14.0f, 15.75f);
+  // Evaluated at compile time so this uses the scalar code
+  constexpr Matrix Expected = Matrix::Multiply(Value1, Value2);
+
+  Matrix res;
+  Matrix::Multiply(Value1, Value2, res);
+  EXPECT_EQ(Expected, res);
+  EXPECT_EQ(Expected, Matrix::Multiply(Value1, Value2));
+  EXPECT_EQ(Expected, Value1 * Value2);
+}
+
+
+TEST(TestMath_Matrix, Multiply_Aliased)
+{
+  constexpr Matrix Value1(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+  constexpr Matrix Value2(0.5f, -1.5f, 2.25f, 3.0f, -4.0f, 5.5f, 6.0f, -7.25f, 8.0f, 9.5f, -10.0f, 11.0f, 12.5f, -13.0f, 14.0f, 15.75f);
+
+  Matrix res1 = Value1;
+  Matrix::Multiply(Value1, Value2, res1);
+  EXPECT_EQ(Value1 * Value2, res1);
+
+  Matrix res2 = Value2;
+  Matrix::Multiply(Value1, Value2, res2);
+  EXPECT_EQ(Value1 * Value2, res2);
+
+  Matrix res3 = Value1;
+  res3 *= res3;
+  EXPECT_EQ(Value1 * Value1, res3);
+}
+
+
 TEST(TestMath_Matrix, Negate)
 {
   const Matrix value(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
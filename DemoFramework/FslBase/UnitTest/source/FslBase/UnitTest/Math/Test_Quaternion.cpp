@@ -0,0 +1,156 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Quaternion.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/Test/Math/TestQuaternion.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <cmath>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestMath_Quaternion = TestFixtureFslBase;
+
+  float Dot(const Quaternion& lhs, const Quaternion& rhs)
+  {
+    return (((lhs.X * rhs.X) + (lhs.Y * rhs.Y)) + (lhs.Z * rhs.Z)) + (lhs.W * rhs.W);
+  }
+
+  // Straightforward reference implementations
+  Quaternion ReferenceLerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
+  {
+    const float sign = Dot(quaternion1, quaternion2) >= 0.0f ? 1.0f : -1.0f;
+    const float weight1 = 1.0f - amount;
+    const float weight2 = amount * sign;
+    Quaternion result((weight1 * quaternion1.X) + (weight2 * quaternion2.X), (weight1 * quaternion1.Y) + (weight2 * quaternion2.Y),
+                      (weight1 * quaternion1.Z) + (weight2 * quaternion2.Z), (weight1 * quaternion1.W) + (weight2 * quaternion2.W));
+    const float scale = 1.0f / std::sqrt(Dot(result, result));
+    return {result.X * scale, result.Y * scale, result.Z * scale, result.W * scale};
+  }
+
+  Quaternion ReferenceSlerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
+  {
+    float dot = Dot(quaternion1, quaternion2);
+    const float sign = dot >= 0.0f ? 1.0f : -1.0f;
+    dot = std::abs(dot);
+    const double angle = std::acos(static_cast<double>(dot));
+    const double invSin = 1.0 / std::sin(angle);
+    const auto weight1 = static_cast<float>(std::sin((1.0 - amount) * angle) * invSin);
+    const auto weight2 = static_cast<float>(std::sin(amount * angle) * invSin) * sign;
+    return {(weight1 * quaternion1.X) + (weight2 * quaternion2.X), (weight1 * quaternion1.Y) + (weight2 * quaternion2.Y),
+            (weight1 * quaternion1.Z) + (weight2 * quaternion2.Z), (weight1 * quaternion1.W) + (weight2 * quaternion2.W)};
+  }
+
+  constexpr float Tolerance = 0.00001f;
+
+  void ExpectNear(const Quaternion& expected, const Quaternion& actual)
+  {
+    EXPECT_NEAR(expected.X, actual.X, Tolerance);
+    EXPECT_NEAR(expected.Y, actual.Y, Tolerance);
+    EXPECT_NEAR(expected.Z, actual.Z, Tolerance);
+    EXPECT_NEAR(expected.W, actual.W, Tolerance);
+  }
+}
+
+
+TEST(TestMath_Quaternion, Lerp)
+{
+  const Quaternion value1 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.5f);
+  const Quaternion value2 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(-3.0f, 1.0f, 0.5f)), 2.0f);
+
+  for (const float amount : std::array<float, 4>{0.0f, 0.25f, 0.6f, 1.0f})
+  {
+    const Quaternion expected = ReferenceLerp(value1, value2, amount);
+    ExpectNear(expected, Quaternion::Lerp(value1, value2, amount));
+
+    Quaternion res;
+    Quaternion::Lerp(res, value1, value2, amount);
+    ExpectNear(expected, res);
+  }
+}
+
+
+TEST(TestMath_Quaternion, Lerp_NegativeDot)
+{
+  const Quaternion value1 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.5f);
+  const Quaternion value2 = Quaternion::Negate(Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 0.0f, 0.5f)), 1.0f));
+
+  const Quaternion expected = ReferenceLerp(value1, value2, 0.3f);
+  ExpectNear(expected, Quaternion::Lerp(value1, value2, 0.3f));
+
+  Quaternion res;
+  Quaternion::Lerp(res, value1, value2, 0.3f);
+  ExpectNear(expected, res);
+}
+
+
+TEST(TestMath_Quaternion, Slerp)
+{
+  const Quaternion value1 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.5f);
+  const Quaternion value2 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(-3.0f, 1.0f, 0.5f)), 2.0f);
+
+  for (const float amount : std::array<float, 4>{0.0f, 0.25f, 0.6f, 1.0f})
+  {
+    const Quaternion expected = ReferenceSlerp(value1, value2, amount);
+    ExpectNear(expected, Quaternion::Slerp(value1, value2, amount));
+
+    Quaternion res;
+    Quaternion::Slerp(res, value1, value2, amount);
+    ExpectNear(expected, res);
+  }
+}
+
+
+TEST(TestMath_Quaternion, Slerp_NegativeDot)
+{
+  const Quaternion value1 = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.5f);
+  const Quaternion value2 = Quaternion::Negate(Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 0.0f, 0.5f)), 1.0f));
+
+  const Quaternion expected = ReferenceSlerp(value1, value2, 0.3f);
+  ExpectNear(expected, Quaternion::Slerp(value1, value2, 0.3f));
+
+  Quaternion res;
+  Quaternion::Slerp(res, value1, value2, 0.3f);
+  ExpectNear(expected, res);
+}
+
+
+TEST(TestMath_Quaternion, Slerp_NearlyEqual)
+{
+  const Quaternion value = Quaternion::CreateFromAxisAngle(Vector3::Normalize(Vector3(1.0f, 2.0f, 3.0f)), 0.5f);
+
+  // Falls back to a linear blend without normalization
+  ExpectNear(value, Quaternion::Slerp(value, value, 0.4f));
+}
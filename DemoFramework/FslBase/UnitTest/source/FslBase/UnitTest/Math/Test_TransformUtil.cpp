@@ -0,0 +1,183 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/LogVector3.hpp>
+#include <FslBase/Log/Math/LogVector4.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Math/TransformUtil.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestMath_TransformUtil = TestFixtureFslBase;
+
+  Matrix CreateTestMatrix()
+  {
+    return Matrix::CreateScale(2.0f, 3.0f, 4.0f) * Matrix::CreateRotationX(0.3f) * Matrix::CreateRotationY(-1.2f) *
+           Matrix::CreateTranslation(10.0f, -20.0f, 30.0f) * Matrix::CreatePerspectiveFieldOfView(1.0f, 1.5f, 0.1f, 100.0f);
+  }
+
+  std::vector<Vector3> CreateVector3(const std::size_t count)
+  {
+    std::vector<Vector3> result(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i);
+      result[i] = Vector3(value * 0.5f, 1.0f - value, value * value * 0.25f);
+    }
+    return result;
+  }
+
+  std::vector<Vector4> CreateVector4(const std::size_t count)
+  {
+    std::vector<Vector4> result(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i);
+      result[i] = Vector4(value * 0.5f, 1.0f - value, value * value * 0.25f, 1.0f + (value * 0.125f));
+    }
+    return result;
+  }
+
+  // Odd and even counts to cover the remainder handling
+  constexpr std::array<std::size_t, 6> TestCounts = {0, 1, 2, 3, 7, 16};
+}
+
+
+TEST(TestMath_TransformUtil, Transform_Vector3)
+{
+  const Matrix matrix = CreateTestMatrix();
+  for (const std::size_t count : TestCounts)
+  {
+    const std::vector<Vector3> src = CreateVector3(count);
+    std::vector<Vector3> dst(count);
+    TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(Vector3::Transform(src[i], matrix), dst[i]);
+    }
+  }
+}
+
+
+TEST(TestMath_TransformUtil, Transform_Vector3_InPlace)
+{
+  const Matrix matrix = CreateTestMatrix();
+  const std::vector<Vector3> src = CreateVector3(7);
+  std::vector<Vector3> values = src;
+  TransformUtil::Transform(SpanUtil::AsReadOnlySpan(values), matrix, SpanUtil::AsSpan(values));
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(Vector3::Transform(src[i], matrix), values[i]);
+  }
+}
+
+
+TEST(TestMath_TransformUtil, TransformNormal_Vector3)
+{
+  const Matrix matrix = CreateTestMatrix();
+  for (const std::size_t count : TestCounts)
+  {
+    const std::vector<Vector3> src = CreateVector3(count);
+    std::vector<Vector3> dst(count);
+    TransformUtil::TransformNormal(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(Vector3::TransformNormal(src[i], matrix), dst[i]);
+    }
+  }
+}
+
+
+TEST(TestMath_TransformUtil, Transform_Vector3ToVector4)
+{
+  const Matrix matrix = CreateTestMatrix();
+  for (const std::size_t count : TestCounts)
+  {
+    const std::vector<Vector3> src = CreateVector3(count);
+    std::vector<Vector4> dst(count);
+    TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(Vector4::Transform(src[i], matrix), dst[i]);
+    }
+  }
+}
+
+
+TEST(TestMath_TransformUtil, Transform_Vector4)
+{
+  const Matrix matrix = CreateTestMatrix();
+  for (const std::size_t count : TestCounts)
+  {
+    const std::vector<Vector4> src = CreateVector4(count);
+    std::vector<Vector4> dst(count);
+    TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(Vector4::Transform(src[i], matrix), dst[i]);
+    }
+  }
+}
+
+
+TEST(TestMath_TransformUtil, Transform_Vector4_InPlace)
+{
+  const Matrix matrix = CreateTestMatrix();
+  const std::vector<Vector4> src = CreateVector4(7);
+  std::vector<Vector4> values = src;
+  TransformUtil::Transform(SpanUtil::AsReadOnlySpan(values), matrix, SpanUtil::AsSpan(values));
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(Vector4::Transform(src[i], matrix), values[i]);
+  }
+}
+
+
+TEST(TestMath_TransformUtil, Transform_DstTooSmall)
+{
+  const Matrix matrix = CreateTestMatrix();
+  const std::vector<Vector3> src3 = CreateVector3(4);
+  const std::vector<Vector4> src4 = CreateVector4(4);
+  std::vector<Vector3> dst3(3);
+  std::vector<Vector4> dst4(3);
+
+  EXPECT_THROW(TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src3), matrix, SpanUtil::AsSpan(dst3)), std::invalid_argument);
+  EXPECT_THROW(TransformUtil::TransformNormal(SpanUtil::AsReadOnlySpan(src3), matrix, SpanUtil::AsSpan(dst3)), std::invalid_argument);
+  EXPECT_THROW(TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src3), matrix, SpanUtil::AsSpan(dst4)), std::invalid_argument);
+  EXPECT_THROW(TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src4), matrix, SpanUtil::AsSpan(dst4)), std::invalid_argument);
+}
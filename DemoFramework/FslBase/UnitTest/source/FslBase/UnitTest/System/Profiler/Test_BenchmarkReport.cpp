@@ -0,0 +1,204 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Profiler/BenchmarkReport.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSystem_Profiler_BenchmarkReport = TestFixtureFslBase;
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, CalcStats_Empty)
+{
+  const BenchmarkSampleStats stats = BenchmarkReport::CalcStats({});
+  EXPECT_EQ(0u, stats.Count);
+  EXPECT_EQ(0u, stats.Max);
+  EXPECT_EQ(0.0, stats.Mean());
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, CalcStats_Single)
+{
+  const std::vector<uint64_t> samples = {42};
+  const BenchmarkSampleStats stats = BenchmarkReport::CalcStats(SpanUtil::AsReadOnlySpan(samples));
+  EXPECT_EQ(42u, stats.P50);
+  EXPECT_EQ(42u, stats.P95);
+  EXPECT_EQ(42u, stats.P99);
+  EXPECT_EQ(42u, stats.Max);
+  EXPECT_EQ(42u, stats.Total);
+  EXPECT_EQ(1u, stats.Count);
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, CalcStats_NearestRank)
+{
+  // 1..100 in reverse order so the samples must be sorted
+  std::vector<uint64_t> samples;
+  for (uint64_t i = 100; i > 0; --i)
+  {
+    samples.push_back(i);
+  }
+  const BenchmarkSampleStats stats = BenchmarkReport::CalcStats(SpanUtil::AsReadOnlySpan(samples));
+  EXPECT_EQ(50u, stats.P50);
+  EXPECT_EQ(95u, stats.P95);
+  EXPECT_EQ(99u, stats.P99);
+  EXPECT_EQ(100u, stats.Max);
+  EXPECT_EQ(5050u, stats.Total);
+  EXPECT_EQ(100u, stats.Count);
+  EXPECT_DOUBLE_EQ(50.5, stats.Mean());
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, AddPhaseTime_WithoutFrame)
+{
+  BenchmarkReport report;
+  EXPECT_THROW(report.AddPhaseTime("Update", 10), UsageErrorException);
+  EXPECT_THROW(report.AddAllocations(1), UsageErrorException);
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, AddPhaseTime)
+{
+  BenchmarkReport report;
+  report.Reserve(4);
+  report.BeginFrame();
+  report.AddPhaseTime("Update", 10);
+  report.AddPhaseTime("Update", 5);
+  report.AddAllocations(3);
+  report.BeginFrame();
+  report.AddPhaseTime("Draw", 20);
+  report.BeginFrame();
+  report.AddPhaseTime("Update", 30);
+  report.AddPhaseTime("Draw", 40);
+  report.AddAllocations(1);
+
+  EXPECT_EQ(3u, report.GetFrameCount());
+
+  // Frames where a phase wasn't sampled count as zero
+  const BenchmarkSampleStats update = report.GetPhaseStats("Update");
+  EXPECT_EQ(3u, update.Count);
+  EXPECT_EQ(15u, update.P50);
+  EXPECT_EQ(30u, update.Max);
+  EXPECT_EQ(45u, update.Total);
+
+  const BenchmarkSampleStats draw = report.GetPhaseStats("Draw");
+  EXPECT_EQ(3u, draw.Count);
+  EXPECT_EQ(20u, draw.P50);
+  EXPECT_EQ(40u, draw.Max);
+  EXPECT_EQ(60u, draw.Total);
+
+  const BenchmarkSampleStats allocations = report.GetAllocationStats();
+  EXPECT_EQ(3u, allocations.Count);
+  EXPECT_EQ(1u, allocations.P50);
+  EXPECT_EQ(3u, allocations.Max);
+  EXPECT_EQ(4u, allocations.Total);
+
+  EXPECT_EQ(0u, report.GetPhaseStats("Unknown").Count);
+
+  report.Clear();
+  EXPECT_EQ(0u, report.GetFrameCount());
+  EXPECT_EQ(0u, report.GetPhaseStats("Update").Count);
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, ToJson)
+{
+  BenchmarkReport report;
+  report.BeginFrame();
+  report.AddPhaseTime("App.Update", 1500);
+  report.AddAllocations(2);
+
+  const std::string result = report.ToJson(BenchmarkReportInfo("My \"app\"", 10, 16666667));
+  EXPECT_NE(std::string::npos, result.find(R"("name":"My \"app\"")"));
+  EXPECT_NE(std::string::npos, result.find(R"("warmupFrames":10)"));
+  EXPECT_NE(std::string::npos, result.find(R"("frames":1)"));
+  EXPECT_NE(std::string::npos, result.find(R"("timestep":16666.667)"));
+  EXPECT_NE(std::string::npos,
+            result.find(R"({"name":"App.Update","p50":1.500,"p95":1.500,"p99":1.500,"max":1.500,"mean":1.500,"total":1.500})"));
+  EXPECT_NE(std::string::npos, result.find(R"("allocations":{"p50":2,"p95":2,"p99":2,"max":2,"mean":2.000,"total":2})"));
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, ToCsv)
+{
+  BenchmarkReport report;
+  report.BeginFrame();
+  report.AddPhaseTime("App.Update", 1500);
+  report.AddPhaseTime("a,b", 1000);
+
+  const std::string result = report.ToCsv();
+  EXPECT_EQ(std::string("name,unit,p50,p95,p99,max,mean,total\n"
+                        "App.Update,us,1.500,1.500,1.500,1.500,1.500,1.500\n"
+                        "\"a,b\",us,1.000,1.000,1.000,1.000,1.000,1.000\n"
+                        "allocations,count,0,0,0,0,0.000,0\n"),
+            result);
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, ToJson_AllocationsNotCounted)
+{
+  BenchmarkReport report;
+  report.SetAllocationsCounted(false);
+  report.BeginFrame();
+  report.AddPhaseTime("App.Update", 1500);
+
+  const std::string result = report.ToJson(BenchmarkReportInfo("app", 0, 0));
+  EXPECT_NE(std::string::npos, result.find(R"("allocations":null)"));
+  EXPECT_EQ(std::string::npos, result.find(R"("allocations":{)"));
+}
+
+
+TEST(TestSystem_Profiler_BenchmarkReport, ToCsv_AllocationsNotCounted)
+{
+  BenchmarkReport report;
+  report.SetAllocationsCounted(false);
+  report.BeginFrame();
+  report.AddPhaseTime("App.Update", 1500);
+  report.Clear();
+  EXPECT_FALSE(report.IsAllocationsCounted());
+  report.BeginFrame();
+  report.AddPhaseTime("App.Update", 1500);
+
+  const std::string result = report.ToCsv();
+  EXPECT_EQ(std::string("name,unit,p50,p95,p99,max,mean,total\n"
+                        "App.Update,us,1.500,1.500,1.500,1.500,1.500,1.500\n"
+                        "allocations,count,n/a,n/a,n/a,n/a,n/a,n/a\n"),
+            result);
+}
@@ -0,0 +1,68 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Profiler/ChromeTraceUtil.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSystem_Profiler_ChromeTraceUtil = TestFixtureFslBase;
+}
+
+
+TEST(TestSystem_Profiler_ChromeTraceUtil, ToJson_Empty)
+{
+  const std::string result = ChromeTraceUtil::ToJson({}, {});
+  EXPECT_EQ(std::string("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n"), result);
+}
+
+
+TEST(TestSystem_Profiler_ChromeTraceUtil, ToJson)
+{
+  std::vector<ScopeProfilerEvent> events;
+  events.emplace_back("Outer", 1000, 6500, 1, 0);
+  events.emplace_back("Inner", 2000, 3001, 1, 1);
+  std::vector<ScopeProfilerThreadInfo> threads;
+  threads.emplace_back(1, "Main \"thread\"");
+
+  const std::string result = ChromeTraceUtil::ToJson(SpanUtil::AsReadOnlySpan(events), SpanUtil::AsReadOnlySpan(threads));
+
+  EXPECT_NE(std::string::npos, result.find(R"({"name":"thread_name","ph":"M","pid":1,"tid":1,"args":{"name":"Main \"thread\""}})"));
+  // Timestamps are relative to the first event and written in microseconds
+  EXPECT_NE(std::string::npos, result.find(R"({"name":"Outer","cat":"cpu","ph":"X","ts":0.000,"dur":5.500,"pid":1,"tid":1})"));
+  EXPECT_NE(std::string::npos, result.find(R"({"name":"Inner","cat":"cpu","ph":"X","ts":1.000,"dur":1.001,"pid":1,"tid":1})"));
+}
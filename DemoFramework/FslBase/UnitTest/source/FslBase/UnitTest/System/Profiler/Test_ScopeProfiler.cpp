@@ -0,0 +1,247 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerConsumer.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestSystem_Profiler_ScopeProfiler : public TestFixtureFslBase
+  {
+  public:
+    TestSystem_Profiler_ScopeProfiler()
+    {
+      // Discard anything recorded by earlier tests
+      ScopeProfiler::EndRecording();
+      std::vector<ScopeProfilerEvent> events;
+      ScopeProfiler::Collect(events);
+    }
+
+    ~TestSystem_Profiler_ScopeProfiler() override
+    {
+      ScopeProfiler::EndRecording();
+    }
+  };
+
+  const ScopeProfilerEvent* TryFind(const std::vector<ScopeProfilerEvent>& events, const char* const pszName)
+  {
+    auto itrFind =
+      std::find_if(events.begin(), events.end(), [pszName](const ScopeProfilerEvent& entry) { return std::strcmp(entry.pszName, pszName) == 0; });
+    return itrFind != events.end() ? &(*itrFind) : nullptr;
+  }
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, NotRecording)
+{
+  EXPECT_FALSE(ScopeProfiler::IsRecording());
+  {
+    const ScopedProfilerZone zone("NotRecorded");
+  }
+  std::vector<ScopeProfilerEvent> events;
+  EXPECT_EQ(0u, ScopeProfiler::Collect(events));
+  EXPECT_TRUE(events.empty());
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, Macro)
+{
+  ScopeProfiler::BeginRecording();
+  {
+    FSL_PROFILE_SCOPE("Macro");
+  }
+  ScopeProfiler::EndRecording();
+
+  std::vector<ScopeProfilerEvent> events;
+  ScopeProfiler::Collect(events);
+#ifndef FSL_SCOPE_PROFILER_DISABLED
+  ASSERT_EQ(1u, events.size());
+  EXPECT_NE(nullptr, TryFind(events, "Macro"));
+#else
+  // The ScopeProfiler=Disabled flavor compiles the zone out
+  EXPECT_TRUE(events.empty());
+#endif
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, NestedZones)
+{
+  ScopeProfiler::BeginRecording();
+  EXPECT_TRUE(ScopeProfiler::IsRecording());
+  {
+    const ScopedProfilerZone outerZone("Outer");
+    {
+      const ScopedProfilerZone innerZone("Inner");
+    }
+  }
+  ScopeProfiler::EndRecording();
+
+  std::vector<ScopeProfilerEvent> events;
+  EXPECT_EQ(0u, ScopeProfiler::Collect(events));
+  ASSERT_EQ(2u, events.size());
+  const ScopeProfilerEvent* pOuter = TryFind(events, "Outer");
+  const ScopeProfilerEvent* pInner = TryFind(events, "Inner");
+  ASSERT_NE(nullptr, pOuter);
+  ASSERT_NE(nullptr, pInner);
+  EXPECT_EQ(0u, pOuter->Depth);
+  EXPECT_EQ(1u, pInner->Depth);
+  EXPECT_EQ(pOuter->ThreadId, pInner->ThreadId);
+  EXPECT_LE(pOuter->BeginNanoseconds, pInner->BeginNanoseconds);
+  EXPECT_LE(pInner->EndNanoseconds, pOuter->EndNanoseconds);
+
+  // The events are moved out by collect
+  events.clear();
+  ScopeProfiler::Collect(events);
+  EXPECT_TRUE(events.empty());
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, MultipleThreads)
+{
+  ScopeProfiler::BeginRecording();
+  {
+    const ScopedProfilerZone zone("MainThread");
+  }
+  std::thread worker(
+    []()
+    {
+      ScopeProfiler::SetThreadName("ScopeProfilerTestWorker");
+      const ScopedProfilerZone zone("WorkerThread");
+    });
+  worker.join();
+  ScopeProfiler::EndRecording();
+
+  std::vector<ScopeProfilerEvent> events;
+  ScopeProfiler::Collect(events);
+  ASSERT_EQ(2u, events.size());
+  const ScopeProfilerEvent* pMain = TryFind(events, "MainThread");
+  const ScopeProfilerEvent* pWorker = TryFind(events, "WorkerThread");
+  ASSERT_NE(nullptr, pMain);
+  ASSERT_NE(nullptr, pWorker);
+  EXPECT_NE(pMain->ThreadId, pWorker->ThreadId);
+
+  const auto threads = ScopeProfiler::GetThreads();
+  const uint32_t workerThreadId = pWorker->ThreadId;
+  auto itrFind =
+    std::find_if(threads.begin(), threads.end(), [workerThreadId](const ScopeProfilerThreadInfo& info) { return info.ThreadId == workerThreadId; });
+  ASSERT_NE(threads.end(), itrFind);
+  EXPECT_EQ(std::string("ScopeProfilerTestWorker"), itrFind->Name);
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, Dropped)
+{
+  constexpr uint32_t ExtraZones = 10;
+  ScopeProfiler::BeginRecording();
+  for (uint32_t i = 0; i < (ScopeProfiler::EventsPerThread + ExtraZones); ++i)
+  {
+    const ScopedProfilerZone zone("Zone");
+  }
+  ScopeProfiler::EndRecording();
+
+  std::vector<ScopeProfilerEvent> events;
+  EXPECT_EQ(ExtraZones, ScopeProfiler::Collect(events));
+  EXPECT_EQ(ScopeProfiler::EventsPerThread, events.size());
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, MultipleBlocks)
+{
+  // Span several blocks and collect twice so the drained blocks are recycled
+  constexpr uint32_t ZoneCount = (ScopeProfiler::EventsPerBlock * 3) + 5;
+  for (uint32_t collectIndex = 0; collectIndex < 2; ++collectIndex)
+  {
+    ScopeProfiler::BeginRecording();
+    for (uint32_t i = 0; i < ZoneCount; ++i)
+    {
+      const ScopedProfilerZone zone("Zone");
+    }
+    ScopeProfiler::EndRecording();
+
+    std::vector<ScopeProfilerEvent> events;
+    EXPECT_EQ(0u, ScopeProfiler::Collect(events));
+    ASSERT_EQ(ZoneCount, events.size());
+    for (std::size_t i = 1; i < events.size(); ++i)
+    {
+      EXPECT_LE(events[i - 1].EndNanoseconds, events[i].BeginNanoseconds);
+    }
+  }
+}
+
+
+TEST_F(TestSystem_Profiler_ScopeProfiler, IndependentConsumers)
+{
+  ScopeProfilerConsumer consumerA;
+  ScopeProfilerConsumer consumerB;
+
+  consumerA.BeginRecording();
+  {
+    const ScopedProfilerZone zone("OnlyA");
+  }
+  consumerB.BeginRecording();
+  {
+    const ScopedProfilerZone zone("Both");
+  }
+  // Collecting for one consumer must not take the zones of the other
+  std::vector<ScopeProfilerEvent> eventsA;
+  EXPECT_EQ(0u, consumerA.Collect(eventsA));
+  consumerA.EndRecording();
+  EXPECT_TRUE(ScopeProfiler::IsRecording());
+  {
+    const ScopedProfilerZone zone("OnlyB");
+  }
+  consumerB.EndRecording();
+  EXPECT_FALSE(ScopeProfiler::IsRecording());
+
+  std::vector<ScopeProfilerEvent> eventsB;
+  EXPECT_EQ(0u, consumerB.Collect(eventsB));
+  consumerA.Collect(eventsA);
+
+  ASSERT_EQ(2u, eventsA.size());
+  EXPECT_NE(nullptr, TryFind(eventsA, "OnlyA"));
+  EXPECT_NE(nullptr, TryFind(eventsA, "Both"));
+  ASSERT_EQ(2u, eventsB.size());
+  EXPECT_NE(nullptr, TryFind(eventsB, "Both"));
+  EXPECT_NE(nullptr, TryFind(eventsB, "OnlyB"));
+
+  // The default consumer was not recording
+  std::vector<ScopeProfilerEvent> events;
+  ScopeProfiler::Collect(events);
+  EXPECT_TRUE(events.empty());
+}
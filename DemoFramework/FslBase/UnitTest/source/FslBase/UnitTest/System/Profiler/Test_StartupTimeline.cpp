@@ -0,0 +1,162 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestSystem_Profiler_StartupTimeline : public TestFixtureFslBase
+  {
+  public:
+    TestSystem_Profiler_StartupTimeline()
+    {
+      StartupTimeline::Clear();
+      StartupTimeline::BeginRecording();
+    }
+
+    ~TestSystem_Profiler_StartupTimeline() override
+    {
+      StartupTimeline::EndRecording();
+      StartupTimeline::Clear();
+    }
+  };
+
+  const StartupTimelineEvent* TryFind(const std::vector<StartupTimelineEvent>& events, const std::string& name)
+  {
+    auto itrFind = std::find_if(events.begin(), events.end(), [&name](const StartupTimelineEvent& entry) { return entry.Name == name; });
+    return itrFind != events.end() ? &(*itrFind) : nullptr;
+  }
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, ProcessStart)
+{
+  const uint64_t processStart = StartupTimeline::GetProcessStartTimestamp();
+  EXPECT_LE(processStart, ScopeProfiler::GetTimestamp());
+  EXPECT_EQ(processStart, StartupTimeline::GetProcessStartTimestamp());
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, Zone)
+{
+  {
+    ScopedStartupTimelineZone zone("Outer");
+    ScopedStartupTimelineZone zone2("Inner");
+    zone2.SetName("Renamed");
+  }
+
+  const std::vector<StartupTimelineEvent> events = StartupTimeline::GetEvents();
+  ASSERT_EQ(2u, events.size());
+  const StartupTimelineEvent* pOuter = TryFind(events, "Outer");
+  const StartupTimelineEvent* pInner = TryFind(events, "Renamed");
+  ASSERT_NE(nullptr, pOuter);
+  ASSERT_NE(nullptr, pInner);
+  EXPECT_LE(pOuter->BeginNanoseconds, pInner->BeginNanoseconds);
+  EXPECT_GE(pOuter->EndNanoseconds, pInner->EndNanoseconds);
+  EXPECT_EQ(pOuter->ThreadId, pInner->ThreadId);
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, EndRecording)
+{
+  { ScopedStartupTimelineZone zone("Before"); }
+
+  EXPECT_TRUE(StartupTimeline::EndRecording());
+  EXPECT_FALSE(StartupTimeline::IsRecording());
+  EXPECT_FALSE(StartupTimeline::EndRecording());
+  EXPECT_NE(0u, StartupTimeline::GetEndTimestamp());
+
+  { ScopedStartupTimelineZone zone("After"); }
+  StartupTimeline::AddEvent("Added", 0, 1);
+
+  const std::vector<StartupTimelineEvent> events = StartupTimeline::GetEvents();
+  ASSERT_EQ(1u, events.size());
+  EXPECT_EQ(std::string("Before"), events.front().Name);
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, ZoneStartedBeforeEndRecording)
+{
+  {
+    ScopedStartupTimelineZone zone("Zone");
+    StartupTimeline::EndRecording();
+  }
+  EXPECT_TRUE(StartupTimeline::GetEvents().empty());
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, MultipleThreads)
+{
+  { ScopedStartupTimelineZone zone("Main"); }
+  std::thread thread(
+    []()
+    {
+      StartupTimeline::SetThreadName("Worker");
+      ScopedStartupTimelineZone zone("Worker zone");
+    });
+  thread.join();
+
+  const std::vector<StartupTimelineEvent> events = StartupTimeline::GetEvents();
+  const StartupTimelineEvent* pMain = TryFind(events, "Main");
+  const StartupTimelineEvent* pWorker = TryFind(events, "Worker zone");
+  ASSERT_NE(nullptr, pMain);
+  ASSERT_NE(nullptr, pWorker);
+  EXPECT_NE(pMain->ThreadId, pWorker->ThreadId);
+
+  const std::vector<ScopeProfilerThreadInfo> threads = StartupTimeline::GetThreads();
+  const uint32_t workerThreadId = pWorker->ThreadId;
+  auto itrFind =
+    std::find_if(threads.begin(), threads.end(), [workerThreadId](const ScopeProfilerThreadInfo& info) { return info.ThreadId == workerThreadId; });
+  ASSERT_NE(threads.end(), itrFind);
+  EXPECT_EQ(std::string("Worker"), itrFind->Name);
+}
+
+
+TEST_F(TestSystem_Profiler_StartupTimeline, ToJson)
+{
+  const uint64_t processStart = StartupTimeline::GetProcessStartTimestamp();
+  StartupTimeline::AddEvent("Service \"A\"", processStart + 1000, processStart + 3500);
+  StartupTimeline::EndRecording();
+
+  const std::string result = StartupTimeline::ToJson();
+
+  // The root span starts at process start so all timestamps are relative to it
+  EXPECT_NE(std::string::npos, result.find(R"({"name":"Startup","cat":"cpu","ph":"X","ts":0.000,)"));
+  EXPECT_NE(std::string::npos, result.find(R"({"name":"Service \"A\"","cat":"cpu","ph":"X","ts":1.000,"dur":2.500,)"));
+}
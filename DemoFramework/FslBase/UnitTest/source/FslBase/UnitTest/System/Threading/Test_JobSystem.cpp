@@ -0,0 +1,246 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSystem_Threading_JobSystem = TestFixtureFslBase;
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Construct)
+{
+  JobSystem jobSystem(2u);
+  EXPECT_EQ(2u, jobSystem.GetWorkerThreadCount());
+  EXPECT_EQ(3u, jobSystem.GetConcurrency());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Construct_NoWorkers)
+{
+  JobSystem jobSystem(0u);
+  EXPECT_EQ(0u, jobSystem.GetWorkerThreadCount());
+  EXPECT_EQ(1u, jobSystem.GetConcurrency());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Wait)
+{
+  JobSystem jobSystem(2u);
+  std::atomic<uint32_t> value{0u};
+  JobHandle handle = jobSystem.Schedule([&value]() { value = 42u; });
+  EXPECT_TRUE(handle.IsValid());
+  jobSystem.Wait(handle);
+  EXPECT_TRUE(jobSystem.IsCompleted(handle));
+  EXPECT_EQ(42u, value.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Wait_NoWorkers)
+{
+  JobSystem jobSystem(0u);
+  uint32_t value = 0u;
+  JobHandle handle = jobSystem.Schedule([&value]() { value = 42u; });
+  EXPECT_FALSE(jobSystem.IsCompleted(handle));
+  jobSystem.Wait(handle);
+  EXPECT_EQ(42u, value);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_EmptyFunction)
+{
+  JobSystem jobSystem(1u);
+  EXPECT_THROW(jobSystem.Schedule(std::function<void()>()), std::invalid_argument);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Wait_InvalidHandle)
+{
+  JobSystem jobSystem(1u);
+  EXPECT_THROW(jobSystem.Wait(JobHandle()), std::invalid_argument);
+  EXPECT_THROW(jobSystem.IsCompleted(JobHandle()), std::invalid_argument);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Wait_RethrowsJobException)
+{
+  JobSystem jobSystem(1u);
+  JobHandle handle = jobSystem.Schedule([]() { throw NotSupportedException("test"); });
+  EXPECT_THROW(jobSystem.Wait(handle), NotSupportedException);
+  EXPECT_TRUE(jobSystem.IsCompleted(handle));
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Dependency)
+{
+  JobSystem jobSystem(3u);
+  std::atomic<uint32_t> stage{0u};
+  std::atomic<bool> orderOk{true};
+
+  JobHandle first = jobSystem.Schedule([&stage]() { stage = 1u; });
+  JobHandle second = jobSystem.Schedule(
+    [&]()
+    {
+      if (stage.load() != 1u)
+      {
+        orderOk = false;
+      }
+      stage = 2u;
+    },
+    first);
+  jobSystem.Wait(second);
+  EXPECT_TRUE(orderOk.load());
+  EXPECT_EQ(2u, stage.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_MultipleDependencies)
+{
+  JobSystem jobSystem(3u);
+  std::atomic<uint32_t> counter{0u};
+  std::atomic<uint32_t> counterWhenFinalRan{0u};
+
+  std::vector<JobHandle> dependencies;
+  for (uint32_t i = 0; i < 16u; ++i)
+  {
+    dependencies.push_back(jobSystem.Schedule([&counter]() { ++counter; }));
+  }
+  JobHandle final = jobSystem.Schedule([&]() { counterWhenFinalRan = counter.load(); }, SpanUtil::AsReadOnlySpan(dependencies));
+  jobSystem.Wait(final);
+  EXPECT_EQ(16u, counterWhenFinalRan.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, WaitAll)
+{
+  JobSystem jobSystem(2u);
+  std::atomic<uint32_t> counter{0u};
+  std::vector<JobHandle> handles;
+  for (uint32_t i = 0; i < 100u; ++i)
+  {
+    handles.push_back(jobSystem.Schedule([&counter]() { ++counter; }));
+  }
+  jobSystem.WaitAll(SpanUtil::AsReadOnlySpan(handles));
+  EXPECT_EQ(100u, counter.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_Span)
+{
+  JobSystem jobSystem(3u);
+  std::vector<uint32_t> values(10000u, 1u);
+  jobSystem.ParallelFor(SpanUtil::AsSpan(values), 64u,
+                        [](Span<uint32_t> batch, const std::size_t offset)
+                        {
+                          for (std::size_t i = 0; i < batch.size(); ++i)
+                          {
+                            batch[i] = static_cast<uint32_t>(offset + i);
+                          }
+                        });
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(i, values[i]);
+  }
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_ReadOnlySpan)
+{
+  JobSystem jobSystem(3u);
+  std::vector<uint32_t> values(10000u);
+  std::iota(values.begin(), values.end(), 0u);
+  std::atomic<uint64_t> sum{0u};
+  jobSystem.ParallelFor(SpanUtil::AsReadOnlySpan(values), 100u,
+                        [&sum](ReadOnlySpan<uint32_t> batch, const std::size_t /*offset*/)
+                        {
+                          uint64_t localSum = 0u;
+                          for (const uint32_t value : batch)
+                          {
+                            localSum += value;
+                          }
+                          sum += localSum;
+                        });
+  EXPECT_EQ((uint64_t(9999u) * 10000u) / 2u, sum.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_Empty)
+{
+  JobSystem jobSystem(1u);
+  std::vector<uint32_t> values;
+  uint32_t callCount = 0u;
+  jobSystem.ParallelFor(SpanUtil::AsSpan(values), 16u, [&callCount](Span<uint32_t> /*batch*/, const std::size_t /*offset*/) { ++callCount; });
+  EXPECT_EQ(0u, callCount);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelForRange_NoWorkers)
+{
+  JobSystem jobSystem(0u);
+  std::vector<uint32_t> values(1000u, 0u);
+  jobSystem.ParallelForRange(values.size(), 10u,
+                             [&values](const std::size_t startIndex, const std::size_t count)
+                             {
+                               for (std::size_t i = startIndex; i < (startIndex + count); ++i)
+                               {
+                                 ++values[i];
+                               }
+                             });
+  for (const uint32_t value : values)
+  {
+    EXPECT_EQ(1u, value);
+  }
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Destruct_ExecutesPendingJobs)
+{
+  std::atomic<uint32_t> counter{0u};
+  {
+    JobSystem jobSystem(0u);
+    for (uint32_t i = 0; i < 10u; ++i)
+    {
+      jobSystem.Schedule([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(10u, counter.load());
+}
@@ -0,0 +1,212 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_BOUNDEDMPMCQUEUE_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_BOUNDEDMPMCQUEUE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Fsl
+{
+  //! @brief A bounded lock free multi producer multi consumer queue.
+  //!        Each cell carries a sequence number that tells producers and consumers if the cell is ready for them,
+  //!        so a enqueue or dequeue only costs a single CAS in the uncontended case.
+  //! @note  Based on Dmitry Vyukov's bounded MPMC queue.
+  //! @note  The queue never blocks, use a external wait mechanism if you need to wait for entries.
+  template <typename T>
+  class BoundedMPMCQueue
+  {
+    static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+    static_assert(std::is_nothrow_move_assignable_v<T>, "T must be nothrow move assignable");
+
+    struct Cell
+    {
+      std::atomic<std::size_t> Sequence{0};
+      T Value{};
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_capacityMask;
+    // Producers and consumers modify different positions so keep them on separate cache lines
+    alignas(64) std::atomic<std::size_t> m_enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> m_dequeuePos{0};
+
+  public:
+    BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+    BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+    using value_type = T;
+
+    //! @brief Create the queue
+    //! @param capacity the max number of entries the queue can hold (must be a power of two and at least two).
+    explicit BoundedMPMCQueue(const uint32_t capacity)
+      : m_cells(std::make_unique<Cell[]>(capacity))
+      , m_capacityMask(static_cast<std::size_t>(capacity) - 1u)
+    {
+      if (capacity < 2u || (capacity & (capacity - 1u)) != 0u)
+      {
+        throw std::invalid_argument("capacity must be a power of two and at least two");
+      }
+      for (std::size_t i = 0; i < capacity; ++i)
+      {
+        m_cells[i].Sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    uint32_t Capacity() const noexcept
+    {
+      return static_cast<uint32_t>(m_capacityMask + 1u);
+    }
+
+    //! @brief Get the approximate number of entries in the queue.
+    //! @note  This is just a snapshot and it might be outdated before it is returned.
+    uint32_t ApproximateSize() const noexcept
+    {
+      const std::size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+      const std::size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+      return enqueuePos > dequeuePos ? static_cast<uint32_t>(enqueuePos - dequeuePos) : 0u;
+    }
+
+    //! @brief Try to add a copy of the value to the queue
+    //! @return true if the value was added, false if the queue was full.
+    //! @warning The copy assignment of T must not throw, as that would leave the claimed cell unpublished.
+    bool TryEnqueue(const T& value)
+    {
+      std::size_t pos = 0;
+      Cell* pCell = ClaimEnqueueCell(pos);
+      if (pCell == nullptr)
+      {
+        return false;
+      }
+      pCell->Value = value;
+      pCell->Sequence.store(pos + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Try to move the value into the queue
+    //! @return true if the value was added, false if the queue was full (in which case value is left untouched).
+    bool TryEnqueue(T&& value)
+    {
+      std::size_t pos = 0;
+      Cell* pCell = ClaimEnqueueCell(pos);
+      if (pCell == nullptr)
+      {
+        return false;
+      }
+      pCell->Value = std::move(value);
+      pCell->Sequence.store(pos + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Try to remove the oldest entry from the queue
+    //! @return true if a entry was dequeued, false if the queue was empty.
+    bool TryDequeue(T& rValue)
+    {
+      std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+      Cell* pCell = nullptr;
+      while (true)
+      {
+        pCell = &m_cells[pos & m_capacityMask];
+        const std::size_t sequence = pCell->Sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1u);
+        if (diff == 0)
+        {
+          if (m_dequeuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+          {
+            break;
+          }
+        }
+        else if (diff < 0)
+        {
+          return false;
+        }
+        else
+        {
+          pos = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+      }
+      rValue = std::move(pCell->Value);
+      // Ensure that any resources held by the moved from value are released now and not when the cell is reused
+      pCell->Value = T();
+      pCell->Sequence.store(pos + m_capacityMask + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Dequeue as many entries as possible into the supplied span
+    //! @return the number of entries written to the span.
+    std::size_t TryDequeue(Span<T> dstSpan)
+    {
+      std::size_t count = 0;
+      while (count < dstSpan.size() && TryDequeue(dstSpan[count]))
+      {
+        ++count;
+      }
+      return count;
+    }
+
+  private:
+    Cell* ClaimEnqueueCell(std::size_t& rPos) noexcept
+    {
+      std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+      while (true)
+      {
+        Cell* pCell = &m_cells[pos & m_capacityMask];
+        const std::size_t sequence = pCell->Sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0)
+        {
+          if (m_enqueuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+          {
+            rPos = pos;
+            return pCell;
+          }
+        }
+        else if (diff < 0)
+        {
+          // The queue is full
+          return nullptr;
+        }
+        else
+        {
+          pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_BOUNDEDSPSCQUEUE_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_BOUNDEDSPSCQUEUE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Fsl
+{
+  //! @brief A bounded lock free single producer single consumer queue.
+  //!        The producer and consumer each cache the other side's position so they only touch the shared cache line
+  //!        when the cached value says the queue is full or empty.
+  //! @warning Only one thread may enqueue and only one thread may dequeue at any given time.
+  template <typename T>
+  class BoundedSPSCQueue
+  {
+    static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+    static_assert(std::is_nothrow_move_assignable_v<T>, "T must be nothrow move assignable");
+
+    std::unique_ptr<T[]> m_entries;
+    std::size_t m_capacityMask;
+
+    // Consumer owned
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    std::size_t m_cachedTail{0};
+
+    // Producer owned
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_cachedHead{0};
+
+  public:
+    BoundedSPSCQueue(const BoundedSPSCQueue&) = delete;
+    BoundedSPSCQueue& operator=(const BoundedSPSCQueue&) = delete;
+
+    using value_type = T;
+
+    //! @brief Create the queue
+    //! @param capacity the max number of entries the queue can hold (must be a power of two).
+    explicit BoundedSPSCQueue(const uint32_t capacity)
+      : m_entries(std::make_unique<T[]>(capacity))
+      , m_capacityMask(static_cast<std::size_t>(capacity) - 1u)
+    {
+      if (capacity == 0u || (capacity & (capacity - 1u)) != 0u)
+      {
+        throw std::invalid_argument("capacity must be a power of two");
+      }
+    }
+
+    uint32_t Capacity() const noexcept
+    {
+      return static_cast<uint32_t>(m_capacityMask + 1u);
+    }
+
+    //! @brief Get the approximate number of entries in the queue.
+    //! @note  This is just a snapshot and it might be outdated before it is returned.
+    uint32_t ApproximateSize() const noexcept
+    {
+      const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+      const std::size_t head = m_head.load(std::memory_order_relaxed);
+      return tail > head ? static_cast<uint32_t>(tail - head) : 0u;
+    }
+
+    //! @brief Try to add a copy of the value to the queue (producer only)
+    //! @return true if the value was added, false if the queue was full.
+    bool TryEnqueue(const T& value)
+    {
+      const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+      if (!HasSpace(tail))
+      {
+        return false;
+      }
+      m_entries[tail & m_capacityMask] = value;
+      m_tail.store(tail + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Try to move the value into the queue (producer only)
+    //! @return true if the value was added, false if the queue was full (in which case value is left untouched).
+    bool TryEnqueue(T&& value)
+    {
+      const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+      if (!HasSpace(tail))
+      {
+        return false;
+      }
+      m_entries[tail & m_capacityMask] = std::move(value);
+      m_tail.store(tail + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Try to remove the oldest entry from the queue (consumer only)
+    //! @return true if a entry was dequeued, false if the queue was empty.
+    bool TryDequeue(T& rValue)
+    {
+      const std::size_t head = m_head.load(std::memory_order_relaxed);
+      if (head == m_cachedTail)
+      {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail)
+        {
+          return false;
+        }
+      }
+      T& rEntry = m_entries[head & m_capacityMask];
+      rValue = std::move(rEntry);
+      // Ensure that any resources held by the moved from value are released now and not when the entry is reused
+      rEntry = T();
+      m_head.store(head + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Dequeue as many entries as possible into the supplied span (consumer only)
+    //! @return the number of entries written to the span.
+    std::size_t TryDequeue(Span<T> dstSpan)
+    {
+      std::size_t count = 0;
+      while (count < dstSpan.size() && TryDequeue(dstSpan[count]))
+      {
+        ++count;
+      }
+      return count;
+    }
+
+  private:
+    bool HasSpace(const std::size_t tail) noexcept
+    {
+      if ((tail - m_cachedHead) > m_capacityMask)
+      {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        return (tail - m_cachedHead) <= m_capacityMask;
+      }
+      return true;
+    }
+  };
+}
+
+#endif
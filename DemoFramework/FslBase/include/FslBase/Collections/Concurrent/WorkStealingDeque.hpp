@@ -0,0 +1,165 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_WORKSTEALINGDEQUE_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_WORKSTEALINGDEQUE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Fsl
+{
+  //! @brief A bounded lock free work stealing deque (Chase-Lev).
+  //!        - The owning thread pushes and pops from the bottom (LIFO).
+  //!        - Any other thread can steal from the top (FIFO).
+  //! @note  Based on "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli 2013),
+  //!        but with a fixed capacity so we never need to reclaim a old buffer.
+  template <typename T>
+  class WorkStealingDeque
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    // Top and bottom are modified by different threads so keep them on separate cache lines
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+    alignas(64) std::unique_ptr<std::atomic<T>[]> m_entries;
+    int64_t m_capacity;
+    int64_t m_capacityMask;
+
+  public:
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    using value_type = T;
+
+    //! @brief Create the deque
+    //! @param capacity the max number of entries the deque can hold (must be a power of two).
+    explicit WorkStealingDeque(const uint32_t capacity)
+      : m_entries(std::make_unique<std::atomic<T>[]>(capacity))
+      , m_capacity(capacity)
+      , m_capacityMask(static_cast<int64_t>(capacity) - 1)
+    {
+      if (capacity == 0u || (capacity & (capacity - 1u)) != 0u)
+      {
+        throw std::invalid_argument("capacity must be a power of two");
+      }
+    }
+
+    uint32_t Capacity() const noexcept
+    {
+      return static_cast<uint32_t>(m_capacity);
+    }
+
+    //! @brief Get the approximate number of entries in the deque.
+    //! @note  This is just a snapshot and it might be outdated before it is returned.
+    uint32_t ApproximateSize() const noexcept
+    {
+      const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+      const int64_t top = m_top.load(std::memory_order_relaxed);
+      return bottom > top ? static_cast<uint32_t>(bottom - top) : 0u;
+    }
+
+    //! @brief Push a entry to the bottom of the deque.
+    //! @warning Can only be called by the owning thread.
+    //! @return true if the entry was added, false if the deque was full.
+    bool TryPush(const T value) noexcept
+    {
+      const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+      const int64_t top = m_top.load(std::memory_order_acquire);
+      if ((bottom - top) >= m_capacity)
+      {
+        return false;
+      }
+      m_entries[bottom & m_capacityMask].store(value, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      return true;
+    }
+
+    //! @brief Pop the most recently pushed entry from the bottom of the deque.
+    //! @warning Can only be called by the owning thread.
+    //! @return true if a entry was returned, false if the deque was empty (or the last entry was stolen)
+    bool TryPop(T& rValue) noexcept
+    {
+      const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+      m_bottom.store(bottom, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t top = m_top.load(std::memory_order_relaxed);
+
+      if (top > bottom)
+      {
+        // The deque was empty
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+      }
+
+      const T value = m_entries[bottom & m_capacityMask].load(std::memory_order_relaxed);
+      if (top == bottom)
+      {
+        // This was the last entry, so we need to race the stealers for it
+        const bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        if (!won)
+        {
+          return false;
+        }
+      }
+      rValue = value;
+      return true;
+    }
+
+    //! @brief Steal the oldest entry from the top of the deque.
+    //! @note  Can be called by any thread.
+    //! @return true if a entry was stolen, false if the deque was empty or we lost the race for the entry.
+    bool TrySteal(T& rValue) noexcept
+    {
+      int64_t top = m_top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+      if (top >= bottom)
+      {
+        return false;
+      }
+
+      const T value = m_entries[top & m_capacityMask].load(std::memory_order_relaxed);
+      if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+        return false;
+      }
+      rValue = value;
+      return true;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,432 @@
+#ifndef FSLBASE_COLLECTIONS_ORDERSTATISTICTREE_HPP
+#define FSLBASE_COLLECTIONS_ORDERSTATISTICTREE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A sorted multiset that supports O(log n) insert, erase, rank and 'n-th smallest element' queries.
+  //!        This makes it possible to maintain order statistics (median, quartiles, percentiles) of a sliding window without re-sorting it.
+  //! @note  Implemented as a treap where each node stores a value, the number of copies of that value and the total number of values in its
+  //!        sub tree. The nodes live in a vector and link to each other by index, erased nodes are recycled through a free list.
+  template <typename T>
+  class OrderStatisticTree
+  {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+
+  private:
+    static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    struct Node
+    {
+      T Value{};
+      uint32_t Priority{0};
+      //! The number of copies of Value
+      uint32_t Count{0};
+      //! The number of values in this sub tree (including the copies)
+      uint32_t Size{0};
+      uint32_t Left{InvalidIndex};
+      uint32_t Right{InvalidIndex};
+    };
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_freeNodes;
+    uint32_t m_root{InvalidIndex};
+    uint32_t m_randomState{0x9E3779B9u};
+
+  public:
+    OrderStatisticTree() = default;
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool empty() const noexcept
+    {
+      return m_root == InvalidIndex;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    size_type size() const noexcept
+    {
+      return SizeOf(m_root);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void clear() noexcept
+    {
+      m_nodes.clear();
+      m_freeNodes.clear();
+      m_root = InvalidIndex;
+    }
+
+    //! @brief Reserve room for the given number of unique values
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void reserve(const size_type capacity)
+    {
+      m_nodes.reserve(capacity);
+    }
+
+    //! @brief Insert a value, duplicates are allowed
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void insert(const T& value)
+    {
+      if (size() >= std::numeric_limits<uint32_t>::max())
+      {
+        throw std::length_error("OrderStatisticTree is full");
+      }
+
+      // If the value is already present we just increase its count (and the size of all the sub trees on the path to it)
+      if (Contains(value))
+      {
+        uint32_t nodeIndex = m_root;
+        while (true)
+        {
+          Node& rNode = m_nodes[nodeIndex];
+          ++rNode.Size;
+          if (value < rNode.Value)
+          {
+            nodeIndex = rNode.Left;
+          }
+          else if (rNode.Value < value)
+          {
+            nodeIndex = rNode.Right;
+          }
+          else
+          {
+            ++rNode.Count;
+            return;
+          }
+        }
+      }
+
+      const uint32_t newIndex = AllocateNode(value);
+      uint32_t left = InvalidIndex;
+      uint32_t right = InvalidIndex;
+      Split(m_root, value, left, right);
+      m_root = Merge(Merge(left, newIndex), right);
+    }
+
+    //! @brief Erase one copy of the value.
+    //! @return true if the value was found and erased
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool erase(const T& value)
+    {
+      if (!Contains(value))
+      {
+        return false;
+      }
+
+      uint32_t* pLink = &m_root;
+      while (true)
+      {
+        Node& rNode = m_nodes[*pLink];
+        --rNode.Size;
+        if (value < rNode.Value)
+        {
+          pLink = &rNode.Left;
+        }
+        else if (rNode.Value < value)
+        {
+          pLink = &rNode.Right;
+        }
+        else
+        {
+          --rNode.Count;
+          if (rNode.Count == 0u)
+          {
+            // Replace the node with the merge of its children
+            const uint32_t nodeIndex = *pLink;
+            *pLink = Merge(rNode.Left, rNode.Right);
+            FreeNode(nodeIndex);
+          }
+          return true;
+        }
+      }
+    }
+
+    //! @brief Get the n'th smallest value (zero based)
+    const_reference operator[](const size_type index) const
+    {
+      assert(index < size());
+      size_type remaining = index;
+      uint32_t nodeIndex = m_root;
+      while (true)
+      {
+        assert(nodeIndex != InvalidIndex);
+        const Node& node = m_nodes[nodeIndex];
+        const size_type leftSize = SizeOf(node.Left);
+        if (remaining < leftSize)
+        {
+          nodeIndex = node.Left;
+        }
+        else if (remaining < (leftSize + node.Count))
+        {
+          return node.Value;
+        }
+        else
+        {
+          remaining -= leftSize + node.Count;
+          nodeIndex = node.Right;
+        }
+      }
+    }
+
+    //! @brief Get the n'th smallest value (zero based)
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    const_reference at(const size_type index) const
+    {
+      if (index >= size())
+      {
+        throw std::out_of_range("index out of range");
+      }
+      return (*this)[index];
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    const_reference front() const
+    {
+      assert(!empty());
+      uint32_t nodeIndex = m_root;
+      while (m_nodes[nodeIndex].Left != InvalidIndex)
+      {
+        nodeIndex = m_nodes[nodeIndex].Left;
+      }
+      return m_nodes[nodeIndex].Value;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    const_reference back() const
+    {
+      assert(!empty());
+      uint32_t nodeIndex = m_root;
+      while (m_nodes[nodeIndex].Right != InvalidIndex)
+      {
+        nodeIndex = m_nodes[nodeIndex].Right;
+      }
+      return m_nodes[nodeIndex].Value;
+    }
+
+    //! @brief Get the number of values that are less than the given key (the index of the first value >= key).
+    //! @note  The key can be of any type that can be compared to T (for example a double limit for a integer tree).
+    template <typename TKey>
+    size_type lower_bound_index(const TKey& key) const    // NOLINT(readability-identifier-naming)
+    {
+      size_type result = 0;
+      uint32_t nodeIndex = m_root;
+      while (nodeIndex != InvalidIndex)
+      {
+        const Node& node = m_nodes[nodeIndex];
+        if (node.Value < key)
+        {
+          result += SizeOf(node.Left) + node.Count;
+          nodeIndex = node.Right;
+        }
+        else
+        {
+          nodeIndex = node.Left;
+        }
+      }
+      return result;
+    }
+
+    //! @brief Get the number of values that are less than or equal to the given key (the index of the first value > key).
+    template <typename TKey>
+    size_type upper_bound_index(const TKey& key) const    // NOLINT(readability-identifier-naming)
+    {
+      size_type result = 0;
+      uint32_t nodeIndex = m_root;
+      while (nodeIndex != InvalidIndex)
+      {
+        const Node& node = m_nodes[nodeIndex];
+        if (key < node.Value)
+        {
+          nodeIndex = node.Left;
+        }
+        else
+        {
+          result += SizeOf(node.Left) + node.Count;
+          nodeIndex = node.Right;
+        }
+      }
+      return result;
+    }
+
+    //! @brief Call fnVisit(value) for every value in sorted order (low to high)
+    template <typename TFunc>
+    void for_each(TFunc fnVisit) const    // NOLINT(readability-identifier-naming)
+    {
+      // Iterative in-order traversal so deep trees can't overflow the stack
+      std::vector<uint32_t> stack;
+      uint32_t nodeIndex = m_root;
+      while (nodeIndex != InvalidIndex || !stack.empty())
+      {
+        while (nodeIndex != InvalidIndex)
+        {
+          stack.push_back(nodeIndex);
+          nodeIndex = m_nodes[nodeIndex].Left;
+        }
+        nodeIndex = stack.back();
+        stack.pop_back();
+        const Node& node = m_nodes[nodeIndex];
+        for (uint32_t i = 0; i < node.Count; ++i)
+        {
+          fnVisit(node.Value);
+        }
+        nodeIndex = node.Right;
+      }
+    }
+
+  private:
+    bool Contains(const T& value) const
+    {
+      uint32_t nodeIndex = m_root;
+      while (nodeIndex != InvalidIndex)
+      {
+        const Node& node = m_nodes[nodeIndex];
+        if (value < node.Value)
+        {
+          nodeIndex = node.Left;
+        }
+        else if (node.Value < value)
+        {
+          nodeIndex = node.Right;
+        }
+        else
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    size_type SizeOf(const uint32_t nodeIndex) const noexcept
+    {
+      return nodeIndex != InvalidIndex ? m_nodes[nodeIndex].Size : 0u;
+    }
+
+    void UpdateSize(const uint32_t nodeIndex) noexcept
+    {
+      Node& rNode = m_nodes[nodeIndex];
+      rNode.Size = static_cast<uint32_t>(SizeOf(rNode.Left) + SizeOf(rNode.Right) + rNode.Count);
+    }
+
+    uint32_t NextPriority() noexcept
+    {
+      // xorshift32
+      uint32_t x = m_randomState;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      m_randomState = x;
+      return x;
+    }
+
+    uint32_t AllocateNode(const T& value)
+    {
+      Node node;
+      node.Value = value;
+      node.Priority = NextPriority();
+      node.Count = 1;
+      node.Size = 1;
+      if (!m_freeNodes.empty())
+      {
+        const uint32_t nodeIndex = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[nodeIndex] = node;
+        return nodeIndex;
+      }
+      m_nodes.push_back(node);
+      return static_cast<uint32_t>(m_nodes.size() - 1u);
+    }
+
+    void FreeNode(const uint32_t nodeIndex)
+    {
+      m_freeNodes.push_back(nodeIndex);
+    }
+
+    //! @brief Split the tree into values less than value (rLeft) and values greater or equal to value (rRight)
+    void Split(const uint32_t nodeIndex, const T& value, uint32_t& rLeft, uint32_t& rRight)
+    {
+      if (nodeIndex == InvalidIndex)
+      {
+        rLeft = InvalidIndex;
+        rRight = InvalidIndex;
+        return;
+      }
+      Node& rNode = m_nodes[nodeIndex];
+      if (rNode.Value < value)
+      {
+        Split(rNode.Right, value, rNode.Right, rRight);
+        rLeft = nodeIndex;
+      }
+      else
+      {
+        Split(rNode.Left, value, rLeft, rNode.Left);
+        rRight = nodeIndex;
+      }
+      UpdateSize(nodeIndex);
+    }
+
+    //! @brief Merge two trees where all values in the left tree are less than the values in the right tree
+    uint32_t Merge(const uint32_t left, const uint32_t right)
+    {
+      if (left == InvalidIndex)
+      {
+        return right;
+      }
+      if (right == InvalidIndex)
+      {
+        return left;
+      }
+      if (m_nodes[left].Priority > m_nodes[right].Priority)
+      {
+        const uint32_t merged = Merge(m_nodes[left].Right, right);
+        m_nodes[left].Right = merged;
+        UpdateSize(left);
+        return left;
+      }
+      const uint32_t merged = Merge(left, m_nodes[right].Left);
+      m_nodes[right].Left = merged;
+      UpdateSize(right);
+      return right;
+    }
+  };
+}
+
+#endif
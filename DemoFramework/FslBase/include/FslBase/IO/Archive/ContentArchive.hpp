@@ -0,0 +1,128 @@
+#ifndef FSLBASE_IO_ARCHIVE_CONTENTARCHIVE_HPP
+#define FSLBASE_IO_ARCHIVE_CONTENTARCHIVE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Archive/ContentArchiveEntry.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <optional>
+#include <vector>
+
+namespace Fsl::IO
+{
+  //! @brief Read access to a packed content archive (see ContentArchiveWriter).
+  //!        The archive is memory mapped once and all lookups are done directly on the mapped index,
+  //!        uncompressed entries can be accessed without copying them.
+  //! @note  All methods are const and can be used from multiple threads at the same time.
+  class ContentArchive
+  {
+    MemoryMappedFile m_file;
+    uint32_t m_entryCount{0};
+    uint64_t m_stringTableOffset{0};
+    uint64_t m_stringTableSize{0};
+
+  public:
+    //! The file extension used for content archives
+    static constexpr const char* const FileExtension = ".fslpak";
+
+    ContentArchive(const ContentArchive&) = delete;
+    ContentArchive& operator=(const ContentArchive&) = delete;
+
+    ContentArchive(ContentArchive&& other) noexcept;
+    ContentArchive& operator=(ContentArchive&& other) noexcept;
+
+    ContentArchive() noexcept;
+
+    //! @brief Open the archive
+    //! @throws IOException if the file isn't found or something goes wrong reading it.
+    //! @throws FormatException if the file is not a valid archive.
+    explicit ContentArchive(const Path& path);
+
+    //! @brief Use the content as a archive
+    //! @throws FormatException if the content is not a valid archive.
+    explicit ContentArchive(MemoryMappedFile file);
+
+    ~ContentArchive();
+
+    bool IsValid() const noexcept
+    {
+      return !m_file.empty();
+    }
+
+    uint32_t GetEntryCount() const noexcept
+    {
+      return m_entryCount;
+    }
+
+    //! @brief Get the name of the entry at the given index (the index is sorted by hash, not by name)
+    StringViewLite GetEntryName(const uint32_t index) const;
+
+    //! @brief Get the entry at the given index (the index is sorted by hash, not by name)
+    ContentArchiveEntry GetEntry(const uint32_t index) const;
+
+    //! @brief Lookup the entry stored under the relative path
+    std::optional<ContentArchiveEntry> TryFind(const Path& relativePath) const noexcept;
+
+    bool Contains(const Path& relativePath) const noexcept
+    {
+      return TryFind(relativePath).has_value();
+    }
+
+    //! @brief Get the stored (possibly compressed) bytes of the entry, this is a view directly into the archive.
+    ReadOnlySpan<uint8_t> GetStoredContent(const ContentArchiveEntry& entry) const;
+
+    //! @brief Read the content of the entry, decompressing it if necessary.
+    //! @throws FormatException if the entry can not be decompressed.
+    void ReadAllBytes(std::vector<uint8_t>& rContent, const ContentArchiveEntry& entry) const;
+
+    //! @brief Read the content of the entry, decompressing it if necessary.
+    //! @throws FormatException if the entry can not be decompressed.
+    std::vector<uint8_t> ReadAllBytes(const ContentArchiveEntry& entry) const;
+
+    //! @brief Get the content of the entry.
+    //!        Uncompressed entries are a view of the archive mapping, compressed entries are decompressed into the returned object.
+    //! @throws FormatException if the entry can not be decompressed.
+    MemoryMappedFile MapAllBytes(const ContentArchiveEntry& entry) const;
+
+  private:
+    void ParseHeader();
+    ReadOnlySpan<uint8_t> GetIndexEntry(const uint32_t index) const;
+    //! @brief Get the index entry without range checking, index must be < m_entryCount.
+    ReadOnlySpan<uint8_t> UncheckedGetIndexEntry(const uint32_t index) const noexcept;
+    StringViewLite GetEntryName(const ReadOnlySpan<uint8_t> indexEntry) const noexcept;
+  };
+}
+
+#endif
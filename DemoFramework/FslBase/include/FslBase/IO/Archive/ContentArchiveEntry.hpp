@@ -0,0 +1,72 @@
+#ifndef FSLBASE_IO_ARCHIVE_CONTENTARCHIVEENTRY_HPP
+#define FSLBASE_IO_ARCHIVE_CONTENTARCHIVEENTRY_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Archive/ContentArchiveCompression.hpp>
+
+namespace Fsl::IO
+{
+  struct ContentArchiveEntry
+  {
+    //! The offset of the stored data from the start of the archive
+    uint64_t Offset{0};
+    //! The number of bytes stored in the archive
+    uint64_t StoredSize{0};
+    //! The size of the content once its decompressed
+    uint64_t Size{0};
+    ContentArchiveCompression Compression{ContentArchiveCompression::None};
+
+    constexpr ContentArchiveEntry() noexcept = default;
+
+    constexpr ContentArchiveEntry(const uint64_t offset, const uint64_t storedSize, const uint64_t size,
+                                  const ContentArchiveCompression compression) noexcept
+      : Offset(offset)
+      , StoredSize(storedSize)
+      , Size(size)
+      , Compression(compression)
+    {
+    }
+
+    constexpr bool operator==(const ContentArchiveEntry& rhs) const noexcept
+    {
+      return Offset == rhs.Offset && StoredSize == rhs.StoredSize && Size == rhs.Size && Compression == rhs.Compression;
+    }
+
+    constexpr bool operator!=(const ContentArchiveEntry& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
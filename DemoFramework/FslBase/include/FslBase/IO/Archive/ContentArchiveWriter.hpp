@@ -0,0 +1,89 @@
+#ifndef FSLBASE_IO_ARCHIVE_CONTENTARCHIVEWRITER_HPP
+#define FSLBASE_IO_ARCHIVE_CONTENTARCHIVEWRITER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Archive/ContentArchiveCompression.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <string>
+#include <vector>
+
+namespace Fsl::IO
+{
+  //! @brief Build a packed content archive that can be read with ContentArchive.
+  class ContentArchiveWriter
+  {
+    struct Record
+    {
+      std::string Name;
+      std::vector<uint8_t> StoredContent;
+      uint64_t Size{0};
+      ContentArchiveCompression Compression{ContentArchiveCompression::None};
+    };
+
+    uint32_t m_alignment;
+    std::vector<Record> m_records;
+
+  public:
+    //! The default alignment of each entry in the archive (large enough for any SIMD load)
+    static constexpr uint32_t DefaultAlignment = 64;
+
+    //! @param alignment the alignment of each entry, must be a power of two.
+    explicit ContentArchiveWriter(const uint32_t alignment = DefaultAlignment);
+
+    uint32_t GetAlignment() const noexcept
+    {
+      return m_alignment;
+    }
+
+    std::size_t GetEntryCount() const noexcept
+    {
+      return m_records.size();
+    }
+
+    //! @brief Add a entry to the archive.
+    //! @param relativePath the path the entry can be found under (it can not be rooted or contain "..")
+    //! @param compression the desired compression, if the compressed entry would be larger it is stored uncompressed instead.
+    //! @throws std::invalid_argument if the path is invalid or already added.
+    void Add(const Path& relativePath, const ReadOnlySpan<uint8_t> content,
+             const ContentArchiveCompression compression = ContentArchiveCompression::None);
+
+    //! @brief Build the archive in memory
+    std::vector<uint8_t> ToBytes() const;
+
+    //! @brief Write the archive to the given file (any existing file is overwritten)
+    void Write(const Path& dstPath) const;
+  };
+}
+
+#endif
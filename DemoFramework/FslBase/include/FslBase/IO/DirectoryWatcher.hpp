@@ -0,0 +1,89 @@
+#ifndef FSLBASE_IO_DIRECTORYWATCHER_HPP
+#define FSLBASE_IO_DIRECTORYWATCHER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/DirectoryWatcherBackend.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/IO/PathWatcher.hpp>
+#include <FslBase/IO/SearchOptions.hpp>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace Fsl::IO
+{
+  class PlatformDirectoryMonitorToken;
+
+  //! @brief Watch a directory tree for changes.
+  //!        Uses the platform change notifications where available and falls back to polling the files with a PathWatcher.
+  //! @note Experimental class, might change.
+  class DirectoryWatcher
+  {
+    Path m_fullPath;
+    std::shared_ptr<PlatformDirectoryMonitorToken> m_platformToken;
+    PathWatcher m_pathWatcher;
+
+  public:
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    //! @brief Start watching the directory
+    //! @param preferredBackend the backend to use if supported (Platform falls back to Polling if unsupported on this platform).
+    //! @throws std::invalid_argument if the path isn't absolute.
+    //! @throws DirectoryNotFoundException if the directory doesn't exist.
+    explicit DirectoryWatcher(const IO::Path& fullPath, const SearchOptions searchOptions = SearchOptions::AllDirectories,
+                              const DirectoryWatcherBackend preferredBackend = DirectoryWatcherBackend::Platform);
+    ~DirectoryWatcher();
+
+    const IO::Path& GetPath() const noexcept
+    {
+      return m_fullPath;
+    }
+
+    //! @brief Get the backend that is actually in use
+    DirectoryWatcherBackend GetBackend() const noexcept
+    {
+      return m_platformToken ? DirectoryWatcherBackend::Platform : DirectoryWatcherBackend::Polling;
+    }
+
+    //! @brief Check for changes
+    //! @param rChangedPaths the full path of every changed file or directory is added here.
+    //! @param maxWait the max time to wait for a change to occur.
+    //!                Only the Platform backend waits, the Polling backend checks once and returns immediately
+    //!                so the caller is in control of the poll interval.
+    //! @return true if something was changed.
+    //! @note The Polling backend only monitors the files that existed when the watcher was created.
+    bool TryGetChanges(std::vector<IO::Path>& rChangedPaths, const std::chrono::milliseconds maxWait = std::chrono::milliseconds(0));
+  };
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef FSLBASE_IO_MEMORYMAPPEDFILE_HPP
+#define FSLBASE_IO_MEMORYMAPPEDFILE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <memory>
+#include <vector>
+
+namespace Fsl::IO
+{
+  class PlatformFileMappingToken;
+
+  //! @brief A read only view of the entire content of a file.
+  //!        The file is memory mapped when the platform supports it, if not the content is read into memory instead.
+  //! @note  The content stays valid until this object is destroyed or reset.
+  class MemoryMappedFile
+  {
+    std::shared_ptr<PlatformFileMappingToken> m_token;
+    std::vector<uint8_t> m_fallbackContent;
+    ReadOnlySpan<uint8_t> m_content;
+
+  public:
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+    MemoryMappedFile() noexcept;
+
+    //! @brief Map the file
+    //! @throws IOException if the file isn't found or something goes wrong reading it.
+    explicit MemoryMappedFile(const Path& path);
+
+    //! @brief Take ownership of content that already lives in memory (for example decompressed content)
+    explicit MemoryMappedFile(std::vector<uint8_t>&& content) noexcept;
+
+    ~MemoryMappedFile();
+
+    //! @brief Check if the content is memory mapped (false if the content was read into memory or if this is empty).
+    bool IsMemoryMapped() const noexcept
+    {
+      return m_token != nullptr;
+    }
+
+    ReadOnlySpan<uint8_t> AsReadOnlySpan() const noexcept
+    {
+      return m_content;
+    }
+
+    const uint8_t* data() const noexcept
+    {
+      return m_content.data();
+    }
+
+    std::size_t size() const noexcept
+    {
+      return m_content.size();
+    }
+
+    bool empty() const noexcept
+    {
+      return m_content.empty();
+    }
+
+    //! @brief Create a view of a part of the content.
+    //!        A mapped file shares the mapping with the returned view, content that was read into memory is copied.
+    //! @throws std::invalid_argument if the range is outside the content.
+    MemoryMappedFile Slice(const std::size_t offset, const std::size_t length) const;
+
+    //! @brief Release the content
+    void Reset() noexcept;
+
+  private:
+    MemoryMappedFile(std::shared_ptr<PlatformFileMappingToken> token, const ReadOnlySpan<uint8_t> content) noexcept;
+  };
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include <FslBase/IO/Path.hpp>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace Fsl::IO
 {
@@ -66,6 +67,11 @@ namespace Fsl::IO
     //! @brief Perform a check
     //! @return true if something was changed.
     bool Check();
+
+    //! @brief Perform a check of all watched paths
+    //! @param rChangedPaths the full path of every changed path is added here.
+    //! @return true if something was changed.
+    bool Check(std::vector<IO::Path>& rChangedPaths);
   };
 }
 
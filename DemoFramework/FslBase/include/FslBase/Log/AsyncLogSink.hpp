@@ -0,0 +1,68 @@
+#ifndef FSLBASE_LOG_ASYNCLOGSINK_HPP
+#define FSLBASE_LOG_ASYNCLOGSINK_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/AsyncLogSinkConfig.hpp>
+#include <FslBase/Log/AsyncLogSinkStats.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  class AsyncLogSinkImpl;
+
+  //! @brief While alive all FSLLOG3 output is handed off to a background thread which writes it in batches to stdout or a file.
+  //!        Each logging thread formats into its own lock free buffer, so logging no longer blocks on console or file I/O.
+  //! @note  Only one AsyncLogSink can be active at a time. Destroying it writes all pending messages and restores synchronous logging.
+  //! @note  Messages that are buffered when the process crashes are lost, so call Flush (or Logger::Flush) at critical points.
+  class AsyncLogSink
+  {
+    std::unique_ptr<AsyncLogSinkImpl> m_impl;
+
+  public:
+    AsyncLogSink(const AsyncLogSink&) = delete;
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    //! @brief Start the background writer and install the sink
+    //! @throws UsageErrorException if another AsyncLogSink is active
+    //! @throws std::invalid_argument if the config is invalid
+    //! @throws IOException if the log file could not be created
+    explicit AsyncLogSink(const AsyncLogSinkConfig& config = {});
+    ~AsyncLogSink() noexcept;
+
+    //! @brief Block until every message logged before this call has been written and the output has been flushed
+    void Flush();
+
+    AsyncLogSinkStats GetStats() const;
+  };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef FSLBASE_LOG_ASYNCLOGSINKCONFIG_HPP
+#define FSLBASE_LOG_ASYNCLOGSINKCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <chrono>
+#include <utility>
+
+namespace Fsl
+{
+  struct AsyncLogSinkConfig
+  {
+    //! The file to write the log to, if empty the log is written to stdout
+    IO::Path LogFile;
+    //! The size of the buffer each logging thread formats into (must be a power of two and at least 1024 bytes).
+    //! If the buffer is full when a message is logged the message is dropped and counted.
+    //! Messages that are larger than the buffer are written synchronously instead.
+    uint32_t ThreadBufferCapacity{64 * 1024};
+    //! The max time before buffered messages are written
+    std::chrono::milliseconds FlushInterval{50};
+
+    AsyncLogSinkConfig() = default;
+
+    explicit AsyncLogSinkConfig(IO::Path logFile)
+      : LogFile(std::move(logFile))
+    {
+    }
+  };
+}
+
+#endif
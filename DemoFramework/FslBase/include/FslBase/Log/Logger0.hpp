@@ -79,6 +79,9 @@ namespace Fsl
 
     //! WARNING: It is not a good idea to utilize this code before 'main' has been hit (so don't use it from static object constructors)
     extern void WriteLine(const LogLocation& location, const LogType logType, const char* const psz) noexcept;
+
+    //! @brief Block until all log messages written so far have reached the output (only relevant when a AsyncLogSink is active).
+    extern void Flush() noexcept;
   }
 }
 
@@ -0,0 +1,134 @@
+#ifndef FSLBASE_MATH_FRUSTUMCULLUTIL_HPP
+#define FSLBASE_MATH_FRUSTUMCULLUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <cstddef>
+
+//! Batch frustum culling of bounding volumes stored as structure of arrays.
+//! The visibility of each entry is identical to calling BoundingFrustum::Intersects for it, but four entries are tested per plane at a
+//! time using SIMD instructions when available.
+//!
+//! The result is written as a bit mask, entry i is visible if bit (i % 32) of word (i / 32) is set.
+//!
+//! Plane coherency: the optional plane cache stores one byte per group of four entries (GroupSize) which remembers the plane that culled
+//! the group during the last call. That plane is tested first on the next call which for slow moving cameras usually rejects the group
+//! after a single plane test. The cache content never changes the result, so it can be reset or reused freely as long as it has the
+//! expected size. A new cache should be filled with InvalidPlaneIndex.
+namespace Fsl::FrustumCullUtil
+{
+  //! The number of entries that share a plane cache entry.
+  constexpr std::size_t GroupSize = 4;
+
+  //! Marks a plane cache entry that does not reference a plane.
+  constexpr uint8_t InvalidPlaneIndex = 0xFF;
+
+  //! Axis aligned bounding boxes stored as structure of arrays, all spans must have the same size.
+  struct BoundingBoxSpans
+  {
+    ReadOnlySpan<float> MinX;
+    ReadOnlySpan<float> MinY;
+    ReadOnlySpan<float> MinZ;
+    ReadOnlySpan<float> MaxX;
+    ReadOnlySpan<float> MaxY;
+    ReadOnlySpan<float> MaxZ;
+
+    constexpr std::size_t size() const noexcept
+    {
+      return MinX.size();
+    }
+  };
+
+  //! Bounding spheres stored as structure of arrays, all spans must have the same size.
+  struct BoundingSphereSpans
+  {
+    ReadOnlySpan<float> CenterX;
+    ReadOnlySpan<float> CenterY;
+    ReadOnlySpan<float> CenterZ;
+    ReadOnlySpan<float> Radius;
+
+    constexpr std::size_t size() const noexcept
+    {
+      return CenterX.size();
+    }
+  };
+
+  //! @brief The number of uint32_t words needed to store the visibility mask of 'count' entries.
+  constexpr std::size_t CalcMaskWordCount(const std::size_t count) noexcept
+  {
+    return (count + 31u) / 32u;
+  }
+
+  //! @brief The number of plane cache entries needed for 'count' entries.
+  constexpr std::size_t CalcPlaneCacheSize(const std::size_t count) noexcept
+  {
+    return (count + (GroupSize - 1u)) / GroupSize;
+  }
+
+  //! @brief Check if the given entry is marked as visible in the mask.
+  constexpr bool IsVisible(const ReadOnlySpan<uint32_t> visibleMask, const std::size_t index)
+  {
+    return (visibleMask[index / 32u] & (1u << (index % 32u))) != 0u;
+  }
+
+  //! @brief Test the boxes against the frustum.
+  //! @param dstVisibleMask receives the visibility mask, it must contain at least CalcMaskWordCount(boxes.size()) words.
+  //! @return the number of visible boxes.
+  //! @throws std::invalid_argument if the box spans are of different sizes or dstVisibleMask is too small.
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingBoxSpans& boxes, Span<uint32_t> dstVisibleMask);
+
+  //! @brief Test the boxes against the frustum using and updating the plane cache.
+  //! @param planeCache the plane cache, it must contain exactly CalcPlaneCacheSize(boxes.size()) entries.
+  //! @param dstVisibleMask receives the visibility mask, it must contain at least CalcMaskWordCount(boxes.size()) words.
+  //! @return the number of visible boxes.
+  //! @throws std::invalid_argument if the box spans are of different sizes, or one of the other spans has an invalid size.
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingBoxSpans& boxes, Span<uint8_t> planeCache, Span<uint32_t> dstVisibleMask);
+
+  //! @brief Test the spheres against the frustum.
+  //! @param dstVisibleMask receives the visibility mask, it must contain at least CalcMaskWordCount(spheres.size()) words.
+  //! @return the number of visible spheres.
+  //! @throws std::invalid_argument if the sphere spans are of different sizes or dstVisibleMask is too small.
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingSphereSpans& spheres, Span<uint32_t> dstVisibleMask);
+
+  //! @brief Test the spheres against the frustum using and updating the plane cache.
+  //! @param planeCache the plane cache, it must contain exactly CalcPlaneCacheSize(spheres.size()) entries.
+  //! @param dstVisibleMask receives the visibility mask, it must contain at least CalcMaskWordCount(spheres.size()) words.
+  //! @return the number of visible spheres.
+  //! @throws std::invalid_argument if the sphere spans are of different sizes, or one of the other spans has an invalid size.
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingSphereSpans& spheres, Span<uint8_t> planeCache,
+                   Span<uint32_t> dstVisibleMask);
+}
+
+#endif
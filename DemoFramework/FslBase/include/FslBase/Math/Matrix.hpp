@@ -31,6 +31,7 @@ SOFTWARE.
 #include <FslBase/Math/MatrixFields.hpp>
 #include <FslBase/Math/Vector3.hpp>
 #include <cstddef>
+#include <type_traits>
 // #include <FslBase/OptimizationFlag.hpp>
 
 namespace Fsl
@@ -739,6 +740,12 @@ namespace Fsl
     //! @brief Multiplies a matrix by another matrix.
     static constexpr Matrix Multiply(const Matrix& matrix1, const Matrix& matrix2)
     {
+      if (!std::is_constant_evaluated())
+      {
+        Matrix result;
+        Multiply(matrix1, matrix2, result);
+        return result;
+      }
       using namespace MatrixFields;
       return {(((matrix1.m[_M11] * matrix2.m[_M11]) + (matrix1.m[_M12] * matrix2.m[_M21])) + (matrix1.m[_M13] * matrix2.m[_M31])) +
                 (matrix1.m[_M14] * matrix2.m[_M41]),
@@ -781,62 +788,8 @@ namespace Fsl
     }
 
     //! @brief Multiplies a matrix by another matrix.
-    static void Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& rResult)
-    {
-      using namespace MatrixFields;
-      const float* pMatrix1 = matrix1.m;
-      const float* pMatrix2 = matrix2.m;
-
-      const float m11 = (((pMatrix1[_M11] * pMatrix2[_M11]) + (pMatrix1[_M12] * pMatrix2[_M21])) + (pMatrix1[_M13] * pMatrix2[_M31])) +
-                        (pMatrix1[_M14] * pMatrix2[_M41]);
-      const float m12 = (((pMatrix1[_M11] * pMatrix2[_M12]) + (pMatrix1[_M12] * pMatrix2[_M22])) + (pMatrix1[_M13] * pMatrix2[_M32])) +
-                        (pMatrix1[_M14] * pMatrix2[_M42]);
-      const float m13 = (((pMatrix1[_M11] * pMatrix2[_M13]) + (pMatrix1[_M12] * pMatrix2[_M23])) + (pMatrix1[_M13] * pMatrix2[_M33])) +
-                        (pMatrix1[_M14] * pMatrix2[_M43]);
-      const float m14 = (((pMatrix1[_M11] * pMatrix2[_M14]) + (pMatrix1[_M12] * pMatrix2[_M24])) + (pMatrix1[_M13] * pMatrix2[_M34])) +
-                        (pMatrix1[_M14] * pMatrix2[_M44]);
-      const float m21 = (((pMatrix1[_M21] * pMatrix2[_M11]) + (pMatrix1[_M22] * pMatrix2[_M21])) + (pMatrix1[_M23] * pMatrix2[_M31])) +
-                        (pMatrix1[_M24] * pMatrix2[_M41]);
-      const float m22 = (((pMatrix1[_M21] * pMatrix2[_M12]) + (pMatrix1[_M22] * pMatrix2[_M22])) + (pMatrix1[_M23] * pMatrix2[_M32])) +
-                        (pMatrix1[_M24] * pMatrix2[_M42]);
-      const float m23 = (((pMatrix1[_M21] * pMatrix2[_M13]) + (pMatrix1[_M22] * pMatrix2[_M23])) + (pMatrix1[_M23] * pMatrix2[_M33])) +
-                        (pMatrix1[_M24] * pMatrix2[_M43]);
-      const float m24 = (((pMatrix1[_M21] * pMatrix2[_M14]) + (pMatrix1[_M22] * pMatrix2[_M24])) + (pMatrix1[_M23] * pMatrix2[_M34])) +
-                        (pMatrix1[_M24] * pMatrix2[_M44]);
-      const float m31 = (((pMatrix1[_M31] * pMatrix2[_M11]) + (pMatrix1[_M32] * pMatrix2[_M21])) + (pMatrix1[_M33] * pMatrix2[_M31])) +
-                        (pMatrix1[_M34] * pMatrix2[_M41]);
-      const float m32 = (((pMatrix1[_M31] * pMatrix2[_M12]) + (pMatrix1[_M32] * pMatrix2[_M22])) + (pMatrix1[_M33] * pMatrix2[_M32])) +
-                        (pMatrix1[_M34] * pMatrix2[_M42]);
-      const float m33 = (((pMatrix1[_M31] * pMatrix2[_M13]) + (pMatrix1[_M32] * pMatrix2[_M23])) + (pMatrix1[_M33] * pMatrix2[_M33])) +
-                        (pMatrix1[_M34] * pMatrix2[_M43]);
-      const float m34 = (((pMatrix1[_M31] * pMatrix2[_M14]) + (pMatrix1[_M32] * pMatrix2[_M24])) + (pMatrix1[_M33] * pMatrix2[_M34])) +
-                        (pMatrix1[_M34] * pMatrix2[_M44]);
-      const float m41 = (((pMatrix1[_M41] * pMatrix2[_M11]) + (pMatrix1[_M42] * pMatrix2[_M21])) + (pMatrix1[_M43] * pMatrix2[_M31])) +
-                        (pMatrix1[_M44] * pMatrix2[_M41]);
-      const float m42 = (((pMatrix1[_M41] * pMatrix2[_M12]) + (pMatrix1[_M42] * pMatrix2[_M22])) + (pMatrix1[_M43] * pMatrix2[_M32])) +
-                        (pMatrix1[_M44] * pMatrix2[_M42]);
-      const float m43 = (((pMatrix1[_M41] * pMatrix2[_M13]) + (pMatrix1[_M42] * pMatrix2[_M23])) + (pMatrix1[_M43] * pMatrix2[_M33])) +
-                        (pMatrix1[_M44] * pMatrix2[_M43]);
-      const float m44 = (((pMatrix1[_M41] * pMatrix2[_M14]) + (pMatrix1[_M42] * pMatrix2[_M24])) + (pMatrix1[_M43] * pMatrix2[_M34])) +
-                        (pMatrix1[_M44] * pMatrix2[_M44]);
-
-      rResult.m[_M11] = m11;
-      rResult.m[_M12] = m12;
-      rResult.m[_M13] = m13;
-      rResult.m[_M14] = m14;
-      rResult.m[_M21] = m21;
-      rResult.m[_M22] = m22;
-      rResult.m[_M23] = m23;
-      rResult.m[_M24] = m24;
-      rResult.m[_M31] = m31;
-      rResult.m[_M32] = m32;
-      rResult.m[_M33] = m33;
-      rResult.m[_M34] = m34;
-      rResult.m[_M41] = m41;
-      rResult.m[_M42] = m42;
-      rResult.m[_M43] = m43;
-      rResult.m[_M44] = m44;
-    }
+    //! @note  Uses SIMD instructions when available.
+    static void Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& rResult);
 
     //! @brief Multiplies a matrix by a scalar.
     static constexpr Matrix Multiply(const Matrix& matrix1, const float factor)
@@ -943,6 +896,12 @@ namespace Fsl
 
     constexpr Matrix& operator*=(const Matrix& rhs)
     {
+      if (!std::is_constant_evaluated())
+      {
+        const Matrix& lhs = *this;
+        Multiply(lhs, rhs, *this);
+        return *this;
+      }
       using namespace MatrixFields;
       const float* pRhs = rhs.DirectAccess();
 
@@ -1019,6 +978,12 @@ namespace Fsl
   //! @brief Matrix multiply
   constexpr inline Matrix operator*(const Matrix& lhs, const Matrix& rhs)
   {
+    if (!std::is_constant_evaluated())
+    {
+      Matrix result;
+      Matrix::Multiply(lhs, rhs, result);
+      return result;
+    }
     using namespace MatrixFields;
 
     const float* pLhs = lhs.DirectAccess();
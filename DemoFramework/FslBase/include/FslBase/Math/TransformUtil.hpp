@@ -0,0 +1,63 @@
+#ifndef FSLBASE_MATH_TRANSFORMUTIL_HPP
+#define FSLBASE_MATH_TRANSFORMUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Math/Vector4.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+
+//! Batch versions of the Vector3/Vector4 transform methods.
+//! The results are identical to calling the single element methods for each entry, but the matrix is only loaded once
+//! and SIMD instructions are used when available.
+//! The src and dst spans can be the same span, but they are not allowed to partially overlap.
+namespace Fsl::TransformUtil
+{
+  //! @brief Transform the positions by the matrix, the same as calling Vector3::Transform for each entry.
+  //! @throws std::invalid_argument if dst is smaller than src.
+  void Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+
+  //! @brief Transform the normals by the matrix, the same as calling Vector3::TransformNormal for each entry.
+  //! @throws std::invalid_argument if dst is smaller than src.
+  void TransformNormal(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+
+  //! @brief Transform the positions by the matrix, the same as calling Vector4::Transform for each entry.
+  //! @throws std::invalid_argument if dst is smaller than src.
+  void Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector4> dst);
+
+  //! @brief Transform the vectors by the matrix, the same as calling Vector4::Transform for each entry.
+  //! @throws std::invalid_argument if dst is smaller than src.
+  void Transform(const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst);
+}
+
+#endif
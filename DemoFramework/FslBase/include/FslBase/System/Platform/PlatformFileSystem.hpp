@@ -35,11 +35,16 @@
 #include <FslBase/IO/FileAttributes.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/IO/SearchOptions.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 namespace Fsl::IO
 {
   class PathDeque;
+  class PlatformDirectoryMonitorToken;
+  class PlatformFileMappingToken;
   class PlatformPathMonitorToken;
 
   //! @note Be very careful with what is used here as its the bottom layer.
@@ -63,6 +68,28 @@ namespace Fsl::IO
     //! @note Experimental interface, might change.
     static bool CheckPathForChanges(const std::shared_ptr<PlatformPathMonitorToken>& token);
 
+    //! @brief Create a platform specific token that uses the OS change notifications to monitor a directory for changes
+    //! @param searchOptions if AllDirectories the sub directories are monitored as well (including directories created later)
+    //! @return return the platform specific token or null if not supported (the caller is expected to fall back to polling)
+    //! @note Experimental interface, might change.
+    static std::shared_ptr<PlatformDirectoryMonitorToken> CreateDirectoryMonitorToken(const Path& fullPath, const SearchOptions searchOptions);
+
+    //! @brief Wait up to maxWait for the monitored directory to change.
+    //!        Once the first change is detected the following events are coalesced for a short while before returning.
+    //! @param rChangedPaths the full path of every changed file or directory is added here (each path is only added once per call).
+    //! @return true if changed, false if not
+    //! @note Experimental interface, might change.
+    static bool WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token, std::vector<Path>& rChangedPaths,
+                                        const std::chrono::milliseconds maxWait);
+
+    //! @brief Map the content of the file read only into memory.
+    //! @return the platform specific token that keeps the mapping alive or null if the file could not be mapped
+    //!         (the caller is expected to fall back to reading the file).
+    //! @note  Empty files can not be mapped so they return null as well.
+    static std::shared_ptr<PlatformFileMappingToken> CreateFileMappingToken(const Path& path);
+
+    //! @brief Get the mapped content, it stays valid as long as the token is alive
+    static ReadOnlySpan<uint8_t> GetFileMappingContent(const PlatformFileMappingToken& token) noexcept;
 
     //! @brief Get the files under the path directory
     static void GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions);
@@ -0,0 +1,160 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_BENCHMARKREPORT_HPP
+#define FSLBASE_SYSTEM_PROFILER_BENCHMARKREPORT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  //! Nearest rank percentiles of a set of samples
+  struct BenchmarkSampleStats
+  {
+    uint64_t P50{0};
+    uint64_t P95{0};
+    uint64_t P99{0};
+    uint64_t Max{0};
+    uint64_t Total{0};
+    uint32_t Count{0};
+
+    constexpr BenchmarkSampleStats() noexcept = default;
+    constexpr BenchmarkSampleStats(const uint64_t p50, const uint64_t p95, const uint64_t p99, const uint64_t max, const uint64_t total,
+                                   const uint32_t count) noexcept
+      : P50(p50)
+      , P95(p95)
+      , P99(p99)
+      , Max(max)
+      , Total(total)
+      , Count(count)
+    {
+    }
+
+    constexpr double Mean() const noexcept
+    {
+      return Count > 0 ? static_cast<double>(Total) / static_cast<double>(Count) : 0.0;
+    }
+  };
+
+
+  struct BenchmarkReportInfo
+  {
+    std::string Name;
+    uint32_t WarmupFrames{0};
+    //! The fixed timestep used while benchmarking (zero if the timestep wasn't fixed)
+    uint64_t TimestepNanoseconds{0};
+
+    BenchmarkReportInfo() = default;
+    BenchmarkReportInfo(std::string name, const uint32_t warmupFrames, const uint64_t timestepNanoseconds)
+      : Name(std::move(name))
+      , WarmupFrames(warmupFrames)
+      , TimestepNanoseconds(timestepNanoseconds)
+    {
+    }
+  };
+
+
+  //! @brief Collects per frame CPU time samples for a dynamic set of named phases (and the per frame allocation count) and reports the
+  //!        p50/p95/p99/max of each as JSON or CSV.
+  //!        A phase that was not sampled during a frame gets a zero sample for that frame, so all phases have a sample per frame.
+  //!        If the allocations aren't counted the allocation stats are written as null (JSON) or n/a (CSV) instead of zero.
+  class BenchmarkReport
+  {
+    struct PhaseRecord
+    {
+      std::string Name;
+      std::vector<uint64_t> Samples;
+
+      PhaseRecord(const StringViewLite name, const std::size_t frameCount, const std::size_t reservedFrames)
+        : Name(name)
+      {
+        Samples.reserve(reservedFrames);
+        Samples.resize(frameCount);
+      }
+    };
+
+    std::vector<PhaseRecord> m_phases;
+    std::vector<uint64_t> m_allocations;
+    uint32_t m_frameCount{0};
+    uint32_t m_reservedFrames{0};
+    bool m_allocationsCounted{true};
+
+  public:
+    //! @brief Calculate the stats of the given samples
+    static BenchmarkSampleStats CalcStats(const ReadOnlySpan<uint64_t> samples);
+
+    uint32_t GetFrameCount() const noexcept
+    {
+      return m_frameCount;
+    }
+
+    bool IsAllocationsCounted() const noexcept
+    {
+      return m_allocationsCounted;
+    }
+
+    //! @brief Mark if the allocations are counted (this is kept by Clear)
+    void SetAllocationsCounted(const bool counted) noexcept
+    {
+      m_allocationsCounted = counted;
+    }
+
+    void Clear() noexcept;
+
+    //! @brief Reserve space for the given number of frames so adding samples doesn't allocate memory.
+    void Reserve(const uint32_t frameCount);
+
+    //! @brief Start a new frame, all following samples are added to it.
+    void BeginFrame();
+
+    //! @brief Add time to the named phase in the current frame (multiple calls for the same phase are accumulated)
+    void AddPhaseTime(const StringViewLite name, const uint64_t nanoseconds);
+
+    //! @brief Add allocations to the current frame
+    void AddAllocations(const uint64_t count);
+
+    //! @brief Get the stats for the named phase (all zero if the phase is unknown)
+    BenchmarkSampleStats GetPhaseStats(const StringViewLite name) const;
+    BenchmarkSampleStats GetAllocationStats() const;
+
+    //! @brief Convert the report to JSON, all times are written in microseconds with nanosecond precision.
+    std::string ToJson(const BenchmarkReportInfo& info) const;
+
+    //! @brief Convert the report to CSV with one row per phase and a final row for the allocations.
+    std::string ToCsv() const;
+  };
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_CHROMETRACEUTIL_HPP
+#define FSLBASE_SYSTEM_PROFILER_CHROMETRACEUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerEvent.hpp>
+#include <string>
+
+namespace Fsl
+{
+  //! @brief Export scope profiler zones using the Chrome trace event format.
+  //!        The result can be loaded by chrome://tracing and https://ui.perfetto.dev
+  namespace ChromeTraceUtil
+  {
+    //! @brief Convert the events to a Chrome trace JSON document.
+    //!        The timestamps are made relative to the earliest event and written in microseconds with nanosecond precision.
+    std::string ToJson(const ReadOnlySpan<ScopeProfilerEvent> events, const ReadOnlySpan<ScopeProfilerThreadInfo> threads);
+
+    //! @brief Write the events to a Chrome trace JSON file
+    void Save(const IO::Path& path, const ReadOnlySpan<ScopeProfilerEvent> events, const ReadOnlySpan<ScopeProfilerThreadInfo> threads);
+  }
+}
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_SCOPEPROFILER_HPP
+#define FSLBASE_SYSTEM_PROFILER_SCOPEPROFILER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerEvent.hpp>
+#include <atomic>
+#include <vector>
+
+// FSL_SCOPE_PROFILER_DISABLED compiles out all FSL_PROFILE_SCOPE zones, it is defined by the FslBase ScopeProfiler=Disabled flavor.
+
+namespace Fsl
+{
+  namespace Internal
+  {
+    inline std::atomic<bool> g_scopeProfilerIsRecording{false};
+  }
+
+  //! @brief A low overhead hierarchical CPU profiler.
+  //!        Zones are recorded into a lock free queue per thread (single producer the recording thread, single consumer the collector).
+  //!        The queue is a list of fixed size blocks that are allocated on demand and recycled once they have been collected.
+  //!        When not recording a zone costs a relaxed atomic load, when the profiler is compiled out it costs nothing.
+  //! @note  Zone names are stored as pointers so they must have static storage duration (string literals).
+  class ScopeProfiler
+  {
+  public:
+    //! The number of zones each thread can buffer between two Collect calls, zones beyond this are dropped.
+    static constexpr uint32_t EventsPerThread = 1u << 16;
+    //! The thread buffers grow in blocks of this many zones, so threads that only record a few zones stay small.
+    static constexpr uint32_t EventsPerBlock = 256;
+
+    //! The consumer used by the BeginRecording, EndRecording and Collect overloads that do not take a consumer id.
+    static constexpr uint32_t DefaultConsumerId = 0;
+
+    //! @brief Check if any consumer is recording
+    static bool IsRecording() noexcept
+    {
+      return Internal::g_scopeProfilerIsRecording.load(std::memory_order_relaxed);
+    }
+
+    static void BeginRecording();
+    static void EndRecording() noexcept;
+
+    //! @brief Get the current profiler timestamp in nanoseconds (only useful for relative compares)
+    static uint64_t GetTimestamp() noexcept;
+
+    //! @brief Name the calling thread (the name is used when exporting)
+    static void SetThreadName(const char* const pszName);
+
+    //! @brief Move all events that have been recorded since the last call into rEvents (the events are appended)
+    //! @return the number of events that were dropped since the last collect because a thread buffer was full.
+    static uint64_t Collect(std::vector<ScopeProfilerEvent>& rEvents);
+
+    //! @brief Register a new consumer. Each consumer has its own recording window and receives every zone recorded inside it,
+    //!        so multiple systems can record and collect at the same time without taking each others zones.
+    //! @note  Prefer the ScopeProfilerConsumer RAII wrapper.
+    static uint32_t CreateConsumer();
+    static void DestroyConsumer(const uint32_t consumerId) noexcept;
+    static void BeginRecording(const uint32_t consumerId);
+    //! @brief Stop recording, the pending zones are stored in the space reserved by BeginRecording and Collect (zones beyond that are dropped)
+    static void EndRecording(const uint32_t consumerId) noexcept;
+    //! @brief Move all events the consumer received since the last call into rEvents (the events are appended)
+    //! @return the number of events that were dropped while the consumer was recording because a thread buffer was full.
+    static uint64_t Collect(const uint32_t consumerId, std::vector<ScopeProfilerEvent>& rEvents);
+
+    //! @brief Get information about all threads that have recorded zones
+    static std::vector<ScopeProfilerThreadInfo> GetThreads();
+
+    //! @brief Used by ScopedProfilerZone, marks the start of a zone on the calling thread.
+    //! @return the zone begin timestamp
+    static uint64_t EnterZone() noexcept;
+
+    //! @brief Used by ScopedProfilerZone, marks the end of a zone on the calling thread.
+    static void LeaveZone(const char* const pszName, const uint64_t beginNanoseconds) noexcept;
+  };
+
+
+  class ScopedProfilerZone
+  {
+    const char* m_pszName;
+    uint64_t m_beginNanoseconds{0};
+    bool m_isActive;
+
+  public:
+    ScopedProfilerZone(const ScopedProfilerZone&) = delete;
+    ScopedProfilerZone& operator=(const ScopedProfilerZone&) = delete;
+
+    explicit ScopedProfilerZone(const char* const pszName) noexcept
+      : m_pszName(pszName)
+      , m_isActive(ScopeProfiler::IsRecording())
+    {
+      if (m_isActive)
+      {
+        m_beginNanoseconds = ScopeProfiler::EnterZone();
+      }
+    }
+
+    ~ScopedProfilerZone() noexcept
+    {
+      if (m_isActive)
+      {
+        ScopeProfiler::LeaveZone(m_pszName, m_beginNanoseconds);
+      }
+    }
+  };
+}
+
+#define FSL_PROFILE_SCOPE_CONCAT_IMPL(X, Y) X##Y
+#define FSL_PROFILE_SCOPE_CONCAT(X, Y) FSL_PROFILE_SCOPE_CONCAT_IMPL(X, Y)
+
+#ifndef FSL_SCOPE_PROFILER_DISABLED
+//! Record a profiler zone from this point to the end of the current scope. The name must be a string literal.
+#define FSL_PROFILE_SCOPE(pszName) const Fsl::ScopedProfilerZone FSL_PROFILE_SCOPE_CONCAT(fslScopedProfilerZone, __LINE__)(pszName)
+#else
+#define FSL_PROFILE_SCOPE(pszName) \
+  do                               \
+  {                                \
+  } while (false)
+#endif
+
+#endif
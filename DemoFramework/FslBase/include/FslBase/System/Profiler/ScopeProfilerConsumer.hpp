@@ -0,0 +1,78 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_SCOPEPROFILERCONSUMER_HPP
+#define FSLBASE_SYSTEM_PROFILER_SCOPEPROFILERCONSUMER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Owns a ScopeProfiler consumer, so it can record and collect zones independently of the other consumers.
+  class ScopeProfilerConsumer
+  {
+    uint32_t m_consumerId;
+
+  public:
+    ScopeProfilerConsumer(const ScopeProfilerConsumer&) = delete;
+    ScopeProfilerConsumer& operator=(const ScopeProfilerConsumer&) = delete;
+
+    ScopeProfilerConsumer()
+      : m_consumerId(ScopeProfiler::CreateConsumer())
+    {
+    }
+
+    ~ScopeProfilerConsumer() noexcept
+    {
+      ScopeProfiler::DestroyConsumer(m_consumerId);
+    }
+
+    void BeginRecording()
+    {
+      ScopeProfiler::BeginRecording(m_consumerId);
+    }
+
+    void EndRecording() noexcept
+    {
+      ScopeProfiler::EndRecording(m_consumerId);
+    }
+
+    //! @brief Move all events received since the last call into rEvents (the events are appended)
+    //! @return the number of events that were dropped while recording because a thread buffer was full.
+    uint64_t Collect(std::vector<ScopeProfilerEvent>& rEvents)
+    {
+      return ScopeProfiler::Collect(m_consumerId, rEvents);
+    }
+  };
+}
+
+#endif
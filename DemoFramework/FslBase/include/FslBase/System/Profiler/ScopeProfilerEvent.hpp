@@ -0,0 +1,85 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_SCOPEPROFILEREVENT_HPP
+#define FSLBASE_SYSTEM_PROFILER_SCOPEPROFILEREVENT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <string>
+#include <utility>
+
+namespace Fsl
+{
+  //! A completed profiler zone
+  struct ScopeProfilerEvent
+  {
+    //! The zone name (the profiler expects this to be a string literal or a string with static storage duration)
+    const char* pszName{nullptr};
+    //! Zone start in nanoseconds (only useful for relative compares)
+    uint64_t BeginNanoseconds{0};
+    //! Zone end in nanoseconds (only useful for relative compares)
+    uint64_t EndNanoseconds{0};
+    //! The profiler thread id of the thread that recorded the zone
+    uint32_t ThreadId{0};
+    //! The nesting depth of the zone on its thread (0 = top level)
+    uint32_t Depth{0};
+
+    constexpr ScopeProfilerEvent() noexcept = default;
+    constexpr ScopeProfilerEvent(const char* const pszTheName, const uint64_t beginNanoseconds, const uint64_t endNanoseconds,
+                                 const uint32_t threadId, const uint32_t depth) noexcept
+      : pszName(pszTheName)
+      , BeginNanoseconds(beginNanoseconds)
+      , EndNanoseconds(endNanoseconds)
+      , ThreadId(threadId)
+      , Depth(depth)
+    {
+    }
+
+    constexpr uint64_t DurationNanoseconds() const noexcept
+    {
+      return EndNanoseconds - BeginNanoseconds;
+    }
+  };
+
+  struct ScopeProfilerThreadInfo
+  {
+    uint32_t ThreadId{0};
+    std::string Name;
+
+    ScopeProfilerThreadInfo() = default;
+    ScopeProfilerThreadInfo(const uint32_t threadId, std::string name)
+      : ThreadId(threadId)
+      , Name(std::move(name))
+    {
+    }
+  };
+}
+
+#endif
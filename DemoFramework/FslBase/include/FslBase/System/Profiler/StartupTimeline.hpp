@@ -0,0 +1,167 @@
+#ifndef FSLBASE_SYSTEM_PROFILER_STARTUPTIMELINE_HPP
+#define FSLBASE_SYSTEM_PROFILER_STARTUPTIMELINE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerEvent.hpp>
+#include <atomic>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  namespace Internal
+  {
+    inline std::atomic<bool> g_startupTimelineIsRecording{true};
+  }
+
+  //! A completed startup timeline span
+  struct StartupTimelineEvent
+  {
+    std::string Name;
+    //! Span start in ScopeProfiler::GetTimestamp nanoseconds
+    uint64_t BeginNanoseconds{0};
+    //! Span end in ScopeProfiler::GetTimestamp nanoseconds
+    uint64_t EndNanoseconds{0};
+    //! The timeline thread id of the thread that recorded the span
+    uint32_t ThreadId{0};
+
+    StartupTimelineEvent() = default;
+    StartupTimelineEvent(std::string name, const uint64_t beginNanoseconds, const uint64_t endNanoseconds, const uint32_t threadId)
+      : Name(std::move(name))
+      , BeginNanoseconds(beginNanoseconds)
+      , EndNanoseconds(endNanoseconds)
+      , ThreadId(threadId)
+    {
+    }
+
+    uint64_t DurationNanoseconds() const noexcept
+    {
+      return EndNanoseconds - BeginNanoseconds;
+    }
+  };
+
+
+  //! @brief Records named spans from process start until the app has finished startup (normally the first presented frame).
+  //!        Unlike the ScopeProfiler the span names are dynamic so they can describe the individual services being constructed.
+  //!        Recording is enabled from process start and stops when EndRecording is called, after that a span costs a relaxed atomic load.
+  class StartupTimeline
+  {
+  public:
+    static bool IsRecording() noexcept
+    {
+      return Internal::g_startupTimelineIsRecording.load(std::memory_order_relaxed);
+    }
+
+    static void BeginRecording() noexcept;
+
+    //! @brief Stop recording
+    //! @return true if this call stopped the recording, false if it was already stopped.
+    static bool EndRecording() noexcept;
+
+    //! @brief Remove all recorded spans
+    static void Clear();
+
+    //! @brief Get the process start time in ScopeProfiler::GetTimestamp nanoseconds.
+    //! @note  On platforms where the process start time can't be queried this is the time the timeline was first used.
+    static uint64_t GetProcessStartTimestamp() noexcept;
+
+    //! @brief Get the time the recording was ended (zero while recording)
+    static uint64_t GetEndTimestamp() noexcept;
+
+    //! @brief Name the calling thread (the name is used when exporting)
+    static void SetThreadName(std::string name);
+
+    //! @brief Add a span recorded on the calling thread (ignored if not recording)
+    static void AddEvent(std::string name, const uint64_t beginNanoseconds, const uint64_t endNanoseconds);
+
+    static std::vector<StartupTimelineEvent> GetEvents();
+    static std::vector<ScopeProfilerThreadInfo> GetThreads();
+
+    //! @brief Convert the timeline to a Chrome trace JSON document.
+    //!        A 'Startup' span covering the process start to the end of the recording is added, so all timestamps are relative to process
+    //!        start.
+    static std::string ToJson();
+
+    //! @brief Write the timeline to a Chrome trace JSON file
+    static void Save(const IO::Path& path);
+  };
+
+
+  class ScopedStartupTimelineZone
+  {
+    std::string m_name;
+    uint64_t m_beginNanoseconds{0};
+    bool m_isActive;
+
+  public:
+    ScopedStartupTimelineZone(const ScopedStartupTimelineZone&) = delete;
+    ScopedStartupTimelineZone& operator=(const ScopedStartupTimelineZone&) = delete;
+
+    explicit ScopedStartupTimelineZone(const char* const pszName)
+      : m_isActive(StartupTimeline::IsRecording())
+    {
+      if (m_isActive)
+      {
+        m_name = pszName;
+        m_beginNanoseconds = ScopeProfiler::GetTimestamp();
+      }
+    }
+
+    //! @brief Rename the zone before it ends, useful when the name is only known after the work has been done.
+    void SetName(std::string name)
+    {
+      m_name = std::move(name);
+    }
+
+    ~ScopedStartupTimelineZone() noexcept
+    {
+      if (m_isActive)
+      {
+        try
+        {
+          StartupTimeline::AddEvent(std::move(m_name), m_beginNanoseconds, ScopeProfiler::GetTimestamp());
+        }
+        catch (const std::exception&)
+        {
+          // A missing span is not worth taking the app down for
+        }
+      }
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef FSLBASE_SYSTEM_THREADING_JOBHANDLE_HPP
+#define FSLBASE_SYSTEM_THREADING_JOBHANDLE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+namespace Fsl
+{
+  class JobRecord;
+
+  //! @brief A reference to a job scheduled on a JobSystem.
+  //!        The handle can be used to wait for the job or as a dependency for other jobs.
+  class JobHandle
+  {
+    JobRecord* m_pRecord{nullptr};
+
+  public:
+    constexpr JobHandle() noexcept = default;
+    JobHandle(const JobHandle& other) noexcept;
+    JobHandle& operator=(const JobHandle& other) noexcept;
+    JobHandle(JobHandle&& other) noexcept;
+    JobHandle& operator=(JobHandle&& other) noexcept;
+    ~JobHandle();
+
+    //! @brief Check if the handle references a job
+    bool IsValid() const noexcept
+    {
+      return m_pRecord != nullptr;
+    }
+
+    //! @brief Release the job reference
+    void Reset() noexcept;
+
+    bool operator==(const JobHandle& rhs) const noexcept
+    {
+      return m_pRecord == rhs.m_pRecord;
+    }
+
+    bool operator!=(const JobHandle& rhs) const noexcept
+    {
+      return m_pRecord != rhs.m_pRecord;
+    }
+
+  private:
+    friend class JobSystem;
+    friend class JobSystemImpl;
+
+    //! @brief Takes ownership of one reference to the record
+    explicit JobHandle(JobRecord* pRecord) noexcept
+      : m_pRecord(pRecord)
+    {
+    }
+
+    JobRecord* GetRecord() const noexcept
+    {
+      return m_pRecord;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef FSLBASE_SYSTEM_THREADING_JOBSYSTEM_HPP
+#define FSLBASE_SYSTEM_THREADING_JOBSYSTEM_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobHandle.hpp>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Fsl
+{
+  class JobSystemImpl;
+
+  //! @brief A work stealing job system.
+  //!        - Each worker thread has its own lock free deque, idle workers steal from the other deques.
+  //!        - The thread that created the job system also gets a deque and executes jobs while it waits ("help while waiting").
+  //!        - Jobs can depend on other jobs, a job is only queued once all its dependencies have completed.
+  //!        - Exceptions thrown by a job are captured and rethrown by Wait.
+  //! @note  If the platform has no thread support (or zero workers are requested) all jobs are executed by the thread calling Wait.
+  class JobSystem
+  {
+    std::unique_ptr<JobSystemImpl> m_impl;
+
+  public:
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    //! @brief Create a job system with GetDefaultWorkerThreadCount() workers
+    JobSystem();
+
+    //! @brief Create a job system with the given amount of worker threads (zero is allowed).
+    explicit JobSystem(const uint32_t workerThreadCount);
+
+    //! @brief Execute all remaining jobs and shutdown the worker threads.
+    ~JobSystem();
+
+    //! @brief Get the recommended worker thread count for this system (one less than the number of hardware threads).
+    static uint32_t GetDefaultWorkerThreadCount();
+
+    //! @brief Get the number of worker threads.
+    uint32_t GetWorkerThreadCount() const noexcept;
+
+    //! @brief Get the number of threads that can execute jobs concurrently (the workers + the waiting thread)
+    uint32_t GetConcurrency() const noexcept;
+
+    //! @brief Schedule a job for execution.
+    JobHandle Schedule(std::function<void()> fnJob);
+
+    //! @brief Schedule a job that will be executed once the dependency has completed.
+    //! @note  A invalid dependency handle is ignored.
+    JobHandle Schedule(std::function<void()> fnJob, const JobHandle& dependency);
+
+    //! @brief Schedule a job that will be executed once all dependencies have completed.
+    //! @note  Invalid dependency handles are ignored.
+    JobHandle Schedule(std::function<void()> fnJob, const ReadOnlySpan<JobHandle> dependencies);
+
+    //! @brief Check if the job has completed.
+    //! @throws std::invalid_argument if the handle is invalid.
+    bool IsCompleted(const JobHandle& handle) const;
+
+    //! @brief Wait for the job to complete, the calling thread executes other jobs while it waits.
+    //! @throws std::invalid_argument if the handle is invalid.
+    //! @note  If the job threw a exception it will be rethrown here.
+    void Wait(const JobHandle& handle);
+
+    //! @brief Wait for all the jobs to complete, the calling thread executes other jobs while it waits.
+    //! @note  Invalid handles are ignored. If any of the jobs threw a exception the first one will be rethrown once all jobs completed.
+    void WaitAll(const ReadOnlySpan<JobHandle> handles);
+
+    //! @brief Try to execute one pending job on the calling thread.
+    //! @return true if a job was executed.
+    bool TryExecuteOne();
+
+    //! @brief Process the span in parallel, the span is split into batches that are processed by fnProcess(Span<T> batch, std::size_t offset).
+    //! @param minBatchSize the minimum number of elements per batch.
+    //! @note  The calling thread processes the first batch itself and then helps with the rest until all batches are done.
+    template <typename T, typename TFunc>
+    void ParallelFor(const Span<T> span, const std::size_t minBatchSize, TFunc fnProcess)
+    {
+      DoParallelFor(span, minBatchSize, fnProcess);
+    }
+
+    //! @brief Process the span in parallel, the span is split into batches that are processed by fnProcess(ReadOnlySpan<T> batch, std::size_t
+    //! offset).
+    //! @param minBatchSize the minimum number of elements per batch.
+    //! @note  The calling thread processes the first batch itself and then helps with the rest until all batches are done.
+    template <typename T, typename TFunc>
+    void ParallelFor(const ReadOnlySpan<T> span, const std::size_t minBatchSize, TFunc fnProcess)
+    {
+      DoParallelFor(span, minBatchSize, fnProcess);
+    }
+
+    //! @brief Execute fnProcess(std::size_t startIndex, std::size_t count) for the range [0, count) in parallel.
+    //! @param minBatchSize the minimum number of indices per batch.
+    template <typename TFunc>
+    void ParallelForRange(const std::size_t count, const std::size_t minBatchSize, TFunc fnProcess)
+    {
+      const std::size_t batchCount = CalcBatchCount(count, minBatchSize);
+      if (batchCount <= 1u)
+      {
+        if (count > 0u)
+        {
+          fnProcess(std::size_t(0), count);
+        }
+        return;
+      }
+
+      const std::size_t batchSize = (count + batchCount - 1u) / batchCount;
+      std::vector<JobHandle> handles;
+      handles.reserve(batchCount - 1u);
+      for (std::size_t offset = batchSize; offset < count; offset += batchSize)
+      {
+        const std::size_t batchEntries = std::min(batchSize, count - offset);
+        handles.push_back(Schedule([offset, batchEntries, &fnProcess]() { fnProcess(offset, batchEntries); }));
+      }
+
+      try
+      {
+        fnProcess(std::size_t(0), batchSize);
+      }
+      catch (...)
+      {
+        // The scheduled jobs reference fnProcess so we must let them finish before the exception is allowed to propagate
+        WaitAllNoThrow(SpanUtil::AsReadOnlySpan(handles));
+        throw;
+      }
+      WaitAll(SpanUtil::AsReadOnlySpan(handles));
+    }
+
+  private:
+    template <typename TSpan, typename TFunc>
+    void DoParallelFor(const TSpan span, const std::size_t minBatchSize, TFunc& fnProcess)
+    {
+      ParallelForRange(span.size(), minBatchSize,
+                       [span, &fnProcess](const std::size_t offset, const std::size_t count)
+                       { fnProcess(span.unchecked_subspan(offset, count), offset); });
+    }
+
+    std::size_t CalcBatchCount(const std::size_t count, const std::size_t minBatchSize) const noexcept;
+    void WaitAllNoThrow(const ReadOnlySpan<JobHandle> handles) noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,336 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteSpanUtil_ReadLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Archive/ContentArchive.hpp>
+#include <fmt/format.h>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include "ContentArchiveFormat.hpp"
+#include "Lz4Block.hpp"
+
+namespace Fsl::IO
+{
+  namespace
+  {
+    bool IsValidRange(const uint64_t offset, const uint64_t size, const uint64_t capacity) noexcept
+    {
+      return offset <= capacity && size <= (capacity - offset);
+    }
+
+    // The index entry readers below are only given spans of ContentArchiveFormat::EntrySize bytes, so the fields can be read unchecked
+
+    uint8_t ReadEntryUInt8(const ReadOnlySpan<uint8_t> indexEntry, const std::size_t offset) noexcept
+    {
+      return ByteSpanUtil::ReadUInt8LE(indexEntry.unchecked_subspan(offset, 1));
+    }
+
+    uint16_t ReadEntryUInt16(const ReadOnlySpan<uint8_t> indexEntry, const std::size_t offset) noexcept
+    {
+      return ByteSpanUtil::ReadUInt16LE(indexEntry.unchecked_subspan(offset, 2));
+    }
+
+    uint32_t ReadEntryUInt32(const ReadOnlySpan<uint8_t> indexEntry, const std::size_t offset) noexcept
+    {
+      return ByteSpanUtil::ReadUInt32LE(indexEntry.unchecked_subspan(offset, 4));
+    }
+
+    uint64_t ReadEntryUInt64(const ReadOnlySpan<uint8_t> indexEntry, const std::size_t offset) noexcept
+    {
+      return ByteSpanUtil::ReadUInt64LE(indexEntry.unchecked_subspan(offset, 8));
+    }
+
+    ContentArchiveEntry DecodeEntry(const ReadOnlySpan<uint8_t> indexEntry) noexcept
+    {
+      assert(indexEntry.size() == ContentArchiveFormat::EntrySize);
+      return {ReadEntryUInt64(indexEntry, ContentArchiveFormat::EntryOffsetDataOffset),
+              ReadEntryUInt64(indexEntry, ContentArchiveFormat::EntryOffsetStoredSize),
+              ReadEntryUInt64(indexEntry, ContentArchiveFormat::EntryOffsetSize),
+              static_cast<ContentArchiveCompression>(ReadEntryUInt8(indexEntry, ContentArchiveFormat::EntryOffsetCompression))};
+    }
+
+    void Decompress(Span<uint8_t> dst, const ContentArchiveEntry& entry, const ReadOnlySpan<uint8_t> storedContent)
+    {
+      switch (entry.Compression)
+      {
+      case ContentArchiveCompression::None:
+        if (dst.size() != storedContent.size())
+        {
+          throw FormatException("Stored entry size mismatch");
+        }
+        if (!storedContent.empty())
+        {
+          std::memcpy(dst.data(), storedContent.data(), storedContent.size());
+        }
+        break;
+      case ContentArchiveCompression::Lz4:
+        if (!Lz4Block::TryDecompress(dst, storedContent))
+        {
+          throw FormatException("Failed to decompress LZ4 entry");
+        }
+        break;
+      default:
+        throw FormatException(fmt::format("Unsupported compression: {}", static_cast<uint32_t>(entry.Compression)));
+      }
+    }
+  }
+
+
+  ContentArchive::ContentArchive(ContentArchive&& other) noexcept
+    : m_file(std::move(other.m_file))
+    , m_entryCount(other.m_entryCount)
+    , m_stringTableOffset(other.m_stringTableOffset)
+    , m_stringTableSize(other.m_stringTableSize)
+  {
+    other.m_entryCount = 0;
+    other.m_stringTableOffset = 0;
+    other.m_stringTableSize = 0;
+  }
+
+
+  ContentArchive& ContentArchive::operator=(ContentArchive&& other) noexcept
+  {
+    if (this != &other)
+    {
+      m_file = std::move(other.m_file);
+      m_entryCount = other.m_entryCount;
+      m_stringTableOffset = other.m_stringTableOffset;
+      m_stringTableSize = other.m_stringTableSize;
+
+      other.m_entryCount = 0;
+      other.m_stringTableOffset = 0;
+      other.m_stringTableSize = 0;
+    }
+    return *this;
+  }
+
+
+  ContentArchive::ContentArchive() noexcept = default;
+
+
+  ContentArchive::ContentArchive(const Path& path)
+    : m_file(path)
+  {
+    ParseHeader();
+  }
+
+
+  ContentArchive::ContentArchive(MemoryMappedFile file)
+    : m_file(std::move(file))
+  {
+    ParseHeader();
+  }
+
+
+  ContentArchive::~ContentArchive() = default;
+
+
+  StringViewLite ContentArchive::GetEntryName(const uint32_t index) const
+  {
+    return GetEntryName(GetIndexEntry(index));
+  }
+
+
+  ContentArchiveEntry ContentArchive::GetEntry(const uint32_t index) const
+  {
+    return DecodeEntry(GetIndexEntry(index));
+  }
+
+
+  std::optional<ContentArchiveEntry> ContentArchive::TryFind(const Path& relativePath) const noexcept
+  {
+    const std::string& pathString = relativePath.ToUTF8String();
+    const StringViewLite name(pathString.data(), pathString.size());
+    const uint64_t hash = ContentArchiveFormat::CalcHash(name);
+
+    // Binary search for the first entry with the hash
+    uint32_t first = 0;
+    uint32_t count = m_entryCount;
+    while (count > 0)
+    {
+      const uint32_t step = count / 2;
+      const uint32_t index = first + step;
+      if (ReadEntryUInt64(UncheckedGetIndexEntry(index), ContentArchiveFormat::EntryOffsetHash) < hash)
+      {
+        first = index + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+
+    // Then scan the entries with a identical hash
+    for (uint32_t index = first; index < m_entryCount; ++index)
+    {
+      const ReadOnlySpan<uint8_t> indexEntry = UncheckedGetIndexEntry(index);
+      if (ReadEntryUInt64(indexEntry, ContentArchiveFormat::EntryOffsetHash) != hash)
+      {
+        break;
+      }
+      if (GetEntryName(indexEntry) == name)
+      {
+        return DecodeEntry(indexEntry);
+      }
+    }
+    return {};
+  }
+
+
+  ReadOnlySpan<uint8_t> ContentArchive::GetStoredContent(const ContentArchiveEntry& entry) const
+  {
+    if (!IsValidRange(entry.Offset, entry.StoredSize, m_file.size()))
+    {
+      throw std::invalid_argument("entry is not part of the archive");
+    }
+    return m_file.AsReadOnlySpan().subspan(static_cast<std::size_t>(entry.Offset), static_cast<std::size_t>(entry.StoredSize));
+  }
+
+
+  void ContentArchive::ReadAllBytes(std::vector<uint8_t>& rContent, const ContentArchiveEntry& entry) const
+  {
+    const ReadOnlySpan<uint8_t> storedContent = GetStoredContent(entry);
+    if (entry.Size > std::numeric_limits<std::size_t>::max())
+    {
+      throw FormatException("Entry too large");
+    }
+    rContent.resize(static_cast<std::size_t>(entry.Size));
+    Decompress(Span<uint8_t>(rContent.data(), rContent.size()), entry, storedContent);
+  }
+
+
+  std::vector<uint8_t> ContentArchive::ReadAllBytes(const ContentArchiveEntry& entry) const
+  {
+    std::vector<uint8_t> content;
+    ReadAllBytes(content, entry);
+    return content;
+  }
+
+
+  MemoryMappedFile ContentArchive::MapAllBytes(const ContentArchiveEntry& entry) const
+  {
+    if (entry.Compression == ContentArchiveCompression::None)
+    {
+      if (entry.StoredSize != entry.Size)
+      {
+        throw FormatException("Stored entry size mismatch");
+      }
+      // Validate the range before creating the slice
+      GetStoredContent(entry);
+      return m_file.Slice(static_cast<std::size_t>(entry.Offset), static_cast<std::size_t>(entry.StoredSize));
+    }
+    return MemoryMappedFile(ReadAllBytes(entry));
+  }
+
+
+  void ContentArchive::ParseHeader()
+  {
+    const ReadOnlySpan<uint8_t> content = m_file.AsReadOnlySpan();
+    if (content.size() < ContentArchiveFormat::HeaderSize ||
+        std::memcmp(content.data(), ContentArchiveFormat::Magic.data(), ContentArchiveFormat::Magic.size()) != 0)
+    {
+      throw FormatException("Not a content archive");
+    }
+    const uint32_t version = ByteSpanUtil::ReadUInt32LE(content, ContentArchiveFormat::HeaderOffsetVersion);
+    if (version != ContentArchiveFormat::Version)
+    {
+      throw FormatException(fmt::format("Unsupported content archive version: {}", version));
+    }
+    const uint32_t entryCount = ByteSpanUtil::ReadUInt32LE(content, ContentArchiveFormat::HeaderOffsetEntryCount);
+    const uint32_t alignment = ByteSpanUtil::ReadUInt32LE(content, ContentArchiveFormat::HeaderOffsetAlignment);
+    const uint64_t stringTableOffset = ByteSpanUtil::ReadUInt64LE(content, ContentArchiveFormat::HeaderOffsetStringTableOffset);
+    const uint64_t stringTableSize = ByteSpanUtil::ReadUInt64LE(content, ContentArchiveFormat::HeaderOffsetStringTableSize);
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+      throw FormatException(fmt::format("Invalid alignment: {}", alignment));
+    }
+    if (!IsValidRange(ContentArchiveFormat::HeaderSize, uint64_t(entryCount) * ContentArchiveFormat::EntrySize, content.size()) ||
+        !IsValidRange(stringTableOffset, stringTableSize, content.size()))
+    {
+      throw FormatException("Content archive is truncated");
+    }
+
+    m_entryCount = entryCount;
+    m_stringTableOffset = stringTableOffset;
+    m_stringTableSize = stringTableSize;
+
+    // Validate the index once so lookups can trust it
+    uint64_t previousHash = 0;
+    for (uint32_t index = 0; index < entryCount; ++index)
+    {
+      const ReadOnlySpan<uint8_t> indexEntry = GetIndexEntry(index);
+      const uint64_t hash = ReadEntryUInt64(indexEntry, ContentArchiveFormat::EntryOffsetHash);
+      const uint32_t nameOffset = ReadEntryUInt32(indexEntry, ContentArchiveFormat::EntryOffsetNameOffset);
+      const uint16_t nameLength = ReadEntryUInt16(indexEntry, ContentArchiveFormat::EntryOffsetNameLength);
+      const ContentArchiveEntry entry = DecodeEntry(indexEntry);
+      if (hash < previousHash || !IsValidRange(nameOffset, nameLength, stringTableSize) ||
+          !IsValidRange(entry.Offset, entry.StoredSize, content.size()))
+      {
+        m_entryCount = 0;
+        throw FormatException(fmt::format("Content archive entry {} is invalid", index));
+      }
+      previousHash = hash;
+    }
+  }
+
+
+  ReadOnlySpan<uint8_t> ContentArchive::GetIndexEntry(const uint32_t index) const
+  {
+    if (index >= m_entryCount)
+    {
+      throw std::invalid_argument(fmt::format("index out of range: {}", index));
+    }
+    return UncheckedGetIndexEntry(index);
+  }
+
+
+  ReadOnlySpan<uint8_t> ContentArchive::UncheckedGetIndexEntry(const uint32_t index) const noexcept
+  {
+    assert(index < m_entryCount);
+    // ParseHeader verified that the whole index is part of the file
+    return m_file.AsReadOnlySpan().unchecked_subspan(ContentArchiveFormat::HeaderSize + (std::size_t(index) * ContentArchiveFormat::EntrySize),
+                                                     ContentArchiveFormat::EntrySize);
+  }
+
+
+  StringViewLite ContentArchive::GetEntryName(const ReadOnlySpan<uint8_t> indexEntry) const noexcept
+  {
+    const uint32_t nameOffset = ReadEntryUInt32(indexEntry, ContentArchiveFormat::EntryOffsetNameOffset);
+    const uint16_t nameLength = ReadEntryUInt16(indexEntry, ContentArchiveFormat::EntryOffsetNameLength);
+    const auto* const pName = reinterpret_cast<const char*>(m_file.data() + m_stringTableOffset + nameOffset);
+    return StringViewLite(pName, nameLength);
+  }
+}
@@ -0,0 +1,96 @@
+#ifndef FSLBASE_IO_ARCHIVE_CONTENTARCHIVEFORMAT_HPP
+#define FSLBASE_IO_ARCHIVE_CONTENTARCHIVEFORMAT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <array>
+
+namespace Fsl::IO::ContentArchiveFormat
+{
+  // All values are stored in little endian
+  //
+  // Header
+  //   uint8_t  Magic[8]
+  //   uint32_t Version
+  //   uint32_t EntryCount
+  //   uint32_t Alignment
+  //   uint32_t Reserved
+  //   uint64_t StringTableOffset
+  //   uint64_t StringTableSize
+  // Index entries (EntryCount, sorted by hash then by name)
+  //   uint64_t Hash
+  //   uint64_t DataOffset
+  //   uint64_t StoredSize
+  //   uint64_t Size
+  //   uint32_t NameOffset (relative to the string table)
+  //   uint16_t NameLength
+  //   uint8_t  Compression
+  //   uint8_t  Reserved
+  // String table (the UTF8 names, not zero terminated)
+  // Data (each entry starts at a multiple of Alignment)
+
+  constexpr std::array<uint8_t, 8> Magic = {'F', 'S', 'L', 'P', 'A', 'K', 0x0D, 0x0A};
+  constexpr uint32_t Version = 1;
+
+  constexpr std::size_t HeaderSize = 40;
+  constexpr std::size_t HeaderOffsetVersion = 8;
+  constexpr std::size_t HeaderOffsetEntryCount = 12;
+  constexpr std::size_t HeaderOffsetAlignment = 16;
+  constexpr std::size_t HeaderOffsetStringTableOffset = 24;
+  constexpr std::size_t HeaderOffsetStringTableSize = 32;
+
+  constexpr std::size_t EntrySize = 40;
+  constexpr std::size_t EntryOffsetHash = 0;
+  constexpr std::size_t EntryOffsetDataOffset = 8;
+  constexpr std::size_t EntryOffsetStoredSize = 16;
+  constexpr std::size_t EntryOffsetSize = 24;
+  constexpr std::size_t EntryOffsetNameOffset = 32;
+  constexpr std::size_t EntryOffsetNameLength = 36;
+  constexpr std::size_t EntryOffsetCompression = 38;
+
+  constexpr std::size_t MaxNameLength = 0xFFFF;
+
+  //! @brief FNV-1a 64bit hash of the entry name
+  constexpr uint64_t CalcHash(const StringViewLite name) noexcept
+  {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char ch : name)
+    {
+      hash ^= static_cast<uint8_t>(ch);
+      hash *= 0x100000001b3ull;
+    }
+    return hash;
+  }
+}
+
+#endif
@@ -0,0 +1,186 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteSpanUtil_WriteLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Archive/ContentArchiveWriter.hpp>
+#include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include "ContentArchiveFormat.hpp"
+#include "Lz4Block.hpp"
+
+namespace Fsl::IO
+{
+  namespace
+  {
+    std::size_t AlignUp(const std::size_t value, const uint32_t alignment) noexcept
+    {
+      return (value + (alignment - 1)) & ~static_cast<std::size_t>(alignment - 1);
+    }
+  }
+
+
+  ContentArchiveWriter::ContentArchiveWriter(const uint32_t alignment)
+    : m_alignment(alignment)
+  {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+      throw std::invalid_argument(fmt::format("alignment must be a power of two: {}", alignment));
+    }
+  }
+
+
+  void ContentArchiveWriter::Add(const Path& relativePath, const ReadOnlySpan<uint8_t> content, const ContentArchiveCompression compression)
+  {
+    if (relativePath.IsEmpty() || Path::IsPathRooted(relativePath) || relativePath.Contains(".."))
+    {
+      throw std::invalid_argument(fmt::format("not a valid relative path: '{}'", relativePath.ToUTF8String()));
+    }
+    const std::string& name = relativePath.ToUTF8String();
+    if (name.size() > ContentArchiveFormat::MaxNameLength)
+    {
+      throw std::invalid_argument(fmt::format("path too long: '{}'", name));
+    }
+    if (std::any_of(m_records.begin(), m_records.end(), [&name](const Record& record) { return record.Name == name; }))
+    {
+      throw std::invalid_argument(fmt::format("path already added: '{}'", name));
+    }
+
+    Record record;
+    record.Name = name;
+    record.Size = content.size();
+    switch (compression)
+    {
+    case ContentArchiveCompression::None:
+      break;
+    case ContentArchiveCompression::Lz4:
+      Lz4Block::Compress(record.StoredContent, content);
+      // Only keep the compressed content if it actually saves space
+      if (record.StoredContent.size() < content.size())
+      {
+        record.Compression = ContentArchiveCompression::Lz4;
+      }
+      else
+      {
+        record.StoredContent.clear();
+      }
+      break;
+    default:
+      throw NotSupportedException(fmt::format("Unsupported compression: {}", static_cast<uint32_t>(compression)));
+    }
+    if (record.Compression == ContentArchiveCompression::None)
+    {
+      record.StoredContent.assign(content.begin(), content.end());
+    }
+    m_records.push_back(std::move(record));
+  }
+
+
+  std::vector<uint8_t> ContentArchiveWriter::ToBytes() const
+  {
+    if (m_records.size() > std::numeric_limits<uint32_t>::max())
+    {
+      throw NotSupportedException("Too many entries");
+    }
+
+    // Sort by hash then by name (the name breaks any hash collisions)
+    std::vector<std::pair<uint64_t, const Record*>> sorted;
+    sorted.reserve(m_records.size());
+    for (const Record& record : m_records)
+    {
+      sorted.emplace_back(ContentArchiveFormat::CalcHash(StringViewLite(record.Name.data(), record.Name.size())), &record);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& lhs, const auto& rhs)
+              { return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second->Name < rhs.second->Name); });
+
+    // Calculate the layout
+    const std::size_t stringTableOffset = ContentArchiveFormat::HeaderSize + (sorted.size() * ContentArchiveFormat::EntrySize);
+    std::size_t stringTableSize = 0;
+    for (const auto& entry : sorted)
+    {
+      stringTableSize += entry.second->Name.size();
+    }
+    if (stringTableSize > std::numeric_limits<uint32_t>::max())
+    {
+      throw NotSupportedException("String table too large");
+    }
+    std::size_t totalSize = AlignUp(stringTableOffset + stringTableSize, m_alignment);
+    for (const auto& entry : sorted)
+    {
+      totalSize = AlignUp(totalSize + entry.second->StoredContent.size(), m_alignment);
+    }
+
+    std::vector<uint8_t> result(totalSize);
+    Span<uint8_t> dst(result.data(), result.size());
+
+    std::memcpy(result.data(), ContentArchiveFormat::Magic.data(), ContentArchiveFormat::Magic.size());
+    ByteSpanUtil::WriteUInt32LE(dst, ContentArchiveFormat::HeaderOffsetVersion, ContentArchiveFormat::Version);
+    ByteSpanUtil::WriteUInt32LE(dst, ContentArchiveFormat::HeaderOffsetEntryCount, static_cast<uint32_t>(sorted.size()));
+    ByteSpanUtil::WriteUInt32LE(dst, ContentArchiveFormat::HeaderOffsetAlignment, m_alignment);
+    ByteSpanUtil::WriteUInt64LE(dst, ContentArchiveFormat::HeaderOffsetStringTableOffset, stringTableOffset);
+    ByteSpanUtil::WriteUInt64LE(dst, ContentArchiveFormat::HeaderOffsetStringTableSize, stringTableSize);
+
+    std::size_t nameOffset = 0;
+    std::size_t dataOffset = AlignUp(stringTableOffset + stringTableSize, m_alignment);
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+    {
+      const Record& record = *sorted[i].second;
+      Span<uint8_t> dstEntry = dst.subspan(ContentArchiveFormat::HeaderSize + (i * ContentArchiveFormat::EntrySize), ContentArchiveFormat::EntrySize);
+      ByteSpanUtil::WriteUInt64LE(dstEntry, ContentArchiveFormat::EntryOffsetHash, sorted[i].first);
+      ByteSpanUtil::WriteUInt64LE(dstEntry, ContentArchiveFormat::EntryOffsetDataOffset, dataOffset);
+      ByteSpanUtil::WriteUInt64LE(dstEntry, ContentArchiveFormat::EntryOffsetStoredSize, record.StoredContent.size());
+      ByteSpanUtil::WriteUInt64LE(dstEntry, ContentArchiveFormat::EntryOffsetSize, record.Size);
+      ByteSpanUtil::WriteUInt32LE(dstEntry, ContentArchiveFormat::EntryOffsetNameOffset, static_cast<uint32_t>(nameOffset));
+      ByteSpanUtil::WriteUInt16LE(dstEntry, ContentArchiveFormat::EntryOffsetNameLength, static_cast<uint16_t>(record.Name.size()));
+      ByteSpanUtil::WriteUInt8LE(dstEntry, ContentArchiveFormat::EntryOffsetCompression, static_cast<uint8_t>(record.Compression));
+
+      std::memcpy(result.data() + stringTableOffset + nameOffset, record.Name.data(), record.Name.size());
+      nameOffset += record.Name.size();
+
+      if (!record.StoredContent.empty())
+      {
+        std::memcpy(result.data() + dataOffset, record.StoredContent.data(), record.StoredContent.size());
+      }
+      dataOffset = AlignUp(dataOffset + record.StoredContent.size(), m_alignment);
+    }
+    return result;
+  }
+
+
+  void ContentArchiveWriter::Write(const Path& dstPath) const
+  {
+    File::WriteAllBytes(dstPath, ToBytes());
+  }
+}
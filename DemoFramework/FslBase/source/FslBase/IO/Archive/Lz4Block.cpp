@@ -0,0 +1,230 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "Lz4Block.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+namespace Fsl::IO::Lz4Block
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t HashBits = 12;
+      constexpr std::size_t MinMatch = 4;
+      constexpr std::size_t MaxOffset = 0xFFFF;
+      //! The last match must start at least 12 bytes before the end of the block
+      constexpr std::size_t MatchStartLimit = 12;
+      //! The last 5 bytes are always literals
+      constexpr std::size_t LastLiterals = 5;
+      constexpr uint8_t TokenLengthMask = 0x0F;
+    }
+
+    inline uint32_t Read32(const uint8_t* const pSrc) noexcept
+    {
+      uint32_t value = 0;
+      std::memcpy(&value, pSrc, sizeof(value));
+      return value;
+    }
+
+    inline uint32_t Hash(const uint32_t value) noexcept
+    {
+      return (value * 2654435761u) >> (32 - LocalConfig::HashBits);
+    }
+
+    void WriteLength(std::vector<uint8_t>& rDst, std::size_t length)
+    {
+      while (length >= 0xFF)
+      {
+        rDst.push_back(0xFF);
+        length -= 0xFF;
+      }
+      rDst.push_back(static_cast<uint8_t>(length));
+    }
+
+    void WriteSequence(std::vector<uint8_t>& rDst, const uint8_t* const pLiterals, const std::size_t literalLength, const std::size_t offset,
+                       const std::size_t matchLength)
+    {
+      assert(matchLength == 0 || matchLength >= LocalConfig::MinMatch);
+      const std::size_t encodedMatchLength = matchLength > 0 ? matchLength - LocalConfig::MinMatch : 0;
+
+      const auto tokenLiteral = static_cast<uint8_t>(std::min(literalLength, std::size_t(LocalConfig::TokenLengthMask)));
+      const auto tokenMatch = static_cast<uint8_t>(std::min(encodedMatchLength, std::size_t(LocalConfig::TokenLengthMask)));
+      rDst.push_back(static_cast<uint8_t>((tokenLiteral << 4) | tokenMatch));
+      if (literalLength >= LocalConfig::TokenLengthMask)
+      {
+        WriteLength(rDst, literalLength - LocalConfig::TokenLengthMask);
+      }
+      rDst.insert(rDst.end(), pLiterals, pLiterals + literalLength);
+      if (matchLength > 0)
+      {
+        rDst.push_back(static_cast<uint8_t>(offset & 0xFF));
+        rDst.push_back(static_cast<uint8_t>((offset >> 8) & 0xFF));
+        if (encodedMatchLength >= LocalConfig::TokenLengthMask)
+        {
+          WriteLength(rDst, encodedMatchLength - LocalConfig::TokenLengthMask);
+        }
+      }
+    }
+
+    //! @brief Read a extended length
+    inline bool TryReadLength(std::size_t& rLength, const ReadOnlySpan<uint8_t> src, std::size_t& rSrcIndex) noexcept
+    {
+      uint8_t value = 0xFF;
+      while (value == 0xFF)
+      {
+        if (rSrcIndex >= src.size())
+        {
+          return false;
+        }
+        value = src[rSrcIndex];
+        ++rSrcIndex;
+        rLength += value;
+      }
+      return true;
+    }
+  }
+
+
+  void Compress(std::vector<uint8_t>& rDst, const ReadOnlySpan<uint8_t> src)
+  {
+    const std::size_t srcSize = src.size();
+    rDst.reserve(rDst.size() + srcSize + (srcSize / 255) + 16);
+
+    const uint8_t* const pSrc = src.data();
+    std::size_t anchor = 0;
+    if (srcSize > LocalConfig::MatchStartLimit)
+    {
+      // Zero is a valid candidate for every hash as all candidates are verified before they are used
+      std::array<uint32_t, 1u << LocalConfig::HashBits> hashTable{};
+      const std::size_t matchStartEnd = srcSize - LocalConfig::MatchStartLimit;
+      const std::size_t matchEnd = srcSize - LocalConfig::LastLiterals;
+
+      std::size_t srcIndex = 0;
+      while (srcIndex <= matchStartEnd)
+      {
+        const uint32_t sequence = Read32(pSrc + srcIndex);
+        const uint32_t hash = Hash(sequence);
+        const std::size_t candidate = hashTable[hash];
+        hashTable[hash] = static_cast<uint32_t>(srcIndex);
+
+        if (candidate < srcIndex && (srcIndex - candidate) <= LocalConfig::MaxOffset && Read32(pSrc + candidate) == sequence)
+        {
+          std::size_t matchLength = LocalConfig::MinMatch;
+          while ((srcIndex + matchLength) < matchEnd && pSrc[candidate + matchLength] == pSrc[srcIndex + matchLength])
+          {
+            ++matchLength;
+          }
+          WriteSequence(rDst, pSrc + anchor, srcIndex - anchor, srcIndex - candidate, matchLength);
+          srcIndex += matchLength;
+          anchor = srcIndex;
+        }
+        else
+        {
+          ++srcIndex;
+        }
+      }
+    }
+    // The last sequence only contains literals
+    WriteSequence(rDst, pSrc + anchor, srcSize - anchor, 0, 0);
+  }
+
+
+  bool TryDecompress(Span<uint8_t> dst, const ReadOnlySpan<uint8_t> src) noexcept
+  {
+    uint8_t* const pDst = dst.data();
+    const std::size_t dstSize = dst.size();
+    const std::size_t srcSize = src.size();
+    std::size_t srcIndex = 0;
+    std::size_t dstIndex = 0;
+    while (srcIndex < srcSize)
+    {
+      const uint8_t token = src[srcIndex];
+      ++srcIndex;
+
+      std::size_t literalLength = token >> 4;
+      if (literalLength == LocalConfig::TokenLengthMask && !TryReadLength(literalLength, src, srcIndex))
+      {
+        return false;
+      }
+      if (literalLength > (srcSize - srcIndex) || literalLength > (dstSize - dstIndex))
+      {
+        return false;
+      }
+      if (literalLength > 0)
+      {
+        std::memcpy(pDst + dstIndex, src.data() + srcIndex, literalLength);
+        srcIndex += literalLength;
+        dstIndex += literalLength;
+      }
+
+      if (srcIndex == srcSize)
+      {
+        // The last sequence has no match
+        break;
+      }
+
+      if ((srcSize - srcIndex) < 2)
+      {
+        return false;
+      }
+      const std::size_t offset = static_cast<std::size_t>(src[srcIndex]) | (static_cast<std::size_t>(src[srcIndex + 1]) << 8);
+      srcIndex += 2;
+      if (offset == 0 || offset > dstIndex)
+      {
+        return false;
+      }
+
+      std::size_t matchLength = token & LocalConfig::TokenLengthMask;
+      if (matchLength == LocalConfig::TokenLengthMask && !TryReadLength(matchLength, src, srcIndex))
+      {
+        return false;
+      }
+      matchLength += LocalConfig::MinMatch;
+      if (matchLength > (dstSize - dstIndex))
+      {
+        return false;
+      }
+
+      // The match is allowed to overlap the output so copy it byte by byte
+      const uint8_t* pMatch = pDst + (dstIndex - offset);
+      for (std::size_t i = 0; i < matchLength; ++i)
+      {
+        pDst[dstIndex + i] = pMatch[i];
+      }
+      dstIndex += matchLength;
+    }
+    return dstIndex == dstSize;
+  }
+}
@@ -0,0 +1,76 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/DirectoryWatcher.hpp>
+#include <FslBase/IO/PathDeque.hpp>
+#include <FslBase/System/Platform/PlatformFileSystem.hpp>
+#include <stdexcept>
+
+namespace Fsl::IO
+{
+  DirectoryWatcher::DirectoryWatcher(const IO::Path& fullPath, const SearchOptions searchOptions, const DirectoryWatcherBackend preferredBackend)
+    : m_fullPath(fullPath)
+  {
+    if (!Path::IsPathRooted(fullPath))
+    {
+      throw std::invalid_argument("Path is not rooted");
+    }
+
+    if (preferredBackend == DirectoryWatcherBackend::Platform)
+    {
+      m_platformToken = PlatformFileSystem::CreateDirectoryMonitorToken(fullPath, searchOptions);
+    }
+
+    if (!m_platformToken)
+    {
+      // Fall back to polling all the files (GetFiles throws if the directory doesn't exist)
+      PathDeque files;
+      PlatformFileSystem::GetFiles(files, fullPath, searchOptions);
+      for (const auto& file : files)
+      {
+        m_pathWatcher.Add(*file);
+      }
+    }
+  }
+
+
+  DirectoryWatcher::~DirectoryWatcher() = default;
+
+
+  bool DirectoryWatcher::TryGetChanges(std::vector<IO::Path>& rChangedPaths, const std::chrono::milliseconds maxWait)
+  {
+    if (m_platformToken)
+    {
+      return PlatformFileSystem::WaitForDirectoryChanges(m_platformToken, rChangedPaths, maxWait);
+    }
+    return m_pathWatcher.Check(rChangedPaths);
+  }
+}
@@ -0,0 +1,122 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/System/Platform/PlatformFileSystem.hpp>
+#include <fmt/format.h>
+#include <utility>
+
+namespace Fsl::IO
+{
+  MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    : m_token(std::move(other.m_token))
+    , m_fallbackContent(std::move(other.m_fallbackContent))
+    , m_content(other.m_content)
+  {
+    // The moved vector keeps its buffer, so m_content is still valid
+    other.m_content = {};
+  }
+
+
+  MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+  {
+    if (this != &other)
+    {
+      m_token = std::move(other.m_token);
+      m_fallbackContent = std::move(other.m_fallbackContent);
+      m_content = other.m_content;
+
+      other.m_content = {};
+    }
+    return *this;
+  }
+
+
+  MemoryMappedFile::MemoryMappedFile() noexcept = default;
+
+
+  MemoryMappedFile::MemoryMappedFile(const Path& path)
+    : m_token(PlatformFileSystem::CreateFileMappingToken(path))
+  {
+    if (m_token)
+    {
+      m_content = PlatformFileSystem::GetFileMappingContent(*m_token);
+    }
+    else
+    {
+      // Empty files, unsupported platforms and files that can't be mapped end up here (missing files throw the normal IOException)
+      File::ReadAllBytes(m_fallbackContent, path);
+      m_content = ReadOnlySpan<uint8_t>(m_fallbackContent.data(), m_fallbackContent.size());
+    }
+  }
+
+
+  MemoryMappedFile::MemoryMappedFile(std::vector<uint8_t>&& content) noexcept
+    : m_fallbackContent(std::move(content))
+    , m_content(m_fallbackContent.data(), m_fallbackContent.size())
+  {
+  }
+
+
+  MemoryMappedFile::MemoryMappedFile(std::shared_ptr<PlatformFileMappingToken> token, const ReadOnlySpan<uint8_t> content) noexcept
+    : m_token(std::move(token))
+    , m_content(content)
+  {
+  }
+
+
+  MemoryMappedFile::~MemoryMappedFile() = default;
+
+
+  MemoryMappedFile MemoryMappedFile::Slice(const std::size_t offset, const std::size_t length) const
+  {
+    if (offset > m_content.size() || length > (m_content.size() - offset))
+    {
+      throw std::invalid_argument(fmt::format("slice out of range (offset: {} length: {} size: {})", offset, length, m_content.size()));
+    }
+    const ReadOnlySpan<uint8_t> content = m_content.subspan(offset, length);
+    if (m_token)
+    {
+      return {m_token, content};
+    }
+    return MemoryMappedFile(std::vector<uint8_t>(content.begin(), content.end()));
+  }
+
+
+  void MemoryMappedFile::Reset() noexcept
+  {
+    m_content = {};
+    m_fallbackContent = {};
+    m_token.reset();
+  }
+}
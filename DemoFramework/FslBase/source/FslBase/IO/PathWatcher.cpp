@@ -134,4 +134,18 @@ namespace Fsl::IO
     }
     return false;
   }
+
+  bool PathWatcher::Check(std::vector<IO::Path>& rChangedPaths)
+  {
+    bool changed = false;
+    for (auto itr = SysPaths.begin(); itr != SysPaths.end(); ++itr)
+    {
+      if ((*itr)->CheckForChanges())
+      {
+        rChangedPaths.push_back((*itr)->FullPath);
+        changed = true;
+      }
+    }
+    return changed;
+  }
 }
@@ -0,0 +1,704 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/AsyncLogSink.hpp>
+#include <FslBase/System/IThreadContext.hpp>
+#include <FslBase/System/Platform/PlatformThread.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AsyncLogSinkInternal.hpp"
+#ifdef __ANDROID__
+#include <android/log.h>
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t MinThreadBufferCapacity = 1024;
+      constexpr std::size_t RecordAlignment = 8;
+      constexpr std::size_t CacheLineSize = 64;
+    }
+
+    struct RecordHeader
+    {
+      uint64_t SequenceNumber{0};
+      uint32_t Length{0};
+      uint32_t LogType{0};
+    };
+    static_assert((sizeof(RecordHeader) % LocalConfig::RecordAlignment) == 0, "the record header size must be a multiple of the record alignment");
+
+    constexpr std::size_t CalcRecordSize(const std::size_t length) noexcept
+    {
+      return sizeof(RecordHeader) + ((length + (LocalConfig::RecordAlignment - 1)) & ~(LocalConfig::RecordAlignment - 1));
+    }
+
+
+    //! @brief A single producer (the logging thread), single consumer (the writer thread) ring buffer of variable sized records.
+    class ThreadLogBuffer
+    {
+      std::vector<uint8_t> m_data;
+      std::size_t m_mask;
+      alignas(LocalConfig::CacheLineSize) std::atomic<std::size_t> m_head{0};
+      alignas(LocalConfig::CacheLineSize) std::atomic<std::size_t> m_tail{0};
+      //! Producer local copy of m_head
+      std::size_t m_cachedHead{0};
+
+    public:
+      alignas(LocalConfig::CacheLineSize) std::atomic<uint64_t> DroppedMessages{0};
+      std::atomic<uint64_t> DroppedBytes{0};
+      //! Set when the owning thread exits, the consumer removes the buffer once it has been drained
+      std::atomic<bool> IsOrphaned{false};
+
+      explicit ThreadLogBuffer(const std::size_t capacity)
+        : m_data(capacity)
+        , m_mask(capacity - 1)
+      {
+      }
+
+      std::size_t Capacity() const noexcept
+      {
+        return m_data.size();
+      }
+
+      //! @brief Consumer only
+      bool IsEmpty() const noexcept
+      {
+        return m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_acquire);
+      }
+
+      //! @brief Producer only
+      //! @return the number of used bytes after the write or 0 if the record was dropped
+      std::size_t TryWrite(const uint64_t sequenceNumber, const LogType logType, const char* const psz, const std::size_t length) noexcept
+      {
+        const std::size_t recordSize = CalcRecordSize(length);
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if ((tail + recordSize - m_cachedHead) > m_data.size())
+        {
+          m_cachedHead = m_head.load(std::memory_order_acquire);
+          if ((tail + recordSize - m_cachedHead) > m_data.size())
+          {
+            DroppedMessages.fetch_add(1, std::memory_order_relaxed);
+            DroppedBytes.fetch_add(length, std::memory_order_relaxed);
+            return 0;
+          }
+        }
+
+        const RecordHeader header{sequenceNumber, static_cast<uint32_t>(length), static_cast<uint32_t>(logType)};
+        CopyIn(tail, &header, sizeof(RecordHeader));
+        CopyIn(tail + sizeof(RecordHeader), psz, length);
+        m_tail.store(tail + recordSize, std::memory_order_release);
+        return tail + recordSize - m_cachedHead;
+      }
+
+      //! @brief Consumer only, calls fnRecord(header, text) for every available record.
+      template <typename TFunc>
+      void Drain(std::vector<char>& rScratchpad, TFunc fnRecord)
+      {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        while (head != tail)
+        {
+          RecordHeader header;
+          CopyOut(&header, head, sizeof(RecordHeader));
+          rScratchpad.resize(header.Length);
+          CopyOut(rScratchpad.data(), head + sizeof(RecordHeader), header.Length);
+          fnRecord(header, rScratchpad);
+          head += CalcRecordSize(header.Length);
+        }
+        m_head.store(head, std::memory_order_release);
+      }
+
+    private:
+      void CopyIn(const std::size_t position, const void* const pSrc, const std::size_t length) noexcept
+      {
+        const std::size_t index = position & m_mask;
+        const std::size_t firstLength = std::min(length, m_data.size() - index);
+        std::memcpy(m_data.data() + index, pSrc, firstLength);
+        std::memcpy(m_data.data(), static_cast<const uint8_t*>(pSrc) + firstLength, length - firstLength);
+      }
+
+      void CopyOut(void* const pDst, const std::size_t position, const std::size_t length) const noexcept
+      {
+        const std::size_t index = position & m_mask;
+        const std::size_t firstLength = std::min(length, m_data.size() - index);
+        std::memcpy(pDst, m_data.data() + index, firstLength);
+        std::memcpy(static_cast<uint8_t*>(pDst) + firstLength, m_data.data(), length - firstLength);
+      }
+    };
+
+
+    //! The buffer the current thread logs into, it is tagged with the id of the sink it belongs to.
+    struct ThreadLogBufferHandle
+    {
+      uint64_t SinkId{0};
+      std::shared_ptr<ThreadLogBuffer> Buffer;
+
+      ThreadLogBufferHandle() = default;
+      ThreadLogBufferHandle(const ThreadLogBufferHandle&) = delete;
+      ThreadLogBufferHandle& operator=(const ThreadLogBufferHandle&) = delete;
+
+      ~ThreadLogBufferHandle()
+      {
+        if (Buffer)
+        {
+          Buffer->IsOrphaned.store(true, std::memory_order_release);
+        }
+      }
+    };
+
+    thread_local ThreadLogBufferHandle g_threadLogBuffer;
+
+    std::atomic<uint64_t> g_nextSinkId{1};
+    std::atomic<AsyncLogSinkImpl*> g_pActiveSink{nullptr};
+    //! The number of threads that might be accessing g_pActiveSink
+    std::atomic<uint32_t> g_activeCallers{0};
+
+
+    struct PendingRecord
+    {
+      uint64_t SequenceNumber{0};
+      LogType Type{LogType::Info};
+      std::size_t Offset{0};
+      std::size_t Length{0};
+
+      constexpr PendingRecord(const uint64_t sequenceNumber, const LogType logType, const std::size_t offset, const std::size_t length) noexcept
+        : SequenceNumber(sequenceNumber)
+        , Type(logType)
+        , Offset(offset)
+        , Length(length)
+      {
+      }
+    };
+
+
+    //! Keeps g_pActiveSink from being uninstalled while the scope is alive
+    class ActiveCallerScope
+    {
+    public:
+      ActiveCallerScope() noexcept
+      {
+        g_activeCallers.fetch_add(1, std::memory_order_seq_cst);
+      }
+
+      ~ActiveCallerScope() noexcept
+      {
+        g_activeCallers.fetch_sub(1, std::memory_order_seq_cst);
+      }
+
+      ActiveCallerScope(const ActiveCallerScope&) = delete;
+      ActiveCallerScope& operator=(const ActiveCallerScope&) = delete;
+    };
+
+
+    void AppendLine(fmt::memory_buffer& rDst, const LogType logType, const char* const pText, const std::size_t length)
+    {
+      switch (logType)
+      {
+      case LogType::Warning:
+        fmt::format_to(std::back_inserter(rDst), "WARNING: ");
+        break;
+      case LogType::Error:
+        fmt::format_to(std::back_inserter(rDst), "ERROR: ");
+        break;
+      default:
+        break;
+      }
+      rDst.append(pText, pText + length);
+      rDst.push_back('\n');
+    }
+  }
+
+
+  class AsyncLogSinkImpl
+  {
+    class WriterThreadContext final : public IThreadContext
+    {
+    public:
+      AsyncLogSinkImpl* pOwner;
+
+      explicit WriterThreadContext(AsyncLogSinkImpl* pTheOwner)
+        : pOwner(pTheOwner)
+      {
+      }
+    };
+
+    uint64_t m_id;
+    std::size_t m_threadBufferCapacity;
+    std::chrono::milliseconds m_flushInterval;
+    FILE* m_pFile{nullptr};
+    bool m_ownsFile{false};
+
+    mutable std::mutex m_buffersLock;
+    std::vector<std::shared_ptr<ThreadLogBuffer>> m_buffers;
+    //! Drop counters of the buffers that have been retired
+    uint64_t m_retiredDroppedMessages{0};
+    uint64_t m_retiredDroppedBytes{0};
+
+    std::atomic<uint64_t> m_nextSequenceNumber{0};
+    std::atomic<uint64_t> m_writtenMessages{0};
+    std::atomic<bool> m_wakePending{false};
+
+    //! Serializes the writes to the output so oversized messages written by the logging threads do not interleave with the writer thread
+    std::mutex m_outputLock;
+
+    std::mutex m_lock;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_flushedCondition;
+    bool m_stop{false};
+    uint64_t m_flushRequested{0};
+    uint64_t m_flushCompleted{0};
+
+    // Only accessed by the writer thread
+    uint64_t m_reportedDroppedMessages{0};
+    std::vector<std::shared_ptr<ThreadLogBuffer>> m_writerBuffers;
+    std::vector<PendingRecord> m_pendingRecords;
+    std::vector<char> m_pendingText;
+    std::vector<char> m_scratchpad;
+    fmt::memory_buffer m_output;
+
+    std::unique_ptr<PlatformThread> m_thread;
+
+  public:
+    explicit AsyncLogSinkImpl(const AsyncLogSinkConfig& config)
+      : m_id(g_nextSinkId.fetch_add(1, std::memory_order_relaxed))
+      , m_threadBufferCapacity(config.ThreadBufferCapacity)
+      , m_flushInterval(config.FlushInterval)
+    {
+      if (config.ThreadBufferCapacity < LocalConfig::MinThreadBufferCapacity || (config.ThreadBufferCapacity & (config.ThreadBufferCapacity - 1)) != 0)
+      {
+        throw std::invalid_argument("ThreadBufferCapacity must be a power of two and at least 1024");
+      }
+      if (config.FlushInterval.count() <= 0)
+      {
+        throw std::invalid_argument("FlushInterval must be positive");
+      }
+
+      if (config.LogFile.IsEmpty())
+      {
+        m_pFile = stdout;
+      }
+      else
+      {
+        m_pFile = std::fopen(config.LogFile.ToUTF8String().c_str(), "wb");
+        if (m_pFile == nullptr)
+        {
+          throw IOException(fmt::format("Failed to create log file '{}'", config.LogFile.ToUTF8String()));
+        }
+        m_ownsFile = true;
+      }
+
+      try
+      {
+        m_thread = std::make_unique<PlatformThread>([](const std::shared_ptr<IThreadContext>& context) { RunWriter(context); },
+                                                    std::make_shared<WriterThreadContext>(this));
+      }
+      catch (const std::exception&)
+      {
+        CloseFile();
+        throw;
+      }
+    }
+
+
+    ~AsyncLogSinkImpl() noexcept
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+      }
+      m_wakeCondition.notify_one();
+      try
+      {
+        m_thread->Join();
+      }
+      catch (const std::exception&)
+      {
+        // The logging functionality should never kill the program
+      }
+      CloseFile();
+    }
+
+    AsyncLogSinkImpl(const AsyncLogSinkImpl&) = delete;
+    AsyncLogSinkImpl& operator=(const AsyncLogSinkImpl&) = delete;
+
+
+    void WriteLine(const LogType logType, const char* const psz) noexcept
+    {
+      const std::size_t length = std::strlen(psz);
+      ThreadLogBuffer* const pBuffer = TryGetThreadBuffer();
+      if (pBuffer == nullptr || CalcRecordSize(length) > pBuffer->Capacity())
+      {
+        // The message can never be buffered, so write it directly instead of losing it
+        WriteLineNow(logType, psz, length);
+        return;
+      }
+
+      const uint64_t sequenceNumber = m_nextSequenceNumber.fetch_add(1, std::memory_order_relaxed);
+      const std::size_t usedBytes = pBuffer->TryWrite(sequenceNumber, logType, psz, length);
+      // Wake the writer early if the buffer is filling up or if something went wrong
+      if (usedBytes == 0 || usedBytes > (pBuffer->Capacity() / 2) || logType == LogType::Error)
+      {
+        if (!m_wakePending.exchange(true, std::memory_order_acq_rel))
+        {
+          m_wakeCondition.notify_one();
+        }
+      }
+    }
+
+
+    void Flush()
+    {
+      std::unique_lock<std::mutex> lock(m_lock);
+      const uint64_t flushTarget = ++m_flushRequested;
+      m_wakeCondition.notify_one();
+      m_flushedCondition.wait(lock, [this, flushTarget] { return m_flushCompleted >= flushTarget; });
+    }
+
+
+    //! @brief Write the message synchronously after the messages that are already buffered
+    void WriteLineNow(const LogType logType, const char* const pText, const std::size_t length) noexcept
+    {
+      try
+      {
+        Flush();
+        fmt::memory_buffer output;
+        std::lock_guard<std::mutex> lock(m_outputLock);
+        WriteRecord(output, logType, pText, length);
+        WriteOutput(output);
+        m_writtenMessages.fetch_add(1, std::memory_order_relaxed);
+      }
+      catch (const std::exception&)
+      {
+        // The logging functionality should never kill the program
+      }
+    }
+
+
+    AsyncLogSinkStats GetStats() const
+    {
+      std::lock_guard<std::mutex> lock(m_buffersLock);
+      uint64_t droppedMessages = m_retiredDroppedMessages;
+      uint64_t droppedBytes = m_retiredDroppedBytes;
+      for (const auto& buffer : m_buffers)
+      {
+        droppedMessages += buffer->DroppedMessages.load(std::memory_order_relaxed);
+        droppedBytes += buffer->DroppedBytes.load(std::memory_order_relaxed);
+      }
+      return {m_writtenMessages.load(std::memory_order_relaxed), droppedMessages, droppedBytes};
+    }
+
+  private:
+    ThreadLogBuffer* TryGetThreadBuffer() noexcept
+    {
+      ThreadLogBufferHandle& rHandle = g_threadLogBuffer;
+      if (rHandle.SinkId != m_id || !rHandle.Buffer)
+      {
+        try
+        {
+          auto buffer = std::make_shared<ThreadLogBuffer>(m_threadBufferCapacity);
+          {
+            std::lock_guard<std::mutex> lock(m_buffersLock);
+            m_buffers.push_back(buffer);
+          }
+          if (rHandle.Buffer)
+          {
+            // The buffer belonged to a sink that is no longer active
+            rHandle.Buffer->IsOrphaned.store(true, std::memory_order_release);
+          }
+          rHandle.Buffer = std::move(buffer);
+          rHandle.SinkId = m_id;
+        }
+        catch (const std::exception&)
+        {
+          return nullptr;
+        }
+      }
+      return rHandle.Buffer.get();
+    }
+
+
+    void CloseFile() noexcept
+    {
+      if (m_pFile != nullptr)
+      {
+        std::fflush(m_pFile);
+        if (m_ownsFile)
+        {
+          std::fclose(m_pFile);
+        }
+        m_pFile = nullptr;
+      }
+    }
+
+
+    static void RunWriter(const std::shared_ptr<IThreadContext>& context)
+    {
+      const auto* pContext = dynamic_cast<const WriterThreadContext*>(context.get());
+      if (pContext == nullptr)
+      {
+        return;
+      }
+      pContext->pOwner->RunWriter();
+    }
+
+
+    void RunWriter()
+    {
+      std::unique_lock<std::mutex> lock(m_lock);
+      bool stop = false;
+      while (!stop)
+      {
+        m_wakeCondition.wait_for(lock, m_flushInterval, [this]
+                                 { return m_stop || m_flushRequested != m_flushCompleted || m_wakePending.load(std::memory_order_acquire); });
+        stop = m_stop;
+        const uint64_t flushTarget = m_flushRequested;
+        lock.unlock();
+
+        m_wakePending.store(false, std::memory_order_release);
+        try
+        {
+          WriteBatch();
+        }
+        catch (const std::exception&)
+        {
+          // The logging functionality should never kill the program
+        }
+
+        lock.lock();
+        if (flushTarget != m_flushCompleted)
+        {
+          m_flushCompleted = flushTarget;
+          m_flushedCondition.notify_all();
+        }
+      }
+    }
+
+
+    //! @brief Drain all thread buffers and write the messages in the order they were logged
+    void WriteBatch()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_buffersLock);
+        m_writerBuffers = m_buffers;
+      }
+
+      m_pendingRecords.clear();
+      m_pendingText.clear();
+      bool hasOrphanedBuffers = false;
+      for (const auto& buffer : m_writerBuffers)
+      {
+        // The orphaned flag must be read before the final drain to ensure we see everything the thread wrote
+        const bool isOrphaned = buffer->IsOrphaned.load(std::memory_order_acquire);
+        buffer->Drain(m_scratchpad,
+                      [this](const RecordHeader& header, const std::vector<char>& text)
+                      {
+                        m_pendingRecords.emplace_back(header.SequenceNumber, static_cast<LogType>(header.LogType), m_pendingText.size(), text.size());
+                        m_pendingText.insert(m_pendingText.end(), text.begin(), text.end());
+                      });
+        hasOrphanedBuffers |= isOrphaned;
+      }
+      if (hasOrphanedBuffers)
+      {
+        RetireOrphanedBuffers();
+      }
+      m_writerBuffers.clear();
+
+      std::sort(m_pendingRecords.begin(), m_pendingRecords.end(),
+                [](const PendingRecord& lhs, const PendingRecord& rhs) { return lhs.SequenceNumber < rhs.SequenceNumber; });
+
+      m_output.clear();
+      const uint64_t droppedMessages = GetStats().DroppedMessages;
+      if (droppedMessages != m_reportedDroppedMessages)
+      {
+        const std::string message(
+          fmt::format("AsyncLogSink dropped {} messages due to full buffers", droppedMessages - m_reportedDroppedMessages));
+        WriteRecord(m_output, LogType::Warning, message.data(), message.size());
+        m_reportedDroppedMessages = droppedMessages;
+      }
+      for (const auto& record : m_pendingRecords)
+      {
+        WriteRecord(m_output, record.Type, m_pendingText.data() + record.Offset, record.Length);
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_outputLock);
+        WriteOutput(m_output);
+      }
+      m_writtenMessages.fetch_add(m_pendingRecords.size(), std::memory_order_relaxed);
+    }
+
+
+    void WriteOutput(const fmt::memory_buffer& output)
+    {
+      if (output.size() > 0)
+      {
+        std::fwrite(output.data(), 1, output.size(), m_pFile);
+        std::fflush(m_pFile);
+      }
+    }
+
+
+    void WriteRecord(fmt::memory_buffer& rOutput, const LogType logType, const char* const pText, const std::size_t length)
+    {
+#ifdef __ANDROID__
+      if (!m_ownsFile)
+      {
+        auto androidLogType = ANDROID_LOG_DEBUG;
+        switch (logType)
+        {
+        case LogType::Warning:
+          androidLogType = ANDROID_LOG_WARN;
+          break;
+        case LogType::Error:
+          androidLogType = ANDROID_LOG_ERROR;
+          break;
+        default:
+          break;
+        }
+        __android_log_print(androidLogType, "FSL_LOG_TAG", "%.*s", static_cast<int>(length), pText);
+        return;
+      }
+#endif
+      AppendLine(rOutput, logType, pText, length);
+    }
+
+
+    //! @brief Remove the drained buffers of threads that have exited
+    void RetireOrphanedBuffers()
+    {
+      std::lock_guard<std::mutex> lock(m_buffersLock);
+      auto itrRemove = std::remove_if(m_buffers.begin(), m_buffers.end(),
+                                      [this](const std::shared_ptr<ThreadLogBuffer>& buffer)
+                                      {
+                                        // Only retire buffers that were orphaned before they were drained
+                                        if (!buffer->IsOrphaned.load(std::memory_order_acquire) || !buffer->IsEmpty())
+                                        {
+                                          return false;
+                                        }
+                                        m_retiredDroppedMessages += buffer->DroppedMessages.load(std::memory_order_relaxed);
+                                        m_retiredDroppedBytes += buffer->DroppedBytes.load(std::memory_order_relaxed);
+                                        return true;
+                                      });
+      m_buffers.erase(itrRemove, m_buffers.end());
+    }
+  };
+
+  bool AsyncLogSinkInternal::TryWriteLine(const LogType logType, const char* const psz) noexcept
+  {
+    // Fast path for the common case where no sink is active
+    if (g_pActiveSink.load(std::memory_order_acquire) == nullptr)
+    {
+      return false;
+    }
+
+    ActiveCallerScope scope;
+    AsyncLogSinkImpl* const pSink = g_pActiveSink.load(std::memory_order_seq_cst);
+    if (pSink == nullptr)
+    {
+      return false;
+    }
+    pSink->WriteLine(logType, psz);
+    return true;
+  }
+
+
+  bool AsyncLogSinkInternal::TryFlush() noexcept
+  {
+    // Fast path for the common case where no sink is active
+    if (g_pActiveSink.load(std::memory_order_acquire) == nullptr)
+    {
+      return false;
+    }
+
+    ActiveCallerScope scope;
+    AsyncLogSinkImpl* const pSink = g_pActiveSink.load(std::memory_order_seq_cst);
+    if (pSink == nullptr)
+    {
+      return false;
+    }
+    try
+    {
+      pSink->Flush();
+    }
+    catch (const std::exception&)
+    {
+      // The logging functionality should never kill the program
+    }
+    return true;
+  }
+
+
+  AsyncLogSink::AsyncLogSink(const AsyncLogSinkConfig& config)
+    : m_impl(std::make_unique<AsyncLogSinkImpl>(config))
+  {
+    AsyncLogSinkImpl* pExpected = nullptr;
+    if (!g_pActiveSink.compare_exchange_strong(pExpected, m_impl.get(), std::memory_order_seq_cst))
+    {
+      throw UsageErrorException("Only one AsyncLogSink can be active at a time");
+    }
+  }
+
+
+  AsyncLogSink::~AsyncLogSink() noexcept
+  {
+    // Uninstall the sink and wait for the threads that might still be using it to leave, new messages are written synchronously
+    g_pActiveSink.store(nullptr, std::memory_order_seq_cst);
+    while (g_activeCallers.load(std::memory_order_seq_cst) != 0u)
+    {
+      std::this_thread::yield();
+    }
+    // Destroying the impl writes the remaining messages
+    m_impl.reset();
+  }
+
+
+  void AsyncLogSink::Flush()
+  {
+    m_impl->Flush();
+  }
+
+
+  AsyncLogSinkStats AsyncLogSink::GetStats() const
+  {
+    return m_impl->GetStats();
+  }
+}
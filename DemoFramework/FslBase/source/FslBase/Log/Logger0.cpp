@@ -34,8 +34,10 @@
 
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/Log/Logger0.hpp>
+#include <cstdio>
 #include <exception>
 #include <iterator>
+#include "AsyncLogSinkInternal.hpp"
 
 #ifdef __ANDROID__
 #include <android/log.h>
@@ -119,6 +121,11 @@ namespace Fsl
           return;
         }
 
+        if (AsyncLogSinkInternal::TryWriteLine(logType, psz))
+        {
+          return;
+        }
+
 #ifdef __ANDROID__
         auto androidLogType = ANDROID_LOG_DEBUG;
         switch (logType)
@@ -165,6 +172,11 @@ namespace Fsl
           return;
         }
 
+        if (AsyncLogSinkInternal::TryWriteLine(logType, psz))
+        {
+          return;
+        }
+
 #ifdef __ANDROID__
         auto androidLogType = ANDROID_LOG_DEBUG;
         switch (logType)
@@ -200,5 +212,16 @@ namespace Fsl
         /// the logging functionality should never kill the program
       }
     }
+
+
+    void Flush() noexcept
+    {
+      if (!AsyncLogSinkInternal::TryFlush())
+      {
+#if !defined(__ANDROID__) && !defined(FSL_PLATFORM_FREERTOS)
+        std::fflush(stdout);
+#endif
+      }
+    }
   }
 }
@@ -38,6 +38,7 @@ SOFTWARE.
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include "SimdFloat4.hpp"
 
 namespace Fsl
 {
@@ -64,6 +65,18 @@ namespace Fsl
     }
 
 
+#ifdef FSLBASE_MATH_SIMD
+    //! @brief Normalize the plane stored as (normal.x, normal.y, normal.z, d) the same way as the scalar NormalizePlane
+    Plane NormalizePlane(const SimdFloat4::Value plane)
+    {
+      using namespace SimdFloat4;
+      const Value squared = Mul(plane, plane);
+      const float length = std::sqrt(GetX(Add(Add(squared, SplatLane<1>(squared)), SplatLane<2>(squared))));
+      float normalized[4];    // NOLINT(modernize-avoid-c-arrays)
+      Store(normalized, Mul(plane, Splat(1.0f / length)));
+      return {normalized[0], normalized[1], normalized[2], normalized[3]};
+    }
+#else
     void NormalizePlane(Plane& rPlane)
     {
       float factor = 1.0f / rPlane.Normal.Length();
@@ -72,6 +85,7 @@ namespace Fsl
       rPlane.Normal.Z *= factor;
       rPlane.D *= factor;
     }
+#endif
   }
 
 
@@ -336,7 +350,23 @@ namespace Fsl
   void BoundingFrustum::CreatePlanes()
   {
     const float* mat = m_matrix.DirectAccess();
-
+#ifdef FSLBASE_MATH_SIMD
+    // Each plane is a combination of the matrix columns, so transpose the rows to get the columns
+    using namespace SimdFloat4;
+    Value column0 = Load(mat);
+    Value column1 = Load(mat + 4);
+    Value column2 = Load(mat + 8);
+    Value column3 = Load(mat + 12);
+    Transpose(column0, column1, column2, column3);
+    const Value negatedColumn3 = Mul(column3, Splat(-1.0f));
+
+    m_planes[0] = NormalizePlane(Mul(column2, Splat(-1.0f)));
+    m_planes[1] = NormalizePlane(Sub(column2, column3));
+    m_planes[2] = NormalizePlane(Sub(negatedColumn3, column0));
+    m_planes[3] = NormalizePlane(Sub(column0, column3));
+    m_planes[4] = NormalizePlane(Sub(column1, column3));
+    m_planes[5] = NormalizePlane(Sub(negatedColumn3, column1));
+#else
     m_planes[0] = Plane(-mat[_M13], -mat[_M23], -mat[_M33], -mat[_M43]);
     m_planes[1] = Plane(mat[_M13] - mat[_M14], mat[_M23] - mat[_M24], mat[_M33] - mat[_M34], mat[_M43] - mat[_M44]);
     m_planes[2] = Plane(-mat[_M14] - mat[_M11], -mat[_M24] - mat[_M21], -mat[_M34] - mat[_M31], -mat[_M44] - mat[_M41]);
@@ -350,5 +380,6 @@ namespace Fsl
     NormalizePlane(m_planes[3]);
     NormalizePlane(m_planes[4]);
     NormalizePlane(m_planes[5]);
+#endif
   }
 }
@@ -0,0 +1,360 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/FrustumCullUtil.hpp>
+#include <FslBase/Math/Plane.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include "SimdFloat4.hpp"
+
+namespace Fsl::FrustumCullUtil
+{
+  namespace
+  {
+    static_assert(GroupSize == 4, "the group size must match the SIMD lane count");
+
+    constexpr std::size_t PlaneCount = BoundingFrustum::PlaneCount;
+
+    using PlaneArray = std::array<Plane, PlaneCount>;
+
+    PlaneArray GetPlanes(const BoundingFrustum& frustum)
+    {
+      return {frustum.Near(), frustum.Far(), frustum.Left(), frustum.Right(), frustum.Top(), frustum.Bottom()};
+    }
+
+#ifdef FSLBASE_MATH_SIMD
+    struct SimdPlane
+    {
+      SimdFloat4::Value NormalX;
+      SimdFloat4::Value NormalY;
+      SimdFloat4::Value NormalZ;
+      SimdFloat4::Value D;
+    };
+
+    std::array<SimdPlane, PlaneCount> ToSimdPlanes(const PlaneArray& planes) noexcept
+    {
+      std::array<SimdPlane, PlaneCount> result{};
+      for (std::size_t i = 0; i < PlaneCount; ++i)
+      {
+        result[i] = {SimdFloat4::Splat(planes[i].Normal.X), SimdFloat4::Splat(planes[i].Normal.Y), SimdFloat4::Splat(planes[i].Normal.Z),
+                     SimdFloat4::Splat(planes[i].D)};
+      }
+      return result;
+    }
+
+    //! @brief (((x * normal.X) + (y * normal.Y)) + (z * normal.Z)) + d, the same order as the scalar plane tests.
+    inline SimdFloat4::Value CalcDistance(const SimdPlane& plane, const float* const pX, const float* const pY, const float* const pZ) noexcept
+    {
+      using namespace SimdFloat4;
+      return Add(Add(Add(Mul(plane.NormalX, Load(pX)), Mul(plane.NormalY, Load(pY))), Mul(plane.NormalZ, Load(pZ))), plane.D);
+    }
+#endif
+
+    //! Tests four boxes at a time against a plane, matching BoundingBox::Intersects(Plane) == PlaneIntersectionType::Front.
+    class BoxTester
+    {
+      // The source of the 'negative vertex' components for each plane
+      std::array<const float*, PlaneCount> m_pX{};
+      std::array<const float*, PlaneCount> m_pY{};
+      std::array<const float*, PlaneCount> m_pZ{};
+#ifdef FSLBASE_MATH_SIMD
+      std::array<SimdPlane, PlaneCount> m_simdPlanes;
+#else
+      PlaneArray m_planes;
+#endif
+
+    public:
+      BoxTester(const PlaneArray& planes, const float* const pMinX, const float* const pMinY, const float* const pMinZ, const float* const pMaxX,
+                const float* const pMaxY, const float* const pMaxZ) noexcept
+#ifdef FSLBASE_MATH_SIMD
+        : m_simdPlanes(ToSimdPlanes(planes))
+#else
+        : m_planes(planes)
+#endif
+      {
+        for (std::size_t i = 0; i < PlaneCount; ++i)
+        {
+          m_pX[i] = planes[i].Normal.X >= 0 ? pMinX : pMaxX;
+          m_pY[i] = planes[i].Normal.Y >= 0 ? pMinY : pMaxY;
+          m_pZ[i] = planes[i].Normal.Z >= 0 ? pMinZ : pMaxZ;
+        }
+      }
+
+      //! @brief Get a bit mask of the four boxes starting at index that are completely in front of the plane.
+      uint32_t OutsideMask(const std::size_t planeIndex, const std::size_t index) const noexcept
+      {
+#ifdef FSLBASE_MATH_SIMD
+        using namespace SimdFloat4;
+        const Value distance = CalcDistance(m_simdPlanes[planeIndex], m_pX[planeIndex] + index, m_pY[planeIndex] + index, m_pZ[planeIndex] + index);
+        return ToBitMask(CompareGreater(distance, Splat(0.0f)));
+#else
+        const Plane& plane = m_planes[planeIndex];
+        uint32_t mask = 0;
+        for (std::size_t lane = 0; lane < GroupSize; ++lane)
+        {
+          const std::size_t i = index + lane;
+          const float distance =
+            plane.Normal.X * m_pX[planeIndex][i] + plane.Normal.Y * m_pY[planeIndex][i] + plane.Normal.Z * m_pZ[planeIndex][i] + plane.D;
+          mask |= distance > 0 ? (1u << lane) : 0u;
+        }
+        return mask;
+#endif
+      }
+    };
+
+    //! Tests four spheres at a time against a plane, matching BoundingSphere::Intersects(Plane) == PlaneIntersectionType::Front.
+    class SphereTester
+    {
+      const float* m_pCenterX;
+      const float* m_pCenterY;
+      const float* m_pCenterZ;
+      const float* m_pRadius;
+#ifdef FSLBASE_MATH_SIMD
+      std::array<SimdPlane, PlaneCount> m_simdPlanes;
+#else
+      PlaneArray m_planes;
+#endif
+
+    public:
+      SphereTester(const PlaneArray& planes, const float* const pCenterX, const float* const pCenterY, const float* const pCenterZ,
+                   const float* const pRadius) noexcept
+        : m_pCenterX(pCenterX)
+        , m_pCenterY(pCenterY)
+        , m_pCenterZ(pCenterZ)
+        , m_pRadius(pRadius)
+#ifdef FSLBASE_MATH_SIMD
+        , m_simdPlanes(ToSimdPlanes(planes))
+#else
+        , m_planes(planes)
+#endif
+      {
+      }
+
+      //! @brief Get a bit mask of the four spheres starting at index that are completely in front of the plane.
+      uint32_t OutsideMask(const std::size_t planeIndex, const std::size_t index) const noexcept
+      {
+#ifdef FSLBASE_MATH_SIMD
+        using namespace SimdFloat4;
+        const Value distance = CalcDistance(m_simdPlanes[planeIndex], m_pCenterX + index, m_pCenterY + index, m_pCenterZ + index);
+        return ToBitMask(CompareGreater(distance, Load(m_pRadius + index)));
+#else
+        const Plane& plane = m_planes[planeIndex];
+        uint32_t mask = 0;
+        for (std::size_t lane = 0; lane < GroupSize; ++lane)
+        {
+          const std::size_t i = index + lane;
+          const float distance =
+            (plane.Normal.X * m_pCenterX[i] + plane.Normal.Y * m_pCenterY[i] + plane.Normal.Z * m_pCenterZ[i]) + plane.D;
+          mask |= distance > m_pRadius[i] ? (1u << lane) : 0u;
+        }
+        return mask;
+#endif
+      }
+    };
+
+
+    //! @brief Cull one group, returns the visible lanes.
+    template <typename TTester>
+    uint32_t CullGroup(const TTester& tester, const std::size_t testerIndex, const uint32_t laneMask, uint8_t* const pPlaneCacheEntry)
+    {
+      // The cached plane is tested first, it swaps place with plane zero in the test order
+      const std::size_t cachedPlane = pPlaneCacheEntry != nullptr ? *pPlaneCacheEntry : InvalidPlaneIndex;
+      const std::size_t firstPlane = cachedPlane < PlaneCount ? cachedPlane : 0u;
+
+      uint32_t visible = laneMask;
+      uint8_t rejectingPlane = InvalidPlaneIndex;
+      for (std::size_t i = 0; i < PlaneCount; ++i)
+      {
+        const std::size_t planeIndex = i == 0 ? firstPlane : (i == firstPlane ? 0u : i);
+        visible &= ~tester.OutsideMask(planeIndex, testerIndex);
+        if (visible == 0u)
+        {
+          rejectingPlane = static_cast<uint8_t>(planeIndex);
+          break;
+        }
+      }
+      if (pPlaneCacheEntry != nullptr)
+      {
+        *pPlaneCacheEntry = rejectingPlane;
+      }
+      return visible;
+    }
+
+
+    //! @brief Cull all full groups with the tester, returns the visible count.
+    template <typename TTester>
+    std::size_t CullFullGroups(const TTester& tester, const std::size_t groupCount, uint8_t* const pPlaneCache, uint32_t* const pDstMask)
+    {
+      std::size_t visibleCount = 0;
+      for (std::size_t group = 0; group < groupCount; ++group)
+      {
+        const std::size_t index = group * GroupSize;
+        const uint32_t visible = CullGroup(tester, index, 0xF, pPlaneCache != nullptr ? pPlaneCache + group : nullptr);
+        pDstMask[index / 32u] |= visible << (index % 32u);
+        visibleCount += static_cast<std::size_t>(std::popcount(visible));
+      }
+      return visibleCount;
+    }
+
+
+    //! @brief Cull the last partial group using a tester that reads from padded copies of the entries, returns the visible count.
+    template <typename TTester>
+    std::size_t CullPartialGroup(const TTester& tester, const std::size_t index, const std::size_t laneCount, uint8_t* const pPlaneCacheEntry,
+                                 uint32_t* const pDstMask)
+    {
+      const uint32_t visible = CullGroup(tester, 0u, (1u << laneCount) - 1u, pPlaneCacheEntry);
+      pDstMask[index / 32u] |= visible << (index % 32u);
+      return static_cast<std::size_t>(std::popcount(visible));
+    }
+
+
+    template <std::size_t TCount>
+    std::array<float, GroupSize * TCount> CreatePaddedCopy(const std::array<const float*, TCount>& sources, const std::size_t index,
+                                                            const std::size_t laneCount)
+    {
+      std::array<float, GroupSize * TCount> result{};
+      for (std::size_t i = 0; i < TCount; ++i)
+      {
+        std::copy(sources[i] + index, sources[i] + index + laneCount, result.data() + (i * GroupSize));
+      }
+      return result;
+    }
+
+
+    void ValidateOutput(const std::size_t count, const Span<uint8_t> planeCache, const bool hasPlaneCache, const Span<uint32_t> dstVisibleMask)
+    {
+      if (hasPlaneCache && planeCache.size() != CalcPlaneCacheSize(count))
+      {
+        throw std::invalid_argument("planeCache must contain exactly CalcPlaneCacheSize entries");
+      }
+      if (dstVisibleMask.size() < CalcMaskWordCount(count))
+      {
+        throw std::invalid_argument("dstVisibleMask must contain at least CalcMaskWordCount entries");
+      }
+    }
+
+
+    std::size_t DoCull(const BoundingFrustum& frustum, const BoundingBoxSpans& boxes, Span<uint8_t> planeCache, const bool hasPlaneCache,
+                       Span<uint32_t> dstVisibleMask)
+    {
+      const std::size_t count = boxes.size();
+      if (boxes.MinY.size() != count || boxes.MinZ.size() != count || boxes.MaxX.size() != count || boxes.MaxY.size() != count ||
+          boxes.MaxZ.size() != count)
+      {
+        throw std::invalid_argument("all box spans must be of the same size");
+      }
+      ValidateOutput(count, planeCache, hasPlaneCache, dstVisibleMask);
+
+      uint32_t* const pDstMask = dstVisibleMask.data();
+      std::fill(pDstMask, pDstMask + CalcMaskWordCount(count), 0u);
+      uint8_t* const pPlaneCache = hasPlaneCache ? planeCache.data() : nullptr;
+
+      const PlaneArray planes = GetPlanes(frustum);
+      const std::size_t fullGroupCount = count / GroupSize;
+      std::size_t visibleCount = CullFullGroups(BoxTester(planes, boxes.MinX.data(), boxes.MinY.data(), boxes.MinZ.data(), boxes.MaxX.data(),
+                                                          boxes.MaxY.data(), boxes.MaxZ.data()),
+                                                fullGroupCount, pPlaneCache, pDstMask);
+
+      const std::size_t index = fullGroupCount * GroupSize;
+      if (index < count)
+      {
+        const std::array<const float*, 6> sources = {boxes.MinX.data(), boxes.MinY.data(), boxes.MinZ.data(),
+                                                     boxes.MaxX.data(), boxes.MaxY.data(), boxes.MaxZ.data()};
+        const auto padded = CreatePaddedCopy(sources, index, count - index);
+        const BoxTester tester(planes, padded.data(), padded.data() + 4, padded.data() + 8, padded.data() + 12, padded.data() + 16,
+                               padded.data() + 20);
+        visibleCount +=
+          CullPartialGroup(tester, index, count - index, pPlaneCache != nullptr ? pPlaneCache + fullGroupCount : nullptr, pDstMask);
+      }
+      return visibleCount;
+    }
+
+
+    std::size_t DoCull(const BoundingFrustum& frustum, const BoundingSphereSpans& spheres, Span<uint8_t> planeCache, const bool hasPlaneCache,
+                       Span<uint32_t> dstVisibleMask)
+    {
+      const std::size_t count = spheres.size();
+      if (spheres.CenterY.size() != count || spheres.CenterZ.size() != count || spheres.Radius.size() != count)
+      {
+        throw std::invalid_argument("all sphere spans must be of the same size");
+      }
+      ValidateOutput(count, planeCache, hasPlaneCache, dstVisibleMask);
+
+      uint32_t* const pDstMask = dstVisibleMask.data();
+      std::fill(pDstMask, pDstMask + CalcMaskWordCount(count), 0u);
+      uint8_t* const pPlaneCache = hasPlaneCache ? planeCache.data() : nullptr;
+
+      const PlaneArray planes = GetPlanes(frustum);
+      const std::size_t fullGroupCount = count / GroupSize;
+      std::size_t visibleCount =
+        CullFullGroups(SphereTester(planes, spheres.CenterX.data(), spheres.CenterY.data(), spheres.CenterZ.data(), spheres.Radius.data()),
+                       fullGroupCount, pPlaneCache, pDstMask);
+
+      const std::size_t index = fullGroupCount * GroupSize;
+      if (index < count)
+      {
+        const std::array<const float*, 4> sources = {spheres.CenterX.data(), spheres.CenterY.data(), spheres.CenterZ.data(),
+                                                     spheres.Radius.data()};
+        const auto padded = CreatePaddedCopy(sources, index, count - index);
+        const SphereTester tester(planes, padded.data(), padded.data() + 4, padded.data() + 8, padded.data() + 12);
+        visibleCount +=
+          CullPartialGroup(tester, index, count - index, pPlaneCache != nullptr ? pPlaneCache + fullGroupCount : nullptr, pDstMask);
+      }
+      return visibleCount;
+    }
+  }
+
+
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingBoxSpans& boxes, Span<uint32_t> dstVisibleMask)
+  {
+    return DoCull(frustum, boxes, {}, false, dstVisibleMask);
+  }
+
+
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingBoxSpans& boxes, Span<uint8_t> planeCache, Span<uint32_t> dstVisibleMask)
+  {
+    return DoCull(frustum, boxes, planeCache, true, dstVisibleMask);
+  }
+
+
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingSphereSpans& spheres, Span<uint32_t> dstVisibleMask)
+  {
+    return DoCull(frustum, spheres, {}, false, dstVisibleMask);
+  }
+
+
+  std::size_t Cull(const BoundingFrustum& frustum, const BoundingSphereSpans& spheres, Span<uint8_t> planeCache, Span<uint32_t> dstVisibleMask)
+  {
+    return DoCull(frustum, spheres, planeCache, true, dstVisibleMask);
+  }
+}
@@ -37,6 +37,7 @@ SOFTWARE.
 #include <cassert>
 #include <cmath>
 #include "MatrixInternals.hpp"
+#include "SimdFloat4.hpp"
 
 // Workaround a issue with qnx signbit
 using namespace std;
@@ -47,6 +48,34 @@ namespace Fsl
 
   static_assert(sizeof(Matrix) == (sizeof(float) * 4 * 4), "Matrix not of expected size");
 
+#ifdef FSLBASE_MATH_SIMD
+  namespace
+  {
+    // The 2x2 matrix helpers used by the block wise inverse, each 2x2 matrix is stored row major in one register.
+
+    //! @brief 2x2 matrix multiply lhs * rhs
+    inline SimdFloat4::Value Mat2Mul(const SimdFloat4::Value lhs, const SimdFloat4::Value rhs) noexcept
+    {
+      using namespace SimdFloat4;
+      return Add(Mul(lhs, Swizzle<0, 3, 0, 3>(rhs)), Mul(Swizzle<1, 0, 3, 2>(lhs), Swizzle<2, 1, 2, 1>(rhs)));
+    }
+
+    //! @brief 2x2 matrix adjugate multiply adj(lhs) * rhs
+    inline SimdFloat4::Value Mat2AdjMul(const SimdFloat4::Value lhs, const SimdFloat4::Value rhs) noexcept
+    {
+      using namespace SimdFloat4;
+      return Sub(Mul(Swizzle<3, 3, 0, 0>(lhs), rhs), Mul(Swizzle<1, 1, 2, 2>(lhs), Swizzle<2, 3, 0, 1>(rhs)));
+    }
+
+    //! @brief 2x2 matrix multiply adjugate lhs * adj(rhs)
+    inline SimdFloat4::Value Mat2MulAdj(const SimdFloat4::Value lhs, const SimdFloat4::Value rhs) noexcept
+    {
+      using namespace SimdFloat4;
+      return Sub(Mul(lhs, Swizzle<3, 0, 3, 0>(rhs)), Mul(Swizzle<1, 0, 3, 2>(lhs), Swizzle<2, 1, 2, 1>(rhs)));
+    }
+  }
+#endif
+
   Matrix Matrix::Add(const Matrix& matrix1, const Matrix& matrix2)
   {
     return {
@@ -1025,6 +1054,57 @@ namespace Fsl
 
   void Matrix::Invert(const Matrix& matrix, Matrix& rResult)
   {
+#ifdef FSLBASE_MATH_SIMD
+    // Block wise inverse where the matrix is split into four 2x2 matrices
+    //   | A B |
+    //   | C D |
+    // this is done in single precision so the result can differ slightly from the scalar version which uses double precision for the
+    // intermediate values.
+    using namespace SimdFloat4;
+    const Value row0 = Load(matrix.m);
+    const Value row1 = Load(matrix.m + 4);
+    const Value row2 = Load(matrix.m + 8);
+    const Value row3 = Load(matrix.m + 12);
+
+    const Value a = Shuffle<0, 1, 0, 1>(row0, row1);
+    const Value b = Shuffle<2, 3, 2, 3>(row0, row1);
+    const Value c = Shuffle<0, 1, 0, 1>(row2, row3);
+    const Value d = Shuffle<2, 3, 2, 3>(row2, row3);
+
+    // The determinants of the sub matrices (|A|, |B|, |C|, |D|)
+    const Value detSub = Sub(Mul(Shuffle<0, 2, 0, 2>(row0, row2), Shuffle<1, 3, 1, 3>(row1, row3)),
+                             Mul(Shuffle<1, 3, 1, 3>(row0, row2), Shuffle<0, 2, 0, 2>(row1, row3)));
+    const Value detA = SplatLane<0>(detSub);
+    const Value detB = SplatLane<1>(detSub);
+    const Value detC = SplatLane<2>(detSub);
+    const Value detD = SplatLane<3>(detSub);
+
+    const Value adjDMulC = Mat2AdjMul(d, c);
+    const Value adjAMulB = Mat2AdjMul(a, b);
+    // The adjugates of the blocks of the inverse
+    Value x = Sub(Mul(detD, a), Mat2Mul(b, adjDMulC));
+    Value w = Sub(Mul(detA, d), Mat2Mul(c, adjAMulB));
+    Value y = Sub(Mul(detB, c), Mat2MulAdj(d, adjAMulB));
+    Value z = Sub(Mul(detC, b), Mat2MulAdj(a, adjDMulC));
+
+    // |M| = |A| * |D| + |B| * |C| - trace(adj(A) * B * adj(D) * C)
+    const Value trace = Mul(adjAMulB, Swizzle<0, 2, 1, 3>(adjDMulC));
+    const Value traceSum2 = SimdFloat4::Add(trace, Swizzle<1, 0, 3, 2>(trace));
+    const Value traceSum = SimdFloat4::Add(traceSum2, Swizzle<2, 3, 0, 1>(traceSum2));
+    const Value detM = Sub(SimdFloat4::Add(Mul(detA, detD), Mul(detB, detC)), traceSum);
+
+    const Value rcpDetM = Div(Set(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    x = Mul(x, rcpDetM);
+    y = Mul(y, rcpDetM);
+    z = Mul(z, rcpDetM);
+    w = Mul(w, rcpDetM);
+
+    // Apply the final adjugate swizzle while storing the rows
+    Store(rResult.m, Shuffle<3, 1, 3, 1>(x, y));
+    Store(rResult.m + 4, Shuffle<2, 0, 2, 0>(x, y));
+    Store(rResult.m + 8, Shuffle<3, 1, 3, 1>(z, w));
+    Store(rResult.m + 12, Shuffle<2, 0, 2, 0>(z, w));
+#else
     const float num1 = matrix.m[_M11];
     const float num2 = matrix.m[_M12];
     const float num3 = matrix.m[_M13];
@@ -1145,6 +1225,7 @@ namespace Fsl
       static_cast<float>(static_cast<double>(num1) * static_cast<double>(num36) - static_cast<double>(num2) * static_cast<double>(num38) +
                          static_cast<double>(num3) * static_cast<double>(num39)) *
       num27;
+#endif
   }
 
 
@@ -1191,6 +1272,103 @@ namespace Fsl
     pResult[_M44] = pMatrix1[_M44] + ((pMatrix2[_M44] - pMatrix1[_M44]) * amount);
   }
 
+  void Matrix::Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& rResult)
+  {
+    // All inputs are loaded before the result is written so the matrices are allowed to alias.
+    // The products are added in the same order as the scalar code so all code paths produce the same result.
+#if defined(FSLBASE_MATH_SIMD_AVX)
+    // Calculate two result rows per instruction
+    const __m256 rhsRow0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix2.m));
+    const __m256 rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix2.m + 4));
+    const __m256 rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix2.m + 8));
+    const __m256 rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix2.m + 12));
+    const __m256 rows01 = _mm256_loadu_ps(matrix1.m);
+    const __m256 rows23 = _mm256_loadu_ps(matrix1.m + 8);
+
+    const __m256 result01 =
+      _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(rows01, rows01, 0x00), rhsRow0),
+                                                _mm256_mul_ps(_mm256_shuffle_ps(rows01, rows01, 0x55), rhsRow1)),
+                                  _mm256_mul_ps(_mm256_shuffle_ps(rows01, rows01, 0xAA), rhsRow2)),
+                    _mm256_mul_ps(_mm256_shuffle_ps(rows01, rows01, 0xFF), rhsRow3));
+    const __m256 result23 =
+      _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(rows23, rows23, 0x00), rhsRow0),
+                                                _mm256_mul_ps(_mm256_shuffle_ps(rows23, rows23, 0x55), rhsRow1)),
+                                  _mm256_mul_ps(_mm256_shuffle_ps(rows23, rows23, 0xAA), rhsRow2)),
+                    _mm256_mul_ps(_mm256_shuffle_ps(rows23, rows23, 0xFF), rhsRow3));
+    _mm256_storeu_ps(rResult.m, result01);
+    _mm256_storeu_ps(rResult.m + 8, result23);
+#elif defined(FSLBASE_MATH_SIMD)
+    using namespace SimdFloat4;
+    const Value rhsRow0 = Load(matrix2.m);
+    const Value rhsRow1 = Load(matrix2.m + 4);
+    const Value rhsRow2 = Load(matrix2.m + 8);
+    const Value rhsRow3 = Load(matrix2.m + 12);
+    const Value row0 = Load(matrix1.m);
+    const Value row1 = Load(matrix1.m + 4);
+    const Value row2 = Load(matrix1.m + 8);
+    const Value row3 = Load(matrix1.m + 12);
+
+    Store(rResult.m, TransformRow(row0, rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+    Store(rResult.m + 4, TransformRow(row1, rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+    Store(rResult.m + 8, TransformRow(row2, rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+    Store(rResult.m + 12, TransformRow(row3, rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+#else
+    const float* pMatrix1 = matrix1.m;
+    const float* pMatrix2 = matrix2.m;
+
+    const float m11 = (((pMatrix1[_M11] * pMatrix2[_M11]) + (pMatrix1[_M12] * pMatrix2[_M21])) + (pMatrix1[_M13] * pMatrix2[_M31])) +
+                      (pMatrix1[_M14] * pMatrix2[_M41]);
+    const float m12 = (((pMatrix1[_M11] * pMatrix2[_M12]) + (pMatrix1[_M12] * pMatrix2[_M22])) + (pMatrix1[_M13] * pMatrix2[_M32])) +
+                      (pMatrix1[_M14] * pMatrix2[_M42]);
+    const float m13 = (((pMatrix1[_M11] * pMatrix2[_M13]) + (pMatrix1[_M12] * pMatrix2[_M23])) + (pMatrix1[_M13] * pMatrix2[_M33])) +
+                      (pMatrix1[_M14] * pMatrix2[_M43]);
+    const float m14 = (((pMatrix1[_M11] * pMatrix2[_M14]) + (pMatrix1[_M12] * pMatrix2[_M24])) + (pMatrix1[_M13] * pMatrix2[_M34])) +
+                      (pMatrix1[_M14] * pMatrix2[_M44]);
+    const float m21 = (((pMatrix1[_M21] * pMatrix2[_M11]) + (pMatrix1[_M22] * pMatrix2[_M21])) + (pMatrix1[_M23] * pMatrix2[_M31])) +
+                      (pMatrix1[_M24] * pMatrix2[_M41]);
+    const float m22 = (((pMatrix1[_M21] * pMatrix2[_M12]) + (pMatrix1[_M22] * pMatrix2[_M22])) + (pMatrix1[_M23] * pMatrix2[_M32])) +
+                      (pMatrix1[_M24] * pMatrix2[_M42]);
+    const float m23 = (((pMatrix1[_M21] * pMatrix2[_M13]) + (pMatrix1[_M22] * pMatrix2[_M23])) + (pMatrix1[_M23] * pMatrix2[_M33])) +
+                      (pMatrix1[_M24] * pMatrix2[_M43]);
+    const float m24 = (((pMatrix1[_M21] * pMatrix2[_M14]) + (pMatrix1[_M22] * pMatrix2[_M24])) + (pMatrix1[_M23] * pMatrix2[_M34])) +
+                      (pMatrix1[_M24] * pMatrix2[_M44]);
+    const float m31 = (((pMatrix1[_M31] * pMatrix2[_M11]) + (pMatrix1[_M32] * pMatrix2[_M21])) + (pMatrix1[_M33] * pMatrix2[_M31])) +
+                      (pMatrix1[_M34] * pMatrix2[_M41]);
+    const float m32 = (((pMatrix1[_M31] * pMatrix2[_M12]) + (pMatrix1[_M32] * pMatrix2[_M22])) + (pMatrix1[_M33] * pMatrix2[_M32])) +
+                      (pMatrix1[_M34] * pMatrix2[_M42]);
+    const float m33 = (((pMatrix1[_M31] * pMatrix2[_M13]) + (pMatrix1[_M32] * pMatrix2[_M23])) + (pMatrix1[_M33] * pMatrix2[_M33])) +
+                      (pMatrix1[_M34] * pMatrix2[_M43]);
+    const float m34 = (((pMatrix1[_M31] * pMatrix2[_M14]) + (pMatrix1[_M32] * pMatrix2[_M24])) + (pMatrix1[_M33] * pMatrix2[_M34])) +
+                      (pMatrix1[_M34] * pMatrix2[_M44]);
+    const float m41 = (((pMatrix1[_M41] * pMatrix2[_M11]) + (pMatrix1[_M42] * pMatrix2[_M21])) + (pMatrix1[_M43] * pMatrix2[_M31])) +
+                      (pMatrix1[_M44] * pMatrix2[_M41]);
+    const float m42 = (((pMatrix1[_M41] * pMatrix2[_M12]) + (pMatrix1[_M42] * pMatrix2[_M22])) + (pMatrix1[_M43] * pMatrix2[_M32])) +
+                      (pMatrix1[_M44] * pMatrix2[_M42]);
+    const float m43 = (((pMatrix1[_M41] * pMatrix2[_M13]) + (pMatrix1[_M42] * pMatrix2[_M23])) + (pMatrix1[_M43] * pMatrix2[_M33])) +
+                      (pMatrix1[_M44] * pMatrix2[_M43]);
+    const float m44 = (((pMatrix1[_M41] * pMatrix2[_M14]) + (pMatrix1[_M42] * pMatrix2[_M24])) + (pMatrix1[_M43] * pMatrix2[_M34])) +
+                      (pMatrix1[_M44] * pMatrix2[_M44]);
+
+    rResult.m[_M11] = m11;
+    rResult.m[_M12] = m12;
+    rResult.m[_M13] = m13;
+    rResult.m[_M14] = m14;
+    rResult.m[_M21] = m21;
+    rResult.m[_M22] = m22;
+    rResult.m[_M23] = m23;
+    rResult.m[_M24] = m24;
+    rResult.m[_M31] = m31;
+    rResult.m[_M32] = m32;
+    rResult.m[_M33] = m33;
+    rResult.m[_M34] = m34;
+    rResult.m[_M41] = m41;
+    rResult.m[_M42] = m42;
+    rResult.m[_M43] = m43;
+    rResult.m[_M44] = m44;
+#endif
+  }
+
+
   void Matrix::Negate(const Matrix& matrix, Matrix& rResult)
   {
     rResult.m[_M11] = -matrix.m[_M11];
@@ -1349,6 +1527,13 @@ namespace Fsl
   void MatrixInternals::Transform(Vector4& rResult, const Vector4& position, const Matrix& matrix)
   {
     const float* pMatrix = matrix.DirectAccess();
+#ifdef FSLBASE_MATH_SIMD
+    using namespace SimdFloat4;
+    const Value result = TransformRow(Set(position.X, position.Y, position.Z, position.W), Load(pMatrix), Load(pMatrix + 4), Load(pMatrix + 8),
+                                      Load(pMatrix + 12));
+    static_assert(sizeof(Vector4) == (sizeof(float) * 4), "Vector4 not of expected size");
+    Store(reinterpret_cast<float*>(&rResult), result);
+#else
     // Done like this to ensure that position and rResult can be the same.
     const auto x = (position.X * pMatrix[_M11]) + (position.Y * pMatrix[_M21]) + (position.Z * pMatrix[_M31]) + (position.W * pMatrix[_M41]);
     const auto y = (position.X * pMatrix[_M12]) + (position.Y * pMatrix[_M22]) + (position.Z * pMatrix[_M32]) + (position.W * pMatrix[_M42]);
@@ -1358,5 +1543,6 @@ namespace Fsl
     rResult.Y = y;
     rResult.Z = z;
     rResult.W = w;
+#endif
   }
 }
@@ -34,11 +34,51 @@ SOFTWARE.
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include "SimdFloat4.hpp"
 
 namespace Fsl
 {
   using namespace MatrixFields;
 
+#ifdef FSLBASE_MATH_SIMD
+  namespace
+  {
+    static_assert(sizeof(Quaternion) == (sizeof(float) * 4), "Quaternion not of expected size");
+
+    inline SimdFloat4::Value LoadQuaternion(const Quaternion& value) noexcept
+    {
+      return SimdFloat4::Load(reinterpret_cast<const float*>(&value));
+    }
+
+    inline void StoreQuaternion(Quaternion& rDst, const SimdFloat4::Value value) noexcept
+    {
+      SimdFloat4::Store(reinterpret_cast<float*>(&rDst), value);
+    }
+
+    //! @brief (weight1 * quaternion1) + (weight2 * quaternion2)
+    inline SimdFloat4::Value WeightedSum(const SimdFloat4::Value quaternion1, const float weight1, const SimdFloat4::Value quaternion2,
+                                         const float weight2) noexcept
+    {
+      using namespace SimdFloat4;
+      return Add(Mul(Splat(weight1), quaternion1), Mul(Splat(weight2), quaternion2));
+    }
+
+    //! @brief Linear interpolation followed by a normalize, the dot products are calculated in the same order as the scalar code
+    inline SimdFloat4::Value SimdLerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount) noexcept
+    {
+      using namespace SimdFloat4;
+      const Value value1 = LoadQuaternion(quaternion1);
+      const Value value2 = LoadQuaternion(quaternion2);
+      const float dot = HorizontalSum(Mul(value1, value2));
+      const float weight1 = 1.0f - amount;
+      const Value lerped = dot >= 0.0f ? WeightedSum(value1, weight1, value2, amount)
+                                       : Sub(Mul(Splat(weight1), value1), Mul(Splat(amount), value2));
+      const float lengthSquared = HorizontalSum(Mul(lerped, lerped));
+      return Mul(lerped, Splat(1.0f / (static_cast<float>(std::sqrt(static_cast<double>(lengthSquared))))));
+    }
+  }
+#endif
+
   Quaternion::Quaternion(const Vector3& vectorPart, const float scalarPart)
     : X(vectorPart.X)
     , Y(vectorPart.Y)
@@ -412,6 +452,11 @@ namespace Fsl
 
   Quaternion Quaternion::Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
   {
+#ifdef FSLBASE_MATH_SIMD
+    Quaternion quaternion;
+    StoreQuaternion(quaternion, SimdLerp(quaternion1, quaternion2, amount));
+    return quaternion;
+#else
     const float num = amount;
     const float num2 = 1.0f - num;
     // Quaternion quaternion(OptimizationFlag::NoInitialization);
@@ -439,11 +484,16 @@ namespace Fsl
     quaternion.Z *= num3;
     quaternion.W *= num3;
     return quaternion;
+#endif
   }
 
 
+
   void Quaternion::Lerp(Quaternion& rResult, const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
   {
+#ifdef FSLBASE_MATH_SIMD
+    StoreQuaternion(rResult, SimdLerp(quaternion1, quaternion2, amount));
+#else
     const float num = amount;
     const float num2 = 1.0f - num;
     const float num5 =
@@ -468,16 +518,24 @@ namespace Fsl
     rResult.Y *= num3;
     rResult.Z *= num3;
     rResult.W *= num3;
+#endif
   }
 
 
+
   Quaternion Quaternion::Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
   {
     float num2 = 0.0f;
     float num3 = 0.0f;
     float num = amount;
+#ifdef FSLBASE_MATH_SIMD
+    const SimdFloat4::Value value1 = LoadQuaternion(quaternion1);
+    const SimdFloat4::Value value2 = LoadQuaternion(quaternion2);
+    float num4 = SimdFloat4::HorizontalSum(SimdFloat4::Mul(value1, value2));
+#else
     float num4 =
       (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
+#endif
     bool flag = false;
     if (num4 < 0.0f)
     {
@@ -500,10 +558,14 @@ namespace Fsl
 
     // Quaternion quaternion(OptimizationFlag::NoInitialization);
     Quaternion quaternion;
+#ifdef FSLBASE_MATH_SIMD
+    StoreQuaternion(quaternion, WeightedSum(value1, num3, value2, num2));
+#else
     quaternion.X = (num3 * quaternion1.X) + (num2 * quaternion2.X);
     quaternion.Y = (num3 * quaternion1.Y) + (num2 * quaternion2.Y);
     quaternion.Z = (num3 * quaternion1.Z) + (num2 * quaternion2.Z);
     quaternion.W = (num3 * quaternion1.W) + (num2 * quaternion2.W);
+#endif
     return quaternion;
   }
 
@@ -513,8 +575,14 @@ namespace Fsl
     float num2 = 0.0f;
     float num3 = 0.0f;
     float num = amount;
+#ifdef FSLBASE_MATH_SIMD
+    const SimdFloat4::Value value1 = LoadQuaternion(quaternion1);
+    const SimdFloat4::Value value2 = LoadQuaternion(quaternion2);
+    float num4 = SimdFloat4::HorizontalSum(SimdFloat4::Mul(value1, value2));
+#else
     float num4 =
       (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
+#endif
     bool flag = false;
     if (num4 < 0.0f)
     {
@@ -534,10 +602,14 @@ namespace Fsl
       num2 = flag ? ((static_cast<float>(-std::sin(static_cast<double>(num * num5)))) * num6)
                   : ((static_cast<float>(std::sin(static_cast<double>(num * num5)))) * num6);
     }
+#ifdef FSLBASE_MATH_SIMD
+    StoreQuaternion(rResult, WeightedSum(value1, num3, value2, num2));
+#else
     rResult.X = (num3 * quaternion1.X) + (num2 * quaternion2.X);
     rResult.Y = (num3 * quaternion1.Y) + (num2 * quaternion2.Y);
     rResult.Z = (num3 * quaternion1.Z) + (num2 * quaternion2.Z);
     rResult.W = (num3 * quaternion1.W) + (num2 * quaternion2.W);
+#endif
   }
 
 
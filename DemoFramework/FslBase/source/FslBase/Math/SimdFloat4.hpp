@@ -0,0 +1,323 @@
+#ifndef FSLBASE_MATH_SIMDFLOAT4_HPP
+#define FSLBASE_MATH_SIMDFLOAT4_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+// Internal helper that wraps the few 4 x float SIMD operations needed by the math code.
+// The instruction set is selected at compile time:
+// - x86/x64: SSE2 (always available on x64), AVX is used for a few wider kernels when the compiler targets it (-mavx, /arch:AVX).
+// - ARM: NEON (ARMv7 + NEON and AArch64).
+// Define FSL_MATH_SIMD_DISABLED to force the scalar code paths.
+
+#include <cstdint>
+
+#if !defined(FSL_MATH_SIMD_DISABLED)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FSLBASE_MATH_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define FSLBASE_MATH_SIMD_AVX
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON)
+#define FSLBASE_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(FSLBASE_MATH_SIMD_SSE2) || defined(FSLBASE_MATH_SIMD_NEON)
+#define FSLBASE_MATH_SIMD
+
+namespace Fsl::SimdFloat4
+{
+#if defined(FSLBASE_MATH_SIMD_SSE2)
+  using Value = __m128;
+
+  inline Value Load(const float* const pSrc) noexcept
+  {
+    return _mm_loadu_ps(pSrc);
+  }
+
+  //! @brief Load three floats, the last lane is set to zero.
+  inline Value Load3(const float* const pSrc) noexcept
+  {
+    return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(pSrc))), _mm_load_ss(pSrc + 2));
+  }
+
+  inline void Store(float* const pDst, const Value value) noexcept
+  {
+    _mm_storeu_ps(pDst, value);
+  }
+
+  //! @brief Store the first three lanes.
+  inline void Store3(float* const pDst, const Value value) noexcept
+  {
+    _mm_store_sd(reinterpret_cast<double*>(pDst), _mm_castps_pd(value));
+    _mm_store_ss(pDst + 2, _mm_movehl_ps(value, value));
+  }
+
+  inline Value Set(const float x, const float y, const float z, const float w) noexcept
+  {
+    return _mm_setr_ps(x, y, z, w);
+  }
+
+  inline Value Splat(const float value) noexcept
+  {
+    return _mm_set1_ps(value);
+  }
+
+  inline float GetX(const Value value) noexcept
+  {
+    return _mm_cvtss_f32(value);
+  }
+
+  inline Value Add(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_add_ps(lhs, rhs);
+  }
+
+  inline Value Sub(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_sub_ps(lhs, rhs);
+  }
+
+  inline Value Mul(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_mul_ps(lhs, rhs);
+  }
+
+  inline Value Div(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_div_ps(lhs, rhs);
+  }
+
+  //! @brief Per lane lhs > rhs, a lane is all ones if true and zero if false.
+  inline Value CompareGreater(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_cmpgt_ps(lhs, rhs);
+  }
+
+  //! @brief Convert a compare result to a bit mask, bit n is set if lane n is true.
+  inline uint32_t ToBitMask(const Value compareResult) noexcept
+  {
+    return static_cast<uint32_t>(_mm_movemask_ps(compareResult));
+  }
+
+  //! @brief Same semantics as _mm_shuffle_ps: lane 0 and 1 are taken from lhs, lane 2 and 3 from rhs.
+  template <int TI0, int TI1, int TI2, int TI3>
+  inline Value Shuffle(const Value lhs, const Value rhs) noexcept
+  {
+    return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(TI3, TI2, TI1, TI0));
+  }
+
+  inline void Transpose(Value& rRow0, Value& rRow1, Value& rRow2, Value& rRow3) noexcept
+  {
+    _MM_TRANSPOSE4_PS(rRow0, rRow1, rRow2, rRow3);
+  }
+
+  //! @brief Load four packed xyz entries (12 floats) and deinterleave them into one value per component.
+  inline void LoadDeinterleave3(const float* const pSrc, Value& rX, Value& rY, Value& rZ) noexcept
+  {
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    const Value a = _mm_loadu_ps(pSrc);
+    const Value b = _mm_loadu_ps(pSrc + 4);
+    const Value c = _mm_loadu_ps(pSrc + 8);
+    rX = Shuffle<0, 2, 0, 2>(Shuffle<0, 0, 3, 3>(a, a), Shuffle<2, 2, 1, 1>(b, c));
+    rY = Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 0, 0>(a, b), Shuffle<3, 3, 2, 2>(b, c));
+    rZ = Shuffle<0, 2, 0, 2>(Shuffle<2, 2, 1, 1>(a, b), Shuffle<0, 0, 3, 3>(c, c));
+  }
+
+  //! @brief The inverse of LoadDeinterleave3.
+  inline void StoreInterleave3(float* const pDst, const Value x, const Value y, const Value z) noexcept
+  {
+    _mm_storeu_ps(pDst, Shuffle<0, 2, 0, 2>(Shuffle<0, 0, 0, 0>(x, y), Shuffle<0, 0, 1, 1>(z, x)));
+    _mm_storeu_ps(pDst + 4, Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 1, 1>(y, z), Shuffle<2, 2, 2, 2>(x, y)));
+    _mm_storeu_ps(pDst + 8, Shuffle<0, 2, 0, 2>(Shuffle<2, 2, 3, 3>(z, x), Shuffle<3, 3, 3, 3>(y, z)));
+  }
+#elif defined(FSLBASE_MATH_SIMD_NEON)
+  using Value = float32x4_t;
+
+  inline Value Load(const float* const pSrc) noexcept
+  {
+    return vld1q_f32(pSrc);
+  }
+
+  //! @brief Load three floats, the last lane is set to zero.
+  inline Value Load3(const float* const pSrc) noexcept
+  {
+    return vcombine_f32(vld1_f32(pSrc), vld1_lane_f32(pSrc + 2, vdup_n_f32(0.0f), 0));
+  }
+
+  inline void Store(float* const pDst, const Value value) noexcept
+  {
+    vst1q_f32(pDst, value);
+  }
+
+  //! @brief Store the first three lanes.
+  inline void Store3(float* const pDst, const Value value) noexcept
+  {
+    vst1_f32(pDst, vget_low_f32(value));
+    vst1q_lane_f32(pDst + 2, value, 2);
+  }
+
+  inline Value Set(const float x, const float y, const float z, const float w) noexcept
+  {
+    const float values[4] = {x, y, z, w};    // NOLINT(modernize-avoid-c-arrays)
+    return vld1q_f32(values);
+  }
+
+  inline Value Splat(const float value) noexcept
+  {
+    return vdupq_n_f32(value);
+  }
+
+  inline float GetX(const Value value) noexcept
+  {
+    return vgetq_lane_f32(value, 0);
+  }
+
+  inline Value Add(const Value lhs, const Value rhs) noexcept
+  {
+    return vaddq_f32(lhs, rhs);
+  }
+
+  inline Value Sub(const Value lhs, const Value rhs) noexcept
+  {
+    return vsubq_f32(lhs, rhs);
+  }
+
+  inline Value Mul(const Value lhs, const Value rhs) noexcept
+  {
+    // vmulq + vaddq instead of vmlaq so the rounding matches the scalar code
+    return vmulq_f32(lhs, rhs);
+  }
+
+  inline Value Div(const Value lhs, const Value rhs) noexcept
+  {
+#if defined(__aarch64__)
+    return vdivq_f32(lhs, rhs);
+#else
+    // ARMv7 NEON has no divide instruction
+    return Set(vgetq_lane_f32(lhs, 0) / vgetq_lane_f32(rhs, 0), vgetq_lane_f32(lhs, 1) / vgetq_lane_f32(rhs, 1),
+               vgetq_lane_f32(lhs, 2) / vgetq_lane_f32(rhs, 2), vgetq_lane_f32(lhs, 3) / vgetq_lane_f32(rhs, 3));
+#endif
+  }
+
+  //! @brief Per lane lhs > rhs, a lane is all ones if true and zero if false.
+  inline Value CompareGreater(const Value lhs, const Value rhs) noexcept
+  {
+    return vreinterpretq_f32_u32(vcgtq_f32(lhs, rhs));
+  }
+
+  //! @brief Convert a compare result to a bit mask, bit n is set if lane n is true.
+  inline uint32_t ToBitMask(const Value compareResult) noexcept
+  {
+    const uint32_t weights[4] = {1u, 2u, 4u, 8u};    // NOLINT(modernize-avoid-c-arrays)
+    const uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(compareResult), vld1q_u32(weights));
+#if defined(__aarch64__)
+    return vaddvq_u32(bits);
+#else
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+    return vget_lane_u32(sum, 0);
+#endif
+  }
+
+  //! @brief Same semantics as _mm_shuffle_ps: lane 0 and 1 are taken from lhs, lane 2 and 3 from rhs.
+  template <int TI0, int TI1, int TI2, int TI3>
+  inline Value Shuffle(const Value lhs, const Value rhs) noexcept
+  {
+    Value result = vmovq_n_f32(vgetq_lane_f32(lhs, TI0));
+    result = vsetq_lane_f32(vgetq_lane_f32(lhs, TI1), result, 1);
+    result = vsetq_lane_f32(vgetq_lane_f32(rhs, TI2), result, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(rhs, TI3), result, 3);
+  }
+
+  inline void Transpose(Value& rRow0, Value& rRow1, Value& rRow2, Value& rRow3) noexcept
+  {
+    const float32x4x2_t row01 = vtrnq_f32(rRow0, rRow1);
+    const float32x4x2_t row23 = vtrnq_f32(rRow2, rRow3);
+    rRow0 = vcombine_f32(vget_low_f32(row01.val[0]), vget_low_f32(row23.val[0]));
+    rRow1 = vcombine_f32(vget_low_f32(row01.val[1]), vget_low_f32(row23.val[1]));
+    rRow2 = vcombine_f32(vget_high_f32(row01.val[0]), vget_high_f32(row23.val[0]));
+    rRow3 = vcombine_f32(vget_high_f32(row01.val[1]), vget_high_f32(row23.val[1]));
+  }
+
+  //! @brief Load four packed xyz entries (12 floats) and deinterleave them into one value per component.
+  inline void LoadDeinterleave3(const float* const pSrc, Value& rX, Value& rY, Value& rZ) noexcept
+  {
+    const float32x4x3_t values = vld3q_f32(pSrc);
+    rX = values.val[0];
+    rY = values.val[1];
+    rZ = values.val[2];
+  }
+
+  //! @brief The inverse of LoadDeinterleave3.
+  inline void StoreInterleave3(float* const pDst, const Value x, const Value y, const Value z) noexcept
+  {
+    float32x4x3_t values;
+    values.val[0] = x;
+    values.val[1] = y;
+    values.val[2] = z;
+    vst3q_f32(pDst, values);
+  }
+#endif
+
+  template <int TI0, int TI1, int TI2, int TI3>
+  inline Value Swizzle(const Value value) noexcept
+  {
+    return Shuffle<TI0, TI1, TI2, TI3>(value, value);
+  }
+
+  template <int TLane>
+  inline Value SplatLane(const Value value) noexcept
+  {
+    return Shuffle<TLane, TLane, TLane, TLane>(value, value);
+  }
+
+  //! @brief Calculate row * matrix for a matrix stored as four rows, the additions are done in the same order as the scalar code.
+  inline Value TransformRow(const Value row, const Value matrixRow0, const Value matrixRow1, const Value matrixRow2, const Value matrixRow3) noexcept
+  {
+    const Value xy = Add(Mul(SplatLane<0>(row), matrixRow0), Mul(SplatLane<1>(row), matrixRow1));
+    return Add(Add(xy, Mul(SplatLane<2>(row), matrixRow2)), Mul(SplatLane<3>(row), matrixRow3));
+  }
+
+  //! @brief The sum of the four lanes calculated as ((x + y) + z) + w to match the scalar code.
+  inline float HorizontalSum(const Value value) noexcept
+  {
+    const Value sumXY = Add(value, SplatLane<1>(value));
+    const Value sumXYZ = Add(sumXY, SplatLane<2>(value));
+    return GetX(Add(sumXYZ, SplatLane<3>(value)));
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,260 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/TransformUtil.hpp>
+#include <stdexcept>
+#include "MatrixInternals.hpp"
+#include "SimdFloat4.hpp"
+
+namespace Fsl::TransformUtil
+{
+  namespace
+  {
+    static_assert(sizeof(Vector3) == (sizeof(float) * 3), "Vector3 not of expected size");
+    static_assert(sizeof(Vector4) == (sizeof(float) * 4), "Vector4 not of expected size");
+
+#ifdef FSLBASE_MATH_SIMD
+    struct MatrixRows
+    {
+      SimdFloat4::Value Row0;
+      SimdFloat4::Value Row1;
+      SimdFloat4::Value Row2;
+      SimdFloat4::Value Row3;
+
+      explicit MatrixRows(const Matrix& matrix) noexcept
+        : Row0(SimdFloat4::Load(matrix.DirectAccess()))
+        , Row1(SimdFloat4::Load(matrix.DirectAccess() + 4))
+        , Row2(SimdFloat4::Load(matrix.DirectAccess() + 8))
+        , Row3(SimdFloat4::Load(matrix.DirectAccess() + 12))
+      {
+      }
+    };
+
+    //! @brief The matrix elements splatted to all lanes, used to transform four Vector3 entries at once in structure of arrays form.
+    struct SplatMatrix
+    {
+      SimdFloat4::Value M[16];    // NOLINT(modernize-avoid-c-arrays)
+
+      explicit SplatMatrix(const Matrix& matrix) noexcept
+      {
+        const float* const pMatrix = matrix.DirectAccess();
+        for (std::size_t i = 0; i < 16u; ++i)
+        {
+          M[i] = SimdFloat4::Splat(pMatrix[i]);
+        }
+      }
+    };
+
+    //! @brief ((x * m[column]) + (y * m[4 + column])) + (z * m[8 + column]) for four entries.
+    template <std::size_t TColumn>
+    inline SimdFloat4::Value TransformLanesXYZ(const SimdFloat4::Value x, const SimdFloat4::Value y, const SimdFloat4::Value z,
+                                               const SplatMatrix& matrix) noexcept
+    {
+      using namespace SimdFloat4;
+      return Add(Add(Mul(x, matrix.M[TColumn]), Mul(y, matrix.M[4 + TColumn])), Mul(z, matrix.M[8 + TColumn]));
+    }
+
+    //! @brief ((x * row0) + (y * row1)) + (z * row2)
+    inline SimdFloat4::Value TransformXYZ(const SimdFloat4::Value value, const MatrixRows& rows) noexcept
+    {
+      using namespace SimdFloat4;
+      return Add(Add(Mul(SplatLane<0>(value), rows.Row0), Mul(SplatLane<1>(value), rows.Row1)), Mul(SplatLane<2>(value), rows.Row2));
+    }
+#endif
+
+    template <typename TSrc, typename TDst>
+    void ValidateSpans(const ReadOnlySpan<TSrc> src, const Span<TDst> dst)
+    {
+      if (dst.size() < src.size())
+      {
+        throw std::invalid_argument("dst must be at least as large as src");
+      }
+    }
+  }
+
+
+  void Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    ValidateSpans(src, dst);
+#ifdef FSLBASE_MATH_SIMD
+    using namespace SimdFloat4;
+    const auto* const pSrc = reinterpret_cast<const float*>(src.data());
+    auto* const pDst = reinterpret_cast<float*>(dst.data());
+    const std::size_t count = src.size();
+    std::size_t i = 0;
+    if (count >= 4u)
+    {
+      // Four entries per iteration, all loads happen before the stores so in place transforms work
+      const SplatMatrix splatMatrix(matrix);
+      for (; (i + 4u) <= count; i += 4u)
+      {
+        Value x;
+        Value y;
+        Value z;
+        LoadDeinterleave3(pSrc + (i * 3u), x, y, z);
+        StoreInterleave3(pDst + (i * 3u), Add(TransformLanesXYZ<0>(x, y, z, splatMatrix), splatMatrix.M[12]),
+                         Add(TransformLanesXYZ<1>(x, y, z, splatMatrix), splatMatrix.M[13]),
+                         Add(TransformLanesXYZ<2>(x, y, z, splatMatrix), splatMatrix.M[14]));
+      }
+    }
+    const MatrixRows rows(matrix);
+    for (; i < count; ++i)
+    {
+      Store3(pDst + (i * 3u), Add(TransformXYZ(Load3(pSrc + (i * 3u)), rows), rows.Row3));
+    }
+#else
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+      MatrixInternals::Transform(dst[i], src[i], matrix);
+    }
+#endif
+  }
+
+
+  void TransformNormal(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    ValidateSpans(src, dst);
+#ifdef FSLBASE_MATH_SIMD
+    using namespace SimdFloat4;
+    const auto* const pSrc = reinterpret_cast<const float*>(src.data());
+    auto* const pDst = reinterpret_cast<float*>(dst.data());
+    const std::size_t count = src.size();
+    std::size_t i = 0;
+    if (count >= 4u)
+    {
+      const SplatMatrix splatMatrix(matrix);
+      for (; (i + 4u) <= count; i += 4u)
+      {
+        Value x;
+        Value y;
+        Value z;
+        LoadDeinterleave3(pSrc + (i * 3u), x, y, z);
+        StoreInterleave3(pDst + (i * 3u), TransformLanesXYZ<0>(x, y, z, splatMatrix), TransformLanesXYZ<1>(x, y, z, splatMatrix),
+                         TransformLanesXYZ<2>(x, y, z, splatMatrix));
+      }
+    }
+    const MatrixRows rows(matrix);
+    for (; i < count; ++i)
+    {
+      Store3(pDst + (i * 3u), TransformXYZ(Load3(pSrc + (i * 3u)), rows));
+    }
+#else
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+      MatrixInternals::TransformNormal(dst[i], src[i], matrix);
+    }
+#endif
+  }
+
+
+  void Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector4> dst)
+  {
+    ValidateSpans(src, dst);
+#ifdef FSLBASE_MATH_SIMD
+    using namespace SimdFloat4;
+    const auto* const pSrc = reinterpret_cast<const float*>(src.data());
+    auto* const pDst = reinterpret_cast<float*>(dst.data());
+    const std::size_t count = src.size();
+    std::size_t i = 0;
+    if (count >= 4u)
+    {
+      const SplatMatrix splatMatrix(matrix);
+      for (; (i + 4u) <= count; i += 4u)
+      {
+        Value x;
+        Value y;
+        Value z;
+        LoadDeinterleave3(pSrc + (i * 3u), x, y, z);
+        Value resultX = Add(TransformLanesXYZ<0>(x, y, z, splatMatrix), splatMatrix.M[12]);
+        Value resultY = Add(TransformLanesXYZ<1>(x, y, z, splatMatrix), splatMatrix.M[13]);
+        Value resultZ = Add(TransformLanesXYZ<2>(x, y, z, splatMatrix), splatMatrix.M[14]);
+        Value resultW = Add(TransformLanesXYZ<3>(x, y, z, splatMatrix), splatMatrix.M[15]);
+        Transpose(resultX, resultY, resultZ, resultW);
+        Store(pDst + (i * 4u), resultX);
+        Store(pDst + ((i + 1u) * 4u), resultY);
+        Store(pDst + ((i + 2u) * 4u), resultZ);
+        Store(pDst + ((i + 3u) * 4u), resultW);
+      }
+    }
+    const MatrixRows rows(matrix);
+    for (; i < count; ++i)
+    {
+      Store(pDst + (i * 4u), Add(TransformXYZ(Load3(pSrc + (i * 3u)), rows), rows.Row3));
+    }
+#else
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+      MatrixInternals::Transform(dst[i], src[i], matrix);
+    }
+#endif
+  }
+
+
+  void Transform(const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst)
+  {
+    ValidateSpans(src, dst);
+#ifdef FSLBASE_MATH_SIMD
+    using namespace SimdFloat4;
+    const auto* const pSrc = reinterpret_cast<const float*>(src.data());
+    auto* const pDst = reinterpret_cast<float*>(dst.data());
+    const std::size_t count = src.size();
+    std::size_t i = 0;
+#ifdef FSLBASE_MATH_SIMD_AVX
+    {
+      // Transform two vectors per iteration
+      const float* const pMatrix = matrix.DirectAccess();
+      const __m256 row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pMatrix));
+      const __m256 row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pMatrix + 4));
+      const __m256 row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pMatrix + 8));
+      const __m256 row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pMatrix + 12));
+      for (; (i + 2u) <= count; i += 2u)
+      {
+        const __m256 value = _mm256_loadu_ps(pSrc + (i * 4u));
+        const __m256 xy = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(value, value, 0x00), row0),
+                                        _mm256_mul_ps(_mm256_shuffle_ps(value, value, 0x55), row1));
+        const __m256 xyz = _mm256_add_ps(xy, _mm256_mul_ps(_mm256_shuffle_ps(value, value, 0xAA), row2));
+        _mm256_storeu_ps(pDst + (i * 4u), _mm256_add_ps(xyz, _mm256_mul_ps(_mm256_shuffle_ps(value, value, 0xFF), row3)));
+      }
+    }
+#endif
+    const MatrixRows rows(matrix);
+    for (; i < count; ++i)
+    {
+      Store(pDst + (i * 4u), TransformRow(Load(pSrc + (i * 4u)), rows.Row0, rows.Row1, rows.Row2, rows.Row3));
+    }
+#else
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+      MatrixInternals::Transform(dst[i], src[i], matrix);
+    }
+#endif
+  }
+}
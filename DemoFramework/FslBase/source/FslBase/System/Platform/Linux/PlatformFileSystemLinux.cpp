@@ -34,12 +34,25 @@
 #include <FslBase/IO/PathDeque.hpp>
 #include <FslBase/System/Platform/PlatformFileSystem.hpp>
 #include <dirent.h>
+#include <fcntl.h>
 #include <fmt/format.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include <cerrno>
 #include <cstring>
+#include <limits>
 #include <utility>
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <algorithm>
+#include <array>
+#include <set>
+#include <unordered_map>
+#define LOCAL_FSLBASE_INOTIFY_SUPPORTED
+#endif
 
 namespace Fsl::IO
 {
@@ -83,8 +96,224 @@ namespace Fsl::IO
   };
 
 
+  class PlatformFileMappingToken
+  {
+  public:
+    const void* const pContent;
+    const std::size_t ByteSize;
+
+    PlatformFileMappingToken(const PlatformFileMappingToken&) = delete;
+    PlatformFileMappingToken& operator=(const PlatformFileMappingToken&) = delete;
+
+    PlatformFileMappingToken(const void* const pMappedContent, const std::size_t byteSize) noexcept
+      : pContent(pMappedContent)
+      , ByteSize(byteSize)
+    {
+    }
+
+    ~PlatformFileMappingToken()
+    {
+      munmap(const_cast<void*>(pContent), ByteSize);
+    }
+  };
+
+
+#ifdef LOCAL_FSLBASE_INOTIFY_SUPPORTED
+  class PlatformDirectoryMonitorToken
+  {
+  public:
+    Path FullPath;
+    bool Recursive;
+    int Fd;
+    //! The watched directories (inotify watch descriptor -> directory path)
+    std::unordered_map<int, Path> Directories;
+
+    PlatformDirectoryMonitorToken(Path fullPath, const bool recursive, const int fd)
+      : FullPath(std::move(fullPath))
+      , Recursive(recursive)
+      , Fd(fd)
+    {
+    }
+
+    ~PlatformDirectoryMonitorToken()
+    {
+      close(Fd);
+    }
+
+    PlatformDirectoryMonitorToken(const PlatformDirectoryMonitorToken&) = delete;
+    PlatformDirectoryMonitorToken& operator=(const PlatformDirectoryMonitorToken&) = delete;
+  };
+#else
+  class PlatformDirectoryMonitorToken
+  {
+  };
+#endif
+
+
   namespace
   {
+#ifdef LOCAL_FSLBASE_INOTIFY_SUPPORTED
+    namespace LocalConfig
+    {
+      constexpr uint32_t WatchMask = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF |
+                                     IN_MOVE_SELF | IN_ONLYDIR;
+
+      //! Once a event has been received we keep collecting events until nothing has been received for this long
+      constexpr std::chrono::milliseconds CoalesceQuietPeriod(50);
+      //! The max time we spend coalescing events, this prevents a file that is continuously written from stalling the reporting
+      constexpr std::chrono::milliseconds CoalesceMaxTime(500);
+
+      constexpr std::size_t EventBufferSize = 16 * 1024;
+    }
+
+    using ChangeSet = std::set<Path>;
+
+
+    //! @brief Add a watch to the directory and if recursive all its sub directories
+    //! @param pFoundFiles if not null all files found in the directories are added to it (used for directories created after the monitoring started)
+    //! @return false if a watch could not be added
+    bool TryAddDirectoryWatch(PlatformDirectoryMonitorToken& rToken, const Path& path, ChangeSet* const pFoundFiles)
+    {
+      const int wd = inotify_add_watch(rToken.Fd, path.ToUTF8String().c_str(), LocalConfig::WatchMask);
+      if (wd < 0)
+      {
+        return false;
+      }
+      // inotify returns the existing descriptor if the directory is already watched, so this also prevents us from looping forever on symlink cycles
+      if (!rToken.Directories.emplace(wd, path).second)
+      {
+        return true;
+      }
+      if (!rToken.Recursive && pFoundFiles == nullptr)
+      {
+        return true;
+      }
+
+      DIR* pDir = opendir(path.ToUTF8String().c_str());
+      if (pDir == nullptr)
+      {
+        // The directory might have been removed already
+        return true;
+      }
+      bool success = true;
+      SafeDirent* pEnt = nullptr;
+      while (success && (pEnt = readdir(pDir)) != nullptr)
+      {
+        if (std::strcmp(pEnt->d_name, ".") != 0 && std::strcmp(pEnt->d_name, "..") != 0)
+        {
+          const Path fullPath(Path::Combine(path, pEnt->d_name));
+          FileAttributes attr;
+          if (PlatformFileSystem::TryGetAttributes(fullPath, attr))
+          {
+            if (attr.HasFlag(FileAttributes::File))
+            {
+              if (pFoundFiles != nullptr)
+              {
+                pFoundFiles->insert(fullPath);
+              }
+            }
+            else if (rToken.Recursive && attr.HasFlag(FileAttributes::Directory))
+            {
+              success = TryAddDirectoryWatch(rToken, fullPath, pFoundFiles);
+            }
+          }
+        }
+      }
+      closedir(pDir);
+      return success;
+    }
+
+
+    //! @brief Remove the watches of the directory and all its sub directories (used when a directory is moved away)
+    void RemoveDirectoryWatches(PlatformDirectoryMonitorToken& rToken, const Path& path)
+    {
+      const Path pathPrefix(path.ToUTF8String() + '/');
+      for (auto itr = rToken.Directories.begin(); itr != rToken.Directories.end();)
+      {
+        if (itr->second == path || itr->second.StartsWith(pathPrefix))
+        {
+          inotify_rm_watch(rToken.Fd, itr->first);
+          itr = rToken.Directories.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+    }
+
+
+    void ProcessEvent(PlatformDirectoryMonitorToken& rToken, const inotify_event& event, ChangeSet& rChanges)
+    {
+      if ((event.mask & IN_Q_OVERFLOW) != 0u)
+      {
+        // Events were lost so we can't tell exactly what changed
+        rChanges.insert(rToken.FullPath);
+        return;
+      }
+
+      auto itr = rToken.Directories.find(event.wd);
+      if (itr == rToken.Directories.end())
+      {
+        return;
+      }
+      if ((event.mask & IN_IGNORED) != 0u)
+      {
+        // The watch was removed (directory deleted or unmounted)
+        rToken.Directories.erase(itr);
+        return;
+      }
+
+      // Copy the path as 'itr' might be invalidated below
+      Path fullPath(event.len > 0 ? Path::Combine(itr->second, event.name) : itr->second);
+      if ((event.mask & IN_ISDIR) != 0u && rToken.Recursive)
+      {
+        if ((event.mask & (IN_CREATE | IN_MOVED_TO)) != 0u)
+        {
+          // Files can be created in the new directory before the watch is added, so report everything we find in it
+          if (!TryAddDirectoryWatch(rToken, fullPath, &rChanges))
+          {
+            // We could not watch the new directory, so changes inside it will go unnoticed
+            rChanges.insert(rToken.FullPath);
+          }
+        }
+        else if ((event.mask & IN_MOVED_FROM) != 0u)
+        {
+          RemoveDirectoryWatches(rToken, fullPath);
+        }
+      }
+      rChanges.insert(std::move(fullPath));
+    }
+
+
+    void ReadEvents(PlatformDirectoryMonitorToken& rToken, ChangeSet& rChanges)
+    {
+      alignas(inotify_event) std::array<char, LocalConfig::EventBufferSize> buffer{};
+      ssize_t length = 0;
+      while ((length = read(rToken.Fd, buffer.data(), buffer.size())) > 0)
+      {
+        const char* pCurrent = buffer.data();
+        const char* const pEnd = pCurrent + length;
+        while (pCurrent < pEnd)
+        {
+          const auto* const pEvent = reinterpret_cast<const inotify_event*>(pCurrent);
+          ProcessEvent(rToken, *pEvent, rChanges);
+          pCurrent += sizeof(inotify_event) + pEvent->len;
+        }
+      }
+    }
+
+
+    //! @return true if there are events ready to be read
+    bool WaitForEvents(const PlatformDirectoryMonitorToken& token, const std::chrono::milliseconds maxWait)
+    {
+      pollfd pollEntry{token.Fd, POLLIN, 0};
+      const auto timeoutMs = static_cast<int>(std::clamp(maxWait.count(), static_cast<std::chrono::milliseconds::rep>(0),
+                                                         static_cast<std::chrono::milliseconds::rep>(std::numeric_limits<int>::max())));
+      return poll(&pollEntry, 1, timeoutMs) > 0 && (pollEntry.revents & POLLIN) != 0;
+    }
+#endif
+
     void ExtractData(FileData& rData, const Path& fullPath)
     {
       rData = FileData();
@@ -182,6 +411,108 @@ namespace Fsl::IO
   }
 
 
+  std::shared_ptr<PlatformDirectoryMonitorToken> PlatformFileSystem::CreateDirectoryMonitorToken(const Path& fullPath,
+                                                                                                const SearchOptions searchOptions)
+  {
+    if (!Path::IsPathRooted(fullPath))
+    {
+      throw std::invalid_argument("path must be rooted");
+    }
+    if (searchOptions != SearchOptions::TopDirectoryOnly && searchOptions != SearchOptions::AllDirectories)
+    {
+      throw NotSupportedException("Unknown search option");
+    }
+
+#ifdef LOCAL_FSLBASE_INOTIFY_SUPPORTED
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0)
+    {
+      return {};
+    }
+    auto result = std::make_shared<PlatformDirectoryMonitorToken>(fullPath, searchOptions == SearchOptions::AllDirectories, fd);
+    // If we fail to watch the full tree (for example due to the 'max_user_watches' limit) we let the caller fall back to polling
+    if (!TryAddDirectoryWatch(*result, fullPath, nullptr))
+    {
+      return {};
+    }
+    return result;
+#else
+    return {};
+#endif
+  }
+
+
+  bool PlatformFileSystem::WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token, std::vector<Path>& rChangedPaths,
+                                                   const std::chrono::milliseconds maxWait)
+  {
+    if (!token)
+    {
+      throw std::invalid_argument("token can not be null");
+    }
+
+#ifdef LOCAL_FSLBASE_INOTIFY_SUPPORTED
+    ChangeSet changes;
+    ReadEvents(*token, changes);
+    if (changes.empty())
+    {
+      if (!WaitForEvents(*token, maxWait))
+      {
+        return false;
+      }
+      ReadEvents(*token, changes);
+    }
+
+    // Coalesce the burst of events that typically follows the first one (editors and build tools rarely do a single write)
+    const auto coalesceEndTime = std::chrono::steady_clock::now() + LocalConfig::CoalesceMaxTime;
+    while (!changes.empty() && std::chrono::steady_clock::now() < coalesceEndTime && WaitForEvents(*token, LocalConfig::CoalesceQuietPeriod))
+    {
+      ReadEvents(*token, changes);
+    }
+
+    rChangedPaths.insert(rChangedPaths.end(), changes.begin(), changes.end());
+    return !changes.empty();
+#else
+    FSL_PARAM_NOT_USED(rChangedPaths);
+    FSL_PARAM_NOT_USED(maxWait);
+    throw NotSupportedException("WaitForDirectoryChanges not supported");
+#endif
+  }
+
+
+  std::shared_ptr<PlatformFileMappingToken> PlatformFileSystem::CreateFileMappingToken(const Path& path)
+  {
+    const int fd = open(path.ToUTF8String().c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+      return {};
+    }
+
+    SafeStat s{};
+    if (fstat(fd, &s) != 0 || !S_ISREG(s.st_mode) || s.st_size <= 0 ||
+        static_cast<uint64_t>(s.st_size) > static_cast<uint64_t>(std::numeric_limits<std::size_t>::max()))
+    {
+      close(fd);
+      return {};
+    }
+
+    const auto byteSize = static_cast<std::size_t>(s.st_size);
+    void* pContent = mmap(nullptr, byteSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (pContent == MAP_FAILED)    // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+    {
+      return {};
+    }
+    return std::make_shared<PlatformFileMappingToken>(pContent, byteSize);
+  }
+
+
+  ReadOnlySpan<uint8_t> PlatformFileSystem::GetFileMappingContent(const PlatformFileMappingToken& token) noexcept
+  {
+    return ReadOnlySpan<uint8_t>(static_cast<const uint8_t*>(token.pContent), token.ByteSize);
+  }
+
+
   void PlatformFileSystem::GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions)
   {
     rResult.clear();
@@ -80,6 +80,15 @@ namespace Fsl
     };
 
 
+    class PlatformDirectoryMonitorToken
+    {
+    };
+
+    class PlatformFileMappingToken
+    {
+    };
+
+
     namespace
     {
       void ExtractData(FileData& rData, const Path& fullPath)
@@ -165,6 +174,39 @@ namespace Fsl
     }
 
 
+    std::shared_ptr<PlatformDirectoryMonitorToken> PlatformFileSystem::CreateDirectoryMonitorToken(const Path& fullPath,
+                                                                                                  const SearchOptions /*searchOptions*/)
+    {
+      if (!Path::IsPathRooted(fullPath))
+        throw std::invalid_argument("path must be rooted");
+
+      // Not supported, so the caller falls back to polling
+      return std::shared_ptr<PlatformDirectoryMonitorToken>();
+    }
+
+
+    bool PlatformFileSystem::WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token,
+                                                     std::vector<Path>& /*rChangedPaths*/, const std::chrono::milliseconds /*maxWait*/)
+    {
+      if (!token)
+        throw std::invalid_argument("token can not be null");
+      throw NotSupportedException("WaitForDirectoryChanges not supported");
+    }
+
+
+    std::shared_ptr<PlatformFileMappingToken> PlatformFileSystem::CreateFileMappingToken(const Path& /*path*/)
+    {
+      // Not supported, so the caller falls back to reading the file
+      return std::shared_ptr<PlatformFileMappingToken>();
+    }
+
+
+    ReadOnlySpan<uint8_t> PlatformFileSystem::GetFileMappingContent(const PlatformFileMappingToken& /*token*/) noexcept
+    {
+      return {};
+    }
+
+
     void PlatformFileSystem::GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions)
     {
       rResult.clear();
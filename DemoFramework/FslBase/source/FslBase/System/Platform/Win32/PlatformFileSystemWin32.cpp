@@ -35,6 +35,7 @@
 #include <FslBase/System/Platform/PlatformFileSystem.hpp>
 #include <FslBase/System/Platform/PlatformWin32.hpp>
 #include <Windows.h>
+#include <limits>
 #include <utility>
 
 
@@ -78,6 +79,34 @@ namespace Fsl::IO
     }
   };
 
+  class PlatformDirectoryMonitorToken
+  {
+  };
+
+  class PlatformFileMappingToken
+  {
+  public:
+    const HANDLE hMapping;
+    const void* const pContent;
+    const std::size_t ByteSize;
+
+    PlatformFileMappingToken(const PlatformFileMappingToken&) = delete;
+    PlatformFileMappingToken& operator=(const PlatformFileMappingToken&) = delete;
+
+    PlatformFileMappingToken(const HANDLE hFileMapping, const void* const pMappedContent, const std::size_t byteSize) noexcept
+      : hMapping(hFileMapping)
+      , pContent(pMappedContent)
+      , ByteSize(byteSize)
+    {
+    }
+
+    ~PlatformFileMappingToken()
+    {
+      ::UnmapViewOfFile(pContent);
+      ::CloseHandle(hMapping);
+    }
+  };
+
   namespace
   {
     void ExtractData(FileData& rData, const Path& fullPath)
@@ -180,6 +209,70 @@ namespace Fsl::IO
   }
 
 
+  std::shared_ptr<PlatformDirectoryMonitorToken> PlatformFileSystem::CreateDirectoryMonitorToken(const Path& fullPath,
+                                                                                                const SearchOptions /*searchOptions*/)
+  {
+    if (!Path::IsPathRooted(fullPath))
+    {
+      throw std::invalid_argument("path must be rooted");
+    }
+    // Not implemented yet (ReadDirectoryChangesW), so the caller falls back to polling
+    return {};
+  }
+
+
+  bool PlatformFileSystem::WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token,
+                                                   std::vector<Path>& /*rChangedPaths*/, const std::chrono::milliseconds /*maxWait*/)
+  {
+    if (!token)
+    {
+      throw std::invalid_argument("token can not be null");
+    }
+    throw NotSupportedException("WaitForDirectoryChanges not supported");
+  }
+
+
+  std::shared_ptr<PlatformFileMappingToken> PlatformFileSystem::CreateFileMappingToken(const Path& path)
+  {
+    HANDLE hFile = ::CreateFileW(PlatformWin32::Widen(path.ToUTF8String()).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)    // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+    {
+      return {};
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (::GetFileSizeEx(hFile, &fileSize) == 0 || fileSize.QuadPart <= 0 ||
+        static_cast<uint64_t>(fileSize.QuadPart) > static_cast<uint64_t>(std::numeric_limits<std::size_t>::max()))
+    {
+      ::CloseHandle(hFile);
+      return {};
+    }
+
+    HANDLE hMapping = ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The mapping keeps its own reference to the file
+    ::CloseHandle(hFile);
+    if (hMapping == nullptr)
+    {
+      return {};
+    }
+
+    const void* pContent = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pContent == nullptr)
+    {
+      ::CloseHandle(hMapping);
+      return {};
+    }
+    return std::make_shared<PlatformFileMappingToken>(hMapping, pContent, static_cast<std::size_t>(fileSize.QuadPart));
+  }
+
+
+  ReadOnlySpan<uint8_t> PlatformFileSystem::GetFileMappingContent(const PlatformFileMappingToken& token) noexcept
+  {
+    return ReadOnlySpan<uint8_t>(static_cast<const uint8_t*>(token.pContent), token.ByteSize);
+  }
+
+
   void PlatformFileSystem::GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions)
   {
     rResult.clear();
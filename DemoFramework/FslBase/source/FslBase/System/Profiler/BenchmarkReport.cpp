@@ -0,0 +1,284 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/String/StringViewLiteUtil.hpp>
+#include <FslBase/System/Profiler/BenchmarkReport.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace Fsl
+{
+  namespace
+  {
+    //! Nearest rank percentile of a sorted span
+    uint64_t GetPercentile(const ReadOnlySpan<uint64_t> sortedSamples, const uint32_t percentile) noexcept
+    {
+      assert(!sortedSamples.empty());
+      assert(percentile <= 100u);
+      // rank = ceil(percentile / 100 * count), done in integer math
+      const std::size_t rank = ((static_cast<std::size_t>(percentile) * sortedSamples.size()) + 99u) / 100u;
+      return sortedSamples[std::max(rank, std::size_t(1u)) - 1u];
+    }
+
+
+    void AppendEscaped(fmt::memory_buffer& rDst, const std::string& str)
+    {
+      for (const char ch : str)
+      {
+        switch (ch)
+        {
+        case '"':
+          fmt::format_to(std::back_inserter(rDst), "\\\"");
+          break;
+        case '\\':
+          fmt::format_to(std::back_inserter(rDst), "\\\\");
+          break;
+        default:
+          if (static_cast<unsigned char>(ch) < 0x20)
+          {
+            fmt::format_to(std::back_inserter(rDst), "\\u{:04x}", static_cast<uint32_t>(ch));
+          }
+          else
+          {
+            rDst.push_back(ch);
+          }
+          break;
+        }
+      }
+    }
+
+
+    //! Write nanoseconds as microseconds with three decimals
+    void AppendMicroseconds(fmt::memory_buffer& rDst, const uint64_t nanoseconds)
+    {
+      fmt::format_to(std::back_inserter(rDst), "{}.{:03}", nanoseconds / 1000u, nanoseconds % 1000u);
+    }
+
+
+    void AppendTimeStats(fmt::memory_buffer& rDst, const BenchmarkSampleStats& stats)
+    {
+      fmt::format_to(std::back_inserter(rDst), "\"p50\":");
+      AppendMicroseconds(rDst, stats.P50);
+      fmt::format_to(std::back_inserter(rDst), ",\"p95\":");
+      AppendMicroseconds(rDst, stats.P95);
+      fmt::format_to(std::back_inserter(rDst), ",\"p99\":");
+      AppendMicroseconds(rDst, stats.P99);
+      fmt::format_to(std::back_inserter(rDst), ",\"max\":");
+      AppendMicroseconds(rDst, stats.Max);
+      fmt::format_to(std::back_inserter(rDst), ",\"mean\":{:.3f},\"total\":", stats.Mean() / 1000.0);
+      AppendMicroseconds(rDst, stats.Total);
+    }
+
+
+    void AppendCsvName(fmt::memory_buffer& rDst, const std::string& name)
+    {
+      if (name.find_first_of(",\"\n") == std::string::npos)
+      {
+        fmt::format_to(std::back_inserter(rDst), "{}", name);
+        return;
+      }
+      rDst.push_back('"');
+      for (const char ch : name)
+      {
+        if (ch == '"')
+        {
+          rDst.push_back('"');
+        }
+        rDst.push_back(ch);
+      }
+      rDst.push_back('"');
+    }
+  }
+
+
+  BenchmarkSampleStats BenchmarkReport::CalcStats(const ReadOnlySpan<uint64_t> samples)
+  {
+    if (samples.empty())
+    {
+      return {};
+    }
+    if (samples.size() > std::numeric_limits<uint32_t>::max())
+    {
+      throw std::invalid_argument("too many samples");
+    }
+
+    std::vector<uint64_t> sortedSamples(samples.begin(), samples.end());
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+
+    uint64_t total = 0;
+    for (const uint64_t sample : sortedSamples)
+    {
+      total += sample;
+    }
+    const ReadOnlySpan<uint64_t> sortedSpan = SpanUtil::AsReadOnlySpan(sortedSamples);
+    return {GetPercentile(sortedSpan, 50), GetPercentile(sortedSpan, 95), GetPercentile(sortedSpan, 99), sortedSamples.back(), total,
+            static_cast<uint32_t>(sortedSamples.size())};
+  }
+
+
+  void BenchmarkReport::Clear() noexcept
+  {
+    m_phases.clear();
+    m_allocations.clear();
+    m_frameCount = 0;
+  }
+
+
+  void BenchmarkReport::Reserve(const uint32_t frameCount)
+  {
+    m_reservedFrames = std::max(m_reservedFrames, frameCount);
+    for (PhaseRecord& rPhase : m_phases)
+    {
+      rPhase.Samples.reserve(m_reservedFrames);
+    }
+    m_allocations.reserve(m_reservedFrames);
+  }
+
+
+  void BenchmarkReport::BeginFrame()
+  {
+    ++m_frameCount;
+    for (PhaseRecord& rPhase : m_phases)
+    {
+      rPhase.Samples.push_back(0);
+    }
+    m_allocations.push_back(0);
+  }
+
+
+  void BenchmarkReport::AddPhaseTime(const StringViewLite name, const uint64_t nanoseconds)
+  {
+    if (m_frameCount == 0u)
+    {
+      throw UsageErrorException("BeginFrame must be called first");
+    }
+    auto itrFind = std::find_if(m_phases.begin(), m_phases.end(), [name](const PhaseRecord& record) { return record.Name == name; });
+    if (itrFind == m_phases.end())
+    {
+      m_phases.emplace_back(name, m_frameCount, m_reservedFrames);
+      itrFind = std::prev(m_phases.end());
+    }
+    itrFind->Samples.back() += nanoseconds;
+  }
+
+
+  void BenchmarkReport::AddAllocations(const uint64_t count)
+  {
+    if (m_frameCount == 0u)
+    {
+      throw UsageErrorException("BeginFrame must be called first");
+    }
+    m_allocations.back() += count;
+  }
+
+
+  BenchmarkSampleStats BenchmarkReport::GetPhaseStats(const StringViewLite name) const
+  {
+    auto itrFind = std::find_if(m_phases.begin(), m_phases.end(), [name](const PhaseRecord& record) { return record.Name == name; });
+    return itrFind != m_phases.end() ? CalcStats(SpanUtil::AsReadOnlySpan(itrFind->Samples)) : BenchmarkSampleStats();
+  }
+
+
+  BenchmarkSampleStats BenchmarkReport::GetAllocationStats() const
+  {
+    return CalcStats(SpanUtil::AsReadOnlySpan(m_allocations));
+  }
+
+
+  std::string BenchmarkReport::ToJson(const BenchmarkReportInfo& info) const
+  {
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "{{\n\"name\":\"");
+    AppendEscaped(buffer, info.Name);
+    fmt::format_to(std::back_inserter(buffer), "\",\n\"unit\":\"microseconds\",\n\"warmupFrames\":{},\n\"frames\":{},\n\"timestep\":",
+                   info.WarmupFrames, m_frameCount);
+    AppendMicroseconds(buffer, info.TimestepNanoseconds);
+    fmt::format_to(std::back_inserter(buffer), ",\n\"phases\":[");
+    bool isFirst = true;
+    for (const PhaseRecord& phase : m_phases)
+    {
+      fmt::format_to(std::back_inserter(buffer), "{}\n{{\"name\":\"", isFirst ? "" : ",");
+      isFirst = false;
+      AppendEscaped(buffer, phase.Name);
+      fmt::format_to(std::back_inserter(buffer), "\",");
+      AppendTimeStats(buffer, CalcStats(SpanUtil::AsReadOnlySpan(phase.Samples)));
+      buffer.push_back('}');
+    }
+    if (!m_allocationsCounted)
+    {
+      fmt::format_to(std::back_inserter(buffer), "\n],\n\"allocations\":null\n}}\n");
+      return fmt::to_string(buffer);
+    }
+    const BenchmarkSampleStats allocStats = GetAllocationStats();
+    fmt::format_to(std::back_inserter(buffer),
+                   "\n],\n\"allocations\":{{\"p50\":{},\"p95\":{},\"p99\":{},\"max\":{},\"mean\":{:.3f},\"total\":{}}}\n}}\n", allocStats.P50,
+                   allocStats.P95, allocStats.P99, allocStats.Max, allocStats.Mean(), allocStats.Total);
+    return fmt::to_string(buffer);
+  }
+
+
+  std::string BenchmarkReport::ToCsv() const
+  {
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "name,unit,p50,p95,p99,max,mean,total\n");
+    for (const PhaseRecord& phase : m_phases)
+    {
+      const BenchmarkSampleStats stats = CalcStats(SpanUtil::AsReadOnlySpan(phase.Samples));
+      AppendCsvName(buffer, phase.Name);
+      fmt::format_to(std::back_inserter(buffer), ",us,");
+      AppendMicroseconds(buffer, stats.P50);
+      buffer.push_back(',');
+      AppendMicroseconds(buffer, stats.P95);
+      buffer.push_back(',');
+      AppendMicroseconds(buffer, stats.P99);
+      buffer.push_back(',');
+      AppendMicroseconds(buffer, stats.Max);
+      fmt::format_to(std::back_inserter(buffer), ",{:.3f},", stats.Mean() / 1000.0);
+      AppendMicroseconds(buffer, stats.Total);
+      buffer.push_back('\n');
+    }
+    if (!m_allocationsCounted)
+    {
+      fmt::format_to(std::back_inserter(buffer), "allocations,count,n/a,n/a,n/a,n/a,n/a,n/a\n");
+      return fmt::to_string(buffer);
+    }
+    const BenchmarkSampleStats allocStats = GetAllocationStats();
+    fmt::format_to(std::back_inserter(buffer), "allocations,count,{},{},{},{},{:.3f},{}\n", allocStats.P50, allocStats.P95, allocStats.P99,
+                   allocStats.Max, allocStats.Mean(), allocStats.Total);
+    return fmt::to_string(buffer);
+  }
+}
@@ -0,0 +1,141 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslBase/System/Profiler/ChromeTraceUtil.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t ProcessId = 1;
+    }
+
+    void Append(fmt::memory_buffer& rDst, const StringViewLite str)
+    {
+      rDst.append(str.data(), str.data() + str.size());
+    }
+
+    void AppendEscaped(fmt::memory_buffer& rDst, const char* const psz)
+    {
+      if (psz == nullptr)
+      {
+        return;
+      }
+      for (const char* pCurrent = psz; *pCurrent != 0; ++pCurrent)
+      {
+        const char ch = *pCurrent;
+        switch (ch)
+        {
+        case '"':
+          Append(rDst, StringViewLite("\\\""));
+          break;
+        case '\\':
+          Append(rDst, StringViewLite("\\\\"));
+          break;
+        default:
+          if (static_cast<unsigned char>(ch) < 0x20)
+          {
+            fmt::format_to(std::back_inserter(rDst), "\\u{:04x}", static_cast<uint32_t>(ch));
+          }
+          else
+          {
+            rDst.push_back(ch);
+          }
+          break;
+        }
+      }
+    }
+
+    //! Write nanoseconds as microseconds with three decimals
+    void AppendMicroseconds(fmt::memory_buffer& rDst, const uint64_t nanoseconds)
+    {
+      fmt::format_to(std::back_inserter(rDst), "{}.{:03}", nanoseconds / 1000u, nanoseconds % 1000u);
+    }
+  }
+
+
+  std::string ChromeTraceUtil::ToJson(const ReadOnlySpan<ScopeProfilerEvent> events, const ReadOnlySpan<ScopeProfilerThreadInfo> threads)
+  {
+    uint64_t epoch = std::numeric_limits<uint64_t>::max();
+    for (const ScopeProfilerEvent& entry : events)
+    {
+      epoch = std::min(epoch, entry.BeginNanoseconds);
+    }
+
+    fmt::memory_buffer buffer;
+    Append(buffer, StringViewLite("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    bool isFirst = true;
+    for (const ScopeProfilerThreadInfo& thread : threads)
+    {
+      if (!isFirst)
+      {
+        buffer.push_back(',');
+      }
+      isFirst = false;
+      fmt::format_to(std::back_inserter(buffer), "\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"",
+                     LocalConfig::ProcessId, thread.ThreadId);
+      AppendEscaped(buffer, thread.Name.c_str());
+      Append(buffer, StringViewLite("\"}}"));
+    }
+
+    for (const ScopeProfilerEvent& entry : events)
+    {
+      if (!isFirst)
+      {
+        buffer.push_back(',');
+      }
+      isFirst = false;
+      Append(buffer, StringViewLite("\n{\"name\":\""));
+      AppendEscaped(buffer, entry.pszName);
+      Append(buffer, StringViewLite("\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":"));
+      AppendMicroseconds(buffer, entry.BeginNanoseconds - epoch);
+      Append(buffer, StringViewLite(",\"dur\":"));
+      AppendMicroseconds(buffer, entry.DurationNanoseconds());
+      fmt::format_to(std::back_inserter(buffer), ",\"pid\":{},\"tid\":{}}}", LocalConfig::ProcessId, entry.ThreadId);
+    }
+    Append(buffer, StringViewLite("\n]}\n"));
+    return fmt::to_string(buffer);
+  }
+
+
+  void ChromeTraceUtil::Save(const IO::Path& path, const ReadOnlySpan<ScopeProfilerEvent> events, const ReadOnlySpan<ScopeProfilerThreadInfo> threads)
+  {
+    IO::File::WriteAllText(path, ToJson(events, threads));
+  }
+}
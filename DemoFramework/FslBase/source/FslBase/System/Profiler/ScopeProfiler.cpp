@@ -0,0 +1,541 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/HighResolutionTimer.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr std::size_t CacheLineSize = 64;
+      constexpr uint64_t NanosecondsPerSecond = 1000000000;
+    }
+
+    static_assert((ScopeProfiler::EventsPerThread % ScopeProfiler::EventsPerBlock) == 0, "EventsPerThread must be a multiple of EventsPerBlock");
+
+    enum class DrainMode
+    {
+      //! The consumer event vectors grow as needed (this can throw)
+      Grow,
+      //! The zones are only stored in the capacity the consumer event vectors already have, the rest are counted as dropped
+      Preallocated
+    };
+
+    struct RawZone
+    {
+      const char* pszName{nullptr};
+      uint64_t BeginNanoseconds{0};
+      uint64_t EndNanoseconds{0};
+      uint32_t Depth{0};
+    };
+
+
+    struct ZoneBlock
+    {
+      std::array<RawZone, ScopeProfiler::EventsPerBlock> Zones;
+      std::atomic<ZoneBlock*> pNext{nullptr};
+    };
+
+
+    //! @brief A single producer (the recording thread), single consumer (the collector) queue of zones.
+    //!        The zones are stored in a linked list of blocks, the producer appends a block when the last one is full and the consumer
+    //!        releases a block once it has been drained. One drained block is kept as a spare so a steady state does not allocate.
+    class ThreadZoneBuffer
+    {
+      //! Consumer only, the block that contains m_head
+      ZoneBlock* m_pHeadBlock;
+      //! Producer only, the block that contains m_tail - 1
+      ZoneBlock* m_pTailBlock;
+      std::atomic<ZoneBlock*> m_pSpareBlock{nullptr};
+      alignas(LocalConfig::CacheLineSize) std::atomic<uint64_t> m_head{0};
+      alignas(LocalConfig::CacheLineSize) std::atomic<uint64_t> m_tail{0};
+      //! Producer local copy of m_head
+      uint64_t m_cachedHead{0};
+
+    public:
+      const uint32_t ThreadId;
+      //! Producer only, the current zone nesting depth
+      uint32_t Depth{0};
+      alignas(LocalConfig::CacheLineSize) std::atomic<uint64_t> DroppedZones{0};
+      //! Set when the owning thread exits, the collector removes the buffer once it has been drained
+      std::atomic<bool> IsOrphaned{false};
+
+      ThreadZoneBuffer(const ThreadZoneBuffer&) = delete;
+      ThreadZoneBuffer& operator=(const ThreadZoneBuffer&) = delete;
+
+      explicit ThreadZoneBuffer(const uint32_t threadId)
+        : m_pHeadBlock(new ZoneBlock())
+        , m_pTailBlock(m_pHeadBlock)
+        , ThreadId(threadId)
+      {
+      }
+
+      ~ThreadZoneBuffer()
+      {
+        ZoneBlock* pBlock = m_pHeadBlock;
+        while (pBlock != nullptr)
+        {
+          ZoneBlock* pNext = pBlock->pNext.load(std::memory_order_relaxed);
+          delete pBlock;
+          pBlock = pNext;
+        }
+        delete m_pSpareBlock.load(std::memory_order_relaxed);
+      }
+
+      //! @brief Producer only
+      void TryWrite(const RawZone& zone) noexcept
+      {
+        const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        if ((tail - m_cachedHead) >= ScopeProfiler::EventsPerThread)
+        {
+          m_cachedHead = m_head.load(std::memory_order_acquire);
+          if ((tail - m_cachedHead) >= ScopeProfiler::EventsPerThread)
+          {
+            DroppedZones.fetch_add(1, std::memory_order_relaxed);
+            return;
+          }
+        }
+        const auto index = static_cast<uint32_t>(tail % ScopeProfiler::EventsPerBlock);
+        if (index == 0u && tail != 0u)
+        {
+          ZoneBlock* pNewBlock = AcquireBlock();
+          if (pNewBlock == nullptr)
+          {
+            DroppedZones.fetch_add(1, std::memory_order_relaxed);
+            return;
+          }
+          // The release store of m_tail below publishes the link to the consumer
+          m_pTailBlock->pNext.store(pNewBlock, std::memory_order_relaxed);
+          m_pTailBlock = pNewBlock;
+        }
+        m_pTailBlock->Zones[index] = zone;
+        m_tail.store(tail + 1, std::memory_order_release);
+      }
+
+      //! @brief Consumer only, calls fnZone(zone) for every available zone.
+      template <typename TFunc>
+      void Drain(TFunc fnZone)
+      {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        const uint64_t tail = m_tail.load(std::memory_order_acquire);
+        while (head != tail)
+        {
+          const auto index = static_cast<uint32_t>(head % ScopeProfiler::EventsPerBlock);
+          if (index == 0u && head != 0u)
+          {
+            // The producer has moved on to the next block, so the drained block can be released
+            ZoneBlock* pDrainedBlock = m_pHeadBlock;
+            m_pHeadBlock = pDrainedBlock->pNext.load(std::memory_order_relaxed);
+            ReleaseBlock(pDrainedBlock);
+          }
+          fnZone(m_pHeadBlock->Zones[index]);
+          ++head;
+        }
+        m_head.store(head, std::memory_order_release);
+      }
+
+    private:
+      //! @brief Producer only
+      ZoneBlock* AcquireBlock() noexcept
+      {
+        ZoneBlock* pBlock = m_pSpareBlock.exchange(nullptr, std::memory_order_acquire);
+        if (pBlock != nullptr)
+        {
+          pBlock->pNext.store(nullptr, std::memory_order_relaxed);
+          return pBlock;
+        }
+        return new (std::nothrow) ZoneBlock();
+      }
+
+      //! @brief Consumer only
+      void ReleaseBlock(ZoneBlock* const pBlock) noexcept
+      {
+        delete m_pSpareBlock.exchange(pBlock, std::memory_order_acq_rel);
+      }
+    };
+
+
+    //! A consumer receives the zones that were recorded while it was recording.
+    //! The thread buffers are drained when a consumer begins and ends recording, so each drain only hands zones to the consumers that were
+    //! recording while the zones were recorded.
+    //! A recording consumer always has room for EventsPerThread events, so ending a recording can drain without allocating.
+    struct ConsumerRecord
+    {
+      uint32_t Id{0};
+      bool IsRecording{false};
+      uint64_t BeginNanoseconds{0};
+      std::vector<ScopeProfilerEvent> Events;
+      uint64_t DroppedZones{0};
+
+      explicit ConsumerRecord(const uint32_t id) noexcept
+        : Id(id)
+      {
+      }
+
+      bool Contains(const RawZone& zone) const noexcept
+      {
+        // Zones on other threads could have been entered before recording began
+        return IsRecording && zone.BeginNanoseconds >= BeginNanoseconds;
+      }
+    };
+
+
+    struct Registry
+    {
+      std::mutex Mutex;
+      std::vector<std::shared_ptr<ThreadZoneBuffer>> Buffers;
+      std::vector<ScopeProfilerThreadInfo> Threads;
+      uint32_t NextThreadId{1};
+      std::vector<ConsumerRecord> Consumers;
+      uint32_t NextConsumerId{ScopeProfiler::DefaultConsumerId + 1};
+
+      Registry()
+      {
+        Consumers.emplace_back(ScopeProfiler::DefaultConsumerId);
+      }
+    };
+
+    Registry& GetRegistry()
+    {
+      static Registry s_registry;
+      return s_registry;
+    }
+
+
+    //! The buffer the current thread records into, it is created the first time the thread records a zone.
+    struct ThreadZoneBufferHandle
+    {
+      std::shared_ptr<ThreadZoneBuffer> Buffer;
+      std::string PendingName;
+      bool AllocationFailed{false};
+
+      ThreadZoneBufferHandle() = default;
+      ThreadZoneBufferHandle(const ThreadZoneBufferHandle&) = delete;
+      ThreadZoneBufferHandle& operator=(const ThreadZoneBufferHandle&) = delete;
+
+      ~ThreadZoneBufferHandle()
+      {
+        if (Buffer)
+        {
+          Buffer->IsOrphaned.store(true, std::memory_order_release);
+        }
+      }
+    };
+
+    thread_local ThreadZoneBufferHandle g_threadZoneBuffer;
+
+    const HighResolutionTimer g_timer;
+
+
+    ThreadZoneBuffer* TryGetThreadBuffer() noexcept
+    {
+      ThreadZoneBufferHandle& rHandle = g_threadZoneBuffer;
+      if (rHandle.Buffer || rHandle.AllocationFailed)
+      {
+        return rHandle.Buffer.get();
+      }
+      try
+      {
+        Registry& rRegistry = GetRegistry();
+        std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+        const uint32_t threadId = rRegistry.NextThreadId++;
+        auto buffer = std::make_shared<ThreadZoneBuffer>(threadId);
+        rRegistry.Threads.emplace_back(threadId, !rHandle.PendingName.empty() ? rHandle.PendingName : fmt::format("Thread {}", threadId));
+        rRegistry.Buffers.push_back(buffer);
+        rHandle.Buffer = std::move(buffer);
+      }
+      catch (const std::exception&)
+      {
+        // We are out of memory, so this thread will not record any zones
+        rHandle.AllocationFailed = true;
+      }
+      return rHandle.Buffer.get();
+    }
+
+
+    //! @brief Move the zones from all thread buffers to the consumers that want them (the registry must be locked)
+    void DrainThreadBuffers(Registry& rRegistry, const DrainMode mode)
+    {
+      auto itr = rRegistry.Buffers.begin();
+      while (itr != rRegistry.Buffers.end())
+      {
+        ThreadZoneBuffer& rBuffer = *(*itr);
+        // Read the orphaned flag before draining so no zones can be written after the drain
+        const bool isOrphaned = rBuffer.IsOrphaned.load(std::memory_order_acquire);
+        const uint32_t threadId = rBuffer.ThreadId;
+        rBuffer.Drain(
+          [&rRegistry, threadId, mode](const RawZone& zone)
+          {
+            for (ConsumerRecord& rConsumer : rRegistry.Consumers)
+            {
+              if (rConsumer.Contains(zone))
+              {
+                if (mode == DrainMode::Preallocated && rConsumer.Events.size() >= rConsumer.Events.capacity())
+                {
+                  ++rConsumer.DroppedZones;
+                }
+                else
+                {
+                  rConsumer.Events.emplace_back(zone.pszName, zone.BeginNanoseconds, zone.EndNanoseconds, threadId, zone.Depth);
+                }
+              }
+            }
+          });
+        const uint64_t droppedZones = rBuffer.DroppedZones.exchange(0, std::memory_order_relaxed);
+        if (droppedZones > 0)
+        {
+          for (ConsumerRecord& rConsumer : rRegistry.Consumers)
+          {
+            rConsumer.DroppedZones += rConsumer.IsRecording ? droppedZones : 0u;
+          }
+        }
+        itr = isOrphaned ? rRegistry.Buffers.erase(itr) : std::next(itr);
+      }
+    }
+
+
+    ConsumerRecord* TryFindConsumer(Registry& rRegistry, const uint32_t consumerId) noexcept
+    {
+      auto itrFind = std::find_if(rRegistry.Consumers.begin(), rRegistry.Consumers.end(),
+                                  [consumerId](const ConsumerRecord& record) { return record.Id == consumerId; });
+      return itrFind != rRegistry.Consumers.end() ? &(*itrFind) : nullptr;
+    }
+
+
+    ConsumerRecord& GetConsumer(Registry& rRegistry, const uint32_t consumerId)
+    {
+      ConsumerRecord* pConsumer = TryFindConsumer(rRegistry, consumerId);
+      if (pConsumer == nullptr)
+      {
+        throw std::invalid_argument(fmt::format("Unknown profiler consumer: {}", consumerId));
+      }
+      return *pConsumer;
+    }
+
+
+    //! @brief Zones are recorded as long as one consumer is recording (the registry must be locked)
+    void UpdateIsRecording(const Registry& registry) noexcept
+    {
+      const bool isRecording = std::any_of(registry.Consumers.begin(), registry.Consumers.end(),
+                                           [](const ConsumerRecord& record) { return record.IsRecording; });
+      Internal::g_scopeProfilerIsRecording.store(isRecording, std::memory_order_release);
+    }
+  }
+
+
+  void ScopeProfiler::BeginRecording()
+  {
+    BeginRecording(DefaultConsumerId);
+  }
+
+
+  void ScopeProfiler::EndRecording() noexcept
+  {
+    EndRecording(DefaultConsumerId);
+  }
+
+
+  uint64_t ScopeProfiler::Collect(std::vector<ScopeProfilerEvent>& rEvents)
+  {
+    return Collect(DefaultConsumerId, rEvents);
+  }
+
+
+  uint32_t ScopeProfiler::CreateConsumer()
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    const uint32_t consumerId = rRegistry.NextConsumerId++;
+    rRegistry.Consumers.emplace_back(consumerId);
+    return consumerId;
+  }
+
+
+  void ScopeProfiler::DestroyConsumer(const uint32_t consumerId) noexcept
+  {
+    if (consumerId == DefaultConsumerId)
+    {
+      return;
+    }
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    auto itrFind = std::find_if(rRegistry.Consumers.begin(), rRegistry.Consumers.end(),
+                                [consumerId](const ConsumerRecord& record) { return record.Id == consumerId; });
+    if (itrFind != rRegistry.Consumers.end())
+    {
+      rRegistry.Consumers.erase(itrFind);
+      UpdateIsRecording(rRegistry);
+    }
+  }
+
+
+  void ScopeProfiler::BeginRecording(const uint32_t consumerId)
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    if (GetConsumer(rRegistry, consumerId).IsRecording)
+    {
+      return;
+    }
+    // Hand out the zones of any earlier recording window before the new window starts
+    DrainThreadBuffers(rRegistry, DrainMode::Grow);
+    ConsumerRecord& rConsumer = GetConsumer(rRegistry, consumerId);
+    // Reserve the space EndRecording drains into, as it can not allocate
+    rConsumer.Events.reserve(rConsumer.Events.size() + EventsPerThread);
+    rConsumer.IsRecording = true;
+    rConsumer.BeginNanoseconds = GetTimestamp();
+    UpdateIsRecording(rRegistry);
+  }
+
+
+  void ScopeProfiler::EndRecording(const uint32_t consumerId) noexcept
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    ConsumerRecord* pConsumer = TryFindConsumer(rRegistry, consumerId);
+    if (pConsumer != nullptr && pConsumer->IsRecording)
+    {
+      // Hand out the zones recorded so far, so zones recorded after this point can not end up in the window.
+      // This only uses the capacity reserved by BeginRecording and Collect, the zones that do not fit are counted as dropped.
+      DrainThreadBuffers(rRegistry, DrainMode::Preallocated);
+      pConsumer->IsRecording = false;
+      UpdateIsRecording(rRegistry);
+    }
+  }
+
+
+  uint64_t ScopeProfiler::Collect(const uint32_t consumerId, std::vector<ScopeProfilerEvent>& rEvents)
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    GetConsumer(rRegistry, consumerId);
+    DrainThreadBuffers(rRegistry, DrainMode::Grow);
+    ConsumerRecord& rConsumer = GetConsumer(rRegistry, consumerId);
+    if (rEvents.empty())
+    {
+      rEvents.swap(rConsumer.Events);
+    }
+    else
+    {
+      rEvents.insert(rEvents.end(), rConsumer.Events.begin(), rConsumer.Events.end());
+    }
+    rConsumer.Events.clear();
+    if (rConsumer.IsRecording)
+    {
+      // The swap above can have handed the reserved space to the caller
+      rConsumer.Events.reserve(EventsPerThread);
+    }
+    const uint64_t droppedZones = rConsumer.DroppedZones;
+    rConsumer.DroppedZones = 0;
+    return droppedZones;
+  }
+
+
+  uint64_t ScopeProfiler::GetTimestamp() noexcept
+  {
+    const uint64_t ticks = g_timer.GetNativeTicks();
+    const uint64_t frequency = g_timer.GetNativeTickFrequency();
+    if (frequency == LocalConfig::NanosecondsPerSecond)
+    {
+      return ticks;
+    }
+    // Split the conversion to prevent the multiplication from overflowing
+    return ((ticks / frequency) * LocalConfig::NanosecondsPerSecond) + (((ticks % frequency) * LocalConfig::NanosecondsPerSecond) / frequency);
+  }
+
+
+  void ScopeProfiler::SetThreadName(const char* const pszName)
+  {
+    if (pszName == nullptr)
+    {
+      throw std::invalid_argument("pszName can not be null");
+    }
+    ThreadZoneBufferHandle& rHandle = g_threadZoneBuffer;
+    rHandle.PendingName = pszName;
+    if (rHandle.Buffer)
+    {
+      Registry& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+      const uint32_t threadId = rHandle.Buffer->ThreadId;
+      auto itrFind = std::find_if(rRegistry.Threads.begin(), rRegistry.Threads.end(),
+                                  [threadId](const ScopeProfilerThreadInfo& info) { return info.ThreadId == threadId; });
+      if (itrFind != rRegistry.Threads.end())
+      {
+        itrFind->Name = rHandle.PendingName;
+      }
+    }
+  }
+
+
+  std::vector<ScopeProfilerThreadInfo> ScopeProfiler::GetThreads()
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Mutex);
+    return rRegistry.Threads;
+  }
+
+
+  uint64_t ScopeProfiler::EnterZone() noexcept
+  {
+    ThreadZoneBuffer* pBuffer = TryGetThreadBuffer();
+    if (pBuffer != nullptr)
+    {
+      ++pBuffer->Depth;
+    }
+    return GetTimestamp();
+  }
+
+
+  void ScopeProfiler::LeaveZone(const char* const pszName, const uint64_t beginNanoseconds) noexcept
+  {
+    const uint64_t endNanoseconds = GetTimestamp();
+    ThreadZoneBuffer* pBuffer = g_threadZoneBuffer.Buffer.get();
+    if (pBuffer != nullptr && pBuffer->Depth > 0)
+    {
+      --pBuffer->Depth;
+      pBuffer->TryWrite(RawZone{pszName, beginNanoseconds, endNanoseconds, pBuffer->Depth});
+    }
+  }
+}
@@ -0,0 +1,293 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Profiler/ChromeTraceUtil.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <time.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint64_t NanosecondsPerSecond = 1000000000;
+      constexpr const char* RootSpanName = "Startup";
+    }
+
+#ifdef __linux__
+    //! @brief Query the process start time from the kernel and convert it to ScopeProfiler::GetTimestamp nanoseconds.
+    //!        /proc/self/stat stores the start time in clock ticks since boot, so we measure how long ago that was using CLOCK_BOOTTIME and
+    //!        subtract it from the current profiler timestamp (the profiler runs on CLOCK_MONOTONIC, the clocks advance at the same rate).
+    std::optional<uint64_t> TryGetProcessStartTimestamp()
+    {
+      std::ifstream stream("/proc/self/stat");
+      std::string content;
+      if (!std::getline(stream, content))
+      {
+        return {};
+      }
+      // The second field is the executable name in parentheses which can contain spaces, so skip past the last ')'
+      const auto commEnd = content.rfind(')');
+      if (commEnd == std::string::npos)
+      {
+        return {};
+      }
+      std::istringstream fields(content.substr(commEnd + 1));
+      // The fields following the name starts with field 3 (state), the start time is field 22
+      constexpr int StartTimeFieldIndex = 22 - 3;
+      std::string field;
+      for (int i = 0; i < StartTimeFieldIndex; ++i)
+      {
+        if (!(fields >> field))
+        {
+          return {};
+        }
+      }
+      uint64_t startTicks = 0;
+      const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+      if (!(fields >> startTicks) || ticksPerSecond <= 0)
+      {
+        return {};
+      }
+
+      timespec bootTime{};
+      const uint64_t nowTimestamp = ScopeProfiler::GetTimestamp();
+      if (clock_gettime(CLOCK_BOOTTIME, &bootTime) != 0)
+      {
+        return {};
+      }
+      const uint64_t bootNanoseconds = (static_cast<uint64_t>(bootTime.tv_sec) * LocalConfig::NanosecondsPerSecond) + bootTime.tv_nsec;
+      const auto ticks = static_cast<uint64_t>(ticksPerSecond);
+      const uint64_t startNanoseconds =
+        ((startTicks / ticks) * LocalConfig::NanosecondsPerSecond) + (((startTicks % ticks) * LocalConfig::NanosecondsPerSecond) / ticks);
+      if (startNanoseconds > bootNanoseconds || (bootNanoseconds - startNanoseconds) > nowTimestamp)
+      {
+        return {};
+      }
+      return nowTimestamp - (bootNanoseconds - startNanoseconds);
+    }
+#endif
+
+    uint64_t DetermineProcessStartTimestamp() noexcept
+    {
+#ifdef __linux__
+      try
+      {
+        const std::optional<uint64_t> timestamp = TryGetProcessStartTimestamp();
+        if (timestamp.has_value())
+        {
+          return timestamp.value();
+        }
+      }
+      catch (const std::exception&)
+      {
+      }
+#endif
+      return ScopeProfiler::GetTimestamp();
+    }
+
+
+    struct TimelineState
+    {
+      std::mutex Mutex;
+      const uint64_t ProcessStartNanoseconds;
+      uint64_t EndNanoseconds{0};
+      uint32_t NextThreadId{1};
+      std::vector<StartupTimelineEvent> Events;
+      std::vector<ScopeProfilerThreadInfo> Threads;
+
+      TimelineState()
+        : ProcessStartNanoseconds(DetermineProcessStartTimestamp())
+      {
+      }
+    };
+
+    TimelineState& GetState()
+    {
+      static TimelineState s_state;
+      return s_state;
+    }
+
+    thread_local uint32_t g_threadId = 0;
+
+
+    //! @brief Get the timeline id of the calling thread, registering it if necessary.
+    //! @note  The state mutex must be locked.
+    uint32_t GetThreadId(TimelineState& rState)
+    {
+      if (g_threadId == 0)
+      {
+        g_threadId = rState.NextThreadId++;
+        rState.Threads.emplace_back(g_threadId, fmt::format("Thread {}", g_threadId));
+      }
+      return g_threadId;
+    }
+  }
+
+
+  void StartupTimeline::BeginRecording() noexcept
+  {
+    TimelineState& rState = GetState();
+    {
+      std::lock_guard<std::mutex> lock(rState.Mutex);
+      rState.EndNanoseconds = 0;
+    }
+    Internal::g_startupTimelineIsRecording.store(true, std::memory_order_release);
+  }
+
+
+  bool StartupTimeline::EndRecording() noexcept
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    if (!Internal::g_startupTimelineIsRecording.exchange(false, std::memory_order_acq_rel))
+    {
+      return false;
+    }
+    rState.EndNanoseconds = ScopeProfiler::GetTimestamp();
+    return true;
+  }
+
+
+  void StartupTimeline::Clear()
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    rState.Events.clear();
+  }
+
+
+  uint64_t StartupTimeline::GetProcessStartTimestamp() noexcept
+  {
+    return GetState().ProcessStartNanoseconds;
+  }
+
+
+  uint64_t StartupTimeline::GetEndTimestamp() noexcept
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    return rState.EndNanoseconds;
+  }
+
+
+  void StartupTimeline::SetThreadName(std::string name)
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    const uint32_t threadId = GetThreadId(rState);
+    auto itrFind =
+      std::find_if(rState.Threads.begin(), rState.Threads.end(), [threadId](const ScopeProfilerThreadInfo& info) { return info.ThreadId == threadId; });
+    if (itrFind != rState.Threads.end())
+    {
+      itrFind->Name = std::move(name);
+    }
+  }
+
+
+  void StartupTimeline::AddEvent(std::string name, const uint64_t beginNanoseconds, const uint64_t endNanoseconds)
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    // Check while holding the lock so no span is added after EndRecording returned
+    if (IsRecording())
+    {
+      rState.Events.emplace_back(std::move(name), beginNanoseconds, std::max(beginNanoseconds, endNanoseconds), GetThreadId(rState));
+    }
+  }
+
+
+  std::vector<StartupTimelineEvent> StartupTimeline::GetEvents()
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    return rState.Events;
+  }
+
+
+  std::vector<ScopeProfilerThreadInfo> StartupTimeline::GetThreads()
+  {
+    TimelineState& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    return rState.Threads;
+  }
+
+
+  std::string StartupTimeline::ToJson()
+  {
+    std::vector<StartupTimelineEvent> events;
+    std::vector<ScopeProfilerThreadInfo> threads;
+    uint64_t processStartNanoseconds = 0;
+    uint64_t endNanoseconds = 0;
+    uint32_t rootThreadId = 0;
+    {
+      TimelineState& rState = GetState();
+      std::lock_guard<std::mutex> lock(rState.Mutex);
+      events = rState.Events;
+      processStartNanoseconds = rState.ProcessStartNanoseconds;
+      endNanoseconds = rState.EndNanoseconds != 0 ? rState.EndNanoseconds : ScopeProfiler::GetTimestamp();
+      rootThreadId = GetThreadId(rState);
+      threads = rState.Threads;
+    }
+
+    // The chrome trace exporter only needs the names while converting, so they can point into the local copy
+    std::vector<ScopeProfilerEvent> traceEvents;
+    traceEvents.reserve(events.size() + 1);
+    traceEvents.emplace_back(LocalConfig::RootSpanName, processStartNanoseconds, std::max(processStartNanoseconds, endNanoseconds), rootThreadId,
+                             0);
+    for (const StartupTimelineEvent& entry : events)
+    {
+      traceEvents.emplace_back(entry.Name.c_str(), std::max(processStartNanoseconds, entry.BeginNanoseconds),
+                               std::max(processStartNanoseconds, entry.EndNanoseconds), entry.ThreadId, 1);
+    }
+    return ChromeTraceUtil::ToJson(SpanUtil::AsReadOnlySpan(traceEvents), SpanUtil::AsReadOnlySpan(threads));
+  }
+
+
+  void StartupTimeline::Save(const IO::Path& path)
+  {
+    IO::File::WriteAllText(path, ToJson());
+  }
+}
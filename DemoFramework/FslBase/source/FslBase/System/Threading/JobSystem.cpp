@@ -0,0 +1,569 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/WorkStealingDeque.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/IThreadContext.hpp>
+#include <FslBase/System/Platform/PlatformThread.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  class JobRecord
+  {
+  public:
+    //! One reference for the handle returned by Schedule and one for the job system itself.
+    std::atomic<uint32_t> RefCount{2};
+    //! Starts at one so the job can't be queued while its dependencies are being registered.
+    std::atomic<uint32_t> PendingDependencies{1};
+    std::atomic<bool> Completed{false};
+    std::function<void()> FnJob;
+    std::exception_ptr Exception;
+
+    std::mutex ContinuationLock;
+    std::vector<JobRecord*> Continuations;
+
+    explicit JobRecord(std::function<void()> fnJob)
+      : FnJob(std::move(fnJob))
+    {
+    }
+
+    void AddRef() noexcept
+    {
+      RefCount.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    void Release() noexcept
+    {
+      if (RefCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      {
+        delete this;
+      }
+    }
+  };
+
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The capacity of each deque, if a deque is full the job is added to the shared queue instead.
+      constexpr uint32_t DequeCapacity = 4096u;
+      //! The number of times a idle worker checks for work before going to sleep
+      constexpr uint32_t IdleSpinCount = 64u;
+      //! Used to limit the batch count of a parallel for to a multiple of the concurrency
+      constexpr std::size_t BatchesPerThread = 4u;
+    }
+
+    class WorkerThreadContext final : public IThreadContext
+    {
+    public:
+      JobSystemImpl* pOwner;
+      uint32_t DequeIndex;
+
+      WorkerThreadContext(JobSystemImpl* pTheOwner, const uint32_t dequeIndex)
+        : pOwner(pTheOwner)
+        , DequeIndex(dequeIndex)
+      {
+      }
+    };
+
+    struct ThreadDequeRecord
+    {
+      const JobSystemImpl* pOwner{nullptr};
+      uint32_t DequeIndex{0};
+    };
+
+    //! Identifies the deque owned by the current thread (if any)
+    thread_local ThreadDequeRecord g_threadDeque;
+  }
+
+
+  class JobSystemImpl
+  {
+    uint32_t m_workerThreadCount;
+    //! One deque per worker + one for the thread that created the job system (last index)
+    std::vector<std::unique_ptr<WorkStealingDeque<JobRecord*>>> m_deques;
+    std::vector<std::unique_ptr<PlatformThread>> m_threads;
+
+    //! Used by threads that don't own a deque and when a deque is full.
+    std::mutex m_sharedQueueLock;
+    std::deque<JobRecord*> m_sharedQueue;
+
+    //! The number of jobs that are queued but not yet dequeued
+    std::atomic<uint32_t> m_queuedJobs{0};
+
+    std::mutex m_sleepLock;
+    std::condition_variable m_sleepCondition;
+    std::atomic<uint32_t> m_sleepingWorkers{0};
+    bool m_quit{false};
+
+  public:
+    explicit JobSystemImpl(const uint32_t workerThreadCount)
+      : m_workerThreadCount(workerThreadCount)
+    {
+      m_deques.reserve(workerThreadCount + 1u);
+      for (uint32_t i = 0; i <= workerThreadCount; ++i)
+      {
+        m_deques.push_back(std::make_unique<WorkStealingDeque<JobRecord*>>(LocalConfig::DequeCapacity));
+      }
+
+      // The creating thread owns the last deque
+      g_threadDeque = ThreadDequeRecord{this, workerThreadCount};
+
+      try
+      {
+        m_threads.reserve(workerThreadCount);
+        for (uint32_t i = 0; i < workerThreadCount; ++i)
+        {
+          m_threads.push_back(std::make_unique<PlatformThread>([](const std::shared_ptr<IThreadContext>& context) { RunWorker(context); },
+                                                               std::make_shared<WorkerThreadContext>(this, i)));
+        }
+      }
+      catch (const std::exception&)
+      {
+        Shutdown();
+        throw;
+      }
+    }
+
+    ~JobSystemImpl()
+    {
+      Shutdown();
+    }
+
+    uint32_t GetWorkerThreadCount() const noexcept
+    {
+      return m_workerThreadCount;
+    }
+
+    JobHandle Schedule(std::function<void()> fnJob, const ReadOnlySpan<JobHandle> dependencies)
+    {
+      if (!fnJob)
+      {
+        throw std::invalid_argument("fnJob can not be empty");
+      }
+
+      auto* pRecord = new JobRecord(std::move(fnJob));
+      for (const JobHandle& dependency : dependencies)
+      {
+        JobRecord* pDependency = dependency.GetRecord();
+        if (pDependency != nullptr)
+        {
+          std::lock_guard<std::mutex> lock(pDependency->ContinuationLock);
+          if (!pDependency->Completed.load(std::memory_order_relaxed))
+          {
+            pRecord->PendingDependencies.fetch_add(1u, std::memory_order_relaxed);
+            pDependency->Continuations.push_back(pRecord);
+          }
+        }
+      }
+
+      // Remove the 'registration' dependency
+      if (pRecord->PendingDependencies.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      {
+        Enqueue(pRecord);
+      }
+      return JobHandle(pRecord);
+    }
+
+    bool TryExecuteOne()
+    {
+      JobRecord* pRecord = TryDequeue(GetThreadDequeIndex());
+      if (pRecord == nullptr)
+      {
+        return false;
+      }
+      Execute(pRecord);
+      return true;
+    }
+
+    void HelpUntilCompleted(const JobRecord& record)
+    {
+      while (!record.Completed.load(std::memory_order_acquire))
+      {
+        if (!TryExecuteOne())
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+  private:
+    //! @brief Get the index of the deque owned by the calling thread, or a invalid index if it doesn't own one.
+    uint32_t GetThreadDequeIndex() const noexcept
+    {
+      return g_threadDeque.pOwner == this ? g_threadDeque.DequeIndex : static_cast<uint32_t>(m_deques.size());
+    }
+
+    void Enqueue(JobRecord* pRecord)
+    {
+      // Count the job before it is published. Once it is visible in a deque another worker can dequeue it and decrement the counter,
+      // so counting it afterwards could make the unsigned counter wrap. A worker that sees the count before the job becomes visible
+      // just fails its dequeue attempt and retries.
+      m_queuedJobs.fetch_add(1u);
+
+      const uint32_t dequeIndex = GetThreadDequeIndex();
+      if (dequeIndex >= m_deques.size() || !m_deques[dequeIndex]->TryPush(pRecord))
+      {
+        std::lock_guard<std::mutex> lock(m_sharedQueueLock);
+        m_sharedQueue.push_back(pRecord);
+      }
+
+      if (m_sleepingWorkers.load() > 0u)
+      {
+        // Take the lock to ensure the worker is either waiting or will see the updated job count
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_sleepCondition.notify_one();
+      }
+    }
+
+    JobRecord* TryDequeue(const uint32_t dequeIndex)
+    {
+      JobRecord* pRecord = nullptr;
+      const auto dequeCount = static_cast<uint32_t>(m_deques.size());
+      bool found = dequeIndex < dequeCount && m_deques[dequeIndex]->TryPop(pRecord);
+      if (!found)
+      {
+        std::lock_guard<std::mutex> lock(m_sharedQueueLock);
+        if (!m_sharedQueue.empty())
+        {
+          pRecord = m_sharedQueue.front();
+          m_sharedQueue.pop_front();
+          found = true;
+        }
+      }
+      if (!found)
+      {
+        // Steal from the other deques, starting with the one after our own to spread out the contention
+        const uint32_t startIndex = dequeIndex < dequeCount ? dequeIndex + 1u : 0u;
+        for (uint32_t i = 0; i < dequeCount && !found; ++i)
+        {
+          const uint32_t victimIndex = (startIndex + i) % dequeCount;
+          found = victimIndex != dequeIndex && m_deques[victimIndex]->TrySteal(pRecord);
+        }
+      }
+      if (!found)
+      {
+        return nullptr;
+      }
+      m_queuedJobs.fetch_sub(1u);
+      return pRecord;
+    }
+
+    void Execute(JobRecord* pRecord)
+    {
+      FSL_PROFILE_SCOPE("JobSystem.Job");
+      try
+      {
+        pRecord->FnJob();
+      }
+      catch (...)
+      {
+        pRecord->Exception = std::current_exception();
+      }
+      // Release anything captured by the job as early as possible
+      pRecord->FnJob = {};
+
+      std::vector<JobRecord*> continuations;
+      {
+        std::lock_guard<std::mutex> lock(pRecord->ContinuationLock);
+        pRecord->Completed.store(true, std::memory_order_release);
+        continuations.swap(pRecord->Continuations);
+      }
+      for (JobRecord* pContinuation : continuations)
+      {
+        if (pContinuation->PendingDependencies.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+          Enqueue(pContinuation);
+        }
+      }
+      // Release the job system's reference
+      pRecord->Release();
+    }
+
+    static void RunWorker(const std::shared_ptr<IThreadContext>& context)
+    {
+      const auto* pContext = dynamic_cast<const WorkerThreadContext*>(context.get());
+      if (pContext == nullptr)
+      {
+        return;
+      }
+      g_threadDeque = ThreadDequeRecord{pContext->pOwner, pContext->DequeIndex};
+      ScopeProfiler::SetThreadName("JobSystem worker");
+      pContext->pOwner->WorkerLoop(pContext->DequeIndex);
+    }
+
+    void WorkerLoop(const uint32_t dequeIndex)
+    {
+      while (true)
+      {
+        JobRecord* pRecord = TryDequeue(dequeIndex);
+        for (uint32_t i = 0; pRecord == nullptr && i < LocalConfig::IdleSpinCount; ++i)
+        {
+          std::this_thread::yield();
+          pRecord = TryDequeue(dequeIndex);
+        }
+
+        if (pRecord != nullptr)
+        {
+          Execute(pRecord);
+        }
+        else
+        {
+          std::unique_lock<std::mutex> lock(m_sleepLock);
+          m_sleepingWorkers.fetch_add(1u);
+          m_sleepCondition.wait(lock, [this]() { return m_quit || m_queuedJobs.load() > 0u; });
+          m_sleepingWorkers.fetch_sub(1u);
+          if (m_quit && m_queuedJobs.load() == 0u)
+          {
+            return;
+          }
+        }
+      }
+    }
+
+    void Shutdown() noexcept
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_quit = true;
+      }
+      m_sleepCondition.notify_all();
+      for (auto& rThread : m_threads)
+      {
+        rThread->Join();
+      }
+      m_threads.clear();
+
+      // Execute anything that is left (only happens if there are no workers)
+      while (TryExecuteOne())
+      {
+      }
+
+      if (g_threadDeque.pOwner == this)
+      {
+        g_threadDeque = {};
+      }
+    }
+  };
+
+
+  JobHandle::JobHandle(const JobHandle& other) noexcept
+    : m_pRecord(other.m_pRecord)
+  {
+    if (m_pRecord != nullptr)
+    {
+      m_pRecord->AddRef();
+    }
+  }
+
+
+  JobHandle& JobHandle::operator=(const JobHandle& other) noexcept
+  {
+    if (this != &other)
+    {
+      if (other.m_pRecord != nullptr)
+      {
+        other.m_pRecord->AddRef();
+      }
+      Reset();
+      m_pRecord = other.m_pRecord;
+    }
+    return *this;
+  }
+
+
+  JobHandle::JobHandle(JobHandle&& other) noexcept
+    : m_pRecord(other.m_pRecord)
+  {
+    other.m_pRecord = nullptr;
+  }
+
+
+  JobHandle& JobHandle::operator=(JobHandle&& other) noexcept
+  {
+    if (this != &other)
+    {
+      Reset();
+      m_pRecord = other.m_pRecord;
+      other.m_pRecord = nullptr;
+    }
+    return *this;
+  }
+
+
+  JobHandle::~JobHandle()
+  {
+    Reset();
+  }
+
+
+  void JobHandle::Reset() noexcept
+  {
+    if (m_pRecord != nullptr)
+    {
+      m_pRecord->Release();
+      m_pRecord = nullptr;
+    }
+  }
+
+
+  JobSystem::JobSystem()
+    : JobSystem(GetDefaultWorkerThreadCount())
+  {
+  }
+
+
+  JobSystem::JobSystem(const uint32_t workerThreadCount)
+    : m_impl(std::make_unique<JobSystemImpl>(workerThreadCount))
+  {
+  }
+
+
+  JobSystem::~JobSystem() = default;
+
+
+  uint32_t JobSystem::GetDefaultWorkerThreadCount()
+  {
+#ifdef FSLBASE_THREAD_BACKEND_NOT_SUPPORTED
+    return 0u;
+#else
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1u ? hardwareThreads - 1u : 0u;
+#endif
+  }
+
+
+  uint32_t JobSystem::GetWorkerThreadCount() const noexcept
+  {
+    return m_impl->GetWorkerThreadCount();
+  }
+
+
+  uint32_t JobSystem::GetConcurrency() const noexcept
+  {
+    return m_impl->GetWorkerThreadCount() + 1u;
+  }
+
+
+  JobHandle JobSystem::Schedule(std::function<void()> fnJob)
+  {
+    return m_impl->Schedule(std::move(fnJob), {});
+  }
+
+
+  JobHandle JobSystem::Schedule(std::function<void()> fnJob, const JobHandle& dependency)
+  {
+    return m_impl->Schedule(std::move(fnJob), ReadOnlySpan<JobHandle>(&dependency, 1u));
+  }
+
+
+  JobHandle JobSystem::Schedule(std::function<void()> fnJob, const ReadOnlySpan<JobHandle> dependencies)
+  {
+    return m_impl->Schedule(std::move(fnJob), dependencies);
+  }
+
+
+  bool JobSystem::IsCompleted(const JobHandle& handle) const
+  {
+    const JobRecord* pRecord = handle.GetRecord();
+    if (pRecord == nullptr)
+    {
+      throw std::invalid_argument("handle is invalid");
+    }
+    return pRecord->Completed.load(std::memory_order_acquire);
+  }
+
+
+  void JobSystem::Wait(const JobHandle& handle)
+  {
+    const JobRecord* pRecord = handle.GetRecord();
+    if (pRecord == nullptr)
+    {
+      throw std::invalid_argument("handle is invalid");
+    }
+    m_impl->HelpUntilCompleted(*pRecord);
+    if (pRecord->Exception)
+    {
+      std::rethrow_exception(pRecord->Exception);
+    }
+  }
+
+
+  void JobSystem::WaitAll(const ReadOnlySpan<JobHandle> handles)
+  {
+    WaitAllNoThrow(handles);
+    for (const JobHandle& handle : handles)
+    {
+      const JobRecord* pRecord = handle.GetRecord();
+      if (pRecord != nullptr && pRecord->Exception)
+      {
+        std::rethrow_exception(pRecord->Exception);
+      }
+    }
+  }
+
+
+  bool JobSystem::TryExecuteOne()
+  {
+    return m_impl->TryExecuteOne();
+  }
+
+
+  std::size_t JobSystem::CalcBatchCount(const std::size_t count, const std::size_t minBatchSize) const noexcept
+  {
+    const std::size_t batchSize = std::max(minBatchSize, std::size_t(1u));
+    const std::size_t maxBatches = static_cast<std::size_t>(GetConcurrency()) * LocalConfig::BatchesPerThread;
+    return std::min((count + batchSize - 1u) / batchSize, maxBatches);
+  }
+
+
+  void JobSystem::WaitAllNoThrow(const ReadOnlySpan<JobHandle> handles) noexcept
+  {
+    for (const JobHandle& handle : handles)
+    {
+      const JobRecord* pRecord = handle.GetRecord();
+      if (pRecord != nullptr)
+      {
+        m_impl->HelpUntilCompleted(*pRecord);
+      }
+    }
+  }
+}
@@ -94,3 +94,20 @@ TEST(Test_DataBinding, SetDataBindingInstanceState)
   state.SetDataBindingInstanceState(newState);
   EXPECT_EQ(newState, state.GetState());
 }
+
+
+TEST(Test_DataBinding, SweepScheduled)
+{
+  DataBinding::Internal::InstanceState state(DataBinding::DataBindingInstanceType::DependencyProperty,
+                                             DataBinding::Internal::PropertyMethodsImplType::ATypedDependencyProperty);
+  EXPECT_FALSE(state.IsSweepScheduled());
+
+  state.MarkSweepScheduled();
+  EXPECT_TRUE(state.IsSweepScheduled());
+  EXPECT_FALSE(state.HasPendingChanges());
+  EXPECT_EQ(DataBinding::DataBindingInstanceType::DependencyProperty, state.GetType());
+  EXPECT_EQ(DataBinding::DataBindingInstanceState::Alive, state.GetState());
+
+  state.ClearSweepScheduled();
+  EXPECT_FALSE(state.IsSweepScheduled());
+}
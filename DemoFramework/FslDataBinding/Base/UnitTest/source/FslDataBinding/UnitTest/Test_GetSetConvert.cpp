@@ -37,6 +37,7 @@
 #include <FslDataBinding/Base/Exceptions.hpp>
 #include <fmt/format.h>
 #include <memory>
+#include <vector>
 #include "UTDependencyObject.hpp"
 #include "UTDependencyObject2.hpp"
 
@@ -474,3 +475,72 @@ TEST(Test_GetSetConvert, SetBinding_DepProperty_Multi_DepProperty_DepProperty_Se
   EXPECT_EQ(dstConvertedValue2, dst.GetProperty0Value());
   EXPECT_EQ(dstDefaultValue, dst.GetProperty1Value());
 }
+
+
+TEST(Test_GetSetConvert, SetBinding_Diamond_Multi_DepProperty_ConvertedOnce)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject src(dataBindingService);
+  UTDependencyObject mid0(dataBindingService);
+  UTDependencyObject mid1(dataBindingService);
+  UTDependencyObject dst(dataBindingService);
+
+  uint32_t convertCount = 0;
+  auto convertingBinding = std::make_shared<Fsl::DataBinding::MultiConverterBinding<uint32_t, float, float>>(
+    [&convertCount](const float value0, const float value1)
+    {
+      ++convertCount;
+      return static_cast<uint32_t>(std::round(value0 + value1));
+    });
+
+  //        src
+  //       /   \
+  //    mid0   mid1
+  //       \   /
+  //        dst
+  mid0.SetBinding(UTDependencyObject::Property1, src.GetPropertyHandle(UTDependencyObject::Property1));
+  mid1.SetBinding(UTDependencyObject::Property1, src.GetPropertyHandle(UTDependencyObject::Property1));
+  EXPECT_TRUE(
+    dst.SetBinding(UTDependencyObject::Property0, DataBinding::Binding(convertingBinding, mid0.GetPropertyHandle(UTDependencyObject::Property1),
+                                                                       mid1.GetPropertyHandle(UTDependencyObject::Property1))));
+  dataBindingService->ExecuteChanges();
+
+  convertCount = 0;
+  EXPECT_TRUE(src.SetProperty1Value(1.7f));
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_EQ(0u, dataBindingService->PendingChanges());
+  EXPECT_EQ(1.7f, mid0.GetProperty1Value());
+  EXPECT_EQ(1.7f, mid1.GetProperty1Value());
+  EXPECT_EQ(3u, dst.GetProperty0Value());    // 1.7f + 1.7f = 3.4 rounded -> 3
+  // Both sources of dst changed but it is only updated once
+  EXPECT_EQ(1u, convertCount);
+}
+
+
+TEST(Test_GetSetConvert, SetBinding_DeepChain_DepProperty)
+{
+  constexpr std::size_t ChainLength = 256;
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  std::vector<std::unique_ptr<UTDependencyObject>> chain(ChainLength);
+  for (std::size_t i = 0; i < chain.size(); ++i)
+  {
+    chain[i] = std::make_unique<UTDependencyObject>(dataBindingService);
+  }
+  // Bind the chain back to front so the levels of the already bound targets needs to be raised for each new binding
+  for (std::size_t i = chain.size() - 1u; i > 0u; --i)
+  {
+    chain[i]->SetBinding(UTDependencyObject::Property0, chain[i - 1]->GetPropertyHandle(UTDependencyObject::Property0));
+  }
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_TRUE(chain.front()->SetProperty0Value(42));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(42u, chain.back()->GetProperty0Value());
+
+  // Closing the chain would create a cycle
+  EXPECT_THROW(chain.front()->SetBinding(UTDependencyObject::Property0, chain.back()->GetPropertyHandle(UTDependencyObject::Property0)),
+               DataBinding::CyclicBindingException);
+}
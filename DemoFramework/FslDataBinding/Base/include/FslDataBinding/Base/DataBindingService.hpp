@@ -45,6 +45,7 @@
 #include <queue>
 #include <typeindex>
 #include <utility>
+#include <vector>
 
 namespace Fsl::DataBinding
 {
@@ -157,13 +158,30 @@ namespace Fsl::DataBinding
       }
     };
 
+    struct SweepRecord
+    {
+      DataBindingInstanceHandle Handle;
+      //! The source that caused the instance to be scheduled (invalid for the changed instances that seeded the sweep)
+      DataBindingInstanceHandle SourceHandle;
+
+      constexpr SweepRecord() noexcept = default;
+      constexpr SweepRecord(const DataBindingInstanceHandle hInstance, const DataBindingInstanceHandle hSource) noexcept
+        : Handle(hInstance)
+        , SourceHandle(hSource)
+      {
+      }
+    };
+
     TwoWayDataBindingGroupManager m_groupManager;
 
     HandleVector<Internal::ServiceBindingRecord> m_instances;
     // We ensure that this vector can always hold m_instances.Count entries (so the schedule of a destroy will never fail)
     std::vector<DataBindingInstanceHandle> m_scheduledForDestroy;
     std::vector<DataBindingInstanceHandle> m_pendingChanges;
-    std::queue<DataBindingInstanceHandle> m_changesOneWay;
+    //! One way changes are executed as a single sweep ordered by the topological level of the instances. Multi source targets are queued
+    //! at their level so they are updated once after all their sources, no matter how many of them changed.
+    std::vector<std::vector<SweepRecord>> m_sweepLevels;
+    std::size_t m_sweepCount{0};
     std::queue<DataBindingInstanceHandle> m_changesTwoWay;
     std::queue<ObserverRecord> m_pendingObserverCallbacks;
     std::queue<DeferredBindingRecord> m_pendingBindings;
@@ -254,7 +272,9 @@ namespace Fsl::DataBinding
     void ExecuteObserverCallbacksNow();
     void ExecuteTwoWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source,
                                 const DataBindingInstanceHandle hSkip);
-    void ExecuteOneWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source);
+    void ScheduleSweep(const DataBindingInstanceHandle hInstance, Internal::ServiceBindingRecord& rInstance, const DataBindingInstanceHandle hSource);
+    void PropagateToTargets(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source);
+    void ClearSweep() noexcept;
     void ExecuteInstanceObserverCallback(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource);
     bool ExecuteDependencyPropertyGetSet(const DataBindingInstanceHandle hTarget, const Internal::ServiceBindingRecord& target,
                                          const Internal::ServiceBindingRecord& source);
@@ -271,11 +291,13 @@ namespace Fsl::DataBinding
     void DestroyScheduledNow() noexcept;
     void EnsureDestroyCapacity();
     void DoDestroyInstanceNow(DataBindingInstanceHandle hInstance) noexcept;
+    void UpdateLevel(Internal::ServiceBindingRecord& rTarget) noexcept;
+    void RaiseTargetLevels(const Internal::ServiceBindingRecord& source) noexcept;
 
     void CheckForCyclicDependencies(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource) const;
     void CheckTwoWayBindingSourceRules(const DataBindingInstanceHandle hSource) const;
     void CheckTwoWayBindingTargetRules(const Internal::ServiceBindingRecord& targetInstance) const;
-    bool IsInstanceTarget(const DataBindingInstanceHandle hInstance, const DataBindingInstanceHandle hEntry) const;
+    bool IsInstanceTarget(const DataBindingInstanceHandle hInstance, const DataBindingInstanceHandle hEntry, const uint32_t entryLevel) const;
   };
 }
 
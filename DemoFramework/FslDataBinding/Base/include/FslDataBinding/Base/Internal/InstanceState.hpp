@@ -56,6 +56,8 @@ namespace Fsl::DataBinding::Internal
       NoFlags = 0,
 
 
+      // Is set while the instance is queued for the one way change propagation sweep
+      SweepScheduled = 0x10000000,
       // Set if this
       Observable = 0x20000000,
       // Is set if there are pending changes
@@ -117,6 +119,21 @@ namespace Fsl::DataBinding::Internal
       m_flags = static_cast<Flags>(static_cast<base_type>(m_flags) & (~static_cast<base_type>(Flags::HasPendingChanges)));
     }
 
+    constexpr inline bool IsSweepScheduled() const noexcept
+    {
+      return static_cast<Flags>((static_cast<base_type>(m_flags) & static_cast<base_type>(Flags::SweepScheduled))) == Flags::SweepScheduled;
+    }
+
+    constexpr inline void MarkSweepScheduled() noexcept
+    {
+      m_flags = static_cast<Flags>(static_cast<base_type>(m_flags) | static_cast<base_type>(Flags::SweepScheduled));
+    }
+
+    constexpr inline void ClearSweepScheduled() noexcept
+    {
+      m_flags = static_cast<Flags>(static_cast<base_type>(m_flags) & (~static_cast<base_type>(Flags::SweepScheduled)));
+    }
+
 
     constexpr inline bool IsEnabled(const Flags flag) const noexcept
     {
@@ -71,6 +71,10 @@ namespace Fsl::DataBinding::Internal
     };
 
     ServiceBindingSourceRecord m_source;
+    //! The topological level of the instance. Instances without sources are at level zero and a bound instance is always at a higher
+    //! level than all of its sources. The level is raised as bindings are added but never lowered for the targets when a binding is
+    //! removed, it is only guaranteed to be a valid ordering, not the minimal one.
+    uint32_t m_level{0};
 
   public:
     Internal::InstanceState Instance;
@@ -117,6 +121,16 @@ namespace Fsl::DataBinding::Internal
       return 0u;
     }
 
+    uint32_t Level() const noexcept
+    {
+      return m_level;
+    }
+
+    void SetLevel(const uint32_t level) noexcept
+    {
+      m_level = level;
+    }
+
     ReadOnlySpan<DataBindingInstanceHandle> TargetHandles() const noexcept
     {
       return SysHandles.AsReadOnlySpan(Internal::ServicePropertyVectorIndex::Targets);
@@ -164,6 +178,8 @@ namespace Fsl::DataBinding::Internal
     void ClearSourceHandles() noexcept
     {
       m_source = {};
+      // Without sources the instance is a root (all existing targets are still at a higher level)
+      m_level = 0;
       SysHandles.Clear(Internal::ServicePropertyVectorIndex::Sources);
     }
 
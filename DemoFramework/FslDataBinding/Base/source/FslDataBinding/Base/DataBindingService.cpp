@@ -32,6 +32,7 @@
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/Span/SpanUtil_Array.hpp>
 #include <FslBase/Span/SpanUtil_ValueCompare.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslDataBinding/Base/Bind/AConverterBinding.hpp>
 #include <FslDataBinding/Base/Bind/AMultiConverterBinding.hpp>
 #include <FslDataBinding/Base/Binding.hpp>
@@ -808,6 +809,7 @@ namespace Fsl::DataBinding
 
   void DataBindingService::ExecuteChanges()
   {
+    FSL_PROFILE_SCOPE("DataBinding.ExecuteChanges");
     if (m_callContext.State != CallContextState::Idle)
     {
       throw UsageErrorException("ExecuteChanges: Can not be called from this context");
@@ -815,7 +817,7 @@ namespace Fsl::DataBinding
     uint32_t changeLoopCounter = 0;
     do
     {
-      assert(m_changesOneWay.empty());
+      assert(m_sweepCount == 0u);
 
       // Since we are single threaded and destroy the instance id's here
       // It means that the 'deferred' changes to destroyed instances will fail to acquire their instance and thereby be ignored.
@@ -901,6 +903,7 @@ namespace Fsl::DataBinding
         }
 
         rTargetInstance.SetSource(binding);
+        UpdateLevel(rTargetInstance);
         // If the target is marked as changed, mark all parent sources as changed as well
         if (rTargetInstance.Instance.HasPendingChanges())
         {
@@ -1009,7 +1012,11 @@ namespace Fsl::DataBinding
         if (rSourceInstance.Instance.GetState() == DataBindingInstanceState::Alive)
         {
           hasSource = true;
-          RecursiveMarkAsChanged(hSource, rSourceInstance);
+          // A source that is already marked has all of its own sources marked as well, so there is no need to visit them again
+          if (!rSourceInstance.Instance.HasPendingChanges())
+          {
+            RecursiveMarkAsChanged(hSource, rSourceInstance);
+          }
         }
       }
     }
@@ -1017,7 +1024,7 @@ namespace Fsl::DataBinding
     {
       if (!wasMarked)
       {
-        m_changesOneWay.push(hInstance);
+        ScheduleSweep(hInstance, rInstance, {});
       }
     }
   }
@@ -1068,6 +1075,12 @@ namespace Fsl::DataBinding
           {    // The handle was not found (so the two way linking is corrupt)
             return false;
           }
+          // Verify that the source is ordered before the target (the order is only maintained between alive instances)
+          if (pSourceRecord->Level() >= record.Level() && pSourceRecord->Instance.GetState() == DataBindingInstanceState::Alive &&
+              record.Instance.GetState() == DataBindingInstanceState::Alive)
+          {
+            return false;
+          }
           // Verify that two way bindings are valid
           if (record.SourceBindingMode() == BindingMode::TwoWay && pSourceRecord->HasValidSourceHandles() &&
               pSourceRecord->SourceBindingMode() == BindingMode::OneWay)
@@ -1223,7 +1236,7 @@ namespace Fsl::DataBinding
 
   void DataBindingService::DeterminePendingChanges()
   {
-    assert(m_changesOneWay.empty());
+    assert(m_sweepCount == 0u);
 
     m_groupManager.ClearGroups();
     for (const DataBindingInstanceHandle hChangedInstance : m_pendingChanges)
@@ -1272,7 +1285,7 @@ namespace Fsl::DataBinding
           if (!rChangedInstance.SysHandles.Empty(Internal::ServicePropertyVectorIndex::Targets) && !rChangedInstance.Instance.HasPendingChanges())
           {
             rChangedInstance.Instance.MarkPendingChanges();
-            m_changesOneWay.push(hChangedInstance);
+            ScheduleSweep(hChangedInstance, rChangedInstance, {});
           }
         }
         else
@@ -1305,6 +1318,8 @@ namespace Fsl::DataBinding
     ExecutePendingOneWayChangesNow();
   }
 
+  // Two-way bindings are not part of the level ordered sweep. A two-way group has no direction, so it has no topological order.
+  // Each group is instead queued once with its last changed member and propagated from there, so every member is visited once per frame.
   void DataBindingService::ExecutePendingTwoWayChangesNow()
   {
     assert(m_callContext.State == CallContextState::Idle);
@@ -1347,32 +1362,51 @@ namespace Fsl::DataBinding
     assert(m_callContext.State == CallContextState::Idle);
     assert(m_callContext.HandlesEmpty());
 
-    if (!m_changesOneWay.empty())
+    if (m_sweepCount > 0u)
     {
       LOCAL_DO_SANITY_CHECK();
 
       try
       {
         m_callContext.State = CallContextState::ExecutingChanges;
-        while (!m_changesOneWay.empty())
+        // A target is always at a higher level than its sources, so once a level has been processed nothing new can be scheduled to it.
+        // The level vectors are accessed by index as scheduling a target can resize m_sweepLevels.
+        for (std::size_t level = 0; m_sweepCount > 0u; ++level)
         {
-          const auto hChangedInstance = m_changesOneWay.front();
-          m_changesOneWay.pop();
-          auto* pChangedInstance = m_instances.TryGet(hChangedInstance.Value);
-          if (pChangedInstance != nullptr)
+          assert(level < m_sweepLevels.size());
+          for (std::size_t i = 0; i < m_sweepLevels[level].size(); ++i)
           {
-            assert(pChangedInstance->Instance.HasPendingChanges());
-            pChangedInstance->Instance.ClearPendingChanges();
-
-            // this method does not modify m_instances so the reference "pChangedInstance" into it is safe
-            ExecuteOneWayChangesTo(hChangedInstance, *pChangedInstance);
+            const SweepRecord entry = m_sweepLevels[level][i];
+            --m_sweepCount;
+            auto* pChangedInstance = m_instances.TryGet(entry.Handle.Value);
+            if (pChangedInstance != nullptr)
+            {
+              pChangedInstance->Instance.ClearSweepScheduled();
+
+              // Instances scheduled by a source are updated once from their source(s) before deciding if the change should propagate
+              bool changed = true;
+              if (entry.SourceHandle.IsValid())
+              {
+                const auto* const pSource = m_instances.TryGet(entry.SourceHandle.Value);
+                changed = pSource != nullptr && ExecuteDependencyPropertyGetSet(entry.Handle, *pChangedInstance, *pSource);
+              }
+              if (changed || pChangedInstance->Instance.HasPendingChanges())
+              {
+                pChangedInstance->Instance.ClearPendingChanges();
+
+                // this method does not modify m_instances so the reference "pChangedInstance" into it is safe
+                PropagateToTargets(entry.Handle, *pChangedInstance);
+              }
+            }
           }
+          m_sweepLevels[level].clear();
         }
         m_callContext = {};
       }
       catch (const std::exception&)
       {
         m_callContext = {};
+        ClearSweep();
         FSLLOG3_ERROR("Exception during DataBinding ExecutePendingOneWayChangesNow");
         throw;
       }
@@ -1454,42 +1488,61 @@ namespace Fsl::DataBinding
     }
   }
 
+  void DataBindingService::ScheduleSweep(const DataBindingInstanceHandle hInstance, Internal::ServiceBindingRecord& rInstance,
+                                         const DataBindingInstanceHandle hSource)
+  {
+    if (!rInstance.Instance.IsSweepScheduled())
+    {
+      const uint32_t level = rInstance.Level();
+      if (level >= m_sweepLevels.size())
+      {
+        m_sweepLevels.resize(level + 1u);
+      }
+      m_sweepLevels[level].emplace_back(hInstance, hSource);
+      rInstance.Instance.MarkSweepScheduled();
+      ++m_sweepCount;
+    }
+  }
+
+
   // Beware this modifies the m_pendingObserverCallbacks with observer instances that need to be executed
-  void DataBindingService::ExecuteOneWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source)
+  void DataBindingService::PropagateToTargets(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source)
   {
     assert(m_callContext.State == CallContextState::ExecutingChanges);
     if (source.Instance.GetState() == DataBindingInstanceState::Alive)
     {
-      // Execute the change
       for (const auto hTarget : source.TargetHandles())
       {
         auto& rTarget = m_instances.FastGet(hTarget.Value);
         if (rTarget.Instance.GetState() == DataBindingInstanceState::Alive)
         {
-          bool changed = false;
           switch (rTarget.Instance.GetType())
           {
           case DataBindingInstanceType::DependencyObserverProperty:
             m_pendingObserverCallbacks.emplace(hTarget, hSource);
+            rTarget.Instance.ClearPendingChanges();
             break;
-          // case DataBindingInstanceType::DependencyObject:
-          // case DataBindingInstanceType::Target:
-          //  assert(target.pDataTarget != nullptr);
-          //  target.pDataTarget->OnChanged(hChangedInstance);
-          //  break;
           case DataBindingInstanceType::DependencyProperty:
-            changed = ExecuteDependencyPropertyGetSet(hTarget, rTarget, source);
+            assert(rTarget.Level() > source.Level());
+            if (rTarget.SourceHandleCount() == 1u)
+            {
+              // A target with a single source can only be reached once per sweep, so it is updated and propagated right away.
+              // Any multi source target further down is still postponed until its level is processed.
+              if (ExecuteDependencyPropertyGetSet(hTarget, rTarget, source) || rTarget.Instance.HasPendingChanges())
+              {
+                rTarget.Instance.ClearPendingChanges();
+                PropagateToTargets(hTarget, rTarget);
+              }
+            }
+            else
+            {
+              // Multiple sources, so postpone the update until all of them have been processed
+              ScheduleSweep(hTarget, rTarget, hSource);
+            }
             break;
           default:
             throw InternalErrorException("Change to a object of a unsupported type");
           }
-          if (changed || rTarget.Instance.HasPendingChanges())
-          {
-            rTarget.Instance.ClearPendingChanges();
-
-            // Execute any pending changes to dependent resources
-            ExecuteOneWayChangesTo(hTarget, rTarget);
-          }
         }
         else
         {
@@ -1504,6 +1557,24 @@ namespace Fsl::DataBinding
   }
 
 
+  void DataBindingService::ClearSweep() noexcept
+  {
+    for (auto& rLevel : m_sweepLevels)
+    {
+      for (const SweepRecord& entry : rLevel)
+      {
+        auto* pRecord = m_instances.TryGet(entry.Handle.Value);
+        if (pRecord != nullptr)
+        {
+          pRecord->Instance.ClearSweepScheduled();
+        }
+      }
+      rLevel.clear();
+    }
+    m_sweepCount = 0;
+  }
+
+
   void DataBindingService::ExecuteInstanceObserverCallback(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource)
   {
     assert(m_callContext.State == CallContextState::ExecutingObserverCallbacks);
@@ -1709,6 +1780,34 @@ namespace Fsl::DataBinding
   }
 
 
+  void DataBindingService::UpdateLevel(Internal::ServiceBindingRecord& rTarget) noexcept
+  {
+    uint32_t level = 0;
+    for (const auto hSource : rTarget.SourceHandles())
+    {
+      level = std::max(level, m_instances.FastGet(hSource.Value).Level() + 1u);
+    }
+    rTarget.SetLevel(level);
+    RaiseTargetLevels(rTarget);
+  }
+
+
+  void DataBindingService::RaiseTargetLevels(const Internal::ServiceBindingRecord& source) noexcept
+  {
+    // Dead instances never propagate changes and are ignored by the cyclic dependency checks, so a cycle can exist through them
+    const uint32_t minTargetLevel = source.Level() + 1u;
+    for (const auto hTarget : source.TargetHandles())
+    {
+      Internal::ServiceBindingRecord& rTarget = m_instances.FastGet(hTarget.Value);
+      if (rTarget.Level() < minTargetLevel && rTarget.Instance.GetState() == DataBindingInstanceState::Alive)
+      {
+        rTarget.SetLevel(minTargetLevel);
+        RaiseTargetLevels(rTarget);
+      }
+    }
+  }
+
+
   void DataBindingService::CheckForCyclicDependencies(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource) const
   {
     if (hTarget == hSource)
@@ -1720,11 +1819,17 @@ namespace Fsl::DataBinding
     // The target is not expected to have any existing source
     assert(!targetRecord.HasValidSourceHandles());
 
-    for (const auto entry : targetRecord.TargetHandles())
+    // The level increases along every binding, so the source can only be reachable from the target if its level is higher.
+    // This lets most binds skip the search entirely and limits it to the instances below the source level when it can't be skipped.
+    const uint32_t sourceLevel = m_instances.FastGet(hSource.Value).Level();
+    if (sourceLevel > targetRecord.Level())
     {
-      if (IsInstanceTarget(entry, hSource))
+      for (const auto entry : targetRecord.TargetHandles())
       {
-        throw CyclicBindingException("Circular dependency found");
+        if (IsInstanceTarget(entry, hSource, sourceLevel))
+        {
+          throw CyclicBindingException("Circular dependency found");
+        }
       }
     }
   }
@@ -1753,17 +1858,19 @@ namespace Fsl::DataBinding
   }
 
 
-  bool DataBindingService::IsInstanceTarget(const DataBindingInstanceHandle hInstance, const DataBindingInstanceHandle hEntry) const
+  bool DataBindingService::IsInstanceTarget(const DataBindingInstanceHandle hInstance, const DataBindingInstanceHandle hEntry,
+                                            const uint32_t entryLevel) const
   {
     bool isTarget = hInstance == hEntry;
     if (!isTarget)
     {
       const auto& record = m_instances.FastGet(hInstance.Value);
-      if (record.Instance.GetState() == DataBindingInstanceState::Alive)
+      // Every instance on a path leading to the entry has a lower level than the entry
+      if (record.Instance.GetState() == DataBindingInstanceState::Alive && record.Level() < entryLevel)
       {
         for (const auto entry : record.TargetHandles())
         {
-          if (IsInstanceTarget(entry, hEntry))
+          if (IsInstanceTarget(entry, hEntry, entryLevel))
           {
             isTarget = true;
             break;
@@ -0,0 +1,426 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoApp/Base/Streaming/ITextureStreamUploader.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamer.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
+#include <FslGraphics/Texture/TextureType.hpp>
+#include <fmt/format.h>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_TextureStreamer = TestFixtureFslBase;
+
+  struct UploadRecord
+  {
+    TextureStreamHandle Handle;
+    PxExtent3D Extent;
+    uint32_t Levels{0};
+    bool IsPlaceholder{false};
+    std::vector<uint8_t> Content;
+  };
+
+  class RecordingUploader final : public ITextureStreamUploader
+  {
+  public:
+    std::vector<UploadRecord> Uploads;
+
+    void Upload(const TextureStreamHandle handle, const Texture& texture, const bool isPlaceholder) final
+    {
+      Texture::ScopedDirectReadAccess access(texture);
+      const auto* const pContent = static_cast<const uint8_t*>(access.AsRawTexture().GetContent());
+      Uploads.push_back(UploadRecord{handle, texture.GetExtent(), texture.GetLevels(), isPlaceholder,
+                                     std::vector<uint8_t>(pContent, pContent + texture.GetByteSize())});
+    }
+  };
+
+  //! Creates a 64x64 texture for every path except "fail"
+  Texture DecodeTestTexture(const IO::Path& absolutePath, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin)
+  {
+    if (absolutePath == IO::Path("content/fail"))
+    {
+      throw IOException("decode failed");
+    }
+    return {PxExtent2D::Create(64, 64), desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : PixelFormat::R8G8B8A8_UNORM,
+            desiredOrigin != BitmapOrigin::Undefined ? desiredOrigin : BitmapOrigin::UpperLeft};
+  }
+
+  TextureStreamer::DecodeFunction CreateTestDecoder()
+  {
+    return DecodeTestTexture;
+  }
+
+  //! Creates a R8 texture where each pixel in the top level contains its x coordinate
+  Texture CreateGradientTexture(const uint32_t width, const uint32_t height, const uint32_t levels)
+  {
+    Texture texture(TextureBlobBuilder(TextureType::Tex2D, PxExtent3D::Create(width, height, 1), PixelFormat::R8_UNORM, TextureInfo(levels, 1, 1),
+                                       BitmapOrigin::UpperLeft, true));
+    Texture::ScopedDirectReadWriteAccess access(texture);
+    RawTextureEx& rRawTexture = access.AsRawTexture();
+    auto* const pContent = static_cast<uint8_t*>(rRawTexture.GetContent()) + rRawTexture.GetTextureBlob(0, 0, 0).Offset;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        pContent[(y * width) + x] = static_cast<uint8_t>(x);
+      }
+    }
+    return texture;
+  }
+
+  TextureStreamerConfig CreateConfig(const uint32_t workerCount, const uint64_t budget)
+  {
+    return {workerCount, budget};
+  }
+}
+
+
+TEST(Test_TextureStreamer, Construct_EmptyDecoder)
+{
+  EXPECT_THROW(TextureStreamer(IO::Path("content"), TextureStreamer::CreateDecoderFunction()), std::invalid_argument);
+}
+
+
+TEST(Test_TextureStreamer, Request_EmptyPath)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1024 * 1024));
+  EXPECT_THROW(streamer.Request(IO::Path()), std::invalid_argument);
+}
+
+
+TEST(Test_TextureStreamer, Update_PlaceholderThenFull)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle = streamer.Request(IO::Path("a"));
+  EXPECT_TRUE(handle.IsValid());
+  EXPECT_EQ(TextureStreamState::Queued, streamer.GetState(handle));
+
+  // Without workers one decode is done per update
+  const TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(1u, stats.PlaceholderUploads);
+  EXPECT_EQ(1u, stats.TextureUploads);
+  EXPECT_EQ(0u, stats.PendingDecodes);
+  EXPECT_EQ(0u, stats.PendingUploads);
+  EXPECT_EQ(TextureStreamState::Ready, streamer.GetState(handle));
+
+  ASSERT_EQ(2u, uploader.Uploads.size());
+  EXPECT_TRUE(uploader.Uploads[0].IsPlaceholder);
+  EXPECT_EQ(handle, uploader.Uploads[0].Handle);
+  EXPECT_EQ(PxExtent3D::Create(32, 32, 1), uploader.Uploads[0].Extent);
+  // The decoded texture had no mip maps, so the placeholder is sampled from the top level before the chain is generated
+  EXPECT_EQ(1u, uploader.Uploads[0].Levels);
+  EXPECT_FALSE(uploader.Uploads[1].IsPlaceholder);
+  EXPECT_EQ(PxExtent3D::Create(64, 64, 1), uploader.Uploads[1].Extent);
+  EXPECT_EQ(7u, uploader.Uploads[1].Levels);
+}
+
+
+TEST(Test_TextureStreamer, Update_NoMipMaps)
+{
+  TextureStreamerConfig config = CreateConfig(0, 1024 * 1024);
+  config.GenerateMipMaps = false;
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, config);
+  RecordingUploader uploader;
+
+  streamer.Request(IO::Path("a"));
+  const TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(1u, stats.PlaceholderUploads);
+  EXPECT_EQ(1u, stats.TextureUploads);
+  ASSERT_EQ(2u, uploader.Uploads.size());
+  EXPECT_EQ(1u, uploader.Uploads[0].Levels);
+  EXPECT_EQ(1u, uploader.Uploads[1].Levels);
+}
+
+
+TEST(Test_TextureStreamer, Update_PlaceholderDisabled)
+{
+  TextureStreamerConfig config = CreateConfig(0, 1024 * 1024);
+  config.PlaceholderMaxExtent = 0;
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, config);
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle = streamer.Request(IO::Path("a"));
+  const TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(0u, stats.PlaceholderUploads);
+  EXPECT_EQ(1u, stats.TextureUploads);
+  ASSERT_EQ(1u, uploader.Uploads.size());
+  EXPECT_EQ(7u, uploader.Uploads[0].Levels);
+  EXPECT_EQ(TextureStreamState::Ready, streamer.GetState(handle));
+}
+
+
+TEST(Test_TextureStreamer, Update_MipTailPlaceholder)
+{
+  // A texture that was decoded with its mip chain uses the tail of the chain as the placeholder
+  auto fnCreateDecoder = []() -> TextureStreamer::DecodeFunction
+  { return [](const IO::Path& /*absolutePath*/, const PixelFormat /*pixelFormat*/, const BitmapOrigin /*origin*/) { return CreateGradientTexture(64, 64, 7); }; };
+  TextureStreamer streamer(IO::Path("content"), fnCreateDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  streamer.Request(IO::Path("a"));
+  streamer.Update(uploader);
+  ASSERT_EQ(2u, uploader.Uploads.size());
+  EXPECT_TRUE(uploader.Uploads[0].IsPlaceholder);
+  EXPECT_EQ(PxExtent3D::Create(32, 32, 1), uploader.Uploads[0].Extent);
+  EXPECT_EQ(6u, uploader.Uploads[0].Levels);
+  EXPECT_EQ(7u, uploader.Uploads[1].Levels);
+}
+
+
+TEST(Test_TextureStreamer, Update_SampledPlaceholder)
+{
+  auto fnCreateDecoder = []() -> TextureStreamer::DecodeFunction
+  { return [](const IO::Path& /*absolutePath*/, const PixelFormat /*pixelFormat*/, const BitmapOrigin /*origin*/) { return CreateGradientTexture(128, 32, 1); }; };
+  TextureStreamer streamer(IO::Path("content"), fnCreateDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  streamer.Request(IO::Path("a"));
+  streamer.Update(uploader);
+  ASSERT_EQ(2u, uploader.Uploads.size());
+  const UploadRecord& placeholder = uploader.Uploads[0];
+  EXPECT_TRUE(placeholder.IsPlaceholder);
+  // The aspect ratio is kept
+  EXPECT_EQ(PxExtent3D::Create(32, 8, 1), placeholder.Extent);
+  EXPECT_EQ(1u, placeholder.Levels);
+  ASSERT_EQ(32u * 8u, placeholder.Content.size());
+  for (uint32_t y = 0; y < 8u; ++y)
+  {
+    for (uint32_t x = 0; x < 32u; ++x)
+    {
+      // Each placeholder pixel samples the center of the 4x4 area it covers
+      EXPECT_EQ((x * 4u) + 2u, placeholder.Content[(y * 32u) + x]);
+    }
+  }
+}
+
+
+TEST(Test_TextureStreamer, Update_Priority)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle0 = streamer.Request(IO::Path("a"), 0);
+  const TextureStreamHandle handle1 = streamer.Request(IO::Path("b"), 5);
+  const TextureStreamHandle handle2 = streamer.Request(IO::Path("c"), 1);
+  EXPECT_TRUE(streamer.SetPriority(handle0, 10));
+
+  streamer.Update(uploader);
+  streamer.Update(uploader);
+  streamer.Update(uploader);
+
+  ASSERT_EQ(6u, uploader.Uploads.size());
+  EXPECT_EQ(handle0, uploader.Uploads[1].Handle);
+  EXPECT_EQ(handle1, uploader.Uploads[3].Handle);
+  EXPECT_EQ(handle2, uploader.Uploads[5].Handle);
+}
+
+
+TEST(Test_TextureStreamer, Update_Budget)
+{
+  // The budget only allows one upload per frame, but a upload is always done if nothing else was uploaded
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1));
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle = streamer.Request(IO::Path("a"));
+
+  TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(1u, stats.PlaceholderUploads);
+  EXPECT_EQ(0u, stats.TextureUploads);
+  EXPECT_EQ(1u, stats.PendingUploads);
+  EXPECT_EQ(TextureStreamState::Placeholder, streamer.GetState(handle));
+
+  stats = streamer.Update(uploader);
+  EXPECT_EQ(0u, stats.PlaceholderUploads);
+  EXPECT_EQ(1u, stats.TextureUploads);
+  EXPECT_EQ(0u, stats.PendingUploads);
+  EXPECT_EQ(TextureStreamState::Ready, streamer.GetState(handle));
+}
+
+
+TEST(Test_TextureStreamer, Update_PlaceholdersFirst)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1));
+  RecordingUploader uploader;
+
+  streamer.Request(IO::Path("a"));
+  streamer.Request(IO::Path("b"));
+
+  // Decode both
+  streamer.Update(uploader);
+  streamer.Update(uploader);
+  // Both placeholders must be uploaded before the full textures
+  streamer.Update(uploader);
+  streamer.Update(uploader);
+
+  ASSERT_EQ(4u, uploader.Uploads.size());
+  EXPECT_TRUE(uploader.Uploads[0].IsPlaceholder);
+  EXPECT_TRUE(uploader.Uploads[1].IsPlaceholder);
+  EXPECT_FALSE(uploader.Uploads[2].IsPlaceholder);
+  EXPECT_FALSE(uploader.Uploads[3].IsPlaceholder);
+}
+
+
+TEST(Test_TextureStreamer, Update_DecodeFailed)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle = streamer.Request(IO::Path("fail"));
+  const TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(1u, stats.Failed);
+  EXPECT_TRUE(uploader.Uploads.empty());
+  EXPECT_EQ(TextureStreamState::Failed, streamer.GetState(handle));
+}
+
+
+TEST(Test_TextureStreamer, Release)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(0, 1024 * 1024));
+  RecordingUploader uploader;
+
+  const TextureStreamHandle handle = streamer.Request(IO::Path("a"));
+  EXPECT_TRUE(streamer.Release(handle));
+  EXPECT_FALSE(streamer.Release(handle));
+  EXPECT_FALSE(streamer.SetPriority(handle, 1));
+  EXPECT_EQ(TextureStreamState::Unknown, streamer.GetState(handle));
+
+  const TextureStreamerFrameStats stats = streamer.Update(uploader);
+  EXPECT_EQ(0u, stats.PendingDecodes);
+  EXPECT_TRUE(uploader.Uploads.empty());
+}
+
+
+TEST(Test_TextureStreamer, Update_Workers)
+{
+  constexpr uint32_t RequestCount = 32;
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(3, 64 * 1024));
+  RecordingUploader uploader;
+
+  std::vector<TextureStreamHandle> handles;
+  for (uint32_t i = 0; i < RequestCount; ++i)
+  {
+    handles.push_back(streamer.Request(IO::Path(fmt::format("{}", i)), static_cast<int32_t>(i % 4)));
+  }
+
+  uint32_t textureUploads = 0;
+  const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (textureUploads < RequestCount && std::chrono::steady_clock::now() < endTime)
+  {
+    const TextureStreamerFrameStats stats = streamer.Update(uploader);
+    EXPECT_EQ(0u, stats.Failed);
+    textureUploads += stats.TextureUploads;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(RequestCount, textureUploads);
+  EXPECT_EQ(RequestCount * 2u, uploader.Uploads.size());
+  for (const TextureStreamHandle handle : handles)
+  {
+    EXPECT_EQ(TextureStreamState::Ready, streamer.GetState(handle));
+  }
+}
+
+
+TEST(Test_TextureStreamer, Update_DecoderPerWorker)
+{
+  constexpr uint32_t WorkerCount = 3;
+  constexpr uint32_t RequestCount = 32;
+
+  // Each decoder records the threads that called it
+  std::mutex callLock;
+  std::vector<std::shared_ptr<std::set<std::thread::id>>> decoderThreads;
+  auto fnCreateDecoder = [&callLock, &decoderThreads]() -> TextureStreamer::DecodeFunction
+  {
+    auto threads = std::make_shared<std::set<std::thread::id>>();
+    {
+      std::lock_guard<std::mutex> lock(callLock);
+      decoderThreads.push_back(threads);
+    }
+    return [&callLock, threads](const IO::Path& absolutePath, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin)
+    {
+      {
+        std::lock_guard<std::mutex> lock(callLock);
+        threads->insert(std::this_thread::get_id());
+      }
+      return DecodeTestTexture(absolutePath, desiredPixelFormat, desiredOrigin);
+    };
+  };
+
+  {
+    TextureStreamer streamer(IO::Path("content"), fnCreateDecoder, CreateConfig(WorkerCount, 64 * 1024 * 1024));
+    RecordingUploader uploader;
+    for (uint32_t i = 0; i < RequestCount; ++i)
+    {
+      streamer.Request(IO::Path(fmt::format("{}", i)));
+    }
+
+    uint32_t textureUploads = 0;
+    const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (textureUploads < RequestCount && std::chrono::steady_clock::now() < endTime)
+    {
+      textureUploads += streamer.Update(uploader).TextureUploads;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(RequestCount, textureUploads);
+  }
+
+  std::lock_guard<std::mutex> lock(callLock);
+  EXPECT_FALSE(decoderThreads.empty());
+  EXPECT_LE(decoderThreads.size(), WorkerCount);
+  std::set<std::thread::id> allThreads;
+  for (const auto& threads : decoderThreads)
+  {
+    // A decoder is only ever called by the thread that created it
+    EXPECT_EQ(1u, threads->size());
+    EXPECT_TRUE(allThreads.insert(*threads->begin()).second);
+  }
+}
+
+
+TEST(Test_TextureStreamer, Destruct_WithPendingRequests)
+{
+  TextureStreamer streamer(IO::Path("content"), CreateTestDecoder, CreateConfig(2, 1024 * 1024));
+  for (uint32_t i = 0; i < 64; ++i)
+  {
+    streamer.Request(IO::Path("a"));
+  }
+}
@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Attributes.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
 #include <FslGraphics/PixelChannelOrder.hpp>
@@ -99,6 +100,13 @@ namespace Fsl
     //! @throws IOException if the file isn't found or something goes wrong reading it.
     virtual std::vector<uint8_t> ReadBytes(const IO::Path& relativePath) const = 0;
 
+    //! @brief Get a read only view of the entire content of the given file without copying it (the file is memory mapped when supported).
+    //! @param relativePath the relative path to load the content from
+    //         (the path is expected to be relative and will be concatenated with the GetContentPath automatically)
+    //! @return the mapped file, its content is valid for as long as the returned object is alive.
+    //! @throws IOException if the file isn't found or something goes wrong reading it.
+    virtual IO::MemoryMappedFile MapAllBytes(const IO::Path& relativePath) const = 0;
+
     //! @brief Read the requested content of the given file into a binary array.
     //! @param rTargetArray the array to load the content into. The array will be resized to fit the file content
     //! @param relativePath the relative path to load the content from
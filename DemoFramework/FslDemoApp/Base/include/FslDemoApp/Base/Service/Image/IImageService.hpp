@@ -34,6 +34,7 @@
 #include <FslBase/Attributes.hpp>
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/ImageFormat.hpp>
@@ -130,6 +131,35 @@ namespace Fsl
                                        const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
                                        const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const = 0;
 
+    //! @brief Try to decode encoded image content that is already in memory as a bitmap (for example a entry in a content archive).
+    //! @param pathHint the path the content was stored under, it is only used to detect the image format.
+    //! @param encodedContent the encoded image file content.
+    //! @param desiredPixelFormat the pixel format that the bitmap should be using. If this is PixelFormat::Undefined then the source image's format
+    //! is used.
+    //! @param desiredOrigin the origin that should be used for the bitmap. If this is BitmapOrigin::Undefined hosts default is used (see
+    //! GetPreferredBitmapOrigin).
+    //! @param preferredChannelOrder this is only used if desiredPixelFormat is PixelFormat::Undefined.
+    //! @return true if the bitmap was decoded, false if the content could not be decoded from memory.
+    [[nodiscard]] virtual bool TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat desiredPixelFormat = PixelFormat::Undefined,
+                                                 const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                                                 const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const = 0;
+
+    //! @brief Try to decode encoded image content that is already in memory as a texture (for example a entry in a content archive).
+    //! @param pathHint the path the content was stored under, it is only used to detect the image format.
+    //! @param encodedContent the encoded image file content.
+    //! @param desiredPixelFormat the pixel format that the texture should be using. If this is PixelFormat::Undefined then the source image's format
+    //! is used.
+    //! @param desiredOrigin the origin that should be used for the texture. If this is BitmapOrigin::Undefined hosts default is used (see
+    //! GetPreferredBitmapOrigin).
+    //! @param preferredChannelOrder this is only used if desiredPixelFormat is PixelFormat::Undefined.
+    //! @return true if the texture was decoded, false if the content could not be decoded from memory.
+    [[nodiscard]] virtual bool TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat desiredPixelFormat = PixelFormat::Undefined,
+                                                 const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                                                 const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const = 0;
+
+
 
     //! @brief Save the bitmap to a file of ImageFormat type and
     //!        the pixel format stored in the file is the one best matching the the bitmap pixel format.
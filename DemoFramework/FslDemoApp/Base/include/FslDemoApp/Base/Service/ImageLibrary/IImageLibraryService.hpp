@@ -34,6 +34,7 @@
 #include <FslBase/Attributes.hpp>
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/ImageFormat.hpp>
 #include <FslGraphics/PixelChannelOrder.hpp>
@@ -88,6 +89,42 @@ namespace Fsl
     [[nodiscard]] virtual bool TryRead(Texture& rTexture, const IO::Path& absolutePath, const PixelFormat pixelFormatHint,
                                        const BitmapOrigin originHint, const PixelChannelOrder preferredChannelOrderHint) = 0;
 
+    //! @brief Try to decode encoded image content that is already in memory as a bitmap (for example a entry in a content archive).
+    //! @param pathHint the path the content was stored under, it is only used to detect the image format.
+    //! @param encodedContent the encoded image file content.
+    //! @note  The hints work like they do for TryRead.
+    //! @return true on success, false if the image failed to load or the library can not decode from memory (the default).
+    [[nodiscard]] virtual bool TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                                                 const PixelChannelOrder preferredChannelOrderHint)
+    {
+      FSL_PARAM_NOT_USED(rBitmap);
+      FSL_PARAM_NOT_USED(pathHint);
+      FSL_PARAM_NOT_USED(encodedContent);
+      FSL_PARAM_NOT_USED(pixelFormatHint);
+      FSL_PARAM_NOT_USED(originHint);
+      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
+      return false;
+    }
+
+    //! @brief Try to decode encoded image content that is already in memory as a texture (for example a entry in a content archive).
+    //! @param pathHint the path the content was stored under, it is only used to detect the image format.
+    //! @param encodedContent the encoded image file content.
+    //! @note  The hints work like they do for TryRead.
+    //! @return true on success, false if the image failed to load or the library can not decode from memory (the default).
+    [[nodiscard]] virtual bool TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                                                 const PixelChannelOrder preferredChannelOrderHint)
+    {
+      FSL_PARAM_NOT_USED(rTexture);
+      FSL_PARAM_NOT_USED(pathHint);
+      FSL_PARAM_NOT_USED(encodedContent);
+      FSL_PARAM_NOT_USED(pixelFormatHint);
+      FSL_PARAM_NOT_USED(originHint);
+      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
+      return false;
+    }
+
     //! @brief Try to write the bitmap to the file.
     //! @param path the file the bitmap should be saved to.
     //! @param bitmap the bitmap to write
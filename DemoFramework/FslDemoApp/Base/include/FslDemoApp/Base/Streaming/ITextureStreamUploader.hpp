@@ -0,0 +1,55 @@
+#ifndef FSLDEMOAPP_BASE_STREAMING_ITEXTURESTREAMUPLOADER_HPP
+#define FSLDEMOAPP_BASE_STREAMING_ITEXTURESTREAMUPLOADER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDemoApp/Base/Streaming/TextureStreamHandle.hpp>
+
+namespace Fsl
+{
+  class Texture;
+
+  //! @brief Implemented by the app to move the streamed textures to the GPU
+  class ITextureStreamUploader
+  {
+  public:
+    virtual ~ITextureStreamUploader() = default;
+
+    //! @brief Upload the texture for the given handle.
+    //! @param handle the handle returned by TextureStreamer::Request
+    //! @param texture the texture to upload, only valid during the call.
+    //! @param isPlaceholder true if this is the low resolution placeholder, the full texture will be uploaded for the same handle later.
+    //! @note Called on the thread that calls TextureStreamer::Update.
+    virtual void Upload(const TextureStreamHandle handle, const Texture& texture, const bool isPlaceholder) = 0;
+  };
+}
+
+#endif
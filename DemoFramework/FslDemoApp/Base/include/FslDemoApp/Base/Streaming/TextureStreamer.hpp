@@ -0,0 +1,184 @@
+#ifndef FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMER_HPP
+#define FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamHandle.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamState.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamerConfig.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamerFrameStats.hpp>
+#include <FslGraphics/Bitmap/BitmapOrigin.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+#include <FslGraphics/Texture/Texture.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl
+{
+  class IContentManager;
+  class IImageBasicServiceInstanceFactory;
+  class ITextureStreamUploader;
+  class JobSystem;
+
+  //! @brief Streams textures from the content into the app without stalling it.
+  //!        - Requests are kept in a priority queue (highest priority first, then in request order).
+  //!          The priority can be changed until the texture has been uploaded.
+  //!        - The decode workers decode the texture and publish a low resolution placeholder before they generate the mip chain.
+  //!          The placeholder is the tail of the decoded mip chain or, if the texture has no mip maps, a point sampled copy of the top level.
+  //!          Each worker decodes with its own decoder, so the decoders do not need to be thread safe.
+  //!        - Update hands the decoded textures to a ITextureStreamUploader within a per frame byte budget, all pending placeholders are
+  //!          uploaded before any full texture so the whole scene can be rendered in low resolution as early as possible.
+  //! @note  All methods must be called from the same thread.
+  class TextureStreamer
+  {
+  public:
+    using DecodeFunction =
+      std::function<Texture(const IO::Path& absolutePath, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin)>;
+    //! Called by each decode worker before its first decode, the returned decoder is only called by that worker.
+    using CreateDecoderFunction = std::function<DecodeFunction()>;
+
+  private:
+    struct SharedRecord
+    {
+      TextureStreamState State{TextureStreamState::Queued};
+      int32_t Priority{0};
+      uint64_t Sequence{0};
+    };
+
+    struct PendingRecord
+    {
+      TextureStreamHandle Handle;
+      int32_t Priority{0};
+      uint64_t Sequence{0};
+      IO::Path AbsolutePath;
+      PixelFormat DesiredPixelFormat{PixelFormat::Undefined};
+      BitmapOrigin DesiredOrigin{BitmapOrigin::Undefined};
+    };
+
+    //! The placeholder is published in its own record before the full texture is done
+    struct DecodedRecord
+    {
+      TextureStreamHandle Handle;
+      Texture Full;
+      Texture Placeholder;
+    };
+
+    struct ReadyRecord
+    {
+      TextureStreamHandle Handle;
+      int32_t Priority{0};
+      uint64_t Sequence{0};
+      Texture Full;
+      Texture Placeholder;
+      bool IsFullUploaded{false};
+    };
+
+    TextureStreamerConfig m_config;
+    IO::Path m_contentPath;
+    CreateDecoderFunction m_fnCreateDecoder;
+
+    //! Guards the records, pending and decoded entries and the decoders, which are shared with the decode workers
+    std::mutex m_lock;
+    //! The decoder owned by each thread that has executed a decode job
+    std::unordered_map<std::thread::id, DecodeFunction> m_decoders;
+    std::unordered_map<uint32_t, SharedRecord> m_records;
+    //! A heap ordered by priority
+    std::vector<PendingRecord> m_pending;
+    std::vector<DecodedRecord> m_decoded;
+    uint32_t m_decodingCount{0};
+    uint32_t m_failedCount{0};
+
+    //! Only accessed by the thread calling Update
+    std::vector<ReadyRecord> m_ready;
+    std::vector<std::pair<TextureStreamHandle, TextureStreamState>> m_scratchStateChanges;
+    //! The failed count seen by the last Update, used to drop the placeholders of requests that failed after publishing them
+    uint32_t m_lastFailedCount{0};
+    uint32_t m_nextHandle{1};
+    uint64_t m_nextSequence{0};
+
+    std::unique_ptr<JobSystem> m_jobSystem;
+
+  public:
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    //! @brief Decode the textures on the workers, each worker uses its own image service instance created by imageServiceFactory.
+    //!        The requested paths are relative to the content manager's content path.
+    TextureStreamer(const IContentManager& contentManager, std::shared_ptr<IImageBasicServiceInstanceFactory> imageServiceFactory,
+                    const TextureStreamerConfig& config = {});
+
+    //! @brief Decode the textures using a decoder per worker created by fnCreateDecoder, the requested paths are relative to the content path.
+    //! @note  fnCreateDecoder is called from the worker threads, so it must be thread safe. The decoders it creates do not need to be.
+    TextureStreamer(IO::Path contentPath, CreateDecoderFunction fnCreateDecoder, const TextureStreamerConfig& config = {});
+
+    //! @brief Cancels all pending requests and waits for the active decodes to finish.
+    ~TextureStreamer();
+
+    const TextureStreamerConfig& GetConfig() const noexcept
+    {
+      return m_config;
+    }
+
+    //! @brief Request a texture.
+    //! @param relativePath the path relative to the content path.
+    //! @param priority higher values are decoded and uploaded first.
+    TextureStreamHandle Request(const IO::Path& relativePath, const int32_t priority = 0,
+                                const PixelFormat desiredPixelFormat = PixelFormat::Undefined,
+                                const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined);
+
+    //! @brief Change the priority of a request that has not been fully uploaded yet.
+    //! @return false if the handle is unknown.
+    bool SetPriority(const TextureStreamHandle handle, const int32_t priority);
+
+    //! @brief Cancel the request (if its still pending) and forget the handle.
+    //! @return false if the handle is unknown.
+    bool Release(const TextureStreamHandle handle);
+
+    //! @brief Get the current state of the request.
+    TextureStreamState GetState(const TextureStreamHandle handle);
+
+    //! @brief Hand the decoded textures to the uploader within the configured per frame byte budget, call this once per frame.
+    TextureStreamerFrameStats Update(ITextureStreamUploader& rUploader);
+
+  private:
+    void ProcessNextPending();
+    const DecodeFunction& GetThreadDecoder();
+    void PublishPlaceholder(const TextureStreamHandle handle, Texture placeholder);
+  };
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMERCONFIG_HPP
+#define FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMERCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/Texture/TextureMipMapFilter.hpp>
+
+namespace Fsl
+{
+  struct TextureStreamerConfig
+  {
+    //! The number of decode worker threads (zero is allowed, then one decode is done per TextureStreamer::Update call)
+    uint32_t DecodeWorkerCount{2};
+    //! The max number of bytes handed to the uploader per TextureStreamer::Update call.
+    //! A texture that is larger than the budget is still uploaded if nothing else has been uploaded during the frame, so everything will arrive.
+    uint64_t UploadBudgetBytesPerFrame{8 * 1024 * 1024};
+    //! The placeholder is the first decoded mip level where both the width and height are <= this value (and all levels below it).
+    //! For textures without decoded mip levels the top level is point sampled down to fit inside this value.
+    //! Set to zero to disable placeholders.
+    uint32_t PlaceholderMaxExtent{32};
+    //! Generate the mip chain for decoded textures that don't have one (only done for square power of two textures with a supported format)
+    bool GenerateMipMaps{true};
+    TextureMipMapFilter MipMapFilter{TextureMipMapFilter::Box};
+
+    TextureStreamerConfig() = default;
+
+    TextureStreamerConfig(const uint32_t decodeWorkerCount, const uint64_t uploadBudgetBytesPerFrame)
+      : DecodeWorkerCount(decodeWorkerCount)
+      , UploadBudgetBytesPerFrame(uploadBudgetBytesPerFrame)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMERFRAMESTATS_HPP
+#define FSLDEMOAPP_BASE_STREAMING_TEXTURESTREAMERFRAMESTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  //! @brief Statistics for one TextureStreamer::Update call
+  struct TextureStreamerFrameStats
+  {
+    //! The number of bytes handed to the uploader
+    uint64_t UploadedBytes{0};
+    //! The number of placeholders handed to the uploader
+    uint32_t PlaceholderUploads{0};
+    //! The number of full textures handed to the uploader
+    uint32_t TextureUploads{0};
+    //! The number of textures waiting for or undergoing decode
+    uint32_t PendingDecodes{0};
+    //! The number of decoded textures waiting for upload budget (this includes textures that only had their placeholder uploaded)
+    uint32_t PendingUploads{0};
+    //! The number of decodes that failed
+    uint32_t Failed{0};
+
+    constexpr TextureStreamerFrameStats() noexcept = default;
+  };
+}
+
+#endif
@@ -0,0 +1,562 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicService.hpp>
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicServiceInstanceFactory.hpp>
+#include <FslDemoApp/Base/Streaming/ITextureStreamUploader.hpp>
+#include <FslDemoApp/Base/Streaming/TextureStreamer.hpp>
+#include <FslGraphics/Bitmap/RawBitmapDownscaleUtil.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
+#include <FslGraphics/Texture/TextureMipMapUtil.hpp>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    template <typename TRecord>
+    bool IsLowerPriority(const TRecord& lhs, const TRecord& rhs) noexcept
+    {
+      // Higher priority first, then the oldest request first
+      return lhs.Priority != rhs.Priority ? lhs.Priority < rhs.Priority : lhs.Sequence > rhs.Sequence;
+    }
+
+    struct PendingCompare
+    {
+      template <typename TRecord>
+      bool operator()(const TRecord& lhs, const TRecord& rhs) const noexcept
+      {
+        return IsLowerPriority(lhs, rhs);
+      }
+    };
+
+    TextureStreamer::CreateDecoderFunction CreateImageServiceDecoderFactory(std::shared_ptr<IImageBasicServiceInstanceFactory> imageServiceFactory)
+    {
+      if (!imageServiceFactory)
+      {
+        throw std::invalid_argument("imageServiceFactory can not be null");
+      }
+      return [imageServiceFactory = std::move(imageServiceFactory)]() -> TextureStreamer::DecodeFunction
+      {
+        // Called on the worker, so each worker gets its own image service instance
+        std::shared_ptr<IImageBasicService> imageService = imageServiceFactory->CreateInstance();
+        return [imageService = std::move(imageService)](const IO::Path& absolutePath, const PixelFormat desiredPixelFormat,
+                                                        const BitmapOrigin desiredOrigin)
+        {
+          Texture texture;
+          imageService->Read(texture, absolutePath, desiredPixelFormat, desiredOrigin);
+          return texture;
+        };
+      };
+    }
+
+    bool CanGenerateMipMaps(const Texture& texture, const TextureMipMapFilter filter) noexcept
+    {
+      const PxExtent3D extent = texture.GetExtent();
+      return texture.GetLevels() == 1u && texture.GetLayers() == 1u && extent.Width == extent.Height && extent.Depth.Value == 1u &&
+             MathHelper::IsPowerOfTwo(extent.Width.Value) && extent.Width.Value > 1u &&
+             RawBitmapDownscaleUtil::IsSupported(texture.GetPixelFormat(), filter);
+    }
+
+    //! @brief Copy the tail of the mip chain starting at the first level that fits inside maxExtent
+    Texture CreateMipTailPlaceholder(const Texture& texture, const uint32_t maxExtent)
+    {
+      const uint32_t levels = texture.GetLevels();
+      uint32_t firstLevel = 0;
+      while (firstLevel < levels)
+      {
+        const PxExtent3D extent = texture.GetExtent(firstLevel);
+        if (extent.Width.Value <= maxExtent && extent.Height.Value <= maxExtent)
+        {
+          break;
+        }
+        ++firstLevel;
+      }
+      // No placeholder if the texture itself is small enough or no level is
+      if (firstLevel == 0u || firstLevel >= levels)
+      {
+        return {};
+      }
+
+      const TextureInfo textureInfo(levels - firstLevel, texture.GetFaces(), texture.GetLayers());
+      Texture placeholder(TextureBlobBuilder(texture.GetTextureType(), texture.GetExtent(firstLevel), texture.GetPixelFormat(), textureInfo,
+                                             texture.GetBitmapOrigin(), true));
+      {
+        Texture::ScopedDirectReadAccess srcAccess(texture);
+        Texture::ScopedDirectReadWriteAccess dstAccess(placeholder);
+        const ReadOnlyRawTexture& rawSrc = srcAccess.AsRawTexture();
+        RawTextureEx& rRawDst = dstAccess.AsRawTexture();
+        const auto* const pSrcStart = static_cast<const uint8_t*>(rawSrc.GetContent());
+        auto* const pDstStart = static_cast<uint8_t*>(rRawDst.GetContent());
+        for (uint32_t layer = 0; layer < textureInfo.Layers; ++layer)
+        {
+          for (uint32_t face = 0; face < textureInfo.Faces; ++face)
+          {
+            for (uint32_t level = 0; level < textureInfo.Levels; ++level)
+            {
+              const BlobRecord srcBlob = rawSrc.GetTextureBlob(firstLevel + level, face, layer);
+              const BlobRecord dstBlob = rRawDst.GetTextureBlob(level, face, layer);
+              if (srcBlob.Size != dstBlob.Size)
+              {
+                throw InternalErrorException("the placeholder blob sizes did not match");
+              }
+              std::memcpy(pDstStart + dstBlob.Offset, pSrcStart + srcBlob.Offset, dstBlob.Size);
+            }
+          }
+        }
+      }
+      return placeholder;
+    }
+
+
+    //! @brief Point sample the top level into a single level texture that fits inside maxExtent.
+    //!        This only reads the sampled pixels, so it is cheap compared to generating the mip chain.
+    Texture CreateSampledPlaceholder(const Texture& texture, const uint32_t maxExtent)
+    {
+      const PxExtent3D extent = texture.GetExtent();
+      const PixelFormat pixelFormat = texture.GetPixelFormat();
+      if (texture.GetTextureType() != TextureType::Tex2D || texture.GetLayers() != 1u || PixelFormatUtil::IsCompressed(pixelFormat) ||
+          (extent.Width.Value <= maxExtent && extent.Height.Value <= maxExtent))
+      {
+        return {};
+      }
+      const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(pixelFormat);
+      if (bytesPerPixel == 0u)
+      {
+        return {};
+      }
+
+      // Keep the aspect ratio
+      const uint32_t srcWidth = extent.Width.Value;
+      const uint32_t srcHeight = extent.Height.Value;
+      const uint64_t srcMaxExtent = std::max(srcWidth, srcHeight);
+      const auto dstWidth = std::max(UncheckedNumericCast<uint32_t>((uint64_t(srcWidth) * maxExtent) / srcMaxExtent), 1u);
+      const auto dstHeight = std::max(UncheckedNumericCast<uint32_t>((uint64_t(srcHeight) * maxExtent) / srcMaxExtent), 1u);
+
+      Texture placeholder(TextureBlobBuilder(TextureType::Tex2D, PxExtent3D::Create(dstWidth, dstHeight, 1), pixelFormat, TextureInfo(1, 1, 1),
+                                             texture.GetBitmapOrigin(), true));
+      {
+        Texture::ScopedDirectReadAccess srcAccess(texture);
+        Texture::ScopedDirectReadWriteAccess dstAccess(placeholder);
+        const ReadOnlyRawTexture& rawSrc = srcAccess.AsRawTexture();
+        RawTextureEx& rRawDst = dstAccess.AsRawTexture();
+        const BlobRecord srcBlob = rawSrc.GetTextureBlob(0, 0, 0);
+        const BlobRecord dstBlob = rRawDst.GetTextureBlob(0, 0, 0);
+        const std::size_t srcStride = srcBlob.Size / srcHeight;
+        const std::size_t dstStride = dstBlob.Size / dstHeight;
+        const auto* const pSrc = static_cast<const uint8_t*>(rawSrc.GetContent()) + srcBlob.Offset;
+        auto* const pDst = static_cast<uint8_t*>(rRawDst.GetContent()) + dstBlob.Offset;
+        for (uint32_t dstY = 0; dstY < dstHeight; ++dstY)
+        {
+          // Sample the center of the area the dst pixel covers
+          const uint64_t srcY = ((uint64_t(dstY) * 2u + 1u) * srcHeight) / (uint64_t(dstHeight) * 2u);
+          const uint8_t* const pSrcRow = pSrc + (srcY * srcStride);
+          uint8_t* const pDstRow = pDst + (dstY * dstStride);
+          for (uint32_t dstX = 0; dstX < dstWidth; ++dstX)
+          {
+            const uint64_t srcX = ((uint64_t(dstX) * 2u + 1u) * srcWidth) / (uint64_t(dstWidth) * 2u);
+            std::memcpy(pDstRow + (std::size_t(dstX) * bytesPerPixel), pSrcRow + (srcX * bytesPerPixel), bytesPerPixel);
+          }
+        }
+      }
+      return placeholder;
+    }
+
+
+    Texture CreatePlaceholder(const Texture& texture, const uint32_t maxExtent)
+    {
+      return texture.GetLevels() > 1u ? CreateMipTailPlaceholder(texture, maxExtent) : CreateSampledPlaceholder(texture, maxExtent);
+    }
+  }
+
+
+  TextureStreamer::TextureStreamer(const IContentManager& contentManager, std::shared_ptr<IImageBasicServiceInstanceFactory> imageServiceFactory,
+                                   const TextureStreamerConfig& config)
+    : TextureStreamer(contentManager.GetContentPath(), CreateImageServiceDecoderFactory(std::move(imageServiceFactory)), config)
+  {
+  }
+
+
+  TextureStreamer::TextureStreamer(IO::Path contentPath, CreateDecoderFunction fnCreateDecoder, const TextureStreamerConfig& config)
+    : m_config(config)
+    , m_contentPath(std::move(contentPath))
+    , m_fnCreateDecoder(std::move(fnCreateDecoder))
+    , m_jobSystem(std::make_unique<JobSystem>(config.DecodeWorkerCount))
+  {
+    if (!m_fnCreateDecoder)
+    {
+      throw std::invalid_argument("fnCreateDecoder can not be empty");
+    }
+  }
+
+
+  TextureStreamer::~TextureStreamer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_pending.clear();
+    }
+    // The scheduled jobs find the pending queue empty, so this only waits for the decodes that are in progress
+    m_jobSystem.reset();
+  }
+
+
+  TextureStreamHandle TextureStreamer::Request(const IO::Path& relativePath, const int32_t priority, const PixelFormat desiredPixelFormat,
+                                               const BitmapOrigin desiredOrigin)
+  {
+    if (relativePath.IsEmpty())
+    {
+      throw std::invalid_argument("relativePath can not be empty");
+    }
+
+    const TextureStreamHandle handle(m_nextHandle);
+    m_nextHandle = m_nextHandle != 0xFFFFFFFFu ? m_nextHandle + 1u : 1u;
+    const uint64_t sequence = m_nextSequence;
+    ++m_nextSequence;
+
+    PendingRecord pending{handle, priority, sequence, IO::Path::Combine(m_contentPath, relativePath), desiredPixelFormat, desiredOrigin};
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      if (!m_records.emplace(handle.Value, SharedRecord{TextureStreamState::Queued, priority, sequence}).second)
+      {
+        throw UsageErrorException("too many active requests");
+      }
+      m_pending.push_back(std::move(pending));
+      std::push_heap(m_pending.begin(), m_pending.end(), PendingCompare());
+    }
+    // Each job decodes the request with the highest priority at the time it starts, not necessarily this one
+    m_jobSystem->Schedule([this]() { ProcessNextPending(); });
+    return handle;
+  }
+
+
+  bool TextureStreamer::SetPriority(const TextureStreamHandle handle, const int32_t priority)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      auto itr = m_records.find(handle.Value);
+      if (itr == m_records.end())
+      {
+        return false;
+      }
+      itr->second.Priority = priority;
+      if (itr->second.State == TextureStreamState::Queued)
+      {
+        auto itrPending = std::find_if(m_pending.begin(), m_pending.end(), [handle](const PendingRecord& record) { return record.Handle == handle; });
+        if (itrPending != m_pending.end())
+        {
+          itrPending->Priority = priority;
+          std::make_heap(m_pending.begin(), m_pending.end(), PendingCompare());
+        }
+      }
+    }
+    for (ReadyRecord& rRecord : m_ready)
+    {
+      if (rRecord.Handle == handle)
+      {
+        rRecord.Priority = priority;
+      }
+    }
+    return true;
+  }
+
+
+  bool TextureStreamer::Release(const TextureStreamHandle handle)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      auto itr = m_records.find(handle.Value);
+      if (itr == m_records.end())
+      {
+        return false;
+      }
+      const TextureStreamState state = itr->second.State;
+      m_records.erase(itr);
+      if (state == TextureStreamState::Queued)
+      {
+        auto itrPending = std::find_if(m_pending.begin(), m_pending.end(), [handle](const PendingRecord& record) { return record.Handle == handle; });
+        if (itrPending != m_pending.end())
+        {
+          m_pending.erase(itrPending);
+          std::make_heap(m_pending.begin(), m_pending.end(), PendingCompare());
+        }
+      }
+      m_decoded.erase(std::remove_if(m_decoded.begin(), m_decoded.end(), [handle](const DecodedRecord& record) { return record.Handle == handle; }),
+                      m_decoded.end());
+    }
+    m_ready.erase(std::remove_if(m_ready.begin(), m_ready.end(), [handle](const ReadyRecord& record) { return record.Handle == handle; }),
+                  m_ready.end());
+    return true;
+  }
+
+
+  TextureStreamState TextureStreamer::GetState(const TextureStreamHandle handle)
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    auto itr = m_records.find(handle.Value);
+    return itr != m_records.end() ? itr->second.State : TextureStreamState::Unknown;
+  }
+
+
+  TextureStreamerFrameStats TextureStreamer::Update(ITextureStreamUploader& rUploader)
+  {
+    if (m_jobSystem->GetWorkerThreadCount() == 0u)
+    {
+      m_jobSystem->TryExecuteOne();
+    }
+
+    TextureStreamerFrameStats stats;
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      for (DecodedRecord& rRecord : m_decoded)
+      {
+        auto itrReady =
+          std::find_if(m_ready.begin(), m_ready.end(), [handle = rRecord.Handle](const ReadyRecord& record) { return record.Handle == handle; });
+        if (itrReady != m_ready.end())
+        {
+          // The placeholder was published before the full texture
+          itrReady->Full = std::move(rRecord.Full);
+        }
+        else
+        {
+          const SharedRecord& sharedRecord = m_records[rRecord.Handle.Value];
+          m_ready.push_back(ReadyRecord{rRecord.Handle, sharedRecord.Priority, sharedRecord.Sequence, std::move(rRecord.Full),
+                                        std::move(rRecord.Placeholder), false});
+        }
+      }
+      m_decoded.clear();
+      if (m_failedCount != m_lastFailedCount)
+      {
+        m_lastFailedCount = m_failedCount;
+        m_ready.erase(std::remove_if(m_ready.begin(), m_ready.end(),
+                                     [this](const ReadyRecord& record)
+                                     {
+                                       auto itr = m_records.find(record.Handle.Value);
+                                       return itr == m_records.end() || itr->second.State == TextureStreamState::Failed;
+                                     }),
+                      m_ready.end());
+      }
+      stats.PendingDecodes = UncheckedNumericCast<uint32_t>(m_pending.size()) + m_decodingCount;
+      stats.Failed = m_failedCount;
+    }
+
+    if (!m_ready.empty())
+    {
+      std::sort(m_ready.begin(), m_ready.end(), [](const ReadyRecord& lhs, const ReadyRecord& rhs) { return IsLowerPriority(rhs, lhs); });
+
+      const uint64_t budget = m_config.UploadBudgetBytesPerFrame;
+      m_scratchStateChanges.clear();
+
+      // The placeholders are tiny, so get all of them uploaded before spending the budget on the full textures
+      for (ReadyRecord& rRecord : m_ready)
+      {
+        if (rRecord.Placeholder.IsValid())
+        {
+          const uint64_t byteSize = rRecord.Placeholder.GetByteSize();
+          if (stats.UploadedBytes > 0u && (stats.UploadedBytes + byteSize) > budget)
+          {
+            break;
+          }
+          rUploader.Upload(rRecord.Handle, rRecord.Placeholder, true);
+          rRecord.Placeholder.Reset();
+          stats.UploadedBytes += byteSize;
+          ++stats.PlaceholderUploads;
+          m_scratchStateChanges.emplace_back(rRecord.Handle, TextureStreamState::Placeholder);
+        }
+      }
+
+      bool uploadedFull = false;
+      for (ReadyRecord& rRecord : m_ready)
+      {
+        if (rRecord.Placeholder.IsValid())
+        {
+          break;
+        }
+        if (!rRecord.Full.IsValid())
+        {
+          // Only the placeholder has arrived, the full texture is still being decoded
+          continue;
+        }
+        const uint64_t byteSize = rRecord.Full.GetByteSize();
+        if (stats.UploadedBytes > 0u && (stats.UploadedBytes + byteSize) > budget)
+        {
+          break;
+        }
+        rUploader.Upload(rRecord.Handle, rRecord.Full, false);
+        rRecord.Full.Reset();
+        rRecord.IsFullUploaded = true;
+        stats.UploadedBytes += byteSize;
+        ++stats.TextureUploads;
+        uploadedFull = true;
+        m_scratchStateChanges.emplace_back(rRecord.Handle, TextureStreamState::Ready);
+      }
+      if (uploadedFull)
+      {
+        m_ready.erase(std::remove_if(m_ready.begin(), m_ready.end(), [](const ReadyRecord& record) { return record.IsFullUploaded; }),
+                      m_ready.end());
+      }
+
+      if (!m_scratchStateChanges.empty())
+      {
+        std::lock_guard<std::mutex> lock(m_lock);
+        for (const auto& change : m_scratchStateChanges)
+        {
+          auto itr = m_records.find(change.first.Value);
+          if (itr != m_records.end())
+          {
+            itr->second.State = change.second;
+          }
+        }
+      }
+    }
+    stats.PendingUploads = UncheckedNumericCast<uint32_t>(m_ready.size());
+    return stats;
+  }
+
+
+  void TextureStreamer::ProcessNextPending()
+  {
+    PendingRecord request;
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      if (m_pending.empty())
+      {
+        return;
+      }
+      std::pop_heap(m_pending.begin(), m_pending.end(), PendingCompare());
+      request = std::move(m_pending.back());
+      m_pending.pop_back();
+      m_records[request.Handle.Value].State = TextureStreamState::Decoding;
+      ++m_decodingCount;
+    }
+
+    DecodedRecord result{request.Handle, {}, {}};
+    bool decoded = false;
+    try
+    {
+      Texture texture = GetThreadDecoder()(request.AbsolutePath, request.DesiredPixelFormat, request.DesiredOrigin);
+      if (!texture.IsValid())
+      {
+        throw GraphicsException("The decoder returned a invalid texture");
+      }
+      if (m_config.PlaceholderMaxExtent > 0u)
+      {
+        // Publish the placeholder before generating the mip chain, which is the slow part for large textures
+        PublishPlaceholder(request.Handle, CreatePlaceholder(texture, m_config.PlaceholderMaxExtent));
+      }
+      if (m_config.GenerateMipMaps && CanGenerateMipMaps(texture, m_config.MipMapFilter))
+      {
+        texture = TextureMipMapUtil::GenerateMipMaps(texture, m_config.MipMapFilter, *m_jobSystem);
+      }
+      result.Full = std::move(texture);
+      decoded = true;
+    }
+    catch (const std::exception& ex)
+    {
+      FSLLOG3_WARNING("TextureStreamer: failed to decode '{}': {}", request.AbsolutePath, ex.what());
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    --m_decodingCount;
+    auto itr = m_records.find(request.Handle.Value);
+    if (itr == m_records.end())
+    {
+      // The request was released while it was being decoded
+      return;
+    }
+    if (decoded)
+    {
+      // Don't move the state backwards if the placeholder has already been uploaded
+      if (itr->second.State == TextureStreamState::Decoding)
+      {
+        itr->second.State = TextureStreamState::Decoded;
+      }
+      m_decoded.push_back(std::move(result));
+    }
+    else
+    {
+      itr->second.State = TextureStreamState::Failed;
+      ++m_failedCount;
+      // The placeholder could have been published before the failure
+      m_decoded.erase(
+        std::remove_if(m_decoded.begin(), m_decoded.end(), [handle = request.Handle](const DecodedRecord& record) { return record.Handle == handle; }),
+        m_decoded.end());
+    }
+  }
+
+
+  const TextureStreamer::DecodeFunction& TextureStreamer::GetThreadDecoder()
+  {
+    const std::thread::id threadId = std::this_thread::get_id();
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      auto itr = m_decoders.find(threadId);
+      if (itr != m_decoders.end())
+      {
+        return itr->second;
+      }
+    }
+    // Only this thread adds its own entry, so its safe to create the decoder without holding the lock
+    DecodeFunction fnDecode = m_fnCreateDecoder();
+    if (!fnDecode)
+    {
+      throw UsageErrorException("fnCreateDecoder returned a empty decoder");
+    }
+    // References to unordered_map values stay valid when other threads insert their decoders
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_decoders.emplace(threadId, std::move(fnDecode)).first->second;
+  }
+
+
+  void TextureStreamer::PublishPlaceholder(const TextureStreamHandle handle, Texture placeholder)
+  {
+    if (!placeholder.IsValid())
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_lock);
+    // Skip it if the request was released while it was being decoded
+    if (m_records.find(handle.Value) != m_records.end())
+    {
+      m_decoded.push_back(DecodedRecord{handle, {}, std::move(placeholder)});
+    }
+  }
+}
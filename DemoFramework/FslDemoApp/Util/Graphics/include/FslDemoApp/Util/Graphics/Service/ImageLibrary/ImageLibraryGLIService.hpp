@@ -46,12 +46,15 @@ namespace Fsl
     ~ImageLibraryGLIService() final;
 
     // From IImageLibraryService
+    using IImageLibraryService::TryReadFromMemory;
     std::string GetName() const final;
     void ExtractSupportedImageFormats(std::deque<ImageFormat>& rFormats) final;
     bool TryRead(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
                  const PixelChannelOrder preferredChannelOrderHint) final;
     bool TryRead(Texture& rTexture, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
                  const PixelChannelOrder preferredChannelOrderHint) final;
+    bool TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent, const PixelFormat pixelFormatHint,
+                           const BitmapOrigin originHint, const PixelChannelOrder preferredChannelOrderHint) final;
     bool TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat, const bool allowOverwrite) final;
   };
 }
@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/NumericCast.hpp>
 #include <FslDemoApp/Base/Setup/HostDemoAppSetup.hpp>
 #include <FslDemoApp/Util/Graphics/RegisterDemoAppUtilGraphics.hpp>
 #include <FslDemoApp/Util/Graphics/Service/ImageConverter/ImageConverterLibraryBasicService.hpp>
@@ -38,14 +39,18 @@
 #include <FslDemoHost/Base/Service/BitmapConverter/BitmapConverterService.hpp>
 #include <FslDemoHost/Base/Service/Image/ImageService.hpp>
 #include <FslDemoHost/Base/Service/ImageBasic/ImageBasicService.hpp>
+#include <FslDemoHost/Base/Service/ImageBasic/ImageBasicServiceInstanceFactoryServiceFactory.hpp>
 #include <FslDemoHost/Base/Service/ServiceGroupName.hpp>
 #include <FslDemoHost/Base/Service/ServicePriorityList.hpp>
 #include <FslDemoHost/Base/Service/Texture/TextureService.hpp>
+#include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
 #include <FslService/Impl/Registry/ServiceRegistry.hpp>
 #include <FslService/Impl/ServiceType/Async/AsynchronousServiceFactory.hpp>
 #include <FslService/Impl/ServiceType/Async/AsynchronousServiceImplFactoryTemplate.hpp>
 #include <FslService/Impl/ServiceType/Async/AsynchronousServiceProxyFactoryTemplate.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalSingletonServiceFactoryTemplate.hpp>
+#include <memory>
+#include <utility>
 
 #ifdef FSL_ENABLE_DEVIL
 #include <FslDemoApp/Util/Graphics/Service/ImageLibrary/ImageLibraryServiceDevILFactory.hpp>
@@ -85,6 +90,39 @@ namespace Fsl
     ThreadLocalSingletonServiceFactoryTemplate<ImageConverterLibraryBasicService, IImageConverterService>;
 
 
+  namespace
+  {
+    //! Registers the image services in the image group and records them for the private instances created by the
+    //! IImageBasicServiceInstanceFactory
+    class ImageServiceRegistrar
+    {
+      ServiceRegistry m_serviceRegistry;
+      ServiceGroupId m_imageServiceGroup;
+      RegisteredServiceDeque m_instanceServices;
+
+    public:
+      ImageServiceRegistrar(ServiceRegistry serviceRegistry, const ServiceGroupId& imageServiceGroup)
+        : m_serviceRegistry(std::move(serviceRegistry))
+        , m_imageServiceGroup(imageServiceGroup)
+      {
+      }
+
+      template <typename TFactory>
+      void Register(const Priority& priority)
+      {
+        auto factory = std::make_shared<TFactory>();
+        m_serviceRegistry.Register(factory, priority, m_imageServiceGroup);
+        const ProviderId providerId(UncheckedNumericCast<uint32_t>(m_instanceServices.size() + 1u));
+        m_instanceServices.emplace_back(providerId, factory, priority);
+      }
+
+      RegisteredServiceDeque ExtractInstanceServices()
+      {
+        return std::move(m_instanceServices);
+      }
+    };
+  }
+
   namespace RegisterDemoAppUtilGraphics
   {
     void Setup(HostDemoAppSetup& rSetup)
@@ -113,21 +151,27 @@ namespace Fsl
       // The image service always run on the main thread
       serviceRegistry.Register<ImageServiceFactory>(ServicePriorityList::ImageService());
 
-      serviceRegistry.Register<ImageConverterLibraryBasicServiceFactory>(ServicePriorityList::ImageConverterLibraryService(), imageServiceGroup);
+      ImageServiceRegistrar imageServices(serviceRegistry, imageServiceGroup);
+      imageServices.Register<ImageConverterLibraryBasicServiceFactory>(ServicePriorityList::ImageConverterLibraryService());
 #ifdef FSL_FEATURE_IMAGECONVERTER_HDR
-      serviceRegistry.Register<ImageConverterLibraryHDRServiceFactory>(ServicePriorityList::ImageConverterLibraryService(), imageServiceGroup);
+      imageServices.Register<ImageConverterLibraryHDRServiceFactory>(ServicePriorityList::ImageConverterLibraryService());
 #endif
 
-      serviceRegistry.Register<BitmapConverterServiceFactory>(ServicePriorityList::BitmapConverterService(), imageServiceGroup);
-      serviceRegistry.Register<ImageBasicServiceFactory>(ServicePriorityList::ImageBasicService(), imageServiceGroup);
+      imageServices.Register<BitmapConverterServiceFactory>(ServicePriorityList::BitmapConverterService());
+      imageServices.Register<ImageBasicServiceFactory>(ServicePriorityList::ImageBasicService());
 #ifdef FSL_FEATURE_GLI
-      serviceRegistry.Register<ImageLibraryServiceGLIFactory>(ServicePriorityList::ImageLibraryService(), imageServiceGroup);
+      imageServices.Register<ImageLibraryServiceGLIFactory>(ServicePriorityList::ImageLibraryService());
 #endif
 #ifdef FSL_FEATURE_STB
-      serviceRegistry.Register<ImageLibraryServiceSTBFactory>(ServicePriorityList::ImageLibraryService(), imageServiceGroup);
+      imageServices.Register<ImageLibraryServiceSTBFactory>(ServicePriorityList::ImageLibraryService());
 #endif
 
+      // The instance factory runs on the main thread, but the instances it creates are used by worker threads
+      serviceRegistry.Register(std::make_shared<ImageBasicServiceInstanceFactoryServiceFactory>(imageServices.ExtractInstanceServices()),
+                               ServicePriorityList::ImageService());
+
 #ifdef FSL_ENABLE_DEVIL
+      // DevIL uses global state, so it is only registered in the image group and is not used by the private instances
       // const auto imageServiceGroup = serviceRegistry.GetServiceGroupByName(ServiceGroupName::Image());
       serviceRegistry.Register<ImageLibraryServiceDevILFactory>(ServicePriorityList::ImageLibraryService(), imageServiceGroup);
 #endif
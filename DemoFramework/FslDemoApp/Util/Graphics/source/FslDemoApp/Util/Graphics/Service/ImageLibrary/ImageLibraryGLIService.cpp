@@ -97,6 +97,91 @@ namespace Fsl
       }
       return false;
     }
+
+
+    bool TryConvertToTexture(Texture& rTexture, gli::texture& tex, const PixelFormat pixelFormatHint)
+    {
+      // Convert the gli pixel-format to something we understand
+      const auto pixelFormat = GLIConversionHelper::TryConvert(tex.format());
+      if (pixelFormat == PixelFormat::Undefined)
+      {
+        return false;
+      }
+
+      // Convert the target to texture type
+      const auto textureType = GLIConversionHelper::TryConvert(tex.target());
+      if (textureType == TextureType::Undefined)
+      {
+        return false;
+      }
+
+      // We assume that all images have a origin of UpperLeft for now
+      const BitmapOrigin currentOrigin = BitmapOrigin::UpperLeft;
+
+      try
+      {
+        if (!PixelFormatUtil::IsCompressed(pixelFormat) && pixelFormatHint != PixelFormat::Undefined && pixelFormat != pixelFormatHint)
+        {
+          // we ignore the return code for now as its not a critical error if the swizzle fails
+          TryConvert(tex, pixelFormat, pixelFormatHint);
+        }
+
+        const auto gliExtent = tex.extent();
+        auto extent = PxExtent3D::Create(gliExtent.x, gliExtent.y, gliExtent.z);
+
+        if (tex.faces() > std::numeric_limits<uint32_t>::max())
+        {
+          FSLLOG3_DEBUG_WARNING("Face count exceeded uint32_t capacity");
+          return false;
+        }
+
+        if (tex.max_level() > (std::numeric_limits<uint32_t>::max() - 1))
+        {
+          FSLLOG3_DEBUG_WARNING("levels count exceeded uint32_t capacity");
+          return false;
+        }
+        if (tex.max_layer() > (std::numeric_limits<uint32_t>::max() - 1))
+        {
+          FSLLOG3_DEBUG_WARNING("layers count exceeded uint32_t capacity");
+          return false;
+        }
+
+        const auto faces = static_cast<uint32_t>(tex.faces());
+        const auto levels = static_cast<uint32_t>(tex.max_level() + 1);
+        const auto layers = static_cast<uint32_t>(tex.max_layer() + 1);
+
+        const TextureInfo textureInfo(levels, faces, layers);
+        TextureBlobBuilder blobBuilder(textureType, extent, pixelFormat, textureInfo, currentOrigin, tex.size());
+        for (uint32_t level = 0; level < levels; ++level)
+        {
+          const auto gliLevelExtent = tex.extent(level);
+          auto levelExtent = PxExtent3D::Create(gliLevelExtent.x, gliLevelExtent.y, gliLevelExtent.z);
+          if (levelExtent != blobBuilder.GetExtent(level))
+          {
+            FSLLOG3_DEBUG_WARNING("The blobBuilder and GLI did not agree on the extent size for level: {}", level);
+            return false;
+          }
+          const auto levelSize = tex.size(level);
+          for (uint32_t layer = 0; layer < layers; ++layer)
+          {
+            for (uint32_t face = 0; face < faces; ++face)
+            {
+              const std::ptrdiff_t offsetPtrDiff =
+                static_cast<const uint8_t*>(tex.data(layer, face, level)) - static_cast<const uint8_t*>(tex.data());
+              assert(offsetPtrDiff >= 0);
+              assert(static_cast<std::size_t>(offsetPtrDiff) <= std::numeric_limits<uint32_t>::max());
+              blobBuilder.SetBlob(BlobRecord(static_cast<uint32_t>(offsetPtrDiff), levelSize), level, face, layer);
+            }
+          }
+        }
+        rTexture.Reset(tex.data(), tex.size(), std::move(blobBuilder));
+      }
+      catch (const std::exception&)
+      {
+        return false;
+      }
+      return true;
+    }
   }
 
 
@@ -199,86 +284,24 @@ namespace Fsl
     {
       return false;
     }
+    return TryConvertToTexture(rTexture, tex, pixelFormatHint);
+  }
 
-    // Convert the gli pixel-format to something we understand
-    const auto pixelFormat = GLIConversionHelper::TryConvert(tex.format());
-    if (pixelFormat == PixelFormat::Undefined)
-    {
-      return false;
-    }
-
-    // Convert the target to texture type
-    const auto textureType = GLIConversionHelper::TryConvert(tex.target());
-    if (textureType == TextureType::Undefined)
-    {
-      return false;
-    }
-
-    // We assume that all images have a origin of UpperLeft for now
-    const BitmapOrigin currentOrigin = BitmapOrigin::UpperLeft;
-
-    try
-    {
-      if (!PixelFormatUtil::IsCompressed(pixelFormat) && pixelFormatHint != PixelFormat::Undefined && pixelFormat != pixelFormatHint)
-      {
-        // we ignore the return code for now as its not a critical error if the swizzle fails
-        TryConvert(tex, pixelFormat, pixelFormatHint);
-      }
-
-      const auto gliExtent = tex.extent();
-      auto extent = PxExtent3D::Create(gliExtent.x, gliExtent.y, gliExtent.z);
-
-      if (tex.faces() > std::numeric_limits<uint32_t>::max())
-      {
-        FSLLOG3_DEBUG_WARNING("Face count exceeded uint32_t capacity");
-        return false;
-      }
-
-      if (tex.max_level() > (std::numeric_limits<uint32_t>::max() - 1))
-      {
-        FSLLOG3_DEBUG_WARNING("levels count exceeded uint32_t capacity");
-        return false;
-      }
-      if (tex.max_layer() > (std::numeric_limits<uint32_t>::max() - 1))
-      {
-        FSLLOG3_DEBUG_WARNING("layers count exceeded uint32_t capacity");
-        return false;
-      }
 
-      const auto faces = static_cast<uint32_t>(tex.faces());
-      const auto levels = static_cast<uint32_t>(tex.max_level() + 1);
-      const auto layers = static_cast<uint32_t>(tex.max_layer() + 1);
+  bool ImageLibraryGLIService::TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                                                 const PixelChannelOrder preferredChannelOrderHint)
+  {
+    FSL_PARAM_NOT_USED(pathHint);
+    FSL_PARAM_NOT_USED(originHint);
+    FSL_PARAM_NOT_USED(preferredChannelOrderHint);
 
-      const TextureInfo textureInfo(levels, faces, layers);
-      TextureBlobBuilder blobBuilder(textureType, extent, pixelFormat, textureInfo, currentOrigin, tex.size());
-      for (uint32_t level = 0; level < levels; ++level)
-      {
-        const auto gliLevelExtent = tex.extent(level);
-        auto levelExtent = PxExtent3D::Create(gliLevelExtent.x, gliLevelExtent.y, gliLevelExtent.z);
-        if (levelExtent != blobBuilder.GetExtent(level))
-        {
-          FSLLOG3_DEBUG_WARNING("The blobBuilder and GLI did not agree on the extent size for level: {}", level);
-          return false;
-        }
-        const auto levelSize = tex.size(level);
-        for (uint32_t layer = 0; layer < layers; ++layer)
-        {
-          for (uint32_t face = 0; face < faces; ++face)
-          {
-            const std::ptrdiff_t offsetPtrDiff = static_cast<const uint8_t*>(tex.data(layer, face, level)) - static_cast<const uint8_t*>(tex.data());
-            assert(offsetPtrDiff >= 0);
-            assert(static_cast<std::size_t>(offsetPtrDiff) <= std::numeric_limits<uint32_t>::max());
-            blobBuilder.SetBlob(BlobRecord(static_cast<uint32_t>(offsetPtrDiff), levelSize), level, face, layer);
-          }
-        }
-      }
-      rTexture.Reset(tex.data(), tex.size(), std::move(blobBuilder));
-    }
-    catch (const std::exception&)
+    gli::texture tex = gli::load(reinterpret_cast<const char*>(encodedContent.data()), encodedContent.size());
+    if (tex.empty())
     {
       return false;
     }
-    return true;
+    return TryConvertToTexture(rTexture, tex, pixelFormatHint);
   }
 
 
@@ -185,18 +185,8 @@ namespace Fsl
       }
     };
 
-    bool TryReadHDR(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
-                    const PixelChannelOrder preferredChannelOrderHint)
+    bool TryCreateHDRBitmap(Bitmap& rBitmap, const ScopedSTBImage<float>& imageData, const int width, const int height, const int channels)
     {
-      FSL_PARAM_NOT_USED(pixelFormatHint);
-      FSL_PARAM_NOT_USED(originHint);
-      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
-
-      int width = 0;
-      int height = 0;
-      int channels = 0;
-
-      ScopedSTBImage<float> imageData(stbi_loadf(absolutePath.ToUTF8String().c_str(), &width, &height, &channels, 0));
       if (imageData.pContent == nullptr || width < 0 || height < 0 || (channels != 3 && channels != 4))
       {
         return false;
@@ -218,18 +208,8 @@ namespace Fsl
     }
 
 
-    bool TryReadImage(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
-                      const PixelChannelOrder preferredChannelOrderHint)
+    bool TryCreateBitmap(Bitmap& rBitmap, const ScopedSTBImage<uint8_t>& imageData, const int width, const int height, const int channels)
     {
-      FSL_PARAM_NOT_USED(pixelFormatHint);
-      FSL_PARAM_NOT_USED(originHint);
-      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
-
-      int width = 0;
-      int height = 0;
-      int channels = 0;
-
-      ScopedSTBImage<uint8_t> imageData(stbi_load(absolutePath.ToUTF8String().c_str(), &width, &height, &channels, 0));
       if (imageData.pContent == nullptr || width < 0 || height < 0 || (channels != 3 && channels != 4))
       {
         return false;
@@ -249,6 +229,38 @@ namespace Fsl
         return false;
       }
     }
+
+
+    bool TryReadHDR(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                    const PixelChannelOrder preferredChannelOrderHint)
+    {
+      FSL_PARAM_NOT_USED(pixelFormatHint);
+      FSL_PARAM_NOT_USED(originHint);
+      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
+
+      int width = 0;
+      int height = 0;
+      int channels = 0;
+
+      ScopedSTBImage<float> imageData(stbi_loadf(absolutePath.ToUTF8String().c_str(), &width, &height, &channels, 0));
+      return TryCreateHDRBitmap(rBitmap, imageData, width, height, channels);
+    }
+
+
+    bool TryReadImage(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                      const PixelChannelOrder preferredChannelOrderHint)
+    {
+      FSL_PARAM_NOT_USED(pixelFormatHint);
+      FSL_PARAM_NOT_USED(originHint);
+      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
+
+      int width = 0;
+      int height = 0;
+      int channels = 0;
+
+      ScopedSTBImage<uint8_t> imageData(stbi_load(absolutePath.ToUTF8String().c_str(), &width, &height, &channels, 0));
+      return TryCreateBitmap(rBitmap, imageData, width, height, channels);
+    }
   }
 
 
@@ -309,6 +321,43 @@ namespace Fsl
   }
 
 
+  bool ImageLibrarySTBService::TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                                 const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
+                                                 const PixelChannelOrder preferredChannelOrderHint)
+  {
+    FSL_PARAM_NOT_USED(pixelFormatHint);
+    FSL_PARAM_NOT_USED(originHint);
+    FSL_PARAM_NOT_USED(preferredChannelOrderHint);
+    if (encodedContent.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    {
+      return false;
+    }
+    const auto cbEncodedContent = static_cast<int>(encodedContent.size());
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    switch (ImageFormatUtil::TryDetectImageFormatFromExtension(pathHint))
+    {
+    case ImageFormat::Hdr:
+      {
+        ScopedSTBImage<float> imageData(stbi_loadf_from_memory(encodedContent.data(), cbEncodedContent, &width, &height, &channels, 0));
+        return TryCreateHDRBitmap(rBitmap, imageData, width, height, channels);
+      }
+    case ImageFormat::Bmp:
+    case ImageFormat::Jpeg:
+    case ImageFormat::Png:
+    case ImageFormat::Tga:
+      {
+        ScopedSTBImage<uint8_t> imageData(stbi_load_from_memory(encodedContent.data(), cbEncodedContent, &width, &height, &channels, 0));
+        return TryCreateBitmap(rBitmap, imageData, width, height, channels);
+      }
+    default:
+      return false;
+    }
+  }
+
+
   bool ImageLibrarySTBService::TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat, const bool allowOverwrite)
   {
     if (!IO::Path::IsPathRooted(absolutePath))
@@ -35,10 +35,10 @@
 #include <FslBase/IO/File.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
-#include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/System/Platform/PlatformPathTransform.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoApp/Util/Graphics/Service/ImageLibrary/ImageLibraryServiceDevIL.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/Bitmap/BitmapUtil.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/IO/BMPUtil.hpp>
@@ -295,17 +295,15 @@ namespace Fsl
     };
 
 
-    void ResetObject(Bitmap& rBitmap, std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
-                     const BitmapOrigin bitmapOrigin)
+    void ResetObject(Bitmap& rBitmap, BitmapMemory&& content)
     {
-      rBitmap.Reset(std::move(content), sizePx, pixelFormat, bitmapOrigin);
+      rBitmap.Reset(std::move(content));
     }
 
 
-    void ResetObject(Texture& rTexture, std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
-                     const BitmapOrigin bitmapOrigin)
+    void ResetObject(Texture& rTexture, BitmapMemory&& content)
     {
-      rTexture.Reset(std::move(content), TypeConverter::To<PxExtent2D>(sizePx), pixelFormat, bitmapOrigin);
+      rTexture = Texture(std::move(content));
     }
 
 
@@ -391,10 +389,11 @@ namespace Fsl
 
         const std::size_t widthEx = width;
         const auto heightEx = UncheckedNumericCast<uint32_t>(height);
-        std::vector<uint8_t> content(widthEx * heightEx * bytesPerPixel);
+        BitmapMemoryBuffer content(BitmapMemoryPool::AcquireUninitialized(widthEx * heightEx * bytesPerPixel));
         ilCopyPixels(0, 0, 0, width, height, 1, activeImageFormat.Format, activeImageFormat.Type, content.data());
 
-        ResetObject(rImageContainer, std::move(content), PxSize2D::Create(width, height), activePixelFormat, bitmapOrigin);
+        ResetObject(rImageContainer,
+                    BitmapMemory::UncheckedCreate(std::move(content), PxSize2D::Create(width, height), activePixelFormat, bitmapOrigin));
       }
 
       devilError = ilGetError();
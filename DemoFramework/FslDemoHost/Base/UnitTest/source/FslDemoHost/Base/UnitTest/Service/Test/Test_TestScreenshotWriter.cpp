@@ -0,0 +1,256 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoHost/Base/Service/Test/TestScreenshotWriter.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestService_Test_TestScreenshotWriter = TestFixtureFslBase;
+
+  Bitmap CaptureInto(Bitmap&& bitmap)
+  {
+    bitmap.Reset(PxExtent2D::Create(4, 4), PixelFormat::R8G8B8A8_UNORM);
+    return std::move(bitmap);
+  }
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, Construct_InvalidArguments)
+{
+  EXPECT_THROW(TestScreenshotWriter(0, TestScreenshotQueuePolicy::Block, [](const IO::Path&, const Bitmap&) {}), std::invalid_argument);
+  EXPECT_THROW(TestScreenshotWriter(1, TestScreenshotQueuePolicy::Block, TestScreenshotWriter::WriteFunction()), std::invalid_argument);
+  EXPECT_THROW(TestScreenshotWriter(1, TestScreenshotQueuePolicy::Block, TestScreenshotWriter::CreateWriteFunction()), std::invalid_argument);
+  EXPECT_THROW(TestScreenshotWriter(1, TestScreenshotQueuePolicy::Block, []() { return TestScreenshotWriter::WriteFunction(); }),
+               std::invalid_argument);
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, Submit_Drain)
+{
+  std::mutex pathMutex;
+  std::vector<std::string> paths;
+  TestScreenshotWriter writer(2, TestScreenshotQueuePolicy::Block,
+                              [&pathMutex, &paths](const IO::Path& dstPath, const Bitmap& bitmap)
+                              {
+                                EXPECT_TRUE(bitmap.IsValid());
+                                std::lock_guard<std::mutex> lock(pathMutex);
+                                paths.push_back(dstPath.ToUTF8String());
+                              });
+
+  constexpr uint32_t Count = 10;
+  for (uint32_t i = 0; i < Count; ++i)
+  {
+    Bitmap bitmap;
+    ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+    writer.Submit(IO::Path(std::to_string(i)), CaptureInto(std::move(bitmap)));
+  }
+  writer.Drain();
+
+  const auto stats = writer.GetStats();
+  EXPECT_EQ(Count, stats.Written);
+  EXPECT_EQ(0u, stats.Failed);
+  EXPECT_EQ(0u, stats.Dropped);
+  EXPECT_EQ(Count, paths.size());
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, Submit_EncodesInParallel)
+{
+  // Each write waits until both encoder threads are writing at the same time
+  std::mutex mutex;
+  std::condition_variable condition;
+  uint32_t activeWrites = 0;
+  uint32_t maxActiveWrites = 0;
+  TestScreenshotWriter writer(2, TestScreenshotQueuePolicy::Block,
+                              [&](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/)
+                              {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                ++activeWrites;
+                                maxActiveWrites = std::max(maxActiveWrites, activeWrites);
+                                condition.notify_all();
+                                condition.wait_for(lock, std::chrono::seconds(5), [&]() { return maxActiveWrites >= 2u; });
+                                --activeWrites;
+                              });
+
+  for (uint32_t i = 0; i < 2; ++i)
+  {
+    Bitmap bitmap;
+    ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+    writer.Submit(IO::Path(std::to_string(i)), CaptureInto(std::move(bitmap)));
+  }
+  writer.Drain();
+
+  EXPECT_EQ(2u, maxActiveWrites);
+  EXPECT_EQ(2u, writer.GetStats().Written);
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, CreateWriteFunction_OnePerThread)
+{
+  // Every write function records the threads it was called on, so we can check that no write function is shared between threads
+  std::mutex mutex;
+  std::vector<std::shared_ptr<std::vector<std::thread::id>>> callers;
+  constexpr uint32_t ThreadCount = 3;
+  {
+    TestScreenshotWriter writer(ThreadCount, TestScreenshotQueuePolicy::Block,
+                                [&]() -> TestScreenshotWriter::WriteFunction
+                                {
+                                  auto threadIds = std::make_shared<std::vector<std::thread::id>>();
+                                  callers.push_back(threadIds);
+                                  return [&mutex, threadIds](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/)
+                                  {
+                                    std::lock_guard<std::mutex> lock(mutex);
+                                    threadIds->push_back(std::this_thread::get_id());
+                                  };
+                                });
+    EXPECT_EQ(ThreadCount, callers.size());
+
+    constexpr uint32_t Count = 20;
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+      Bitmap bitmap;
+      ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+      writer.Submit(IO::Path(std::to_string(i)), CaptureInto(std::move(bitmap)));
+    }
+    writer.Drain();
+    EXPECT_EQ(Count, writer.GetStats().Written);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto& threadIds : callers)
+  {
+    for (const auto& threadId : *threadIds)
+    {
+      EXPECT_EQ(threadIds->front(), threadId);
+    }
+  }
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, DropFrame_WhenAllBuffersBusy)
+{
+  std::promise<void> gate;
+  std::shared_future<void> gateFuture(gate.get_future());
+  TestScreenshotWriter writer(1, TestScreenshotQueuePolicy::DropFrame,
+                              [gateFuture](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/) { gateFuture.wait(); });
+
+  // One encoder thread means two buffers
+  Bitmap bitmap0;
+  Bitmap bitmap1;
+  Bitmap bitmap2;
+  ASSERT_TRUE(writer.TryAcquireBuffer(bitmap0));
+  writer.Submit(IO::Path("0"), CaptureInto(std::move(bitmap0)));
+  ASSERT_TRUE(writer.TryAcquireBuffer(bitmap1));
+  EXPECT_FALSE(writer.TryAcquireBuffer(bitmap2));
+  EXPECT_EQ(1u, writer.GetStats().Dropped);
+
+  writer.Release(std::move(bitmap1));
+  gate.set_value();
+  writer.Drain();
+
+  const auto stats = writer.GetStats();
+  EXPECT_EQ(1u, stats.Written);
+  EXPECT_EQ(1u, stats.Dropped);
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, Block_WaitsForBuffer)
+{
+  std::atomic<uint32_t> writeCount{0};
+  TestScreenshotWriter writer(1, TestScreenshotQueuePolicy::Block,
+                              [&writeCount](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/) { ++writeCount; });
+
+  // More screenshots than buffers, so the frame thread has to wait for the encoder
+  constexpr uint32_t Count = 8;
+  for (uint32_t i = 0; i < Count; ++i)
+  {
+    Bitmap bitmap;
+    ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+    writer.Submit(IO::Path(std::to_string(i)), CaptureInto(std::move(bitmap)));
+  }
+  writer.Drain();
+
+  EXPECT_EQ(Count, writeCount.load());
+  EXPECT_EQ(0u, writer.GetStats().Dropped);
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, WriteFailure_ReturnsBuffer)
+{
+  TestScreenshotWriter writer(1, TestScreenshotQueuePolicy::DropFrame,
+                              [](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/) { throw std::runtime_error("write failed"); });
+
+  Bitmap bitmap;
+  ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+  writer.Submit(IO::Path("0"), CaptureInto(std::move(bitmap)));
+  writer.Drain();
+  EXPECT_EQ(1u, writer.GetStats().Failed);
+
+  // Both buffers are available again
+  Bitmap bitmap0;
+  Bitmap bitmap1;
+  EXPECT_TRUE(writer.TryAcquireBuffer(bitmap0));
+  EXPECT_TRUE(writer.TryAcquireBuffer(bitmap1));
+  writer.Release(std::move(bitmap0));
+  writer.Release(std::move(bitmap1));
+}
+
+
+TEST(TestService_Test_TestScreenshotWriter, Destruct_DrainsQueue)
+{
+  std::atomic<uint32_t> writeCount{0};
+  constexpr uint32_t Count = 6;
+  {
+    TestScreenshotWriter writer(2, TestScreenshotQueuePolicy::Block,
+                                [&writeCount](const IO::Path& /*dstPath*/, const Bitmap& /*bitmap*/) { ++writeCount; });
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+      Bitmap bitmap;
+      ASSERT_TRUE(writer.TryAcquireBuffer(bitmap));
+      writer.Submit(IO::Path(std::to_string(i)), CaptureInto(std::move(bitmap)));
+    }
+  }
+  EXPECT_EQ(Count, writeCount.load());
+}
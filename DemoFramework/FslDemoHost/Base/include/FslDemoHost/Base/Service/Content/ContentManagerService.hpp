@@ -31,16 +31,21 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/Archive/ContentArchive.hpp>
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
 #include <memory>
+#include <optional>
 
 namespace Fsl
 {
+  class IHostInfo;
   class IImageService;
   class ITextureService;
 
+  //! @brief Serves the content from '<ContentPath>.fslpak' when that archive exists and falls back to the loose files in the content path.
+  //!        While the content monitor is enabled the loose files override the archive so edited content is picked up.
   class ContentManagerService final
     : public ThreadLocalService
     , public IContentManager
@@ -48,6 +53,15 @@ namespace Fsl
     IO::Path m_contentPath;
     std::shared_ptr<IImageService> m_imageService;
     std::shared_ptr<ITextureService> m_textureService;
+    std::shared_ptr<IHostInfo> m_hostInfo;
+    IO::ContentArchive m_archive;
+
+    struct ResolvedPath
+    {
+      //! The normalized content relative path, this is also the archive entry name
+      IO::Path RelativePath;
+      IO::Path AbsolutePath;
+    };
 
   public:
     ContentManagerService(const ServiceProvider& serviceProvider, const IO::Path& contentPath);
@@ -63,6 +77,7 @@ namespace Fsl
     std::vector<uint8_t> ReadAllBytes(const IO::Path& relativePath) const final;
     uint64_t ReadAllBytes(void* pDstArray, const uint64_t cbDstArray, const IO::Path& relativePath) const final;
     std::vector<uint8_t> ReadBytes(const IO::Path& relativePath) const final;
+    IO::MemoryMappedFile MapAllBytes(const IO::Path& relativePath) const final;
     void ReadBytes(std::vector<uint8_t>& rTargetArray, const IO::Path& relativePath, const uint64_t fileOffset,
                    const uint64_t bytesToRead) const final;
     uint64_t ReadBytes(void* pDstArray, const uint64_t cbDstArray, const uint64_t dstStartIndex, const IO::Path& relativePath,
@@ -90,6 +105,15 @@ namespace Fsl
     BitmapFont ReadBitmapFont(const IO::Path& relativePath) const final;
 
   private:
+    ResolvedPath Resolve(const IO::Path& relativePath) const;
+    std::optional<IO::ContentArchiveEntry> TryFindInArchive(const ResolvedPath& path) const;
+
+    //! @brief Decode the image stored in the archive entry
+    //! @return false if the image could not be decoded from memory.
+    bool TryReadFromArchive(Bitmap& rBitmap, const ResolvedPath& path, const IO::ContentArchiveEntry& entry, const PixelFormat desiredPixelFormat,
+                            const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder) const;
+    bool TryReadFromArchive(Texture& rTexture, const ResolvedPath& path, const IO::ContentArchiveEntry& entry, const PixelFormat desiredPixelFormat,
+                            const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder) const;
   };
 }
 
@@ -73,6 +73,12 @@ namespace Fsl
     bool TryRead(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat desiredPixelFormat = PixelFormat::Undefined,
                  const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
                  const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
+    bool TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                           const PixelFormat desiredPixelFormat = PixelFormat::Undefined, const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                           const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
+    bool TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                           const PixelFormat desiredPixelFormat = PixelFormat::Undefined, const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                           const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
     bool TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat = ImageFormat::Undefined,
                   const PixelFormat desiredPixelFormat = PixelFormat::Undefined) final;
     bool TryWriteExactImage(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat,
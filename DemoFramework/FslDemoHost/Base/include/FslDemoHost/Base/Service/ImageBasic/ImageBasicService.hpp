@@ -72,12 +72,20 @@ namespace Fsl
     bool TryRead(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat desiredPixelFormat = PixelFormat::Undefined,
                  const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
                  const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
+    bool TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                           const PixelFormat desiredPixelFormat = PixelFormat::Undefined, const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                           const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
+    bool TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                           const PixelFormat desiredPixelFormat = PixelFormat::Undefined, const BitmapOrigin desiredOrigin = BitmapOrigin::Undefined,
+                           const PixelChannelOrder preferredChannelOrder = PixelChannelOrder::Undefined) const final;
     bool TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat = ImageFormat::Undefined,
                   const PixelFormat desiredPixelFormat = PixelFormat::Undefined) final;
     bool TryWriteExactImage(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat,
                             const PixelFormat desiredPixelFormat = PixelFormat::Undefined) final;
 
   private:
+    void ApplyDesiredFormat(Bitmap& rBitmap, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin) const;
+    void ApplyDesiredFormat(Texture& rTexture, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin) const;
     void DoWrite(const IO::Path& absPath, const Bitmap& bitmap, const ImageFormat imageFormat);
     void DoWriteExactImage(const IO::Path& absPath, const Bitmap& bitmap, const ImageFormat imageFormat);
   };
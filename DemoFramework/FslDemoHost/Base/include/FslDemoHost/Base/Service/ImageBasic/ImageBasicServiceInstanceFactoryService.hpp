@@ -0,0 +1,58 @@
+#ifndef FSLDEMOHOST_BASE_SERVICE_IMAGEBASIC_IMAGEBASICSERVICEINSTANCEFACTORYSERVICE_HPP
+#define FSLDEMOHOST_BASE_SERVICE_IMAGEBASIC_IMAGEBASICSERVICEINSTANCEFACTORYSERVICE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicServiceInstanceFactory.hpp>
+#include <FslService/Consumer/ServiceProvider.hpp>
+#include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+
+namespace Fsl
+{
+  //! @brief Creates the instances by launching a private copy of the registered image services on the calling thread.
+  class ImageBasicServiceInstanceFactoryService final
+    : public ThreadLocalService
+    , public IImageBasicServiceInstanceFactory
+  {
+    RegisteredServiceDeque m_services;
+
+  public:
+    //! @param services the services needed by a image basic service instance (they must be safe to create and use on any thread).
+    ImageBasicServiceInstanceFactoryService(const ServiceProvider& serviceProvider, RegisteredServiceDeque services);
+    ~ImageBasicServiceInstanceFactoryService() final;
+
+    // From IImageBasicServiceInstanceFactory
+    std::shared_ptr<IImageBasicService> CreateInstance() const final;
+  };
+}
+
+#endif
@@ -32,6 +32,9 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Collections/CircularFixedSizeBuffer.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerConsumer.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerEvent.hpp>
 #include <FslDemoHost/Base/Service/Profiler/IProfilerServiceControl.hpp>
 #include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
@@ -81,6 +84,12 @@ namespace Fsl
     int32_t m_customCounterCount;
     uint32_t m_customConfigurationRevision;
 
+    IO::Path m_chromeTracePath;
+    ScopeProfilerConsumer m_traceConsumer;
+    bool m_isTraceRecording{false};
+    std::vector<ScopeProfilerEvent> m_traceEvents;
+    uint64_t m_traceDroppedEvents{0};
+
   public:
     ProfilerService(const ServiceProvider& serviceProvider, const std::shared_ptr<ProfilerServiceOptionParser>& optionParser);
     ~ProfilerService() final;
@@ -105,6 +114,8 @@ namespace Fsl
 
   private:
     inline int32_t ConvertHandleToIndex(const ProfilerCustomCounterHandle& handle) const;
+    void CollectTraceEvents();
+    void SaveChromeTrace() noexcept;
   };
 }
 
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/Path.hpp>
 #include <FslService/Impl/AServiceOptionParser.hpp>
 
 namespace Fsl
@@ -38,6 +39,7 @@ namespace Fsl
   class ProfilerServiceOptionParser final : public AServiceOptionParser
   {
     uint32_t m_averageEntries;
+    IO::Path m_chromeTracePath;
 
   public:
     ProfilerServiceOptionParser();
@@ -56,6 +58,12 @@ namespace Fsl
     {
       return m_averageEntries;
     }
+
+    //! @brief Get the path the scope profiler Chrome trace should be written to (empty if disabled)
+    const IO::Path& GetChromeTracePath() const noexcept
+    {
+      return m_chromeTracePath;
+    }
   };
 }
 
@@ -33,6 +33,7 @@
 
 #include <FslBase/BasicTypes.hpp>
 #include <FslDemoHost/Base/Service/Test/TestScreenshotNameScheme.hpp>
+#include <FslDemoHost/Base/Service/Test/TestScreenshotQueuePolicy.hpp>
 #include <FslGraphics/ImageFormat.hpp>
 #include <FslGraphics/ToneMapping/BasicToneMapper.hpp>
 #include <string>
@@ -48,6 +49,12 @@ namespace Fsl
     uint32_t Frequency{0};
     std::string FilenamePrefix;
     BasicToneMapper ToneMapper{BasicToneMapper::Clamp};
+    //! The number of background threads that encode and write the periodic screenshots in parallel.
+    //! Every thread encodes with its own image service instance.
+    //! If zero, or if no image service instance factory is registered, the screenshots are encoded and written on the frame thread.
+    uint32_t EncoderThreadCount{0};
+    //! What to do with a periodic screenshot when all the encoder buffers are busy
+    TestScreenshotQueuePolicy QueuePolicy{TestScreenshotQueuePolicy::Block};
 
     TestScreenshotConfig() = default;
 
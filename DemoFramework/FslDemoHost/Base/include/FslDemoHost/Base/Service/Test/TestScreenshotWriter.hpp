@@ -0,0 +1,127 @@
+#ifndef FSLDEMOHOST_BASE_SERVICE_TEST_TESTSCREENSHOTWRITER_HPP
+#define FSLDEMOHOST_BASE_SERVICE_TEST_TESTSCREENSHOTWRITER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslDemoHost/Base/Service/Test/TestScreenshotQueuePolicy.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Encodes and writes screenshots on a small pool of background threads so the frame thread only pays for the capture.
+  //!        The writer owns a fixed number of bitmap buffers (one more than the number of threads, so a single thread is double buffered).
+  //!        The frame thread acquires a buffer, captures into it and submits it. The buffer returns to the pool once it has been written,
+  //!        so the bitmap memory is reused for the next capture.
+  //! @note  When all buffers are busy the queue policy decides if the frame thread waits or the screenshot is dropped.
+  //!        Destroying the writer drains the queue, so every submitted screenshot is written.
+  class TestScreenshotWriter
+  {
+  public:
+    //! @brief Called on a encoder thread to write the bitmap to the given path
+    using WriteFunction = std::function<void(const IO::Path&, const Bitmap&)>;
+    //! @brief Called once per encoder thread to create the write function that thread uses.
+    //!        This lets every thread own the (non thread safe) encoder state it writes with.
+    using CreateWriteFunction = std::function<WriteFunction()>;
+
+    struct Stats
+    {
+      //! The number of screenshots written
+      uint64_t Written{0};
+      //! The number of screenshots that failed to write
+      uint64_t Failed{0};
+      //! The number of screenshots skipped because all buffers were busy
+      uint64_t Dropped{0};
+      //! The number of times the frame thread had to wait for a free buffer
+      uint64_t Stalls{0};
+    };
+
+  private:
+    struct WriteRecord
+    {
+      IO::Path DstPath;
+      Bitmap TheBitmap;
+    };
+
+    TestScreenshotQueuePolicy m_policy;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_bufferAvailable;
+    std::vector<Bitmap> m_freeBuffers;
+    std::deque<WriteRecord> m_queue;
+    uint32_t m_activeWrites{0};
+    bool m_quit{false};
+    Stats m_stats;
+    std::vector<std::thread> m_threads;
+
+  public:
+    TestScreenshotWriter(const TestScreenshotWriter&) = delete;
+    TestScreenshotWriter& operator=(const TestScreenshotWriter&) = delete;
+
+    //! @param encoderThreadCount the number of encoder threads (must be at least one)
+    //! @param fnWrite the write function shared by all encoder threads (so it must be thread safe)
+    TestScreenshotWriter(const uint32_t encoderThreadCount, const TestScreenshotQueuePolicy policy, WriteFunction fnWrite);
+
+    //! @param encoderThreadCount the number of encoder threads (must be at least one)
+    //! @param fnCreateWrite called once per encoder thread (on the calling thread) to create the write function only that thread uses
+    TestScreenshotWriter(const uint32_t encoderThreadCount, const TestScreenshotQueuePolicy policy, const CreateWriteFunction& fnCreateWrite);
+    ~TestScreenshotWriter();
+
+    //! @brief Get a free bitmap buffer to capture into.
+    //! @return true if rBitmap was assigned a buffer, false if the screenshot should be dropped (only when the policy is DropFrame).
+    //! @note  A acquired buffer must be handed back with Submit or Release.
+    bool TryAcquireBuffer(Bitmap& rBitmap);
+
+    //! @brief Queue the bitmap for writing to the given path, the bitmap buffer is returned to the pool once written.
+    void Submit(IO::Path dstPath, Bitmap&& bitmap);
+
+    //! @brief Return a acquired buffer without writing it (for example if the capture failed)
+    void Release(Bitmap&& bitmap);
+
+    //! @brief Block until all submitted screenshots have been written.
+    void Drain();
+
+    Stats GetStats() const;
+
+  private:
+    void WorkerMain(const WriteFunction& fnWrite);
+  };
+}
+
+#endif
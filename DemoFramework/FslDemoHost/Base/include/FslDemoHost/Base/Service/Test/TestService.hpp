@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslDemoHost/Base/Service/Test/ITestService.hpp>
+#include <FslBase/IO/Path.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
@@ -41,7 +42,9 @@ namespace Fsl
 {
   class IDemoAppControlEx;
   class IGraphicsService;
+  class IImageBasicServiceInstanceFactory;
   class IPersistentDataManager;
+  class TestScreenshotWriter;
 
   class TestService final
     : public ThreadLocalService
@@ -50,11 +53,19 @@ namespace Fsl
     std::shared_ptr<IDemoAppControlEx> m_demoAppControlService;
     std::shared_ptr<IPersistentDataManager> m_persistentDataManager;
     std::shared_ptr<IGraphicsService> m_graphicsService;
+    //! Creates the image service instances the screenshot writer threads encode with (optional)
+    std::shared_ptr<IImageBasicServiceInstanceFactory> m_imageServiceFactory;
     TestScreenshotConfig m_config;
     uint32_t m_frameCounter;
     uint32_t m_screenshotNameCounter;
     int32_t m_userScreenshotCount;
     Bitmap m_screenshot;
+    //! The config values the current screenshot writer was created with
+    uint32_t m_writerThreadCount{0};
+    TestScreenshotQueuePolicy m_writerQueuePolicy{TestScreenshotQueuePolicy::Block};
+    ImageFormat m_writerImageFormat{ImageFormat::Png};
+    //! Only created when the periodic screenshots are encoded on background threads (declared last so its drained first on destruction)
+    std::unique_ptr<TestScreenshotWriter> m_screenshotWriter;
 
   public:
     explicit TestService(const ServiceProvider& serviceProvider);
@@ -70,6 +81,9 @@ namespace Fsl
 
   private:
     void SaveBitmap();
+    void SaveBitmapAsync(const PixelFormat capturePixelFormat);
+    IO::Path CreateScreenshotPath();
+    void UpdateScreenshotWriter();
   };
 }
 
@@ -34,9 +34,12 @@
 #include <FslDemoApp/Base/Service/Texture/ITextureService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <memory>
 
 namespace Fsl
 {
+  class JobSystem;
+
   class TextureService final
     : public ThreadLocalService
     , public ITextureService
@@ -53,6 +56,12 @@ namespace Fsl
     Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter) final;
     Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter) final;
     Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter) final;
+
+  private:
+    //! The job system is created the first time mip maps are generated
+    JobSystem& GetJobSystem();
+
+    std::unique_ptr<JobSystem> m_jobSystem;
   };
 }
 
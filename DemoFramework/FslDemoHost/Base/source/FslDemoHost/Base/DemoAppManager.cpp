@@ -32,6 +32,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslBase/Time/TimeSpanUtil.hpp>
 #include <FslDemoApp/Base/DemoAppFirewall.hpp>
 #include <FslDemoApp/Base/FrameInfo.hpp>
@@ -194,9 +195,14 @@ namespace Fsl
 
       m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
       {
-        m_record.DemoApp->_PreUpdate(currentUpdateTime);
+        FSL_PROFILE_SCOPE("Frame.Update");
+        {
+          FSL_PROFILE_SCOPE("App.PreUpdate");
+          m_record.DemoApp->_PreUpdate(currentUpdateTime);
+        }
 
         {    // Run all missing fixed updates
+          FSL_PROFILE_SCOPE("App.FixedUpdate");
           std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
           while (fixedTime.has_value())
           {
@@ -210,9 +216,18 @@ namespace Fsl
           m_graphicsService->PreUpdate();
         }
 
-        m_record.DemoApp->_Update(currentUpdateTime);
-        m_record.DemoApp->_PostUpdate(currentUpdateTime);
-        m_record.DemoApp->_Resolve(currentUpdateTime);
+        {
+          FSL_PROFILE_SCOPE("App.Update");
+          m_record.DemoApp->_Update(currentUpdateTime);
+        }
+        {
+          FSL_PROFILE_SCOPE("App.PostUpdate");
+          m_record.DemoApp->_PostUpdate(currentUpdateTime);
+        }
+        {
+          FSL_PROFILE_SCOPE("App.Resolve");
+          m_record.DemoApp->_Resolve(currentUpdateTime);
+        }
       }
       m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
     }
@@ -226,6 +241,7 @@ namespace Fsl
 
   AppDrawResult DemoAppManager::TryDraw()
   {
+    FSL_PROFILE_SCOPE("Frame.Draw");
     FrameInfo frameInfo(m_record.FrameIndex, m_currentDemoTimeDraw);
 
     auto result = m_record.DemoApp->_TryPrepareDraw(frameInfo);
@@ -198,7 +198,7 @@ namespace Fsl
       const PixelFormat toneMapPixelFormat =
         PixelFormatUtil::HasAlphaChannel(rBitmap.GetPixelFormat()) ? PixelFormat::R32G32B32A32_SFLOAT : PixelFormat::R32G32B32_SFLOAT;
 
-      Bitmap tmpBitmap(rBitmap.GetSize(), toneMapPixelFormat, rBitmap.GetOrigin(), rBitmap.GetStrideRequirement());
+      Bitmap tmpBitmap(Bitmap::CreateUninitialized(rBitmap.GetSize(), toneMapPixelFormat, rBitmap.GetOrigin(), rBitmap.GetStrideRequirement()));
       if (TryConvertLibraries(tmpBitmap, rBitmap, converterLibraries) != ImageConvertResult::Completed)
       {
         return false;
@@ -257,7 +257,8 @@ namespace Fsl
     }
 
     // Try using one of the 'non overlapping memory' converters
-    Bitmap tmpBitmap(rBitmap.GetSize(), desiredPixelFormat, rBitmap.GetOrigin(), rBitmap.GetStrideRequirement());
+    // The converters write every pixel of the destination, so it can use uninitialized (pooled) storage
+    Bitmap tmpBitmap(Bitmap::CreateUninitialized(rBitmap.GetSize(), desiredPixelFormat, rBitmap.GetOrigin(), rBitmap.GetStrideRequirement()));
     result = TryConvertLibraries(tmpBitmap, rBitmap, SpanUtil::AsReadOnlySpan(m_converterLibraries));
     if (result == ImageConvertResult::Completed)
     {
@@ -34,6 +34,7 @@
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslDemoApp/Base/Service/Host/IHostInfo.hpp>
 #include <FslDemoApp/Base/Service/Image/IImageService.hpp>
 #include <FslDemoApp/Base/Service/Texture/ITextureService.hpp>
 #include <FslDemoHost/Base/Service/Content/ContentManagerService.hpp>
@@ -44,16 +45,48 @@
 #include <FslGraphics/TextureAtlas/BinaryTextureAtlasLoader.hpp>
 #include <fmt/format.h>
 #include <cassert>
+#include <cstring>
 #include <limits>
+#include <string_view>
 
 namespace Fsl
 {
   namespace
   {
-    IO::Path ToAbsolutePath(const IO::Path& trustedAbsPath, const IO::Path& notTrustedRelativePath)
+    IO::ContentArchive TryOpenArchive(const IO::Path& contentPath)
     {
-      assert(!trustedAbsPath.IsEmpty());
+      IO::Path archivePath(contentPath);
+      archivePath.Append(IO::ContentArchive::FileExtension);
+      if (!IO::File::Exists(archivePath))
+      {
+        return {};
+      }
+      try
+      {
+        IO::ContentArchive archive(archivePath);
+        FSLLOG3_VERBOSE("Using content archive '{}' with {} entries", archivePath, archive.GetEntryCount());
+        return archive;
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_WARNING("Failed to open content archive '{}' ({}), using the loose content files", archivePath, ex.what());
+        return {};
+      }
+    }
+
+
+    void CheckLength(const uint64_t length, const IO::Path& path)
+    {
+      if (length > std::numeric_limits<uint32_t>::max())
+      {
+        throw IOException(fmt::format(" File '{}' was larger than 4GB, which is unsupported ", path));
+      }
+    }
 
+
+    //! @brief Validate the relative path and strip the '.' segments and repeated separators so it matches the names stored in the archive.
+    IO::Path ToContentRelativePath(const IO::Path& notTrustedRelativePath)
+    {
       // Do a lot of extra validation
       if (notTrustedRelativePath.IsEmpty())
       {
@@ -68,7 +101,33 @@ namespace Fsl
         throw std::invalid_argument(fmt::format("\"..\" not allowed in the relative path: '{}'", notTrustedRelativePath));
       }
 
-      return IO::Path::Combine(trustedAbsPath, notTrustedRelativePath);
+      const std::string& src = notTrustedRelativePath.ToUTF8String();
+      std::string normalized;
+      normalized.reserve(src.size());
+      std::size_t segmentStart = 0;
+      while (segmentStart <= src.size())
+      {
+        std::size_t segmentEnd = src.find('/', segmentStart);
+        if (segmentEnd == std::string::npos)
+        {
+          segmentEnd = src.size();
+        }
+        const std::string_view segment(src.data() + segmentStart, segmentEnd - segmentStart);
+        if (!segment.empty() && segment.compare(".") != 0)
+        {
+          if (!normalized.empty())
+          {
+            normalized += '/';
+          }
+          normalized.append(segment);
+        }
+        segmentStart = segmentEnd + 1;
+      }
+      if (normalized.empty())
+      {
+        throw std::invalid_argument(fmt::format("path is invalid: '{}'", notTrustedRelativePath));
+      }
+      return IO::Path(std::move(normalized));
     }
   }
 
@@ -77,11 +136,16 @@ namespace Fsl
     , m_contentPath(contentPath)
     , m_imageService(serviceProvider.TryGet<IImageService>())        // Try to acquire the image service so we can use it if its available.
     , m_textureService(serviceProvider.TryGet<ITextureService>())    // Try to acquire the texture service so we can use it if its available.
+    , m_hostInfo(serviceProvider.TryGet<IHostInfo>())
   {
     if (!IO::Path::IsPathRooted(m_contentPath))
     {
       FSLLOG3_WARNING("The supplied path is not rooted '{}'", contentPath);
     }
+    else
+    {
+      m_archive = TryOpenArchive(m_contentPath);
+    }
   }
 
 
@@ -102,79 +166,165 @@ namespace Fsl
 
   bool ContentManagerService::Exists(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::Exists(absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    return IO::File::Exists(path.AbsolutePath) || m_archive.Contains(path.RelativePath);
   }
 
 
   uint64_t ContentManagerService::GetLength(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    const auto length = IO::File::GetLength(absPath);
-    if (length > std::numeric_limits<uint32_t>::max())
-    {
-      throw IOException(fmt::format(" File '{}' was larger than 4GB, which is unsupported ", absPath));
-    }
+    const ResolvedPath path(Resolve(relativePath));
+    const auto entry = TryFindInArchive(path);
+    const auto length = entry.has_value() ? entry->Size : IO::File::GetLength(path.AbsolutePath);
+    CheckLength(length, path.AbsolutePath);
     return length;
   }
 
 
   std::string ContentManagerService::ReadAllText(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::ReadAllText(absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      return {reinterpret_cast<const char*>(content.data()), content.size()};
+    }
+    return IO::File::ReadAllText(path.AbsolutePath);
   }
 
 
   void ContentManagerService::ReadAllBytes(std::vector<uint8_t>& rTargetArray, const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    IO::File::ReadAllBytes(rTargetArray, absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      m_archive.ReadAllBytes(rTargetArray, *entry);
+      return;
+    }
+    IO::File::ReadAllBytes(rTargetArray, path.AbsolutePath);
   }
 
 
   std::vector<uint8_t> ContentManagerService::ReadAllBytes(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::ReadAllBytes(absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      return m_archive.ReadAllBytes(*entry);
+    }
+    return IO::File::ReadAllBytes(path.AbsolutePath);
   }
 
 
   uint64_t ContentManagerService::ReadAllBytes(void* pDstArray, const uint64_t cbDstArray, const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::ReadAllBytes(pDstArray, cbDstArray, absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      if (pDstArray == nullptr)
+      {
+        throw std::invalid_argument("pDstArray can not be null");
+      }
+      if (entry->Size > cbDstArray)
+      {
+        throw IOException(fmt::format("Supplied array too small to hold '{0}'", path.AbsolutePath));
+      }
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      if (!content.empty())
+      {
+        std::memcpy(pDstArray, content.data(), content.size());
+      }
+      return content.size();
+    }
+    return IO::File::ReadAllBytes(pDstArray, cbDstArray, path.AbsolutePath);
   }
 
 
   std::vector<uint8_t> ContentManagerService::ReadBytes(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::ReadBytes(absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      return m_archive.ReadAllBytes(*entry);
+    }
+    return IO::File::ReadBytes(path.AbsolutePath);
+  }
+
+
+  IO::MemoryMappedFile ContentManagerService::MapAllBytes(const IO::Path& relativePath) const
+  {
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      return m_archive.MapAllBytes(*entry);
+    }
+    return IO::MemoryMappedFile(path.AbsolutePath);
   }
 
 
   void ContentManagerService::ReadBytes(std::vector<uint8_t>& rTargetArray, const IO::Path& relativePath, const uint64_t fileOffset,
                                         const uint64_t bytesToRead) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    IO::File::ReadBytes(rTargetArray, absPath, fileOffset, bytesToRead);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      if (fileOffset > content.size() || bytesToRead > (content.size() - fileOffset))
+      {
+        throw std::invalid_argument("can not read outside the file");
+      }
+      const auto* const pSrc = content.data() + fileOffset;
+      rTargetArray.assign(pSrc, pSrc + bytesToRead);
+      return;
+    }
+    IO::File::ReadBytes(rTargetArray, path.AbsolutePath, fileOffset, bytesToRead);
   }
 
 
   uint64_t ContentManagerService::ReadBytes(void* pDstArray, const uint64_t cbDstArray, const uint64_t dstStartIndex, const IO::Path& relativePath,
                                             const uint64_t fileOffset, const uint64_t bytesToRead) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return IO::File::ReadBytes(pDstArray, cbDstArray, dstStartIndex, absPath, fileOffset, bytesToRead);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      if (pDstArray == nullptr)
+      {
+        throw std::invalid_argument("pDstArray can not be null");
+      }
+      if (dstStartIndex > cbDstArray || bytesToRead > (cbDstArray - dstStartIndex))
+      {
+        throw std::invalid_argument("the requested number of bytes can not fit in the supplied dstArray at the given location");
+      }
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      if (fileOffset > content.size() || bytesToRead > (content.size() - fileOffset))
+      {
+        throw std::invalid_argument("can not read outside the file");
+      }
+      if (bytesToRead > 0)
+      {
+        std::memcpy(static_cast<uint8_t*>(pDstArray) + dstStartIndex, content.data() + fileOffset, bytesToRead);
+      }
+      return bytesToRead;
+    }
+    return IO::File::ReadBytes(pDstArray, cbDstArray, dstStartIndex, path.AbsolutePath, fileOffset, bytesToRead);
   }
 
 
   void ContentManagerService::Read(Bitmap& rBitmap, const IO::Path& relativePath, const PixelFormat desiredPixelFormat,
                                    const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    m_imageService->Read(rBitmap, absPath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      if (!TryReadFromArchive(rBitmap, path, *entry, desiredPixelFormat, desiredOrigin, preferredChannelOrder))
+      {
+        throw FormatException(fmt::format("Failed to decode '{}' from the content archive", path.RelativePath));
+      }
+    }
+    else
+    {
+      m_imageService->Read(rBitmap, path.AbsolutePath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    }
   }
 
 
@@ -182,8 +332,18 @@ namespace Fsl
                                    const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder,
                                    const bool generateMipMapsHint) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    m_imageService->Read(rTexture, absPath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      if (!TryReadFromArchive(rTexture, path, *entry, desiredPixelFormat, desiredOrigin, preferredChannelOrder))
+      {
+        throw FormatException(fmt::format("Failed to decode '{}' from the content archive", path.RelativePath));
+      }
+    }
+    else
+    {
+      m_imageService->Read(rTexture, path.AbsolutePath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    }
     if (generateMipMapsHint)
     {
       if (m_textureService)
@@ -208,15 +368,27 @@ namespace Fsl
 
   void ContentManagerService::Read(BasicTextureAtlas& rTextureAtlas, const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    BinaryTextureAtlasLoader::Load(rTextureAtlas, absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      BinaryTextureAtlasLoader::Decode(rTextureAtlas, content.AsReadOnlySpan());
+      return;
+    }
+    BinaryTextureAtlasLoader::Load(rTextureAtlas, path.AbsolutePath);
   }
 
 
   void ContentManagerService::Read(BasicFontKerning& rFontKerning, const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    BinaryFontBasicKerningLoader::Load(rFontKerning, absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      BinaryFontBasicKerningLoader::Decode(rFontKerning, content.AsReadOnlySpan());
+      return;
+    }
+    BinaryFontBasicKerningLoader::Load(rFontKerning, path.AbsolutePath);
   }
 
 
@@ -227,8 +399,13 @@ namespace Fsl
 
   BitmapFont ContentManagerService::ReadBitmapFont(const IO::Path& relativePath) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return BitmapFontDecoder::Load(absPath);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      const IO::MemoryMappedFile content = m_archive.MapAllBytes(*entry);
+      return BitmapFontDecoder::Decode(content.AsReadOnlySpan());
+    }
+    return BitmapFontDecoder::Load(path.AbsolutePath);
   }
 
   bool ContentManagerService::TryReadAllText(std::string& rText, const IO::Path& relativePath) const
@@ -250,8 +427,12 @@ namespace Fsl
   bool ContentManagerService::TryRead(Bitmap& rBitmap, const IO::Path& relativePath, const PixelFormat desiredPixelFormat,
                                       const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder) const
   {
-    const IO::Path absPath(ToAbsolutePath(m_contentPath, relativePath));
-    return m_imageService->TryRead(rBitmap, absPath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    const ResolvedPath path(Resolve(relativePath));
+    if (const auto entry = TryFindInArchive(path))
+    {
+      return TryReadFromArchive(rBitmap, path, *entry, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    }
+    return m_imageService->TryRead(rBitmap, path.AbsolutePath, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
   }
 
 
@@ -271,4 +452,49 @@ namespace Fsl
     Read(texture, relativePath, desiredPixelFormat, desiredOrigin, preferredChannelOrder, generateMipMapsHint);
     return texture;
   }
+
+
+  ContentManagerService::ResolvedPath ContentManagerService::Resolve(const IO::Path& relativePath) const
+  {
+    assert(!m_contentPath.IsEmpty());
+    IO::Path contentRelativePath(ToContentRelativePath(relativePath));
+    IO::Path absolutePath(IO::Path::Combine(m_contentPath, contentRelativePath));
+    return {std::move(contentRelativePath), std::move(absolutePath)};
+  }
+
+
+  std::optional<IO::ContentArchiveEntry> ContentManagerService::TryFindInArchive(const ResolvedPath& path) const
+  {
+    if (!m_archive.IsValid())
+    {
+      return {};
+    }
+    // While the content monitor is running the loose files are being edited, so they take precedence over the packed copies
+    if (m_hostInfo && m_hostInfo->GetConfig().ContentMonitor && IO::File::Exists(path.AbsolutePath))
+    {
+      return {};
+    }
+    return m_archive.TryFind(path.RelativePath);
+  }
+
+
+  bool ContentManagerService::TryReadFromArchive(Bitmap& rBitmap, const ResolvedPath& path, const IO::ContentArchiveEntry& entry,
+                                                 const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                                 const PixelChannelOrder preferredChannelOrder) const
+  {
+    // Uncompressed entries are decoded directly from the archive mapping
+    const IO::MemoryMappedFile content = m_archive.MapAllBytes(entry);
+    return m_imageService->TryReadFromMemory(rBitmap, path.RelativePath, content.AsReadOnlySpan(), desiredPixelFormat, desiredOrigin,
+                                             preferredChannelOrder);
+  }
+
+
+  bool ContentManagerService::TryReadFromArchive(Texture& rTexture, const ResolvedPath& path, const IO::ContentArchiveEntry& entry,
+                                                 const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                                 const PixelChannelOrder preferredChannelOrder) const
+  {
+    const IO::MemoryMappedFile content = m_archive.MapAllBytes(entry);
+    return m_imageService->TryReadFromMemory(rTexture, path.RelativePath, content.AsReadOnlySpan(), desiredPixelFormat, desiredOrigin,
+                                             preferredChannelOrder);
+  }
 }
@@ -31,28 +31,26 @@
 
 #include "ContentMonitorThread.hpp"
 #include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
-#include <FslBase/IO/Directory.hpp>
-#include <FslBase/IO/PathDeque.hpp>
-#include <FslBase/IO/PathWatcher.hpp>
+#include <FslBase/IO/DirectoryWatcher.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/System/IThreadContext.hpp>
 #include <FslBase/System/Threading/Thread.hpp>
 #include <cassert>
+#include <chrono>
 #include <utility>
+#include <vector>
 
 namespace Fsl
 {
   namespace
   {
-    void AddCurrentContentFiles(IO::PathWatcher& rPathWatcher, const IO::Path& contentPath)
+    namespace LocalConfig
     {
-      IO::PathDeque files;
-      IO::Directory::GetFiles(files, contentPath, IO::SearchOptions::AllDirectories);
-
-      for (auto itr = files.begin(); itr != files.end(); ++itr)
-      {
-        rPathWatcher.Add(**itr);
-      }
+      //! The interval used by the polling fallback
+      constexpr std::chrono::milliseconds PollInterval(1000 / 5);
+      //! The max time we block waiting for a platform change notification before checking for cancellation
+      constexpr std::chrono::milliseconds NotificationWaitTime(100);
     }
 
 
@@ -73,19 +71,28 @@ namespace Fsl
 
       void Run()
       {
-        IO::PathWatcher pathWatcher;
-        AddCurrentContentFiles(pathWatcher, m_contentPath);
+        IO::DirectoryWatcher watcher(m_contentPath, IO::SearchOptions::AllDirectories);
+        const bool useNotifications = watcher.GetBackend() == IO::DirectoryWatcherBackend::Platform;
+        FSLLOG3_VERBOSE("ContentMonitor: using {}", useNotifications ? "platform change notifications" : "polling");
+
+        // When using notifications the watcher does the waiting, so we just peek at the cancellation queue
+        const std::chrono::milliseconds cancelWaitTime = useNotifications ? std::chrono::milliseconds(0) : LocalConfig::PollInterval;
+        const std::chrono::milliseconds changeWaitTime = useNotifications ? LocalConfig::NotificationWaitTime : std::chrono::milliseconds(0);
 
         // As we use the queue as a cancellation token this means that if a message is in it we should shutdown
         bool queueEntry = false;
         bool stopNow = false;
-        while (!stopNow && !m_toQueue->TryDequeueWait(queueEntry, std::chrono::milliseconds(1000 / 5)))
+        std::vector<IO::Path> changedPaths;
+        while (!stopNow && !m_toQueue->TryDequeueWait(queueEntry, cancelWaitTime))
         {
-          // A even better solution will use the 'platform dependent' filesystem change notification interfaces.
-          // But that will also require more development time.
-
-          if (pathWatcher.Check())
+          changedPaths.clear();
+          if (watcher.TryGetChanges(changedPaths, changeWaitTime))
           {
+            for (const auto& changedPath : changedPaths)
+            {
+              FSLLOG3_VERBOSE2("ContentMonitor: '{}' changed", changedPath);
+            }
+
             std::shared_ptr<ConcurrentQueue<ContentMonitorResultCommand>> ownerQueue = m_ownerQueue.lock();
             if (ownerQueue)
             {
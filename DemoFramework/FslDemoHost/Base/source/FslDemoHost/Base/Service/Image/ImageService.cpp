@@ -198,6 +198,34 @@ namespace Fsl
   }
 
 
+  bool ImageService::TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                       const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                       const PixelChannelOrder preferredChannelOrder) const
+  {
+    if (!m_imageBasic)
+    {
+      // The async image service only works on files
+      return false;
+    }
+    const auto usedOrigin = (desiredOrigin != BitmapOrigin::Undefined ? desiredOrigin : m_bitmapOrigin);
+    return m_imageBasic->TryReadFromMemory(rBitmap, pathHint, encodedContent, desiredPixelFormat, usedOrigin, preferredChannelOrder);
+  }
+
+
+  bool ImageService::TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                       const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                       const PixelChannelOrder preferredChannelOrder) const
+  {
+    if (!m_imageBasic)
+    {
+      // The async image service only works on files
+      return false;
+    }
+    const auto usedOrigin = (desiredOrigin != BitmapOrigin::Undefined ? desiredOrigin : m_bitmapOrigin);
+    return m_imageBasic->TryReadFromMemory(rTexture, pathHint, encodedContent, desiredPixelFormat, usedOrigin, preferredChannelOrder);
+  }
+
+
   bool ImageService::TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat)
   {
     if (!IO::Path::IsPathRooted(absolutePath))
@@ -167,18 +167,7 @@ namespace Fsl
       throw NotSupportedException(fmt::format("None of the available image libraries could load: '{}'", absolutePath));
     }
 
-    const auto usedDesiredPixelFormat = (desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : rBitmap.GetPixelFormat());
-
-    if (rBitmap.GetPixelFormat() != usedDesiredPixelFormat || rBitmap.GetOrigin() != desiredOrigin)
-    {
-      m_bitmapConverter->Convert(rBitmap, usedDesiredPixelFormat, desiredOrigin);
-    }
-
-    // When loading a undefined pixel format we prefer the unorm variant
-    if (desiredPixelFormat == PixelFormat::Undefined)
-    {
-      rBitmap.TrySetCompatiblePixelFormatFlag(PixelFormatFlags::NF_UNorm);
-    }
+    ApplyDesiredFormat(rBitmap, desiredPixelFormat, desiredOrigin);
   }
 
 
@@ -233,24 +222,7 @@ namespace Fsl
       rTexture = ContainerTypeConvert::Convert(std::move(tmpBitmap));
     }
 
-    const bool isCompressed = PixelFormatUtil::IsCompressed(rTexture.GetPixelFormat());
-    if (isCompressed && desiredOrigin != BitmapOrigin::Undefined && rTexture.GetBitmapOrigin() != desiredOrigin)
-    {
-      throw NotSupportedException("The origin of compressed formats can not be modified");
-    }
-
-    const auto usedDesiredPixelFormat = (desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : rTexture.GetPixelFormat());
-
-    if (rTexture.GetPixelFormat() != usedDesiredPixelFormat || rTexture.GetBitmapOrigin() != desiredOrigin)
-    {
-      m_bitmapConverter->Convert(rTexture, usedDesiredPixelFormat, desiredOrigin);
-    }
-
-    // When loading a undefined pixel format we prefer the unorm variant
-    if (desiredPixelFormat == PixelFormat::Undefined)
-    {
-      rTexture.TrySetCompatiblePixelFormatFlag(PixelFormatFlags::NF_UNorm);
-    }
+    ApplyDesiredFormat(rTexture, desiredPixelFormat, desiredOrigin);
   }
 
 
@@ -334,6 +306,88 @@ namespace Fsl
   }
 
 
+  bool ImageBasicService::TryReadFromMemory(Bitmap& rBitmap, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                            const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                            const PixelChannelOrder preferredChannelOrder) const
+  {
+    bool isLoaded = false;
+
+    // Same strategy as Read, try the libraries that support the format first then all of them
+    const ImageFormat imageFormatBasedOnExt = ImageFormatUtil::TryDetectImageFormatFromExtension(pathHint);
+    const auto itrFind = m_formatToImageLibrary.find(imageFormatBasedOnExt);
+    if (itrFind != m_formatToImageLibrary.end())
+    {
+      for (auto itr = itrFind->second->begin(); !isLoaded && itr != itrFind->second->end(); ++itr)
+      {
+        isLoaded = (*itr)->TryReadFromMemory(rBitmap, pathHint, encodedContent, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+      }
+    }
+    for (auto itr = m_imageLibraryServices.begin(); !isLoaded && itr != m_imageLibraryServices.end(); ++itr)
+    {
+      isLoaded = (*itr)->TryReadFromMemory(rBitmap, pathHint, encodedContent, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    }
+    if (!isLoaded)
+    {
+      return false;
+    }
+
+    try
+    {
+      ApplyDesiredFormat(rBitmap, desiredPixelFormat, desiredOrigin);
+      return true;
+    }
+    catch (const std::exception& ex)
+    {
+      FSL_PARAM_NOT_USED(ex);
+      FSLLOG3_DEBUG_WARNING("TryReadFromMemory failed with {}", ex.what());
+      return false;
+    }
+  }
+
+
+  bool ImageBasicService::TryReadFromMemory(Texture& rTexture, const IO::Path& pathHint, const ReadOnlySpan<uint8_t> encodedContent,
+                                            const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin,
+                                            const PixelChannelOrder preferredChannelOrder) const
+  {
+    bool isLoaded = false;
+
+    const ImageFormat imageFormatBasedOnExt = ImageFormatUtil::TryDetectImageFormatFromExtension(pathHint);
+    const auto itrFind = m_formatToImageLibrary.find(imageFormatBasedOnExt);
+    if (itrFind != m_formatToImageLibrary.end())
+    {
+      for (auto itr = itrFind->second->begin(); !isLoaded && itr != itrFind->second->end(); ++itr)
+      {
+        isLoaded = (*itr)->TryReadFromMemory(rTexture, pathHint, encodedContent, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+      }
+    }
+    for (auto itr = m_imageLibraryServices.begin(); !isLoaded && itr != m_imageLibraryServices.end(); ++itr)
+    {
+      isLoaded = (*itr)->TryReadFromMemory(rTexture, pathHint, encodedContent, desiredPixelFormat, desiredOrigin, preferredChannelOrder);
+    }
+
+    try
+    {
+      if (!isLoaded)
+      {
+        Bitmap tmpBitmap;
+        if (!TryReadFromMemory(tmpBitmap, pathHint, encodedContent, desiredPixelFormat, desiredOrigin, preferredChannelOrder))
+        {
+          return false;
+        }
+        rTexture = ContainerTypeConvert::Convert(std::move(tmpBitmap));
+      }
+      ApplyDesiredFormat(rTexture, desiredPixelFormat, desiredOrigin);
+      return true;
+    }
+    catch (const std::exception& ex)
+    {
+      FSL_PARAM_NOT_USED(ex);
+      FSLLOG3_DEBUG_WARNING("TryReadFromMemory failed with {}", ex.what());
+      return false;
+    }
+  }
+
+
   bool ImageBasicService::TryWrite(const IO::Path& absolutePath, const Bitmap& bitmap, const ImageFormat imageFormat,
                                    const PixelFormat desiredPixelFormat)
   {
@@ -383,6 +437,46 @@ namespace Fsl
   }
 
 
+  void ImageBasicService::ApplyDesiredFormat(Bitmap& rBitmap, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin) const
+  {
+    const auto usedDesiredPixelFormat = (desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : rBitmap.GetPixelFormat());
+
+    if (rBitmap.GetPixelFormat() != usedDesiredPixelFormat || rBitmap.GetOrigin() != desiredOrigin)
+    {
+      m_bitmapConverter->Convert(rBitmap, usedDesiredPixelFormat, desiredOrigin);
+    }
+
+    // When loading a undefined pixel format we prefer the unorm variant
+    if (desiredPixelFormat == PixelFormat::Undefined)
+    {
+      rBitmap.TrySetCompatiblePixelFormatFlag(PixelFormatFlags::NF_UNorm);
+    }
+  }
+
+
+  void ImageBasicService::ApplyDesiredFormat(Texture& rTexture, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin) const
+  {
+    const bool isCompressed = PixelFormatUtil::IsCompressed(rTexture.GetPixelFormat());
+    if (isCompressed && desiredOrigin != BitmapOrigin::Undefined && rTexture.GetBitmapOrigin() != desiredOrigin)
+    {
+      throw NotSupportedException("The origin of compressed formats can not be modified");
+    }
+
+    const auto usedDesiredPixelFormat = (desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : rTexture.GetPixelFormat());
+
+    if (rTexture.GetPixelFormat() != usedDesiredPixelFormat || rTexture.GetBitmapOrigin() != desiredOrigin)
+    {
+      m_bitmapConverter->Convert(rTexture, usedDesiredPixelFormat, desiredOrigin);
+    }
+
+    // When loading a undefined pixel format we prefer the unorm variant
+    if (desiredPixelFormat == PixelFormat::Undefined)
+    {
+      rTexture.TrySetCompatiblePixelFormatFlag(PixelFormatFlags::NF_UNorm);
+    }
+  }
+
+
   void ImageBasicService::DoWrite(const IO::Path& absPath, const Bitmap& bitmap, const ImageFormat imageFormat)
   {
     // If there is a image service available for the format
@@ -0,0 +1,76 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicService.hpp>
+#include <FslDemoHost/Base/Service/ImageBasic/ImageBasicServiceInstanceFactoryService.hpp>
+#include <FslService/Consumer/IServiceProvider.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    struct InstanceRecord
+    {
+      //! Owns the private services, so it must outlive the service
+      std::shared_ptr<IServiceProvider> Provider;
+      std::shared_ptr<IImageBasicService> Service;
+    };
+  }
+
+
+  ImageBasicServiceInstanceFactoryService::ImageBasicServiceInstanceFactoryService(const ServiceProvider& serviceProvider,
+                                                                                   RegisteredServiceDeque services)
+    : ThreadLocalService(serviceProvider)
+    , m_services(std::move(services))
+  {
+  }
+
+
+  ImageBasicServiceInstanceFactoryService::~ImageBasicServiceInstanceFactoryService() = default;
+
+
+  std::shared_ptr<IImageBasicService> ImageBasicServiceInstanceFactoryService::CreateInstance() const
+  {
+    auto record = std::make_shared<InstanceRecord>();
+    record->Provider = ServiceLauncher::LaunchPrivate(m_services);
+    record->Service = ServiceProvider(record->Provider).Get<IImageBasicService>();
+    if (!record->Service)
+    {
+      throw UsageErrorException("The private services did not provide a IImageBasicService");
+    }
+    IImageBasicService* const pService = record->Service.get();
+    // Share the ownership of the record, so the private services live as long as the returned service
+    return {std::move(record), pService};
+  }
+}
@@ -30,8 +30,12 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Profiler/ChromeTraceUtil.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerService.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
@@ -46,6 +50,8 @@ namespace Fsl
     namespace LocalConfig
     {
       constexpr uint16_t MaxCustomCounters = 20;
+      //! Stop recording the trace once it contains this many zones (roughly 128MB)
+      constexpr std::size_t MaxTraceEvents = 4 * 1024 * 1024;
     }
 
     inline int32_t CapTime(const uint64_t value)
@@ -61,15 +67,33 @@ namespace Fsl
     , m_customCounters(LocalConfig::MaxCustomCounters)
     , m_customCounterCount(0)
     , m_customConfigurationRevision(1)
+    , m_chromeTracePath(optionParser->GetChromeTracePath())
   {
     for (uint16_t i = 0; i < static_cast<uint16_t>(m_customCounters.size()); ++i)
     {
       m_customCounters[i].RealIndex = i;
     }
+
+    if (!m_chromeTracePath.IsEmpty())
+    {
+      FSLLOG3_INFO("Recording profiler zones to Chrome trace: '{}'", m_chromeTracePath);
+#ifdef FSL_SCOPE_PROFILER_DISABLED
+      FSLLOG3_WARNING("The profiler zones were compiled out (ScopeProfiler=Disabled), the Chrome trace will only contain manually recorded zones");
+#endif
+      m_traceConsumer.BeginRecording();
+      m_isTraceRecording = true;
+    }
   }
 
 
-  ProfilerService::~ProfilerService() = default;
+  ProfilerService::~ProfilerService()
+  {
+    if (!m_chromeTracePath.IsEmpty())
+    {
+      m_traceConsumer.EndRecording();
+      SaveChromeTrace();
+    }
+  }
 
 
   ProfilerFrameTime ProfilerService::GetLastFrameTime() const
@@ -233,6 +257,11 @@ namespace Fsl
     m_combinedTime.UpdateTime += cappedUpdateTime;
     m_combinedTime.DrawTime += cappedDrawTime;
     m_combinedTime.TotalTime += cappedTotalTime;
+
+    if (m_isTraceRecording)
+    {
+      CollectTraceEvents();
+    }
   }
 
 
@@ -248,4 +277,33 @@ namespace Fsl
 
     return UncheckedNumericCast<int32_t>(handleIndex);
   }
+
+
+  void ProfilerService::CollectTraceEvents()
+  {
+    m_traceDroppedEvents += m_traceConsumer.Collect(m_traceEvents);
+    if (m_traceEvents.size() >= LocalConfig::MaxTraceEvents)
+    {
+      FSLLOG3_WARNING("Chrome trace reached its capacity of {} zones, recording stopped", LocalConfig::MaxTraceEvents);
+      m_traceConsumer.EndRecording();
+      m_isTraceRecording = false;
+    }
+  }
+
+
+  void ProfilerService::SaveChromeTrace() noexcept
+  {
+    try
+    {
+      CollectTraceEvents();
+      const auto threads = ScopeProfiler::GetThreads();
+      ChromeTraceUtil::Save(m_chromeTracePath, SpanUtil::AsReadOnlySpan(m_traceEvents), SpanUtil::AsReadOnlySpan(threads));
+      FSLLOG3_INFO("Chrome trace with {} zones written to '{}'", m_traceEvents.size(), m_chromeTracePath);
+      FSLLOG3_WARNING_IF(m_traceDroppedEvents > 0, "Chrome trace: {} zones were dropped as a thread buffer was full", m_traceDroppedEvents);
+    }
+    catch (const std::exception& ex)
+    {
+      FSLLOG3_ERROR("Failed to write Chrome trace '{}': {}", m_chromeTracePath, ex.what());
+    }
+  }
 }
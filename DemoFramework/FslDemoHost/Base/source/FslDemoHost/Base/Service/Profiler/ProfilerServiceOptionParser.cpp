@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/String/StringParseUtil.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
 #include <fmt/format.h>
@@ -51,6 +52,7 @@ namespace Fsl
       enum Enum
       {
         AverageEntries,
+        ChromeTrace,
       };
     };
   }
@@ -66,6 +68,9 @@ namespace Fsl
   {
     rOptions.emplace_back("Profiler.AverageEntries", OptionArgument::OptionRequired, CommandId::AverageEntries,
                           fmt::format("The number of frames used to calculate the average frame-time. Defaults to: {}", LocalConfig::DefaultEntries));
+    rOptions.emplace_back("Profiler.ChromeTrace", OptionArgument::OptionRequired, CommandId::ChromeTrace,
+                          "Record the CPU profiler zones and write them to the given file as a Chrome trace JSON file when the app exits. "
+                          "The file can be viewed with chrome://tracing or https://ui.perfetto.dev");
   }
 
 
@@ -79,6 +84,14 @@ namespace Fsl
         m_averageEntries = std::max(m_averageEntries, 1u);
         return OptionParseResult::Parsed;
       }
+    case CommandId::ChromeTrace:
+      if (strOptArg.empty())
+      {
+        FSLLOG3_ERROR("Profiler.ChromeTrace requires a filename");
+        return OptionParseResult::Failed;
+      }
+      m_chromeTracePath = IO::Path(strOptArg);
+      return OptionParseResult::Parsed;
     default:
       return OptionParseResult::NotHandled;
     }
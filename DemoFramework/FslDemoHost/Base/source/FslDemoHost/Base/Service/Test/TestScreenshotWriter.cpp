@@ -0,0 +1,230 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslDemoHost/Base/Service/Test/TestScreenshotWriter.hpp>
+#include <cassert>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  namespace
+  {
+    TestScreenshotWriter::CreateWriteFunction ShareWriteFunction(TestScreenshotWriter::WriteFunction fnWrite)
+    {
+      if (!fnWrite)
+      {
+        throw std::invalid_argument("fnWrite can not be empty");
+      }
+      return [fnWrite = std::move(fnWrite)]() { return fnWrite; };
+    }
+  }
+
+
+  TestScreenshotWriter::TestScreenshotWriter(const uint32_t encoderThreadCount, const TestScreenshotQueuePolicy policy, WriteFunction fnWrite)
+    : TestScreenshotWriter(encoderThreadCount, policy, ShareWriteFunction(std::move(fnWrite)))
+  {
+  }
+
+
+  TestScreenshotWriter::TestScreenshotWriter(const uint32_t encoderThreadCount, const TestScreenshotQueuePolicy policy,
+                                             const CreateWriteFunction& fnCreateWrite)
+    : m_policy(policy)
+  {
+    if (encoderThreadCount < 1u)
+    {
+      throw std::invalid_argument("encoderThreadCount must be at least one");
+    }
+    if (!fnCreateWrite)
+    {
+      throw std::invalid_argument("fnCreateWrite can not be empty");
+    }
+
+    // Create the write functions before any thread is started so a failure leaves nothing to clean up
+    std::vector<WriteFunction> writeFunctions(encoderThreadCount);
+    for (auto& rFnWrite : writeFunctions)
+    {
+      rFnWrite = fnCreateWrite();
+      if (!rFnWrite)
+      {
+        throw std::invalid_argument("fnCreateWrite returned a empty write function");
+      }
+    }
+
+    // One buffer per encoder thread plus one for the frame thread to capture into
+    m_freeBuffers.resize(encoderThreadCount + 1u);
+
+    m_threads.reserve(encoderThreadCount);
+    try
+    {
+      for (auto& rFnWrite : writeFunctions)
+      {
+        m_threads.emplace_back([this, fnWrite = std::move(rFnWrite)]() { WorkerMain(fnWrite); });
+      }
+    }
+    catch (const std::exception&)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+      }
+      m_workAvailable.notify_all();
+      for (auto& rThread : m_threads)
+      {
+        rThread.join();
+      }
+      throw;
+    }
+  }
+
+
+  TestScreenshotWriter::~TestScreenshotWriter()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_quit = true;
+    }
+    m_workAvailable.notify_all();
+    // The workers empty the queue before they exit
+    for (auto& rThread : m_threads)
+    {
+      rThread.join();
+    }
+
+    FSLLOG3_WARNING_IF(m_stats.Dropped > 0u || m_stats.Failed > 0u, "Screenshots written: {}, dropped: {}, failed: {}", m_stats.Written,
+                       m_stats.Dropped, m_stats.Failed);
+  }
+
+
+  bool TestScreenshotWriter::TryAcquireBuffer(Bitmap& rBitmap)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_freeBuffers.empty())
+    {
+      if (m_policy == TestScreenshotQueuePolicy::DropFrame)
+      {
+        ++m_stats.Dropped;
+        return false;
+      }
+      ++m_stats.Stalls;
+      m_bufferAvailable.wait(lock, [this]() { return !m_freeBuffers.empty(); });
+    }
+    rBitmap = std::move(m_freeBuffers.back());
+    m_freeBuffers.pop_back();
+    return true;
+  }
+
+
+  void TestScreenshotWriter::Submit(IO::Path dstPath, Bitmap&& bitmap)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_queue.push_back(WriteRecord{std::move(dstPath), std::move(bitmap)});
+    }
+    m_workAvailable.notify_one();
+  }
+
+
+  void TestScreenshotWriter::Release(Bitmap&& bitmap)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_freeBuffers.push_back(std::move(bitmap));
+    }
+    m_bufferAvailable.notify_one();
+  }
+
+
+  void TestScreenshotWriter::Drain()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_bufferAvailable.wait(lock, [this]() { return m_queue.empty() && m_activeWrites == 0u; });
+  }
+
+
+  TestScreenshotWriter::Stats TestScreenshotWriter::GetStats() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+  }
+
+
+  void TestScreenshotWriter::WorkerMain(const WriteFunction& fnWrite)
+  {
+    ScopeProfiler::SetThreadName("Screenshot encoder");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      m_workAvailable.wait(lock, [this]() { return m_quit || !m_queue.empty(); });
+      if (m_queue.empty())
+      {
+        assert(m_quit);
+        return;
+      }
+
+      WriteRecord record = std::move(m_queue.front());
+      m_queue.pop_front();
+      ++m_activeWrites;
+      lock.unlock();
+
+      bool success = true;
+      try
+      {
+        FSL_PROFILE_SCOPE("Screenshot.Encode");
+        fnWrite(record.DstPath, record.TheBitmap);
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_ERROR("Failed to write screenshot '{}': {}", record.DstPath, ex.what());
+        success = false;
+      }
+
+      lock.lock();
+      --m_activeWrites;
+      if (success)
+      {
+        ++m_stats.Written;
+      }
+      else
+      {
+        ++m_stats.Failed;
+      }
+      m_freeBuffers.push_back(std::move(record.TheBitmap));
+      // Drain and TryAcquireBuffer both wait on this condition
+      m_bufferAvailable.notify_all();
+    }
+  }
+}
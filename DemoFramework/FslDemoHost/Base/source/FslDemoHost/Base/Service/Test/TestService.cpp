@@ -31,15 +31,20 @@
 
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicService.hpp>
+#include <FslDemoApp/Base/Service/ImageBasic/IImageBasicServiceInstanceFactory.hpp>
 #include <FslDemoApp/Base/Service/Persistent/IPersistentDataManager.hpp>
 #include <FslDemoHost/Base/Service/DemoAppControl/IDemoAppControlEx.hpp>
+#include <FslDemoHost/Base/Service/Test/TestScreenshotWriter.hpp>
 #include <FslDemoHost/Base/Service/Test/TestService.hpp>
 #include <FslDemoService/Graphics/IGraphicsService.hpp>
 #include <FslGraphics/ImageFormatUtil.hpp>
 #include <fmt/format.h>
 #include <cassert>
 #include <iomanip>
+#include <utility>
 
 namespace Fsl
 {
@@ -66,6 +71,7 @@ namespace Fsl
     m_demoAppControlService = serviceProvider.Get<IDemoAppControlEx>();
     m_persistentDataManager = serviceProvider.Get<IPersistentDataManager>();
     m_graphicsService = serviceProvider.TryGet<IGraphicsService>();
+    m_imageServiceFactory = serviceProvider.TryGet<IImageBasicServiceInstanceFactory>();
   }
 
 
@@ -81,6 +87,7 @@ namespace Fsl
   void TestService::SetScreenshotFrequency(const uint32_t frequency)
   {
     m_config.Frequency = frequency;
+    UpdateScreenshotWriter();
   }
 
 
@@ -99,6 +106,7 @@ namespace Fsl
   void TestService::SetScreenshotConfig(const TestScreenshotConfig& config)
   {
     m_config = config;
+    UpdateScreenshotWriter();
   }
 
 
@@ -123,6 +131,13 @@ namespace Fsl
       const auto colorSpaceType = m_graphicsService->GetColorSpaceType();
       const auto capturePixelFormat = DetermineSaveFormat(m_config.Format, colorSpaceType);
 
+      if (m_screenshotWriter && !hasRequest)
+      {
+        // Periodic screenshots are encoded and written by the background writer
+        SaveBitmapAsync(capturePixelFormat);
+        return;
+      }
+
       // Capture a screenshot and save it in the request format
       m_graphicsService->Capture(m_screenshot, capturePixelFormat, m_config.ToneMapper);
 
@@ -158,6 +173,44 @@ namespace Fsl
 
 
   void TestService::SaveBitmap()
+  {
+    m_persistentDataManager->Write(CreateScreenshotPath(), m_screenshot, m_config.Format);
+  }
+
+
+  void TestService::SaveBitmapAsync(const PixelFormat capturePixelFormat)
+  {
+    assert(m_screenshotWriter);
+    Bitmap bitmap;
+    if (!m_screenshotWriter->TryAcquireBuffer(bitmap))
+    {
+      // All buffers are busy and the policy is to drop the screenshot
+      return;
+    }
+
+    try
+    {
+      m_graphicsService->Capture(bitmap, capturePixelFormat, m_config.ToneMapper);
+    }
+    catch (const std::exception&)
+    {
+      // Hand the buffer back so the pool keeps its size
+      m_screenshotWriter->Release(std::move(bitmap));
+      throw;
+    }
+
+    if (bitmap.IsValid())
+    {
+      m_screenshotWriter->Submit(CreateScreenshotPath(), std::move(bitmap));
+    }
+    else
+    {
+      m_screenshotWriter->Release(std::move(bitmap));
+    }
+  }
+
+
+  IO::Path TestService::CreateScreenshotPath()
   {
     fmt::memory_buffer buf;
 
@@ -176,8 +229,47 @@ namespace Fsl
     {
       fmt::format_to(std::back_inserter(buf), "{}{}", m_config.FilenamePrefix, ImageFormatUtil::GetDefaultExtension(m_config.Format));
     }
+    return IO::Path(fmt::to_string(buf));
+  }
 
-    IO::Path dstFilename(fmt::to_string(buf));
-    m_persistentDataManager->Write(dstFilename, m_screenshot, m_config.Format);
+
+  void TestService::UpdateScreenshotWriter()
+  {
+    const bool wantsWriter = m_config.Frequency > 0 && m_config.EncoderThreadCount > 0;
+    FSLLOG3_WARNING_IF(wantsWriter && !m_imageServiceFactory,
+                       "Screenshot encoder threads need the image service instance factory, the screenshots will be written on the frame thread");
+    const bool useWriter = wantsWriter && m_imageServiceFactory;
+    if (!m_screenshotWriter && !useWriter)
+    {
+      return;
+    }
+    if (m_screenshotWriter && useWriter && m_writerThreadCount == m_config.EncoderThreadCount && m_writerQueuePolicy == m_config.QueuePolicy &&
+        m_writerImageFormat == m_config.Format)
+    {
+      // Nothing the writer depends on changed, so keep it and its threads
+      return;
+    }
+
+    // Destroying the old writer drains it, so all pending screenshots are written with the config they were captured with
+    m_screenshotWriter.reset();
+    if (useWriter)
+    {
+      // The image services of this thread are not thread safe, so every encoder thread gets its own image service instance
+      // (with its own image libraries and bitmap converter) and the encodes run in parallel.
+      auto imageServiceFactory = m_imageServiceFactory;
+      const IO::Path persistentDataPath = m_persistentDataManager->GetPersistentDataPath();
+      const ImageFormat imageFormat = m_config.Format;
+      m_screenshotWriter = std::make_unique<TestScreenshotWriter>(
+        m_config.EncoderThreadCount, m_config.QueuePolicy,
+        [imageServiceFactory, persistentDataPath, imageFormat]() -> TestScreenshotWriter::WriteFunction
+        {
+          std::shared_ptr<IImageBasicService> imageService = imageServiceFactory->CreateInstance();
+          return [imageService, persistentDataPath, imageFormat](const IO::Path& dstPath, const Bitmap& bitmap)
+          { imageService->Write(IO::Path::Combine(persistentDataPath, dstPath), bitmap, imageFormat); };
+        });
+      m_writerThreadCount = m_config.EncoderThreadCount;
+      m_writerQueuePolicy = m_config.QueuePolicy;
+      m_writerImageFormat = m_config.Format;
+    }
   }
 }
@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslDemoHost/Base/Service/Texture/TextureService.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
 
@@ -102,21 +103,30 @@ namespace Fsl
 
   Texture TextureService::GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    return TextureMipMapUtil::GenerateMipMaps(src, filter, GetJobSystem());
   }
 
   Texture TextureService::GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    return TextureMipMapUtil::GenerateMipMaps(src, filter, GetJobSystem());
   }
 
   Texture TextureService::GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    return TextureMipMapUtil::GenerateMipMaps(src, filter, GetJobSystem());
   }
 
   Texture TextureService::GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    return TextureMipMapUtil::GenerateMipMaps(src, filter, GetJobSystem());
+  }
+
+  JobSystem& TextureService::GetJobSystem()
+  {
+    if (!m_jobSystem)
+    {
+      m_jobSystem = std::make_unique<JobSystem>();
+    }
+    return *m_jobSystem;
   }
 }
@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslDemoApp/Shared/Host/ConfigControl.hpp>
+#include <FslDemoApp/Shared/Host/DemoWindowMetrics.hpp>
 #include <FslDemoHost/Base/ADemoHost.hpp>
 #include <deque>
 #include <vector>
@@ -43,6 +44,7 @@ namespace Fsl
     DemoHostConfig m_demoHostConfig;
     bool m_isActivated;
     DemoHostFeature m_activeApi;
+    DemoWindowMetrics m_windowMetrics;
 
   public:
     explicit StubDemoHost(const DemoHostConfig& demoHostConfig);
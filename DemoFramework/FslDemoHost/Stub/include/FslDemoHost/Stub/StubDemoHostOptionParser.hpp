@@ -31,17 +31,26 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
 #include <FslDemoHost/Base/ADemoHostOptionParser.hpp>
 
 namespace Fsl
 {
   class StubDemoHostOptionParser final : public ADemoHostOptionParser
   {
+    PxExtent2D m_windowExtent;
+
   public:
     StubDemoHostOptionParser();
     void ArgumentSetup(std::deque<Option>& rOptions) final;
     OptionParseResult Parse(const int cmdId, const StringViewLite& strOptArg) final;
     bool ParsingComplete() final;
+
+    //! The extent of the simulated window (zero if not set)
+    PxExtent2D GetWindowExtent() const noexcept
+    {
+      return m_windowExtent;
+    }
   };
 }
 
@@ -57,6 +57,12 @@ namespace Fsl
 
     m_activeApi = hostAppSetup.DemoHostFeatures->front();
 
+    const PxExtent2D windowExtent = demoHostConfig.GetOptions<StubDemoHostOptionParser>()->GetWindowExtent();
+    if (windowExtent.Width.Value > 0u && windowExtent.Height.Value > 0u)
+    {
+      m_windowMetrics = DemoWindowMetrics(windowExtent, Vector2(160, 160), 160);
+    }
+
     const std::shared_ptr<INativeWindowEventQueue> eventQueue = demoHostConfig.GetEventQueue().lock();
     eventQueue->PostEvent(NativeWindowEventHelper::EncodeWindowActivationEvent(true));
   }
@@ -95,8 +101,8 @@ namespace Fsl
 
   DemoWindowMetrics StubDemoHost::GetWindowMetrics() const
   {
-    // FIX: this is the only real invalid data that we return
-    return {};
+    // FIX: unless a window size was requested this is the only real invalid data that we return
+    return m_windowMetrics;
   }
 
 
@@ -31,6 +31,8 @@
 
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Getopt/OptionBaseValues.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Math/Point2U.hpp>
 #include <FslBase/String/StringParseUtil.hpp>
 #include <FslDemoHost/Stub/StubDemoHostOptionParser.hpp>
 #include <algorithm>
@@ -43,7 +45,7 @@ namespace Fsl
     {
       enum Enum
       {
-        // LogConfig = DEMO_HOST_OPTION_BASE,
+        WindowSize = DEMO_HOST_OPTION_BASE,
       };
     };
   }
@@ -58,6 +60,9 @@ namespace Fsl
   {
     ADemoHostOptionParser::ArgumentSetup(rOptions);
 
+    rOptions.emplace_back("StubWindowSize", OptionArgument::OptionRequired, CommandId::WindowSize,
+                          "Simulate a window of the given size [width,height] at 160 dpi, useful when running UI apps headless", OptionGroup::Host);
+
     // rOptions.push_back(Option("EGLLogConfig", OptionArgument::OptionNone, CommandId::LogConfig, "Output the EGL config to the log",
     // OptionGroup::Host));
   }
@@ -65,7 +70,23 @@ namespace Fsl
 
   OptionParseResult StubDemoHostOptionParser::Parse(const int cmdId, const StringViewLite& strOptArg)
   {
-    return ADemoHostOptionParser::Parse(cmdId, strOptArg);
+    switch (cmdId)
+    {
+    case CommandId::WindowSize:
+      {
+        Point2U value;
+        StringParseUtil::Parse(value, strOptArg);
+        if (value.X == 0u || value.Y == 0u)
+        {
+          FSLLOG3_ERROR("StubWindowSize must be larger than zero");
+          return OptionParseResult::Failed;
+        }
+        m_windowExtent = PxExtent2D::Create(value.X, value.Y);
+        return OptionParseResult::Parsed;
+      }
+    default:
+      return ADemoHostOptionParser::Parse(cmdId, strOptArg);
+    }
   }
 
 
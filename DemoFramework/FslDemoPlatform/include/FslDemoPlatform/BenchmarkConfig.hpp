@@ -0,0 +1,65 @@
+#ifndef FSLDEMOPLATFORM_BENCHMARKCONFIG_HPP
+#define FSLDEMOPLATFORM_BENCHMARKCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <utility>
+
+namespace Fsl
+{
+  struct BenchmarkConfig
+  {
+    //! The report file, empty if benchmarking is disabled. A '.csv' file gets a CSV report, anything else gets a JSON report.
+    IO::Path ReportFile;
+    //! The number of frames rendered before the measurements start
+    uint32_t WarmupFrames{60};
+    //! The number of frames that are measured
+    uint32_t Frames{600};
+
+    BenchmarkConfig() = default;
+
+    BenchmarkConfig(IO::Path reportFile, const uint32_t warmupFrames, const uint32_t frames)
+      : ReportFile(std::move(reportFile))
+      , WarmupFrames(warmupFrames)
+      , Frames(frames)
+    {
+    }
+
+    bool IsEnabled() const noexcept
+    {
+      return !ReportFile.IsEmpty();
+    }
+  };
+}
+
+#endif
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/Path.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
 #include <FslDemoHost/Base/DemoHostCaps.hpp>
 #include <FslDemoHost/Base/SwapBuffersResult.hpp>
@@ -43,6 +44,7 @@ namespace Fsl
 {
   struct Point2;
   class DemoAppManager;
+  class DemoBenchmark;
   class DemoHostManagerOptionParser;
   struct DemoWindowMetrics;
   class IDemoHost;
@@ -82,6 +84,10 @@ namespace Fsl
     HighResolutionTimer m_timer;
     //! Only used if m_exitAfterDuration.Enabled is true
     std::chrono::microseconds m_exitTime;
+    //! If not empty the startup timeline is written here once the first frame has been presented
+    IO::Path m_startupTimelineFile;
+    //! Only allocated when running in benchmark mode
+    std::unique_ptr<DemoBenchmark> m_benchmark;
 
   public:
     DemoHostManager(const DemoSetup& demoSetup, const std::shared_ptr<DemoHostManagerOptionParser>& demoHostManagerOptionParser);
@@ -91,8 +97,10 @@ namespace Fsl
     int Run(const std::shared_ptr<IServiceHostLooper>& serviceHostLooper, FNMainLoopCallback mainLoopCallbackFunction);
 
   private:
-    void AppProcess(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedHost);
+    //! @return true if a frame was presented
+    bool AppProcess(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedHost);
     SwapBuffersResult AppDrawAndSwapBuffers();
+    void CompleteStartupTimeline(const uint64_t firstFrameBeginNanoseconds);
     void ProcessMessages();
     void CmdRestart();
     void CmdActivation(const bool bActivated);
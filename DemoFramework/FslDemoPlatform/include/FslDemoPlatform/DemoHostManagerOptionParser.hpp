@@ -32,11 +32,13 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Getopt/IOptionParser.hpp>
+#include <FslBase/IO/Path.hpp>
 #include <FslBase/ITag.hpp>
 #include <FslBase/Time/TimeSpan.hpp>
 #include <FslDemoApp/Base/DemoAppStatsFlags.hpp>
 #include <FslDemoHost/Base/LogStatsMode.hpp>
 #include <FslDemoHost/Base/Service/Test/TestScreenshotConfig.hpp>
+#include <FslDemoPlatform/BenchmarkConfig.hpp>
 #include <FslDemoPlatform/DurationExitConfig.hpp>
 #include <FslDemoService/Graphics/ColorSpaceType.hpp>
 #include <FslGraphics/ImageFormat.hpp>
@@ -60,6 +62,10 @@ namespace Fsl
     bool m_appFirewall{false};
     bool m_enableBasic2DPrealloc{false};
     bool m_contentMonitor{false};
+    bool m_logAsync{false};
+    IO::Path m_logFile;
+    IO::Path m_startupTimelineFile;
+    BenchmarkConfig m_benchmarkConfig;
 
   public:
     DemoHostManagerOptionParser(const DemoHostManagerOptionParser&) = delete;
@@ -127,6 +133,30 @@ namespace Fsl
     //! Check if content monitoring is enabled
     bool IsContentMonitorEnabled() const;
 
+    //! Check if the log should be written by a background thread
+    bool IsAsyncLogEnabled() const noexcept
+    {
+      return m_logAsync;
+    }
+
+    //! The file the log should be written to (empty means stdout)
+    const IO::Path& GetLogFile() const noexcept
+    {
+      return m_logFile;
+    }
+
+    //! The file the startup timeline should be written to once the first frame has been presented (empty means disabled)
+    const IO::Path& GetStartupTimelineFile() const noexcept
+    {
+      return m_startupTimelineFile;
+    }
+
+    //! Get the benchmark config
+    const BenchmarkConfig& GetBenchmarkConfig() const noexcept
+    {
+      return m_benchmarkConfig;
+    }
+
     void RequestEnableAppFirewall();
 
   private:
@@ -0,0 +1,155 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    std::atomic<uint64_t> g_allocationCount{0};
+  }
+
+
+  bool AllocationCounter::IsSupported() noexcept
+  {
+#ifdef FSL_DEMOPLATFORM_ALLOCATION_COUNTER_ENABLED
+    return true;
+#else
+    return false;
+#endif
+  }
+
+
+  uint64_t AllocationCounter::GetCount() noexcept
+  {
+    return g_allocationCount.load(std::memory_order_relaxed);
+  }
+}
+
+#ifdef FSL_DEMOPLATFORM_ALLOCATION_COUNTER_ENABLED
+// The default implementations of the array and nothrow versions forward to these, so replacing the plain and aligned versions is enough to count
+// them all.
+
+namespace
+{
+  void* AllocateAligned(std::size_t size, std::size_t alignment) noexcept
+  {
+#ifdef _WIN32
+    return _aligned_malloc(size != 0u ? size : 1u, alignment);
+#else
+    // std::aligned_alloc requires the size to be a multiple of the alignment
+    const std::size_t alignedSize = ((size != 0u ? size : 1u) + (alignment - 1u)) & ~(alignment - 1u);
+    return std::aligned_alloc(alignment, alignedSize);
+#endif
+  }
+
+
+  void FreeAligned(void* pMemory) noexcept
+  {
+#ifdef _WIN32
+    _aligned_free(pMemory);
+#else
+    std::free(pMemory);
+#endif
+  }
+}
+
+
+void* operator new(std::size_t size)
+{
+  Fsl::g_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+  for (;;)
+  {
+    void* pMemory = std::malloc(size != 0u ? size : 1u);
+    if (pMemory != nullptr)
+    {
+      return pMemory;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  Fsl::g_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+  for (;;)
+  {
+    void* pMemory = AllocateAligned(size, static_cast<std::size_t>(alignment));
+    if (pMemory != nullptr)
+    {
+      return pMemory;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+
+void operator delete(void* pMemory) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete(void* pMemory, std::size_t /*size*/) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete(void* pMemory, std::align_val_t /*alignment*/) noexcept
+{
+  FreeAligned(pMemory);
+}
+
+
+void operator delete(void* pMemory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+  FreeAligned(pMemory);
+}
+#endif
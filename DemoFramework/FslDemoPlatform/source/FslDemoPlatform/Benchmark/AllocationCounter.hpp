@@ -0,0 +1,54 @@
+#ifndef FSLDEMOPLATFORM_BENCHMARK_ALLOCATIONCOUNTER_HPP
+#define FSLDEMOPLATFORM_BENCHMARK_ALLOCATIONCOUNTER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+// Allocation counting replaces the global operator new/delete so it is opt-in. Set the AllocationCounter flavor to Enabled (which defines
+// FSL_DEMOPLATFORM_ALLOCATION_COUNTER_ENABLED) to enable it, otherwise the default operators are kept and the counter always returns zero.
+
+namespace Fsl
+{
+  //! @brief Counts the calls to the global operator new (including the array, nothrow and aligned variants) when
+  //!        FSL_DEMOPLATFORM_ALLOCATION_COUNTER_ENABLED is defined. The counting costs a relaxed atomic increment per allocation.
+  class AllocationCounter
+  {
+  public:
+    //! @brief Check if allocations are being counted
+    static bool IsSupported() noexcept;
+
+    //! @brief Get the number of allocations done since the process was started.
+    static uint64_t GetCount() noexcept;
+  };
+}
+
+#endif
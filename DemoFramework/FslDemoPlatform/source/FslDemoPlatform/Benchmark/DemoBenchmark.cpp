@@ -0,0 +1,130 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "DemoBenchmark.hpp"
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Time/TimeSpanUtil.hpp>
+#include <algorithm>
+#include <utility>
+#include "AllocationCounter.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr StringViewLite FramePhaseName("Frame");
+      constexpr uint64_t NanosecondsPerTick = 1000000000u / static_cast<uint64_t>(TimeSpan::TicksPerSecond);
+    }
+
+    bool IsCsvFile(const IO::Path& path)
+    {
+      return path.EndsWith(".csv") || path.EndsWith(".CSV");
+    }
+  }
+
+
+  DemoBenchmark::DemoBenchmark(BenchmarkConfig config, std::string name, const TimeSpan& timestep)
+    : m_config(std::move(config))
+    , m_info(std::move(name), m_config.WarmupFrames, static_cast<uint64_t>(std::max(timestep.Ticks(), int64_t(0))) * LocalConfig::NanosecondsPerTick)
+    , m_lastAllocationCount(AllocationCounter::GetCount())
+  {
+    FSLLOG3_INFO("Benchmark: {} warm-up frames, {} measured frames, fixed timestep {}us, report '{}'", m_config.WarmupFrames, m_config.Frames,
+                 TimeSpanUtil::ToClampedMicrosecondsUInt64(timestep), m_config.ReportFile);
+    FSLLOG3_WARNING_IF(!AllocationCounter::IsSupported(),
+                       "Benchmark: allocation counting is disabled (set the AllocationCounter flavor to Enabled to enable it), the "
+                       "allocation counts will be reported as n/a");
+#ifdef FSL_SCOPE_PROFILER_DISABLED
+    FSLLOG3_WARNING("Benchmark: the profiler zones were compiled out (ScopeProfiler=Disabled), the report will not contain any phase times");
+#endif
+    m_report.SetAllocationsCounted(AllocationCounter::IsSupported());
+    // Prevent the report from allocating memory while we count allocations
+    m_report.Reserve(m_config.Frames);
+    m_profilerConsumer.BeginRecording();
+  }
+
+
+  DemoBenchmark::~DemoBenchmark() noexcept
+  {
+    m_profilerConsumer.EndRecording();
+  }
+
+
+  bool DemoBenchmark::OnFramePresented()
+  {
+    m_events.clear();
+    m_droppedEvents += m_profilerConsumer.Collect(m_events);
+    const uint64_t allocationCount = AllocationCounter::GetCount();
+    const uint64_t frameAllocations = allocationCount - m_lastAllocationCount;
+    m_lastAllocationCount = allocationCount;
+
+    ++m_presentedFrames;
+    if (m_presentedFrames <= m_config.WarmupFrames)
+    {
+      return false;
+    }
+
+    m_report.BeginFrame();
+    for (const ScopeProfilerEvent& event : m_events)
+    {
+      m_report.AddPhaseTime(StringViewLite(event.pszName), event.DurationNanoseconds());
+    }
+    m_report.AddAllocations(frameAllocations);
+
+    if (m_report.GetFrameCount() < m_config.Frames)
+    {
+      return false;
+    }
+    SaveReport();
+    return true;
+  }
+
+
+  void DemoBenchmark::SaveReport()
+  {
+    FSLLOG3_WARNING_IF(m_droppedEvents > 0, "Benchmark: {} profiler zones were dropped, the report is incomplete", m_droppedEvents);
+
+    const std::string content = IsCsvFile(m_config.ReportFile) ? m_report.ToCsv() : m_report.ToJson(m_info);
+    IO::File::WriteAllText(m_config.ReportFile, content);
+
+    const BenchmarkSampleStats frameStats = m_report.GetPhaseStats(LocalConfig::FramePhaseName);
+    FSLLOG3_INFO("Benchmark completed, {} frames. Frame p50: {}us p95: {}us p99: {}us max: {}us", m_report.GetFrameCount(),
+                 frameStats.P50 / 1000u, frameStats.P95 / 1000u, frameStats.P99 / 1000u, frameStats.Max / 1000u);
+    if (m_report.IsAllocationsCounted())
+    {
+      const BenchmarkSampleStats allocationStats = m_report.GetAllocationStats();
+      FSLLOG3_INFO("Benchmark allocations per frame p50: {} max: {}", allocationStats.P50, allocationStats.Max);
+    }
+  }
+}
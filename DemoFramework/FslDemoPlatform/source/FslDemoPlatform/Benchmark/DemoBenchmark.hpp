@@ -0,0 +1,75 @@
+#ifndef FSLDEMOPLATFORM_BENCHMARK_DEMOBENCHMARK_HPP
+#define FSLDEMOPLATFORM_BENCHMARK_DEMOBENCHMARK_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Profiler/BenchmarkReport.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerConsumer.hpp>
+#include <FslBase/System/Profiler/ScopeProfilerEvent.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslDemoPlatform/BenchmarkConfig.hpp>
+#include <string>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Measures the CPU time of every profiler zone (Frame, App.Update, App.FixedUpdate, Frame.Draw, UI.*, ...) for each presented frame
+  //!        and writes a percentile report once all frames have been measured.
+  //! @note  The measurements are collected from the ScopeProfiler with a dedicated consumer that records while the benchmark is alive,
+  //!        so it can be combined with the other ScopeProfiler consumers like the Chrome trace.
+  class DemoBenchmark
+  {
+    BenchmarkConfig m_config;
+    BenchmarkReportInfo m_info;
+    BenchmarkReport m_report;
+    ScopeProfilerConsumer m_profilerConsumer;
+    std::vector<ScopeProfilerEvent> m_events;
+    uint32_t m_presentedFrames{0};
+    uint64_t m_lastAllocationCount{0};
+    uint64_t m_droppedEvents{0};
+
+  public:
+    DemoBenchmark(const DemoBenchmark&) = delete;
+    DemoBenchmark& operator=(const DemoBenchmark&) = delete;
+
+    DemoBenchmark(BenchmarkConfig config, std::string name, const TimeSpan& timestep);
+    ~DemoBenchmark() noexcept;
+
+    //! @brief Call each time a frame has been presented
+    //! @return true once all frames have been measured and the report has been written.
+    bool OnFramePresented();
+
+  private:
+    void SaveReport();
+  };
+}
+
+#endif
@@ -30,7 +30,10 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Core.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
 #include <FslDemoApp/Shared/Log/Host/FmtDemoWindowMetrics.hpp>
 #include <FslDemoHost/Base/ADemoHost.hpp>
@@ -46,6 +49,7 @@
 #include <FslService/Impl/Threading/IServiceHostLooper.hpp>
 #include <cassert>
 #include <thread>
+#include "Benchmark/DemoBenchmark.hpp"
 
 namespace Fsl
 {
@@ -58,6 +62,7 @@ namespace Fsl
     , m_exitAfterFrame(demoHostManagerOptionParser->GetExitAfterFrame())
     , m_exitAfterDuration(demoHostManagerOptionParser->GetDurationExitConfig())
     , m_exitTime(std::chrono::microseconds(m_timer.GetTimestamp().TotalMicrosecondsInt64()) + std::chrono::microseconds(m_exitAfterDuration.Duration))
+    , m_startupTimelineFile(demoHostManagerOptionParser->GetStartupTimelineFile())
   {
     // Acquire the various services
     ServiceProvider serviceProvider(demoSetup.ServiceProvider);
@@ -91,6 +96,13 @@ namespace Fsl
       demoHostManagerOptionParser->GetAppStatsFlags(), hostConfig.AppFirewall, hostConfig.ContentMonitor,
       demoHostManagerOptionParser->GetForceUpdateTime(), !m_demoHostCaps.IsEnabled(DemoHostCaps::Flags::AppRenderedSystemOverlay));
 
+    const BenchmarkConfig& benchmarkConfig = demoHostManagerOptionParser->GetBenchmarkConfig();
+    if (benchmarkConfig.IsEnabled())
+    {
+      m_benchmark = std::make_unique<DemoBenchmark>(benchmarkConfig, demoSetup.App.AppSetup.ApplicationName,
+                                                    demoHostManagerOptionParser->GetForceUpdateTime());
+    }
+
     FSLLOG3_VERBOSE("DemoHostManager: Processing messages");
 
     // Allow the pending messages that was created during setup to be processed as part of the 'host setup'
@@ -102,6 +114,8 @@ namespace Fsl
 
   DemoHostManager::~DemoHostManager()
   {
+    m_benchmark.reset();
+
     // Close the app first
     m_demoAppManager.reset();
 
@@ -125,9 +139,12 @@ namespace Fsl
     // Event loop
     while (m_demoHost->ProcessNativeMessages(m_state == State::Suspended) && !m_demoAppManager->HasExitRequest())
     {
-      ProcessMessages();
-      // Allow the services to react to the incoming messages before we process the app
-      serviceHostLooper->ProcessMessages();
+      {
+        FSL_PROFILE_SCOPE("Host.ProcessMessages");
+        ProcessMessages();
+        // Allow the services to react to the incoming messages before we process the app
+        serviceHostLooper->ProcessMessages();
+      }
 
       if (m_state == State::Activated)
       {
@@ -139,7 +156,11 @@ namespace Fsl
             FSLLOG3_VERBOSE("WindowMetrics updated: {}", windowMetrics);
             m_windowMetricsDirty = false;
           }
-          AppProcess(windowMetrics, isConsoleBasedHost);
+          const bool framePresented = AppProcess(windowMetrics, isConsoleBasedHost);
+          if (framePresented && m_benchmark && m_benchmark->OnFramePresented())
+          {
+            m_demoAppManager->RequestExit();
+          }
         }
       }
       if (mainLoopCallbackFunction != nullptr)
@@ -151,9 +172,12 @@ namespace Fsl
   }
 
 
-  void DemoHostManager::AppProcess(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedHost)
+  bool DemoHostManager::AppProcess(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedHost)
   {
+    FSL_PROFILE_SCOPE("Frame");
+    const uint64_t startupFrameBegin = StartupTimeline::IsRecording() ? ScopeProfiler::GetTimestamp() : 0;
     const DemoAppManagerProcessResult processResult = m_demoAppManager->Process(windowMetrics, isConsoleBasedHost);
+    bool framePresented = false;
     if (processResult.Cmd == DemoAppManagerProcessResult::Command::Draw)
     {
       auto swapBuffersResult = AppDrawAndSwapBuffers();
@@ -163,6 +187,11 @@ namespace Fsl
         m_demoAppManager->OnFrameSwapCompleted();
         m_testService->OnFrameSwapCompleted();
         m_demoAppManager->ProcessDone();
+        framePresented = true;
+        if (startupFrameBegin != 0)
+        {
+          CompleteStartupTimeline(startupFrameBegin);
+        }
 
         // Provide support for exiting after a number of successfully rendered frames
         if (m_exitAfterFrame >= 0)
@@ -205,6 +234,7 @@ namespace Fsl
       m_demoAppManager->OnDemandDrawSkipped();
       m_demoAppManager->ProcessDone();
     }
+    return framePresented;
   }
 
   SwapBuffersResult DemoHostManager::AppDrawAndSwapBuffers()
@@ -218,7 +248,11 @@ namespace Fsl
       if (result == AppDrawResult::Completed)
       {
         assert(m_demoHost);
-        auto swapBuffersResult = m_demoHost->TrySwapBuffers();
+        auto swapBuffersResult = SwapBuffersResult::Failed;
+        {
+          FSL_PROFILE_SCOPE("Host.SwapBuffers");
+          swapBuffersResult = m_demoHost->TrySwapBuffers();
+        }
         if (swapBuffersResult != SwapBuffersResult::AppControlled)
         {
           //  The swap buffer operation is not app controlled, so use a quick exit.
@@ -248,6 +282,27 @@ namespace Fsl
   }
 
 
+  void DemoHostManager::CompleteStartupTimeline(const uint64_t firstFrameBeginNanoseconds)
+  {
+    StartupTimeline::AddEvent("First frame", firstFrameBeginNanoseconds, ScopeProfiler::GetTimestamp());
+    if (StartupTimeline::EndRecording() && !m_startupTimelineFile.IsEmpty())
+    {
+      const uint64_t startupNanoseconds = StartupTimeline::GetEndTimestamp() - StartupTimeline::GetProcessStartTimestamp();
+      try
+      {
+        StartupTimeline::Save(m_startupTimelineFile);
+        FSLLOG3_INFO("First frame presented {}ms after process start, startup timeline written to '{}'", startupNanoseconds / 1000000u,
+                     m_startupTimelineFile);
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_ERROR("Failed to write the startup timeline to '{}': {}", m_startupTimelineFile, ex.what());
+      }
+    }
+    StartupTimeline::Clear();
+  }
+
+
   void DemoHostManager::ProcessMessages()
   {
     NativeWindowEvent event;
@@ -66,9 +66,17 @@ namespace Fsl
       constexpr auto ScreenshotNameScheme = "ScreenshotNameScheme";
       constexpr auto ScreenshotNamePrefix = "ScreenshotNamePrefix";
       constexpr auto ScreenshotToneMapper = "ScreenshotToneMapper";
+      constexpr auto ScreenshotEncoderThreads = "ScreenshotEncoderThreads";
+      constexpr auto ScreenshotDropFrames = "ScreenshotDropFrames";
       constexpr auto ContentMonitor = "ContentMonitor";
       constexpr auto ForceUpdateTime = "ForceUpdateTime";
       constexpr auto Version = "Version";
+      constexpr auto LogAsync = "LogAsync";
+      constexpr auto LogFile = "LogFile";
+      constexpr auto StartupTimeline = "StartupTimeline";
+      constexpr auto Benchmark = "Benchmark";
+      constexpr auto BenchmarkWarmupFrames = "BenchmarkWarmupFrames";
+      constexpr auto BenchmarkFrames = "BenchmarkFrames";
     }
 
 
@@ -91,11 +99,26 @@ namespace Fsl
         EnableBasic2DPrealloc,
         ScreenshotNameScheme,
         ForceUpdateTime,
-        Version
+        Version,
+        LogAsync,
+        LogFile,
+        ScreenshotEncoderThreads,
+        ScreenshotDropFrames,
+        StartupTimeline,
+        Benchmark,
+        BenchmarkWarmupFrames,
+        BenchmarkFrames
       };
     };
 
 
+    namespace LocalConfig
+    {
+      //! The fixed timestep used while benchmarking unless ForceUpdateTime has been used (60 fps)
+      constexpr uint32_t BenchmarkUpdateTimeMicroseconds = 16667;
+    }
+
+
     enum class DurationFormat
     {
       Invalid,
@@ -197,6 +220,11 @@ namespace Fsl
                             fmt::format("Chose the tone mapper to apply when converting a HDR screenshot to SDR: {}.",
                                         OptionArgUtil::BuildArgumentString(SpanUtil::AsReadOnlySpan(ScreenshotToneMapperArgs), true)));
     }
+    rOptions.emplace_back(ArgName::ScreenshotEncoderThreads, OptionArgument::OptionRequired, CommandId::ScreenshotEncoderThreads,
+                          "Encode and write the periodic screenshots on the given number of background threads (defaults to 0, "
+                          "which writes them on the frame thread)");
+    rOptions.emplace_back(ArgName::ScreenshotDropFrames, OptionArgument::OptionNone, CommandId::ScreenshotDropFrames,
+                          "Skip a periodic screenshot instead of waiting when all the background encoders are busy");
     rOptions.emplace_back(ArgName::ContentMonitor, OptionArgument::OptionNone, CommandId::ContentMonitor,
                           "Monitor the Content directory for changes and restart the app on changes.\nWARNING: Might not work on all platforms "
                           "and it might impact app performance (experimental)");
@@ -204,6 +232,22 @@ namespace Fsl
       ArgName::ForceUpdateTime, OptionArgument::OptionRequired, CommandId::ForceUpdateTime,
       "Force the update time to be the given value in microseconds (can be useful when taking a lot of screen-shots). If 0 this option is disabled");
     rOptions.emplace_back(ArgName::Version, OptionArgument::OptionNone, CommandId::Version, "Print version information");
+    rOptions.emplace_back(ArgName::LogAsync, OptionArgument::OptionNone, CommandId::LogAsync,
+                          "Write the log from a background thread so logging doesn't stall the app on console I/O");
+    rOptions.emplace_back(ArgName::LogFile, OptionArgument::OptionRequired, CommandId::LogFile,
+                          "Write the log to the given file instead of stdout (the log is written from a background thread)");
+    rOptions.emplace_back(ArgName::StartupTimeline, OptionArgument::OptionRequired, CommandId::StartupTimeline,
+                          "Write a timeline of the app startup (from process start to the first presented frame) to the given file. The file uses "
+                          "the chrome trace JSON format and includes the construction time of each service");
+    rOptions.emplace_back(ArgName::Benchmark, OptionArgument::OptionRequired, CommandId::Benchmark,
+                          "Run the app as a repeatable benchmark and write a report with the p50/p95/p99/max CPU time of each profiled frame "
+                          "phase and the allocations per frame to the given file (a .csv file gets a CSV report, anything else JSON). Uses a fixed "
+                          "timestep (see ForceUpdateTime) and exits once all frames have been measured");
+    rOptions.emplace_back(ArgName::BenchmarkWarmupFrames, OptionArgument::OptionRequired, CommandId::BenchmarkWarmupFrames,
+                          fmt::format("The number of frames rendered before the benchmark measurements start (defaults to {})",
+                                      BenchmarkConfig().WarmupFrames));
+    rOptions.emplace_back(ArgName::BenchmarkFrames, OptionArgument::OptionRequired, CommandId::BenchmarkFrames,
+                          fmt::format("The number of frames measured by the benchmark (defaults to {})", BenchmarkConfig().Frames));
   }
 
 
@@ -231,6 +275,12 @@ namespace Fsl
     case CommandId::ScreenshotToneMapper:
       return OptionArgUtil::TryParseOptionArg(ArgName::ScreenshotToneMapper, SpanUtil::AsReadOnlySpan(ScreenshotToneMapperArgs), strOptArg,
                                               m_screenshotConfig.ToneMapper);
+    case CommandId::ScreenshotEncoderThreads:
+      StringParseUtil::Parse(m_screenshotConfig.EncoderThreadCount, strOptArg);
+      return OptionParseResult::Parsed;
+    case CommandId::ScreenshotDropFrames:
+      m_screenshotConfig.QueuePolicy = TestScreenshotQueuePolicy::DropFrame;
+      return OptionParseResult::Parsed;
     case CommandId::ForceUpdateTime:
       {
         uint32_t value = 0;
@@ -280,6 +330,45 @@ namespace Fsl
     case CommandId::Version:
       FSLLOG3_INFO("Release {}, GitCommit '{}'", ReleaseVersion::CurrentVersion(), ReleaseVersion::GetGitCommit());
       return OptionParseResult::Parsed;
+    case CommandId::LogAsync:
+      m_logAsync = true;
+      return OptionParseResult::Parsed;
+    case CommandId::LogFile:
+      if (strOptArg.empty())
+      {
+        FSLLOG3_ERROR("LogFile requires a filename");
+        return OptionParseResult::Failed;
+      }
+      m_logFile = IO::Path(strOptArg);
+      m_logAsync = true;
+      return OptionParseResult::Parsed;
+    case CommandId::StartupTimeline:
+      if (strOptArg.empty())
+      {
+        FSLLOG3_ERROR("StartupTimeline requires a filename");
+        return OptionParseResult::Failed;
+      }
+      m_startupTimelineFile = IO::Path(strOptArg);
+      return OptionParseResult::Parsed;
+    case CommandId::Benchmark:
+      if (strOptArg.empty())
+      {
+        FSLLOG3_ERROR("Benchmark requires a filename");
+        return OptionParseResult::Failed;
+      }
+      m_benchmarkConfig.ReportFile = IO::Path(strOptArg);
+      return OptionParseResult::Parsed;
+    case CommandId::BenchmarkWarmupFrames:
+      StringParseUtil::Parse(m_benchmarkConfig.WarmupFrames, strOptArg);
+      return OptionParseResult::Parsed;
+    case CommandId::BenchmarkFrames:
+      StringParseUtil::Parse(m_benchmarkConfig.Frames, strOptArg);
+      if (m_benchmarkConfig.Frames == 0u)
+      {
+        FSLLOG3_ERROR("BenchmarkFrames must be larger than zero");
+        return OptionParseResult::Failed;
+      }
+      return OptionParseResult::Parsed;
     default:
       break;
     }
@@ -289,6 +378,11 @@ namespace Fsl
 
   bool DemoHostManagerOptionParser::ParsingComplete()
   {
+    if (m_benchmarkConfig.IsEnabled() && m_forceUpdateTime.Ticks() == 0)
+    {
+      // A benchmark must be repeatable so we use a fixed timestep
+      m_forceUpdateTime = TimeSpanUtil::FromMicroseconds(LocalConfig::BenchmarkUpdateTimeMicroseconds);
+    }
     return true;
   }
 
@@ -32,10 +32,13 @@
 #include <FslBase/ExceptionMessageFormatter.hpp>
 #include <FslBase/Getopt/OptionBaseValues.hpp>
 #include <FslBase/Getopt/OptionParser.hpp>
+#include <FslBase/Log/AsyncLogSink.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/String/StringParseUtil.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
 #include <FslDemoApp/Base/ADemoOptionParser.hpp>
 #include <FslDemoHost/Base/ADemoHostOptionParser.hpp>
 #include <FslDemoHost/Base/IDemoHost.hpp>
@@ -210,6 +213,10 @@ namespace Fsl
         }
       }
 
+      StartupTimeline::SetThreadName("Main");
+      ScopeProfiler::SetThreadName("Main");
+      const uint64_t setupBegin = ScopeProfiler::GetTimestamp();
+
       bool enableFirewallRequest = false;
 
       std::unique_ptr<ServiceFramework> serviceFramework(new ServiceFramework());
@@ -231,15 +238,37 @@ namespace Fsl
         serviceFramework->PrepareServices(*demoBasicSetup.Host.ServiceOptionParsers);
       }
 
+      const uint64_t parseBegin = ScopeProfiler::GetTimestamp();
+      StartupTimeline::AddEvent("Setup", setupBegin, parseBegin);
       const auto parseResult = TryParseInputArguments(arguments, demoBasicSetup, demoHostManagerOptionParser);
       if (parseResult.Status != OptionParser::Result::OK)
       {
         return parseResult.Status == OptionParser::Result::Failed ? EXIT_FAILURE : EXIT_SUCCESS;
       }
+      if (demoHostManagerOptionParser->GetStartupTimelineFile().IsEmpty())
+      {
+        // Nobody wants the timeline, so stop recording it
+        StartupTimeline::EndRecording();
+        StartupTimeline::Clear();
+      }
+      StartupTimeline::AddEvent("ParseArguments", parseBegin, ScopeProfiler::GetTimestamp());
+
+      // Hand the log output off to a background thread if requested, destroying the sink writes all pending messages.
+      std::unique_ptr<AsyncLogSink> asyncLogSink;
+      if (demoHostManagerOptionParser->IsAsyncLogEnabled())
+      {
+        asyncLogSink = std::make_unique<AsyncLogSink>(AsyncLogSinkConfig(demoHostManagerOptionParser->GetLogFile()));
+      }
 
       // Start the services, after the command line parameters have been processed
-      serviceFramework->LaunchGlobalServices();
-      serviceFramework->LaunchThreads();
+      {
+        ScopedStartupTimelineZone timelineZone("LaunchGlobalServices");
+        serviceFramework->LaunchGlobalServices();
+      }
+      {
+        ScopedStartupTimelineZone timelineZone("LaunchThreads");
+        serviceFramework->LaunchThreads();
+      }
 
       auto serviceProvider = serviceFramework->GetServiceProvider();
       // This really should not happen, but just check anyway
@@ -259,6 +288,7 @@ namespace Fsl
         demoSetup.Host.OptionParser->SetNativeWindowTag(demoRunnerConfig.NativeWindowTag);
 
         // Initialize the demo
+        ScopedStartupTimelineZone timelineZone("DemoHostManager");
         demoHostManager = std::make_unique<DemoHostManager>(demoSetup, demoHostManagerOptionParser);
       }
       catch (const std::exception& ex)
@@ -94,6 +94,9 @@ namespace Fsl
     std::shared_ptr<IProfilerService> m_profilerService;
     ScopedProfilerCustomCounterHandle m_hProfilerBatchDrawCalls;
     ScopedProfilerCustomCounterHandle m_hProfilerBatchVertices;
+    ScopedProfilerCustomCounterHandle m_hProfilerBitmapAllocations;
+    ScopedProfilerCustomCounterHandle m_hProfilerBitmapPool;
+    uint64_t m_lastBitmapPoolMissCount{0};
 
     NativeGraphicsServiceDeque m_nativeGraphicsServices;
 
@@ -48,6 +48,7 @@
 #include <FslDemoService/NativeGraphics/Base/NativeGraphicsDeviceCreateInfo.hpp>
 #include <FslDemoService/Profiler/DefaultProfilerColors.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/Bitmap/BitmapUtil.hpp>
 #include <FslGraphics/Render/Adapter/INativeBatch2D.hpp>
 #include <FslGraphics/Render/Adapter/INativeGraphics.hpp>
@@ -76,6 +77,11 @@ namespace Fsl
                                       m_profilerService->CreateCustomCounter("batches", 0, 200, DefaultProfilerColors::BatchDrawCalls));
       m_hProfilerBatchVertices.Reset(m_profilerService,
                                      m_profilerService->CreateCustomCounter("vertices", 0, 9000, DefaultProfilerColors::BatchVertices));
+      // The number of new bitmap buffers allocated per frame (pool misses) and the amount of pooled bitmap memory in MB
+      m_hProfilerBitmapAllocations.Reset(m_profilerService,
+                                         m_profilerService->CreateCustomCounter("bmp alloc", 0, 16, DefaultProfilerColors::BitmapAllocations));
+      m_hProfilerBitmapPool.Reset(m_profilerService, m_profilerService->CreateCustomCounter("bmp pool", 0, 128, DefaultProfilerColors::BitmapPool));
+      m_lastBitmapPoolMissCount = BitmapMemoryPool::GetStats().MissCount;
     }
 
     // Acquire all providers of the INativeGraphicsService interface
@@ -114,6 +120,13 @@ namespace Fsl
 
       m_profilerService->Set(m_hProfilerBatchDrawCalls, batchDrawCount);
       m_profilerService->Set(m_hProfilerBatchVertices, batchVertices);
+
+      const BitmapMemoryPoolStats bitmapPoolStats = BitmapMemoryPool::GetStats();
+      const uint64_t bitmapAllocations = bitmapPoolStats.MissCount - m_lastBitmapPoolMissCount;
+      m_lastBitmapPoolMissCount = bitmapPoolStats.MissCount;
+      m_profilerService->Set(m_hProfilerBitmapAllocations, UncheckedNumericCast<int32_t>(std::min(bitmapAllocations, uint64_t(0x7FFFFFFF))));
+      const uint64_t bitmapPoolMB = bitmapPoolStats.PooledBytes / (1024 * 1024);
+      m_profilerService->Set(m_hProfilerBitmapPool, UncheckedNumericCast<int32_t>(std::min(bitmapPoolMB, uint64_t(0x7FFFFFFF))));
     }
   }
 
@@ -43,10 +43,14 @@ namespace Fsl::DefaultProfilerColors
   constexpr Color BatchDrawCalls = Colors::Blue();
   constexpr Color BatchVertices = Colors::Olive();
 
+  constexpr Color BitmapAllocations = Colors::Red();
+  constexpr Color BitmapPool = Colors::DarkBlue();
+
   constexpr Color UIUpdate = Colors::Purple();
   constexpr Color UIResolve = Colors::Marrom();
   constexpr Color UIDraw = Colors::Lime();
   constexpr Color UIWinCount = Colors::Silver();
+  constexpr Color UIMeasure = Colors::Pink();
 
 }
 
@@ -0,0 +1,351 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/BitmapMemory.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
+#include <FslGraphics/ContainerTypeConvert.hpp>
+#include <FslGraphics/Texture/Texture.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  constexpr uint32_t MinPooledByteSize = 1024;
+
+  //! Gives every test a empty pool with a known configuration and restores the original configuration afterwards
+  class TestBitmap_BitmapMemoryPool : public TestFixtureFslGraphics
+  {
+    BitmapMemoryPoolConfig m_oldConfig;
+
+  public:
+    TestBitmap_BitmapMemoryPool()
+      : m_oldConfig(BitmapMemoryPool::GetConfig())
+    {
+      BitmapMemoryPool::SetConfig(BitmapMemoryPoolConfig(MinPooledByteSize, 1024 * 1024, 2, false));
+    }
+
+    ~TestBitmap_BitmapMemoryPool() override
+    {
+      BitmapMemoryPool::SetConfig(m_oldConfig);
+    }
+  };
+
+  bool IsAllZero(const BitmapMemoryBuffer& content)
+  {
+    return std::all_of(content.begin(), content.end(), [](const uint8_t value) { return value == 0; });
+  }
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, GetSizeClassCapacity)
+{
+  // Four size classes per power of two
+  EXPECT_EQ(65536u, BitmapMemoryPool::GetSizeClassCapacity(65536));
+  EXPECT_EQ(81920u, BitmapMemoryPool::GetSizeClassCapacity(65537));
+  EXPECT_EQ(81920u, BitmapMemoryPool::GetSizeClassCapacity(81920));
+  EXPECT_EQ(98304u, BitmapMemoryPool::GetSizeClassCapacity(81921));
+  EXPECT_EQ(114688u, BitmapMemoryPool::GetSizeClassCapacity(100000));
+  EXPECT_EQ(131072u, BitmapMemoryPool::GetSizeClassCapacity(114689));
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, AcquireZeroed)
+{
+  const BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireZeroed(5000);
+  EXPECT_EQ(5000u, buffer.size());
+  EXPECT_TRUE(IsAllZero(buffer));
+
+  const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+  EXPECT_EQ(0u, stats.PooledBuffers);
+  EXPECT_EQ(0u, stats.PooledBytes);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Recycle_ThenAcquire_ReusesBuffer)
+{
+  const BitmapMemoryPoolStats oldStats = BitmapMemoryPool::GetStats();
+
+  BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(5000);
+  EXPECT_EQ(5000u, buffer.size());
+  EXPECT_GE(buffer.capacity(), BitmapMemoryPool::GetSizeClassCapacity(5000));
+  const uint8_t* const pData = buffer.data();
+
+  BitmapMemoryPool::Recycle(std::move(buffer));
+  {
+    const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+    EXPECT_EQ(1u, stats.PooledBuffers);
+    EXPECT_EQ(oldStats.RecycleCount + 1u, stats.RecycleCount);
+  }
+
+  // A slightly smaller request in the same size class is served by the recycled buffer
+  const BitmapMemoryBuffer buffer2 = BitmapMemoryPool::AcquireUninitialized(4900);
+  EXPECT_EQ(4900u, buffer2.size());
+  EXPECT_EQ(pData, buffer2.data());
+
+  const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+  EXPECT_EQ(oldStats.AcquireCount + 2u, stats.AcquireCount);
+  EXPECT_EQ(oldStats.HitCount + 1u, stats.HitCount);
+  EXPECT_EQ(oldStats.MissCount + 1u, stats.MissCount);
+  EXPECT_EQ(0u, stats.PooledBuffers);
+  EXPECT_EQ(0u, stats.PooledBytes);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, AcquireUninitialized_MissAllocatesSizeClass)
+{
+  const BitmapMemoryPoolStats oldStats = BitmapMemoryPool::GetStats();
+
+  // A miss hands out a uninitialized allocation of the full size class, so it can be recycled into the same class
+  const BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(5000);
+  EXPECT_EQ(5000u, buffer.size());
+  EXPECT_EQ(BitmapMemoryPool::GetSizeClassCapacity(5000), buffer.capacity());
+  EXPECT_EQ(oldStats.MissCount + 1u, BitmapMemoryPool::GetStats().MissCount);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, AcquireZeroed_RecycledBufferIsCleared)
+{
+  BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(4096);
+  std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0xFF));
+  const uint8_t* const pData = buffer.data();
+  BitmapMemoryPool::Recycle(std::move(buffer));
+
+  const BitmapMemoryBuffer buffer2 = BitmapMemoryPool::AcquireZeroed(4096);
+  EXPECT_EQ(pData, buffer2.data());
+  EXPECT_EQ(4096u, buffer2.size());
+  EXPECT_TRUE(IsAllZero(buffer2));
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, ResizeUninitialized_GrowRecyclesOldBuffer)
+{
+  BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(4096);
+  buffer[0] = 0x42;
+  const uint8_t* const pOldData = buffer.data();
+
+  // Growing beyond the capacity moves the content to a new buffer and hands the old one to the pool
+  buffer.ResizeUninitialized(64 * 1024);
+  EXPECT_EQ(64u * 1024u, buffer.size());
+  EXPECT_EQ(0x42, buffer[0]);
+  EXPECT_EQ(1u, BitmapMemoryPool::GetStats().PooledBuffers);
+
+  const BitmapMemoryBuffer buffer2 = BitmapMemoryPool::AcquireUninitialized(4096);
+  EXPECT_EQ(pOldData, buffer2.data());
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, AcquireUninitialized_HugePageAdviceAlignsAllocation)
+{
+  constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+  BitmapMemoryPool::SetConfig(BitmapMemoryPoolConfig(MinPooledByteSize, 8 * HugePageSize, 2, true));
+
+  const BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(HugePageSize + 1);
+  EXPECT_EQ(HugePageSize + 1, buffer.size());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffer.data()) % HugePageSize);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Recycle_SmallBufferIsNotPooled)
+{
+  std::vector<uint8_t> buffer(MinPooledByteSize / 2);
+  buffer.shrink_to_fit();
+  BitmapMemoryPool::Recycle(BitmapMemoryBuffer(std::move(buffer)));
+  EXPECT_EQ(0u, BitmapMemoryPool::GetStats().PooledBuffers);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Recycle_MaxBuffersPerSizeClass)
+{
+  const BitmapMemoryPoolStats oldStats = BitmapMemoryPool::GetStats();
+
+  BitmapMemoryBuffer buffer0 = BitmapMemoryPool::AcquireUninitialized(4096);
+  BitmapMemoryBuffer buffer1 = BitmapMemoryPool::AcquireUninitialized(4096);
+  BitmapMemoryBuffer buffer2 = BitmapMemoryPool::AcquireUninitialized(4096);
+  BitmapMemoryPool::Recycle(std::move(buffer0));
+  BitmapMemoryPool::Recycle(std::move(buffer1));
+  BitmapMemoryPool::Recycle(std::move(buffer2));
+
+  const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+  EXPECT_EQ(2u, stats.PooledBuffers);
+  EXPECT_EQ(oldStats.DiscardCount + 1u, stats.DiscardCount);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Recycle_MaxPooledBytes)
+{
+  const BitmapMemoryPoolStats oldStats = BitmapMemoryPool::GetStats();
+
+  // The pool is limited to 1MB
+  BitmapMemoryBuffer buffer0 = BitmapMemoryPool::AcquireUninitialized(768 * 1024);
+  BitmapMemoryBuffer buffer1 = BitmapMemoryPool::AcquireUninitialized(512 * 1024);
+  BitmapMemoryPool::Recycle(std::move(buffer0));
+  BitmapMemoryPool::Recycle(std::move(buffer1));
+
+  const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+  EXPECT_EQ(1u, stats.PooledBuffers);
+  EXPECT_LE(stats.PooledBytes, 1024u * 1024u);
+  EXPECT_EQ(oldStats.DiscardCount + 1u, stats.DiscardCount);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Trim)
+{
+  BitmapMemoryPool::Recycle(BitmapMemoryPool::AcquireUninitialized(4096));
+  EXPECT_EQ(1u, BitmapMemoryPool::GetStats().PooledBuffers);
+
+  BitmapMemoryPool::Trim();
+
+  const BitmapMemoryPoolStats stats = BitmapMemoryPool::GetStats();
+  EXPECT_EQ(0u, stats.PooledBuffers);
+  EXPECT_EQ(0u, stats.PooledBytes);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Bitmap_DestroyRecyclesContent)
+{
+  const void* pOldContent = nullptr;
+  {
+    Bitmap bitmap(PxSize2D::Create(64, 64), PixelFormat::R8G8B8A8_UNORM);
+    const Bitmap::ScopedDirectReadAccess access(bitmap);
+    pOldContent = access.AsRawBitmap().Content();
+  }
+  EXPECT_EQ(1u, BitmapMemoryPool::GetStats().PooledBuffers);
+
+  Bitmap bitmap(Bitmap::CreateUninitialized(PxSize2D::Create(64, 64), PixelFormat::R8G8B8A8_UNORM));
+  EXPECT_EQ(PxSize2D::Create(64, 64), bitmap.GetSize());
+  EXPECT_EQ(PixelFormat::R8G8B8A8_UNORM, bitmap.GetPixelFormat());
+  const Bitmap::ScopedDirectReadAccess access(bitmap);
+  EXPECT_EQ(pOldContent, access.AsRawBitmap().Content());
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Bitmap_ConstructFromPooledBufferIsCleared)
+{
+  BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(64 * 64 * 4);
+  std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0xFF));
+  BitmapMemoryPool::Recycle(std::move(buffer));
+
+  // The normal constructor still guarantees cleared content
+  Bitmap bitmap(PxSize2D::Create(64, 64), PixelFormat::R8G8B8A8_UNORM);
+  EXPECT_EQ(0u, BitmapMemoryPool::GetStats().PooledBuffers);
+  EXPECT_EQ(0u, bitmap.GetNativePixel(0, 0));
+  EXPECT_EQ(0u, bitmap.GetNativePixel(63, 63));
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Bitmap_CreateUninitialized_ClearsPadding)
+{
+  constexpr PxSize2D SizePx = PxSize2D::Create(341, 4);
+  // 341 * 3 = 1023 bytes, so a 32bit aligned stride has one padding byte
+  BitmapMemoryBuffer buffer = BitmapMemoryPool::AcquireUninitialized(1024 * 4);
+  std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0xFF));
+  BitmapMemoryPool::Recycle(std::move(buffer));
+
+  Bitmap bitmap(Bitmap::CreateUninitialized(SizePx, PixelFormat::R8G8B8_UNORM, BitmapOrigin::UpperLeft, StrideRequirement::MinimumAlign32Bit));
+  ASSERT_EQ(1024u, bitmap.Stride());
+  const Bitmap::ScopedDirectReadAccess access(bitmap);
+  const auto* const pContent = static_cast<const uint8_t*>(access.AsRawBitmap().Content());
+  for (uint32_t y = 0; y < SizePx.RawUnsignedHeight(); ++y)
+  {
+    EXPECT_EQ(0u, pContent[(y * 1024u) + 1023u]);
+  }
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, BitmapMemory_CreateUninitialized)
+{
+  BitmapMemory memory(BitmapMemory::CreateUninitialized(PxSize2D::Create(32, 16), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::LowerLeft));
+  EXPECT_EQ(PxSize2D::Create(32, 16), memory.GetSize());
+  EXPECT_EQ(PixelFormat::R8G8B8A8_UNORM, memory.GetPixelFormat());
+  EXPECT_EQ(BitmapOrigin::LowerLeft, memory.GetOrigin());
+  EXPECT_EQ(32u * 4u, memory.Stride());
+  EXPECT_TRUE(memory.IsTightlyPacked());
+
+  memory.Reset();
+  EXPECT_EQ(1u, BitmapMemoryPool::GetStats().PooledBuffers);
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Texture_CreateUninitialized)
+{
+  const TextureBlobBuilder builder(TextureType::Tex2D, PxExtent3D::Create(32, 32, 1), PixelFormat::R8G8B8A8_UNORM, TextureInfo(1, 1, 1),
+                                   BitmapOrigin::UpperLeft, true);
+  const void* pOldContent = nullptr;
+  {
+    Texture texture(builder);
+    const Texture::ScopedDirectReadAccess access(texture);
+    pOldContent = access.AsRawTexture().GetContent();
+  }
+  EXPECT_EQ(1u, BitmapMemoryPool::GetStats().PooledBuffers);
+
+  Texture texture(Texture::CreateUninitialized(builder));
+  EXPECT_TRUE(texture.IsValid());
+  EXPECT_EQ(builder.GetContentSize(), texture.GetByteSize());
+  const Texture::ScopedDirectReadAccess access(texture);
+  EXPECT_EQ(pOldContent, access.AsRawTexture().GetContent());
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, Bitmap_ReleaseDoesNotCopyVectorContent)
+{
+  std::vector<uint8_t> content(16 * 16 * 4);
+  const uint8_t* const pContent = content.data();
+
+  Bitmap bitmap(std::move(content), PxSize2D::Create(16, 16), PixelFormat::R8G8B8A8_UNORM);
+  BitmapMemory memory = bitmap.Release();
+  const std::vector<uint8_t> releasedContent = memory.Release();
+  EXPECT_EQ(pContent, releasedContent.data());
+}
+
+
+TEST_F(TestBitmap_BitmapMemoryPool, ContainerTypeConvert_KeepsPooledContent)
+{
+  Bitmap bitmap(Bitmap::CreateUninitialized(PxSize2D::Create(64, 64), PixelFormat::R8G8B8A8_UNORM));
+  const void* pContent = nullptr;
+  {
+    const Bitmap::ScopedDirectReadAccess access(bitmap);
+    pContent = access.AsRawBitmap().Content();
+  }
+
+  Texture texture = ContainerTypeConvert::Convert(std::move(bitmap));
+  Bitmap result = ContainerTypeConvert::Convert(std::move(texture));
+  EXPECT_EQ(PxSize2D::Create(64, 64), result.GetSize());
+  const Bitmap::ScopedDirectReadAccess access(result);
+  EXPECT_EQ(pContent, access.AsRawBitmap().Content());
+}
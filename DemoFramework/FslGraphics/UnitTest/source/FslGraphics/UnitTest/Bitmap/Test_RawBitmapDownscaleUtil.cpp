@@ -0,0 +1,387 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Bitmap/RawBitmapDownscaleUtil.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/Log/LogPixelFormat.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestBitmap_RawBitmapDownscaleUtil = TestFixtureFslGraphics;
+
+  //! A bitmap with a padded stride so the row handling gets tested
+  struct TestBitmap
+  {
+    std::vector<uint8_t> Content;
+    PxSize2D Size;
+    PixelFormat Format{PixelFormat::Undefined};
+    uint32_t Stride{0};
+
+    TestBitmap(const PxSize2D sizePx, const PixelFormat pixelFormat)
+      : Size(sizePx)
+      , Format(pixelFormat)
+      , Stride(PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat) + 12u)
+    {
+      Content.resize(static_cast<std::size_t>(Stride) * sizePx.RawUnsignedHeight());
+    }
+
+    RawBitmapEx AsRawBitmap()
+    {
+      return RawBitmapEx::Create(SpanUtil::AsSpan(Content), Size, Format, Stride, BitmapOrigin::UpperLeft);
+    }
+
+    ReadOnlyRawBitmap AsReadOnlyRawBitmap() const
+    {
+      return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(Content), Size, Format, Stride, BitmapOrigin::UpperLeft);
+    }
+
+    uint8_t* GetPixel(const uint32_t x, const uint32_t y)
+    {
+      return Content.data() + (static_cast<std::size_t>(y) * Stride) + (x * PixelFormatUtil::GetBytesPerPixel(Format));
+    }
+
+    const uint8_t* GetPixel(const uint32_t x, const uint32_t y) const
+    {
+      return Content.data() + (static_cast<std::size_t>(y) * Stride) + (x * PixelFormatUtil::GetBytesPerPixel(Format));
+    }
+
+    float GetFloat(const uint32_t x, const uint32_t y, const uint32_t channel) const
+    {
+      float value = 0.0f;
+      std::memcpy(&value, GetPixel(x, y) + (channel * sizeof(float)), sizeof(float));
+      return value;
+    }
+
+    void SetFloat(const uint32_t x, const uint32_t y, const uint32_t channel, const float value)
+    {
+      std::memcpy(GetPixel(x, y) + (channel * sizeof(float)), &value, sizeof(float));
+    }
+  };
+
+  TestBitmap CreateRandomBitmap(const PxSize2D sizePx, const PixelFormat pixelFormat, const uint32_t seed)
+  {
+    TestBitmap bitmap(sizePx, pixelFormat);
+    std::mt19937 random(seed);
+    if (PixelFormatUtil::GetNumericFormat(pixelFormat) == PixelFormatFlags::NF_SFloat)
+    {
+      std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+      const uint32_t channelCount = PixelFormatUtil::GetChannelCount(pixelFormat);
+      for (uint32_t y = 0; y < sizePx.RawUnsignedHeight(); ++y)
+      {
+        for (uint32_t x = 0; x < sizePx.RawUnsignedWidth(); ++x)
+        {
+          for (uint32_t channel = 0; channel < channelCount; ++channel)
+          {
+            bitmap.SetFloat(x, y, channel, distribution(random));
+          }
+        }
+      }
+    }
+    else
+    {
+      std::uniform_int_distribution<uint32_t> distribution(0, 255);
+      for (auto& rValue : bitmap.Content)
+      {
+        rValue = static_cast<uint8_t>(distribution(random));
+      }
+    }
+    return bitmap;
+  }
+
+  TestBitmap CreateFilledBitmap(const PxSize2D sizePx, const PixelFormat pixelFormat, const uint8_t value)
+  {
+    TestBitmap bitmap(sizePx, pixelFormat);
+    std::fill(bitmap.Content.begin(), bitmap.Content.end(), value);
+    return bitmap;
+  }
+
+  PxSize2D GetDownscaledSize(const PxSize2D sizePx)
+  {
+    const uint32_t width = sizePx.RawUnsignedWidth();
+    const uint32_t height = sizePx.RawUnsignedHeight();
+    return PxSize2D::Create(static_cast<int32_t>(width > 1u ? width / 2u : width), static_cast<int32_t>(height > 1u ? height / 2u : height));
+  }
+
+  TestBitmap Downscale(const TestBitmap& src, const TextureMipMapFilter filter)
+  {
+    TestBitmap dst(GetDownscaledSize(src.Size), src.Format);
+    RawBitmapEx dstBitmap = dst.AsRawBitmap();
+    RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), filter);
+    return dst;
+  }
+
+  void ExpectBoxUNorm8(const TestBitmap& dst, const TestBitmap& src)
+  {
+    const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(src.Format);
+    for (uint32_t y = 0; y < dst.Size.RawUnsignedHeight(); ++y)
+    {
+      for (uint32_t x = 0; x < dst.Size.RawUnsignedWidth(); ++x)
+      {
+        for (uint32_t channel = 0; channel < bytesPerPixel; ++channel)
+        {
+          const uint32_t sum = src.GetPixel(x * 2, y * 2)[channel] + src.GetPixel((x * 2) + 1, y * 2)[channel] +
+                               src.GetPixel(x * 2, (y * 2) + 1)[channel] + src.GetPixel((x * 2) + 1, (y * 2) + 1)[channel];
+          ASSERT_EQ(sum / 4, dst.GetPixel(x, y)[channel]);
+        }
+      }
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, IsSupported)
+{
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Nearest));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Box));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Kaiser));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Lanczos));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::B8G8R8A8_SRGB, TextureMipMapFilter::Box));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8_UNORM, TextureMipMapFilter::Box));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8_UNORM, TextureMipMapFilter::Box));
+  EXPECT_TRUE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R32G32B32A32_SFLOAT, TextureMipMapFilter::Lanczos));
+
+  EXPECT_FALSE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R16G16B16A16_SFLOAT, TextureMipMapFilter::Box));
+  EXPECT_FALSE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::A8B8G8R8_UNORM_PACK32, TextureMipMapFilter::Box));
+  EXPECT_FALSE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::R8G8B8A8_UINT, TextureMipMapFilter::Box));
+  EXPECT_FALSE(RawBitmapDownscaleUtil::IsSupported(PixelFormat::Undefined, TextureMipMapFilter::Box));
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_InvalidSize)
+{
+  const TestBitmap src(PxSize2D::Create(8, 8), PixelFormat::R8G8B8A8_UNORM);
+  TestBitmap dst(PxSize2D::Create(4, 3), PixelFormat::R8G8B8A8_UNORM);
+  RawBitmapEx dstBitmap = dst.AsRawBitmap();
+  EXPECT_THROW(RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Box), std::invalid_argument);
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_PixelFormatMismatch)
+{
+  const TestBitmap src(PxSize2D::Create(8, 8), PixelFormat::R8G8B8A8_UNORM);
+  TestBitmap dst(PxSize2D::Create(4, 4), PixelFormat::R8G8B8A8_SRGB);
+  RawBitmapEx dstBitmap = dst.AsRawBitmap();
+  EXPECT_THROW(RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Box), std::invalid_argument);
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_UnsupportedPixelFormat)
+{
+  const TestBitmap src(PxSize2D::Create(8, 8), PixelFormat::R16G16B16A16_SFLOAT);
+  TestBitmap dst(PxSize2D::Create(4, 4), PixelFormat::R16G16B16A16_SFLOAT);
+  RawBitmapEx dstBitmap = dst.AsRawBitmap();
+  EXPECT_THROW(RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Box), NotSupportedException);
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_InvalidRowRange)
+{
+  const TestBitmap src(PxSize2D::Create(8, 8), PixelFormat::R8G8B8A8_UNORM);
+  TestBitmap dst(PxSize2D::Create(4, 4), PixelFormat::R8G8B8A8_UNORM);
+  RawBitmapEx dstBitmap = dst.AsRawBitmap();
+  EXPECT_THROW(RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Box, 2, 3), std::invalid_argument);
+  EXPECT_THROW(RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Box, 5, 0), std::invalid_argument);
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Nearest)
+{
+  const TestBitmap src = CreateRandomBitmap(PxSize2D::Create(38, 14), PixelFormat::R8G8B8_UNORM, 1);
+  const TestBitmap dst = Downscale(src, TextureMipMapFilter::Nearest);
+  for (uint32_t y = 0; y < dst.Size.RawUnsignedHeight(); ++y)
+  {
+    for (uint32_t x = 0; x < dst.Size.RawUnsignedWidth(); ++x)
+    {
+      ASSERT_EQ(0, std::memcmp(src.GetPixel(x * 2, y * 2), dst.GetPixel(x, y), 3));
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Box_UNorm8)
+{
+  // The width is chosen so both the SIMD code and the scalar tail is used
+  for (const PixelFormat pixelFormat : {PixelFormat::R8G8B8A8_UNORM, PixelFormat::B8G8R8A8_UNORM, PixelFormat::R8G8B8_UNORM, PixelFormat::R8_UNORM})
+  {
+    const TestBitmap src = CreateRandomBitmap(PxSize2D::Create(86, 10), pixelFormat, 2);
+    const TestBitmap dst = Downscale(src, TextureMipMapFilter::Box);
+    ExpectBoxUNorm8(dst, src);
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Box_Float32)
+{
+  const TestBitmap src = CreateRandomBitmap(PxSize2D::Create(22, 6), PixelFormat::R32G32B32A32_SFLOAT, 3);
+  const TestBitmap dst = Downscale(src, TextureMipMapFilter::Box);
+  for (uint32_t y = 0; y < dst.Size.RawUnsignedHeight(); ++y)
+  {
+    for (uint32_t x = 0; x < dst.Size.RawUnsignedWidth(); ++x)
+    {
+      for (uint32_t channel = 0; channel < 4u; ++channel)
+      {
+        const float sum0 = src.GetFloat(x * 2, y * 2, channel) + src.GetFloat((x * 2) + 1, y * 2, channel);
+        const float sum1 = src.GetFloat(x * 2, (y * 2) + 1, channel) + src.GetFloat((x * 2) + 1, (y * 2) + 1, channel);
+        ASSERT_EQ((sum0 + sum1) * 0.25f, dst.GetFloat(x, y, channel));
+      }
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Box_Srgb8_LinearAverage)
+{
+  // A black and white checkerboard averages to 50% linear intensity which is 188 when sRGB encoded, the alpha channel is averaged linearly
+  TestBitmap src(PxSize2D::Create(4, 4), PixelFormat::R8G8B8A8_SRGB);
+  for (uint32_t y = 0; y < 4u; ++y)
+  {
+    for (uint32_t x = 0; x < 4u; ++x)
+    {
+      const uint8_t value = ((x + y) & 1u) != 0u ? 255u : 0u;
+      std::array<uint8_t, 4> pixel = {value, value, value, value};
+      std::memcpy(src.GetPixel(x, y), pixel.data(), pixel.size());
+    }
+  }
+  const TestBitmap dst = Downscale(src, TextureMipMapFilter::Box);
+  for (uint32_t y = 0; y < 2u; ++y)
+  {
+    for (uint32_t x = 0; x < 2u; ++x)
+    {
+      EXPECT_EQ(188u, dst.GetPixel(x, y)[0]);
+      EXPECT_EQ(188u, dst.GetPixel(x, y)[1]);
+      EXPECT_EQ(188u, dst.GetPixel(x, y)[2]);
+      EXPECT_EQ(127u, dst.GetPixel(x, y)[3]);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Box_Srgb8_Constant)
+{
+  for (uint32_t value = 0; value < 256u; value += 5u)
+  {
+    const TestBitmap src = CreateFilledBitmap(PxSize2D::Create(6, 4), PixelFormat::R8G8B8_SRGB, static_cast<uint8_t>(value));
+    const TestBitmap dst = Downscale(src, TextureMipMapFilter::Box);
+    ASSERT_EQ(value, dst.GetPixel(1, 1)[0]);
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Windowed_Constant)
+{
+  for (const TextureMipMapFilter filter : {TextureMipMapFilter::Kaiser, TextureMipMapFilter::Lanczos})
+  {
+    for (const PixelFormat pixelFormat : {PixelFormat::R8G8B8A8_UNORM, PixelFormat::R8G8B8A8_SRGB, PixelFormat::R8G8_UNORM})
+    {
+      const TestBitmap src = CreateFilledBitmap(PxSize2D::Create(40, 32), pixelFormat, 200);
+      const TestBitmap dst = Downscale(src, filter);
+      for (const uint8_t value : dst.Content)
+      {
+        // The row padding is zero
+        if (value != 0u)
+        {
+          ASSERT_EQ(200u, value);
+        }
+      }
+      ASSERT_EQ(200u, dst.GetPixel(19, 15)[0]);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Windowed_Float32_Constant)
+{
+  TestBitmap src(PxSize2D::Create(32, 16), PixelFormat::R32G32B32A32_SFLOAT);
+  for (uint32_t y = 0; y < 16u; ++y)
+  {
+    for (uint32_t x = 0; x < 32u; ++x)
+    {
+      for (uint32_t channel = 0; channel < 4u; ++channel)
+      {
+        src.SetFloat(x, y, channel, 4.0f);
+      }
+    }
+  }
+  const TestBitmap dst = Downscale(src, TextureMipMapFilter::Lanczos);
+  for (uint32_t y = 0; y < 8u; ++y)
+  {
+    for (uint32_t x = 0; x < 16u; ++x)
+    {
+      for (uint32_t channel = 0; channel < 4u; ++channel)
+      {
+        ASSERT_NEAR(4.0f, dst.GetFloat(x, y, channel), 0.0001f);
+      }
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Windowed_RowBandsMatchFull)
+{
+  for (const PixelFormat pixelFormat : {PixelFormat::R8G8B8A8_SRGB, PixelFormat::R32G32B32A32_SFLOAT})
+  {
+    const TestBitmap src = CreateRandomBitmap(PxSize2D::Create(44, 38), pixelFormat, 4);
+    const TestBitmap expected = Downscale(src, TextureMipMapFilter::Kaiser);
+
+    TestBitmap dst(expected.Size, pixelFormat);
+    RawBitmapEx dstBitmap = dst.AsRawBitmap();
+    RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Kaiser, 0, 7);
+    RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Kaiser, 7, 1);
+    RawBitmapDownscaleUtil::Downscale(dstBitmap, src.AsReadOnlyRawBitmap(), TextureMipMapFilter::Kaiser, 8, 11);
+    EXPECT_EQ(expected.Content, dst.Content);
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapDownscaleUtil, Downscale_Windowed_SinglePixel)
+{
+  for (const TextureMipMapFilter filter : {TextureMipMapFilter::Box, TextureMipMapFilter::Kaiser, TextureMipMapFilter::Lanczos})
+  {
+    const TestBitmap src = CreateFilledBitmap(PxSize2D::Create(2, 1), PixelFormat::R8G8B8A8_UNORM, 77);
+    const TestBitmap dst = Downscale(src, filter);
+    ASSERT_EQ(PxSize2D::Create(1, 1), dst.Size);
+    EXPECT_EQ(77u, dst.GetPixel(0, 0)[0]);
+    EXPECT_EQ(77u, dst.GetPixel(0, 0)[3]);
+  }
+}
@@ -32,12 +32,16 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Math/LogPoint2.hpp>
 #include <FslBase/Log/Math/Pixel/LogPxExtent2D.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslGraphics/Log/LogPixelFormat.hpp>
 #include <FslGraphics/Log/LogStrideRequirement.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
 #include <FslGraphics/UnitTest/Helper/Common.hpp>
 #include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
 #include <cassert>
+#include <cstring>
+#include <random>
 
 using namespace Fsl;
 
@@ -72,6 +76,30 @@ namespace
     auto c3 = BoxFilterChannel(pixelColor00 & 0xFF, pixelColor10 & 0xFF, pixelColor01 & 0xFF, pixelColor11 & 0xFF);
     return (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
   }
+
+  Texture CreateRandomTexture(const TextureType textureType, const uint32_t size, const uint32_t faces, const PixelFormat pixelFormat)
+  {
+    Texture texture(TextureBlobBuilder(textureType, PxExtent3D::Create(size, size, 1), pixelFormat, TextureInfo(1, faces, 1), BitmapOrigin::UpperLeft,
+                                       true));
+    Texture::ScopedDirectReadWriteAccess access(texture);
+    RawTextureEx rawTexture = access.AsRawTexture();
+    auto* pContent = static_cast<uint8_t*>(rawTexture.GetContent());
+    std::mt19937 random(static_cast<uint32_t>(size + faces));
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+    for (std::size_t i = 0; i < rawTexture.GetByteSize(); ++i)
+    {
+      pContent[i] = static_cast<uint8_t>(distribution(random));
+    }
+    return texture;
+  }
+
+  void ExpectSameContent(const Texture& expected, const Texture& actual)
+  {
+    ASSERT_EQ(expected.GetByteSize(), actual.GetByteSize());
+    Texture::ScopedDirectReadAccess expectedAccess(expected);
+    Texture::ScopedDirectReadAccess actualAccess(actual);
+    EXPECT_EQ(0, std::memcmp(expectedAccess.AsRawTexture().GetContent(), actualAccess.AsRawTexture().GetContent(), expected.GetByteSize()));
+  }
 }
 
 TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_From1X1Bitmap_Box)
@@ -226,3 +254,69 @@ TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_From4X4Bitmap_Box)
   const uint32_t mip2Color00 = BoxFilter(mip1Color00, mip1Color10, mip1Color01, mip1Color11);
   EXPECT_EQ(mip2Color00, GetR8G8B8A8Pixel(result, 2, 0, 0, PxPoint2::Create(0, 0)));
 }
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_JobSystem_MatchesSerial)
+{
+  JobSystem jobSystem(3);
+  const Texture src = CreateRandomTexture(TextureType::Tex2D, 256, 1, PixelFormat::R8G8B8A8_SRGB);
+  for (const TextureMipMapFilter filter : {TextureMipMapFilter::Box, TextureMipMapFilter::Lanczos})
+  {
+    const Texture expected = TextureMipMapUtil::GenerateMipMaps(src, filter);
+    const Texture result = TextureMipMapUtil::GenerateMipMaps(src, filter, jobSystem);
+    EXPECT_EQ(9u, result.GetLevels());
+    ExpectSameContent(expected, result);
+  }
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Cube_JobSystem_MatchesSerial)
+{
+  JobSystem jobSystem(3);
+  const Texture src = CreateRandomTexture(TextureType::TexCube, 128, 6, PixelFormat::R8G8B8A8_UNORM);
+  const Texture expected = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Kaiser);
+  const Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Kaiser, jobSystem);
+  EXPECT_EQ(8u, result.GetLevels());
+  EXPECT_EQ(6u, result.GetFaces());
+  ExpectSameContent(expected, result);
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_UInt_Box)
+{
+  // R8G8B8A8_UINT is not handled by RawBitmapDownscaleUtil so this uses the RawBitmapUtil fallback
+  const uint32_t pixelColor00 = 0x80604020;
+  const uint32_t pixelColor10 = 0x10203040;
+  const uint32_t pixelColor01 = 0x0F0C0804;
+  const uint32_t pixelColor11 = 0x01020304;
+  Bitmap src(2, 2, PixelFormat::R8G8B8A8_UINT, BitmapOrigin::UpperLeft);
+  src.SetNativePixel(0, 0, pixelColor00);
+  src.SetNativePixel(1, 0, pixelColor10);
+  src.SetNativePixel(0, 1, pixelColor01);
+  src.SetNativePixel(1, 1, pixelColor11);
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Box);
+
+  EXPECT_EQ(2u, result.GetLevels());
+  EXPECT_EQ(src.GetPixelFormat(), result.GetPixelFormat());
+  EXPECT_EQ(pixelColor00, GetR8G8B8A8Pixel(result, 0, 0, 0, PxPoint2::Create(0, 0)));
+  EXPECT_EQ(BoxFilter(pixelColor00, pixelColor10, pixelColor01, pixelColor11), GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(0, 0)));
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_UInt_Nearest_JobSystem)
+{
+  JobSystem jobSystem(3);
+  const Texture src = CreateRandomTexture(TextureType::Tex2D, 64, 1, PixelFormat::R8G8B8A8_UINT);
+  const Texture expected = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Nearest);
+  const Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Nearest, jobSystem);
+  EXPECT_EQ(7u, result.GetLevels());
+  EXPECT_EQ(PixelFormat::R8G8B8A8_UINT, result.GetPixelFormat());
+  ExpectSameContent(expected, result);
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_UInt_Lanczos_NotSupported)
+{
+  const Texture src = CreateRandomTexture(TextureType::Tex2D, 4, 1, PixelFormat::R8G8B8A8_UINT);
+  EXPECT_THROW(TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Lanczos), NotSupportedException);
+}
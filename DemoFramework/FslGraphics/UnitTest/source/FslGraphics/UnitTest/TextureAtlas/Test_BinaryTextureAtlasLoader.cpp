@@ -29,11 +29,13 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/File.hpp>
 #include <FslBase/Log/IO/LogPath.hpp>
 #include <FslBase/Log/Math/LogPoint2.hpp>
 #include <FslBase/Log/Math/LogRectangle.hpp>
 #include <FslBase/Log/Math/LogThickness.hpp>
 #include <FslBase/Log/String/LogUTF8String.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/TextureAtlas/BasicTextureAtlas.hpp>
 #include <FslGraphics/TextureAtlas/BinaryTextureAtlasLoader.hpp>
@@ -86,3 +88,35 @@ TEST_F(TestTextureAtlasBinaryTextureAtlasLoader, Load_NotFound)
   EXPECT_THROW(BinaryTextureAtlasLoader::Load(atlas, m_notExistingFilename), FormatException);
   EXPECT_EQ(0u, atlas.Count());
 }
+
+
+TEST_F(TestTextureAtlasBinaryTextureAtlasLoader, Decode)
+{
+  const std::vector<uint8_t> content = IO::File::ReadAllBytes(m_smallAtlasFilename);
+
+  BasicTextureAtlas atlas;
+  BinaryTextureAtlasLoader::Decode(atlas, SpanUtil::AsReadOnlySpan(content));
+
+  BasicTextureAtlas loadedAtlas;
+  BinaryTextureAtlasLoader::Load(loadedAtlas, m_smallAtlasFilename);
+
+  ASSERT_EQ(loadedAtlas.Count(), atlas.Count());
+  const auto& entry0 = atlas.GetEntry(0);
+  const auto& loadedEntry0 = loadedAtlas.GetEntry(0);
+  EXPECT_EQ(loadedEntry0.Name, entry0.Name);
+  EXPECT_EQ(loadedEntry0.TextureInfo.OffsetPx, entry0.TextureInfo.OffsetPx);
+  EXPECT_EQ(loadedEntry0.TextureInfo.ExtentPx, entry0.TextureInfo.ExtentPx);
+  EXPECT_EQ(loadedEntry0.TextureInfo.TrimMarginPx, entry0.TextureInfo.TrimMarginPx);
+  EXPECT_EQ(loadedEntry0.TextureInfo.TrimmedRectPx, entry0.TextureInfo.TrimmedRectPx);
+  EXPECT_EQ(loadedEntry0.TextureInfo.Dpi, entry0.TextureInfo.Dpi);
+}
+
+
+TEST_F(TestTextureAtlasBinaryTextureAtlasLoader, Decode_Truncated)
+{
+  const std::vector<uint8_t> content = IO::File::ReadAllBytes(m_smallAtlasFilename);
+  ASSERT_GT(content.size(), 1u);
+
+  BasicTextureAtlas atlas;
+  EXPECT_THROW(BinaryTextureAtlasLoader::Decode(atlas, SpanUtil::AsReadOnlySpan(content).subspan(0, content.size() - 1)), FormatException);
+}
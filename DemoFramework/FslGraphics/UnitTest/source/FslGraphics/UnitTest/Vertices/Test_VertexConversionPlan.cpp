@@ -0,0 +1,224 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Math/LogVector2.hpp>
+#include <FslBase/Log/Math/LogVector3.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlanCache.hpp>
+#include <FslGraphics/Vertices/VertexPositionColor.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorF.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTangentTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestVertices_VertexConversionPlan = TestFixtureFslGraphics;
+
+  std::vector<VertexPositionNormalTexture> CreateVertices(const std::size_t count)
+  {
+    std::vector<VertexPositionNormalTexture> vertices(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i);
+      vertices[i] = VertexPositionNormalTexture(Vector3(value, value + 1.0f, value + 2.0f), Vector3(-value, -value - 1.0f, -value - 2.0f),
+                                                Vector2(value * 0.5f, value * 0.25f));
+    }
+    return vertices;
+  }
+
+  void ExpectConverted(const std::vector<VertexPositionNormalTangentTexture>& dst, const std::vector<VertexPositionNormalTexture>& src,
+                       const VertexPositionNormalTangentTexture& defaultValue)
+  {
+    ASSERT_EQ(src.size(), dst.size());
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+      EXPECT_EQ(src[i].Position, dst[i].Position);
+      EXPECT_EQ(src[i].Normal, dst[i].Normal);
+      EXPECT_EQ(defaultValue.Tangent, dst[i].Tangent);
+      EXPECT_EQ(src[i].TextureCoordinate, dst[i].TextureCoordinate);
+    }
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_Default)
+{
+  VertexConversionPlan plan;
+
+  EXPECT_EQ(0u, plan.GetDstVertexStride());
+  EXPECT_EQ(0u, plan.GetSrcVertexStride());
+  EXPECT_FALSE(plan.IsStraightCopy());
+  EXPECT_TRUE(plan.GetOperations().empty());
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_SameFormat)
+{
+  VertexConversionPlan plan(VertexPositionNormalTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+
+  EXPECT_TRUE(plan.IsStraightCopy());
+  ASSERT_EQ(1u, plan.GetOperations().size());
+  EXPECT_EQ(VertexConversionPlan::Operation(VertexConversionPlan::OperationType::Copy, 0u, 0u, sizeof(VertexPositionNormalTexture)),
+            plan.GetOperations()[0]);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_FusesAdjacentElements)
+{
+  VertexConversionPlan plan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+
+  EXPECT_FALSE(plan.IsStraightCopy());
+  EXPECT_EQ(sizeof(VertexPositionNormalTangentTexture), plan.GetDstVertexStride());
+  EXPECT_EQ(sizeof(VertexPositionNormalTexture), plan.GetSrcVertexStride());
+
+  // Position and normal are fused into one copy
+  const auto operations = plan.GetOperations();
+  ASSERT_EQ(3u, operations.size());
+  EXPECT_EQ(VertexConversionPlan::Operation(VertexConversionPlan::OperationType::Copy, offsetof(VertexPositionNormalTangentTexture, Position),
+                                            offsetof(VertexPositionNormalTexture, Position), sizeof(Vector3) * 2),
+            operations[0]);
+  EXPECT_EQ(VertexConversionPlan::Operation(VertexConversionPlan::OperationType::Fill, offsetof(VertexPositionNormalTangentTexture, Tangent),
+                                            offsetof(VertexPositionNormalTangentTexture, Tangent), sizeof(Vector3)),
+            operations[1]);
+  EXPECT_EQ(VertexConversionPlan::Operation(VertexConversionPlan::OperationType::Copy,
+                                            offsetof(VertexPositionNormalTangentTexture, TextureCoordinate),
+                                            offsetof(VertexPositionNormalTexture, TextureCoordinate), sizeof(Vector2)),
+            operations[2]);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_FormatConversion_NotImplemented)
+{
+  EXPECT_THROW(VertexConversionPlan(VertexPositionColorF::AsVertexDeclarationSpan(), VertexPositionColor::AsVertexDeclarationSpan()),
+               NotImplementedException);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Convert)
+{
+  // Use a count that is not a multiple of the internal block size
+  const std::vector<VertexPositionNormalTexture> src = CreateVertices(150);
+  std::vector<VertexPositionNormalTangentTexture> dst(src.size());
+  const VertexPositionNormalTangentTexture defaultValue(Vector3(), Vector3(), Vector3(7.0f, 8.0f, 9.0f), Vector2());
+
+  VertexConversionPlan plan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  plan.Convert(dst.data(), dst.size() * sizeof(VertexPositionNormalTangentTexture), src.data(), src.size() * sizeof(VertexPositionNormalTexture),
+               src.size(), &defaultValue, sizeof(VertexPositionNormalTangentTexture));
+
+  ExpectConverted(dst, src, defaultValue);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Convert_StraightCopy)
+{
+  const std::vector<VertexPositionNormalTexture> src = CreateVertices(10);
+  std::vector<VertexPositionNormalTexture> dst(src.size());
+  const VertexPositionNormalTexture defaultValue;
+
+  VertexConversionPlan plan(VertexPositionNormalTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  plan.Convert(dst.data(), dst.size() * sizeof(VertexPositionNormalTexture), src.data(), src.size() * sizeof(VertexPositionNormalTexture),
+               src.size(), &defaultValue, sizeof(VertexPositionNormalTexture));
+
+  EXPECT_EQ(src, dst);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Convert_JobSystem)
+{
+  // Use a count large enough to be split into multiple chunks
+  const std::vector<VertexPositionNormalTexture> src = CreateVertices(50001);
+  std::vector<VertexPositionNormalTangentTexture> dst(src.size());
+  const VertexPositionNormalTangentTexture defaultValue(Vector3(), Vector3(), Vector3(7.0f, 8.0f, 9.0f), Vector2());
+
+  JobSystem jobSystem(2);
+  VertexConversionPlan plan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  plan.Convert(jobSystem, dst.data(), dst.size() * sizeof(VertexPositionNormalTangentTexture), src.data(),
+               src.size() * sizeof(VertexPositionNormalTexture), src.size(), &defaultValue, sizeof(VertexPositionNormalTangentTexture));
+
+  ExpectConverted(dst, src, defaultValue);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Convert_InvalidArguments)
+{
+  const std::vector<VertexPositionNormalTexture> src = CreateVertices(4);
+  std::vector<VertexPositionNormalTangentTexture> dst(src.size());
+  const VertexPositionNormalTangentTexture defaultValue;
+  constexpr auto CbDst = sizeof(VertexPositionNormalTangentTexture) * 4;
+  constexpr auto CbSrc = sizeof(VertexPositionNormalTexture) * 4;
+  constexpr auto CbDefault = sizeof(VertexPositionNormalTangentTexture);
+
+  VertexConversionPlan plan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  EXPECT_THROW(plan.Convert(nullptr, CbDst, src.data(), CbSrc, 4, &defaultValue, CbDefault), std::invalid_argument);
+  EXPECT_THROW(plan.Convert(dst.data(), CbDst, nullptr, CbSrc, 4, &defaultValue, CbDefault), std::invalid_argument);
+  EXPECT_THROW(plan.Convert(dst.data(), CbDst, src.data(), CbSrc, 4, nullptr, CbDefault), std::invalid_argument);
+  EXPECT_THROW(plan.Convert(dst.data(), CbDst, src.data(), CbSrc, 4, &defaultValue, CbDefault - 1), std::invalid_argument);
+  EXPECT_THROW(plan.Convert(dst.data(), CbDst - 1, src.data(), CbSrc, 4, &defaultValue, CbDefault), std::invalid_argument);
+  EXPECT_THROW(plan.Convert(dst.data(), CbDst, src.data(), CbSrc - 1, 4, &defaultValue, CbDefault), std::invalid_argument);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Cache_GetPlan)
+{
+  VertexConversionPlanCache cache;
+  EXPECT_EQ(0u, cache.Count());
+
+  const auto plan0 =
+    cache.GetPlan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  const auto plan1 =
+    cache.GetPlan(VertexPositionNormalTangentTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  EXPECT_EQ(1u, cache.Count());
+  ASSERT_NE(nullptr, plan0);
+  EXPECT_EQ(plan0, plan1);
+
+  const auto plan2 = cache.GetPlan(VertexPositionNormalTexture::AsVertexDeclarationSpan(), VertexPositionNormalTexture::AsVertexDeclarationSpan());
+  EXPECT_EQ(2u, cache.Count());
+  EXPECT_NE(plan0, plan2);
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Count());
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Cache_GetPlan_FormatConversion_NotCached)
+{
+  VertexConversionPlanCache cache;
+  EXPECT_THROW(cache.GetPlan(VertexPositionColorF::AsVertexDeclarationSpan(), VertexPositionColor::AsVertexDeclarationSpan()),
+               NotImplementedException);
+  EXPECT_EQ(0u, cache.Count());
+}
@@ -37,6 +37,7 @@
 #include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslGraphics/Bitmap/BitmapClearMethod.hpp>
 #include <FslGraphics/Bitmap/BitmapMemory.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/Bitmap/RawBitmapEx.hpp>
 #include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
@@ -52,7 +53,7 @@ namespace Fsl
   class Bitmap
   {
     //! The raw image data
-    std::vector<uint8_t> m_content;
+    BitmapMemoryBuffer m_content;
     PxSize2D m_sizePx;
     uint32_t m_stride{0};
     uint32_t m_bytesPerPixel{0};
@@ -159,6 +160,11 @@ namespace Fsl
 
     ~Bitmap();
 
+    //! @brief Create a bitmap using pooled storage without initializing the pixels (any stride padding is cleared).
+    //! @warning The pixel content is unspecified (it can contain leftover data), so only use this when every pixel will be written.
+    static Bitmap CreateUninitialized(const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin bitmapOrigin = BitmapOrigin::UpperLeft,
+                                      const StrideRequirement strideRequirement = StrideRequirement::Any);
+
     bool IsValid() const noexcept
 
     {
@@ -570,8 +576,11 @@ namespace Fsl
     RawBitmapEx LockEx();
     void UnlockEx(const RawBitmapEx& bitmap) noexcept;
     void Unlock() const noexcept;
-    void ResizeToFit(const PxSize2D sizePx, const PixelFormat pixelFormat, const StrideRequirement strideRequirement, const uint32_t stride = 0);
+    void ResizeToFit(const PxSize2D sizePx, const PixelFormat pixelFormat, const StrideRequirement strideRequirement, const uint32_t stride = 0,
+                     const bool zeroFill = true);
     void Clear(const BitmapClearMethod clearMethod);
+    void DoReset(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const uint32_t stride,
+                 const BitmapOrigin bitmapOrigin);
     void ResetNoThrow() noexcept;
   };
 }
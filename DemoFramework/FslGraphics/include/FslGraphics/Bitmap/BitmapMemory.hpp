@@ -34,6 +34,7 @@
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/Math/Pixel/PxSize2D.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/PixelFormat.hpp>
 #include <vector>
@@ -43,7 +44,7 @@ namespace Fsl
   //! @brief A simple safe way to transfer the 'memory/info/ between 'Bitmap like' classes.
   class BitmapMemory final
   {
-    std::vector<uint8_t> m_content;
+    BitmapMemoryBuffer m_content;
     PxSize2D m_sizePx;
     PixelFormat m_pixelFormat{PixelFormat::Undefined};
     BitmapOrigin m_origin{BitmapOrigin::UpperLeft};
@@ -60,6 +61,7 @@ namespace Fsl
     BitmapMemory& operator=(const BitmapMemory&) = default;
 
     BitmapMemory() = default;
+    ~BitmapMemory();
 
 
     PxSize2D GetSize() const noexcept
@@ -96,7 +98,11 @@ namespace Fsl
     void Reset() noexcept;
 
     //! @brief Release the internal vector and 'reset' the class
-    [[nodiscard]] std::vector<uint8_t> Release() noexcept;
+    //! @note If the content lives in pooled storage it is copied into the returned vector.
+    [[nodiscard]] std::vector<uint8_t> Release();
+
+    //! @brief Release the internal buffer and 'reset' the class (never copies the content)
+    [[nodiscard]] BitmapMemoryBuffer ReleaseBuffer() noexcept;
 
     static BitmapMemory Create(const ReadOnlySpan<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin);
     static BitmapMemory Create(const ReadOnlySpan<uint8_t>, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin,
@@ -116,8 +122,17 @@ namespace Fsl
     static BitmapMemory UncheckedCreate(std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
                                         const BitmapOrigin origin, const uint32_t stride);
 
+    static BitmapMemory UncheckedCreate(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
+                                        const BitmapOrigin origin);
+    static BitmapMemory UncheckedCreate(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
+                                        const BitmapOrigin origin, const uint32_t stride);
+
+    //! @brief Create tightly packed bitmap memory using pooled storage without initializing the pixels.
+    //! @warning The content is unspecified (it can contain leftover data), so only use this when every pixel will be written.
+    static BitmapMemory CreateUninitialized(const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin);
+
   private:
-    BitmapMemory(std::vector<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin,
+    BitmapMemory(BitmapMemoryBuffer content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin,
                  const uint32_t stride);
   };
 }
@@ -0,0 +1,201 @@
+#ifndef FSLGRAPHICS_BITMAP_BITMAPMEMORYBUFFER_HPP
+#define FSLGRAPHICS_BITMAP_BITMAPMEMORYBUFFER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief The pixel storage used by Bitmap, BitmapMemory, TightBitmap and Texture.
+  //!        It either owns a std::vector that was handed to it (so it can be handed back without a copy) or a BitmapMemoryPool allocation.
+  //!        A pool allocation is default initialized, so allocating it does not touch the memory.
+  class BitmapMemoryBuffer
+  {
+    //! Releases a allocation made with the matching (optionally over-aligned) operator new
+    struct AllocationDeleter
+    {
+      //! The alignment the allocation was made with, zero for the default alignment (unique_ptr value initializes its deleter)
+      std::size_t Alignment;
+
+      void operator()(uint8_t* const pAllocation) const noexcept
+      {
+        if (Alignment == 0u)
+        {
+          ::operator delete(pAllocation);
+        }
+        else
+        {
+          ::operator delete(pAllocation, std::align_val_t{Alignment});
+        }
+      }
+    };
+
+    std::vector<uint8_t> m_vector;
+    std::unique_ptr<uint8_t[], AllocationDeleter> m_allocation;
+    std::size_t m_allocationSize{0};
+    std::size_t m_allocationCapacity{0};
+
+  public:
+    BitmapMemoryBuffer() noexcept = default;
+    ~BitmapMemoryBuffer() = default;
+
+    //! @brief Copy the content into a uninitialized pool allocation
+    BitmapMemoryBuffer(const BitmapMemoryBuffer& other);
+    BitmapMemoryBuffer& operator=(const BitmapMemoryBuffer& other);
+
+    BitmapMemoryBuffer(BitmapMemoryBuffer&& other) noexcept
+      : m_vector(std::exchange(other.m_vector, {}))
+      , m_allocation(std::move(other.m_allocation))
+      , m_allocationSize(std::exchange(other.m_allocationSize, 0))
+      , m_allocationCapacity(std::exchange(other.m_allocationCapacity, 0))
+    {
+    }
+
+    BitmapMemoryBuffer& operator=(BitmapMemoryBuffer&& other) noexcept
+    {
+      if (this != &other)
+      {
+        m_vector = std::exchange(other.m_vector, {});
+        m_allocation = std::move(other.m_allocation);
+        m_allocationSize = std::exchange(other.m_allocationSize, 0);
+        m_allocationCapacity = std::exchange(other.m_allocationCapacity, 0);
+      }
+      return *this;
+    }
+
+    //! @brief Take ownership of the vector content (no copy)
+    explicit BitmapMemoryBuffer(std::vector<uint8_t>&& content) noexcept
+      : m_vector(std::move(content))
+    {
+    }
+
+    //! @brief Allocate capacity bytes without initializing them.
+    //! @param byteSize the size of the buffer (must be <= capacity)
+    //! @param alignment the alignment of the allocation (must be zero for the default alignment or a power of two).
+    static BitmapMemoryBuffer AllocateUninitialized(const std::size_t byteSize, const std::size_t capacity, const std::size_t alignment = 0);
+
+    uint8_t* data() noexcept
+    {
+      return m_allocation ? m_allocation.get() : m_vector.data();
+    }
+
+    const uint8_t* data() const noexcept
+    {
+      return m_allocation ? m_allocation.get() : m_vector.data();
+    }
+
+    std::size_t size() const noexcept
+    {
+      return m_allocation ? m_allocationSize : m_vector.size();
+    }
+
+    std::size_t capacity() const noexcept
+    {
+      return m_allocation ? m_allocationCapacity : m_vector.capacity();
+    }
+
+    bool empty() const noexcept
+    {
+      return size() == 0u;
+    }
+
+    uint8_t* begin() noexcept
+    {
+      return data();
+    }
+
+    const uint8_t* begin() const noexcept
+    {
+      return data();
+    }
+
+    uint8_t* end() noexcept
+    {
+      return data() + size();
+    }
+
+    const uint8_t* end() const noexcept
+    {
+      return data() + size();
+    }
+
+    uint8_t& operator[](const std::size_t index) noexcept
+    {
+      assert(index < size());
+      return data()[index];
+    }
+
+    const uint8_t& operator[](const std::size_t index) const noexcept
+    {
+      assert(index < size());
+      return data()[index];
+    }
+
+    //! @brief Set the size to zero, the storage is kept
+    void clear() noexcept
+    {
+      m_vector.clear();
+      m_allocationSize = 0;
+    }
+
+    //! @brief Change the size, the existing content is kept and the added bytes are zero.
+    void resize(const std::size_t byteSize);
+
+    //! @brief Change the size, the existing content is kept and the content of the added bytes is unspecified.
+    void ResizeUninitialized(const std::size_t byteSize);
+
+    Span<uint8_t> AsSpan() noexcept
+    {
+      return Span<uint8_t>(data(), size());
+    }
+
+    ReadOnlySpan<uint8_t> AsReadOnlySpan() const noexcept
+    {
+      return ReadOnlySpan<uint8_t>(data(), size());
+    }
+
+    //! @brief Release the content as a std::vector, this only copies the content if it is a pool allocation.
+    [[nodiscard]] std::vector<uint8_t> ReleaseAsVector();
+
+  private:
+    void Reallocate(const std::size_t byteSize);
+  };
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOL_HPP
+#define FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPoolConfig.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPoolStats.hpp>
+
+namespace Fsl
+{
+  //! @brief A process wide, thread safe pool of pixel buffers.
+  //!        Buffers are grouped in size classes (four classes per power of two) so a recycled buffer can serve any request in its class.
+  //!        Bitmap and Texture return their buffers here when they are destroyed or reset, and allocate from here when they need a new buffer.
+  //! @note  A pool miss allocates the buffer without touching it, so a uninitialized acquire never pays for a zero fill.
+  class BitmapMemoryPool
+  {
+  public:
+    static BitmapMemoryPoolConfig GetConfig() noexcept;
+
+    //! @brief Change the pool configuration, this frees all currently pooled buffers.
+    static void SetConfig(const BitmapMemoryPoolConfig& config);
+
+    static BitmapMemoryPoolStats GetStats() noexcept;
+
+    //! @brief Get a buffer of exactly byteSize bytes, the content of the buffer is unspecified.
+    static BitmapMemoryBuffer AcquireUninitialized(const std::size_t byteSize);
+
+    //! @brief Get a buffer of exactly byteSize bytes where all bytes are zero.
+    static BitmapMemoryBuffer AcquireZeroed(const std::size_t byteSize);
+
+    //! @brief Hand a buffer to the pool so it can be reused (buffers that are too small or do not fit in the pool are freed).
+    static void Recycle(BitmapMemoryBuffer buffer) noexcept;
+
+    //! @brief Free all pooled buffers
+    static void Trim() noexcept;
+
+    //! @brief Get the capacity of the size class a request of byteSize bytes is served from
+    static std::size_t GetSizeClassCapacity(const std::size_t byteSize) noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOLCONFIG_HPP
+#define FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOLCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  struct BitmapMemoryPoolConfig
+  {
+    //! Buffers with a capacity below this are never pooled (they are cheap to allocate)
+    uint32_t MinPooledByteSize{64 * 1024};
+    //! The maximum number of bytes the pool will keep alive, a value of zero disables recycling.
+    uint64_t MaxPooledBytes{128 * 1024 * 1024};
+    //! The maximum number of buffers kept per size class
+    uint32_t MaxBuffersPerSizeClass{4};
+    //! New buffers of at least one huge page (2MB) are allocated huge page aligned and the OS is asked to back them with huge pages
+    //! (the advice is only supported on linux, elsewhere only the alignment is applied)
+    bool HugePageAdvice{false};
+
+    constexpr BitmapMemoryPoolConfig() noexcept = default;
+
+    constexpr BitmapMemoryPoolConfig(const uint32_t minPooledByteSize, const uint64_t maxPooledBytes, const uint32_t maxBuffersPerSizeClass,
+                                     const bool hugePageAdvice) noexcept
+      : MinPooledByteSize(minPooledByteSize)
+      , MaxPooledBytes(maxPooledBytes)
+      , MaxBuffersPerSizeClass(maxBuffersPerSizeClass)
+      , HugePageAdvice(hugePageAdvice)
+    {
+    }
+  };
+}
+
+#endif
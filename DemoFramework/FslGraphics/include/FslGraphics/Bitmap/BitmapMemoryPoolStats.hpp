@@ -0,0 +1,61 @@
+#ifndef FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOLSTATS_HPP
+#define FSLGRAPHICS_BITMAP_BITMAPMEMORYPOOLSTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  struct BitmapMemoryPoolStats
+  {
+    //! The number of buffers requested from the pool
+    uint64_t AcquireCount{0};
+    //! The number of requests that were served by a recycled buffer
+    uint64_t HitCount{0};
+    //! The number of requests that required a new allocation
+    uint64_t MissCount{0};
+    //! The number of buffers that were accepted by the pool
+    uint64_t RecycleCount{0};
+    //! The number of poolable buffers that were freed because the pool was full
+    uint64_t DiscardCount{0};
+    //! The total number of bytes allocated by pool misses
+    uint64_t AllocatedBytes{0};
+    //! The number of bytes currently kept alive by the pool
+    uint64_t PooledBytes{0};
+    //! The number of buffers currently kept alive by the pool
+    uint32_t PooledBuffers{0};
+
+    constexpr BitmapMemoryPoolStats() noexcept = default;
+  };
+}
+
+#endif
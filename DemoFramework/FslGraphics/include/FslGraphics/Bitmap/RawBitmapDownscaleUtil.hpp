@@ -0,0 +1,66 @@
+#ifndef FSLGRAPHICS_BITMAP_RAWBITMAPDOWNSCALEUTIL_HPP
+#define FSLGRAPHICS_BITMAP_RAWBITMAPDOWNSCALEUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/PixelFormat.hpp>
+#include <FslGraphics/Texture/TextureMipMapFilter.hpp>
+
+namespace Fsl
+{
+  class RawBitmapEx;
+  class ReadOnlyRawBitmap;
+
+  //! @brief Downscale bitmaps to half their size, this is used to generate mip maps.
+  //!        - 8bit UNorm, 8bit sRGB and 32bit float formats with one to four channels are supported.
+  //!        - sRGB color channels are averaged in linear space, the alpha channel is always linear.
+  //!        - Kaiser and Lanczos are separable windowed sinc filters, the edges are clamped.
+  namespace RawBitmapDownscaleUtil
+  {
+    //! @brief Check if the pixel format can be downscaled using the given filter.
+    extern bool IsSupported(const PixelFormat pixelFormat, const TextureMipMapFilter filter) noexcept;
+
+    //! @brief Downscale the src bitmap to the dst bitmap.
+    //! @note The dst width and height must be max(src / 2, 1) and the origin and pixel format must match.
+    //! @throws std::invalid_argument if the bitmaps are incompatible.
+    //! @throws NotSupportedException if the pixel format or filter is unsupported.
+    extern void Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter);
+
+    //! @brief Downscale the dst rows [dstRowStart, dstRowStart + dstRowCount) from the src bitmap.
+    //! @note This allows multiple threads to generate different row bands of the same dst bitmap.
+    //! @throws std::invalid_argument if the bitmaps are incompatible or the row range is outside the dst bitmap.
+    //! @throws NotSupportedException if the pixel format or filter is unsupported.
+    extern void Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter, const uint32_t dstRowStart,
+                          const uint32_t dstRowCount);
+  }
+}
+
+#endif
@@ -37,6 +37,7 @@
 #include <FslBase/Span/Span.hpp>
 #include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslGraphics/Bitmap/BitmapMemory.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/Bitmap/RawBitmapEx.hpp>
 #include <FslGraphics/PixelFormat.hpp>
@@ -49,7 +50,7 @@ namespace Fsl
   //! @brief Represents a Bitmap that is tightly packed in memory (No padding applied stride).
   class TightBitmap final
   {
-    std::vector<uint8_t> m_content;
+    BitmapMemoryBuffer m_content;
     PxSize2D m_sizePx;
     PixelFormat m_pixelFormat{PixelFormat::Undefined};
     BitmapOrigin m_origin{BitmapOrigin::UpperLeft};
@@ -76,6 +77,7 @@ namespace Fsl
 
     TightBitmap(std::vector<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin);
     TightBitmap(std::vector<uint8_t> content, const PxExtent2D extentPx, const PixelFormat pixelFormat, const BitmapOrigin origin);
+    TightBitmap(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin);
 
     TightBitmap(const ReadOnlySpan<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
       : TightBitmap(SpanUtil::ToVector(content), sizePx, pixelFormat, origin)
@@ -205,7 +207,8 @@ namespace Fsl
     [[nodiscard]] BitmapMemory Release() noexcept;
 
     //! @brief Release the internal vector and 'Reset' the class
-    [[nodiscard]] std::vector<uint8_t> ReleaseAsVector() noexcept;
+    //! @note If the content lives in pooled storage it is copied into the returned vector.
+    [[nodiscard]] std::vector<uint8_t> ReleaseAsVector();
   };
 }
 
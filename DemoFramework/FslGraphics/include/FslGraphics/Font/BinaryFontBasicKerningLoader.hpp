@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
 #include <fstream>
 
 namespace Fsl
@@ -53,6 +54,11 @@ namespace Fsl
     //! @param rTextureAtlas the atlas that will be filled with the loaded atlas
     //! @param stream the stream to load the atlas from
     static void Load(BasicFontKerning& rTextureAtlas, std::ifstream& rStream);
+
+    //! @brief Decode the font kerning from the content span (the kerning does not reference the content after this returns)
+    //! @param rTextureAtlas the kerning that will be filled with the decoded kerning
+    //! @param content the encoded kerning (this can be a memory mapped file).
+    static void Decode(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t>& content);
   };
 }
 
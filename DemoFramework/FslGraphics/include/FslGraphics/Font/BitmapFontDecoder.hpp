@@ -47,8 +47,8 @@ namespace Fsl
     //! @param strFilename the file to load.
     static BitmapFont Load(const IO::Path& strFilename);
 
-    //! @brief decode the bitmap font from the vector
-    //! @param strFilename the file to load.
+    //! @brief decode the bitmap font from the content span (the font does not reference the content after this returns)
+    //! @param content the encoded font (this can be a memory mapped file).
     static BitmapFont Decode(const ReadOnlySpan<uint8_t>& content);
   };
 }
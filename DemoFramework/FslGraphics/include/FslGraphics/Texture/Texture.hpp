@@ -35,6 +35,7 @@
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Math/Pixel/PxExtent3D.hpp>
 #include <FslGraphics/Bitmap/BitmapMemory.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
 #include <FslGraphics/Bitmap/BitmapOrigin.hpp>
 #include <FslGraphics/PixelFormat.hpp>
 #include <FslGraphics/Texture/RawTextureEx.hpp>
@@ -52,7 +53,7 @@ namespace Fsl
   class Texture
   {
     //! The raw image data
-    std::vector<uint8_t> m_content;
+    BitmapMemoryBuffer m_content;
     std::vector<BlobRecord> m_blobs;
     PxExtent3D m_extent;
     PixelFormat m_pixelFormat{PixelFormat::Undefined};
@@ -110,9 +111,17 @@ namespace Fsl
 
     ~Texture();
 
+    //! @brief Create a texture based on the given builder using pooled storage without initializing the content.
+    //! @warning The content is unspecified (it can contain leftover data), so only use this when every texel will be written.
+    static Texture CreateUninitialized(const TextureBlobBuilder& builder);
+
     //! @brief Release the internal content array into the supplied vector, then reset this class
+    //! @note If the content lives in pooled storage it is copied into the vector.
     void ReleaseInto(std::vector<uint8_t>& rContentTarget);
 
+    //! @brief Release the internal content buffer (never copies the content), then reset this class
+    [[nodiscard]] BitmapMemoryBuffer ReleaseBuffer();
+
     //! @brief Destroys the texture and resets the object to its default state.
     void Reset();
 
@@ -366,10 +375,10 @@ namespace Fsl
     };
 
   private:
-    void DoReset(const void* const pContent, const std::size_t contentByteSize, const TextureBlobBuilder& builder);
-    void DoReset(std::vector<uint8_t>&& content, TextureBlobBuilder&& builder);
+    void DoReset(const void* const pContent, const std::size_t contentByteSize, const TextureBlobBuilder& builder, const bool zeroFill = true);
+    void DoReset(BitmapMemoryBuffer&& content, TextureBlobBuilder&& builder);
     void DoReset(const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin);
-    void DoReset(std::vector<uint8_t>&& content, const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin);
+    void DoReset(BitmapMemoryBuffer&& content, const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin);
 
     ReadOnlyRawTexture Lock() const;
     RawTextureEx LockEx();
@@ -38,6 +38,10 @@ namespace Fsl
   {
     Nearest,
     Box,
+    //! Kaiser windowed sinc filter (alpha 4, radius 3)
+    Kaiser,
+    //! Lanczos3 windowed sinc filter
+    Lanczos,
   };
 }
 
@@ -36,6 +36,7 @@
 
 namespace Fsl
 {
+  class JobSystem;
   class Bitmap;
   class ReadOnlyRawBitmap;
   class ReadOnlyRawTexture;
@@ -57,6 +58,18 @@ namespace Fsl
 
     //! @brief Generate a new texture with mip maps based on the src
     extern Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter);
+
+    //! @brief Generate a new texture with mip maps based on the src, the faces and rows of each level are generated in parallel
+    extern Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, the faces and rows of each level are generated in parallel
+    extern Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, the faces and rows of each level are generated in parallel
+    extern Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, the faces and rows of each level are generated in parallel
+    extern Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
   };
 }
 
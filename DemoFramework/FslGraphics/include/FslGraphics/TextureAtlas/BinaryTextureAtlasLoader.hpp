@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
 #include <fstream>
 
 namespace Fsl
@@ -53,6 +54,11 @@ namespace Fsl
     //! @param rTextureAtlas the atlas that will be filled with the loaded atlas
     //! @param stream the stream to load the atlas from
     static void Load(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream);
+
+    //! @brief Decode the texture atlas from the content span (the atlas does not reference the content after this returns)
+    //! @param rTextureAtlas the atlas that will be filled with the decoded atlas
+    //! @param content the encoded atlas (this can be a memory mapped file).
+    static void Decode(BasicTextureAtlas& rTextureAtlas, const ReadOnlySpan<uint8_t>& content);
   };
 }
 
@@ -0,0 +1,163 @@
+#ifndef FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLAN_HPP
+#define FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLAN_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <cstdlib>
+#include <vector>
+
+namespace Fsl
+{
+  class JobSystem;
+
+  //! @brief A precompiled description of how to convert vertices from one vertex declaration to another.
+  //!        The element matching between the two declarations is done once when the plan is created, adjacent element copies are fused into
+  //!        larger memcpy runs and the vertices are then converted in cache friendly blocks.
+  //! @note  The plan only stores offsets and sizes so it can be reused for any number of conversions between the two declarations.
+  class VertexConversionPlan
+  {
+  public:
+    enum class OperationType : uint8_t
+    {
+      //! Copy bytes from the src vertex
+      Copy,
+      //! Copy bytes from the dst default vertex
+      Fill
+    };
+
+    struct Operation
+    {
+      OperationType Type{OperationType::Copy};
+      //! The byte offset into the dst vertex
+      uint32_t DstOffset{0};
+      //! The byte offset into the src vertex (or into the default vertex for fill operations)
+      uint32_t SrcOffset{0};
+      //! The number of bytes to copy
+      uint32_t ByteSize{0};
+
+      constexpr Operation() noexcept = default;
+      constexpr Operation(const OperationType type, const uint32_t dstOffset, const uint32_t srcOffset, const uint32_t byteSize) noexcept
+        : Type(type)
+        , DstOffset(dstOffset)
+        , SrcOffset(srcOffset)
+        , ByteSize(byteSize)
+      {
+      }
+
+      constexpr bool operator==(const Operation& rhs) const noexcept
+      {
+        return Type == rhs.Type && DstOffset == rhs.DstOffset && SrcOffset == rhs.SrcOffset && ByteSize == rhs.ByteSize;
+      }
+
+      constexpr bool operator!=(const Operation& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
+    };
+
+  private:
+    using CopyFunction = void (*)(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                                  const std::size_t vertexCount, const std::size_t byteSize);
+
+    struct CompiledOperation
+    {
+      CopyFunction FnCopy{nullptr};
+      bool IsFill{false};
+      uint32_t DstOffset{0};
+      uint32_t SrcOffset{0};
+      uint32_t ByteSize{0};
+    };
+
+    uint32_t m_dstVertexStride{0};
+    uint32_t m_srcVertexStride{0};
+    bool m_isStraightCopy{false};
+    std::vector<Operation> m_operations;
+    std::vector<CompiledOperation> m_compiled;
+
+  public:
+    VertexConversionPlan() noexcept = default;
+
+    //! @brief Build the conversion plan from srcVertexDeclaration to dstVertexDeclaration.
+    //! @note  Fields that are present in dst but not in src are filled with the default values supplied to Convert. Src fields that isn't present
+    //!        in the dst format will be ignored.
+    //! @throws NotImplementedException if a element format conversion is required.
+    VertexConversionPlan(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration);
+
+    uint32_t GetDstVertexStride() const noexcept
+    {
+      return m_dstVertexStride;
+    }
+
+    uint32_t GetSrcVertexStride() const noexcept
+    {
+      return m_srcVertexStride;
+    }
+
+    //! @brief Check if the conversion can be done as one memcpy of the entire vertex buffer.
+    bool IsStraightCopy() const noexcept
+    {
+      return m_isStraightCopy;
+    }
+
+    //! @brief Get the fused operations sorted by dst offset.
+    ReadOnlySpan<Operation> GetOperations() const noexcept
+    {
+      return ReadOnlySpan<Operation>(m_operations.data(), m_operations.size());
+    }
+
+    //! @brief Convert the vertices.
+    //! @param pDst the dst vertices that should be written to. This points to the start of the first element.
+    //! @param cbDst the number of bytes the pDst array can hold.
+    //! @param pSrc the src vertices that should be converted. This points to the start of the first element.
+    //! @param cbSrc the number of bytes the pSrc array holds.
+    //! @param srcVertexCount the number of source vertices that should be converted.
+    //! @param pDstDefaultValues points to one dst type vertex that holds the default values which is used to fill in required fields in a dst vertex
+    //! which are missing from a src vertex
+    //! @param cbDstDefaultValues the number of bytes used for the default vertex.
+    void Convert(void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc, const std::size_t srcVertexCount,
+                 const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues) const;
+
+    //! @brief Convert the vertices, large vertex counts are split into chunks that are converted in parallel by the job system.
+    //! @note  The parameters match the single threaded Convert.
+    void Convert(JobSystem& jobSystem, void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                 const std::size_t srcVertexCount, const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues) const;
+
+  private:
+    void ValidateConvertArguments(const void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                                  const std::size_t srcVertexCount, const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues) const;
+    void DoConvert(uint8_t* const pDst, const uint8_t* const pSrc, const std::size_t vertexCount, const uint8_t* const pDstDefaultValues) const;
+  };
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLANCACHE_HPP
+#define FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLANCACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexDeclaration.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A thread safe cache of vertex conversion plans keyed by their (dst, src) vertex declaration pair.
+  //! @note  An application normally only converts between a handful of vertex declarations so the cache is a simple list.
+  class VertexConversionPlanCache
+  {
+    struct Record
+    {
+      VertexDeclaration Dst;
+      VertexDeclaration Src;
+      std::shared_ptr<const VertexConversionPlan> Plan;
+    };
+
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+
+  public:
+    VertexConversionPlanCache(const VertexConversionPlanCache&) = delete;
+    VertexConversionPlanCache& operator=(const VertexConversionPlanCache&) = delete;
+
+    VertexConversionPlanCache();
+    ~VertexConversionPlanCache();
+
+    //! @brief Get the plan for the given declaration pair, the plan is created on first use.
+    //! @throws NotImplementedException if a element format conversion is required.
+    std::shared_ptr<const VertexConversionPlan> GetPlan(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration);
+
+    //! @brief Get the number of cached plans
+    std::size_t Count() const;
+
+    //! @brief Remove all cached plans
+    void Clear();
+  };
+}
+
+#endif
@@ -40,7 +40,7 @@ namespace Fsl
   class VertexConverter
   {
   public:
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to
     //! @param dstVertexCapacity the number of vertices that pDst array can hold.
     //! @param pSrc the src vertices that should be converted. This points to the start of the first element.
@@ -54,7 +54,7 @@ namespace Fsl
       Convert(pDst, dstVertexCapacity, pSrc, srcVertexCount, TDstVertexFormat());
     }
 
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to
     //! @param dstVertexCapacity the number of vertices that pDst array can hold.
     //! @param pSrc the src vertices that should be converted. This points to the start of the first element.
@@ -71,7 +71,7 @@ namespace Fsl
     }
 
 
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to
     //! @param dstVertexCapacity the number of vertices that pDst array can hold.
     //! @param pSrc the src vertices that should be converted. This points to the start of the first element.
@@ -91,7 +91,7 @@ namespace Fsl
     }
 
 
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to
     //! @param dstVertexCapacity the number of vertices that pDst array can hold.
     //! @param pSrc the src vertices that should be converted. This points to the start of the first element.
@@ -113,7 +113,7 @@ namespace Fsl
     }
 
 
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to (of the format described in dstVertexDeclaration). This points to the start of the
     //! first element.
     //! @param cbDst the number of bytes the pDst array can hold.
@@ -130,7 +130,7 @@ namespace Fsl
                                const std::size_t cbSrc, VertexDeclarationSpan srcVertexDeclaration, const std::size_t srcVertexCount,
                                const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues);
 
-    //! @brief Convert from one vertex format to another. This method exist for convenience and its performance is probably pretty bad!
+    //! @brief Convert from one vertex format to another. The conversion plan for the format pair is compiled on first use and cached.
     //! @param pDst the dst vertices that should be written to (of the format described in dstVertexDeclaration). This points to the start of the
     //! first element.
     //! @param cbDst the number of bytes the pDst array can hold.
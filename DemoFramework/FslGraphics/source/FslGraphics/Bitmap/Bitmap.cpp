@@ -32,8 +32,8 @@
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/Span/SpanUtil_Create.hpp>
-#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
@@ -172,10 +172,12 @@ namespace Fsl
       throw std::invalid_argument("The image buffer is not of the expected size for a image of that pixel format with the given stride");
     }
 
-    ResizeToFit(sizePx, pixelFormat, m_strideRequirement);
+    ResizeToFit(sizePx, pixelFormat, m_strideRequirement, 0, false);
     ReadOnlyRawBitmap srcBitmap(ReadOnlyRawBitmap::UncheckedCreate(contentSpan, sizePx, pixelFormat, stride, m_origin));
-    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin));
+    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, m_origin));
     RawBitmapUtil::MemoryCopy(dstBitmap, srcBitmap);
+    // The pooled buffer is uninitialized and the copy only overwrites the pixels, so clear the padding
+    Clear(BitmapClearMethod::DontClear);
   }
 
 
@@ -217,9 +219,11 @@ namespace Fsl
       throw std::invalid_argument("Content can not be null");
     }
 
-    ResizeToFit(srcBitmap.GetSize(), srcBitmap.GetPixelFormat(), m_strideRequirement);
-    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin));
+    ResizeToFit(srcBitmap.GetSize(), srcBitmap.GetPixelFormat(), m_strideRequirement, 0, false);
+    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, m_origin));
     RawBitmapUtil::MemoryCopy(dstBitmap, srcBitmap);
+    // The pooled buffer is uninitialized and the copy only overwrites the pixels, so clear the padding
+    Clear(BitmapClearMethod::DontClear);
   }
 
 
@@ -260,9 +264,11 @@ namespace Fsl
       throw std::invalid_argument("Content can not be null");
     }
 
-    ResizeToFit(srcBitmap.GetSize(), srcBitmap.GetPixelFormat(), m_strideRequirement);
-    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin));
+    ResizeToFit(srcBitmap.GetSize(), srcBitmap.GetPixelFormat(), m_strideRequirement, 0, false);
+    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, m_origin));
     RawBitmapUtil::MemoryCopy(dstBitmap, srcBitmap);
+    // The pooled buffer is uninitialized and the copy only overwrites the pixels, so clear the padding
+    Clear(BitmapClearMethod::DontClear);
 
     if (srcBitmap.GetOrigin() != desiredOrigin)
     {
@@ -275,6 +281,18 @@ namespace Fsl
   Bitmap::~Bitmap()
   {
     FSLLOG3_WARNING_IF(m_isLocked, "Destroying a locked bitmap, the content being accessed will no longer be available");
+    BitmapMemoryPool::Recycle(std::move(m_content));
+  }
+
+
+  Bitmap Bitmap::CreateUninitialized(const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin bitmapOrigin,
+                                     const StrideRequirement strideRequirement)
+  {
+    Bitmap bitmap;
+    bitmap.m_origin = CheckBitmapOrigin(bitmapOrigin);
+    bitmap.ResizeToFit(sizePx, pixelFormat, strideRequirement, 0, false);
+    bitmap.Clear(BitmapClearMethod::DontClear);
+    return bitmap;
   }
 
 
@@ -299,7 +317,7 @@ namespace Fsl
     }
 
     // Get the current content array, then reset this object
-    rContentTarget = std::move(m_content);
+    rContentTarget = m_content.ReleaseAsVector();
     ResetNoThrow();
   }
 
@@ -345,7 +363,7 @@ namespace Fsl
 
     if (sizePx != m_sizePx || pixelFormat != m_pixelFormat)
     {
-      ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any);
+      ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any, 0, clearMethod == BitmapClearMethod::DontClear);
     }
     if (clearMethod != BitmapClearMethod::DontModify)
     {
@@ -371,7 +389,7 @@ namespace Fsl
     }
     if (sizePx != m_sizePx || pixelFormat != m_pixelFormat || stride != m_stride)
     {
-      ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any, stride);
+      ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any, stride, clearMethod == BitmapClearMethod::DontClear);
     }
     if (clearMethod != BitmapClearMethod::DontModify)
     {
@@ -395,7 +413,7 @@ namespace Fsl
     const PixelFormat pixelFormat = bitmapMemory.GetPixelFormat();
     const BitmapOrigin origin = bitmapMemory.GetOrigin();
     const uint32_t stride = bitmapMemory.Stride();
-    Reset(bitmapMemory.Release(), sizePx, pixelFormat, stride, origin);
+    DoReset(bitmapMemory.ReleaseBuffer(), sizePx, pixelFormat, stride, origin);
   }
 
 
@@ -428,9 +446,9 @@ namespace Fsl
       throw std::invalid_argument("The image buffer is not of the expected size for a image of that pixel format with the given stride");
     }
 
-    ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any);
+    ResizeToFit(sizePx, pixelFormat, StrideRequirement::Any, 0, false);
     ReadOnlyRawBitmap srcBitmap(ReadOnlyRawBitmap::UncheckedCreate(contentSpan, sizePx, pixelFormat, stride, bitmapOrigin));
-    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, bitmapOrigin));
+    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, bitmapOrigin));
     RawBitmapUtil::MemoryCopy(dstBitmap, srcBitmap);
     m_origin = dstBitmap.GetOrigin();
   }
@@ -470,10 +488,12 @@ namespace Fsl
       throw std::invalid_argument("invalid srcBitmap");
     }
 
-    Reset(srcBitmap.GetSize(), srcBitmap.GetPixelFormat());
-    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, srcBitmap.GetOrigin()));
+    // The copy overwrites all pixels so only the padding needs to be cleared
+    Reset(srcBitmap.GetSize(), srcBitmap.GetPixelFormat(), BitmapOrigin::UpperLeft, BitmapClearMethod::DontModify);
+    RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, srcBitmap.GetOrigin()));
     RawBitmapUtil::MemoryCopy(dstBitmap, srcBitmap);
     m_origin = dstBitmap.GetOrigin();
+    Clear(BitmapClearMethod::DontClear);
   }
 
 
@@ -492,32 +512,7 @@ namespace Fsl
   void Bitmap::Reset(std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const uint32_t stride,
                      const BitmapOrigin bitmapOrigin)
   {
-    if (m_isLocked)
-    {
-      throw UsageErrorException("The bitmap is locked");
-    }
-
-    const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(pixelFormat);
-    const uint32_t minStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), bytesPerPixel);
-    if (stride < minStride)
-    {
-      throw std::invalid_argument("stride is smaller than the width allows");
-    }
-
-    const std::size_t extentHeight = sizePx.RawUnsignedHeight();
-    const std::size_t totalByteSize = (extentHeight * stride);
-    if (content.size() != totalByteSize)
-    {
-      throw std::invalid_argument("the content buffer size is does not match the described content");
-    }
-
-    m_content = std::move(content);
-    m_sizePx = sizePx;
-    m_stride = stride;
-    m_bytesPerPixel = bytesPerPixel;
-    m_pixelFormat = pixelFormat;
-    m_strideRequirement = StrideRequirement::Any;
-    m_origin = CheckBitmapOrigin(bitmapOrigin);
+    DoReset(BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, stride, bitmapOrigin);
   }
 
 
@@ -681,7 +676,7 @@ namespace Fsl
         throw UsageErrorException("The bitmap is already locked");
       }
       m_isLocked = true;
-      return ReadOnlyRawBitmap::UncheckedCreate(SpanUtil::AsReadOnlySpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin);
+      return ReadOnlyRawBitmap::UncheckedCreate(m_content.AsReadOnlySpan(), m_sizePx, m_pixelFormat, m_stride, m_origin);
     }
     catch (const std::exception&)
     {
@@ -700,7 +695,7 @@ namespace Fsl
         throw UsageErrorException("The bitmap is already locked");
       }
       m_isLocked = true;
-      return RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin);
+      return RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, m_origin);
     }
     catch (const std::exception&)
     {
@@ -739,7 +734,8 @@ namespace Fsl
   }
 
 
-  void Bitmap::ResizeToFit(const PxSize2D sizePx, const PixelFormat pixelFormat, const StrideRequirement strideRequirement, const uint32_t stride)
+  void Bitmap::ResizeToFit(const PxSize2D sizePx, const PixelFormat pixelFormat, const StrideRequirement strideRequirement, const uint32_t stride,
+                           const bool zeroFill)
   {
     const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(pixelFormat);
     const uint32_t minStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), bytesPerPixel, strideRequirement);
@@ -763,7 +759,16 @@ namespace Fsl
     const std::size_t totalByteSize = sizePx.RawUnsignedHeight() * cbChosenStride;
     if (m_content.size() != totalByteSize)
     {
-      m_content.resize(totalByteSize);
+      if (m_content.empty())
+      {
+        // No content to preserve, so grab a pooled buffer
+        BitmapMemoryPool::Recycle(std::move(m_content));
+        m_content = zeroFill ? BitmapMemoryPool::AcquireZeroed(totalByteSize) : BitmapMemoryPool::AcquireUninitialized(totalByteSize);
+      }
+      else
+      {
+        m_content.resize(totalByteSize);
+      }
     }
 
     // Update the members
@@ -785,7 +790,7 @@ namespace Fsl
     case BitmapClearMethod::DontClear:
       if (PixelFormatUtil::CalcMinimumStride(m_sizePx.Width(), m_pixelFormat) != m_stride)
       {
-        RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), m_sizePx, m_pixelFormat, m_stride, m_origin));
+        RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(m_content.AsSpan(), m_sizePx, m_pixelFormat, m_stride, m_origin));
         RawBitmapUtil::ClearPadding(dstBitmap);
       }
       break;
@@ -797,9 +802,43 @@ namespace Fsl
   }
 
 
+  void Bitmap::DoReset(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const uint32_t stride,
+                       const BitmapOrigin bitmapOrigin)
+  {
+    if (m_isLocked)
+    {
+      throw UsageErrorException("The bitmap is locked");
+    }
+
+    const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(pixelFormat);
+    const uint32_t minStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), bytesPerPixel);
+    if (stride < minStride)
+    {
+      throw std::invalid_argument("stride is smaller than the width allows");
+    }
+
+    const std::size_t extentHeight = sizePx.RawUnsignedHeight();
+    const std::size_t totalByteSize = (extentHeight * stride);
+    if (content.size() != totalByteSize)
+    {
+      throw std::invalid_argument("the content buffer size is does not match the described content");
+    }
+
+    BitmapMemoryPool::Recycle(std::move(m_content));
+    m_content = std::move(content);
+    m_sizePx = sizePx;
+    m_stride = stride;
+    m_bytesPerPixel = bytesPerPixel;
+    m_pixelFormat = pixelFormat;
+    m_strideRequirement = StrideRequirement::Any;
+    m_origin = CheckBitmapOrigin(bitmapOrigin);
+  }
+
+
   void Bitmap::ResetNoThrow() noexcept
   {
     FSLLOG3_WARNING_IF(m_isLocked, "Destroying a locked bitmap, the content being accessed will no longer be available");
+    BitmapMemoryPool::Recycle(std::move(m_content));
     m_content.clear();
     m_sizePx = {};
     m_stride = 0;
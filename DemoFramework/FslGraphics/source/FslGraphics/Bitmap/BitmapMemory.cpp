@@ -33,6 +33,7 @@
 #include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslGraphics/Bitmap/BitmapMemory.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
 #include <cassert>
 #include <utility>
@@ -77,13 +78,27 @@ namespace Fsl
   }
 
 
+  BitmapMemory::~BitmapMemory()
+  {
+    BitmapMemoryPool::Recycle(std::move(m_content));
+  }
+
+
   uint32_t BitmapMemory::GetBytesPerPixel() const noexcept
   {
     return PixelFormatUtil::GetBytesPerPixel(m_pixelFormat);
   }
 
 
-  std::vector<uint8_t> BitmapMemory::Release() noexcept
+  std::vector<uint8_t> BitmapMemory::Release()
+  {
+    auto res = m_content.ReleaseAsVector();
+    Reset();
+    return res;
+  }
+
+
+  BitmapMemoryBuffer BitmapMemory::ReleaseBuffer() noexcept
   {
     auto res = std::move(m_content);
     Reset();
@@ -99,6 +114,7 @@ namespace Fsl
 
   void BitmapMemory::Reset() noexcept
   {
+    BitmapMemoryPool::Recycle(std::move(m_content));
     m_content.clear();
     m_sizePx = {};
     m_pixelFormat = PixelFormat::Undefined;
@@ -116,7 +132,7 @@ namespace Fsl
       throw std::invalid_argument("The content is not of the expected size for a bitmap of that pixel format with the given stride");
     }
 
-    return {SpanUtil::ToVector(content), sizePx, pixelFormat, origin, minimumStride};
+    return {BitmapMemoryBuffer(SpanUtil::ToVector(content)), sizePx, pixelFormat, origin, minimumStride};
   }
 
 
@@ -133,7 +149,7 @@ namespace Fsl
       throw std::invalid_argument("The content is not of the expected size for a bitmap of that pixel format with the given stride");
     }
 
-    return {SpanUtil::ToVector(content), sizePx, pixelFormat, origin, stride};
+    return {BitmapMemoryBuffer(SpanUtil::ToVector(content)), sizePx, pixelFormat, origin, stride};
   }
 
   BitmapMemory BitmapMemory::Create(std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
@@ -145,7 +161,7 @@ namespace Fsl
       throw std::invalid_argument("The content is not of the expected size for a bitmap of that pixel format with the given stride");
     }
 
-    return {std::move(content), sizePx, pixelFormat, origin, minimumStride};
+    return {BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, origin, minimumStride};
   }
 
 
@@ -162,7 +178,7 @@ namespace Fsl
       throw std::invalid_argument("The content is not of the expected size for a bitmap of that pixel format with the given stride");
     }
 
-    return {std::move(content), sizePx, pixelFormat, origin, stride};
+    return {BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, origin, stride};
   }
 
 
@@ -170,14 +186,14 @@ namespace Fsl
                                              const BitmapOrigin origin)
   {
     const uint32_t minimumStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat);
-    return {SpanUtil::ToVector(content), sizePx, pixelFormat, origin, minimumStride};
+    return {BitmapMemoryBuffer(SpanUtil::ToVector(content)), sizePx, pixelFormat, origin, minimumStride};
   }
 
 
   BitmapMemory BitmapMemory::UncheckedCreate(const ReadOnlySpan<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat,
                                              const BitmapOrigin origin, const uint32_t stride)
   {
-    return {SpanUtil::ToVector(content), sizePx, pixelFormat, origin, stride};
+    return {BitmapMemoryBuffer(SpanUtil::ToVector(content)), sizePx, pixelFormat, origin, stride};
   }
 
 
@@ -185,18 +201,41 @@ namespace Fsl
                                              const BitmapOrigin origin)
   {
     const uint32_t minimumStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat);
-    return {std::move(content), sizePx, pixelFormat, origin, minimumStride};
+    return {BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, origin, minimumStride};
   }
 
 
   BitmapMemory BitmapMemory::UncheckedCreate(std::vector<uint8_t>&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
                                              const BitmapOrigin origin, const uint32_t stride)
+  {
+    return {BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, origin, stride};
+  }
+
+
+  BitmapMemory BitmapMemory::UncheckedCreate(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
+                                             const BitmapOrigin origin)
+  {
+    const uint32_t minimumStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat);
+    return {std::move(content), sizePx, pixelFormat, origin, minimumStride};
+  }
+
+
+  BitmapMemory BitmapMemory::UncheckedCreate(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat,
+                                             const BitmapOrigin origin, const uint32_t stride)
   {
     return {std::move(content), sizePx, pixelFormat, origin, stride};
   }
 
 
-  BitmapMemory::BitmapMemory(std::vector<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin,
+  BitmapMemory BitmapMemory::CreateUninitialized(const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
+  {
+    const uint32_t minimumStride = PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat);
+    const std::size_t byteSize = minimumStride * UncheckedNumericCast<std::size_t>(sizePx.RawHeight());
+    return {BitmapMemoryPool::AcquireUninitialized(byteSize), sizePx, pixelFormat, origin, minimumStride};
+  }
+
+
+  BitmapMemory::BitmapMemory(BitmapMemoryBuffer content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin,
                              const uint32_t stride)
     : m_content(std::move(content))
     , m_sizePx(sizePx)
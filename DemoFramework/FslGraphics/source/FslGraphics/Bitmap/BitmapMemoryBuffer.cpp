@@ -0,0 +1,159 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Bitmap/BitmapMemoryBuffer.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl
+{
+  BitmapMemoryBuffer::BitmapMemoryBuffer(const BitmapMemoryBuffer& other)
+  {
+    if (!other.empty())
+    {
+      *this = BitmapMemoryPool::AcquireUninitialized(other.size());
+      std::memcpy(data(), other.data(), other.size());
+    }
+  }
+
+
+  BitmapMemoryBuffer& BitmapMemoryBuffer::operator=(const BitmapMemoryBuffer& other)
+  {
+    if (this != &other)
+    {
+      if (capacity() >= other.size())
+      {
+        ResizeUninitialized(other.size());
+        if (!other.empty())
+        {
+          std::memcpy(data(), other.data(), other.size());
+        }
+      }
+      else
+      {
+        *this = BitmapMemoryBuffer(other);
+      }
+    }
+    return *this;
+  }
+
+
+  BitmapMemoryBuffer BitmapMemoryBuffer::AllocateUninitialized(const std::size_t byteSize, const std::size_t capacity, const std::size_t alignment)
+  {
+    if (byteSize > capacity)
+    {
+      throw std::invalid_argument("byteSize can not be larger than the capacity");
+    }
+    if ((alignment & (alignment - 1u)) != 0u)
+    {
+      throw std::invalid_argument("alignment must be a power of two");
+    }
+    BitmapMemoryBuffer buffer;
+    if (capacity > 0u)
+    {
+      // operator new does not initialize the bytes, so the allocation is not touched
+      void* const pAllocation = alignment == 0u ? ::operator new(capacity) : ::operator new(capacity, std::align_val_t{alignment});
+      buffer.m_allocation = std::unique_ptr<uint8_t[], AllocationDeleter>(static_cast<uint8_t*>(pAllocation), AllocationDeleter{alignment});
+      buffer.m_allocationSize = byteSize;
+      buffer.m_allocationCapacity = capacity;
+    }
+    return buffer;
+  }
+
+
+  void BitmapMemoryBuffer::resize(const std::size_t byteSize)
+  {
+    if (!m_allocation)
+    {
+      m_vector.resize(byteSize);
+      return;
+    }
+    const std::size_t oldSize = m_allocationSize;
+    ResizeUninitialized(byteSize);
+    if (byteSize > oldSize)
+    {
+      std::fill(m_allocation.get() + oldSize, m_allocation.get() + byteSize, static_cast<uint8_t>(0));
+    }
+  }
+
+
+  void BitmapMemoryBuffer::ResizeUninitialized(const std::size_t byteSize)
+  {
+    if (!m_allocation)
+    {
+      if (byteSize <= m_vector.capacity())
+      {
+        // The vector value initializes the bytes beyond the old size, but it does not need to allocate
+        m_vector.resize(byteSize);
+        return;
+      }
+      Reallocate(byteSize);
+      return;
+    }
+    if (byteSize > m_allocationCapacity)
+    {
+      Reallocate(byteSize);
+      return;
+    }
+    m_allocationSize = byteSize;
+  }
+
+
+  std::vector<uint8_t> BitmapMemoryBuffer::ReleaseAsVector()
+  {
+    if (!m_allocation)
+    {
+      return std::exchange(m_vector, {});
+    }
+    std::vector<uint8_t> content(m_allocation.get(), m_allocation.get() + m_allocationSize);
+    m_allocation.reset();
+    m_allocationSize = 0;
+    m_allocationCapacity = 0;
+    return content;
+  }
+
+
+  void BitmapMemoryBuffer::Reallocate(const std::size_t byteSize)
+  {
+    BitmapMemoryBuffer newBuffer = BitmapMemoryPool::AcquireUninitialized(byteSize);
+    const std::size_t oldSize = size();
+    if (oldSize > 0u)
+    {
+      std::memcpy(newBuffer.data(), data(), std::min(oldSize, byteSize));
+    }
+    // Hand the old storage back to the pool so a later acquire in its size class can reuse it
+    BitmapMemoryPool::Recycle(std::exchange(*this, std::move(newBuffer)));
+  }
+}
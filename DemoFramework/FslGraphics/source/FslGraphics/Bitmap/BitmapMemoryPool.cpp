@@ -0,0 +1,280 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    // Each power of two is split into 1 << SubClassBits size classes
+    constexpr uint32_t SubClassBits = 2;
+    constexpr uint32_t SubClasses = 1u << SubClassBits;
+    // Buffers up to 2^MaxClassExponent (+ the sub classes) can be pooled
+    constexpr uint32_t MaxClassExponent = 40;
+    constexpr std::size_t SizeClassCount = (MaxClassExponent + 1) * SubClasses;
+    constexpr std::size_t MaxPoolableByteSize = std::size_t(1) << MaxClassExponent;
+
+    constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+    struct PoolState
+    {
+      std::mutex Lock;
+      BitmapMemoryPoolConfig Config;
+      BitmapMemoryPoolStats Stats;
+      std::array<std::vector<BitmapMemoryBuffer>, SizeClassCount> Classes;
+    };
+
+    PoolState& GetState()
+    {
+      // Intentionally never destroyed so bitmaps that are destroyed during static destruction can still recycle their content
+      static PoolState* const g_pState = new PoolState();
+      return *g_pState;
+    }
+
+    bool IsPoolable(const std::size_t byteSize, const BitmapMemoryPoolConfig& config) noexcept
+    {
+      return byteSize >= std::max(config.MinPooledByteSize, SubClasses) && byteSize <= MaxPoolableByteSize && config.MaxPooledBytes > 0;
+    }
+
+    std::size_t GetSizeClassByteSize(const std::size_t sizeClassIndex) noexcept
+    {
+      const std::size_t base = std::size_t(1) << (sizeClassIndex / SubClasses);
+      return base + ((sizeClassIndex % SubClasses) * (base >> SubClassBits));
+    }
+
+    //! The smallest size class that can hold byteSize
+    std::size_t ToSizeClassIndexRoundUp(const std::size_t byteSize) noexcept
+    {
+      assert(byteSize >= SubClasses);
+      const auto exponent = static_cast<std::size_t>(std::bit_width(byteSize) - 1);
+      const std::size_t base = std::size_t(1) << exponent;
+      const std::size_t step = base >> SubClassBits;
+      // A sub class of SubClasses rolls over into the first class of the next exponent
+      return (exponent * SubClasses) + ((byteSize - base + step - 1) / step);
+    }
+
+    //! The largest size class that a buffer of the given capacity can serve
+    std::size_t ToSizeClassIndexRoundDown(const std::size_t capacity) noexcept
+    {
+      assert(capacity >= SubClasses);
+      const auto exponent = static_cast<std::size_t>(std::bit_width(capacity) - 1);
+      const std::size_t base = std::size_t(1) << exponent;
+      return (exponent * SubClasses) + ((capacity - base) / (base >> SubClassBits));
+    }
+
+    void AdviseHugePages(const uint8_t* const pBuffer, const std::size_t byteSize) noexcept
+    {
+#if defined(__linux__) && !defined(__EMSCRIPTEN__) && defined(MADV_HUGEPAGE)
+      // The buffer is allocated huge page aligned, so every whole huge page of it can be advised.
+      // A partial huge page at the end can not be backed by a huge page so it is left alone.
+      assert((reinterpret_cast<uintptr_t>(pBuffer) & uintptr_t(HugePageSize - 1)) == 0u);
+      const std::size_t adviseByteSize = byteSize & ~std::size_t(HugePageSize - 1);
+      if (adviseByteSize > 0u)
+      {
+        // This is only a hint, so failures are ignored
+        madvise(const_cast<uint8_t*>(pBuffer), adviseByteSize, MADV_HUGEPAGE);
+      }
+#else
+      FSL_PARAM_NOT_USED(pBuffer);
+      FSL_PARAM_NOT_USED(byteSize);
+#endif
+    }
+
+    BitmapMemoryBuffer DoAcquire(const std::size_t byteSize, const bool zeroFill)
+    {
+      PoolState& rState = GetState();
+      BitmapMemoryBuffer buffer;
+      std::size_t capacity = byteSize;
+      bool hugePageAdvice = false;
+      {
+        const std::lock_guard<std::mutex> lock(rState.Lock);
+        ++rState.Stats.AcquireCount;
+        if (IsPoolable(byteSize, rState.Config))
+        {
+          const std::size_t sizeClassIndex = ToSizeClassIndexRoundUp(byteSize);
+          auto& rSizeClass = rState.Classes[sizeClassIndex];
+          if (!rSizeClass.empty())
+          {
+            buffer = std::move(rSizeClass.back());
+            rSizeClass.pop_back();
+            ++rState.Stats.HitCount;
+            rState.Stats.PooledBytes -= buffer.capacity();
+            --rState.Stats.PooledBuffers;
+          }
+          else
+          {
+            capacity = GetSizeClassByteSize(sizeClassIndex);
+          }
+        }
+        if (buffer.capacity() == 0)
+        {
+          ++rState.Stats.MissCount;
+          rState.Stats.AllocatedBytes += capacity;
+          hugePageAdvice = rState.Config.HugePageAdvice && capacity >= HugePageSize;
+        }
+      }
+
+      if (buffer.capacity() == 0)
+      {
+        // The allocation is not touched, so the huge page advice is given before the first page fault
+        buffer = BitmapMemoryBuffer::AllocateUninitialized(byteSize, capacity, hugePageAdvice ? HugePageSize : 0u);
+        if (hugePageAdvice)
+        {
+          AdviseHugePages(buffer.data(), capacity);
+        }
+      }
+      else
+      {
+        buffer.ResizeUninitialized(byteSize);
+      }
+
+      if (zeroFill)
+      {
+        std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0));
+      }
+      return buffer;
+    }
+  }
+
+
+  BitmapMemoryPoolConfig BitmapMemoryPool::GetConfig() noexcept
+  {
+    PoolState& rState = GetState();
+    const std::lock_guard<std::mutex> lock(rState.Lock);
+    return rState.Config;
+  }
+
+
+  void BitmapMemoryPool::SetConfig(const BitmapMemoryPoolConfig& config)
+  {
+    {
+      PoolState& rState = GetState();
+      const std::lock_guard<std::mutex> lock(rState.Lock);
+      rState.Config = config;
+    }
+    Trim();
+  }
+
+
+  BitmapMemoryPoolStats BitmapMemoryPool::GetStats() noexcept
+  {
+    PoolState& rState = GetState();
+    const std::lock_guard<std::mutex> lock(rState.Lock);
+    return rState.Stats;
+  }
+
+
+  BitmapMemoryBuffer BitmapMemoryPool::AcquireUninitialized(const std::size_t byteSize)
+  {
+    return DoAcquire(byteSize, false);
+  }
+
+
+  BitmapMemoryBuffer BitmapMemoryPool::AcquireZeroed(const std::size_t byteSize)
+  {
+    return DoAcquire(byteSize, true);
+  }
+
+
+  void BitmapMemoryPool::Recycle(BitmapMemoryBuffer buffer) noexcept
+  {
+    // The buffer is a parameter so if it is not pooled it is freed after the lock has been released
+    const std::size_t capacity = buffer.capacity();
+    if (capacity == 0)
+    {
+      return;
+    }
+
+    PoolState& rState = GetState();
+    const std::lock_guard<std::mutex> lock(rState.Lock);
+    if (!IsPoolable(capacity, rState.Config))
+    {
+      return;
+    }
+
+    auto& rSizeClass = rState.Classes[ToSizeClassIndexRoundDown(capacity)];
+    if ((rState.Stats.PooledBytes + capacity) > rState.Config.MaxPooledBytes || rSizeClass.size() >= rState.Config.MaxBuffersPerSizeClass)
+    {
+      ++rState.Stats.DiscardCount;
+      return;
+    }
+
+    try
+    {
+      rSizeClass.push_back(std::move(buffer));
+    }
+    catch (const std::bad_alloc&)
+    {
+      ++rState.Stats.DiscardCount;
+      return;
+    }
+    ++rState.Stats.RecycleCount;
+    rState.Stats.PooledBytes += capacity;
+    ++rState.Stats.PooledBuffers;
+  }
+
+
+  void BitmapMemoryPool::Trim() noexcept
+  {
+    std::array<std::vector<BitmapMemoryBuffer>, SizeClassCount> classes;
+    {
+      PoolState& rState = GetState();
+      const std::lock_guard<std::mutex> lock(rState.Lock);
+      std::swap(classes, rState.Classes);
+      rState.Stats.PooledBytes = 0;
+      rState.Stats.PooledBuffers = 0;
+    }
+    // The buffers are freed here, outside the lock
+  }
+
+
+  std::size_t BitmapMemoryPool::GetSizeClassCapacity(const std::size_t byteSize) noexcept
+  {
+    if (byteSize < SubClasses || byteSize > MaxPoolableByteSize)
+    {
+      return byteSize;
+    }
+    return GetSizeClassByteSize(ToSizeClassIndexRoundUp(byteSize));
+  }
+}
@@ -41,7 +41,8 @@ namespace Fsl::BitmapConverterFunctions
     {
       throw UnsupportedPixelFormatException("R8G8B8ToGrayscaleLuminanceNTSC only supports R8G8B8_UNORM", srcBitmap.GetPixelFormat());
     }
-    Bitmap dstBitmap(srcBitmap.GetSize(), dstOneChannel8BitPixelFormat, srcBitmap.GetOrigin());
+    // Every pixel is written by the converter so there is no need to clear the bitmap first
+    Bitmap dstBitmap(Bitmap::CreateUninitialized(srcBitmap.GetSize(), dstOneChannel8BitPixelFormat, srcBitmap.GetOrigin()));
     {
       const Bitmap::ScopedDirectReadAccess directSrcAccess(srcBitmap);
       Bitmap::ScopedDirectReadWriteAccess directDstAccess(dstBitmap);
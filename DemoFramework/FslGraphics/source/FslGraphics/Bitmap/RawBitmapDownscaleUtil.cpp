@@ -0,0 +1,747 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslGraphics/Bitmap/RawBitmapDownscaleUtil.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOCAL_DOWNSCALE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define LOCAL_DOWNSCALE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The windowed filters have a radius of three dst pixels which is six src pixels on each side of the dst pixel center
+      constexpr uint32_t WindowedTapCount = 12;
+      //! The offset of the first tap relative to the first src pixel covered by the dst pixel
+      constexpr int32_t WindowedFirstTap = -5;
+      constexpr double WindowedRadius = 3.0;
+      constexpr double KaiserAlpha = 4.0;
+    }
+
+    enum class ChannelEncoding
+    {
+      UNorm8,
+      Srgb8,
+      Float32
+    };
+
+    struct FormatInfo
+    {
+      ChannelEncoding Encoding{ChannelEncoding::UNorm8};
+      uint32_t ChannelCount{0};
+      //! The index of the alpha channel (equal to ChannelCount if there is none)
+      uint32_t AlphaIndex{0};
+      uint32_t BytesPerPixel{0};
+
+      constexpr FormatInfo() noexcept = default;
+      constexpr FormatInfo(const ChannelEncoding encoding, const uint32_t channelCount, const uint32_t alphaIndex, const uint32_t bytesPerPixel) noexcept
+        : Encoding(encoding)
+        , ChannelCount(channelCount)
+        , AlphaIndex(alphaIndex)
+        , BytesPerPixel(bytesPerPixel)
+      {
+      }
+    };
+
+    struct SrgbTables
+    {
+      //! The linear range [0, 1) is split into this many buckets for the encode
+      static constexpr uint32_t EncodeBucketCount = 4096;
+
+      //! sRGB UInt8 to linear float
+      std::array<float, 256> ToLinear{};
+      //! The smallest linear value that encodes to the given sRGB value (entry zero is unused and the last entry is +inf)
+      std::array<float, 257> Thresholds{};
+      //! The sRGB value of the start of each bucket, the sRGB curve is flat enough that a bucket never contains more than one threshold
+      std::array<uint8_t, EncodeBucketCount> EncodeBuckets{};
+    };
+
+    struct WindowedFilter
+    {
+      std::array<float, LocalConfig::WindowedTapCount> Weights{};
+    };
+
+    std::optional<FormatInfo> TryGetFormatInfo(const PixelFormat pixelFormat) noexcept
+    {
+      if (PixelFormatUtil::IsCompressed(pixelFormat) || PixelFormatUtil::IsPacked(pixelFormat))
+      {
+        return {};
+      }
+      const uint32_t channelCount = PixelFormatUtil::GetChannelCount(pixelFormat);
+      const uint32_t bytesPerPixel = PixelFormatUtil::GetBytesPerPixel(pixelFormat);
+      if (channelCount < 1u || channelCount > 4u)
+      {
+        return {};
+      }
+      // Only packed layouts store the alpha channel first
+      const uint32_t alphaIndex = PixelFormatUtil::HasAlphaChannel(pixelFormat) ? channelCount - 1u : channelCount;
+      switch (PixelFormatUtil::GetNumericFormat(pixelFormat))
+      {
+      case PixelFormatFlags::NF_UNorm:
+        if (bytesPerPixel == channelCount)
+        {
+          return FormatInfo(ChannelEncoding::UNorm8, channelCount, alphaIndex, bytesPerPixel);
+        }
+        break;
+      case PixelFormatFlags::NF_Srgb:
+        if (bytesPerPixel == channelCount)
+        {
+          return FormatInfo(ChannelEncoding::Srgb8, channelCount, alphaIndex, bytesPerPixel);
+        }
+        break;
+      case PixelFormatFlags::NF_SFloat:
+        if (bytesPerPixel == (channelCount * 4u))
+        {
+          return FormatInfo(ChannelEncoding::Float32, channelCount, alphaIndex, bytesPerPixel);
+        }
+        break;
+      default:
+        break;
+      }
+      return {};
+    }
+
+    double SrgbToLinear(const double value) noexcept
+    {
+      return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+    }
+
+    SrgbTables CreateSrgbTables() noexcept
+    {
+      SrgbTables tables;
+      for (uint32_t i = 0; i < 256u; ++i)
+      {
+        tables.ToLinear[i] = static_cast<float>(SrgbToLinear(static_cast<double>(i) / 255.0));
+      }
+      // The encode rounds to the nearest sRGB value so the threshold is the midpoint between two sRGB values
+      for (uint32_t i = 1; i < 256u; ++i)
+      {
+        tables.Thresholds[i] = static_cast<float>(SrgbToLinear((static_cast<double>(i) - 0.5) / 255.0));
+      }
+      tables.Thresholds[256] = std::numeric_limits<float>::infinity();
+
+      uint32_t encoded = 0;
+      for (uint32_t bucket = 0; bucket < SrgbTables::EncodeBucketCount; ++bucket)
+      {
+        const float bucketStart = static_cast<float>(bucket) / static_cast<float>(SrgbTables::EncodeBucketCount);
+        while (bucketStart >= tables.Thresholds[encoded + 1u])
+        {
+          ++encoded;
+        }
+        tables.EncodeBuckets[bucket] = static_cast<uint8_t>(encoded);
+        assert(encoded >= 255u ||
+               (static_cast<float>(bucket + 1u) / static_cast<float>(SrgbTables::EncodeBucketCount)) <= tables.Thresholds[encoded + 2u]);
+      }
+      return tables;
+    }
+
+    const SrgbTables& GetSrgbTables() noexcept
+    {
+      static const SrgbTables g_tables = CreateSrgbTables();
+      return g_tables;
+    }
+
+    double Sinc(const double value) noexcept
+    {
+      const double x = value * std::numbers::pi;
+      return x != 0.0 ? std::sin(x) / x : 1.0;
+    }
+
+    //! Zero order modified Bessel function of the first kind
+    double BesselI0(const double value) noexcept
+    {
+      const double halfValue = value * 0.5;
+      double sum = 1.0;
+      double term = 1.0;
+      for (uint32_t k = 1; k < 32u; ++k)
+      {
+        term *= halfValue / static_cast<double>(k);
+        sum += term * term;
+      }
+      return sum;
+    }
+
+    WindowedFilter CreateWindowedFilter(const TextureMipMapFilter filter) noexcept
+    {
+      assert(filter == TextureMipMapFilter::Kaiser || filter == TextureMipMapFilter::Lanczos);
+      std::array<double, LocalConfig::WindowedTapCount> weights{};
+      double sum = 0.0;
+      for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+      {
+        // The distance from the src pixel center to the dst pixel center measured in dst pixels
+        const double distance = (static_cast<double>(LocalConfig::WindowedFirstTap + static_cast<int32_t>(i)) - 0.5) / 2.0;
+        double window = 0.0;
+        if (filter == TextureMipMapFilter::Lanczos)
+        {
+          window = Sinc(distance / LocalConfig::WindowedRadius);
+        }
+        else
+        {
+          const double relative = distance / LocalConfig::WindowedRadius;
+          window = BesselI0(LocalConfig::KaiserAlpha * std::sqrt(std::max(1.0 - (relative * relative), 0.0))) / BesselI0(LocalConfig::KaiserAlpha);
+        }
+        weights[i] = Sinc(distance) * window;
+        sum += weights[i];
+      }
+      WindowedFilter result;
+      for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+      {
+        result.Weights[i] = static_cast<float>(weights[i] / sum);
+      }
+      return result;
+    }
+
+    const WindowedFilter& GetWindowedFilter(const TextureMipMapFilter filter) noexcept
+    {
+      static const WindowedFilter g_kaiser = CreateWindowedFilter(TextureMipMapFilter::Kaiser);
+      static const WindowedFilter g_lanczos = CreateWindowedFilter(TextureMipMapFilter::Lanczos);
+      return filter == TextureMipMapFilter::Kaiser ? g_kaiser : g_lanczos;
+    }
+
+    inline uint8_t EncodeUNorm8(const float value) noexcept
+    {
+      // Written so NaN becomes zero
+      const float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+      return static_cast<uint8_t>((clamped * 255.0f) + 0.5f);
+    }
+
+    inline uint8_t EncodeSrgb8(const float valueLinear, const SrgbTables& tables) noexcept
+    {
+      // Written so NaN and negative values becomes zero
+      if (!(valueLinear > 0.0f))
+      {
+        return 0u;
+      }
+      if (valueLinear >= 1.0f)
+      {
+        return 255u;
+      }
+      const uint32_t encoded = tables.EncodeBuckets[static_cast<uint32_t>(valueLinear * static_cast<float>(SrgbTables::EncodeBucketCount))];
+      return static_cast<uint8_t>(encoded + (valueLinear >= tables.Thresholds[encoded + 1u] ? 1u : 0u));
+    }
+
+    inline uint32_t CalcDownscaledSize(const uint32_t size) noexcept
+    {
+      return size > 1u ? size / 2u : size;
+    }
+
+    inline const uint8_t* GetRow(const ReadOnlyRawBitmap& bitmap, const uint32_t y) noexcept
+    {
+      assert(y < bitmap.RawUnsignedHeight());
+      return static_cast<const uint8_t*>(bitmap.Content()) + (static_cast<std::size_t>(y) * bitmap.Stride());
+    }
+
+    inline uint8_t* GetRow(RawBitmapEx& rBitmap, const uint32_t y) noexcept
+    {
+      assert(y < rBitmap.RawUnsignedHeight());
+      return static_cast<uint8_t*>(rBitmap.Content()) + (static_cast<std::size_t>(y) * rBitmap.Stride());
+    }
+
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+    // Nearest
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+
+    void DownscaleNearestRow(uint8_t* pDst, const uint8_t* pSrc, const uint32_t dstWidth, const uint32_t bytesPerPixel) noexcept
+    {
+      switch (bytesPerPixel)
+      {
+      case 4:
+        for (uint32_t x = 0; x < dstWidth; ++x)
+        {
+          std::memcpy(pDst + (x * 4u), pSrc + (x * 8u), 4u);
+        }
+        break;
+      default:
+        for (uint32_t x = 0; x < dstWidth; ++x)
+        {
+          std::memcpy(pDst + (x * bytesPerPixel), pSrc + (x * 2u * bytesPerPixel), bytesPerPixel);
+        }
+        break;
+      }
+    }
+
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+    // Box
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+
+    //! Calculate the number of dst pixels where both src pixels are inside the src row
+    inline uint32_t CalcUnclampedBoxWidth(const uint32_t dstWidth, const uint32_t srcWidth) noexcept
+    {
+      return std::min(dstWidth, srcWidth / 2u);
+    }
+
+    //! The 8bit average is truncated to match the original RawBitmapUtil::DownscaleBoxFilter
+    void DownscaleBoxUNorm8Row(uint8_t* pDst, const uint8_t* pSrc0, const uint8_t* pSrc1, const uint32_t dstWidth, const uint32_t srcWidth,
+                               const uint32_t channelCount) noexcept
+    {
+      uint32_t x = 0;
+      if (channelCount == 4u)
+      {
+        const uint32_t simdWidth = CalcUnclampedBoxWidth(dstWidth, srcWidth);
+#if defined(LOCAL_DOWNSCALE_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; (x + 4u) <= simdWidth; x += 4u)
+        {
+          const __m128i src00 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + (x * 8u)));
+          const __m128i src01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + (x * 8u) + 16u));
+          const __m128i src10 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + (x * 8u)));
+          const __m128i src11 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + (x * 8u) + 16u));
+          // Vertical sums of src pixel 0,1 and 2,3 (and 4,5 + 6,7)
+          const __m128i low0 = _mm_add_epi16(_mm_unpacklo_epi8(src00, zero), _mm_unpacklo_epi8(src10, zero));
+          const __m128i high0 = _mm_add_epi16(_mm_unpackhi_epi8(src00, zero), _mm_unpackhi_epi8(src10, zero));
+          const __m128i low1 = _mm_add_epi16(_mm_unpacklo_epi8(src01, zero), _mm_unpacklo_epi8(src11, zero));
+          const __m128i high1 = _mm_add_epi16(_mm_unpackhi_epi8(src01, zero), _mm_unpackhi_epi8(src11, zero));
+          // Horizontal sums of the even and odd pixels
+          const __m128i sum0 = _mm_add_epi16(_mm_unpacklo_epi64(low0, high0), _mm_unpackhi_epi64(low0, high0));
+          const __m128i sum1 = _mm_add_epi16(_mm_unpacklo_epi64(low1, high1), _mm_unpackhi_epi64(low1, high1));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + (x * 4u)), _mm_packus_epi16(_mm_srli_epi16(sum0, 2), _mm_srli_epi16(sum1, 2)));
+        }
+#elif defined(LOCAL_DOWNSCALE_NEON)
+        for (; (x + 8u) <= simdWidth; x += 8u)
+        {
+          // De-interleave the channels so the pairwise add sums the two adjacent pixels
+          const uint8x16x4_t src0 = vld4q_u8(pSrc0 + (x * 8u));
+          const uint8x16x4_t src1 = vld4q_u8(pSrc1 + (x * 8u));
+          uint8x8x4_t result;
+          result.val[0] = vshrn_n_u16(vpadalq_u8(vpaddlq_u8(src0.val[0]), src1.val[0]), 2);
+          result.val[1] = vshrn_n_u16(vpadalq_u8(vpaddlq_u8(src0.val[1]), src1.val[1]), 2);
+          result.val[2] = vshrn_n_u16(vpadalq_u8(vpaddlq_u8(src0.val[2]), src1.val[2]), 2);
+          result.val[3] = vshrn_n_u16(vpadalq_u8(vpaddlq_u8(src0.val[3]), src1.val[3]), 2);
+          vst4_u8(pDst + (x * 4u), result);
+        }
+#endif
+      }
+      for (; x < dstWidth; ++x)
+      {
+        const uint32_t srcOffset0 = (x * 2u) * channelCount;
+        const uint32_t srcOffset1 = std::min((x * 2u) + 1u, srcWidth - 1u) * channelCount;
+        for (uint32_t channel = 0; channel < channelCount; ++channel)
+        {
+          const uint32_t sum = static_cast<uint32_t>(pSrc0[srcOffset0 + channel]) + pSrc0[srcOffset1 + channel] + pSrc1[srcOffset0 + channel] +
+                               pSrc1[srcOffset1 + channel];
+          pDst[(x * channelCount) + channel] = static_cast<uint8_t>(sum >> 2);
+        }
+      }
+    }
+
+    void DownscaleBoxSrgb8Row(uint8_t* pDst, const uint8_t* pSrc0, const uint8_t* pSrc1, const uint32_t dstWidth, const uint32_t srcWidth,
+                              const FormatInfo& format, const SrgbTables& tables) noexcept
+    {
+      const uint32_t channelCount = format.ChannelCount;
+      for (uint32_t x = 0; x < dstWidth; ++x)
+      {
+        const uint32_t srcOffset0 = (x * 2u) * channelCount;
+        const uint32_t srcOffset1 = std::min((x * 2u) + 1u, srcWidth - 1u) * channelCount;
+        for (uint32_t channel = 0; channel < channelCount; ++channel)
+        {
+          const uint8_t value00 = pSrc0[srcOffset0 + channel];
+          const uint8_t value10 = pSrc0[srcOffset1 + channel];
+          const uint8_t value01 = pSrc1[srcOffset0 + channel];
+          const uint8_t value11 = pSrc1[srcOffset1 + channel];
+          if (channel != format.AlphaIndex)
+          {
+            const float sum = (tables.ToLinear[value00] + tables.ToLinear[value10]) + (tables.ToLinear[value01] + tables.ToLinear[value11]);
+            pDst[(x * channelCount) + channel] = EncodeSrgb8(sum * 0.25f, tables);
+          }
+          else
+          {
+            pDst[(x * channelCount) + channel] = static_cast<uint8_t>((static_cast<uint32_t>(value00) + value10 + value01 + value11) >> 2);
+          }
+        }
+      }
+    }
+
+    void DownscaleBoxFloat32Row(float* pDst, const float* pSrc0, const float* pSrc1, const uint32_t dstWidth, const uint32_t srcWidth,
+                                const uint32_t channelCount) noexcept
+    {
+      uint32_t x = 0;
+      if (channelCount == 4u)
+      {
+        const uint32_t simdWidth = CalcUnclampedBoxWidth(dstWidth, srcWidth);
+#if defined(LOCAL_DOWNSCALE_SSE2)
+        const __m128 quarter = _mm_set1_ps(0.25f);
+        for (; x < simdWidth; ++x)
+        {
+          const __m128 sum0 = _mm_add_ps(_mm_loadu_ps(pSrc0 + (x * 8u)), _mm_loadu_ps(pSrc0 + (x * 8u) + 4u));
+          const __m128 sum1 = _mm_add_ps(_mm_loadu_ps(pSrc1 + (x * 8u)), _mm_loadu_ps(pSrc1 + (x * 8u) + 4u));
+          _mm_storeu_ps(pDst + (x * 4u), _mm_mul_ps(_mm_add_ps(sum0, sum1), quarter));
+        }
+#elif defined(LOCAL_DOWNSCALE_NEON)
+        for (; x < simdWidth; ++x)
+        {
+          const float32x4_t sum0 = vaddq_f32(vld1q_f32(pSrc0 + (x * 8u)), vld1q_f32(pSrc0 + (x * 8u) + 4u));
+          const float32x4_t sum1 = vaddq_f32(vld1q_f32(pSrc1 + (x * 8u)), vld1q_f32(pSrc1 + (x * 8u) + 4u));
+          vst1q_f32(pDst + (x * 4u), vmulq_n_f32(vaddq_f32(sum0, sum1), 0.25f));
+        }
+#endif
+      }
+      // The scalar code uses the same order of operations as the SIMD code so the result is identical
+      for (; x < dstWidth; ++x)
+      {
+        const uint32_t srcOffset0 = (x * 2u) * channelCount;
+        const uint32_t srcOffset1 = std::min((x * 2u) + 1u, srcWidth - 1u) * channelCount;
+        for (uint32_t channel = 0; channel < channelCount; ++channel)
+        {
+          const float sum0 = pSrc0[srcOffset0 + channel] + pSrc0[srcOffset1 + channel];
+          const float sum1 = pSrc1[srcOffset0 + channel] + pSrc1[srcOffset1 + channel];
+          pDst[(x * channelCount) + channel] = (sum0 + sum1) * 0.25f;
+        }
+      }
+    }
+
+    void DownscaleBox(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const FormatInfo& format, const uint32_t dstRowStart,
+                      const uint32_t dstRowCount)
+    {
+      const uint32_t dstWidth = rDstBitmap.RawUnsignedWidth();
+      const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
+      const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
+      const SrgbTables& srgbTables = GetSrgbTables();
+      for (uint32_t y = dstRowStart; y < (dstRowStart + dstRowCount); ++y)
+      {
+        uint8_t* pDst = GetRow(rDstBitmap, y);
+        const uint8_t* pSrc0 = GetRow(srcBitmap, y * 2u);
+        const uint8_t* pSrc1 = GetRow(srcBitmap, std::min((y * 2u) + 1u, srcHeight - 1u));
+        switch (format.Encoding)
+        {
+        case ChannelEncoding::UNorm8:
+          DownscaleBoxUNorm8Row(pDst, pSrc0, pSrc1, dstWidth, srcWidth, format.ChannelCount);
+          break;
+        case ChannelEncoding::Srgb8:
+          DownscaleBoxSrgb8Row(pDst, pSrc0, pSrc1, dstWidth, srcWidth, format, srgbTables);
+          break;
+        case ChannelEncoding::Float32:
+          // The bitmap rows are expected to be float aligned
+          DownscaleBoxFloat32Row(reinterpret_cast<float*>(pDst), reinterpret_cast<const float*>(pSrc0), reinterpret_cast<const float*>(pSrc1), dstWidth,
+                                 srcWidth, format.ChannelCount);
+          break;
+        }
+      }
+    }
+
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+    // Windowed
+    // ---------------------------------------------------------------------------------------------------------------------------------------------
+
+    void DecodeRow(float* pDst, const uint8_t* pSrc, const uint32_t width, const FormatInfo& format, const SrgbTables& tables) noexcept
+    {
+      const uint32_t count = width * format.ChannelCount;
+      switch (format.Encoding)
+      {
+      case ChannelEncoding::UNorm8:
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          pDst[i] = static_cast<float>(pSrc[i]) * (1.0f / 255.0f);
+        }
+        break;
+      case ChannelEncoding::Srgb8:
+        for (uint32_t i = 0; i < count; i += format.ChannelCount)
+        {
+          for (uint32_t channel = 0; channel < format.ChannelCount; ++channel)
+          {
+            const uint8_t value = pSrc[i + channel];
+            pDst[i + channel] = channel != format.AlphaIndex ? tables.ToLinear[value] : static_cast<float>(value) * (1.0f / 255.0f);
+          }
+        }
+        break;
+      case ChannelEncoding::Float32:
+        std::memcpy(pDst, pSrc, count * sizeof(float));
+        break;
+      }
+    }
+
+    void EncodeRow(uint8_t* pDst, const float* pSrc, const uint32_t width, const FormatInfo& format, const SrgbTables& tables) noexcept
+    {
+      const uint32_t count = width * format.ChannelCount;
+      switch (format.Encoding)
+      {
+      case ChannelEncoding::UNorm8:
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          pDst[i] = EncodeUNorm8(pSrc[i]);
+        }
+        break;
+      case ChannelEncoding::Srgb8:
+        for (uint32_t i = 0; i < count; i += format.ChannelCount)
+        {
+          for (uint32_t channel = 0; channel < format.ChannelCount; ++channel)
+          {
+            const float value = pSrc[i + channel];
+            pDst[i + channel] = channel != format.AlphaIndex ? EncodeSrgb8(value, tables) : EncodeUNorm8(value);
+          }
+        }
+        break;
+      case ChannelEncoding::Float32:
+        std::memcpy(pDst, pSrc, count * sizeof(float));
+        break;
+      }
+    }
+
+    //! Apply the filter horizontally to a decoded src row
+    void FilterRowHorizontal(float* pDst, const float* pSrc, const uint32_t dstWidth, const uint32_t srcWidth, const uint32_t channelCount,
+                             const WindowedFilter& filter) noexcept
+    {
+      const auto lastSrcX = static_cast<int32_t>(srcWidth) - 1;
+      for (uint32_t x = 0; x < dstWidth; ++x)
+      {
+        const int32_t firstSrcX = (static_cast<int32_t>(x) * 2) + LocalConfig::WindowedFirstTap;
+        float* pDstPixel = pDst + (x * channelCount);
+#if defined(LOCAL_DOWNSCALE_SSE2) || defined(LOCAL_DOWNSCALE_NEON)
+        const bool isInside = firstSrcX >= 0 && (firstSrcX + static_cast<int32_t>(LocalConfig::WindowedTapCount)) <= static_cast<int32_t>(srcWidth);
+        if (isInside && channelCount == 4u)
+        {
+          const float* pSrcPixel = pSrc + (static_cast<uint32_t>(firstSrcX) * 4u);
+#if defined(LOCAL_DOWNSCALE_SSE2)
+          __m128 sum = _mm_setzero_ps();
+          for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+          {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(filter.Weights[i]), _mm_loadu_ps(pSrcPixel + (i * 4u))));
+          }
+          _mm_storeu_ps(pDstPixel, sum);
+          continue;
+#elif defined(LOCAL_DOWNSCALE_NEON)
+          float32x4_t sum = vdupq_n_f32(0.0f);
+          for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+          {
+            sum = vmlaq_n_f32(sum, vld1q_f32(pSrcPixel + (i * 4u)), filter.Weights[i]);
+          }
+          vst1q_f32(pDstPixel, sum);
+          continue;
+#endif
+        }
+#endif
+        for (uint32_t channel = 0; channel < channelCount; ++channel)
+        {
+          float sum = 0.0f;
+          for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+          {
+            const int32_t srcX = std::clamp(firstSrcX + static_cast<int32_t>(i), 0, lastSrcX);
+            sum += filter.Weights[i] * pSrc[(static_cast<uint32_t>(srcX) * channelCount) + channel];
+          }
+          pDstPixel[channel] = sum;
+        }
+      }
+    }
+
+    //! Apply the filter vertically to the horizontally filtered rows
+    void FilterRowVertical(float* pDst, const std::array<const float*, LocalConfig::WindowedTapCount>& rows, const uint32_t count,
+                           const WindowedFilter& filter) noexcept
+    {
+      uint32_t index = 0;
+#if defined(LOCAL_DOWNSCALE_SSE2)
+      for (; (index + 4u) <= count; index += 4u)
+      {
+        __m128 sum = _mm_setzero_ps();
+        for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+        {
+          sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(filter.Weights[i]), _mm_loadu_ps(rows[i] + index)));
+        }
+        _mm_storeu_ps(pDst + index, sum);
+      }
+#elif defined(LOCAL_DOWNSCALE_NEON)
+      for (; (index + 4u) <= count; index += 4u)
+      {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+        {
+          sum = vmlaq_n_f32(sum, vld1q_f32(rows[i] + index), filter.Weights[i]);
+        }
+        vst1q_f32(pDst + index, sum);
+      }
+#endif
+      for (; index < count; ++index)
+      {
+        float sum = 0.0f;
+        for (uint32_t i = 0; i < LocalConfig::WindowedTapCount; ++i)
+        {
+          sum += filter.Weights[i] * rows[i][index];
+        }
+        pDst[index] = sum;
+      }
+    }
+
+    void DownscaleWindowed(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const FormatInfo& format, const WindowedFilter& filter,
+                           const uint32_t dstRowStart, const uint32_t dstRowCount)
+    {
+      constexpr auto TapCount = static_cast<int32_t>(LocalConfig::WindowedTapCount);
+      const uint32_t dstWidth = rDstBitmap.RawUnsignedWidth();
+      const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
+      const auto lastSrcY = static_cast<int32_t>(srcBitmap.RawUnsignedHeight()) - 1;
+      const uint32_t srcRowFloats = srcWidth * format.ChannelCount;
+      const uint32_t dstRowFloats = dstWidth * format.ChannelCount;
+      const SrgbTables& srgbTables = GetSrgbTables();
+
+      // The horizontally filtered rows are kept in a ring buffer, so every src row is only decoded and filtered once per band.
+      std::vector<float> buffer(srcRowFloats + ((LocalConfig::WindowedTapCount + 1u) * static_cast<std::size_t>(dstRowFloats)));
+      float* const pDecodedRow = buffer.data();
+      float* const pRingStart = pDecodedRow + srcRowFloats;
+      float* const pFilteredRow = pRingStart + (LocalConfig::WindowedTapCount * static_cast<std::size_t>(dstRowFloats));
+      std::array<int32_t, LocalConfig::WindowedTapCount> ringRowIndex{};
+      ringRowIndex.fill(std::numeric_limits<int32_t>::min());
+
+      std::array<const float*, LocalConfig::WindowedTapCount> rows{};
+      for (uint32_t y = dstRowStart; y < (dstRowStart + dstRowCount); ++y)
+      {
+        const int32_t firstSrcY = (static_cast<int32_t>(y) * 2) + LocalConfig::WindowedFirstTap;
+        for (int32_t i = 0; i < TapCount; ++i)
+        {
+          // The ring is indexed by the unclamped row so the clamped edge rows are just filtered again
+          const int32_t srcY = firstSrcY + i;
+          const auto slot = static_cast<uint32_t>(((srcY % TapCount) + TapCount) % TapCount);
+          float* pRingRow = pRingStart + (slot * static_cast<std::size_t>(dstRowFloats));
+          if (ringRowIndex[slot] != srcY)
+          {
+            DecodeRow(pDecodedRow, GetRow(srcBitmap, static_cast<uint32_t>(std::clamp(srcY, 0, lastSrcY))), srcWidth, format, srgbTables);
+            FilterRowHorizontal(pRingRow, pDecodedRow, dstWidth, srcWidth, format.ChannelCount, filter);
+            ringRowIndex[slot] = srcY;
+          }
+          rows[static_cast<uint32_t>(i)] = pRingRow;
+        }
+        FilterRowVertical(pFilteredRow, rows, dstRowFloats, filter);
+        EncodeRow(GetRow(rDstBitmap, y), pFilteredRow, dstWidth, format, srgbTables);
+      }
+    }
+
+    FormatInfo Validate(const RawBitmapEx& dstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter)
+    {
+      if (!dstBitmap.IsValid() || !srcBitmap.IsValid())
+      {
+        throw std::invalid_argument("Downscale requires valid bitmaps");
+      }
+      if (dstBitmap.GetOrigin() != srcBitmap.GetOrigin() || dstBitmap.GetPixelFormat() != srcBitmap.GetPixelFormat())
+      {
+        throw std::invalid_argument("Downscale requires that the origin and pixel format matches");
+      }
+      if (dstBitmap.RawUnsignedWidth() != CalcDownscaledSize(srcBitmap.RawUnsignedWidth()) ||
+          dstBitmap.RawUnsignedHeight() != CalcDownscaledSize(srcBitmap.RawUnsignedHeight()))
+      {
+        throw std::invalid_argument("Downscale requires that dst width, height is half the size of the src");
+      }
+      const std::optional<FormatInfo> format = TryGetFormatInfo(srcBitmap.GetPixelFormat());
+      if (!format.has_value())
+      {
+        throw NotSupportedException("Downscale unsupported pixel format");
+      }
+      if (format->Encoding == ChannelEncoding::Float32 &&
+          (((reinterpret_cast<uintptr_t>(dstBitmap.Content()) | reinterpret_cast<uintptr_t>(srcBitmap.Content())) % sizeof(float)) != 0u ||
+           ((dstBitmap.Stride() | srcBitmap.Stride()) % sizeof(float)) != 0u))
+      {
+        throw NotSupportedException("Downscale requires float formats to be float aligned");
+      }
+      switch (filter)
+      {
+      case TextureMipMapFilter::Nearest:
+      case TextureMipMapFilter::Box:
+      case TextureMipMapFilter::Kaiser:
+      case TextureMipMapFilter::Lanczos:
+        break;
+      default:
+        throw NotSupportedException("Unsupported filter");
+      }
+      return format.value();
+    }
+  }
+
+
+  namespace RawBitmapDownscaleUtil
+  {
+    bool IsSupported(const PixelFormat pixelFormat, const TextureMipMapFilter filter) noexcept
+    {
+      switch (filter)
+      {
+      case TextureMipMapFilter::Nearest:
+      case TextureMipMapFilter::Box:
+      case TextureMipMapFilter::Kaiser:
+      case TextureMipMapFilter::Lanczos:
+        return TryGetFormatInfo(pixelFormat).has_value();
+      default:
+        return false;
+      }
+    }
+
+
+    void Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter)
+    {
+      Downscale(rDstBitmap, srcBitmap, filter, 0u, rDstBitmap.RawUnsignedHeight());
+    }
+
+
+    void Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter, const uint32_t dstRowStart,
+                   const uint32_t dstRowCount)
+    {
+      const FormatInfo format = Validate(rDstBitmap, srcBitmap, filter);
+      if (dstRowStart > rDstBitmap.RawUnsignedHeight() || dstRowCount > (rDstBitmap.RawUnsignedHeight() - dstRowStart))
+      {
+        throw std::invalid_argument("Downscale row range is outside the dst bitmap");
+      }
+      if (rDstBitmap.RawUnsignedWidth() == 0u || dstRowCount == 0u)
+      {
+        return;
+      }
+
+      switch (filter)
+      {
+      case TextureMipMapFilter::Nearest:
+        for (uint32_t y = dstRowStart; y < (dstRowStart + dstRowCount); ++y)
+        {
+          DownscaleNearestRow(GetRow(rDstBitmap, y), GetRow(srcBitmap, y * 2u), rDstBitmap.RawUnsignedWidth(), format.BytesPerPixel);
+        }
+        break;
+      case TextureMipMapFilter::Box:
+        DownscaleBox(rDstBitmap, srcBitmap, format, dstRowStart, dstRowCount);
+        break;
+      case TextureMipMapFilter::Kaiser:
+      case TextureMipMapFilter::Lanczos:
+        DownscaleWindowed(rDstBitmap, srcBitmap, format, GetWindowedFilter(filter), dstRowStart, dstRowCount);
+        break;
+      }
+    }
+  }
+}
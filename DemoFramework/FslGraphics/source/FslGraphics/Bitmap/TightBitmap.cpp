@@ -31,9 +31,9 @@
 
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/NumericCast.hpp>
-#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/Bitmap/RawBitmapEx.hpp>
 #include <FslGraphics/Bitmap/TightBitmap.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
@@ -56,7 +56,7 @@ namespace Fsl
 
       {    // Pack tightly
         const std::size_t minimumSize = minimumStride * rawBitmap.RawUnsignedHeight();
-        std::vector<uint8_t> tightlyPackedBitmap(minimumSize);
+        BitmapMemoryBuffer tightlyPackedBitmap(BitmapMemoryPool::AcquireUninitialized(minimumSize));
 
         const auto* pSrc = static_cast<const uint8_t*>(rawBitmap.Content());
         const uint8_t* const pSrcEnd = pSrc + rawBitmap.GetByteSize();
@@ -73,7 +73,7 @@ namespace Fsl
           pSrc += srcStride;
           pDst += minimumStride;
         }
-        return {std::move(tightlyPackedBitmap), rawBitmap.GetExtent(), rawBitmap.GetPixelFormat(), rawBitmap.GetOrigin()};
+        return {std::move(tightlyPackedBitmap), rawBitmap.GetSize(), rawBitmap.GetPixelFormat(), rawBitmap.GetOrigin()};
       }
     }
 
@@ -88,11 +88,11 @@ namespace Fsl
       // Check if the source is tightly packed
       if (minimumStride == stride)
       {
-        return {bitmapMemory.Release(), sizePx, pixelFormat, origin};
+        return {bitmapMemory.ReleaseBuffer(), sizePx, pixelFormat, origin};
       }
       {    // Pack tightly 'in-place'
         assert(stride > minimumStride);
-        std::vector<uint8_t> bitmapContent = bitmapMemory.Release();
+        BitmapMemoryBuffer bitmapContent = bitmapMemory.ReleaseBuffer();
         // The released bitmap content should be able to contain its bitmap
         assert(bitmapContent.size() == (stride * sizePx.RawUnsignedHeight()));
 
@@ -111,8 +111,8 @@ namespace Fsl
           pDst += minimumStride;
         }
 
-        // Resize the vector so it only fits the tightly packed bitmap size
-        bitmapContent.resize(minimumStride * sizePx.RawUnsignedHeight());
+        // Shrink the buffer so it only fits the tightly packed bitmap size
+        bitmapContent.ResizeUninitialized(minimumStride * sizePx.RawUnsignedHeight());
         return {std::move(bitmapContent), sizePx, pixelFormat, origin};
       }
     }
@@ -157,7 +157,7 @@ namespace Fsl
 
 
   TightBitmap::TightBitmap(const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
-    : m_content(sizePx.RawHeight() * PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat))
+    : m_content(std::vector<uint8_t>(sizePx.RawHeight() * PixelFormatUtil::CalcMinimumStride(sizePx.Width(), pixelFormat)))
     , m_sizePx(sizePx)
     , m_pixelFormat(pixelFormat)
     , m_origin(origin)
@@ -191,6 +191,12 @@ namespace Fsl
 
 
   TightBitmap::TightBitmap(std::vector<uint8_t> content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
+    : TightBitmap(BitmapMemoryBuffer(std::move(content)), sizePx, pixelFormat, origin)
+  {
+  }
+
+
+  TightBitmap::TightBitmap(BitmapMemoryBuffer&& content, const PxSize2D sizePx, const PixelFormat pixelFormat, const BitmapOrigin origin)
     : m_content(std::move(content))
     , m_sizePx(sizePx)
     , m_pixelFormat(pixelFormat)
@@ -227,26 +233,26 @@ namespace Fsl
   ReadOnlySpan<uint8_t> TightBitmap::AsSpan() const noexcept
   {
     assert((m_bytesPerPixel * UncheckedNumericCast<std::size_t>(RawUnsignedWidth()) * RawUnsignedHeight()) == m_content.size());
-    return SpanUtil::AsReadOnlySpan(m_content);
+    return m_content.AsReadOnlySpan();
   }
 
 
   Span<uint8_t> TightBitmap::AsSpan() noexcept
   {
     assert((m_bytesPerPixel * UncheckedNumericCast<std::size_t>(RawUnsignedWidth()) * RawUnsignedHeight()) == m_content.size());
-    return SpanUtil::AsSpan(m_content);
+    return m_content.AsSpan();
   }
 
 
   ReadOnlyRawBitmap TightBitmap::AsRawBitmap() const noexcept
   {
-    return ReadOnlyRawBitmap::UncheckedCreate(SpanUtil::AsReadOnlySpan(m_content), GetSize(), GetPixelFormat(), GetOrigin());
+    return ReadOnlyRawBitmap::UncheckedCreate(m_content.AsReadOnlySpan(), GetSize(), GetPixelFormat(), GetOrigin());
   }
 
 
   RawBitmapEx TightBitmap::AsRawBitmap() noexcept
   {
-    return RawBitmapEx::UncheckedCreate(SpanUtil::AsSpan(m_content), GetSize(), GetPixelFormat(), GetOrigin());
+    return RawBitmapEx::UncheckedCreate(m_content.AsSpan(), GetSize(), GetPixelFormat(), GetOrigin());
   }
 
 
@@ -258,7 +264,7 @@ namespace Fsl
 
   BitmapMemory TightBitmap::Release() noexcept
   {
-    std::vector<uint8_t> content = std::move(m_content);
+    BitmapMemoryBuffer content = std::move(m_content);
     const PxSize2D sizePx = m_sizePx;
     const PixelFormat pixelFormat = m_pixelFormat;
     const BitmapOrigin origin = m_origin;
@@ -268,9 +274,9 @@ namespace Fsl
   }
 
 
-  std::vector<uint8_t> TightBitmap::ReleaseAsVector() noexcept
+  std::vector<uint8_t> TightBitmap::ReleaseAsVector()
   {
-    auto content = std::move(m_content);
+    auto content = m_content.ReleaseAsVector();
     Reset();
     return content;
   }
@@ -74,10 +74,10 @@ namespace Fsl::ContainerTypeConvert
     const auto origin = texture.GetBitmapOrigin();
     const auto extent = texture.GetExtent();
 
-    std::vector<uint8_t> contentVector;
-    texture.ReleaseInto(contentVector);
+    // Take the buffer so pooled storage is handed over without a copy
+    BitmapMemoryBuffer content = texture.ReleaseBuffer();
     // Texture has now been reset, so dont use it
-    return {std::move(contentVector), TypeConverter::To<PxSize2D>(PxExtent2D(extent.Width, extent.Height)), pixelFormat,
-            static_cast<uint32_t>(stride), origin};
+    return Bitmap(BitmapMemory::UncheckedCreate(std::move(content), TypeConverter::To<PxSize2D>(PxExtent2D(extent.Width, extent.Height)), pixelFormat,
+                                                origin, static_cast<uint32_t>(stride)));
   }
 }
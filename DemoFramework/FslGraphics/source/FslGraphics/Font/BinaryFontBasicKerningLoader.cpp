@@ -37,6 +37,8 @@
 #include <FslBase/Math/Rectangle.hpp>
 #include <FslBase/NumericCast.hpp>
 #include <FslBase/String/UTF8String.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/System/Platform/PlatformPathTransform.hpp>
 #include <FslGraphics/Font/BasicFontKerning.hpp>
 #include <FslGraphics/Font/BinaryFontBasicKerningLoader.hpp>
@@ -80,11 +82,12 @@ namespace Fsl
     }
 
 
-    FBKHeader ReadAndValidateHeader(std::ifstream& rStream)
+    FBKHeader DecodeAndValidateHeader(const ReadOnlySpan<uint8_t> fileHeader)
     {
-      std::array<uint8_t, SizeFileheader> fileHeader{};
-      // Try to read the file header
-      StreamRead(rStream, fileHeader.data(), SizeFileheader);
+      if (fileHeader.size() < SizeFileheader)
+      {
+        throw FormatException("Failed to read the expected amount of bytes");
+      }
 
       FBKHeader header;
       header.Magic = ByteArrayUtil::ReadUInt32LE(fileHeader.data(), SizeFileheader, FileheaderOffsetMagic);
@@ -104,6 +107,15 @@ namespace Fsl
     }
 
 
+    FBKHeader ReadAndValidateHeader(std::ifstream& rStream)
+    {
+      std::array<uint8_t, SizeFileheader> fileHeader{};
+      // Try to read the file header
+      StreamRead(rStream, fileHeader.data(), SizeFileheader);
+      return DecodeAndValidateHeader(SpanUtil::AsReadOnlySpan(fileHeader));
+    }
+
+
     // int32_t ReadRectangle(Rectangle& rResult, const uint8_t*const pSrc, const int32_t srcLength, const int32_t index)
     //{
     //  int32_t srcRectX, srcRectY;
@@ -135,7 +147,7 @@ namespace Fsl
       return currentIndex - index;
     }
 
-    std::size_t ReadRanges(BasicFontKerning& rTextureAtlas, const std::vector<uint8_t>& content, const std::size_t index)
+    std::size_t ReadRanges(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t> content, const std::size_t index)
     {
       std::size_t currentIndex = index;
 
@@ -157,7 +169,7 @@ namespace Fsl
     }
 
 
-    std::size_t ReadGlyphKernings(BasicFontKerning& rTextureAtlas, const std::vector<uint8_t>& content, const std::size_t index)
+    std::size_t ReadGlyphKernings(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t> content, const std::size_t index)
     {
       std::size_t currentIndex = index;
 
@@ -191,7 +203,7 @@ namespace Fsl
     }
 
 
-    std::size_t ReadDescription(BasicFontKerning& rTextureAtlas, const std::vector<uint8_t>& content, const std::size_t index)
+    std::size_t ReadDescription(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t> content, const std::size_t index)
     {
       std::size_t currentIndex = index;
 
@@ -211,11 +223,8 @@ namespace Fsl
     }
 
 
-    void ReadEntries(BasicFontKerning& rTextureAtlas, std::ifstream& rStream, const uint32_t contentSize)
+    void DecodeEntries(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t> content)
     {
-      std::vector<uint8_t> content(contentSize);
-      StreamRead(rStream, content.data(), content.size());
-
       std::size_t currentIndex = 0;
       currentIndex += ReadRanges(rTextureAtlas, content, currentIndex);
       currentIndex += ReadGlyphKernings(rTextureAtlas, content, currentIndex);
@@ -227,6 +236,14 @@ namespace Fsl
       ReadString(strTmp, content.data(), content.size(), currentIndex);
       rTextureAtlas.SetPathName(IO::Path(strTmp));
     }
+
+
+    void ReadEntries(BasicFontKerning& rTextureAtlas, std::ifstream& rStream, const uint32_t contentSize)
+    {
+      std::vector<uint8_t> content(contentSize);
+      StreamRead(rStream, content.data(), content.size());
+      DecodeEntries(rTextureAtlas, SpanUtil::AsReadOnlySpan(content));
+    }
   }
 
 
@@ -254,4 +271,21 @@ namespace Fsl
       throw FormatException("The file format appears to be invalid");
     }
   }
+
+
+  void BinaryFontBasicKerningLoader::Decode(BasicFontKerning& rTextureAtlas, const ReadOnlySpan<uint8_t>& content)
+  {
+    const FBKHeader header = DecodeAndValidateHeader(content);
+    const ReadOnlySpan<uint8_t> remainingSpan = content.subspan(SizeFileheader);
+    if (remainingSpan.size() < header.Size)
+    {
+      throw FormatException("Failed to read the expected amount of bytes");
+    }
+    DecodeEntries(rTextureAtlas, remainingSpan.subspan(0, header.Size));
+
+    if (!rTextureAtlas.IsValid())
+    {
+      throw FormatException("The file format appears to be invalid");
+    }
+  }
 }
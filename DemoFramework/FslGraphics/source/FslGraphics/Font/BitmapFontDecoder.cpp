@@ -38,7 +38,7 @@
 #include <FslGraphics/Font/BitmapFontDecoder.hpp>
 #include <FslGraphics/Log/Font/FmtBitmapFontType.hpp>
 // #include <FslBase/Math/Pixel/TypeConverter.hpp>
-#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
 #include <fmt/format.h>
 #include <utility>
 
@@ -171,8 +171,9 @@ namespace Fsl
 
   BitmapFont BitmapFontDecoder::Load(const IO::Path& strFilename)
   {
-    auto content = IO::File::ReadAllBytes(strFilename);
-    return Decode(ReadOnlySpan<uint8_t>(content.data(), content.size()));
+    // Decode directly from the mapped pages instead of a copy of the file
+    const IO::MemoryMappedFile content(strFilename);
+    return Decode(content.AsReadOnlySpan());
   }
 
   BitmapFont BitmapFontDecoder::Decode(const ReadOnlySpan<uint8_t>& content)
@@ -31,6 +31,7 @@
 
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Bitmap/BitmapMemoryPool.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
 #include <FslGraphics/Texture/Texture.hpp>
@@ -62,7 +63,7 @@ namespace Fsl
     }
 
     //! @brief Returns the total texel count
-    uint32_t ValidateBlobs(const std::vector<uint8_t>& srcContent, const std::vector<BlobRecord>& srcBlobs, const PxExtent3D& extent,
+    uint32_t ValidateBlobs(const BitmapMemoryBuffer& srcContent, const std::vector<BlobRecord>& srcBlobs, const PxExtent3D& extent,
                            const PixelFormat pixelFormat, const TextureInfo& textureInfo)
     {
       const bool isCompressed = PixelFormatUtil::IsCompressed(pixelFormat);
@@ -220,7 +221,7 @@ namespace Fsl
     const PixelFormat pixelFormat = bitmapMemory.GetPixelFormat();
     const BitmapOrigin origin = bitmapMemory.GetOrigin();
 
-    DoReset(bitmapMemory.Release(), extent, pixelFormat, origin);
+    DoReset(bitmapMemory.ReleaseBuffer(), extent, pixelFormat, origin);
     assert(IsValid());
   }
 
@@ -228,13 +229,27 @@ namespace Fsl
   Texture::Texture(std::vector<uint8_t>&& content, const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin)
     : Texture()
   {
-    DoReset(std::move(content), extent, pixelFormat, origin);
+    DoReset(BitmapMemoryBuffer(std::move(content)), extent, pixelFormat, origin);
   }
 
 
   Texture::~Texture()
   {
     FSLLOG3_WARNING_IF(m_isLocked, "Destroying a locked texture, the content being accessed will no longer be available");
+    BitmapMemoryPool::Recycle(std::move(m_content));
+  }
+
+
+  Texture Texture::CreateUninitialized(const TextureBlobBuilder& builder)
+  {
+    if (!builder.IsValid())
+    {
+      throw std::invalid_argument("build can not be invalid");
+    }
+
+    Texture texture;
+    texture.DoReset(nullptr, 0, builder, false);
+    return texture;
   }
 
 
@@ -247,12 +262,26 @@ namespace Fsl
     }
 
     // Get the current content array, then reset this object
-    rContentTarget = std::move(m_content);
+    rContentTarget = m_content.ReleaseAsVector();
 
     ResetNoThrow();
   }
 
 
+  BitmapMemoryBuffer Texture::ReleaseBuffer()
+  {
+    // Reset() should not throw, but this warrants a program stop since its a critical error
+    if (m_isLocked)
+    {
+      throw UsageErrorException("Can not release a locked texture, that would invalidate the content being accessed");
+    }
+
+    BitmapMemoryBuffer content = std::move(m_content);
+    ResetNoThrow();
+    return content;
+  }
+
+
   void Texture::Reset()
   {
     // Reset() should not throw, but this warrants a program stop since its a critical error
@@ -333,7 +362,7 @@ namespace Fsl
       throw NotSupportedException("the builder content size did not match the buffer size");
     }
 
-    DoReset(std::move(content), std::move(builder));
+    DoReset(BitmapMemoryBuffer(std::move(content)), std::move(builder));
   }
 
 
@@ -355,7 +384,7 @@ namespace Fsl
       throw UsageErrorException("Can not reset a locked texture, that would invalidate the content being accessed");
     }
 
-    DoReset(std::move(content), extent, pixelFormat, origin);
+    DoReset(BitmapMemoryBuffer(std::move(content)), extent, pixelFormat, origin);
   }
 
 
@@ -647,7 +676,7 @@ namespace Fsl
   }
 
 
-  void Texture::DoReset(const void* const pContent, const std::size_t contentByteSize, const TextureBlobBuilder& builder)
+  void Texture::DoReset(const void* const pContent, const std::size_t contentByteSize, const TextureBlobBuilder& builder, const bool zeroFill)
   {
     // If any of these fire the builder did not keep its contract or
     // we forgot to validate a input parameter somewhere
@@ -670,7 +699,10 @@ namespace Fsl
     try
     {
       const auto blobCount = builder.GetBlobCount();
-      m_content.resize(builder.GetContentSize());
+      // When we copy the content there is no need to clear it first
+      BitmapMemoryPool::Recycle(std::move(m_content));
+      m_content = zeroFill && pContent == nullptr ? BitmapMemoryPool::AcquireZeroed(builder.GetContentSize())
+                                                  : BitmapMemoryPool::AcquireUninitialized(builder.GetContentSize());
       m_blobs.resize(blobCount);
 
       for (std::size_t i = 0; i < blobCount; ++i)
@@ -705,7 +737,7 @@ namespace Fsl
   }
 
 
-  void Texture::DoReset(std::vector<uint8_t>&& content, TextureBlobBuilder&& builder)
+  void Texture::DoReset(BitmapMemoryBuffer&& content, TextureBlobBuilder&& builder)
   {
     // If any of these fire the builder did not keep its contract or
     // we forgot to validate a input parameter somewhere
@@ -773,12 +805,11 @@ namespace Fsl
       const std::size_t minStride = PixelFormatUtil::CalcMinimumStride(extent.Width, pixelFormat);
       const std::size_t totalByteSize = (extent.Height.Value * minStride);
 
-      m_content.resize(totalByteSize);
+      BitmapMemoryPool::Recycle(std::move(m_content));
+      m_content = BitmapMemoryPool::AcquireZeroed(totalByteSize);
       m_blobs.resize(1);
       m_blobs[0].Offset = 0;
       m_blobs[0].Size = totalByteSize;
-
-      std::fill(m_content.begin(), m_content.end(), static_cast<uint8_t>(0));
     }
     catch (const std::exception&)
     {
@@ -797,7 +828,7 @@ namespace Fsl
   }
 
 
-  void Texture::DoReset(std::vector<uint8_t>&& content, const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin)
+  void Texture::DoReset(BitmapMemoryBuffer&& content, const PxExtent2D& extent, const PixelFormat pixelFormat, const BitmapOrigin origin)
   {
     // If any of these fire the caller did not keep its contract.
     assert(!m_isLocked);
@@ -845,7 +876,7 @@ namespace Fsl
     }
     m_isLocked = true;
 
-    return ReadOnlyRawTexture::Create(m_textureType, SpanUtil::AsReadOnlySpan(m_content), SpanUtil::AsReadOnlySpan(m_blobs), m_extent, m_pixelFormat,
+    return ReadOnlyRawTexture::Create(m_textureType, m_content.AsReadOnlySpan(), SpanUtil::AsReadOnlySpan(m_blobs), m_extent, m_pixelFormat,
                                       m_textureInfo, m_bitmapOrigin);
   }
 
@@ -858,7 +889,7 @@ namespace Fsl
     }
     m_isLocked = true;
 
-    return RawTextureEx::UncheckedCreate(m_textureType, SpanUtil::AsSpan(m_content), SpanUtil::AsReadOnlySpan(m_blobs), m_extent, m_pixelFormat,
+    return RawTextureEx::UncheckedCreate(m_textureType, m_content.AsSpan(), SpanUtil::AsReadOnlySpan(m_blobs), m_extent, m_pixelFormat,
                                          m_textureInfo, m_bitmapOrigin);
   }
 
@@ -893,6 +924,7 @@ namespace Fsl
   void Texture::ResetNoThrow()
   {
     FSLLOG3_WARNING_IF(m_isLocked, "Destroying a locked texture, the content being accessed will no longer be available");
+    BitmapMemoryPool::Recycle(std::move(m_content));
     m_content.clear();
     m_blobs.clear();
     m_extent = PxExtent3D();
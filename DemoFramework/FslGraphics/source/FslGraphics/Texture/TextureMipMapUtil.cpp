@@ -31,53 +31,105 @@
 
 #include <FslBase/Math/MathHelper.hpp>
 #include <FslBase/NumericCast.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/RawBitmapDownscaleUtil.hpp>
 #include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
+#include <FslGraphics/Log/FmtPixelFormat.hpp>
 #include <FslGraphics/Log/Texture/FmtTextureType.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
 #include <FslGraphics/Texture/RawTextureHelper.hpp>
 #include <FslGraphics/Texture/TextureBlobBuilder.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
 
 namespace Fsl
 {
-  namespace TextureMipMapUtil
+  namespace
   {
-    uint32_t CountMipMapLevels(uint32_t size)
+    namespace LocalConfig
     {
-      if (!MathHelper::IsPowerOfTwo(size))
-      {
-        throw std::invalid_argument("size is not a power of two");
-      }
+      //! The minimum amount of dst bytes generated by one job
+      constexpr std::size_t MinBatchBytes = 64 * 1024;
+    }
 
-      uint32_t levels = 0;
-      while (size > 0)
+    struct FaceBitmaps
+    {
+      ReadOnlyRawBitmap Src;
+      RawBitmapEx Dst;
+
+      FaceBitmaps(const ReadOnlyRawBitmap& src, const RawBitmapEx& dst) noexcept
+        : Src(src)
+        , Dst(dst)
       {
-        size >>= 1;
-        ++levels;
       }
-      return levels;
-    }
+    };
 
-    Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter)
+    //! @brief The RawBitmapUtil downscalers accept formats that RawBitmapDownscaleUtil does not (nearest works on any 32bit format and box on
+    //!        every R8G8B8A8 swizzle compatible format like the UINT, SINT and SNORM variants), so they are used as a fallback for those.
+    bool IsFallbackFilter(const TextureMipMapFilter filter) noexcept
     {
-      const Bitmap::ScopedDirectReadAccess access(src);
-      return GenerateMipMaps(access.AsRawBitmap(), filter);
+      return filter == TextureMipMapFilter::Nearest || filter == TextureMipMapFilter::Box;
     }
 
-    Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter)
+    void GenerateFallbackLevel(std::vector<FaceBitmaps>& rFaces, const TextureMipMapFilter filter)
     {
-      Texture::ScopedDirectReadAccess access(src);
-      return GenerateMipMaps(access.AsRawTexture(), filter);
+      for (FaceBitmaps& rFace : rFaces)
+      {
+        switch (filter)
+        {
+        case TextureMipMapFilter::Nearest:
+          RawBitmapUtil::DownscaleNearest(rFace.Dst, rFace.Src);
+          break;
+        case TextureMipMapFilter::Box:
+          RawBitmapUtil::DownscaleBoxFilter(rFace.Dst, rFace.Src);
+          break;
+        default:
+          throw NotSupportedException("Unsupported filter");
+        }
+      }
     }
 
-    Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter)
+    void GenerateLevel(std::vector<FaceBitmaps>& rFaces, const TextureMipMapFilter filter, const bool useFallback, JobSystem* const pJobSystem)
     {
-      ReadOnlyRawTexture srcTexture = RawTextureHelper::ToRawTexture(src);
-      return GenerateMipMaps(srcTexture, filter);
+      assert(!rFaces.empty());
+      if (useFallback)
+      {
+        GenerateFallbackLevel(rFaces, filter);
+        return;
+      }
+      const uint32_t dstHeight = rFaces.front().Dst.RawUnsignedHeight();
+      const std::size_t totalRows = rFaces.size() * dstHeight;
+      const std::size_t minBatchRows = std::max(LocalConfig::MinBatchBytes / std::max(rFaces.front().Dst.Stride(), 1u), std::size_t(1));
+      if (pJobSystem == nullptr || pJobSystem->GetConcurrency() <= 1u || totalRows < (minBatchRows * 2u))
+      {
+        for (FaceBitmaps& rFace : rFaces)
+        {
+          RawBitmapDownscaleUtil::Downscale(rFace.Dst, rFace.Src, filter);
+        }
+        return;
+      }
+
+      // All faces of the level are treated as one continuous range of rows which is split between the workers
+      pJobSystem->ParallelForRange(totalRows, minBatchRows,
+                                   [&rFaces, filter, dstHeight](std::size_t startIndex, std::size_t count)
+                                   {
+                                     while (count > 0u)
+                                     {
+                                       FaceBitmaps& rFace = rFaces[startIndex / dstHeight];
+                                       const auto row = static_cast<uint32_t>(startIndex % dstHeight);
+                                       const auto rowCount = static_cast<uint32_t>(std::min(count, static_cast<std::size_t>(dstHeight - row)));
+                                       RawBitmapDownscaleUtil::Downscale(rFace.Dst, rFace.Src, filter, row, rowCount);
+                                       startIndex += rowCount;
+                                       count -= rowCount;
+                                     }
+                                   });
     }
 
-    Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter)
+    Texture DoGenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem* const pJobSystem)
     {
       if (!src.IsValid())
       {
@@ -98,6 +150,11 @@ namespace Fsl
       {
         throw NotSupportedException("texture Layers and Faces must be 1");
       }
+      const bool useFallback = !RawBitmapDownscaleUtil::IsSupported(pixelFormat, filter);
+      if (useFallback && !IsFallbackFilter(filter))
+      {
+        throw NotSupportedException(fmt::format("unsupported pixel format for the filter: {}", pixelFormat));
+      }
 
       switch (src.GetTextureType())
       {
@@ -109,9 +166,10 @@ namespace Fsl
         throw NotSupportedException(fmt::format("unsupported texture type: {}", src.GetTextureType()));
       }
 
-      const uint32_t mipLevels = CountMipMapLevels(extent.Width.Value);
+      const uint32_t mipLevels = TextureMipMapUtil::CountMipMapLevels(extent.Width.Value);
       const TextureInfo textureInfo(mipLevels, src.GetFaces(), src.GetLayers());
-      Texture result(TextureBlobBuilder(src.GetTextureType(), src.GetExtent(), pixelFormat, textureInfo, origin, true));
+      // All levels are written below (level zero is copied, the rest is generated) so the content does not need to be cleared
+      Texture result(Texture::CreateUninitialized(TextureBlobBuilder(src.GetTextureType(), src.GetExtent(), pixelFormat, textureInfo, origin, true)));
       {
         Texture::ScopedDirectReadWriteAccess dstAccess(result);
         RawTextureEx rawDstTexture = dstAccess.AsRawTexture();
@@ -133,34 +191,26 @@ namespace Fsl
           }
         }
         if (textureInfo.Layers > 0u)
-        {    // Generate the mip maps
+        {    // Generate the mip maps, each level depends on the previous one so only the faces and rows of a level are generated in parallel
           const uint32_t finalSrcLevel = textureInfo.Levels - 1;
           uint32_t width = extent.Width.Value;
           uint32_t height = extent.Height.Value;
+          std::vector<FaceBitmaps> faces;
+          faces.reserve(textureInfo.Faces);
           for (uint32_t levelIndex = 0; levelIndex < finalSrcLevel; ++levelIndex)
           {
+            faces.clear();
             for (uint32_t faceIndex = 0; faceIndex < textureInfo.Faces; ++faceIndex)
             {
               BlobRecord srcBlobRecord = rawDstTexture.GetTextureBlob(levelIndex, faceIndex, 0);
               BlobRecord dstBlobRecord = rawDstTexture.GetTextureBlob(levelIndex + 1, faceIndex, 0);
               // Since we copied the original data to dest and are reusing the previous mipmaps pDstStart is the base
-              ReadOnlyRawBitmap srcBitmap(ReadOnlyRawBitmap::UncheckedCreate(
-                pDstStart + srcBlobRecord.Offset, NumericCast<uint32_t>(srcBlobRecord.Size), PxExtent2D::Create(width, height), pixelFormat, origin));
-              RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(pDstStart + dstBlobRecord.Offset, NumericCast<uint32_t>(dstBlobRecord.Size),
-                                                                 PxExtent2D::Create(width / 2, height / 2), pixelFormat, origin));
-
-              switch (filter)
-              {
-              case TextureMipMapFilter::Nearest:
-                RawBitmapUtil::DownscaleNearest(dstBitmap, srcBitmap);
-                break;
-              case TextureMipMapFilter::Box:
-                RawBitmapUtil::DownscaleBoxFilter(dstBitmap, srcBitmap);
-                break;
-              default:
-                throw NotSupportedException("Unsupported filter");
-              }
+              faces.emplace_back(ReadOnlyRawBitmap::UncheckedCreate(pDstStart + srcBlobRecord.Offset, NumericCast<uint32_t>(srcBlobRecord.Size),
+                                                                    PxExtent2D::Create(width, height), pixelFormat, origin),
+                                 RawBitmapEx::UncheckedCreate(pDstStart + dstBlobRecord.Offset, NumericCast<uint32_t>(dstBlobRecord.Size),
+                                                              PxExtent2D::Create(width / 2, height / 2), pixelFormat, origin));
             }
+            GenerateLevel(faces, filter, useFallback, pJobSystem);
             width /= 2;
             height /= 2;
           }
@@ -168,5 +218,70 @@ namespace Fsl
       }
       return result;
     }
+  }
+
+  namespace TextureMipMapUtil
+  {
+    uint32_t CountMipMapLevels(uint32_t size)
+    {
+      if (!MathHelper::IsPowerOfTwo(size))
+      {
+        throw std::invalid_argument("size is not a power of two");
+      }
+
+      uint32_t levels = 0;
+      while (size > 0)
+      {
+        size >>= 1;
+        ++levels;
+      }
+      return levels;
+    }
+
+    Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter)
+    {
+      const Bitmap::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawBitmap(), filter);
+    }
+
+    Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter)
+    {
+      Texture::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawTexture(), filter);
+    }
+
+    Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter)
+    {
+      ReadOnlyRawTexture srcTexture = RawTextureHelper::ToRawTexture(src);
+      return GenerateMipMaps(srcTexture, filter);
+    }
+
+    Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter)
+    {
+      return DoGenerateMipMaps(src, filter, nullptr);
+    }
+
+    Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      const Bitmap::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawBitmap(), filter, rJobSystem);
+    }
+
+    Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      Texture::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawTexture(), filter, rJobSystem);
+    }
+
+    Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      ReadOnlyRawTexture srcTexture = RawTextureHelper::ToRawTexture(src);
+      return GenerateMipMaps(srcTexture, filter, rJobSystem);
+    }
+
+    Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      return DoGenerateMipMaps(src, filter, &rJobSystem);
+    }
   };
 }
@@ -154,13 +154,12 @@ namespace Fsl
     }
 
 
-    BTAHeader ReadAndValidateHeader(std::ifstream& rStream)
+    BTAHeader DecodeAndValidateHeader(const ReadOnlySpan<uint8_t> fileHeaderSpan)
     {
-      std::array<uint8_t, BTAFormat::Header::HeaderSize> fileheader{};
-      // Try to read the file header
-      StreamRead(rStream, fileheader.data(), fileheader.size());
-
-      const auto fileHeaderSpan = SpanUtil::AsReadOnlySpan(fileheader);
+      if (fileHeaderSpan.size() < BTAFormat::Header::HeaderSize)
+      {
+        throw FormatException("Failed to read the expected amount of bytes");
+      }
 
       BTAHeader header;
       header.Magic = ByteSpanUtil::ReadUInt32LE(fileHeaderSpan.subspan(BTAFormat::Header::OffsetMagic));
@@ -181,6 +180,14 @@ namespace Fsl
       return header;
     }
 
+    BTAHeader ReadAndValidateHeader(std::ifstream& rStream)
+    {
+      std::array<uint8_t, BTAFormat::Header::HeaderSize> fileheader{};
+      // Try to read the file header
+      StreamRead(rStream, fileheader.data(), fileheader.size());
+      return DecodeAndValidateHeader(SpanUtil::AsReadOnlySpan(fileheader));
+    }
+
     ChunkType ReadChunkType(ReadOnlySpan<uint8_t>& rSpan)
     {
       const uint32_t chunkContentType = ValueCompression::ReadSimpleUInt32(rSpan);
@@ -294,13 +301,8 @@ namespace Fsl
       rTextureAtlas.SetEntry(index, rectanglePx, trimPx, BTAFormat::DefaultDp, std::move(path));
     }
 
-    void ReadBTA1Entries(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream, const uint32_t contentSize)
+    void DecodeBTA1Entries(BasicTextureAtlas& rTextureAtlas, ReadOnlySpan<uint8_t> contentSpan)
     {
-      std::vector<uint8_t> content(contentSize);
-      StreamRead(rStream, content.data(), content.size());
-
-      auto contentSpan = SpanUtil::AsReadOnlySpan(content);
-
       const uint32_t numEntries = ValueCompression::ReadSimpleUInt32(contentSpan);
       rTextureAtlas.Reset(numEntries);
 
@@ -376,27 +378,57 @@ namespace Fsl
     }
 
 
-    void ReadBTA2Entries(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream, const uint32_t contentSize)
+    void DecodeBTA2Entries(BasicTextureAtlas& rTextureAtlas, ReadOnlySpan<uint8_t> contentSpan)
     {
-      std::vector<uint8_t> content(contentSize);
-      StreamRead(rStream, content.data(), content.size());
-
-      auto contentSpan = SpanUtil::AsReadOnlySpan(content);
       auto pathEntries = ReadBTAPathEntries(contentSpan);
       ReadBTA2AtlasEntries(rTextureAtlas, pathEntries, contentSpan);
     }
 
 
-    void ReadBTA3Entries(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream, const uint32_t contentSize)
+    void DecodeBTA3Entries(BasicTextureAtlas& rTextureAtlas, ReadOnlySpan<uint8_t> contentSpan)
     {
-      std::vector<uint8_t> content(contentSize);
-      StreamRead(rStream, content.data(), content.size());
-
-      auto contentSpan = SpanUtil::AsReadOnlySpan(content);
       auto pathEntries = ReadBTAPathEntries(contentSpan);
       ReadBTA3AtlasEntries(rTextureAtlas, pathEntries, contentSpan);
     }
 
+
+    //! @brief Decode the atlas entries of the given version (this does not include the optional BTA4 chunks)
+    void DecodeEntries(BasicTextureAtlas& rTextureAtlas, const uint32_t version, const ReadOnlySpan<uint8_t> contentSpan)
+    {
+      switch (version)
+      {
+      case BTAFormat::BtaVersioN1:
+        DecodeBTA1Entries(rTextureAtlas, contentSpan);
+        break;
+      case BTAFormat::BtaVersioN2:
+        DecodeBTA2Entries(rTextureAtlas, contentSpan);
+        break;
+      case BTAFormat::BtaVersioN3:
+      case BTAFormat::BtaVersioN4:
+        DecodeBTA3Entries(rTextureAtlas, contentSpan);
+        break;
+      default:
+        throw NotSupportedException("BTA format not supported");
+      }
+    }
+
+    MinimalChunkHeader DecodeAndValidateMinimalChunkHeader(const ReadOnlySpan<uint8_t> headerSpan)
+    {
+      MinimalChunkHeader minimalHeader;
+      minimalHeader.Magic = ByteSpanUtil::ReadUInt32LE(headerSpan, BTAFormat::Chunk::OffsetMagic);
+      minimalHeader.Size = ByteSpanUtil::ReadUInt32LE(headerSpan, BTAFormat::Chunk::OffsetSize);
+      if (minimalHeader.Magic != BTAFormat::Chunk::HeaderMagicValue)
+      {
+        throw FormatException("Chunk not of the expected format");
+      }
+      if (minimalHeader.Size < BTAFormat::Chunk::HeaderSize)
+      {
+        throw FormatException("Invalid chunk");
+      }
+      return minimalHeader;
+    }
+
+
     std::optional<MinimalChunkHeader> TryReadMinimalChunkHeader(std::ifstream& rStream)
     {
       // Try to read the header
@@ -405,11 +437,7 @@ namespace Fsl
       {
         return {};
       }
-      const auto headerSpan = SpanUtil::AsReadOnlySpan(header);
-      MinimalChunkHeader minimalHeader;
-      minimalHeader.Magic = ByteSpanUtil::ReadUInt32LE(headerSpan, BTAFormat::Chunk::OffsetMagic);
-      minimalHeader.Size = ByteSpanUtil::ReadUInt32LE(headerSpan, BTAFormat::Chunk::OffsetSize);
-      return minimalHeader;
+      return DecodeAndValidateMinimalChunkHeader(SpanUtil::AsReadOnlySpan(header));
     }
 
 
@@ -444,30 +472,8 @@ namespace Fsl
       }
     }
 
-    bool TryReadBTA4Chunk(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream)
+    void ProcessBTA4Chunk(BasicTextureAtlas& rTextureAtlas, ReadOnlySpan<uint8_t> chunkContentSpan)
     {
-      // Try to read the chunk header
-      std::optional<MinimalChunkHeader> chunkHeader = TryReadMinimalChunkHeader(rStream);
-      if (!chunkHeader.has_value())
-      {
-        return false;
-      }
-      if (chunkHeader.value().Magic != BTAFormat::Chunk::HeaderMagicValue)
-      {
-        throw FormatException("Chunk not of the expected format");
-      }
-      if (chunkHeader.value().Size < BTAFormat::Chunk::HeaderSize)
-      {
-        throw FormatException("Invalid chunk");
-      }
-
-      // Read the remaining chunk content
-      const uint32_t chunkContentSize = chunkHeader.value().Size - BTAFormat::Chunk::HeaderSize;
-      std::vector<uint8_t> chunkContent(chunkContentSize);
-      StreamRead(rStream, chunkContent.data(), chunkContent.size());
-
-      auto chunkContentSpan = SpanUtil::AsReadOnlySpan(chunkContent);
-
       // Just after the basic chunk header, there is a extended chunk header
       // ChunkType = EncodedUInt32
       // ChunkVersion = EncodedUInt32
@@ -482,6 +488,24 @@ namespace Fsl
       default:
         throw NotSupportedException(fmt::format("Unsupported chunk content type: ", static_cast<uint32_t>(chunkType)));
       }
+    }
+
+
+    bool TryReadBTA4Chunk(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream)
+    {
+      // Try to read the chunk header
+      std::optional<MinimalChunkHeader> chunkHeader = TryReadMinimalChunkHeader(rStream);
+      if (!chunkHeader.has_value())
+      {
+        return false;
+      }
+
+      // Read the remaining chunk content
+      const uint32_t chunkContentSize = chunkHeader.value().Size - BTAFormat::Chunk::HeaderSize;
+      std::vector<uint8_t> chunkContent(chunkContentSize);
+      StreamRead(rStream, chunkContent.data(), chunkContent.size());
+
+      ProcessBTA4Chunk(rTextureAtlas, SpanUtil::AsReadOnlySpan(chunkContent));
       return true;
     }
 
@@ -495,6 +519,22 @@ namespace Fsl
       }
     }
 
+
+    void DecodeBTA4OptionalChunks(BasicTextureAtlas& rTextureAtlas, ReadOnlySpan<uint8_t> span)
+    {
+      // Like the stream reader, trailing bytes that can not hold a chunk header end the chunk list
+      while (span.size() >= BTAFormat::Chunk::HeaderSize)
+      {
+        const MinimalChunkHeader chunkHeader = DecodeAndValidateMinimalChunkHeader(span);
+        if (span.size() < chunkHeader.Size)
+        {
+          throw FormatException("Failed to read the expected amount of bytes");
+        }
+        ProcessBTA4Chunk(rTextureAtlas, span.subspan(BTAFormat::Chunk::HeaderSize, chunkHeader.Size - BTAFormat::Chunk::HeaderSize));
+        span = span.subspan(chunkHeader.Size);
+      }
+    }
+
   }
 
 
@@ -515,23 +555,28 @@ namespace Fsl
   void BinaryTextureAtlasLoader::Load(BasicTextureAtlas& rTextureAtlas, std::ifstream& rStream)
   {
     const BTAHeader header = ReadAndValidateHeader(rStream);
-    switch (header.Version)
-    {
-    case BTAFormat::BtaVersioN1:
-      ReadBTA1Entries(rTextureAtlas, rStream, header.Size);
-      break;
-    case BTAFormat::BtaVersioN2:
-      ReadBTA2Entries(rTextureAtlas, rStream, header.Size);
-      break;
-    case BTAFormat::BtaVersioN3:
-      ReadBTA3Entries(rTextureAtlas, rStream, header.Size);
-      break;
-    case BTAFormat::BtaVersioN4:
-      ReadBTA3Entries(rTextureAtlas, rStream, header.Size);
+    std::vector<uint8_t> content(header.Size);
+    StreamRead(rStream, content.data(), content.size());
+    DecodeEntries(rTextureAtlas, header.Version, SpanUtil::AsReadOnlySpan(content));
+    if (header.Version == BTAFormat::BtaVersioN4)
+    {
       ReadBTA4OptionalChunks(rTextureAtlas, rStream);
-      break;
-    default:
-      throw NotSupportedException("BTA format not supported");
+    }
+  }
+
+
+  void BinaryTextureAtlasLoader::Decode(BasicTextureAtlas& rTextureAtlas, const ReadOnlySpan<uint8_t>& content)
+  {
+    const BTAHeader header = DecodeAndValidateHeader(content);
+    const ReadOnlySpan<uint8_t> remainingSpan = content.subspan(BTAFormat::Header::HeaderSize);
+    if (remainingSpan.size() < header.Size)
+    {
+      throw FormatException("Failed to read the expected amount of bytes");
+    }
+    DecodeEntries(rTextureAtlas, header.Version, remainingSpan.subspan(0, header.Size));
+    if (header.Version == BTAFormat::BtaVersioN4)
+    {
+      DecodeBTA4OptionalChunks(rTextureAtlas, remainingSpan.subspan(header.Size));
     }
   }
 }
@@ -0,0 +1,271 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The number of vertices converted per block. Each operation runs over the entire block before the next operation is executed,
+      //! so the block size is chosen to keep both the src and dst block in the L1 cache for typical vertex sizes.
+      constexpr std::size_t BlockVertexCount = 64;
+      //! The minimum number of vertices each job converts when using the job system
+      constexpr std::size_t MinParallelVertexCount = 16384;
+    }
+
+    template <std::size_t TByteSize>
+    void CopyFixed(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride, const std::size_t vertexCount,
+                   const std::size_t /*byteSize*/)
+    {
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        // A fixed size memcpy is turned into plain (vector) register moves by the compiler
+        std::memcpy(pDst, pSrc, TByteSize);
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+
+    void CopyGeneric(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride, const std::size_t vertexCount,
+                     const std::size_t byteSize)
+    {
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(pDst, pSrc, byteSize);
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+
+    auto SelectCopyFunction(const uint32_t byteSize)
+    {
+      switch (byteSize)
+      {
+      case 4:
+        return &CopyFixed<4>;
+      case 8:
+        return &CopyFixed<8>;
+      case 12:
+        return &CopyFixed<12>;
+      case 16:
+        return &CopyFixed<16>;
+      case 20:
+        return &CopyFixed<20>;
+      case 24:
+        return &CopyFixed<24>;
+      case 28:
+        return &CopyFixed<28>;
+      case 32:
+        return &CopyFixed<32>;
+      default:
+        return &CopyGeneric;
+      }
+    }
+
+
+    int32_t IndexOf(VertexDeclarationSpan vertexDeclaration, const VertexElementUsage usage, const uint32_t usageIndex)
+    {
+      for (uint32_t i = 0; i < vertexDeclaration.Count(); ++i)
+      {
+        const VertexElement element = vertexDeclaration.At(i);
+        if (usage == element.Usage && usageIndex == element.UsageIndex)
+        {
+          return static_cast<int32_t>(i);
+        }
+      }
+      return -1;
+    }
+
+
+    //! @brief Check if the operation can be appended to the previous one as one larger copy
+    bool CanFuse(const VertexConversionPlan::Operation& prev, const VertexConversionPlan::Operation& op)
+    {
+      return prev.Type == op.Type && (prev.DstOffset + prev.ByteSize) == op.DstOffset && (prev.SrcOffset + prev.ByteSize) == op.SrcOffset;
+    }
+  }
+
+
+  VertexConversionPlan::VertexConversionPlan(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration)
+    : m_dstVertexStride(dstVertexDeclaration.VertexStride())
+    , m_srcVertexStride(srcVertexDeclaration.VertexStride())
+  {
+    std::vector<Operation> operations;
+    operations.reserve(dstVertexDeclaration.Count());
+    for (uint32_t i = 0; i < dstVertexDeclaration.Count(); ++i)
+    {
+      const VertexElement dstElement = dstVertexDeclaration.At(i);
+      const auto cbFormatEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
+      const int32_t srcIndex = IndexOf(srcVertexDeclaration, dstElement.Usage, dstElement.UsageIndex);
+      if (srcIndex >= 0)
+      {
+        const VertexElement srcElement = srcVertexDeclaration.At(static_cast<uint32_t>(srcIndex));
+        if (dstElement.Format != srcElement.Format)
+        {
+          // We need to do a format conversion
+          throw NotImplementedException("Element format conversion not implemented");
+        }
+        if ((srcElement.Offset + cbFormatEntry) > m_srcVertexStride)
+        {
+          throw std::invalid_argument("src element does not fit inside the src vertex");
+        }
+        operations.emplace_back(OperationType::Copy, dstElement.Offset, srcElement.Offset, cbFormatEntry);
+      }
+      else
+      {
+        // Not found, so assign the default value
+        operations.emplace_back(OperationType::Fill, dstElement.Offset, dstElement.Offset, cbFormatEntry);
+      }
+      if ((dstElement.Offset + cbFormatEntry) > m_dstVertexStride)
+      {
+        throw std::invalid_argument("dst element does not fit inside the dst vertex");
+      }
+    }
+
+    // The declarations are sorted by offset, but we sort anyway as the fusing relies on it
+    std::stable_sort(operations.begin(), operations.end(),
+                     [](const Operation& lhs, const Operation& rhs) { return lhs.DstOffset < rhs.DstOffset; });
+
+    m_operations.reserve(operations.size());
+    for (const Operation& op : operations)
+    {
+      if (!m_operations.empty() && CanFuse(m_operations.back(), op))
+      {
+        m_operations.back().ByteSize += op.ByteSize;
+      }
+      else
+      {
+        m_operations.push_back(op);
+      }
+    }
+
+    m_isStraightCopy = m_dstVertexStride == m_srcVertexStride && m_operations.size() == 1u && m_operations.front().Type == OperationType::Copy &&
+                       m_operations.front().DstOffset == 0u && m_operations.front().SrcOffset == 0u &&
+                       m_operations.front().ByteSize == m_dstVertexStride;
+
+    m_compiled.reserve(m_operations.size());
+    for (const Operation& op : m_operations)
+    {
+      m_compiled.push_back(
+        CompiledOperation{SelectCopyFunction(op.ByteSize), op.Type == OperationType::Fill, op.DstOffset, op.SrcOffset, op.ByteSize});
+    }
+  }
+
+
+  void VertexConversionPlan::Convert(void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                                     const std::size_t srcVertexCount, const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues) const
+  {
+    ValidateConvertArguments(pDst, cbDst, pSrc, cbSrc, srcVertexCount, pDstDefaultValues, cbDstDefaultValues);
+    DoConvert(static_cast<uint8_t*>(pDst), static_cast<const uint8_t*>(pSrc), srcVertexCount, static_cast<const uint8_t*>(pDstDefaultValues));
+  }
+
+
+  void VertexConversionPlan::Convert(JobSystem& jobSystem, void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                                     const std::size_t srcVertexCount, const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues) const
+  {
+    ValidateConvertArguments(pDst, cbDst, pSrc, cbSrc, srcVertexCount, pDstDefaultValues, cbDstDefaultValues);
+
+    auto* const pDstVertices = static_cast<uint8_t*>(pDst);
+    const auto* const pSrcVertices = static_cast<const uint8_t*>(pSrc);
+    const auto* const pDefaultValues = static_cast<const uint8_t*>(pDstDefaultValues);
+    jobSystem.ParallelForRange(srcVertexCount, LocalConfig::MinParallelVertexCount,
+                               [this, pDstVertices, pSrcVertices, pDefaultValues](const std::size_t offset, const std::size_t count)
+                               {
+                                 DoConvert(pDstVertices + (offset * m_dstVertexStride), pSrcVertices + (offset * m_srcVertexStride), count,
+                                           pDefaultValues);
+                               });
+  }
+
+
+  void VertexConversionPlan::ValidateConvertArguments(const void* const pDst, const std::size_t cbDst, const void* const pSrc,
+                                                      const std::size_t cbSrc, const std::size_t srcVertexCount, const void* const pDstDefaultValues,
+                                                      const uint32_t cbDstDefaultValues) const
+  {
+    if (pDst == nullptr || pSrc == nullptr || pDstDefaultValues == nullptr || cbDstDefaultValues < m_dstVertexStride)
+    {
+      throw std::invalid_argument("invalid argument");
+    }
+
+    // Verify that we have room for the elements
+    const auto cbDstEntries = m_dstVertexStride * srcVertexCount;
+    const auto cbSrcEntries = m_srcVertexStride * srcVertexCount;
+    if (cbSrc < cbSrcEntries)
+    {
+      throw std::invalid_argument("out of bounds. pSrc does not hold the intended number of elements");
+    }
+    if (cbDst < cbDstEntries)
+    {
+      throw std::invalid_argument("out of bounds. pDst can not hold the intended number of elements");
+    }
+  }
+
+
+  void VertexConversionPlan::DoConvert(uint8_t* const pDst, const uint8_t* const pSrc, const std::size_t vertexCount,
+                                       const uint8_t* const pDstDefaultValues) const
+  {
+    if (m_isStraightCopy)
+    {
+      std::memcpy(pDst, pSrc, vertexCount * m_dstVertexStride);
+      return;
+    }
+
+    const std::size_t dstStride = m_dstVertexStride;
+    const std::size_t srcStride = m_srcVertexStride;
+    for (std::size_t blockStart = 0; blockStart < vertexCount; blockStart += LocalConfig::BlockVertexCount)
+    {
+      const std::size_t blockCount = std::min(LocalConfig::BlockVertexCount, vertexCount - blockStart);
+      uint8_t* const pDstBlock = pDst + (blockStart * dstStride);
+      const uint8_t* const pSrcBlock = pSrc + (blockStart * srcStride);
+      for (const CompiledOperation& op : m_compiled)
+      {
+        assert(op.FnCopy != nullptr);
+        if (!op.IsFill)
+        {
+          op.FnCopy(pDstBlock + op.DstOffset, dstStride, pSrcBlock + op.SrcOffset, srcStride, blockCount, op.ByteSize);
+        }
+        else
+        {
+          op.FnCopy(pDstBlock + op.DstOffset, dstStride, pDstDefaultValues + op.SrcOffset, 0u, blockCount, op.ByteSize);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Vertices/VertexConversionPlanCache.hpp>
+
+namespace Fsl
+{
+  VertexConversionPlanCache::VertexConversionPlanCache() = default;
+  VertexConversionPlanCache::~VertexConversionPlanCache() = default;
+
+
+  std::shared_ptr<const VertexConversionPlan> VertexConversionPlanCache::GetPlan(VertexDeclarationSpan dstVertexDeclaration,
+                                                                                 VertexDeclarationSpan srcVertexDeclaration)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Record& record : m_records)
+    {
+      if (record.Dst.AsSpan() == dstVertexDeclaration && record.Src.AsSpan() == srcVertexDeclaration)
+      {
+        return record.Plan;
+      }
+    }
+
+    // The plan constructor throws on unsupported conversions, so nothing is cached for them
+    auto plan = std::make_shared<const VertexConversionPlan>(dstVertexDeclaration, srcVertexDeclaration);
+    m_records.push_back(Record{VertexDeclaration(dstVertexDeclaration), VertexDeclaration(srcVertexDeclaration), plan});
+    return plan;
+  }
+
+
+  std::size_t VertexConversionPlanCache::Count() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records.size();
+  }
+
+
+  void VertexConversionPlanCache::Clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.clear();
+  }
+}
@@ -30,41 +30,28 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlanCache.hpp>
 #include <FslGraphics/Vertices/VertexConverter.hpp>
-#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
-#include <cassert>
 #include <cstring>
-#include <limits>
+#include <memory>
 
 namespace Fsl
 {
   namespace
   {
-    int32_t IndexOf(VertexDeclarationSpan vertexDeclaration, const VertexElementUsage usage, const std::size_t usageIndex)
+    VertexConversionPlanCache& GetPlanCache()
     {
-      for (std::size_t i = 0; i < vertexDeclaration.Count(); ++i)
-      {
-        const VertexElement element = vertexDeclaration.At(i);
-        if (usage == element.Usage && usageIndex == element.UsageIndex)
-        {
-          static_assert(static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) < std::numeric_limits<std::size_t>::max(),
-                        "std::size assumptions are wrong");
-          assert(i <= static_cast<std::size_t>(std::numeric_limits<int32_t>::max()));
-          return static_cast<int32_t>(i);
-        }
-      }
-      return -1;
+      static VertexConversionPlanCache g_planCache;
+      return g_planCache;
     }
   }
 
+
   void VertexConverter::GenericConvert(void* const pDst, const std::size_t cbDst, VertexDeclarationSpan dstVertexDeclaration, const void* const pSrc,
                                        const std::size_t cbSrc, VertexDeclarationSpan srcVertexDeclaration, const std::size_t srcVertexCount,
                                        const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues)
   {
-    const uint32_t srcVertexStride = srcVertexDeclaration.VertexStride();
-    const uint32_t dstVertexStride = dstVertexDeclaration.VertexStride();
-
-    if (pDst == nullptr || pSrc == nullptr || pDstDefaultValues == nullptr || cbDstDefaultValues < dstVertexStride)
+    if (pDst == nullptr || pSrc == nullptr || pDstDefaultValues == nullptr || cbDstDefaultValues < dstVertexDeclaration.VertexStride())
     {
       throw std::invalid_argument("invalid argument");
     }
@@ -74,49 +61,8 @@ namespace Fsl
       return;
     }
 
-    // Verify that we have room for the elements
-    const auto cbDstEntries = dstVertexStride * srcVertexCount;
-    const auto cbSrcEntries = srcVertexStride * srcVertexCount;
-    if (cbSrc < cbSrcEntries)
-    {
-      throw std::invalid_argument("out of bounds. pSrc does not hold the intended number of elements");
-    }
-    if (cbDst < cbDstEntries)
-    {
-      throw std::invalid_argument("out of bounds. pDst can not hold the intended number of elements");
-    }
-
-
-    for (std::size_t i = 0; i < dstVertexDeclaration.Count(); ++i)
-    {
-      const VertexElement dstElement = dstVertexDeclaration.At(i);
-      const int32_t srcIndex = IndexOf(srcVertexDeclaration, dstElement.Usage, dstElement.UsageIndex);
-      if (srcIndex >= 0)
-      {
-        const VertexElement srcElement = srcVertexDeclaration.At(static_cast<uint32_t>(srcIndex));
-
-        // We found it so now we just need to look at the format
-        if (dstElement.Format == srcElement.Format)
-        {
-          // Straight forward copy
-          const auto cbFormatEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
-          VertexConverter::GenericElementCopy(pDst, cbDst, dstVertexStride, dstElement.Offset, pSrc, cbSrc, srcVertexStride, srcElement.Offset,
-                                              cbFormatEntry, srcVertexCount);
-        }
-        else
-        {
-          // We need to do a format conversion
-          throw NotImplementedException("Element format conversion not implemented");
-        }
-      }
-      else
-      {
-        // Not found, so assign the default value
-        const auto cbFormatEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
-        VertexConverter::GenericElementFill(pDst, cbDst, dstVertexStride, dstElement.Offset, pDstDefaultValues, cbDstDefaultValues, dstElement.Offset,
-                                            cbFormatEntry, srcVertexCount);
-      }
-    }
+    const std::shared_ptr<const VertexConversionPlan> plan = GetPlanCache().GetPlan(dstVertexDeclaration, srcVertexDeclaration);
+    plan->Convert(pDst, cbDst, pSrc, cbSrc, srcVertexCount, pDstDefaultValues, cbDstDefaultValues);
   }
 
 
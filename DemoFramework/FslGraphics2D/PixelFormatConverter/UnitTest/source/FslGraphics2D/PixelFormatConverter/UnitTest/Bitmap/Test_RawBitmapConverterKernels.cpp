@@ -0,0 +1,358 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverter.hpp>
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include "UnitTestRawBitmapHelper.hpp"
+
+using namespace Fsl;
+
+namespace
+{
+  using TestBitmap_RawBitmapConverterKernels = TestFixtureFslGraphics;
+
+  constexpr std::array<FslGraphics2D::RawBitmapConverterInstructionSet, 4> AllInstructionSets = {
+    FslGraphics2D::RawBitmapConverterInstructionSet::Scalar, FslGraphics2D::RawBitmapConverterInstructionSet::SSE4_1,
+    FslGraphics2D::RawBitmapConverterInstructionSet::AVX2, FslGraphics2D::RawBitmapConverterInstructionSet::NEON};
+
+  class ScopedInstructionSet
+  {
+    FslGraphics2D::RawBitmapConverterInstructionSet m_restore;
+
+  public:
+    explicit ScopedInstructionSet(const FslGraphics2D::RawBitmapConverterInstructionSet instructionSet)
+      : m_restore(FslGraphics2D::RawBitmapConverterFunctions::GetInstructionSet())
+    {
+      FslGraphics2D::RawBitmapConverterFunctions::SetInstructionSet(instructionSet);
+    }
+
+    ~ScopedInstructionSet()
+    {
+      FslGraphics2D::RawBitmapConverterFunctions::SetInstructionSet(m_restore);
+    }
+  };
+
+  struct TestBitmap
+  {
+    std::vector<uint8_t> Content;
+    PxSize2D Size;
+    PixelFormat Format{PixelFormat::Undefined};
+    uint32_t Stride{0};
+
+    TestBitmap(const PxSize2D size, const PixelFormat pixelFormat, const uint32_t stride)
+      : Content(static_cast<std::size_t>(size.RawUnsignedHeight()) * stride, 0xCD)
+      , Size(size)
+      , Format(pixelFormat)
+      , Stride(stride)
+    {
+    }
+
+    RawBitmapEx AsRawBitmap()
+    {
+      return RawBitmapEx::Create(SpanUtil::AsSpan(Content), Size, Format, Stride, BitmapOrigin::UpperLeft);
+    }
+
+    ReadOnlyRawBitmap AsReadOnlyRawBitmap() const
+    {
+      return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(Content), Size, Format, Stride, BitmapOrigin::UpperLeft);
+    }
+  };
+
+  uint32_t CalcPaddedStride(const PxSize2D size, const PixelFormat pixelFormat)
+  {
+    // Add some padding to ensure we respect the stride
+    return PixelFormatUtil::CalcMinimumStride(size.Width(), pixelFormat) + 16u;
+  }
+
+  float NextFloat(std::mt19937& rRandom)
+  {
+    // Mostly values in the 0-1 range, but also some outside the range and special values (NaN is not tested as its undefined)
+    constexpr std::array<float, 8> SpecialValues = {0.0f, -0.0f, 1.0f, 1e-8f, 0.0031308f, std::numeric_limits<float>::infinity(),
+                                                    -std::numeric_limits<float>::infinity(), 65504.0f};
+    std::uniform_int_distribution<uint32_t> selectDist(0, 31);
+    const uint32_t select = selectDist(rRandom);
+    if (select < SpecialValues.size())
+    {
+      return SpecialValues[select];
+    }
+    std::uniform_real_distribution<float> valueDist(-0.25f, 1.25f);
+    return valueDist(rRandom);
+  }
+
+  TestBitmap CreateRandomBitmap(const PxSize2D size, const PixelFormat pixelFormat, const uint32_t seed)
+  {
+    TestBitmap bitmap(size, pixelFormat, CalcPaddedStride(size, pixelFormat));
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<uint32_t> byteDist(0, 0xFFFF);
+    const uint32_t channelCount = PixelFormatUtil::GetChannelCount(pixelFormat);
+    const uint32_t channelsWidth = size.RawUnsignedWidth() * channelCount;
+    for (uint32_t y = 0; y < size.RawUnsignedHeight(); ++y)
+    {
+      uint8_t* const pRow = bitmap.Content.data() + (static_cast<std::size_t>(y) * bitmap.Stride);
+      for (uint32_t x = 0; x < channelsWidth; ++x)
+      {
+        switch (pixelFormat)
+        {
+        case PixelFormat::R8G8B8_SRGB:
+        case PixelFormat::R8G8B8A8_SRGB:
+          pRow[x] = static_cast<uint8_t>(byteDist(random));
+          break;
+        case PixelFormat::R16G16B16_UNORM:
+        case PixelFormat::R16G16B16A16_UNORM:
+          {
+            const auto value = static_cast<uint16_t>(byteDist(random));
+            std::memcpy(pRow + (x * sizeof(uint16_t)), &value, sizeof(uint16_t));
+            break;
+          }
+        case PixelFormat::R16G16B16_SFLOAT:
+        case PixelFormat::R16G16B16A16_SFLOAT:
+          {
+            const uint16_t value = UnitTestRawBitmapHelper::ConvertLinearFloatToLinearFp16(NextFloat(random));
+            std::memcpy(pRow + (x * sizeof(uint16_t)), &value, sizeof(uint16_t));
+            break;
+          }
+        case PixelFormat::R32G32B32_SFLOAT:
+        case PixelFormat::R32G32B32A32_SFLOAT:
+          {
+            const float value = NextFloat(random);
+            std::memcpy(pRow + (x * sizeof(float)), &value, sizeof(float));
+            break;
+          }
+        default:
+          throw NotSupportedException("Unsupported pixel format");
+        }
+      }
+    }
+    return bitmap;
+  }
+
+  //! Compare the pixel content (ignoring the stride padding)
+  void ExpectEqualPixels(const ReadOnlyRawBitmap& expected, const ReadOnlyRawBitmap& actual, const SupportedConversion conversion)
+  {
+    ASSERT_EQ(expected.GetSize(), actual.GetSize());
+    ASSERT_EQ(expected.GetPixelFormat(), actual.GetPixelFormat());
+    const uint32_t rowBytes = PixelFormatUtil::CalcMinimumStride(expected.Width(), expected.GetPixelFormat());
+    for (uint32_t y = 0; y < expected.RawUnsignedHeight(); ++y)
+    {
+      const auto* const pExpected = static_cast<const uint8_t*>(expected.Content()) + (static_cast<std::size_t>(y) * expected.Stride());
+      const auto* const pActual = static_cast<const uint8_t*>(actual.Content()) + (static_cast<std::size_t>(y) * actual.Stride());
+      ASSERT_EQ(0, std::memcmp(pExpected, pActual, rowBytes))
+        << "Row " << y << " differs for conversion " << static_cast<uint32_t>(conversion.From) << " -> " << static_cast<uint32_t>(conversion.To);
+    }
+  }
+
+  TestBitmap ConvertUsingScalar(const TestBitmap& srcBitmap, const PixelFormat dstPixelFormat)
+  {
+    ScopedInstructionSet scopedInstructionSet(FslGraphics2D::RawBitmapConverterInstructionSet::Scalar);
+    TestBitmap dstBitmap(srcBitmap.Size, dstPixelFormat, CalcPaddedStride(srcBitmap.Size, dstPixelFormat));
+    EXPECT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsReadOnlyRawBitmap()));
+    return dstBitmap;
+  }
+
+  bool IsInplaceSupported(const SupportedConversion conversion)
+  {
+    return PixelFormatUtil::GetBytesPerPixel(conversion.From) >= PixelFormatUtil::GetBytesPerPixel(conversion.To);
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST(TestBitmap_RawBitmapConverterKernels, InstructionSet_Default)
+{
+  EXPECT_TRUE(FslGraphics2D::RawBitmapConverterFunctions::IsInstructionSetSupported(FslGraphics2D::RawBitmapConverterInstructionSet::Scalar));
+  const auto bestInstructionSet = FslGraphics2D::RawBitmapConverterFunctions::GetBestInstructionSet();
+  EXPECT_TRUE(FslGraphics2D::RawBitmapConverterFunctions::IsInstructionSetSupported(bestInstructionSet));
+  EXPECT_EQ(bestInstructionSet, FslGraphics2D::RawBitmapConverterFunctions::GetInstructionSet());
+}
+
+
+TEST(TestBitmap_RawBitmapConverterKernels, SetInstructionSet)
+{
+  for (const auto instructionSet : AllInstructionSets)
+  {
+    if (FslGraphics2D::RawBitmapConverterFunctions::IsInstructionSetSupported(instructionSet))
+    {
+      ScopedInstructionSet scopedInstructionSet(instructionSet);
+      EXPECT_EQ(instructionSet, FslGraphics2D::RawBitmapConverterFunctions::GetInstructionSet());
+    }
+    else
+    {
+      EXPECT_THROW(FslGraphics2D::RawBitmapConverterFunctions::SetInstructionSet(instructionSet), NotSupportedException);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST(TestBitmap_RawBitmapConverterKernels, AllInstructionSets_MatchScalar)
+{
+  // A width that exercises both the vector loops and the scalar tails as well as multiple chunks
+  const PxSize2D size = PxSize2D::Create(141, 3);
+  uint32_t seed = 1;
+  for (const SupportedConversion conversion : FslGraphics2D::RawBitmapConverter::GetSupportedConversions())
+  {
+    const TestBitmap srcBitmap = CreateRandomBitmap(size, conversion.From, seed++);
+    const TestBitmap expectedBitmap = ConvertUsingScalar(srcBitmap, conversion.To);
+
+    for (const auto instructionSet : AllInstructionSets)
+    {
+      if (!FslGraphics2D::RawBitmapConverterFunctions::IsInstructionSetSupported(instructionSet))
+      {
+        continue;
+      }
+      ScopedInstructionSet scopedInstructionSet(instructionSet);
+      TestBitmap dstBitmap(size, conversion.To, CalcPaddedStride(size, conversion.To));
+      ASSERT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsReadOnlyRawBitmap()));
+      ExpectEqualPixels(expectedBitmap.AsReadOnlyRawBitmap(), dstBitmap.AsReadOnlyRawBitmap(), conversion);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapConverterKernels, AllInstructionSets_Inplace_MatchScalar)
+{
+  const PxSize2D size = PxSize2D::Create(141, 3);
+  uint32_t seed = 100;
+  for (const SupportedConversion conversion : FslGraphics2D::RawBitmapConverter::GetSupportedConversions())
+  {
+    if (!IsInplaceSupported(conversion))
+    {
+      continue;
+    }
+    const TestBitmap srcBitmap = CreateRandomBitmap(size, conversion.From, seed++);
+    const TestBitmap expectedBitmap = ConvertUsingScalar(srcBitmap, conversion.To);
+
+    for (const auto instructionSet : AllInstructionSets)
+    {
+      if (!FslGraphics2D::RawBitmapConverterFunctions::IsInstructionSetSupported(instructionSet))
+      {
+        continue;
+      }
+      ScopedInstructionSet scopedInstructionSet(instructionSet);
+
+      // Tightly packed destination rows inside the source buffer
+      TestBitmap bitmap = srcBitmap;
+      const uint32_t dstStride = PixelFormatUtil::CalcMinimumStride(size.Width(), conversion.To);
+      auto dstBitmap = RawBitmapEx::Create(SpanUtil::AsSpan(bitmap.Content), size, conversion.To, dstStride, BitmapOrigin::UpperLeft);
+      ASSERT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap, bitmap.AsReadOnlyRawBitmap()));
+      ExpectEqualPixels(expectedBitmap.AsReadOnlyRawBitmap(), dstBitmap, conversion);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST(TestBitmap_RawBitmapConverterKernels, TryTransform_JobSystem_MatchScalar)
+{
+  JobSystem jobSystem(3u);
+  // Tall enough to be split into multiple bands
+  const PxSize2D size = PxSize2D::Create(517, 300);
+  uint32_t seed = 200;
+  for (const SupportedConversion conversion : FslGraphics2D::RawBitmapConverter::GetSupportedConversions())
+  {
+    const TestBitmap srcBitmap = CreateRandomBitmap(size, conversion.From, seed++);
+    const TestBitmap expectedBitmap = ConvertUsingScalar(srcBitmap, conversion.To);
+
+    TestBitmap dstBitmap(size, conversion.To, CalcPaddedStride(size, conversion.To));
+    ASSERT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsReadOnlyRawBitmap(), jobSystem));
+    ExpectEqualPixels(expectedBitmap.AsReadOnlyRawBitmap(), dstBitmap.AsReadOnlyRawBitmap(), conversion);
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapConverterKernels, TryTransform_JobSystem_Inplace_MatchScalar)
+{
+  JobSystem jobSystem(3u);
+  const PxSize2D size = PxSize2D::Create(517, 300);
+  uint32_t seed = 300;
+  for (const SupportedConversion conversion : FslGraphics2D::RawBitmapConverter::GetSupportedConversions())
+  {
+    if (!IsInplaceSupported(conversion))
+    {
+      continue;
+    }
+    const TestBitmap srcBitmap = CreateRandomBitmap(size, conversion.From, seed++);
+    const TestBitmap expectedBitmap = ConvertUsingScalar(srcBitmap, conversion.To);
+
+    // Same stride (converted in parallel)
+    {
+      TestBitmap bitmap = srcBitmap;
+      auto dstBitmap = RawBitmapEx::Create(SpanUtil::AsSpan(bitmap.Content), size, conversion.To, bitmap.Stride, BitmapOrigin::UpperLeft);
+      ASSERT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap, bitmap.AsReadOnlyRawBitmap(), jobSystem));
+      ExpectEqualPixels(expectedBitmap.AsReadOnlyRawBitmap(), dstBitmap, conversion);
+    }
+    // Tightly packed destination (rows depend on each other)
+    {
+      TestBitmap bitmap = srcBitmap;
+      const uint32_t dstStride = PixelFormatUtil::CalcMinimumStride(size.Width(), conversion.To);
+      auto dstBitmap = RawBitmapEx::Create(SpanUtil::AsSpan(bitmap.Content), size, conversion.To, dstStride, BitmapOrigin::UpperLeft);
+      ASSERT_TRUE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap, bitmap.AsReadOnlyRawBitmap(), jobSystem));
+      ExpectEqualPixels(expectedBitmap.AsReadOnlyRawBitmap(), dstBitmap, conversion);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapConverterKernels, TryTransform_JobSystem_Unsupported)
+{
+  JobSystem jobSystem(1u);
+  const PxSize2D size = PxSize2D::Create(4, 4);
+  TestBitmap srcBitmap(size, PixelFormat::R8G8B8_SRGB, CalcPaddedStride(size, PixelFormat::R8G8B8_SRGB));
+  TestBitmap dstBitmap(size, PixelFormat::R8G8B8A8_SRGB, CalcPaddedStride(size, PixelFormat::R8G8B8A8_SRGB));
+  EXPECT_FALSE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsReadOnlyRawBitmap(), jobSystem));
+}
+
+
+TEST(TestBitmap_RawBitmapConverterKernels, TryTransform_JobSystem_Unsupported_HalfFloat)
+{
+  JobSystem jobSystem(3u);
+  // Tall enough to be split into multiple bands
+  const PxSize2D size = PxSize2D::Create(517, 300);
+  TestBitmap srcBitmap(size, PixelFormat::R16G16B16A16_SFLOAT, CalcPaddedStride(size, PixelFormat::R16G16B16A16_SFLOAT));
+  TestBitmap dstBitmap(size, PixelFormat::R8G8B8A8_UNORM, CalcPaddedStride(size, PixelFormat::R8G8B8A8_UNORM));
+  EXPECT_FALSE(FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsReadOnlyRawBitmap(), jobSystem));
+
+  // Same stride inplace conversion is also split into bands
+  TestBitmap bitmap(size, PixelFormat::R16G16B16A16_SFLOAT, CalcPaddedStride(size, PixelFormat::R16G16B16A16_SFLOAT));
+  auto inplaceDstBitmap =
+    RawBitmapEx::Create(SpanUtil::AsSpan(bitmap.Content), size, PixelFormat::R16G16B16A16_UNORM, bitmap.Stride, BitmapOrigin::UpperLeft);
+  EXPECT_FALSE(FslGraphics2D::RawBitmapConverter::TryTransform(inplaceDstBitmap, bitmap.AsReadOnlyRawBitmap(), jobSystem));
+}
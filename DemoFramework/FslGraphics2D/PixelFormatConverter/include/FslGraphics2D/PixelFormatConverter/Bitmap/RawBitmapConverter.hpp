@@ -36,6 +36,11 @@
 #include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
 #include <FslGraphics/Bitmap/SupportedConversion.hpp>
 
+namespace Fsl
+{
+  class JobSystem;
+}
+
 namespace Fsl::FslGraphics2D::RawBitmapConverter
 {
   ReadOnlySpan<SupportedConversion> GetSupportedConversions() noexcept;
@@ -45,6 +50,13 @@ namespace Fsl::FslGraphics2D::RawBitmapConverter
   //! @param srcBitmap The raw bitmap to convert.
   //! @param dstBitmap The raw bitmap to write to.
   bool TryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept;
+
+  //! @brief Try to perform the requested pixel format conversion using the job system to convert bands of rows in parallel.
+  //! @param srcBitmap The raw bitmap to convert.
+  //! @param dstBitmap The raw bitmap to write to.
+  //! @param rJobSystem The job system used to convert the bitmap (the calling thread participates).
+  //! @note Small bitmaps and inplace conversions that change the stride are converted on the calling thread.
+  bool TryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, JobSystem& rJobSystem) noexcept;
 }
 
 #endif
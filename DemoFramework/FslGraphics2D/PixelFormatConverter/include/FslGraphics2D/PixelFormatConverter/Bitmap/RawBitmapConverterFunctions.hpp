@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterInstructionSet.hpp>
 
 namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 {
@@ -46,6 +47,20 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
   //! This allow inplace modification to occur by processing from the first pixel in the bitmap moving towards the last.
   bool IsSafeInplaceModificationOrNoMemoryOverlap(const RawBitmapEx& dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept;
 
+  //! @brief Get the best instruction set supported by the CPU we are running on (this is used by default).
+  RawBitmapConverterInstructionSet GetBestInstructionSet() noexcept;
+
+  //! @brief Get the instruction set used by the conversion functions.
+  RawBitmapConverterInstructionSet GetInstructionSet() noexcept;
+
+  //! @brief Check if the instruction set is available in this build and supported by the CPU we are running on.
+  bool IsInstructionSetSupported(const RawBitmapConverterInstructionSet instructionSet) noexcept;
+
+  //! @brief Select the instruction set used by the conversion functions (this is a global setting).
+  //! @note  All instruction sets produce the exact same result, so this is mainly useful for benchmarks and tests.
+  //! @throws NotSupportedException if the instruction set is not supported.
+  void SetInstructionSet(const RawBitmapConverterInstructionSet instructionSet);
+
   //! @brief Convert SRGB R8G8B8 to linear R16G16B16  (stored as a uint16 per channel).
   //! @param dstBitmap The raw bitmap to write to. Must be PixelFormat::R16G16B16_UNORM.
   //! @param srcBitmap The raw bitmap to convert. Must be PixelFormat::R8G8B8_SRGB
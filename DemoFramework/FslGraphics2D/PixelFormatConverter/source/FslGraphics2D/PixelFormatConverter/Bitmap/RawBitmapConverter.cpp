@@ -30,15 +30,24 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
 #include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverter.hpp>
 #include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
+#include <algorithm>
 #include <array>
+#include <atomic>
 
 namespace Fsl::FslGraphics2D::RawBitmapConverter
 {
   namespace
   {
+    namespace LocalConfig
+    {
+      //! The minimum amount of source bitmap bytes converted by one job
+      constexpr uint32_t MinBatchBytes = 128 * 1024;
+    }
+
     constexpr std::array<SupportedConversion, 27> SupportedConversions = {
       SupportedConversion(PixelFormat::R8G8B8_SRGB, PixelFormat::R16G16B16_UNORM),
       SupportedConversion(PixelFormat::R8G8B8_SRGB, PixelFormat::R16G16B16_SFLOAT),
@@ -121,7 +130,6 @@ namespace Fsl::FslGraphics2D::RawBitmapConverter
       }
     }
 
-
     bool UncheckedTryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
     {
       // We support the 'reverse' of the src format conversions also
@@ -222,149 +230,217 @@ namespace Fsl::FslGraphics2D::RawBitmapConverter
       }
       return false;
     }
-  }
-
-
-  ReadOnlySpan<SupportedConversion> GetSupportedConversions() noexcept
-  {
-    return SpanUtil::AsReadOnlySpan(SupportedConversions);
-  }
-
 
-  bool TryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
-  {
-    if (dstBitmap.GetOrigin() != srcBitmap.GetOrigin())
+    bool IsValidTransform(const RawBitmapEx& dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
     {
-      // We only support conversion between the same bitmap origins
-      return false;
-    }
-    if (dstBitmap.GetSize() != srcBitmap.GetSize())
-    {
-      // We only support conversion between the same bitmap sizes
-      return false;
+      if (dstBitmap.GetOrigin() != srcBitmap.GetOrigin())
+      {
+        // We only support conversion between the same bitmap origins
+        return false;
+      }
+      if (dstBitmap.GetSize() != srcBitmap.GetSize())
+      {
+        // We only support conversion between the same bitmap sizes
+        return false;
+      }
+      // We only support converting between bitmaps that obeys the above rules
+      return RawBitmapConverterFunctions::IsSafeInplaceModificationOrNoMemoryOverlap(dstBitmap, srcBitmap);
     }
-    if (!RawBitmapConverterFunctions::IsSafeInplaceModificationOrNoMemoryOverlap(dstBitmap, srcBitmap))
+
+    bool IsSupportedConversion(const PixelFormat srcPixelFormat, const PixelFormat dstPixelFormat) noexcept
     {
-      // We only support converting between bitmaps that obeys the above rules
-      return false;
+      return std::find(SupportedConversions.begin(), SupportedConversions.end(), SupportedConversion(srcPixelFormat, dstPixelFormat)) !=
+             SupportedConversions.end();
     }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R8G8B8_SRGB)
+    bool UncheckedTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
     {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R8G8B8_SRGB)
       {
-      case PixelFormat::R16G16B16_UNORM:
-        RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16UNorm(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R16G16B16_SFLOAT:
-        UncheckedR8G8B8SrgbToR16G16B16Float(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R32G32B32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR32G32B32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R16G16B16_UNORM:
+          RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16UNorm(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R16G16B16_SFLOAT:
+          UncheckedR8G8B8SrgbToR16G16B16Float(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R32G32B32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR32G32B32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R8G8B8A8_SRGB)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R8G8B8A8_SRGB)
       {
-      case PixelFormat::R16G16B16A16_UNORM:
-        RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R16G16B16A16_SFLOAT:
-        UncheckedR8G8B8A8SrgbToR16G16B16A16Float(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R32G32B32A32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR32G32B32A32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R16G16B16A16_UNORM:
+          RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R16G16B16A16_SFLOAT:
+          UncheckedR8G8B8A8SrgbToR16G16B16A16Float(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R32G32B32A32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR32G32B32A32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16_SFLOAT)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16_SFLOAT)
       {
-      case PixelFormat::R32G32B32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR16G16B16FloatToR32G32B32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R32G32B32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR16G16B16FloatToR32G32B32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16_UNORM)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16_UNORM)
       {
-      case PixelFormat::R32G32B32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR16G16B16UNormToR32G32B32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R32G32B32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR16G16B16UNormToR32G32B32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_SFLOAT)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_SFLOAT)
       {
-      case PixelFormat::R32G32B32A32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR16G16B16A16FloatToR32G32B32A32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R32G32B32A32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR16G16B16A16FloatToR32G32B32A32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_UNORM)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_UNORM)
       {
-      case PixelFormat::R32G32B32A32_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR16G16B16A16UNormToR32G32B32A32Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R32G32B32A32_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR16G16B16A16UNormToR32G32B32A32Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32_SFLOAT)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32_SFLOAT)
       {
-      case PixelFormat::R16G16B16_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16Float(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R16G16B16_UNORM:
-        RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16UNorm(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R16G16B16A16_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16A16Float(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R16G16B16_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16Float(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R16G16B16_UNORM:
+          RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16UNorm(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R16G16B16A16_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16A16Float(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
-    }
 
-    if (srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32A32_SFLOAT)
-    {
-      switch (dstBitmap.GetPixelFormat())
+      if (srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32A32_SFLOAT)
       {
-      case PixelFormat::R16G16B16A16_SFLOAT:
-        RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16Float(dstBitmap, srcBitmap);
-        return true;
-      case PixelFormat::R16G16B16A16_UNORM:
-        RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16UNorm(dstBitmap, srcBitmap);
-        return true;
-      default:
-        break;
+        switch (dstBitmap.GetPixelFormat())
+        {
+        case PixelFormat::R16G16B16A16_SFLOAT:
+          RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16Float(dstBitmap, srcBitmap);
+          return true;
+        case PixelFormat::R16G16B16A16_UNORM:
+          RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16UNorm(dstBitmap, srcBitmap);
+          return true;
+        default:
+          break;
+        }
       }
+      return UncheckedTryTransform(dstBitmap, srcBitmap);
+    }
+
+    RawBitmapEx UncheckedCreateRowBand(RawBitmapEx bitmap, const uint32_t firstRow, const uint32_t rowCount) noexcept
+    {
+      auto* const pContent = static_cast<uint8_t*>(bitmap.Content()) + (static_cast<std::size_t>(firstRow) * bitmap.Stride());
+      return RawBitmapEx::UncheckedCreate(pContent, rowCount * bitmap.Stride(), PxSize2D::Create(bitmap.RawUnsignedWidth(), rowCount),
+                                          bitmap.GetPixelFormat(), bitmap.Stride(), bitmap.GetOrigin());
+    }
+
+    ReadOnlyRawBitmap UncheckedCreateRowBand(const ReadOnlyRawBitmap& bitmap, const uint32_t firstRow, const uint32_t rowCount) noexcept
+    {
+      const auto* const pContent = static_cast<const uint8_t*>(bitmap.Content()) + (static_cast<std::size_t>(firstRow) * bitmap.Stride());
+      return ReadOnlyRawBitmap::UncheckedCreate(pContent, rowCount * bitmap.Stride(), PxSize2D::Create(bitmap.RawUnsignedWidth(), rowCount),
+                                                bitmap.GetPixelFormat(), bitmap.Stride(), bitmap.GetOrigin());
+    }
+  }
+
+
+  ReadOnlySpan<SupportedConversion> GetSupportedConversions() noexcept
+  {
+    return SpanUtil::AsReadOnlySpan(SupportedConversions);
+  }
+
+
+  bool TryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
+  {
+    return IsValidTransform(dstBitmap, srcBitmap) && UncheckedTransform(dstBitmap, srcBitmap);
+  }
+
+
+  bool TryTransform(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, JobSystem& rJobSystem) noexcept
+  {
+    if (!IsValidTransform(dstBitmap, srcBitmap) || !IsSupportedConversion(srcBitmap.GetPixelFormat(), dstBitmap.GetPixelFormat()))
+    {
+      return false;
+    }
+
+    // A inplace conversion that changes the stride writes into source rows that belong to the previous band,
+    // so the bands are only independent if there is no overlap or if the stride is unchanged.
+    const bool independentRows = !RawBitmapConverterFunctions::DoesMemoryRegionOverlap(dstBitmap, srcBitmap) ||
+                                 srcBitmap.Stride() == dstBitmap.Stride();
+    const uint32_t height = srcBitmap.RawUnsignedHeight();
+    const uint32_t minBatchRows = std::max(LocalConfig::MinBatchBytes / std::max(srcBitmap.Stride(), 1u), 1u);
+    if (!independentRows || height < (minBatchRows * 2u) || rJobSystem.GetConcurrency() <= 1u)
+    {
+      return UncheckedTransform(dstBitmap, srcBitmap);
+    }
+
+    try
+    {
+      // Every band runs the same conversion, but a band failing must still be reported as a failed transform
+      std::atomic<bool> bandFailed{false};
+      rJobSystem.ParallelForRange(height, minBatchRows,
+                                  [dstBitmap, &srcBitmap, &bandFailed](const std::size_t firstRow, const std::size_t rowCount)
+                                  {
+                                    const auto first = static_cast<uint32_t>(firstRow);
+                                    const auto count = static_cast<uint32_t>(rowCount);
+                                    if (!UncheckedTransform(UncheckedCreateRowBand(dstBitmap, first, count),
+                                                            UncheckedCreateRowBand(srcBitmap, first, count)))
+                                    {
+                                      bandFailed.store(true, std::memory_order_relaxed);
+                                    }
+                                  });
+      return !bandFailed.load(std::memory_order_relaxed);
+    }
+    catch (const std::exception&)
+    {
+      // Scheduling failed, the content of the dstBitmap is undefined
+      return false;
     }
-    return UncheckedTryTransform(dstBitmap, srcBitmap);
   }
 }
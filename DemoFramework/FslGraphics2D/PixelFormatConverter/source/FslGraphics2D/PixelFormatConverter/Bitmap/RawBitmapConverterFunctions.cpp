@@ -29,150 +29,210 @@
  *
  ****************************************************************************************************************************************************/
 
-#include <FslBase/Math/MathHelper_Clamp.hpp>
+#include <FslBase/Exceptions.hpp>
 #include <FslGraphics/Bitmap/UncheckedRawBitmapTransformer.hpp>
-#include <FslGraphics/ColorChannelConverter.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
 #include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
-#include <half.hpp>
+#include <algorithm>
+#include <array>
 #include <cassert>
-#include <cmath>
 #include <limits>
+#include "RawBitmapConverterKernels.hpp"
 
 namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 {
   namespace
   {
-    // Conversion based on http://entropymine.com/imageworsener/srgbformula/
-
-    //! This returns a value in the range of 0f to 1f.
-    float ConvertSRGBToLinearFloat(const float valueSRGB) noexcept
+    namespace LocalConfig
     {
-      if (valueSRGB <= 0.0f)
-      {
-        return 0.0f;
-      }
-      if (valueSRGB < 0.04045f)
-      {
-        return valueSRGB / 12.92f;
-      }
-      if (valueSRGB >= 1.0f)
-      {
-        return 1.0f;
-      }
-      auto res = std::pow((valueSRGB + 0.055f) / 1.055f, 2.4f);
-      assert(res >= 0.0f && res <= 1.0f);
-      return res;
+      //! The number of pixels processed at a time by the row functions that need a temporary buffer
+      constexpr uint32_t ChunkPixels = 64;
     }
 
-    float ConvertUInt8SRGBToLinearFloat(const uint8_t valueSRGB) noexcept
+    constexpr uint16_t ConvertLinearUInt8ToLinearUInt16(const uint8_t valueLinear) noexcept
     {
-      return ConvertSRGBToLinearFloat(static_cast<float>(valueSRGB) / 255.0f);
+      // 65535 / 255 = 257
+      return valueLinear * 257;
     }
 
-    //! @brief Convert a UInt8 SRGB value to a linear UInt16 value
-    //! @return Values will be in the range 0 to 0xFFFF
-    uint16_t ConvertSRGBToLinearUInt16(const uint8_t valueSRGB)
+    constexpr float ConvertLinearUInt8ToLinearFloat(const uint8_t valueLinear) noexcept
     {
-      const float colorLinear = ConvertSRGBToLinearFloat(static_cast<float>(valueSRGB) / 255.0f);
-
-      const float expandedLinearValue = std::round(colorLinear * std::numeric_limits<uint16_t>::max());
-      assert(expandedLinearValue >= 0.0f && expandedLinearValue <= static_cast<float>(std::numeric_limits<uint32_t>::max()));
-      const auto convertedLinearValue = static_cast<uint32_t>(expandedLinearValue);
+      return static_cast<float>(valueLinear) / 255.0f;
+    }
 
-      return convertedLinearValue <= std::numeric_limits<uint16_t>::max() ? static_cast<uint16_t>(convertedLinearValue)
-                                                                          : std::numeric_limits<uint16_t>::max();
+    constexpr uint8_t ConvertLinearUInt16ToLinearUInt8(const uint16_t valueLinear) noexcept
+    {
+      return valueLinear / 257;
     }
 
-    uint16_t ConvertSRGBToLinearFP16AsUInt16(const uint8_t srgbValue)
+    uint8_t ConvertLinearFP16ToLinearUInt8(const uint16_t valueLinear) noexcept
     {
-      const float linearValue = ConvertSRGBToLinearFloat(static_cast<float>(srgbValue) / 255.0f);
-      return half_float::detail::float2half<std::float_round_style::round_to_nearest>(linearValue);
+      return RawBitmapConverterKernels::ReferenceLinearF32ToLinearU8(RawBitmapConverterKernels::ReferenceLinearF16ToLinearF32(valueLinear));
     }
 
-    //! This returns a value in the range of 0f to 1f.
-    float ConvertLinearToSRGBFloat(const float valueLinear) noexcept
+    //! Must be true
+    //! - IsSafeInplaceModificationOrNoMemoryOverlap(rDstBitmap, srcBitmap) == true
+    //! The row operation is called with (pDstRow, pSrcRow, width) and must obey the same inplace modification rules.
+    template <typename TDstChannel, PixelFormat TDstPixelFormat, typename TSrcChannel, PixelFormat TSrcPixelFormat, typename TRowOperation>
+    void TransformRows(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, TRowOperation fnRowOperation) noexcept
     {
-      if (valueLinear <= 0.0f)
-      {
-        return 0.0f;
-      }
-      if (valueLinear < 0.0031308f)
-      {
-        return valueLinear * 12.92f;
-      }
-      if (valueLinear >= 1.0f)
+      static_assert(!PixelFormatUtil::IsCompressed(TDstPixelFormat), "TDstPixelFormat PixelFormat can not be compressed");
+      static_assert(!PixelFormatUtil::IsCompressed(TSrcPixelFormat), "TSrcPixelFormat PixelFormat can not be compressed");
+      static_assert(!PixelFormatUtil::IsPacked(TDstPixelFormat), "TDstPixelFormat PixelFormat can not be packed");
+      static_assert(!PixelFormatUtil::IsPacked(TSrcPixelFormat), "TSrcPixelFormat PixelFormat can not be packed");
+
+      assert(srcBitmap.GetPixelFormat() == TSrcPixelFormat);
+      assert(dstBitmap.GetPixelFormat() == TDstPixelFormat);
+      assert(dstBitmap.GetOrigin() == srcBitmap.GetOrigin());
+      assert(dstBitmap.GetSize() == srcBitmap.GetSize());
+      // The src and dst memory can only over in a 'safe' way
+      assert(UncheckedRawBitmapTransformer::IsSafeInplaceModificationOrNoMemoryOverlap(dstBitmap, srcBitmap));
+      // Expect the stride to be aligned to channel type size.
+      assert((srcBitmap.Stride() % sizeof(TSrcChannel)) == 0);
+      assert((dstBitmap.Stride() % sizeof(TDstChannel)) == 0);
+      assert(srcBitmap.RawUnsignedWidth() <= (std::numeric_limits<uint32_t>::max() / 4u));
+
+      const uint32_t width = srcBitmap.RawUnsignedWidth();
+      const uint32_t height = srcBitmap.RawUnsignedHeight();
+      const uint32_t srcStride = srcBitmap.Stride();
+      const uint32_t dstStride = dstBitmap.Stride();
+      const auto* pSrc = static_cast<const uint8_t*>(srcBitmap.Content());
+      auto* pDst = static_cast<uint8_t*>(dstBitmap.Content());
+      for (uint32_t y = 0; y < height; ++y)
       {
-        return 1.0f;
+        fnRowOperation(reinterpret_cast<TDstChannel*>(pDst), reinterpret_cast<const TSrcChannel*>(pSrc), width);
+        pSrc += srcStride;
+        pDst += dstStride;
       }
-      auto res = std::pow(valueLinear, 1.0f / 2.4f) * 1.055f - 0.055f;
-      assert(res >= 0.0f && res <= 1.0f);
-      return res;
     }
 
-    uint16_t ConvertLinearFloatToLinearFP16(const float valueLinear)
+    //! Apply a element wise kernel to all channels
+    template <typename TDstChannel, PixelFormat TDstPixelFormat, typename TSrcChannel, PixelFormat TSrcPixelFormat>
+    void TransformAllChannels(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap,
+                              void (*fnKernel)(TDstChannel*, const TSrcChannel*, const uint32_t) noexcept) noexcept
     {
-      return half_float::detail::float2half<std::float_round_style::round_to_nearest>(valueLinear);
-    }
-
+      constexpr uint32_t NumChannels = PixelFormatUtil::GetChannelCount(TSrcPixelFormat);
+      static_assert(PixelFormatUtil::GetChannelCount(TDstPixelFormat) == NumChannels);
 
-    float ConvertLinearFP16ToLinearFloat(const uint16_t valueLinear)
-    {
-      return half_float::detail::half2float<float>(valueLinear);
+      TransformRows<TDstChannel, TDstPixelFormat, TSrcChannel, TSrcPixelFormat>(
+        dstBitmap, srcBitmap,
+        [fnKernel](TDstChannel* pDst, const TSrcChannel* pSrc, const uint32_t width) { fnKernel(pDst, pSrc, width * NumChannels); });
     }
 
-
-    uint8_t ConvertLinearFloatToSRGBUInt8(const float valueLinear) noexcept
+    //! Apply a element wise kernel to the three color channels and a scalar operation to the fourth channel
+    template <typename TDstChannel, PixelFormat TDstPixelFormat, typename TSrcChannel, PixelFormat TSrcPixelFormat, typename TUnaryOperation>
+    void TransformThreeChannelsTransformFourth(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap,
+                                               void (*fnKernel)(TDstChannel*, const TSrcChannel*, const uint32_t) noexcept,
+                                               TUnaryOperation fnUnaryOperation) noexcept
     {
-      const float colorSRGB = ConvertLinearToSRGBFloat(valueLinear);
-      const float expandedSRGBValue = std::round(colorSRGB * std::numeric_limits<uint8_t>::max());
-      assert(expandedSRGBValue >= 0.0f && expandedSRGBValue <= static_cast<float>(std::numeric_limits<uint32_t>::max()));
-      const auto convertedSRGBValue = static_cast<uint32_t>(expandedSRGBValue);
-      return convertedSRGBValue <= std::numeric_limits<uint8_t>::max() ? static_cast<uint8_t>(convertedSRGBValue)
-                                                                       : std::numeric_limits<uint8_t>::max();
+      constexpr uint32_t NumChannels = 4u;
+      static_assert(PixelFormatUtil::GetChannelCount(TDstPixelFormat) == NumChannels);
+      static_assert(PixelFormatUtil::GetChannelCount(TSrcPixelFormat) == NumChannels);
+
+      TransformRows<TDstChannel, TDstPixelFormat, TSrcChannel, TSrcPixelFormat>(
+        dstBitmap, srcBitmap,
+        [fnKernel, fnUnaryOperation](TDstChannel* pDst, const TSrcChannel* pSrc, const uint32_t width)
+        {
+          // The fourth channel is read before the chunk is converted as a inplace conversion might overwrite it.
+          // A chunk never writes beyond the source memory of the chunk, so this is safe for the supported inplace modifications.
+          std::array<TDstChannel, LocalConfig::ChunkPixels> fourthChannel{};
+          for (uint32_t x = 0; x < width; x += LocalConfig::ChunkPixels)
+          {
+            const uint32_t count = std::min(LocalConfig::ChunkPixels, width - x);
+            const TSrcChannel* const pSrcChunk = pSrc + (x * NumChannels);
+            TDstChannel* const pDstChunk = pDst + (x * NumChannels);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+              fourthChannel[i] = fnUnaryOperation(pSrcChunk[(i * NumChannels) + 3u]);
+            }
+            fnKernel(pDstChunk, pSrcChunk, count * NumChannels);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+              pDstChunk[(i * NumChannels) + 3u] = fourthChannel[i];
+            }
+          }
+        });
     }
 
-
-    uint8_t ConvertLinearFP16ToSRGBUInt8(const uint16_t valueLinear)
+    //! Convert the sRGB UInt8 color channels using a lookup table (the fourth channel, if present, uses the alpha table)
+    template <typename TDstChannel, PixelFormat TDstPixelFormat, PixelFormat TSrcPixelFormat>
+    void TransformSrgbWithLookup(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, const std::array<TDstChannel, 256>& colorLookup,
+                                 const std::array<TDstChannel, 256>& alphaLookup) noexcept
     {
-      return ConvertLinearFloatToSRGBUInt8(half_float::detail::half2float<float>(valueLinear));
+      constexpr uint32_t NumChannels = PixelFormatUtil::GetChannelCount(TSrcPixelFormat);
+      static_assert(PixelFormatUtil::GetChannelCount(TDstPixelFormat) == NumChannels);
+      static_assert(NumChannels == 3u || NumChannels == 4u);
+
+      TransformRows<TDstChannel, TDstPixelFormat, uint8_t, TSrcPixelFormat>(
+        dstBitmap, srcBitmap,
+        [&colorLookup, &alphaLookup](TDstChannel* pDst, const uint8_t* pSrc, const uint32_t width)
+        {
+          const uint32_t channelsWidth = width * NumChannels;
+          for (uint32_t x = 0; x < channelsWidth; x += NumChannels)
+          {
+            pDst[x] = colorLookup[pSrc[x]];
+            pDst[x + 1] = colorLookup[pSrc[x + 1]];
+            pDst[x + 2] = colorLookup[pSrc[x + 2]];
+            if constexpr (NumChannels == 4u)
+            {
+              pDst[x + 3] = alphaLookup[pSrc[x + 3]];
+            }
+          }
+        });
     }
 
-    uint8_t ConvertLinearUInt16ToSRGBUInt8(const uint16_t valueLinear) noexcept
+    template <typename T>
+    std::array<T, 256> CreateLookup(T (*fnUnaryOperation)(const uint8_t) noexcept) noexcept
     {
-      return ConvertLinearFloatToSRGBUInt8(static_cast<float>(valueLinear) / static_cast<float>(std::numeric_limits<uint16_t>::max()));
+      std::array<T, 256> lookup{};
+      for (uint32_t i = 0; i < lookup.size(); ++i)
+      {
+        lookup[i] = fnUnaryOperation(static_cast<uint8_t>(i));
+      }
+      return lookup;
     }
 
-    uint16_t ConvertLinearUInt8ToLinearUInt16(const uint8_t valueLinear) noexcept
+    const std::array<uint16_t, 256>& GetLinearU8ToLinearU16Lookup() noexcept
     {
-      // 65535 / 255 = 257
-      return valueLinear * 257;
+      static const std::array<uint16_t, 256> g_lookup = CreateLookup<uint16_t>(ConvertLinearUInt8ToLinearUInt16);
+      return g_lookup;
     }
 
-    uint16_t ConvertLinearUInt8ToLinearFP16(const uint8_t valueLinear)
+    const std::array<float, 256>& GetLinearU8ToLinearF32Lookup() noexcept
     {
-      return ConvertLinearFloatToLinearFP16(static_cast<float>(valueLinear) / 255.0f);
+      static const std::array<float, 256> g_lookup = CreateLookup<float>(ConvertLinearUInt8ToLinearFloat);
+      return g_lookup;
     }
+  }
 
-    constexpr float ConvertLinearUInt8ToLinearFloat(const uint8_t valueLinear) noexcept
-    {
-      return static_cast<float>(valueLinear) / 255.0f;
-    }
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
 
-    constexpr uint8_t ConvertLinearUInt16ToLinearUInt8(const uint16_t valueLinear) noexcept
-    {
-      return valueLinear / 257;
-    }
+  RawBitmapConverterInstructionSet GetBestInstructionSet() noexcept
+  {
+    return RawBitmapConverterKernels::GetBestKernelTable().InstructionSet;
+  }
 
-    uint8_t ConvertLinearFloatToLinearUInt8(const float valueLinear) noexcept
-    {
-      auto converted = static_cast<int32_t>(std::round(MathHelper::Clamp(valueLinear, 0.0f, 1.0f) * std::numeric_limits<uint8_t>::max()));
-      return static_cast<uint8_t>(MathHelper::Clamp(converted, 0, 255));
-    }
 
-    uint8_t ConvertLinearFP16ToLinearUInt8(const uint16_t valueLinear) noexcept
+  RawBitmapConverterInstructionSet GetInstructionSet() noexcept
+  {
+    return RawBitmapConverterKernels::GetActiveKernelTable().InstructionSet;
+  }
+
+
+  bool IsInstructionSetSupported(const RawBitmapConverterInstructionSet instructionSet) noexcept
+  {
+    return RawBitmapConverterKernels::IsSupported(instructionSet);
+  }
+
+
+  void SetInstructionSet(const RawBitmapConverterInstructionSet instructionSet)
+  {
+    const RawBitmapConverterKernels::KernelTable* const pTable = RawBitmapConverterKernels::TryGetKernelTable(instructionSet);
+    if (pTable == nullptr || !RawBitmapConverterKernels::IsSupported(instructionSet))
     {
-      return ConvertLinearFloatToLinearUInt8(ConvertLinearFP16ToLinearFloat(valueLinear));
+      throw NotSupportedException("The instruction set is not supported");
     }
+    RawBitmapConverterKernels::SetActiveKernelTable(*pTable);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -191,144 +251,145 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 
   void UncheckedR8G8B8SrgbToR16G16B16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_UNORM, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearUInt16);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<uint16_t, PixelFormat::R16G16B16_UNORM, PixelFormat::R8G8B8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearU16,
+                                                                                               tables.SrgbToLinearU16);
   }
 
 
   void UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint16_t, PixelFormat::R16G16B16A16_UNORM, uint8_t,
-                                                                         PixelFormat::R8G8B8A8_SRGB>(dstBitmap, srcBitmap, ConvertSRGBToLinearUInt16,
-                                                                                                     ConvertLinearUInt8ToLinearUInt16);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<uint16_t, PixelFormat::R16G16B16A16_UNORM, PixelFormat::R8G8B8A8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearU16,
+                                                                                                     GetLinearU8ToLinearU16Lookup());
   }
 
 
   void UncheckedR8G8B8SrgbToR16G16B16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_SFLOAT, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearFP16AsUInt16);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<uint16_t, PixelFormat::R16G16B16_SFLOAT, PixelFormat::R8G8B8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearF16,
+                                                                                                tables.SrgbToLinearF16);
   }
 
   void UncheckedR8G8B8A8SrgbToR16G16B16A16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, uint8_t,
-                                                                         PixelFormat::R8G8B8A8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearFP16AsUInt16, ConvertLinearUInt8ToLinearFP16);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, PixelFormat::R8G8B8A8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearF16,
+                                                                                                      tables.LinearU8ToLinearF16);
   }
 
   void UncheckedR8G8B8SrgbToR32G32B32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<float, PixelFormat::R32G32B32_SFLOAT, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertUInt8SRGBToLinearFloat);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<float, PixelFormat::R32G32B32_SFLOAT, PixelFormat::R8G8B8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearF32,
+                                                                                             tables.SrgbToLinearF32);
   }
 
   void UncheckedR8G8B8A8SrgbToR32G32B32A32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<float, PixelFormat::R32G32B32A32_SFLOAT, uint8_t,
-                                                                         PixelFormat::R8G8B8A8_SRGB>(
-      dstBitmap, srcBitmap, ConvertUInt8SRGBToLinearFloat, ConvertLinearUInt8ToLinearFloat);
+    const auto& tables = RawBitmapConverterKernels::GetSrgbDecodeTables();
+    TransformSrgbWithLookup<float, PixelFormat::R32G32B32A32_SFLOAT, PixelFormat::R8G8B8A8_SRGB>(dstBitmap, srcBitmap, tables.SrgbToLinearF32,
+                                                                                                   GetLinearU8ToLinearF32Lookup());
   }
 
   // Linear to SRGB (clamp)
 
   void UncheckedR16G16B16UNormToR8G8B8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint8_t, PixelFormat::R8G8B8_SRGB, uint16_t, PixelFormat::R16G16B16_UNORM>(
-      dstBitmap, srcBitmap, ConvertLinearUInt16ToSRGBUInt8);
+    TransformAllChannels<uint8_t, PixelFormat::R8G8B8_SRGB, uint16_t, PixelFormat::R16G16B16_UNORM>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearU16ToSrgbU8);
   }
 
   void UncheckedR16G16B16A16UNormToR8G8B8A8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, uint16_t,
-                                                                         PixelFormat::R16G16B16A16_UNORM>(
-      dstBitmap, srcBitmap, ConvertLinearUInt16ToSRGBUInt8, ConvertLinearUInt16ToLinearUInt8);
+    TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, uint16_t, PixelFormat::R16G16B16A16_UNORM>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearU16ToSrgbU8, ConvertLinearUInt16ToLinearUInt8);
   }
 
   void UncheckedR16G16B16FloatToR8G8B8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint8_t, PixelFormat::R8G8B8_SRGB, uint16_t, PixelFormat::R16G16B16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToSRGBUInt8);
+    TransformAllChannels<uint8_t, PixelFormat::R8G8B8_SRGB, uint16_t, PixelFormat::R16G16B16_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF16ToSrgbU8);
   }
 
 
   void UncheckedR16G16B16A16FloatToR8G8B8A8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, uint16_t,
-                                                                         PixelFormat::R16G16B16A16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToSRGBUInt8, ConvertLinearFP16ToLinearUInt8);
+    TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, uint16_t, PixelFormat::R16G16B16A16_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF16ToSrgbU8, ConvertLinearFP16ToLinearUInt8);
   }
 
 
   void UncheckedR32G32B32FloatToR8G8B8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint8_t, PixelFormat::R8G8B8_SRGB, float, PixelFormat::R32G32B32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToSRGBUInt8);
+    TransformAllChannels<uint8_t, PixelFormat::R8G8B8_SRGB, float, PixelFormat::R32G32B32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToSrgbU8);
   }
 
 
   void UncheckedR32G32B32A32FloatToR8G8B8A8Srgb(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, float,
-                                                                         PixelFormat::R32G32B32A32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToSRGBUInt8, ConvertLinearFloatToLinearUInt8);
+    TransformThreeChannelsTransformFourth<uint8_t, PixelFormat::R8G8B8A8_SRGB, float, PixelFormat::R32G32B32A32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToSrgbU8,
+      RawBitmapConverterKernels::ReferenceLinearF32ToLinearU8);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
 
   void UncheckedR16G16B16FloatToR32G32B32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<float, PixelFormat::R32G32B32_SFLOAT, uint16_t, PixelFormat::R16G16B16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToLinearFloat);
+    TransformAllChannels<float, PixelFormat::R32G32B32_SFLOAT, uint16_t, PixelFormat::R16G16B16_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF16ToLinearF32);
   }
 
 
   void UncheckedR16G16B16A16FloatToR32G32B32A32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<float, PixelFormat::R32G32B32A32_SFLOAT, uint16_t, PixelFormat::R16G16B16A16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToLinearFloat);
+    TransformAllChannels<float, PixelFormat::R32G32B32A32_SFLOAT, uint16_t, PixelFormat::R16G16B16A16_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF16ToLinearF32);
   }
 
 
   void UncheckedR32G32B32FloatToR16G16B16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_SFLOAT, float, PixelFormat::R32G32B32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToLinearFP16);
+    TransformAllChannels<uint16_t, PixelFormat::R16G16B16_SFLOAT, float, PixelFormat::R32G32B32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToLinearF16);
   }
 
 
   void UncheckedR32G32B32A32FloatToR16G16B16A16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, float, PixelFormat::R32G32B32A32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToLinearFP16);
+    TransformAllChannels<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, float, PixelFormat::R32G32B32A32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToLinearF16);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
 
   void UncheckedR16G16B16UNormToR32G32B32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<float, PixelFormat::R32G32B32_SFLOAT, uint16_t, PixelFormat::R16G16B16_UNORM>(
-      dstBitmap, srcBitmap, ColorChannelConverter::RawU16ToRawF32);
+    TransformAllChannels<float, PixelFormat::R32G32B32_SFLOAT, uint16_t, PixelFormat::R16G16B16_UNORM>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearU16ToLinearF32);
   }
 
 
   void UncheckedR16G16B16A16UNormToR32G32B32A32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<float, PixelFormat::R32G32B32A32_SFLOAT, uint16_t, PixelFormat::R16G16B16A16_UNORM>(
-      dstBitmap, srcBitmap, ColorChannelConverter::RawU16ToRawF32);
+    TransformAllChannels<float, PixelFormat::R32G32B32A32_SFLOAT, uint16_t, PixelFormat::R16G16B16A16_UNORM>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearU16ToLinearF32);
   }
 
   void UncheckedR32G32B32FloatToR16G16B16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_UNORM, float, PixelFormat::R32G32B32_SFLOAT>(
-      dstBitmap, srcBitmap, ColorChannelConverter::RawF32ToRawU16);
+    TransformAllChannels<uint16_t, PixelFormat::R16G16B16_UNORM, float, PixelFormat::R32G32B32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToLinearU16);
   }
 
 
   void UncheckedR32G32B32A32FloatToR16G16B16A16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<uint16_t, PixelFormat::R16G16B16A16_UNORM, float, PixelFormat::R32G32B32A32_SFLOAT>(
-      dstBitmap, srcBitmap, ColorChannelConverter::RawF32ToRawU16);
+    TransformAllChannels<uint16_t, PixelFormat::R16G16B16A16_UNORM, float, PixelFormat::R32G32B32A32_SFLOAT>(
+      dstBitmap, srcBitmap, RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToLinearU16);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -337,8 +398,27 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 
   void UncheckedR32G32B32FloatToR16G16B16A16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannelsAndAddChannel<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, float,
-                                                                       PixelFormat::R32G32B32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToLinearFP16, ConvertLinearFloatToLinearFP16(1.0f));
+    const auto fnKernel = RawBitmapConverterKernels::GetActiveKernelTable().LinearF32ToLinearF16;
+    const uint16_t newChannelValue = RawBitmapConverterKernels::ReferenceLinearF32ToLinearF16(1.0f);
+    TransformRows<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, float, PixelFormat::R32G32B32_SFLOAT>(
+      dstBitmap, srcBitmap,
+      [fnKernel, newChannelValue](uint16_t* pDst, const float* pSrc, const uint32_t width)
+      {
+        // The chunk is converted to a temporary buffer before its written, so inplace modification is safe
+        std::array<uint16_t, LocalConfig::ChunkPixels * 3u> converted{};
+        for (uint32_t x = 0; x < width; x += LocalConfig::ChunkPixels)
+        {
+          const uint32_t count = std::min(LocalConfig::ChunkPixels, width - x);
+          fnKernel(converted.data(), pSrc + (x * 3u), count * 3u);
+          uint16_t* const pDstChunk = pDst + (x * 4u);
+          for (uint32_t i = 0; i < count; ++i)
+          {
+            pDstChunk[(i * 4u)] = converted[(i * 3u)];
+            pDstChunk[(i * 4u) + 1u] = converted[(i * 3u) + 1u];
+            pDstChunk[(i * 4u) + 2u] = converted[(i * 3u) + 2u];
+            pDstChunk[(i * 4u) + 3u] = newChannelValue;
+          }
+        }
+      });
   }
 }
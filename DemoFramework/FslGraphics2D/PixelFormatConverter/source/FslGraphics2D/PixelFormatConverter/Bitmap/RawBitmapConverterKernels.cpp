@@ -0,0 +1,461 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper_Clamp.hpp>
+#include <FslGraphics/ColorChannelConverter.hpp>
+#include <half.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "RawBitmapConverterKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LOCAL_RAWBITMAPCONVERTER_X86
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Fsl::FslGraphics2D::RawBitmapConverterKernels
+{
+  namespace
+  {
+    // Conversion based on http://entropymine.com/imageworsener/srgbformula/
+
+    //! This returns a value in the range of 0f to 1f.
+    float ConvertSRGBToLinearFloat(const float valueSRGB) noexcept
+    {
+      if (valueSRGB <= 0.0f)
+      {
+        return 0.0f;
+      }
+      if (valueSRGB < 0.04045f)
+      {
+        return valueSRGB / 12.92f;
+      }
+      if (valueSRGB >= 1.0f)
+      {
+        return 1.0f;
+      }
+      auto res = std::pow((valueSRGB + 0.055f) / 1.055f, 2.4f);
+      assert(res >= 0.0f && res <= 1.0f);
+      return res;
+    }
+
+    float ConvertUInt8SRGBToLinearFloat(const uint8_t valueSRGB) noexcept
+    {
+      return ConvertSRGBToLinearFloat(static_cast<float>(valueSRGB) / 255.0f);
+    }
+
+    //! @brief Convert a UInt8 SRGB value to a linear UInt16 value
+    //! @return Values will be in the range 0 to 0xFFFF
+    uint16_t ConvertSRGBToLinearUInt16(const uint8_t valueSRGB) noexcept
+    {
+      const float colorLinear = ConvertSRGBToLinearFloat(static_cast<float>(valueSRGB) / 255.0f);
+
+      const float expandedLinearValue = std::round(colorLinear * std::numeric_limits<uint16_t>::max());
+      assert(expandedLinearValue >= 0.0f && expandedLinearValue <= static_cast<float>(std::numeric_limits<uint32_t>::max()));
+      const auto convertedLinearValue = static_cast<uint32_t>(expandedLinearValue);
+
+      return convertedLinearValue <= std::numeric_limits<uint16_t>::max() ? static_cast<uint16_t>(convertedLinearValue)
+                                                                          : std::numeric_limits<uint16_t>::max();
+    }
+
+    //! This returns a value in the range of 0f to 1f.
+    float ConvertLinearToSRGBFloat(const float valueLinear) noexcept
+    {
+      if (valueLinear <= 0.0f)
+      {
+        return 0.0f;
+      }
+      if (valueLinear < 0.0031308f)
+      {
+        return valueLinear * 12.92f;
+      }
+      if (valueLinear >= 1.0f)
+      {
+        return 1.0f;
+      }
+      auto res = std::pow(valueLinear, 1.0f / 2.4f) * 1.055f - 0.055f;
+      assert(res >= 0.0f && res <= 1.0f);
+      return res;
+    }
+
+    SrgbDecodeTables CreateSrgbDecodeTables() noexcept
+    {
+      SrgbDecodeTables tables;
+      for (uint32_t i = 0; i < 256u; ++i)
+      {
+        const auto value = static_cast<uint8_t>(i);
+        tables.SrgbToLinearU16[i] = ConvertSRGBToLinearUInt16(value);
+        tables.SrgbToLinearF16[i] = ReferenceLinearF32ToLinearF16(ConvertUInt8SRGBToLinearFloat(value));
+        tables.SrgbToLinearF32[i] = ConvertUInt8SRGBToLinearFloat(value);
+        tables.LinearU8ToLinearF16[i] = ReferenceLinearF32ToLinearF16(static_cast<float>(value) / 255.0f);
+      }
+      return tables;
+    }
+
+    SrgbEncodeTables CreateSrgbEncodeTables() noexcept
+    {
+      // Binary search the float bit patterns in the range [0, 1.0f] for the first value that encodes to each sRGB value.
+      // Positive floats sort the same way as their bit patterns and the reference encode is monotonic.
+      SrgbEncodeTables tables;
+      uint32_t low = 0;
+      for (uint32_t i = 1; i < 256u; ++i)
+      {
+        uint32_t high = SrgbEncodeTables::BucketEndBits;
+        while (low < high)
+        {
+          const uint32_t mid = low + ((high - low) / 2u);
+          if (ReferenceLinearF32ToSrgbU8(std::bit_cast<float>(mid)) >= i)
+          {
+            high = mid;
+          }
+          else
+          {
+            low = mid + 1u;
+          }
+        }
+        tables.Thresholds[i] = std::bit_cast<float>(low);
+      }
+      tables.Thresholds[256] = std::numeric_limits<float>::infinity();
+      assert(tables.Thresholds[1] >= std::bit_cast<float>(SrgbEncodeTables::BucketBaseBits));
+
+      uint32_t encoded = 0;
+      for (uint32_t bucket = 0; bucket < tables.Buckets.size(); ++bucket)
+      {
+        const float bucketStart = std::bit_cast<float>(SrgbEncodeTables::BucketBaseBits + (bucket << SrgbEncodeTables::BucketShift));
+        while (bucketStart >= tables.Thresholds[encoded + 1u])
+        {
+          ++encoded;
+        }
+        tables.Buckets[bucket] = static_cast<uint8_t>(encoded);
+        // The sRGB curve is flat enough that a bucket never contains more than one threshold
+        assert(std::bit_cast<float>(SrgbEncodeTables::BucketBaseBits + ((bucket + 1u) << SrgbEncodeTables::BucketShift) - 1u) <
+               tables.Thresholds[std::min(encoded + 2u, 256u)]);
+      }
+      return tables;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+    // Scalar kernels
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    void ScalarLinearF16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF16ToLinearF32(pSrc[i]);
+      }
+    }
+
+    void ScalarLinearF32ToLinearF16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF32ToLinearF16(pSrc[i]);
+      }
+    }
+
+    void ScalarLinearU16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawU16ToRawF32(pSrc[i]);
+      }
+    }
+
+    void ScalarLinearF32ToLinearU16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawF32ToRawU16(pSrc[i]);
+      }
+    }
+
+    void ScalarLinearF32ToSrgbU8(uint8_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(pSrc[i], encodeTables);
+      }
+    }
+
+    void ScalarLinearF16ToSrgbU8(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(ReferenceLinearF16ToLinearF32(pSrc[i]), encodeTables);
+      }
+    }
+
+    void ScalarLinearU16ToSrgbU8(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(static_cast<float>(pSrc[i]) / static_cast<float>(std::numeric_limits<uint16_t>::max()), encodeTables);
+      }
+    }
+
+    constexpr KernelTable ScalarKernelTable = {RawBitmapConverterInstructionSet::Scalar,
+                                               ScalarLinearF16ToLinearF32,
+                                               ScalarLinearF32ToLinearF16,
+                                               ScalarLinearU16ToLinearF32,
+                                               ScalarLinearF32ToLinearU16,
+                                               ScalarLinearF32ToSrgbU8,
+                                               ScalarLinearF16ToSrgbU8,
+                                               ScalarLinearU16ToSrgbU8};
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+    // CPU feature detection
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    struct CpuFeatures
+    {
+      bool SSE41{false};
+      bool AVX2{false};
+    };
+
+#ifdef LOCAL_RAWBITMAPCONVERTER_X86
+    CpuFeatures DetectCpuFeatures() noexcept
+    {
+      constexpr uint32_t Leaf1EcxSSE41 = 1u << 19;
+      constexpr uint32_t Leaf1EcxOSXSave = 1u << 27;
+      constexpr uint32_t Leaf1EcxAVX = 1u << 28;
+      constexpr uint32_t Leaf1EcxF16C = 1u << 29;
+      constexpr uint32_t Leaf7EbxAVX2 = 1u << 5;
+      // The OS must save the XMM and YMM registers
+      constexpr uint64_t XCR0SSEAndAVXState = 0x6u;
+
+      uint32_t maxLeaf = 0;
+      uint32_t leaf1Ecx = 0;
+      uint32_t leaf7Ebx = 0;
+#if defined(_MSC_VER)
+      std::array<int, 4> regs{};
+      __cpuid(regs.data(), 0);
+      maxLeaf = static_cast<uint32_t>(regs[0]);
+      if (maxLeaf >= 1u)
+      {
+        __cpuid(regs.data(), 1);
+        leaf1Ecx = static_cast<uint32_t>(regs[2]);
+      }
+      if (maxLeaf >= 7u)
+      {
+        __cpuidex(regs.data(), 7, 0);
+        leaf7Ebx = static_cast<uint32_t>(regs[1]);
+      }
+#else
+      uint32_t eax = 0;
+      uint32_t ebx = 0;
+      uint32_t ecx = 0;
+      uint32_t edx = 0;
+      maxLeaf = __get_cpuid_max(0, nullptr);
+      if (maxLeaf >= 1u && __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0)
+      {
+        leaf1Ecx = ecx;
+      }
+      if (maxLeaf >= 7u && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0)
+      {
+        leaf7Ebx = ebx;
+      }
+#endif
+
+      CpuFeatures features;
+      features.SSE41 = (leaf1Ecx & Leaf1EcxSSE41) != 0u;
+      if ((leaf1Ecx & Leaf1EcxOSXSave) != 0u && (leaf1Ecx & Leaf1EcxAVX) != 0u && (leaf1Ecx & Leaf1EcxF16C) != 0u)
+      {
+#if defined(_MSC_VER)
+        const uint64_t xcr0 = _xgetbv(0);
+#else
+        uint32_t xcr0Low = 0;
+        uint32_t xcr0High = 0;
+        __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        const uint64_t xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+#endif
+        features.AVX2 = (xcr0 & XCR0SSEAndAVXState) == XCR0SSEAndAVXState && (leaf7Ebx & Leaf7EbxAVX2) != 0u;
+      }
+      return features;
+    }
+#else
+    CpuFeatures DetectCpuFeatures() noexcept
+    {
+      return {};
+    }
+#endif
+
+    const CpuFeatures& GetCpuFeatures() noexcept
+    {
+      static const CpuFeatures g_features = DetectCpuFeatures();
+      return g_features;
+    }
+
+    std::atomic<const KernelTable*> g_pActiveKernelTable{nullptr};
+  }
+
+
+  const SrgbDecodeTables& GetSrgbDecodeTables() noexcept
+  {
+    static const SrgbDecodeTables g_tables = CreateSrgbDecodeTables();
+    return g_tables;
+  }
+
+
+  const SrgbEncodeTables& GetSrgbEncodeTables() noexcept
+  {
+    static const SrgbEncodeTables g_tables = CreateSrgbEncodeTables();
+    return g_tables;
+  }
+
+
+  uint8_t ReferenceLinearF32ToSrgbU8(const float valueLinear) noexcept
+  {
+    const float colorSRGB = ConvertLinearToSRGBFloat(valueLinear);
+    const float expandedSRGBValue = std::round(colorSRGB * std::numeric_limits<uint8_t>::max());
+    assert(expandedSRGBValue >= 0.0f && expandedSRGBValue <= static_cast<float>(std::numeric_limits<uint32_t>::max()));
+    const auto convertedSRGBValue = static_cast<uint32_t>(expandedSRGBValue);
+    return convertedSRGBValue <= std::numeric_limits<uint8_t>::max() ? static_cast<uint8_t>(convertedSRGBValue)
+                                                                     : std::numeric_limits<uint8_t>::max();
+  }
+
+
+  uint8_t ReferenceLinearF32ToLinearU8(const float valueLinear) noexcept
+  {
+    auto converted = static_cast<int32_t>(std::round(MathHelper::Clamp(valueLinear, 0.0f, 1.0f) * std::numeric_limits<uint8_t>::max()));
+    return static_cast<uint8_t>(MathHelper::Clamp(converted, 0, 255));
+  }
+
+
+  uint16_t ReferenceLinearF32ToLinearF16(const float valueLinear) noexcept
+  {
+    return static_cast<uint16_t>(half_float::detail::float2half<std::float_round_style::round_to_nearest>(valueLinear));
+  }
+
+
+  float ReferenceLinearF16ToLinearF32(const uint16_t valueLinear) noexcept
+  {
+    return half_float::detail::half2float<float>(valueLinear);
+  }
+
+
+  const KernelTable* TryGetKernelTable(const RawBitmapConverterInstructionSet instructionSet) noexcept
+  {
+    switch (instructionSet)
+    {
+    case RawBitmapConverterInstructionSet::Scalar:
+      return &ScalarKernelTable;
+    case RawBitmapConverterInstructionSet::SSE4_1:
+      return TryGetSSE41KernelTable();
+    case RawBitmapConverterInstructionSet::AVX2:
+      return TryGetAVX2KernelTable();
+    case RawBitmapConverterInstructionSet::NEON:
+      return TryGetNeonKernelTable();
+    default:
+      return nullptr;
+    }
+  }
+
+
+  const KernelTable& GetScalarKernelTable() noexcept
+  {
+    return ScalarKernelTable;
+  }
+
+
+  bool IsSupported(const RawBitmapConverterInstructionSet instructionSet) noexcept
+  {
+    if (TryGetKernelTable(instructionSet) == nullptr)
+    {
+      return false;
+    }
+    switch (instructionSet)
+    {
+    case RawBitmapConverterInstructionSet::Scalar:
+      return true;
+    case RawBitmapConverterInstructionSet::SSE4_1:
+      return GetCpuFeatures().SSE41;
+    case RawBitmapConverterInstructionSet::AVX2:
+      return GetCpuFeatures().AVX2;
+    case RawBitmapConverterInstructionSet::NEON:
+      // NEON is a mandatory part of ARM64 so if the kernels were compiled they can be used
+      return true;
+    default:
+      return false;
+    }
+  }
+
+
+  const KernelTable& GetBestKernelTable() noexcept
+  {
+    constexpr std::array<RawBitmapConverterInstructionSet, 3> Preferred = {
+      RawBitmapConverterInstructionSet::AVX2, RawBitmapConverterInstructionSet::NEON, RawBitmapConverterInstructionSet::SSE4_1};
+    for (const RawBitmapConverterInstructionSet entry : Preferred)
+    {
+      if (IsSupported(entry))
+      {
+        const KernelTable* const pTable = TryGetKernelTable(entry);
+        assert(pTable != nullptr);
+        return *pTable;
+      }
+    }
+    return ScalarKernelTable;
+  }
+
+
+  const KernelTable& GetActiveKernelTable() noexcept
+  {
+    const KernelTable* pTable = g_pActiveKernelTable.load(std::memory_order_acquire);
+    if (pTable == nullptr)
+    {
+      // Multiple threads might race to select the table, the first one wins (unless a table was set explicitly in the meantime)
+      const KernelTable* pBestTable = &GetBestKernelTable();
+      if (g_pActiveKernelTable.compare_exchange_strong(pTable, pBestTable, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        pTable = pBestTable;
+      }
+    }
+    return *pTable;
+  }
+
+
+  void SetActiveKernelTable(const KernelTable& kernelTable) noexcept
+  {
+    g_pActiveKernelTable.store(&kernelTable, std::memory_order_release);
+  }
+}
@@ -0,0 +1,129 @@
+#ifndef FSLGRAPHICS2D_PIXELFORMATCONVERTER_BITMAP_RAWBITMAPCONVERTERKERNELS_HPP
+#define FSLGRAPHICS2D_PIXELFORMATCONVERTER_BITMAP_RAWBITMAPCONVERTERKERNELS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterInstructionSet.hpp>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Fsl::FslGraphics2D::RawBitmapConverterKernels
+{
+  //! Element wise row kernels, 'count' is the number of channel values to convert (not pixels).
+  //! All kernels load a block of source values before storing the destination values, so they support the same 'safe' inplace modification
+  //! as the UncheckedRawBitmapTransformer (same start address and a source element size >= the destination element size).
+  struct KernelTable
+  {
+    RawBitmapConverterInstructionSet InstructionSet{RawBitmapConverterInstructionSet::Scalar};
+    void (*LinearF16ToLinearF32)(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearF32ToLinearF16)(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearU16ToLinearF32)(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearF32ToLinearU16)(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearF32ToSrgbU8)(uint8_t* pDst, const float* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearF16ToSrgbU8)(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept{nullptr};
+    void (*LinearU16ToSrgbU8)(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept{nullptr};
+  };
+
+  //! Lookup tables for the sRGB UInt8 decode, they are generated from the reference conversion so the results are identical.
+  struct SrgbDecodeTables
+  {
+    std::array<uint16_t, 256> SrgbToLinearU16{};
+    std::array<uint16_t, 256> SrgbToLinearF16{};
+    std::array<float, 256> SrgbToLinearF32{};
+    std::array<uint16_t, 256> LinearU8ToLinearF16{};
+  };
+
+  //! Lookup tables for the linear float to sRGB UInt8 encode.
+  //! The tables are generated from the reference conversion and as it is monotonic the encode returns the exact same result as the reference.
+  struct SrgbEncodeTables
+  {
+    //! The bit pattern of the smallest float that uses the buckets (2^-13), all smaller values encode to zero.
+    static constexpr uint32_t BucketBaseBits = 0x39000000u;
+    //! The bit pattern of 1.0f, all larger values encode to 255.
+    static constexpr uint32_t BucketEndBits = 0x3F800000u;
+    static constexpr uint32_t BucketShift = 16u;
+    static constexpr uint32_t BucketCount = (BucketEndBits - BucketBaseBits) >> BucketShift;
+
+    //! The linear float value where the reference encode first returns the given index (entry zero is unused and the last entry is +inf).
+    std::array<float, 257> Thresholds{};
+    //! The encoded value of the first float in each bucket, no bucket contains more than one threshold so one compare finishes the encode.
+    std::array<uint8_t, BucketCount> Buckets{};
+  };
+
+  const SrgbDecodeTables& GetSrgbDecodeTables() noexcept;
+  const SrgbEncodeTables& GetSrgbEncodeTables() noexcept;
+
+  //! @brief Encode a linear float value to sRGB UInt8 using the encode tables.
+  //! @note NaN and negative values return zero.
+  inline uint8_t LinearF32ToSrgbU8(const float valueLinear, const SrgbEncodeTables& tables) noexcept
+  {
+    if (!(valueLinear >= std::bit_cast<float>(SrgbEncodeTables::BucketBaseBits)))
+    {
+      return 0u;
+    }
+    if (valueLinear >= 1.0f)
+    {
+      return 255u;
+    }
+    const uint32_t bucket = (std::bit_cast<uint32_t>(valueLinear) - SrgbEncodeTables::BucketBaseBits) >> SrgbEncodeTables::BucketShift;
+    const uint32_t encoded = tables.Buckets[bucket];
+    return static_cast<uint8_t>(encoded + (valueLinear >= tables.Thresholds[encoded + 1u] ? 1u : 0u));
+  }
+
+  // Reference scalar conversions (these define the expected result of all kernels)
+
+  uint8_t ReferenceLinearF32ToSrgbU8(const float valueLinear) noexcept;
+  uint8_t ReferenceLinearF32ToLinearU8(const float valueLinear) noexcept;
+  uint16_t ReferenceLinearF32ToLinearF16(const float valueLinear) noexcept;
+  float ReferenceLinearF16ToLinearF32(const uint16_t valueLinear) noexcept;
+
+  //! The kernel table for the given instruction set or nullptr if it is unavailable in this build.
+  //! @note This does not check if the CPU supports the instruction set.
+  const KernelTable* TryGetKernelTable(const RawBitmapConverterInstructionSet instructionSet) noexcept;
+
+  const KernelTable& GetScalarKernelTable() noexcept;
+  const KernelTable* TryGetSSE41KernelTable() noexcept;
+  const KernelTable* TryGetAVX2KernelTable() noexcept;
+  const KernelTable* TryGetNeonKernelTable() noexcept;
+
+  //! Check if the CPU we are running on supports the instruction set (and the kernels for it are available)
+  bool IsSupported(const RawBitmapConverterInstructionSet instructionSet) noexcept;
+
+  //! The best kernel table supported by the CPU we are running on
+  const KernelTable& GetBestKernelTable() noexcept;
+
+  //! The kernel table currently used by the RawBitmapConverterFunctions
+  const KernelTable& GetActiveKernelTable() noexcept;
+  void SetActiveKernelTable(const KernelTable& kernelTable) noexcept;
+}
+
+#endif
@@ -0,0 +1,168 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/ColorChannelConverter.hpp>
+#include <limits>
+#include "RawBitmapConverterKernels.hpp"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define LOCAL_RAWBITMAPCONVERTER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Fsl::FslGraphics2D::RawBitmapConverterKernels
+{
+#ifdef LOCAL_RAWBITMAPCONVERTER_NEON
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr float MaxU16 = static_cast<float>(std::numeric_limits<uint16_t>::max());
+      // Matches ColorChannelConverter::UncheckedRawF32ToRawU16
+      constexpr float U16RoundScale = static_cast<float>(0xFFFFu << 2);
+    }
+
+    void NeonLinearF16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        const uint16x8_t src = vld1q_u16(pSrc + i);
+        vst1q_f32(pDst + i, vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(src))));
+        vst1q_f32(pDst + i + 4u, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(src))));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF16ToLinearF32(pSrc[i]);
+      }
+    }
+
+    void NeonLinearF32ToLinearF16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        // The default FPCR rounding mode is round to nearest even which matches the half library round_to_nearest
+        const uint16x4_t low = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSrc + i)));
+        const uint16x4_t high = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSrc + i + 4u)));
+        vst1q_u16(pDst + i, vcombine_u16(low, high));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF32ToLinearF16(pSrc[i]);
+      }
+    }
+
+    void NeonLinearU16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const float32x4_t maxValue = vdupq_n_f32(LocalConfig::MaxU16);
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        const uint16x8_t src = vld1q_u16(pSrc + i);
+        vst1q_f32(pDst + i, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(src))), maxValue));
+        vst1q_f32(pDst + i + 4u, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(src))), maxValue));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawU16ToRawF32(pSrc[i]);
+      }
+    }
+
+    inline uint16x4_t NeonToRawU16(const float32x4_t value) noexcept
+    {
+      // vmaxnm returns the number if one operand is NaN so NaN is clamped to zero
+      const float32x4_t clamped = vminq_f32(vmaxnmq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+      const int32x4_t scaled = vcvtq_s32_f32(vmulq_f32(clamped, vdupq_n_f32(LocalConfig::U16RoundScale)));
+      return vqmovun_s32(vshrq_n_s32(vaddq_s32(scaled, vdupq_n_s32(2)), 2));
+    }
+
+    void NeonLinearF32ToLinearU16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        const uint16x4_t low = NeonToRawU16(vld1q_f32(pSrc + i));
+        const uint16x4_t high = NeonToRawU16(vld1q_f32(pSrc + i + 4u));
+        vst1q_u16(pDst + i, vcombine_u16(low, high));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawF32ToRawU16(pSrc[i]);
+      }
+    }
+
+    void NeonLinearF16ToSrgbU8(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      // The sRGB encode is a table lookup per value so only the F16 decode is vectorized
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      uint32_t i = 0;
+      for (; (i + 4u) <= count; i += 4u)
+      {
+        float values[4];
+        vst1q_f32(values, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc + i))));
+        pDst[i] = LinearF32ToSrgbU8(values[0], encodeTables);
+        pDst[i + 1u] = LinearF32ToSrgbU8(values[1], encodeTables);
+        pDst[i + 2u] = LinearF32ToSrgbU8(values[2], encodeTables);
+        pDst[i + 3u] = LinearF32ToSrgbU8(values[3], encodeTables);
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(ReferenceLinearF16ToLinearF32(pSrc[i]), encodeTables);
+      }
+    }
+
+    KernelTable CreateNeonKernelTable() noexcept
+    {
+      KernelTable table = GetScalarKernelTable();
+      table.InstructionSet = RawBitmapConverterInstructionSet::NEON;
+      table.LinearF16ToLinearF32 = NeonLinearF16ToLinearF32;
+      table.LinearF32ToLinearF16 = NeonLinearF32ToLinearF16;
+      table.LinearU16ToLinearF32 = NeonLinearU16ToLinearF32;
+      table.LinearF32ToLinearU16 = NeonLinearF32ToLinearU16;
+      table.LinearF16ToSrgbU8 = NeonLinearF16ToSrgbU8;
+      return table;
+    }
+  }
+
+
+  const KernelTable* TryGetNeonKernelTable() noexcept
+  {
+    static const KernelTable g_table = CreateNeonKernelTable();
+    return &g_table;
+  }
+#else
+  const KernelTable* TryGetNeonKernelTable() noexcept
+  {
+    return nullptr;
+  }
+#endif
+}
@@ -0,0 +1,273 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/ColorChannelConverter.hpp>
+#include <limits>
+#include "RawBitmapConverterKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LOCAL_RAWBITMAPCONVERTER_X86
+#include <immintrin.h>
+
+// The kernels are compiled for their instruction set using function level target attributes so the library itself can still be built for the
+// baseline architecture. The kernels are only called after the runtime CPU check in RawBitmapConverterKernels.cpp succeeded.
+#if defined(__GNUC__) || defined(__clang__)
+#define LOCAL_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define LOCAL_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#else
+#define LOCAL_TARGET_SSE41
+#define LOCAL_TARGET_AVX2
+#endif
+#endif
+
+namespace Fsl::FslGraphics2D::RawBitmapConverterKernels
+{
+#ifdef LOCAL_RAWBITMAPCONVERTER_X86
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr float MaxU16 = static_cast<float>(std::numeric_limits<uint16_t>::max());
+      // Matches ColorChannelConverter::UncheckedRawF32ToRawU16
+      constexpr float U16RoundScale = static_cast<float>(0xFFFFu << 2);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+    // SSE4.1
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    LOCAL_TARGET_SSE41 void SSE41LinearU16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const __m128 maxValue = _mm_set1_ps(LocalConfig::MaxU16);
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+        const __m128 low = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(src)), maxValue);
+        const __m128 high = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(src, 8))), maxValue);
+        _mm_storeu_ps(pDst + i, low);
+        _mm_storeu_ps(pDst + i + 4u, high);
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawU16ToRawF32(pSrc[i]);
+      }
+    }
+
+    LOCAL_TARGET_SSE41 __m128i SSE41ToRawU16(const __m128 value) noexcept
+    {
+      // NaN is clamped to zero
+      const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+      const __m128i scaled = _mm_cvttps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(LocalConfig::U16RoundScale)));
+      return _mm_srli_epi32(_mm_add_epi32(scaled, _mm_set1_epi32(2)), 2);
+    }
+
+    LOCAL_TARGET_SSE41 void SSE41LinearF32ToLinearU16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        const __m128i low = SSE41ToRawU16(_mm_loadu_ps(pSrc + i));
+        const __m128i high = SSE41ToRawU16(_mm_loadu_ps(pSrc + i + 4u));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm_packus_epi32(low, high));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawF32ToRawU16(pSrc[i]);
+      }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+    // AVX2 + F16C
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    LOCAL_TARGET_AVX2 void AVX2LinearF16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        _mm256_storeu_ps(pDst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i))));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF16ToLinearF32(pSrc[i]);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearF32ToLinearF16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        // F16C round to nearest even matches the half library round_to_nearest
+        const __m128i converted = _mm256_cvtps_ph(_mm256_loadu_ps(pSrc + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), converted);
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ReferenceLinearF32ToLinearF16(pSrc[i]);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 __m256 AVX2LoadU16AsF32(const uint16_t* pSrc) noexcept
+    {
+      const __m256i src = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)));
+      return _mm256_div_ps(_mm256_cvtepi32_ps(src), _mm256_set1_ps(LocalConfig::MaxU16));
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearU16ToLinearF32(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        _mm256_storeu_ps(pDst + i, AVX2LoadU16AsF32(pSrc + i));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawU16ToRawF32(pSrc[i]);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearF32ToLinearU16(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      const __m256 zero = _mm256_setzero_ps();
+      const __m256 one = _mm256_set1_ps(1.0f);
+      const __m256 scale = _mm256_set1_ps(LocalConfig::U16RoundScale);
+      const __m256i two = _mm256_set1_epi32(2);
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        // NaN is clamped to zero
+        const __m256 clamped = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(pSrc + i), zero), one);
+        const __m256i scaled = _mm256_srli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(clamped, scale)), two), 2);
+        // packus works per 128 bit lane so the two halves are moved together afterwards
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(scaled, scaled), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm256_castsi256_si128(packed));
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = ColorChannelConverter::RawF32ToRawU16(pSrc[i]);
+      }
+    }
+
+    //! The encode is a table lookup per value, so the vector code only covers the conversion to linear float
+    LOCAL_TARGET_AVX2 void AVX2StoreSrgbU8(uint8_t* pDst, const __m256 valueLinear, const SrgbEncodeTables& encodeTables) noexcept
+    {
+      alignas(32) float values[8];
+      _mm256_store_ps(values, valueLinear);
+      for (uint32_t i = 0; i < 8u; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(values[i], encodeTables);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearF32ToSrgbU8(uint8_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(pSrc[i], encodeTables);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearF16ToSrgbU8(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        AVX2StoreSrgbU8(pDst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i))), encodeTables);
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(ReferenceLinearF16ToLinearF32(pSrc[i]), encodeTables);
+      }
+    }
+
+    LOCAL_TARGET_AVX2 void AVX2LinearU16ToSrgbU8(uint8_t* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      const SrgbEncodeTables& encodeTables = GetSrgbEncodeTables();
+      uint32_t i = 0;
+      for (; (i + 8u) <= count; i += 8u)
+      {
+        AVX2StoreSrgbU8(pDst + i, AVX2LoadU16AsF32(pSrc + i), encodeTables);
+      }
+      for (; i < count; ++i)
+      {
+        pDst[i] = LinearF32ToSrgbU8(ColorChannelConverter::RawU16ToRawF32(pSrc[i]), encodeTables);
+      }
+    }
+
+    KernelTable CreateSSE41KernelTable() noexcept
+    {
+      // F16 needs F16C so the F16 and sRGB encode kernels use the scalar versions
+      KernelTable table = GetScalarKernelTable();
+      table.InstructionSet = RawBitmapConverterInstructionSet::SSE4_1;
+      table.LinearU16ToLinearF32 = SSE41LinearU16ToLinearF32;
+      table.LinearF32ToLinearU16 = SSE41LinearF32ToLinearU16;
+      return table;
+    }
+
+    constexpr KernelTable AVX2KernelTable = {RawBitmapConverterInstructionSet::AVX2,
+                                             AVX2LinearF16ToLinearF32,
+                                             AVX2LinearF32ToLinearF16,
+                                             AVX2LinearU16ToLinearF32,
+                                             AVX2LinearF32ToLinearU16,
+                                             AVX2LinearF32ToSrgbU8,
+                                             AVX2LinearF16ToSrgbU8,
+                                             AVX2LinearU16ToSrgbU8};
+  }
+
+
+  const KernelTable* TryGetSSE41KernelTable() noexcept
+  {
+    static const KernelTable g_table = CreateSSE41KernelTable();
+    return &g_table;
+  }
+
+
+  const KernelTable* TryGetAVX2KernelTable() noexcept
+  {
+    return &AVX2KernelTable;
+  }
+#else
+  const KernelTable* TryGetSSE41KernelTable() noexcept
+  {
+    return nullptr;
+  }
+
+
+  const KernelTable* TryGetAVX2KernelTable() noexcept
+  {
+    return nullptr;
+  }
+#endif
+}
@@ -1074,3 +1074,101 @@ TEST_F(TestBacherImmediateModeBatcher, MeshBuild_AtOverVertexCapacity_AddRect)
     EXPECT_EQ(SpanRange<uint32_t>(0, 6), batchRecord.IndexSpanRange);
   }
 }
+
+
+TEST_F(TestBacherImmediateModeBatcher, ResumeBatch_NotBuilding)
+{
+  const ImmediateModeBatcherTypes::BatchBuildStatus status(true);
+  EXPECT_THROW(m_batcher.ResumeBatch(status), UsageErrorException);
+}
+
+
+TEST_F(TestBacherImmediateModeBatcher, ResumeBatch_InvalidStatus)
+{
+  ImmediateModeBatcherTypes::BatchBuildStatus status(true);
+  status.VertexCount = UncheckedNumericCast<uint32_t>(m_batcher.VertexCapacity() + 1u);
+
+  EXPECT_TRUE(m_batcher.BeginBatch());
+  EXPECT_THROW(m_batcher.ResumeBatch(ImmediateModeBatcherTypes::BatchBuildStatus()), std::invalid_argument);
+  EXPECT_THROW(m_batcher.ResumeBatch(status), std::invalid_argument);
+}
+
+
+TEST_F(TestBacherImmediateModeBatcher, ResumeBatch_PatchLastMesh)
+{
+  constexpr uint16_t VertexCount = 30;
+  constexpr uint16_t IndexCount = 60;
+  constexpr Color Color(0xFFFEFDFC);
+
+  constexpr float Quad1X0 = 1.0f;
+  constexpr float Quad1X1 = 2.0f;
+  constexpr float Quad1Y0 = 3.0f;
+  constexpr float Quad1Y1 = 4.0f;
+  constexpr NativeTextureArea Quad1TextureArea(0.5f, 0.6f, 0.7f, 0.8f);
+
+  constexpr float Quad2X0 = 11.0f;
+  constexpr float Quad2X1 = 12.0f;
+  constexpr float Quad2Y0 = 13.0f;
+  constexpr float Quad2Y1 = 14.0f;
+  constexpr NativeTextureArea Quad2TextureArea(0.15f, 0.16f, 0.17f, 0.18f);
+
+  constexpr float Quad3X0 = 21.0f;
+  constexpr float Quad3X1 = 22.0f;
+  constexpr float Quad3Y0 = 23.0f;
+  constexpr float Quad3Y1 = 24.0f;
+  constexpr NativeTextureArea Quad3TextureArea(0.25f, 0.26f, 0.27f, 0.28f);
+
+  m_batcher.EnsureCapacity(VertexCount * 2, IndexCount * 2);
+
+  // Build two meshes and capture the status before the second one
+  EXPECT_TRUE(m_batcher.BeginBatch());
+  {
+    auto meshBuilder = m_batcher.BeginMeshBuild(g_materialInfoOpaque0, VertexCount, IndexCount, Color);
+    meshBuilder.AddRect(Quad1X0, Quad1Y0, Quad1X1, Quad1Y1, Quad1TextureArea);
+    m_batcher.EndMeshBuild(meshBuilder);
+  }
+  const ImmediateModeBatcherTypes::BatchBuildStatus statusBeforeMesh1 = m_batcher.GetBuildStatus();
+  {
+    auto meshBuilder = m_batcher.BeginMeshBuild(g_materialInfoOpaque1, VertexCount, IndexCount, Color);
+    meshBuilder.AddRect(Quad2X0, Quad2Y0, Quad2X1, Quad2Y1, Quad2TextureArea);
+    m_batcher.EndMeshBuild(meshBuilder);
+  }
+  const ImmediateModeBatcherTypes::BatchBuildStatus statusEnd = m_batcher.GetBuildStatus();
+  EXPECT_TRUE(m_batcher.EndBatch());
+
+  // Reuse the first mesh and regenerate the second one
+  EXPECT_TRUE(m_batcher.BeginBatch());
+  m_batcher.ResumeBatch(statusBeforeMesh1);
+  {
+    auto meshBuilder = m_batcher.BeginMeshBuild(g_materialInfoOpaque1, VertexCount, IndexCount, Color);
+    meshBuilder.AddRect(Quad3X0, Quad3Y0, Quad3X1, Quad3Y1, Quad3TextureArea);
+    m_batcher.EndMeshBuild(meshBuilder);
+  }
+  EXPECT_EQ(statusEnd, m_batcher.GetBuildStatus());
+  EXPECT_TRUE(m_batcher.EndBatch());
+
+  EXPECT_EQ(1u, m_batcher.GetSegmentCount());
+  EXPECT_EQ(2u, m_batcher.GetStats().BatchCount);
+  EXPECT_EQ(4u * 2u, m_batcher.GetStats().VertexCount);
+  EXPECT_EQ(6u * 2u, m_batcher.GetStats().IndexCount);
+  {
+    auto segmentSpans = m_batcher.GetSegmentSpans(0);
+    EXPECT_EQ(4u * 2u, segmentSpans.Vertices.size());
+    EXPECT_EQ(6u * 2u, segmentSpans.Indices.size());
+    CheckSpanRect(segmentSpans.Vertices.subspan(0, 4), Quad1X0, Quad1Y0, Quad1X1, Quad1Y1, Color, Quad1TextureArea, LocalConfig::StartZ);
+    CheckSpanRect(segmentSpans.Vertices.subspan(4, 4), Quad3X0, Quad3Y0, Quad3X1, Quad3Y1, Color, Quad3TextureArea,
+                  LocalConfig::StartZ + LocalConfig::ZAdd);
+    CheckSpanRect(segmentSpans.Indices.subspan(0, 6), 0);
+    CheckSpanRect(segmentSpans.Indices.subspan(6, 6), 4);
+  }
+  {
+    const auto& batchRecord = m_batcher.GetBatchRecord(0);
+    EXPECT_EQ(g_materialInfoOpaque0, batchRecord.Info.MaterialId);
+    EXPECT_EQ(SpanRange<uint32_t>(0, 4), batchRecord.VertexSpanRange);
+  }
+  {
+    const auto& batchRecord = m_batcher.GetBatchRecord(1);
+    EXPECT_EQ(g_materialInfoOpaque1, batchRecord.Info.MaterialId);
+    EXPECT_EQ(SpanRange<uint32_t>(4, 4), batchRecord.VertexSpanRange);
+  }
+}
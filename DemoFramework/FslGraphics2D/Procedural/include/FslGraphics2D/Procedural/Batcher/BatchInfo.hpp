@@ -48,6 +48,16 @@ namespace Fsl
       , MaterialId(materialId)
     {
     }
+
+    constexpr bool operator==(const BatchInfo& rhs) const noexcept
+    {
+      return ContentType == rhs.ContentType && MaterialId == rhs.MaterialId;
+    }
+
+    constexpr bool operator!=(const BatchInfo& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
   };
 }
 
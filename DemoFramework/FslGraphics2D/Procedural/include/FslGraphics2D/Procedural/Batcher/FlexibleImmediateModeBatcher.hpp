@@ -327,6 +327,31 @@ namespace Fsl
       return true;
     }
 
+    //! @brief Get the current build status.
+    //! @note  The status can be given to ResumeBatch during a later build to continue from this point while reusing all vertices, indices,
+    //!        batches and segments that were generated before it.
+    const ImmediateModeBatcherTypes::BatchBuildStatus& GetBuildStatus() const noexcept
+    {
+      return m_batchBuildStatus;
+    }
+
+    //! @brief Continue the active batch build from a status captured by GetBuildStatus during a earlier build.
+    //! @note  It is the callers responsibility to ensure that the meshes that were generated before the status was captured would be
+    //!        generated exactly the same way by the active build (as they are being reused as is).
+    void ResumeBatch(const ImmediateModeBatcherTypes::BatchBuildStatus& status)
+    {
+      if (!m_batchBuildStatus.Building)
+      {
+        throw UsageErrorException("Not in a mesh building section");
+      }
+      if (!status.Building || status.VertexCount > m_vertices.size() || status.IndexCount > m_indices.size() ||
+          status.BatchCount > m_batches.size() || status.SegmentCount > m_segments.size())
+      {
+        throw std::invalid_argument("status is not compatible with the batcher");
+      }
+      m_batchBuildStatus = status;
+    }
+
     void EnsureCapacity(const size_type vertexCapacity, const size_type indexCapacity)
     {
       EnsureVertexCapacity(vertexCapacity);
@@ -59,6 +59,17 @@ namespace Fsl
         , IndexOffset(indexOffset)
       {
       }
+
+      constexpr bool operator==(const CurrentSegementRecord& rhs) const noexcept
+      {
+        return BatchStartIndex == rhs.BatchStartIndex && VertexOffset == rhs.VertexOffset && IndexOffset == rhs.IndexOffset &&
+               VertexCount == rhs.VertexCount && IndexCount == rhs.IndexCount;
+      }
+
+      constexpr bool operator!=(const CurrentSegementRecord& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
     };
 
     struct CurrentBatchRecord
@@ -82,6 +93,17 @@ namespace Fsl
         , SegmentIndexOffset(segmentIndexOffset)
       {
       }
+
+      constexpr bool operator==(const CurrentBatchRecord& rhs) const noexcept
+      {
+        return Info == rhs.Info && SegmentVertexOffset == rhs.SegmentVertexOffset && SegmentIndexOffset == rhs.SegmentIndexOffset &&
+               VertexCount == rhs.VertexCount && IndexCount == rhs.IndexCount;
+      }
+
+      constexpr bool operator!=(const CurrentBatchRecord& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
     };
 
     struct BatchBuildStatus
@@ -100,6 +122,17 @@ namespace Fsl
         : Building(building)
       {
       }
+
+      constexpr bool operator==(const BatchBuildStatus& rhs) const noexcept
+      {
+        return Building == rhs.Building && SegmentCount == rhs.SegmentCount && BatchCount == rhs.BatchCount && VertexCount == rhs.VertexCount &&
+               IndexCount == rhs.IndexCount && ZPos == rhs.ZPos && CurrentSegment == rhs.CurrentSegment && CurrentBatch == rhs.CurrentBatch;
+      }
+
+      constexpr bool operator!=(const BatchBuildStatus& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
     };
 
     struct SegmentRecord
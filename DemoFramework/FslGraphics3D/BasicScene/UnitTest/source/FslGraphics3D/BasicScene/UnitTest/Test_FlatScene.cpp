@@ -0,0 +1,318 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics3D/BasicScene/FlatScene.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/GenericScene.hpp>
+#include <FslGraphics3D/BasicScene/SceneNode.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using TestBasicScene_FlatScene = TestFixtureFslGraphics;
+
+  std::shared_ptr<SceneNode> CreateNode(const std::string& name, const Matrix& transformation)
+  {
+    auto node = std::make_shared<SceneNode>();
+    node->SetName(UTF8String(name));
+    node->SetTransformation(transformation);
+    return node;
+  }
+
+  //! root
+  //!  - a
+  //!    - a0
+  //!    - a1
+  //!  - b
+  //!    - b0
+  //!       - b00
+  std::shared_ptr<SceneNode> CreateHierarchy()
+  {
+    auto root = CreateNode("root", Matrix::CreateTranslation(1.0f, 2.0f, 3.0f));
+    auto a = CreateNode("a", Matrix::CreateRotationY(0.5f));
+    auto b = CreateNode("b", Matrix::CreateScale(2.0f));
+    auto a0 = CreateNode("a0", Matrix::CreateTranslation(0.0f, 1.0f, 0.0f));
+    auto a1 = CreateNode("a1", Matrix::CreateRotationX(0.25f));
+    auto b0 = CreateNode("b0", Matrix::CreateTranslation(4.0f, 0.0f, 0.0f));
+    auto b00 = CreateNode("b00", Matrix::CreateRotationZ(1.0f));
+    a->AddMesh(1);
+    a1->AddMesh(2);
+    a1->AddMesh(3);
+    b00->AddMesh(4);
+
+    root->AddChild(a);
+    root->AddChild(b);
+    a->AddChild(a0);
+    a->AddChild(a1);
+    b->AddChild(b0);
+    b0->AddChild(b00);
+    return root;
+  }
+
+  //! The reference implementation, the same composition order as the samples use
+  void CollectWorldTransforms(const SceneNode& node, const Matrix& parentMatrix, std::vector<Matrix>& rResult)
+  {
+    const Matrix world = parentMatrix * node.GetTransformation();
+    rResult.push_back(world);
+    for (int32_t i = 0; i < node.GetChildCount(); ++i)
+    {
+      CollectWorldTransforms(*node.GetChildAt(i), world, rResult);
+    }
+  }
+
+  const Matrix* TryFindWorld(const FlatScene& scene, const UTF8String& name)
+  {
+    for (uint32_t i = 0; i < scene.NodeCount(); ++i)
+    {
+      if (scene.GetName(i) == name)
+      {
+        return &scene.GetWorldTransform(i);
+      }
+    }
+    return nullptr;
+  }
+
+  void ExpectSameHierarchy(const SceneNode& expected, const SceneNode& actual)
+  {
+    EXPECT_EQ(expected.GetName(), actual.GetName());
+    EXPECT_EQ(expected.GetTransformation(), actual.GetTransformation());
+    ASSERT_EQ(expected.GetMeshCount(), actual.GetMeshCount());
+    for (int32_t i = 0; i < expected.GetMeshCount(); ++i)
+    {
+      EXPECT_EQ(expected.GetMeshAt(i), actual.GetMeshAt(i));
+    }
+    ASSERT_EQ(expected.GetChildCount(), actual.GetChildCount());
+    for (int32_t i = 0; i < expected.GetChildCount(); ++i)
+    {
+      EXPECT_EQ(actual.GetChildAt(i)->GetParent().get(), &actual);
+      ExpectSameHierarchy(*expected.GetChildAt(i), *actual.GetChildAt(i));
+    }
+  }
+}
+
+
+TEST(TestBasicScene_FlatScene, Construct_Default)
+{
+  FlatScene scene;
+
+  EXPECT_TRUE(scene.IsEmpty());
+  EXPECT_EQ(0u, scene.NodeCount());
+  EXPECT_EQ(0u, scene.DepthCount());
+  EXPECT_EQ(nullptr, scene.CreateSceneNodeHierarchy());
+}
+
+
+TEST(TestBasicScene_FlatScene, Construct_EmptyScene)
+{
+  GenericScene<GenericMesh<VertexPosition, uint16_t>> genericScene;
+  FlatScene scene(genericScene);
+
+  EXPECT_TRUE(scene.IsEmpty());
+}
+
+
+TEST(TestBasicScene_FlatScene, Construct_BreadthFirstOrder)
+{
+  FlatScene scene(*CreateHierarchy());
+
+  ASSERT_EQ(7u, scene.NodeCount());
+  ASSERT_EQ(4u, scene.DepthCount());
+  EXPECT_EQ(0u, scene.GetDepthBegin(0));
+  EXPECT_EQ(1u, scene.GetDepthEnd(0));
+  EXPECT_EQ(1u, scene.GetDepthBegin(1));
+  EXPECT_EQ(3u, scene.GetDepthEnd(1));
+  EXPECT_EQ(3u, scene.GetDepthBegin(2));
+  EXPECT_EQ(6u, scene.GetDepthEnd(2));
+  EXPECT_EQ(6u, scene.GetDepthBegin(3));
+  EXPECT_EQ(7u, scene.GetDepthEnd(3));
+
+  const std::vector<std::string> expectedNames = {"root", "a", "b", "a0", "a1", "b0", "b00"};
+  const std::vector<uint32_t> expectedParents = {FlatScene::InvalidIndex, 0, 0, 1, 1, 2, 5};
+  for (uint32_t i = 0; i < scene.NodeCount(); ++i)
+  {
+    EXPECT_EQ(UTF8String(expectedNames[i]), scene.GetName(i));
+    EXPECT_EQ(expectedParents[i], scene.GetParentIndex(i));
+    EXPECT_EQ(expectedParents[i], scene.GetParentIndices()[i]);
+  }
+
+  EXPECT_EQ(0u, scene.GetMeshIndices(0).size());
+  ASSERT_EQ(1u, scene.GetMeshIndices(1).size());
+  EXPECT_EQ(1, scene.GetMeshIndices(1)[0]);
+  ASSERT_EQ(2u, scene.GetMeshIndices(4).size());
+  EXPECT_EQ(2, scene.GetMeshIndices(4)[0]);
+  EXPECT_EQ(3, scene.GetMeshIndices(4)[1]);
+  ASSERT_EQ(1u, scene.GetMeshIndices(6).size());
+  EXPECT_EQ(4, scene.GetMeshIndices(6)[0]);
+}
+
+
+TEST(TestBasicScene_FlatScene, Construct_Scene)
+{
+  GenericScene<GenericMesh<VertexPosition, uint16_t>> genericScene;
+  genericScene.SetRootNode(CreateHierarchy());
+
+  FlatScene scene(genericScene);
+  EXPECT_EQ(7u, scene.NodeCount());
+  EXPECT_EQ(4u, scene.DepthCount());
+}
+
+
+TEST(TestBasicScene_FlatScene, WorldTransforms_MatchRecursive)
+{
+  auto root = CreateHierarchy();
+  FlatScene scene(*root);
+
+  std::vector<Matrix> expected;
+  CollectWorldTransforms(*root, Matrix::GetIdentity(), expected);
+
+  // The recursive order is depth first so look the nodes up by name
+  std::vector<std::string> depthFirstNames = {"root", "a", "a0", "a1", "b", "b0", "b00"};
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    const Matrix* pWorld = TryFindWorld(scene, UTF8String(depthFirstNames[i]));
+    ASSERT_NE(nullptr, pWorld);
+    EXPECT_EQ(expected[i], *pWorld);
+  }
+}
+
+
+TEST(TestBasicScene_FlatScene, SetLocalTransform_UpdateWorldTransforms)
+{
+  FlatScene scene(*CreateHierarchy());
+
+  const Matrix newLocal = Matrix::CreateTranslation(10.0f, 0.0f, 0.0f);
+  scene.SetLocalTransform(2, newLocal);
+  // Not visible until the world transforms are updated
+  EXPECT_NE(scene.GetWorldTransform(0) * newLocal, scene.GetWorldTransform(2));
+
+  scene.UpdateWorldTransforms();
+  EXPECT_EQ(newLocal, scene.GetLocalTransform(2));
+  EXPECT_EQ(scene.GetWorldTransform(0) * newLocal, scene.GetWorldTransform(2));
+  EXPECT_EQ(scene.GetWorldTransform(2) * scene.GetLocalTransform(5), scene.GetWorldTransform(5));
+  EXPECT_EQ(scene.GetWorldTransform(5) * scene.GetLocalTransform(6), scene.GetWorldTransform(6));
+}
+
+
+TEST(TestBasicScene_FlatScene, UpdateWorldTransforms_PerDepthRange)
+{
+  FlatScene scene(*CreateHierarchy());
+  FlatScene reference(scene);
+
+  const std::vector<Matrix> newLocals = {Matrix::CreateScale(3.0f), Matrix::CreateRotationZ(0.1f)};
+  scene.SetLocalTransforms(1, ReadOnlySpan<Matrix>(newLocals.data(), newLocals.size()));
+  reference.SetLocalTransforms(1, ReadOnlySpan<Matrix>(newLocals.data(), newLocals.size()));
+  reference.UpdateWorldTransforms();
+
+  for (uint32_t depth = 0; depth < scene.DepthCount(); ++depth)
+  {
+    // Split every level into single node ranges
+    for (uint32_t i = scene.GetDepthBegin(depth); i < scene.GetDepthEnd(depth); ++i)
+    {
+      scene.UpdateWorldTransforms(i, i + 1);
+    }
+  }
+
+  for (uint32_t i = 0; i < scene.NodeCount(); ++i)
+  {
+    EXPECT_EQ(reference.GetWorldTransform(i), scene.GetWorldTransform(i));
+  }
+}
+
+
+TEST(TestBasicScene_FlatScene, UpdateWorldTransforms_JobSystem)
+{
+  // Create a wide hierarchy so the levels are split into multiple batches
+  auto root = CreateNode("root", Matrix::CreateTranslation(1.0f, 0.0f, 0.0f));
+  for (int32_t i = 0; i < 64; ++i)
+  {
+    auto child = CreateNode("child", Matrix::CreateRotationY(static_cast<float>(i) * 0.01f));
+    for (int32_t j = 0; j < 128; ++j)
+    {
+      child->AddChild(CreateNode("leaf", Matrix::CreateTranslation(static_cast<float>(j), 0.0f, 0.0f)));
+    }
+    root->AddChild(child);
+  }
+
+  FlatScene scene(*root);
+  FlatScene reference(scene);
+  scene.SetLocalTransform(0, Matrix::CreateScale(2.0f));
+  reference.SetLocalTransform(0, Matrix::CreateScale(2.0f));
+  reference.UpdateWorldTransforms();
+
+  JobSystem jobSystem(2);
+  scene.UpdateWorldTransforms(jobSystem);
+
+  ASSERT_EQ(reference.NodeCount(), scene.NodeCount());
+  for (uint32_t i = 0; i < scene.NodeCount(); ++i)
+  {
+    EXPECT_EQ(reference.GetWorldTransform(i), scene.GetWorldTransform(i));
+  }
+}
+
+
+TEST(TestBasicScene_FlatScene, CreateSceneNodeHierarchy_RoundTrip)
+{
+  auto root = CreateHierarchy();
+  FlatScene scene(*root);
+
+  auto recreated = scene.CreateSceneNodeHierarchy();
+  ASSERT_NE(nullptr, recreated);
+  ExpectSameHierarchy(*root, *recreated);
+}
+
+
+TEST(TestBasicScene_FlatScene, InvalidArguments)
+{
+  FlatScene scene(*CreateHierarchy());
+
+  EXPECT_THROW(scene.GetDepthBegin(4), std::invalid_argument);
+  EXPECT_THROW(scene.GetDepthEnd(4), std::invalid_argument);
+  EXPECT_THROW(scene.GetParentIndex(7), std::invalid_argument);
+  EXPECT_THROW(scene.GetName(7), std::invalid_argument);
+  EXPECT_THROW(scene.GetMeshIndices(7), std::invalid_argument);
+  EXPECT_THROW(scene.GetLocalTransform(7), std::invalid_argument);
+  EXPECT_THROW(scene.GetWorldTransform(7), std::invalid_argument);
+  EXPECT_THROW(scene.SetLocalTransform(7, Matrix::GetIdentity()), std::invalid_argument);
+  EXPECT_THROW(scene.UpdateWorldTransforms(3, 2), std::invalid_argument);
+  EXPECT_THROW(scene.UpdateWorldTransforms(0, 8), std::invalid_argument);
+
+  const std::vector<Matrix> locals(2);
+  EXPECT_THROW(scene.SetLocalTransforms(6, ReadOnlySpan<Matrix>(locals.data(), locals.size())), std::invalid_argument);
+}
@@ -0,0 +1,151 @@
+#ifndef FSLGRAPHICS3D_BASICSCENE_FLATSCENE_HPP
+#define FSLGRAPHICS3D_BASICSCENE_FLATSCENE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/UTF8String.hpp>
+#include <memory>
+#include <vector>
+
+namespace Fsl
+{
+  class JobSystem;
+}
+
+namespace Fsl::Graphics3D
+{
+  class Scene;
+  class SceneNode;
+
+  //! @brief A flat, data oriented copy of a SceneNode hierarchy.
+  //!        The nodes are stored breadth first which means that
+  //!        - every parent is stored before its children.
+  //!        - all nodes at the same depth are stored contiguously (depth 0 contains the root).
+  //!        - the children of a node are stored contiguously in the same order as in the source hierarchy.
+  //!        This allows the world transforms to be calculated in one linear pass over contiguous arrays
+  //!        and every depth level can be split into independent ranges that can be processed in parallel.
+  class FlatScene
+  {
+    //! The parent index of each node (InvalidIndex for the root)
+    std::vector<uint32_t> m_parentIndices;
+    //! The first node index of each depth level, contains DepthCount() + 1 entries.
+    std::vector<uint32_t> m_depthOffsets;
+    std::vector<Matrix> m_localTransforms;
+    std::vector<Matrix> m_worldTransforms;
+    std::vector<UTF8String> m_names;
+    //! The first mesh index entry of each node, contains NodeCount() + 1 entries.
+    std::vector<uint32_t> m_meshOffsets;
+    std::vector<int32_t> m_meshIndices;
+
+  public:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+    FlatScene() = default;
+
+    //! @brief Create a flat copy of the scene hierarchy (an empty scene results in a empty FlatScene).
+    explicit FlatScene(const Scene& scene);
+
+    //! @brief Create a flat copy of the hierarchy starting at the given node.
+    explicit FlatScene(const SceneNode& rootNode);
+
+    bool IsEmpty() const noexcept
+    {
+      return m_parentIndices.empty();
+    }
+
+    uint32_t NodeCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_parentIndices.size());
+    }
+
+    //! @brief The number of depth levels in the hierarchy
+    uint32_t DepthCount() const noexcept
+    {
+      return !m_depthOffsets.empty() ? static_cast<uint32_t>(m_depthOffsets.size() - 1u) : 0u;
+    }
+
+    //! @brief Get the index of the first node at the given depth
+    uint32_t GetDepthBegin(const uint32_t depth) const;
+
+    //! @brief Get the index one past the last node at the given depth
+    uint32_t GetDepthEnd(const uint32_t depth) const;
+
+    //! @brief Get the parent index of the node (InvalidIndex for the root)
+    uint32_t GetParentIndex(const uint32_t nodeIndex) const;
+
+    const UTF8String& GetName(const uint32_t nodeIndex) const;
+
+    //! @brief Get the mesh indices assigned to the node
+    ReadOnlySpan<int32_t> GetMeshIndices(const uint32_t nodeIndex) const;
+
+    ReadOnlySpan<uint32_t> GetParentIndices() const noexcept;
+    ReadOnlySpan<Matrix> GetLocalTransforms() const noexcept;
+
+    //! @brief Get the world transforms as calculated by the last UpdateWorldTransforms call.
+    ReadOnlySpan<Matrix> GetWorldTransforms() const noexcept;
+
+    //! @brief Get the transformation relative to the parent
+    const Matrix& GetLocalTransform(const uint32_t nodeIndex) const;
+
+    //! @brief Get the world transform as calculated by the last UpdateWorldTransforms call.
+    const Matrix& GetWorldTransform(const uint32_t nodeIndex) const;
+
+    //! @brief Set the transformation relative to the parent
+    void SetLocalTransform(const uint32_t nodeIndex, const Matrix& transformation);
+
+    //! @brief Set the transformation relative to the parent for a continuous range of nodes starting at the given index
+    void SetLocalTransforms(const uint32_t startIndex, const ReadOnlySpan<Matrix> transformations);
+
+    //! @brief Recalculate all world transforms.
+    void UpdateWorldTransforms() noexcept;
+
+    //! @brief Recalculate the world transforms of the nodes in the range [beginIndex, endIndex).
+    //! @note  The world transforms of the parents must be up to date, this is the case if the range is inside one depth level
+    //!        and all previous depth levels have been updated. Ranges inside the same depth level can be updated in parallel.
+    void UpdateWorldTransforms(const uint32_t beginIndex, const uint32_t endIndex);
+
+    //! @brief Recalculate all world transforms using the job system.
+    //!        The depth levels are processed in order and each level is split into batches that are processed in parallel.
+    void UpdateWorldTransforms(JobSystem& rJobSystem);
+
+    //! @brief Recreate the SceneNode hierarchy (names, meshes and local transforms) from the flat representation.
+    //! @return the root node or null if the FlatScene is empty.
+    std::shared_ptr<SceneNode> CreateSceneNodeHierarchy() const;
+
+  private:
+    void UncheckedUpdateWorldTransforms(const uint32_t beginIndex, const uint32_t endIndex) noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,310 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics3D/BasicScene/FlatScene.hpp>
+#include <FslGraphics3D/BasicScene/Scene.hpp>
+#include <FslGraphics3D/BasicScene/SceneNode.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Fsl::Graphics3D
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The minimum number of nodes processed by one job, a matrix multiply is cheap so small batches are not worth scheduling.
+      constexpr std::size_t MinParallelBatchSize = 2048;
+    }
+
+    struct PendingNode
+    {
+      const SceneNode* pNode{nullptr};
+      uint32_t ParentIndex{FlatScene::InvalidIndex};
+    };
+  }
+
+
+  FlatScene::FlatScene(const Scene& scene)
+  {
+    const std::shared_ptr<SceneNode> rootNode = scene.GetRootNode();
+    if (rootNode)
+    {
+      *this = FlatScene(*rootNode);
+    }
+  }
+
+
+  FlatScene::FlatScene(const SceneNode& rootNode)
+  {
+    // Breadth first traversal, one depth level at a time
+    std::vector<PendingNode> currentLevel;
+    std::vector<PendingNode> nextLevel;
+    currentLevel.push_back(PendingNode{&rootNode, InvalidIndex});
+
+    m_meshOffsets.push_back(0u);
+    while (!currentLevel.empty())
+    {
+      m_depthOffsets.push_back(NodeCount());
+      for (const PendingNode& entry : currentLevel)
+      {
+        const uint32_t nodeIndex = NodeCount();
+        if (nodeIndex >= InvalidIndex)
+        {
+          throw NotSupportedException("Too many scene nodes");
+        }
+        const SceneNode& node = *entry.pNode;
+        m_parentIndices.push_back(entry.ParentIndex);
+        m_localTransforms.push_back(node.GetTransformation());
+        m_names.push_back(node.GetName());
+
+        const int32_t meshCount = node.GetMeshCount();
+        for (int32_t i = 0; i < meshCount; ++i)
+        {
+          m_meshIndices.push_back(node.GetMeshAt(i));
+        }
+        m_meshOffsets.push_back(NumericCast<uint32_t>(m_meshIndices.size()));
+
+        const int32_t childCount = node.GetChildCount();
+        for (int32_t i = 0; i < childCount; ++i)
+        {
+          // The parent node owns the child so the raw pointer stays valid during the traversal
+          nextLevel.push_back(PendingNode{node.GetChildAt(i).get(), nodeIndex});
+        }
+      }
+      std::swap(currentLevel, nextLevel);
+      nextLevel.clear();
+    }
+    m_depthOffsets.push_back(NodeCount());
+
+    m_worldTransforms.resize(m_localTransforms.size());
+    UpdateWorldTransforms();
+  }
+
+
+  uint32_t FlatScene::GetDepthBegin(const uint32_t depth) const
+  {
+    if (depth >= DepthCount())
+    {
+      throw std::invalid_argument("depth out of bounds");
+    }
+    return m_depthOffsets[depth];
+  }
+
+
+  uint32_t FlatScene::GetDepthEnd(const uint32_t depth) const
+  {
+    if (depth >= DepthCount())
+    {
+      throw std::invalid_argument("depth out of bounds");
+    }
+    return m_depthOffsets[depth + 1u];
+  }
+
+
+  uint32_t FlatScene::GetParentIndex(const uint32_t nodeIndex) const
+  {
+    if (nodeIndex >= m_parentIndices.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    return m_parentIndices[nodeIndex];
+  }
+
+
+  const UTF8String& FlatScene::GetName(const uint32_t nodeIndex) const
+  {
+    if (nodeIndex >= m_names.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    return m_names[nodeIndex];
+  }
+
+
+  ReadOnlySpan<int32_t> FlatScene::GetMeshIndices(const uint32_t nodeIndex) const
+  {
+    if (nodeIndex >= m_parentIndices.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    const uint32_t offset = m_meshOffsets[nodeIndex];
+    return SpanUtil::UncheckedAsReadOnlySpan(m_meshIndices, offset, m_meshOffsets[nodeIndex + 1u] - offset);
+  }
+
+
+  ReadOnlySpan<uint32_t> FlatScene::GetParentIndices() const noexcept
+  {
+    return SpanUtil::AsReadOnlySpan(m_parentIndices);
+  }
+
+
+  ReadOnlySpan<Matrix> FlatScene::GetLocalTransforms() const noexcept
+  {
+    return SpanUtil::AsReadOnlySpan(m_localTransforms);
+  }
+
+
+  ReadOnlySpan<Matrix> FlatScene::GetWorldTransforms() const noexcept
+  {
+    return SpanUtil::AsReadOnlySpan(m_worldTransforms);
+  }
+
+
+  const Matrix& FlatScene::GetLocalTransform(const uint32_t nodeIndex) const
+  {
+    if (nodeIndex >= m_localTransforms.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    return m_localTransforms[nodeIndex];
+  }
+
+
+  const Matrix& FlatScene::GetWorldTransform(const uint32_t nodeIndex) const
+  {
+    if (nodeIndex >= m_worldTransforms.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    return m_worldTransforms[nodeIndex];
+  }
+
+
+  void FlatScene::SetLocalTransform(const uint32_t nodeIndex, const Matrix& transformation)
+  {
+    if (nodeIndex >= m_localTransforms.size())
+    {
+      throw std::invalid_argument("nodeIndex out of bounds");
+    }
+    m_localTransforms[nodeIndex] = transformation;
+  }
+
+
+  void FlatScene::SetLocalTransforms(const uint32_t startIndex, const ReadOnlySpan<Matrix> transformations)
+  {
+    if (startIndex > m_localTransforms.size() || transformations.size() > (m_localTransforms.size() - startIndex))
+    {
+      throw std::invalid_argument("transformations out of bounds");
+    }
+    std::copy(transformations.begin(), transformations.end(), m_localTransforms.begin() + startIndex);
+  }
+
+
+  void FlatScene::UpdateWorldTransforms() noexcept
+  {
+    UncheckedUpdateWorldTransforms(0u, NodeCount());
+  }
+
+
+  void FlatScene::UpdateWorldTransforms(const uint32_t beginIndex, const uint32_t endIndex)
+  {
+    if (beginIndex > endIndex || endIndex > NodeCount())
+    {
+      throw std::invalid_argument("range out of bounds");
+    }
+    UncheckedUpdateWorldTransforms(beginIndex, endIndex);
+  }
+
+
+  void FlatScene::UpdateWorldTransforms(JobSystem& rJobSystem)
+  {
+    const uint32_t depthCount = DepthCount();
+    for (uint32_t depth = 0; depth < depthCount; ++depth)
+    {
+      const uint32_t depthBegin = m_depthOffsets[depth];
+      const uint32_t depthEnd = m_depthOffsets[depth + 1u];
+      rJobSystem.ParallelForRange(depthEnd - depthBegin, LocalConfig::MinParallelBatchSize,
+                                  [this, depthBegin](const std::size_t offset, const std::size_t count)
+                                  {
+                                    const auto beginIndex = static_cast<uint32_t>(depthBegin + offset);
+                                    UncheckedUpdateWorldTransforms(beginIndex, static_cast<uint32_t>(beginIndex + count));
+                                  });
+    }
+  }
+
+
+  std::shared_ptr<SceneNode> FlatScene::CreateSceneNodeHierarchy() const
+  {
+    if (m_parentIndices.empty())
+    {
+      return {};
+    }
+
+    // Parents are always stored before their children and siblings are stored in order, so one pass recreates the hierarchy
+    std::vector<std::shared_ptr<SceneNode>> nodes(m_parentIndices.size());
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+      const uint32_t meshBegin = m_meshOffsets[i];
+      const uint32_t meshEnd = m_meshOffsets[i + 1u];
+      auto node = std::make_shared<SceneNode>(meshEnd - meshBegin);
+      node->SetName(m_names[i]);
+      node->SetTransformation(m_localTransforms[i]);
+      for (uint32_t meshIndex = meshBegin; meshIndex < meshEnd; ++meshIndex)
+      {
+        node->AddMesh(m_meshIndices[meshIndex]);
+      }
+
+      const uint32_t parentIndex = m_parentIndices[i];
+      if (parentIndex != InvalidIndex)
+      {
+        nodes[parentIndex]->AddChild(node);
+      }
+      nodes[i] = std::move(node);
+    }
+    return nodes.front();
+  }
+
+
+  void FlatScene::UncheckedUpdateWorldTransforms(const uint32_t beginIndex, const uint32_t endIndex) noexcept
+  {
+    const uint32_t* const pParentIndices = m_parentIndices.data();
+    const Matrix* const pLocal = m_localTransforms.data();
+    Matrix* const pWorld = m_worldTransforms.data();
+    const Matrix* const pParentWorld = pWorld;
+
+    uint32_t index = beginIndex;
+    // Only the root has no parent and it is always stored first
+    if (index == 0u && index < endIndex)
+    {
+      pWorld[0] = pLocal[0];
+      ++index;
+    }
+    for (; index < endIndex; ++index)
+    {
+      Matrix::Multiply(pParentWorld[pParentIndices[index]], pLocal[index], pWorld[index]);
+    }
+  }
+}
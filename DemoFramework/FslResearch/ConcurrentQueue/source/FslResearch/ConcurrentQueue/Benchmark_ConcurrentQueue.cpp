@@ -0,0 +1,176 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/BoundedMPMCQueue.hpp>
+#include <FslBase/Collections/Concurrent/BoundedSPSCQueue.hpp>
+#include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
+#include <FslService/Impl/Foundation/Message/BasicMessageQueue.hpp>
+#include <FslService/Impl/Registry/ServiceGroupId.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t MessagesPerIteration = 64 * 1024;
+    constexpr uint32_t RingBufferCapacity = 1024;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+  // Each iteration: N producer threads push MessagesPerIteration messages in total while the benchmark thread consumes them all.
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <typename TFnProduce, typename TFnConsume>
+  void RunProducersConsumer(benchmark::State& state, TFnProduce fnProduce, TFnConsume fnConsume)
+  {
+    const auto producerCount = static_cast<uint32_t>(state.range(0));
+    const uint32_t messagesPerProducer = LocalConfig::MessagesPerIteration / producerCount;
+    const uint32_t totalMessages = messagesPerProducer * producerCount;
+
+    for (auto _ : state)
+    {
+      std::vector<std::thread> producers;
+      producers.reserve(producerCount);
+      for (uint32_t i = 0; i < producerCount; ++i)
+      {
+        producers.emplace_back(
+          [&fnProduce, messagesPerProducer]()
+          {
+            for (uint32_t j = 0; j < messagesPerProducer; ++j)
+            {
+              fnProduce(j);
+            }
+          });
+      }
+
+      uint32_t consumed = 0;
+      while (consumed < totalMessages)
+      {
+        const uint32_t count = fnConsume();
+        if (count == 0u)
+        {
+          std::this_thread::yield();
+        }
+        consumed += count;
+      }
+
+      for (auto& rThread : producers)
+      {
+        rThread.join();
+      }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * totalMessages);
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  void ConcurrentQueue_UInt32(benchmark::State& state)
+  {
+    ConcurrentQueue<uint32_t> queue;
+    std::queue<uint32_t> swapQueue;
+    RunProducersConsumer(
+      state, [&queue](const uint32_t value) { queue.Enqueue(value); },
+      [&queue, &swapQueue]() -> uint32_t
+      {
+        queue.SwapQueue(swapQueue);
+        const auto count = static_cast<uint32_t>(swapQueue.size());
+        swapQueue = {};
+        return count;
+      });
+  }
+
+
+  void BoundedMPMCQueue_UInt32(benchmark::State& state)
+  {
+    BoundedMPMCQueue<uint32_t> queue(LocalConfig::RingBufferCapacity);
+    std::vector<uint32_t> batch(256);
+    RunProducersConsumer(
+      state,
+      [&queue](const uint32_t value)
+      {
+        while (!queue.TryEnqueue(value))
+        {
+          std::this_thread::yield();
+        }
+      },
+      [&queue, &batch]() -> uint32_t { return static_cast<uint32_t>(queue.TryDequeue(Span<uint32_t>(batch.data(), batch.size()))); });
+  }
+
+  // SPSC is only valid for one producer so it is registered separately
+
+  void BoundedSPSCQueue_UInt32(benchmark::State& state)
+  {
+    BoundedSPSCQueue<uint32_t> queue(LocalConfig::RingBufferCapacity);
+    std::vector<uint32_t> batch(256);
+    RunProducersConsumer(
+      state,
+      [&queue](const uint32_t value)
+      {
+        while (!queue.TryEnqueue(value))
+        {
+          std::this_thread::yield();
+        }
+      },
+      [&queue, &batch]() -> uint32_t { return static_cast<uint32_t>(queue.TryDequeue(Span<uint32_t>(batch.data(), batch.size()))); });
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <BasicMessageQueueBackend TBackend>
+  void BasicMessageQueue_Message(benchmark::State& state)
+  {
+    BasicMessageQueue queue(ServiceGroupId::Invalid(), TBackend);
+    auto content = std::make_shared<Message>();
+    std::queue<BasicMessage> dstQueue;
+    RunProducersConsumer(
+      state, [&queue, &content](const uint32_t /*value*/) { queue.Push(BasicMessage(BasicMessageType::FireAndForgetMessage, content)); },
+      [&queue, &dstQueue]() -> uint32_t
+      {
+        queue.TryPopWait(dstQueue, std::chrono::milliseconds(1));
+        const auto count = static_cast<uint32_t>(dstQueue.size());
+        dstQueue = {};
+        return count;
+      });
+  }
+}
+
+BENCHMARK(ConcurrentQueue_UInt32)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BoundedMPMCQueue_UInt32)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BoundedSPSCQueue_UInt32)->Arg(1)->UseRealTime();
+
+BENCHMARK(BasicMessageQueue_Message<BasicMessageQueueBackend::Mutex>)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BasicMessageQueue_Message<BasicMessageQueueBackend::LockFree>)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,246 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/Bind/MultiConverterBinding.hpp>
+#include <FslDataBinding/Base/Binding.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslDataBinding/Base/Object/DependencyObject.hpp>
+#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    //! The number of bindings per changed source (a telemetry channel is typically shown by several charts and labels)
+    constexpr std::size_t BindingsPerSource = 10;
+  }
+
+  class BenchmarkObject final : public DataBinding::DependencyObject
+  {
+    DataBinding::TypedDependencyProperty<float> m_property0;
+
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition Property0;
+
+    explicit BenchmarkObject(const std::shared_ptr<DataBinding::DataBindingService>& dataBinding)
+      : DataBinding::DependencyObject(dataBinding)
+    {
+    }
+
+    float GetProperty0Value() const noexcept
+    {
+      return m_property0.Get();
+    }
+
+    bool SetProperty0Value(const float value)
+    {
+      return m_property0.Set(ThisDependencyObject(), value);
+    }
+
+  protected:
+    DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final
+    {
+      using namespace DataBinding;
+      auto res = DependencyObjectHelper::TryGetPropertyHandle(this, ThisDependencyObject(), sourceDef, PropLinkRefs(Property0, m_property0));
+      return res.IsValid() ? res : DependencyObject::TryGetPropertyHandleNow(sourceDef);
+    }
+
+    DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                           const DataBinding::Binding& binding) final
+    {
+      using namespace DataBinding;
+      auto res = DependencyObjectHelper::TrySetBinding(this, ThisDependencyObject(), targetDef, binding, PropLinkRefs(Property0, m_property0));
+      return res != PropertySetBindingResult::NotFound ? res : DependencyObject::TrySetBindingNow(targetDef, binding);
+    }
+  };
+
+  DataBinding::DependencyPropertyDefinition BenchmarkObject::Property0 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<float, BenchmarkObject, &BenchmarkObject::GetProperty0Value,
+                                                             &BenchmarkObject::SetProperty0Value>("Property0");
+
+
+  //! A binding graph where the service is declared first so it outlives the objects
+  struct BindingGraph
+  {
+    std::shared_ptr<DataBinding::DataBindingService> Service;
+    std::vector<std::unique_ptr<BenchmarkObject>> Sources;
+    std::vector<std::unique_ptr<BenchmarkObject>> Targets;
+
+    BindingGraph(const std::size_t sourceCount, const std::size_t targetCount)
+      : Service(std::make_shared<DataBinding::DataBindingService>())
+      , Sources(sourceCount)
+      , Targets(targetCount)
+    {
+      for (auto& rSource : Sources)
+      {
+        rSource = std::make_unique<BenchmarkObject>(Service);
+      }
+      for (auto& rTarget : Targets)
+      {
+        rTarget = std::make_unique<BenchmarkObject>(Service);
+      }
+    }
+
+    ~BindingGraph()
+    {
+      // The service keeps its instances in creation order, so destroying them in reverse order avoids moving the remaining instances
+      while (!Targets.empty())
+      {
+        Targets.pop_back();
+      }
+      while (!Sources.empty())
+      {
+        Sources.pop_back();
+      }
+      Service->ExecuteChanges();
+    }
+
+    BindingGraph(const BindingGraph&) = delete;
+    BindingGraph& operator=(const BindingGraph&) = delete;
+
+    //! Every target is bound to one of the sources
+    void BindFanOut()
+    {
+      for (std::size_t i = 0; i < Targets.size(); ++i)
+      {
+        Targets[i]->SetBinding(BenchmarkObject::Property0, Sources[i % Sources.size()]->GetPropertyHandle(BenchmarkObject::Property0));
+      }
+    }
+
+    //! The first half of the targets are bound to the sources and the second half combines two of those, so every target in the second half is
+    //! reachable through two paths from its source.
+    void BindDiamonds()
+    {
+      const std::size_t firstHalf = Targets.size() / 2u;
+      for (std::size_t i = 0; i < firstHalf; ++i)
+      {
+        Targets[i]->SetBinding(BenchmarkObject::Property0, Sources[i % Sources.size()]->GetPropertyHandle(BenchmarkObject::Property0));
+      }
+      auto convertingBinding = std::make_shared<DataBinding::MultiConverterBinding<float, float, float>>(
+        [](const float value0, const float value1) { return value0 + value1; });
+      for (std::size_t i = firstHalf; i < Targets.size(); ++i)
+      {
+        // Pick two first half targets that are bound to the same source
+        const std::size_t index0 = (i - firstHalf) % firstHalf;
+        const std::size_t index1 = (index0 + Sources.size()) % firstHalf;
+        Targets[i]->SetBinding(BenchmarkObject::Property0,
+                               DataBinding::Binding(convertingBinding, Targets[index0]->GetPropertyHandle(BenchmarkObject::Property0),
+                                                    Targets[index1]->GetPropertyHandle(BenchmarkObject::Property0)));
+      }
+    }
+
+    void ChangeAllSources(const float value)
+    {
+      for (auto& rSource : Sources)
+      {
+        rSource->SetProperty0Value(value);
+      }
+    }
+  };
+
+
+  std::size_t ToSourceCount(const std::size_t bindingCount)
+  {
+    return std::max(bindingCount / LocalConfig::BindingsPerSource, std::size_t(1));
+  }
+
+
+  void Propagate_FanOut(benchmark::State& state)
+  {
+    const auto bindingCount = static_cast<std::size_t>(state.range(0));
+    BindingGraph graph(ToSourceCount(bindingCount), bindingCount);
+    graph.BindFanOut();
+    graph.Service->ExecuteChanges();
+
+    float value = 0.0f;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      value += 1.0f;
+      graph.ChangeAllSources(value);
+      graph.Service->ExecuteChanges();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  void Propagate_Diamonds(benchmark::State& state)
+  {
+    const auto bindingCount = static_cast<std::size_t>(state.range(0));
+    BindingGraph graph(ToSourceCount(bindingCount), bindingCount);
+    graph.BindDiamonds();
+    graph.Service->ExecuteChanges();
+
+    float value = 0.0f;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      value += 1.0f;
+      graph.ChangeAllSources(value);
+      graph.Service->ExecuteChanges();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  //! Measures the cost of creating the bindings (which includes the cyclic dependency checks)
+  void SetBinding_Diamonds(benchmark::State& state)
+  {
+    const auto bindingCount = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      {
+        BindingGraph graph(ToSourceCount(bindingCount), bindingCount);
+        state.ResumeTiming();
+
+        // This code gets timed
+        graph.BindDiamonds();
+
+        state.PauseTiming();
+      }
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+}
+
+BENCHMARK(Propagate_FanOut)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Propagate_Diamonds)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SetBinding_Diamonds)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,269 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingBox.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/BoundingSphere.hpp>
+#include <FslBase/Math/FrustumCullUtil.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr std::size_t GridSize = 47;
+    constexpr float Spacing = 4.0f;
+  }
+
+  //! A camera inside a large grid of objects, roughly a sixth of the objects are visible.
+  BoundingFrustum CreateFrustum(const float yaw)
+  {
+    return BoundingFrustum(Matrix::CreateRotationY(yaw) * Matrix::CreatePerspectiveFieldOfView(1.0f, 16.0f / 9.0f, 0.5f, 150.0f));
+  }
+
+  Vector3 CreatePosition(const std::size_t index)
+  {
+    constexpr float Offset = static_cast<float>(LocalConfig::GridSize) * LocalConfig::Spacing * 0.5f;
+    const auto x = static_cast<float>(index % LocalConfig::GridSize);
+    const auto y = static_cast<float>((index / LocalConfig::GridSize) % LocalConfig::GridSize);
+    const auto z = static_cast<float>(index / (LocalConfig::GridSize * LocalConfig::GridSize));
+    return {(x * LocalConfig::Spacing) - Offset, (y * LocalConfig::Spacing) - Offset, (z * LocalConfig::Spacing) - Offset};
+  }
+
+  struct BoxData
+  {
+    std::vector<BoundingBox> Boxes;
+    std::vector<float> MinX;
+    std::vector<float> MinY;
+    std::vector<float> MinZ;
+    std::vector<float> MaxX;
+    std::vector<float> MaxY;
+    std::vector<float> MaxZ;
+
+    explicit BoxData(const std::size_t count)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const Vector3 position = CreatePosition(i);
+        const BoundingBox box(position - Vector3(1.0f, 1.0f, 1.0f), position + Vector3(1.0f, 1.0f, 1.0f));
+        Boxes.push_back(box);
+        MinX.push_back(box.Min.X);
+        MinY.push_back(box.Min.Y);
+        MinZ.push_back(box.Min.Z);
+        MaxX.push_back(box.Max.X);
+        MaxY.push_back(box.Max.Y);
+        MaxZ.push_back(box.Max.Z);
+      }
+    }
+
+    FrustumCullUtil::BoundingBoxSpans AsSpans() const
+    {
+      return {SpanUtil::AsReadOnlySpan(MinX), SpanUtil::AsReadOnlySpan(MinY), SpanUtil::AsReadOnlySpan(MinZ),
+              SpanUtil::AsReadOnlySpan(MaxX), SpanUtil::AsReadOnlySpan(MaxY), SpanUtil::AsReadOnlySpan(MaxZ)};
+    }
+  };
+
+  struct SphereData
+  {
+    std::vector<BoundingSphere> Spheres;
+    std::vector<float> CenterX;
+    std::vector<float> CenterY;
+    std::vector<float> CenterZ;
+    std::vector<float> Radius;
+
+    explicit SphereData(const std::size_t count)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const BoundingSphere sphere(CreatePosition(i), 1.5f);
+        Spheres.push_back(sphere);
+        CenterX.push_back(sphere.Center.X);
+        CenterY.push_back(sphere.Center.Y);
+        CenterZ.push_back(sphere.Center.Z);
+        Radius.push_back(sphere.Radius);
+      }
+    }
+
+    FrustumCullUtil::BoundingSphereSpans AsSpans() const
+    {
+      return {SpanUtil::AsReadOnlySpan(CenterX), SpanUtil::AsReadOnlySpan(CenterY), SpanUtil::AsReadOnlySpan(CenterZ),
+              SpanUtil::AsReadOnlySpan(Radius)};
+    }
+  };
+
+  //! The camera turns a little every frame, so the plane cache sees realistic frame to frame coherency.
+  float NextYaw(const float yaw)
+  {
+    return yaw + 0.01f;
+  }
+}
+
+
+static void Boxes_Scalar(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const BoxData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    const BoundingFrustum frustum = CreateFrustum(yaw);
+    std::fill(mask.begin(), mask.end(), 0u);
+    visibleCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (frustum.Intersects(data.Boxes[i]))
+      {
+        mask[i / 32u] |= 1u << (i % 32u);
+        ++visibleCount;
+      }
+    }
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Boxes_Scalar)->Arg(100000);
+
+
+static void Boxes_Batch(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const BoxData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    visibleCount = FrustumCullUtil::Cull(CreateFrustum(yaw), data.AsSpans(), SpanUtil::AsSpan(mask));
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Boxes_Batch)->Arg(100000);
+
+
+static void Boxes_Batch_PlaneCache(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const BoxData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(count), FrustumCullUtil::InvalidPlaneIndex);
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    visibleCount = FrustumCullUtil::Cull(CreateFrustum(yaw), data.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(mask));
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Boxes_Batch_PlaneCache)->Arg(100000);
+
+
+static void Spheres_Scalar(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const SphereData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    const BoundingFrustum frustum = CreateFrustum(yaw);
+    std::fill(mask.begin(), mask.end(), 0u);
+    visibleCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (frustum.Intersects(data.Spheres[i]))
+      {
+        mask[i / 32u] |= 1u << (i % 32u);
+        ++visibleCount;
+      }
+    }
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Spheres_Scalar)->Arg(100000);
+
+
+static void Spheres_Batch(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const SphereData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    visibleCount = FrustumCullUtil::Cull(CreateFrustum(yaw), data.AsSpans(), SpanUtil::AsSpan(mask));
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Spheres_Batch)->Arg(100000);
+
+
+static void Spheres_Batch_PlaneCache(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const SphereData data(count);
+  std::vector<uint32_t> mask(FrustumCullUtil::CalcMaskWordCount(count));
+  std::vector<uint8_t> planeCache(FrustumCullUtil::CalcPlaneCacheSize(count), FrustumCullUtil::InvalidPlaneIndex);
+  float yaw = 0.0f;
+  std::size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    visibleCount = FrustumCullUtil::Cull(CreateFrustum(yaw), data.AsSpans(), SpanUtil::AsSpan(planeCache), SpanUtil::AsSpan(mask));
+    benchmark::DoNotOptimize(mask.data());
+    yaw = NextYaw(yaw);
+  }
+  state.counters["Visible"] = static_cast<double>(visibleCount);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Spheres_Batch_PlaneCache)->Arg(100000);
@@ -0,0 +1,371 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Math/Quaternion.hpp>
+#include <FslBase/Math/TransformUtil.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Math/Vector4.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    //! The number of matrices/quaternions processed per iteration of the per-element benchmarks
+    constexpr std::size_t ElementCount = 1024;
+  }
+
+  // The scalar reference versions below match the code the SIMD paths replaced.
+  // Building with FSL_MATH_SIMD_DISABLED defined makes the library versions scalar as well.
+
+  void ScalarMultiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& rResult)
+  {
+    const float* pLhs = matrix1.DirectAccess();
+    const float* pRhs = matrix2.DirectAccess();
+    float* pDst = rResult.DirectAccess();
+    for (std::size_t row = 0; row < 4; ++row)
+    {
+      for (std::size_t column = 0; column < 4; ++column)
+      {
+        pDst[(row * 4) + column] = (((pLhs[(row * 4) + 0] * pRhs[column]) + (pLhs[(row * 4) + 1] * pRhs[4 + column])) +
+                                    (pLhs[(row * 4) + 2] * pRhs[8 + column])) +
+                                   (pLhs[(row * 4) + 3] * pRhs[12 + column]);
+      }
+    }
+  }
+
+
+  Vector4 ScalarTransform(const Vector4& vector, const Matrix& matrix)
+  {
+    const float* pM = matrix.DirectAccess();
+    return {(((vector.X * pM[0]) + (vector.Y * pM[4])) + (vector.Z * pM[8])) + (vector.W * pM[12]),
+            (((vector.X * pM[1]) + (vector.Y * pM[5])) + (vector.Z * pM[9])) + (vector.W * pM[13]),
+            (((vector.X * pM[2]) + (vector.Y * pM[6])) + (vector.Z * pM[10])) + (vector.W * pM[14]),
+            (((vector.X * pM[3]) + (vector.Y * pM[7])) + (vector.Z * pM[11])) + (vector.W * pM[15])};
+  }
+
+
+  Vector3 ScalarTransform(const Vector3& vector, const Matrix& matrix)
+  {
+    const float* pM = matrix.DirectAccess();
+    return {(((vector.X * pM[0]) + (vector.Y * pM[4])) + (vector.Z * pM[8])) + pM[12],
+            (((vector.X * pM[1]) + (vector.Y * pM[5])) + (vector.Z * pM[9])) + pM[13],
+            (((vector.X * pM[2]) + (vector.Y * pM[6])) + (vector.Z * pM[10])) + pM[14]};
+  }
+
+
+  Quaternion ScalarSlerp(const Quaternion& quaternion1, const Quaternion& quaternion2, const float amount)
+  {
+    float dot =
+      (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
+    const bool flip = dot < 0.0f;
+    if (flip)
+    {
+      dot = -dot;
+    }
+    float weight1 = 1.0f - amount;
+    float weight2 = flip ? -amount : amount;
+    if (dot <= 0.999999f)
+    {
+      const auto angle = static_cast<float>(std::acos(static_cast<double>(dot)));
+      const auto invSin = static_cast<float>(1.0 / std::sin(static_cast<double>(angle)));
+      weight1 = static_cast<float>(std::sin(static_cast<double>((1.0f - amount) * angle))) * invSin;
+      weight2 = static_cast<float>(std::sin(static_cast<double>(amount * angle))) * (flip ? -invSin : invSin);
+    }
+    return {(weight1 * quaternion1.X) + (weight2 * quaternion2.X), (weight1 * quaternion1.Y) + (weight2 * quaternion2.Y),
+            (weight1 * quaternion1.Z) + (weight2 * quaternion2.Z), (weight1 * quaternion1.W) + (weight2 * quaternion2.W)};
+  }
+
+
+  std::vector<Matrix> CreateMatrices(const std::size_t count)
+  {
+    std::vector<Matrix> matrices(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i % 97);
+      matrices[i] = Matrix::CreateRotationY(value * 0.01f) * Matrix::CreateScale(1.0f + (value * 0.01f)) *
+                    Matrix::CreateTranslation(value * 0.1f, 1.0f, -value);
+    }
+    return matrices;
+  }
+
+
+  std::vector<Quaternion> CreateQuaternions(const std::size_t count)
+  {
+    std::vector<Quaternion> quaternions(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i % 97);
+      quaternions[i] = Quaternion::CreateFromYawPitchRoll(value * 0.05f, value * 0.02f, value * 0.01f);
+    }
+    return quaternions;
+  }
+
+
+  template <typename T>
+  std::vector<T> CreateVectors(const std::size_t count)
+  {
+    std::vector<T> vectors(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i % 1013);
+      if constexpr (std::is_same_v<T, Vector4>)
+      {
+        vectors[i] = Vector4(value, value * 0.5f, -value, 1.0f);
+      }
+      else
+      {
+        vectors[i] = Vector3(value, value * 0.5f, -value);
+      }
+    }
+    return vectors;
+  }
+}
+
+
+static void Matrix_Multiply_Scalar(benchmark::State& state)
+{
+  const std::vector<Matrix> matrices = CreateMatrices(LocalConfig::ElementCount);
+  const Matrix view = Matrix::CreateLookAt(Vector3(0.0f, 5.0f, 10.0f), Vector3(), Vector3::Up());
+  std::vector<Matrix> result(matrices.size());
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < matrices.size(); ++i)
+    {
+      ScalarMultiply(matrices[i], view, result[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrices.size()));
+}
+BENCHMARK(Matrix_Multiply_Scalar);
+
+
+static void Matrix_Multiply(benchmark::State& state)
+{
+  const std::vector<Matrix> matrices = CreateMatrices(LocalConfig::ElementCount);
+  const Matrix view = Matrix::CreateLookAt(Vector3(0.0f, 5.0f, 10.0f), Vector3(), Vector3::Up());
+  std::vector<Matrix> result(matrices.size());
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < matrices.size(); ++i)
+    {
+      Matrix::Multiply(matrices[i], view, result[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrices.size()));
+}
+BENCHMARK(Matrix_Multiply);
+
+
+static void Matrix_Invert(benchmark::State& state)
+{
+  const std::vector<Matrix> matrices = CreateMatrices(LocalConfig::ElementCount);
+  std::vector<Matrix> result(matrices.size());
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < matrices.size(); ++i)
+    {
+      Matrix::Invert(matrices[i], result[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrices.size()));
+}
+BENCHMARK(Matrix_Invert);
+
+
+static void Vector3_Transform_Scalar(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::vector<Vector3> src = CreateVectors<Vector3>(count);
+  const Matrix matrix = CreateMatrices(2).back();
+  std::vector<Vector3> dst(count);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      dst[i] = ScalarTransform(src[i], matrix);
+    }
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Vector3_Transform_Scalar)->Arg(10000)->Arg(100000);
+
+
+static void Vector3_Transform_PerElement(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::vector<Vector3> src = CreateVectors<Vector3>(count);
+  const Matrix matrix = CreateMatrices(2).back();
+  std::vector<Vector3> dst(count);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Vector3::Transform(src[i], matrix, dst[i]);
+    }
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Vector3_Transform_PerElement)->Arg(10000)->Arg(100000);
+
+
+static void Vector3_Transform_Batch(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::vector<Vector3> src = CreateVectors<Vector3>(count);
+  const Matrix matrix = CreateMatrices(2).back();
+  std::vector<Vector3> dst(count);
+  for (auto _ : state)
+  {
+    TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Vector3_Transform_Batch)->Arg(10000)->Arg(100000);
+
+
+static void Vector4_Transform_Scalar(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::vector<Vector4> src = CreateVectors<Vector4>(count);
+  const Matrix matrix = CreateMatrices(2).back();
+  std::vector<Vector4> dst(count);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      dst[i] = ScalarTransform(src[i], matrix);
+    }
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Vector4_Transform_Scalar)->Arg(10000)->Arg(100000);
+
+
+static void Vector4_Transform_Batch(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::vector<Vector4> src = CreateVectors<Vector4>(count);
+  const Matrix matrix = CreateMatrices(2).back();
+  std::vector<Vector4> dst(count);
+  for (auto _ : state)
+  {
+    TransformUtil::Transform(SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(Vector4_Transform_Batch)->Arg(10000)->Arg(100000);
+
+
+static void Quaternion_Slerp_Scalar(benchmark::State& state)
+{
+  const std::vector<Quaternion> quaternions = CreateQuaternions(LocalConfig::ElementCount + 1);
+  std::vector<Quaternion> result(LocalConfig::ElementCount);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+      result[i] = ScalarSlerp(quaternions[i], quaternions[i + 1], 0.3f);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size()));
+}
+BENCHMARK(Quaternion_Slerp_Scalar);
+
+
+static void Quaternion_Slerp(benchmark::State& state)
+{
+  const std::vector<Quaternion> quaternions = CreateQuaternions(LocalConfig::ElementCount + 1);
+  std::vector<Quaternion> result(LocalConfig::ElementCount);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+      Quaternion::Slerp(result[i], quaternions[i], quaternions[i + 1], 0.3f);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size()));
+}
+BENCHMARK(Quaternion_Slerp);
+
+
+static void Quaternion_Lerp(benchmark::State& state)
+{
+  const std::vector<Quaternion> quaternions = CreateQuaternions(LocalConfig::ElementCount + 1);
+  std::vector<Quaternion> result(LocalConfig::ElementCount);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+      Quaternion::Lerp(result[i], quaternions[i], quaternions[i + 1], 0.3f);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size()));
+}
+BENCHMARK(Quaternion_Lerp);
+
+
+static void BoundingFrustum_SetMatrix(benchmark::State& state)
+{
+  const std::vector<Matrix> matrices = CreateMatrices(LocalConfig::ElementCount);
+  const Matrix viewProjection = Matrix::CreateLookAt(Vector3(0.0f, 5.0f, 10.0f), Vector3(), Vector3::Up()) *
+                                Matrix::CreatePerspectiveFieldOfView(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+  BoundingFrustum frustum(viewProjection);
+  for (auto _ : state)
+  {
+    for (const Matrix& matrix : matrices)
+    {
+      frustum.SetMatrix(matrix * viewProjection);
+      benchmark::DoNotOptimize(frustum);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(matrices.size()));
+}
+BENCHMARK(BoundingFrustum_SetMatrix);
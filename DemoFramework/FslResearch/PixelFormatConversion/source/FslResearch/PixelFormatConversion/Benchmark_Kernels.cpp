@@ -0,0 +1,124 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Bitmap/TightBitmap.hpp>
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverter.hpp>
+#include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <string>
+
+using namespace Fsl;
+
+namespace
+{
+  enum class KernelVariant
+  {
+    //! Scalar kernels on the calling thread
+    Scalar,
+    //! The best instruction set supported by the CPU on the calling thread
+    Simd,
+    //! The best instruction set supported by the CPU with the rows split between the job system workers
+    Threaded
+  };
+
+  JobSystem& GetJobSystem()
+  {
+    static JobSystem g_jobSystem;
+    return g_jobSystem;
+  }
+
+  TightBitmap CreateSrcBitmap(const PixelFormat pixelFormat)
+  {
+    TightBitmap bitmap(PxSize2D::Create(4000, 3000), pixelFormat, BitmapOrigin::UpperLeft);
+    // Fill the content with a value that is valid for all the formats (0x3C00 is 1.0 as a half float)
+    auto span = bitmap.AsSpan();
+    for (std::size_t i = 0; (i + 1) < span.size(); i += 2)
+    {
+      span[i] = 0x00;
+      span[i + 1] = 0x3C;
+    }
+    return bitmap;
+  }
+
+  template <PixelFormat TSrcPixelFormat, PixelFormat TDstPixelFormat, KernelVariant TVariant>
+  void TryTransform(benchmark::State& state)
+  {
+    const TightBitmap srcBitmap(CreateSrcBitmap(TSrcPixelFormat));
+    TightBitmap dstBitmap(srcBitmap.GetSize(), TDstPixelFormat, BitmapOrigin::UpperLeft);
+
+    const auto oldInstructionSet = FslGraphics2D::RawBitmapConverterFunctions::GetInstructionSet();
+    FslGraphics2D::RawBitmapConverterFunctions::SetInstructionSet(TVariant == KernelVariant::Scalar
+                                                                     ? FslGraphics2D::RawBitmapConverterInstructionSet::Scalar
+                                                                     : FslGraphics2D::RawBitmapConverterFunctions::GetBestInstructionSet());
+    JobSystem& rJobSystem = GetJobSystem();
+    for (auto _ : state)
+    {
+      // This code gets timed
+      bool result = false;
+      if constexpr (TVariant == KernelVariant::Threaded)
+      {
+        result = FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(), rJobSystem);
+      }
+      else
+      {
+        result = FslGraphics2D::RawBitmapConverter::TryTransform(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
+      }
+      benchmark::DoNotOptimize(result);
+    }
+    FslGraphics2D::RawBitmapConverterFunctions::SetInstructionSet(oldInstructionSet);
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * (srcBitmap.GetByteSize() + dstBitmap.GetByteSize())));
+    state.SetLabel(TVariant == KernelVariant::Threaded ? fmt::format("threads: {}", rJobSystem.GetConcurrency()) : std::string());
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// The benchmarks report the bytes read + written per second
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#define LOCAL_BENCHMARK_VARIANTS(SRC, DST)                                                 \
+  BENCHMARK_TEMPLATE(TryTransform, SRC, DST, KernelVariant::Scalar)->UseRealTime();      \
+  BENCHMARK_TEMPLATE(TryTransform, SRC, DST, KernelVariant::Simd)->UseRealTime();        \
+  BENCHMARK_TEMPLATE(TryTransform, SRC, DST, KernelVariant::Threaded)->UseRealTime();
+
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R8G8B8A8_SRGB, PixelFormat::R16G16B16A16_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R8G8B8A8_SRGB, PixelFormat::R32G32B32A32_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R16G16B16A16_SFLOAT, PixelFormat::R32G32B32A32_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R32G32B32A32_SFLOAT, PixelFormat::R16G16B16A16_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R16G16B16A16_UNORM, PixelFormat::R32G32B32A32_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R32G32B32A32_SFLOAT, PixelFormat::R16G16B16A16_UNORM)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R32G32B32A32_SFLOAT, PixelFormat::R8G8B8A8_SRGB)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R16G16B16A16_SFLOAT, PixelFormat::R8G8B8A8_SRGB)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R16G16B16_UNORM, PixelFormat::R8G8B8_SRGB)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R32G32B32_SFLOAT, PixelFormat::R16G16B16A16_SFLOAT)
+LOCAL_BENCHMARK_VARIANTS(PixelFormat::R32G32B32A32_SFLOAT, PixelFormat::B8G8R8A8_SRGB)
@@ -45,6 +45,11 @@ namespace
     return {PxSize2D::Create(4000, 3000), pixelFormat, BitmapOrigin::UpperLeft};
   }
 
+  void SetBytesProcessed(benchmark::State& state, const TightBitmap& srcBitmap, const TightBitmap& dstBitmap)
+  {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * (srcBitmap.GetByteSize() + dstBitmap.GetByteSize())));
+  }
+
   uint8_t TestOp(const uint8_t val)
   {
     return val + 10;
@@ -63,6 +68,7 @@ namespace
       UncheckedRawBitmapTransformer::TransformChannelsRAWNoMemoryOverlap<uint8_t, uint8_t, 3>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(),
                                                                                               TestOp);
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 
@@ -77,6 +83,7 @@ namespace
       // This code gets timed
       UncheckedRawBitmapTransformer::TransformThreeChannelsRAW<uint8_t, uint8_t>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(), TestOp);
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -93,6 +100,7 @@ namespace
       UncheckedRawBitmapTransformer::TransformChannelsRAWNoMemoryOverlap<uint8_t, uint8_t, 4>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(),
                                                                                               TestOp);
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 
@@ -107,6 +115,7 @@ namespace
       // This code gets timed
       UncheckedRawBitmapTransformer::TransformFourChannelsRAW<uint8_t, uint8_t>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(), TestOp);
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -122,6 +131,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -136,6 +146,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -151,6 +162,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -165,6 +177,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -180,6 +193,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -194,6 +208,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -209,6 +224,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16FloatToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 
@@ -222,6 +238,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -237,6 +254,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16A16FloatToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 
@@ -250,6 +268,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -265,6 +284,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   void UncheckedR16G16B16A16UNormToR32G32B32A32Float(benchmark::State& state)
@@ -277,6 +297,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16A16UNormToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 
@@ -290,6 +311,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
   void UncheckedR16G16B16UNormToR32G32B32Float(benchmark::State& state)
@@ -302,6 +324,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16UNormToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, srcBitmap, dstBitmap);
   }
 
 }
@@ -0,0 +1,129 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics3D/BasicScene/FlatScene.hpp>
+#include <FslGraphics3D/BasicScene/SceneNode.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    //! The number of children per node (a typical imported model hierarchy is fairly wide and shallow)
+    constexpr std::size_t ChildrenPerNode = 8;
+  }
+
+  //! Build a hierarchy with the given number of nodes, filled breadth first
+  std::shared_ptr<Graphics3D::SceneNode> CreateHierarchy(const std::size_t nodeCount)
+  {
+    std::vector<std::shared_ptr<Graphics3D::SceneNode>> nodes;
+    nodes.reserve(nodeCount);
+    for (std::size_t i = 0; i < nodeCount; ++i)
+    {
+      auto node = std::make_shared<Graphics3D::SceneNode>();
+      const auto value = static_cast<float>(i % 97);
+      node->SetTransformation(Matrix::CreateRotationY(value * 0.01f) * Matrix::CreateTranslation(value * 0.1f, 1.0f, 0.0f));
+      if (i > 0)
+      {
+        nodes[(i - 1) / LocalConfig::ChildrenPerNode]->AddChild(node);
+      }
+      nodes.push_back(std::move(node));
+    }
+    return nodes.front();
+  }
+
+  //! The traditional approach, the same composition as the samples use
+  void RecursiveUpdate(const Graphics3D::SceneNode& node, const Matrix& parentMatrix, std::vector<Matrix>& rWorldTransforms)
+  {
+    const Matrix world = parentMatrix * node.GetTransformation();
+    rWorldTransforms.push_back(world);
+    const int32_t childCount = node.GetChildCount();
+    for (int32_t i = 0; i < childCount; ++i)
+    {
+      RecursiveUpdate(*node.GetChildAt(i), world, rWorldTransforms);
+    }
+  }
+
+
+  void SceneTransform_Recursive(benchmark::State& state)
+  {
+    const auto nodeCount = static_cast<std::size_t>(state.range(0));
+    auto root = CreateHierarchy(nodeCount);
+    std::vector<Matrix> worldTransforms;
+    worldTransforms.reserve(nodeCount);
+
+    for (auto _ : state)
+    {
+      worldTransforms.clear();
+      RecursiveUpdate(*root, Matrix::GetIdentity(), worldTransforms);
+      benchmark::DoNotOptimize(worldTransforms.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+
+  void SceneTransform_Flat(benchmark::State& state)
+  {
+    Graphics3D::FlatScene scene(*CreateHierarchy(static_cast<std::size_t>(state.range(0))));
+
+    for (auto _ : state)
+    {
+      scene.UpdateWorldTransforms();
+      benchmark::DoNotOptimize(scene.GetWorldTransforms().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+
+  void SceneTransform_FlatJobSystem(benchmark::State& state)
+  {
+    Graphics3D::FlatScene scene(*CreateHierarchy(static_cast<std::size_t>(state.range(0))));
+    JobSystem jobSystem;
+
+    for (auto _ : state)
+    {
+      scene.UpdateWorldTransforms(jobSystem);
+      benchmark::DoNotOptimize(scene.GetWorldTransforms().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.counters["Threads"] = static_cast<double>(jobSystem.GetConcurrency());
+  }
+}
+
+BENCHMARK(SceneTransform_Recursive)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SceneTransform_Flat)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SceneTransform_FlatJobSystem)->Arg(10000)->Arg(50000)->Arg(100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,158 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Bitmap/RawBitmapDownscaleUtil.hpp>
+#include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
+#include <FslGraphics/Bitmap/TightBitmap.hpp>
+#include <FslGraphics/Texture/Texture.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
+#include <FslGraphics/Texture/TextureMipMapUtil.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <string>
+
+using namespace Fsl;
+
+namespace
+{
+  enum class MipMapVariant
+  {
+    //! All levels and faces are generated on the calling thread
+    Serial,
+    //! The faces and rows of each level are split between the job system workers
+    Threaded
+  };
+
+  JobSystem& GetJobSystem()
+  {
+    static JobSystem g_jobSystem;
+    return g_jobSystem;
+  }
+
+  //! Fill the content with a pattern that is valid for all the formats (0x3F000000 is 0.5 as a float)
+  void FillContent(uint8_t* pContent, const std::size_t byteSize)
+  {
+    for (std::size_t i = 0; (i + 3u) < byteSize; i += 4u)
+    {
+      pContent[i] = 0x00;
+      pContent[i + 1] = static_cast<uint8_t>(i >> 4);
+      pContent[i + 2] = 0x00;
+      pContent[i + 3] = 0x3F;
+    }
+  }
+
+  Texture CreateSrcTexture(const TextureType textureType, const uint32_t size, const PixelFormat pixelFormat)
+  {
+    const uint32_t faces = textureType == TextureType::TexCube ? 6u : 1u;
+    Texture texture(TextureBlobBuilder(textureType, PxExtent3D::Create(size, size, 1), pixelFormat, TextureInfo(1, faces, 1), BitmapOrigin::UpperLeft,
+                                       true));
+    Texture::ScopedDirectReadWriteAccess access(texture);
+    RawTextureEx rawTexture = access.AsRawTexture();
+    FillContent(static_cast<uint8_t*>(rawTexture.GetContent()), rawTexture.GetByteSize());
+    return texture;
+  }
+
+  template <TextureType TTextureType, uint32_t TSize, PixelFormat TPixelFormat, TextureMipMapFilter TFilter, MipMapVariant TVariant>
+  void GenerateMipMaps(benchmark::State& state)
+  {
+    const Texture srcTexture(CreateSrcTexture(TTextureType, TSize, TPixelFormat));
+    JobSystem& rJobSystem = GetJobSystem();
+    for (auto _ : state)
+    {
+      // This code gets timed
+      if constexpr (TVariant == MipMapVariant::Threaded)
+      {
+        Texture result = TextureMipMapUtil::GenerateMipMaps(srcTexture, TFilter, rJobSystem);
+        benchmark::DoNotOptimize(result);
+      }
+      else
+      {
+        Texture result = TextureMipMapUtil::GenerateMipMaps(srcTexture, TFilter);
+        benchmark::DoNotOptimize(result);
+      }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * srcTexture.GetByteSize()));
+    state.SetLabel(TVariant == MipMapVariant::Threaded ? fmt::format("threads: {}", rJobSystem.GetConcurrency()) : std::string());
+  }
+
+  //! The original 32bit box filter, kept as a baseline for a single level
+  void DownscaleOneLevel_RawBitmapUtil(benchmark::State& state)
+  {
+    TightBitmap srcBitmap(PxSize2D::Create(4096, 4096), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+    FillContent(srcBitmap.AsSpan().data(), srcBitmap.GetByteSize());
+    TightBitmap dstBitmap(PxSize2D::Create(2048, 2048), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+    for (auto _ : state)
+    {
+      // This code gets timed
+      RawBitmapEx rawDstBitmap = dstBitmap.AsRawBitmap();
+      RawBitmapUtil::DownscaleBoxFilter(rawDstBitmap, srcBitmap.AsRawBitmap());
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * srcBitmap.GetByteSize()));
+  }
+
+  void DownscaleOneLevel_RawBitmapDownscaleUtil(benchmark::State& state)
+  {
+    TightBitmap srcBitmap(PxSize2D::Create(4096, 4096), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+    FillContent(srcBitmap.AsSpan().data(), srcBitmap.GetByteSize());
+    TightBitmap dstBitmap(PxSize2D::Create(2048, 2048), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+    for (auto _ : state)
+    {
+      // This code gets timed
+      RawBitmapEx rawDstBitmap = dstBitmap.AsRawBitmap();
+      RawBitmapDownscaleUtil::Downscale(rawDstBitmap, srcBitmap.AsRawBitmap(), TextureMipMapFilter::Box);
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * srcBitmap.GetByteSize()));
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// The benchmarks report the src bytes per second
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+BENCHMARK(DownscaleOneLevel_RawBitmapUtil)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(DownscaleOneLevel_RawBitmapDownscaleUtil)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#define LOCAL_BENCHMARK_VARIANTS(TEXTURE_TYPE, SIZE, PIXEL_FORMAT, FILTER)                                                                     \
+  BENCHMARK_TEMPLATE(GenerateMipMaps, TEXTURE_TYPE, SIZE, PIXEL_FORMAT, FILTER, MipMapVariant::Serial)->UseRealTime()->Unit(benchmark::kMillisecond); \
+  BENCHMARK_TEMPLATE(GenerateMipMaps, TEXTURE_TYPE, SIZE, PIXEL_FORMAT, FILTER, MipMapVariant::Threaded)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 2048, PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 4096, PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 4096, PixelFormat::R8G8B8A8_SRGB, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 2048, PixelFormat::R32G32B32A32_SFLOAT, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 2048, PixelFormat::R8G8B8A8_SRGB, TextureMipMapFilter::Kaiser)
+LOCAL_BENCHMARK_VARIANTS(TextureType::Tex2D, 4096, PixelFormat::R8G8B8A8_SRGB, TextureMipMapFilter::Lanczos)
+LOCAL_BENCHMARK_VARIANTS(TextureType::TexCube, 1024, PixelFormat::R8G8B8A8_UNORM, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::TexCube, 2048, PixelFormat::R8G8B8A8_SRGB, TextureMipMapFilter::Box)
+LOCAL_BENCHMARK_VARIANTS(TextureType::TexCube, 1024, PixelFormat::R8G8B8A8_SRGB, TextureMipMapFilter::Lanczos)
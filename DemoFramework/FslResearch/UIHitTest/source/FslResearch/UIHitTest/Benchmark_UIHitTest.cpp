@@ -0,0 +1,214 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslBase/Math/Pixel/PxRectangle.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslSimpleUI/Base/IWindowId.hpp>
+#include <FslSimpleUI/Base/System/UITreeHitGrid.hpp>
+#include <FslSimpleUI/Base/System/UITreeInputTargetRecord.hpp>
+#include <FslSimpleUI/Base/System/WindowToNodeMap.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr int32_t ScreenWidth = 1920;
+    constexpr int32_t ScreenHeight = 1080;
+    constexpr std::size_t QueryCount = 1024;
+  }
+
+  //! Create input target records that resembles a UI: a full screen root container and its items laid out in a uniform grid
+  //! (in the z-order the UITree produces them).
+  std::vector<UI::UITreeInputTargetRecord> CreateRecords(const std::size_t count)
+  {
+    std::vector<UI::UITreeInputTargetRecord> records;
+    records.reserve(count);
+    records.emplace_back(PxRectangle::Create(0, 0, LocalConfig::ScreenWidth, LocalConfig::ScreenHeight), nullptr);
+
+    const auto itemCount = static_cast<int32_t>(count - 1u);
+    const auto columns = std::max(static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(itemCount)))), 1);
+    const int32_t rows = std::max((itemCount + columns - 1) / columns, 1);
+    const int32_t cellWidth = std::max(LocalConfig::ScreenWidth / columns, 2);
+    const int32_t cellHeight = std::max(LocalConfig::ScreenHeight / rows, 2);
+    for (int32_t i = 0; i < itemCount; ++i)
+    {
+      const int32_t x = (i % columns) * cellWidth;
+      const int32_t y = (i / columns) * cellHeight;
+      records.emplace_back(PxRectangle::Create(x, y, cellWidth - 1, cellHeight - 1), nullptr);
+    }
+    return records;
+  }
+
+  std::vector<PxPoint2> CreateQueries()
+  {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int32_t> distX(0, LocalConfig::ScreenWidth - 1);
+    std::uniform_int_distribution<int32_t> distY(0, LocalConfig::ScreenHeight - 1);
+    std::vector<PxPoint2> queries(LocalConfig::QueryCount);
+    for (auto& rQuery : queries)
+    {
+      rQuery = PxPoint2::Create(distX(random), distY(random));
+    }
+    return queries;
+  }
+
+  //! The original UITree search
+  int32_t LinearFindTopMost(const std::vector<UI::UITreeInputTargetRecord>& records, const PxPoint2& positionPx)
+  {
+    for (std::size_t i = records.size(); i > 0; --i)
+    {
+      if (records[i - 1].VisibleRectPx.Contains(positionPx))
+      {
+        return static_cast<int32_t>(i - 1);
+      }
+    }
+    return -1;
+  }
+
+
+  void HitTest_Linear(benchmark::State& state)
+  {
+    const auto records = CreateRecords(static_cast<std::size_t>(state.range(0)));
+    const auto queries = CreateQueries();
+    std::size_t queryIndex = 0;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      benchmark::DoNotOptimize(LinearFindTopMost(records, queries[queryIndex]));
+      queryIndex = (queryIndex + 1) % queries.size();
+    }
+  }
+
+  void HitTest_Grid(benchmark::State& state)
+  {
+    const auto records = CreateRecords(static_cast<std::size_t>(state.range(0)));
+    const auto queries = CreateQueries();
+    const auto recordSpan = SpanUtil::AsReadOnlySpan(records);
+    UI::UITreeHitGrid grid;
+    grid.Build(recordSpan);
+    std::size_t queryIndex = 0;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      benchmark::DoNotOptimize(grid.TryFindTopMost(recordSpan, queries[queryIndex]));
+      queryIndex = (queryIndex + 1) % queries.size();
+    }
+  }
+
+  void HitGrid_Build(benchmark::State& state)
+  {
+    const auto records = CreateRecords(static_cast<std::size_t>(state.range(0)));
+    const auto recordSpan = SpanUtil::AsReadOnlySpan(records);
+    UI::UITreeHitGrid grid;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      grid.Build(recordSpan);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+
+  std::vector<std::unique_ptr<UI::IWindowId>> CreateWindowIds(const std::size_t count)
+  {
+    std::vector<std::unique_ptr<UI::IWindowId>> windowIds(count);
+    for (auto& rWindowId : windowIds)
+    {
+      rWindowId = std::make_unique<UI::IWindowId>();
+    }
+    return windowIds;
+  }
+
+  std::vector<const UI::IWindowId*> CreateLookups(const std::vector<std::unique_ptr<UI::IWindowId>>& windowIds)
+  {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<std::size_t> dist(0, windowIds.size() - 1);
+    std::vector<const UI::IWindowId*> lookups(LocalConfig::QueryCount);
+    for (auto& rLookup : lookups)
+    {
+      rLookup = windowIds[dist(random)].get();
+    }
+    return lookups;
+  }
+
+  //! The original UITree window lookup
+  void WindowLookup_StdMap(benchmark::State& state)
+  {
+    const auto windowIds = CreateWindowIds(static_cast<std::size_t>(state.range(0)));
+    const auto lookups = CreateLookups(windowIds);
+    std::map<const UI::IWindowId*, std::shared_ptr<UI::TreeNode>> map;
+    for (const auto& windowId : windowIds)
+    {
+      map.emplace(windowId.get(), std::shared_ptr<UI::TreeNode>());
+    }
+    std::size_t lookupIndex = 0;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      benchmark::DoNotOptimize(map.find(lookups[lookupIndex]));
+      lookupIndex = (lookupIndex + 1) % lookups.size();
+    }
+  }
+
+  void WindowLookup_FlatMap(benchmark::State& state)
+  {
+    const auto windowIds = CreateWindowIds(static_cast<std::size_t>(state.range(0)));
+    const auto lookups = CreateLookups(windowIds);
+    UI::WindowToNodeMap map;
+    for (const auto& windowId : windowIds)
+    {
+      map.TryAdd(windowId.get(), std::shared_ptr<UI::TreeNode>());
+    }
+    std::size_t lookupIndex = 0;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      benchmark::DoNotOptimize(&map.TryGet(lookups[lookupIndex]));
+      lookupIndex = (lookupIndex + 1) % lookups.size();
+    }
+  }
+}
+
+BENCHMARK(HitTest_Linear)->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+BENCHMARK(HitTest_Grid)->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+BENCHMARK(HitGrid_Build)->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+BENCHMARK(WindowLookup_StdMap)->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+BENCHMARK(WindowLookup_FlatMap)->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
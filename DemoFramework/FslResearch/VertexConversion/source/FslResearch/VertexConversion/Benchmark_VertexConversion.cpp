@@ -0,0 +1,210 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexConverter.hpp>
+#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTangentTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr int64_t VertexCount = 250000;
+  }
+
+  template <typename TVertex>
+  std::vector<TVertex> CreateSrcVertices(const std::size_t count)
+  {
+    std::vector<TVertex> vertices(count);
+    // Fill with a simple byte pattern, the content does not matter for the copy speed
+    auto* pBytes = reinterpret_cast<uint8_t*>(vertices.data());
+    for (std::size_t i = 0; i < count * sizeof(TVertex); ++i)
+    {
+      pBytes[i] = static_cast<uint8_t>(i);
+    }
+    return vertices;
+  }
+
+  //! The element by element conversion used before the conversion plans, kept as a reference.
+  void LegacyConvert(void* const pDst, VertexDeclarationSpan dstVertexDeclaration, const void* const pSrc, VertexDeclarationSpan srcVertexDeclaration,
+                     const std::size_t vertexCount, const void* const pDstDefaultValues)
+  {
+    const uint32_t dstStride = dstVertexDeclaration.VertexStride();
+    const uint32_t srcStride = srcVertexDeclaration.VertexStride();
+    for (uint32_t i = 0; i < dstVertexDeclaration.Count(); ++i)
+    {
+      const VertexElement dstElement = dstVertexDeclaration.At(i);
+      const auto cbEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
+      const int32_t srcIndex = srcVertexDeclaration.VertexElementIndexOf(dstElement.Usage, dstElement.UsageIndex);
+
+      uint8_t* pDstEntry = static_cast<uint8_t*>(pDst) + dstElement.Offset;
+      const uint8_t* pSrcEntry = srcIndex >= 0 ? static_cast<const uint8_t*>(pSrc) + srcVertexDeclaration.At(srcIndex).Offset
+                                               : static_cast<const uint8_t*>(pDstDefaultValues) + dstElement.Offset;
+      const std::size_t srcEntryStride = srcIndex >= 0 ? srcStride : 0u;
+      for (std::size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+      {
+        std::memcpy(pDstEntry, pSrcEntry, cbEntry);
+        pDstEntry += dstStride;
+        pSrcEntry += srcEntryStride;
+      }
+    }
+  }
+
+  enum class Method
+  {
+    Legacy,
+    Plan,
+    GenericConvert,
+    PlanJobSystem
+  };
+
+  template <typename TDst, typename TSrc>
+  void RunConversion(benchmark::State& state, const Method method)
+  {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<TSrc> src = CreateSrcVertices<TSrc>(count);
+    std::vector<TDst> dst(count);
+    const TDst defaultValue;
+    const VertexDeclarationSpan dstDecl = TDst::AsVertexDeclarationSpan();
+    const VertexDeclarationSpan srcDecl = TSrc::AsVertexDeclarationSpan();
+    const VertexConversionPlan plan(dstDecl, srcDecl);
+    JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 1u) - 1u);
+
+    for (auto _ : state)
+    {
+      switch (method)
+      {
+      case Method::Legacy:
+        LegacyConvert(dst.data(), dstDecl, src.data(), srcDecl, count, &defaultValue);
+        break;
+      case Method::Plan:
+        plan.Convert(dst.data(), dst.size() * sizeof(TDst), src.data(), src.size() * sizeof(TSrc), count, &defaultValue, sizeof(TDst));
+        break;
+      case Method::GenericConvert:
+        VertexConverter::GenericConvert(dst.data(), dst.size() * sizeof(TDst), dstDecl, src.data(), src.size() * sizeof(TSrc), srcDecl, count,
+                                        &defaultValue, sizeof(TDst));
+        break;
+      case Method::PlanJobSystem:
+        plan.Convert(jobSystem, dst.data(), dst.size() * sizeof(TDst), src.data(), src.size() * sizeof(TSrc), count, &defaultValue, sizeof(TDst));
+        break;
+      }
+      benchmark::DoNotOptimize(dst.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * static_cast<int64_t>(sizeof(TDst)));
+  }
+}
+
+
+// Position, normal and uv expanded to the tangent space layout (the tangent is filled with the default value)
+static void PNT_To_PNTT_Legacy(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTexture>(state, Method::Legacy);
+}
+BENCHMARK(PNT_To_PNTT_Legacy)->Arg(LocalConfig::VertexCount);
+
+
+static void PNT_To_PNTT_Plan(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTexture>(state, Method::Plan);
+}
+BENCHMARK(PNT_To_PNTT_Plan)->Arg(LocalConfig::VertexCount);
+
+
+static void PNT_To_PNTT_GenericConvert(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTexture>(state, Method::GenericConvert);
+}
+BENCHMARK(PNT_To_PNTT_GenericConvert)->Arg(LocalConfig::VertexCount);
+
+
+static void PNT_To_PNTT_PlanJobSystem(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTexture>(state, Method::PlanJobSystem);
+}
+BENCHMARK(PNT_To_PNTT_PlanJobSystem)->Arg(LocalConfig::VertexCount);
+
+
+// The tangent space layout stripped down to position, normal and uv
+static void PNTT_To_PNT_Legacy(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTexture, VertexPositionNormalTangentTexture>(state, Method::Legacy);
+}
+BENCHMARK(PNTT_To_PNT_Legacy)->Arg(LocalConfig::VertexCount);
+
+
+static void PNTT_To_PNT_Plan(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTexture, VertexPositionNormalTangentTexture>(state, Method::Plan);
+}
+BENCHMARK(PNTT_To_PNT_Plan)->Arg(LocalConfig::VertexCount);
+
+
+// Position, normal and uv stripped down to position and uv
+static void PNT_To_PT_Legacy(benchmark::State& state)
+{
+  RunConversion<VertexPositionTexture, VertexPositionNormalTexture>(state, Method::Legacy);
+}
+BENCHMARK(PNT_To_PT_Legacy)->Arg(LocalConfig::VertexCount);
+
+
+static void PNT_To_PT_Plan(benchmark::State& state)
+{
+  RunConversion<VertexPositionTexture, VertexPositionNormalTexture>(state, Method::Plan);
+}
+BENCHMARK(PNT_To_PT_Plan)->Arg(LocalConfig::VertexCount);
+
+
+// Identical layouts
+static void PNTT_To_PNTT_Legacy(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTangentTexture>(state, Method::Legacy);
+}
+BENCHMARK(PNTT_To_PNTT_Legacy)->Arg(LocalConfig::VertexCount);
+
+
+static void PNTT_To_PNTT_Plan(benchmark::State& state)
+{
+  RunConversion<VertexPositionNormalTangentTexture, VertexPositionNormalTangentTexture>(state, Method::Plan);
+}
+BENCHMARK(PNTT_To_PNTT_Plan)->Arg(LocalConfig::VertexCount);
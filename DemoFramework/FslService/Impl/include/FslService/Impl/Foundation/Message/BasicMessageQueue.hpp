@@ -31,11 +31,15 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Collections/Concurrent/BoundedMPMCQueue.hpp>
 #include <FslService/Impl/Foundation/Message/BasicMessage.hpp>
+#include <FslService/Impl/Foundation/Message/BasicMessageQueueBackend.hpp>
 #include <FslService/Impl/Foundation/Message/IBasicMessageProvider.hpp>
 #include <FslService/Impl/Foundation/Message/IBasicMessageQueue.hpp>
 #include <FslService/Impl/Registry/ServiceGroupId.hpp>
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 namespace Fsl
@@ -44,10 +48,18 @@ namespace Fsl
     : public IBasicMessageQueue
     , public IBasicMessageProvider
   {
+    BasicMessageQueueBackend m_backend;
     std::mutex m_mutex;
     std::condition_variable m_waitForMsgCondition;
+    //! The message queue when using the mutex backend, the overflow queue when using the lock free backend
     std::queue<BasicMessage> m_queue;
-    bool m_shutdownMarked;
+    //! Only allocated for the lock free backend
+    std::unique_ptr<BoundedMPMCQueue<BasicMessage>> m_ringBuffer;
+    //! The number of messages in m_queue (only used by the lock free backend)
+    std::atomic<uint32_t> m_overflowCount{0};
+    //! The number of consumers that are waiting for a message (only used by the lock free backend)
+    std::atomic<uint32_t> m_waitingConsumers{0};
+    std::atomic<bool> m_shutdownMarked{false};
 
   public:
     const ServiceGroupId TheServiceGroupId;
@@ -56,10 +68,19 @@ namespace Fsl
     BasicMessageQueue& operator=(const BasicMessageQueue&) = delete;
 
     explicit BasicMessageQueue(const ServiceGroupId& serviceGroupId);
+    BasicMessageQueue(const ServiceGroupId& serviceGroupId, const BasicMessageQueueBackend backend);
+    ~BasicMessageQueue() override;
+
+    BasicMessageQueueBackend GetBackend() const noexcept
+    {
+      return m_backend;
+    }
 
     // Inherited via IBasicMessageQueue
     void Push(const BasicMessage& message) override;
     bool TryPush(const BasicMessage& message) override;
+    void Push(BasicMessage&& message) override;
+    bool TryPush(BasicMessage&& message) override;
 
     // Inherited via IBasicMessageProvider
     bool TryPop(std::queue<BasicMessage>& rQueue) override;
@@ -71,6 +92,13 @@ namespace Fsl
 
   private:
     void UnsafeWake();
+
+    bool TryPushLockFree(BasicMessage&& message);
+    void WakeWaitingConsumer();
+    bool TryPopLockFree(std::queue<BasicMessage>& rQueue);
+    bool TryPopLockFree(BasicMessage& rMessage);
+    void WaitLockFree();
+    void WaitLockFree(const std::chrono::milliseconds& duration);
   };
 }
 
@@ -47,6 +47,10 @@ namespace Fsl
     //! @brief Push a message onto the queue
     virtual void Push(const BasicMessage& message) = 0;
     virtual bool TryPush(const BasicMessage& message) = 0;
+
+    //! @brief Move a message onto the queue (avoids the shared_ptr reference count churn of a copy)
+    virtual void Push(BasicMessage&& message) = 0;
+    virtual bool TryPush(BasicMessage&& message) = 0;
   };
 }
 
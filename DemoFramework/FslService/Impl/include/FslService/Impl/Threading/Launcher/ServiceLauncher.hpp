@@ -35,6 +35,7 @@
 
 namespace Fsl
 {
+  class IServiceProvider;
   class RegisteredServiceDeque;
   struct RegisteredGlobalServiceInfo;
   class ServiceProviderImpl;
@@ -52,6 +53,10 @@ namespace Fsl
     static std::shared_ptr<RegisteredGlobalServiceInfo> Launch(const RegisteredServiceDeque& services);
     static std::shared_ptr<ServiceProviderImpl> Launch(const TypeServiceMaps& globalServiceTypeMaps, const RegisteredServiceDeque& services,
                                                        const bool clearOwnedUniqueServices);
+
+    //! @brief Launch a private instance of the services on the calling thread, the services can only access each other.
+    //! @note  The services are owned by the returned provider, so it must be kept alive while they are used.
+    static std::shared_ptr<IServiceProvider> LaunchPrivate(const RegisteredServiceDeque& services);
   };
 }
 
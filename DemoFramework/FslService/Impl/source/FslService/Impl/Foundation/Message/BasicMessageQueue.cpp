@@ -29,18 +29,51 @@
  *
  ****************************************************************************************************************************************************/
 
+
 #include <FslBase/Exceptions.hpp>
 #include <FslService/Impl/Foundation/Message/BasicMessageQueue.hpp>
+#include <thread>
+#include <utility>
 
 namespace Fsl
 {
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The ring buffer capacity of the lock free backend, if it overflows the mutex protected queue is used.
+      constexpr uint32_t LockFreeCapacity = 1024;
+    }
+
+    void MoveAll(std::queue<BasicMessage>& rDstQueue, std::queue<BasicMessage>& rSrcQueue)
+    {
+      while (!rSrcQueue.empty())
+      {
+        rDstQueue.push(std::move(rSrcQueue.front()));
+        rSrcQueue.pop();
+      }
+    }
+  }
+
+
   BasicMessageQueue::BasicMessageQueue(const ServiceGroupId& serviceGroupId)
-    : m_shutdownMarked(false)
+    : BasicMessageQueue(serviceGroupId, BasicMessageQueueBackend::Mutex)
+  {
+  }
+
+
+  BasicMessageQueue::BasicMessageQueue(const ServiceGroupId& serviceGroupId, const BasicMessageQueueBackend backend)
+    : m_backend(backend)
+    , m_ringBuffer(backend == BasicMessageQueueBackend::LockFree ? std::make_unique<BoundedMPMCQueue<BasicMessage>>(LocalConfig::LockFreeCapacity)
+                                                                 : nullptr)
     , TheServiceGroupId(serviceGroupId)
   {
   }
 
 
+  BasicMessageQueue::~BasicMessageQueue() = default;
+
+
   void BasicMessageQueue::Push(const BasicMessage& message)
   {
     if (!TryPush(message))
@@ -52,6 +85,26 @@ namespace Fsl
 
   bool BasicMessageQueue::TryPush(const BasicMessage& message)
   {
+    return TryPush(BasicMessage(message));
+  }
+
+
+  void BasicMessageQueue::Push(BasicMessage&& message)
+  {
+    if (!TryPush(std::move(message)))
+    {
+      throw std::runtime_error("Queue has been shutdown as the thread has been killed");
+    }
+  }
+
+
+  bool BasicMessageQueue::TryPush(BasicMessage&& message)
+  {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      return TryPushLockFree(std::move(message));
+    }
+
     // FIX: this check was incorrect as it marked the wrong queue, a mark as dead function is probably better
     const bool isShutdownMessage = false;    // (message.Type == BasicMessageType::ThreadShutdown);
     bool wasEmpty = false;
@@ -64,7 +117,7 @@ namespace Fsl
       }
 
       wasEmpty = m_queue.empty();
-      m_queue.push(message);
+      m_queue.push(std::move(message));
 
       if (isShutdownMessage)
       {
@@ -82,6 +135,11 @@ namespace Fsl
 
   bool BasicMessageQueue::TryPop(std::queue<BasicMessage>& rQueue)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      return TryPopLockFree(rQueue);
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_queue.empty())
@@ -89,17 +147,18 @@ namespace Fsl
       return false;
     }
 
-    while (!m_queue.empty())
-    {
-      rQueue.push(m_queue.front());
-      m_queue.pop();
-    }
+    MoveAll(rQueue, m_queue);
     return true;
   }
 
 
   bool BasicMessageQueue::TryPop(BasicMessage& rMessage)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      return TryPopLockFree(rMessage);
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_queue.empty())
@@ -107,7 +166,7 @@ namespace Fsl
       rMessage = BasicMessage();
       return false;
     }
-    rMessage = m_queue.front();
+    rMessage = std::move(m_queue.front());
     m_queue.pop();
     return true;
   }
@@ -115,6 +174,15 @@ namespace Fsl
 
   void BasicMessageQueue::PopWait(std::queue<BasicMessage>& rQueue)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      while (!TryPopLockFree(rQueue))
+      {
+        WaitLockFree();
+      }
+      return;
+    }
+
     std::unique_lock<std::mutex> lock(m_mutex);
 
     // Wait for a message to arrive
@@ -123,16 +191,21 @@ namespace Fsl
       m_waitForMsgCondition.wait(lock);
     }
 
-    while (!m_queue.empty())
-    {
-      rQueue.push(m_queue.front());
-      m_queue.pop();
-    }
+    MoveAll(rQueue, m_queue);
   }
 
 
   void BasicMessageQueue::PopWait(BasicMessage& rMessage)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      while (!TryPopLockFree(rMessage))
+      {
+        WaitLockFree();
+      }
+      return;
+    }
+
     std::unique_lock<std::mutex> lock(m_mutex);
 
     // Wait for a message to arrive
@@ -141,13 +214,26 @@ namespace Fsl
       m_waitForMsgCondition.wait(lock);
     }
 
-    rMessage = m_queue.front();
+    rMessage = std::move(m_queue.front());
     m_queue.pop();
   }
 
 
   bool BasicMessageQueue::TryPopWait(std::queue<BasicMessage>& rQueue, const std::chrono::milliseconds& duration)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      if (TryPopLockFree(rQueue))
+      {
+        return true;
+      }
+      if (duration.count() > 0)
+      {
+        WaitLockFree(duration);
+      }
+      return TryPopLockFree(rQueue);
+    }
+
     std::unique_lock<std::mutex> lock(m_mutex);
 
     // Wait for a message to arrive
@@ -161,17 +247,26 @@ namespace Fsl
 
     // We dont just check rQueue.empty() since it might have been non-empty to begin with
     const bool hasMessage = !m_queue.empty();
-    while (!m_queue.empty())
-    {
-      rQueue.push(m_queue.front());
-      m_queue.pop();
-    }
+    MoveAll(rQueue, m_queue);
     return hasMessage;
   }
 
 
   bool BasicMessageQueue::TryPopWait(BasicMessage& rMessage, const std::chrono::milliseconds& duration)
   {
+    if (m_backend == BasicMessageQueueBackend::LockFree)
+    {
+      if (TryPopLockFree(rMessage))
+      {
+        return true;
+      }
+      if (duration.count() > 0)
+      {
+        WaitLockFree(duration);
+      }
+      return TryPopLockFree(rMessage);
+    }
+
     std::unique_lock<std::mutex> lock(m_mutex);
 
     // Wait for a message to arrive
@@ -189,7 +284,7 @@ namespace Fsl
       return false;
     }
 
-    rMessage = m_queue.front();
+    rMessage = std::move(m_queue.front());
     m_queue.pop();
     return true;
   }
@@ -199,4 +294,124 @@ namespace Fsl
   {
     m_waitForMsgCondition.notify_one();
   }
+
+
+  bool BasicMessageQueue::TryPushLockFree(BasicMessage&& message)
+  {
+    if (m_shutdownMarked.load())
+    {
+      return false;
+    }
+
+    // Once the ring buffer has overflowed we keep using the overflow queue until the consumer has drained it,
+    // this ensures that the messages from a producer are received in the order they were pushed.
+    if (m_overflowCount.load(std::memory_order_acquire) != 0u || !m_ringBuffer->TryEnqueue(std::move(message)))
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_queue.push(std::move(message));
+      m_overflowCount.fetch_add(1u);
+    }
+    WakeWaitingConsumer();
+    return true;
+  }
+
+
+  void BasicMessageQueue::WakeWaitingConsumer()
+  {
+    // Pairs with the fence in WaitLockFree so either the consumer sees the new message or we see the waiting consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waitingConsumers.load(std::memory_order_relaxed) > 0u)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      UnsafeWake();
+    }
+  }
+
+
+  bool BasicMessageQueue::TryPopLockFree(std::queue<BasicMessage>& rQueue)
+  {
+    const bool hasOverflow = m_overflowCount.load(std::memory_order_acquire) != 0u;
+
+    bool hasMessage = false;
+    BasicMessage message;
+    while (true)
+    {
+      if (m_ringBuffer->TryDequeue(message))
+      {
+        rQueue.push(std::move(message));
+        hasMessage = true;
+      }
+      else if (hasOverflow && m_ringBuffer->ApproximateSize() > 0u)
+      {
+        // A producer claimed a ring buffer entry before the overflow entries were added, wait for it to be published
+        std::this_thread::yield();
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    if (hasOverflow)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      hasMessage |= !m_queue.empty();
+      MoveAll(rQueue, m_queue);
+      m_overflowCount.store(0u);
+    }
+    return hasMessage;
+  }
+
+
+  bool BasicMessageQueue::TryPopLockFree(BasicMessage& rMessage)
+  {
+    const bool hasOverflow = m_overflowCount.load(std::memory_order_acquire) != 0u;
+    while (true)
+    {
+      if (m_ringBuffer->TryDequeue(rMessage))
+      {
+        return true;
+      }
+      if (!hasOverflow || m_ringBuffer->ApproximateSize() == 0u)
+      {
+        break;
+      }
+      // A producer claimed a ring buffer entry before the overflow entries were added, wait for it to be published
+      std::this_thread::yield();
+    }
+
+    if (hasOverflow)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_queue.empty())
+      {
+        rMessage = std::move(m_queue.front());
+        m_queue.pop();
+        m_overflowCount.fetch_sub(1u);
+        return true;
+      }
+    }
+    rMessage = BasicMessage();
+    return false;
+  }
+
+
+  void BasicMessageQueue::WaitLockFree()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_waitingConsumers.fetch_add(1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    m_waitForMsgCondition.wait(lock, [this]() { return m_ringBuffer->ApproximateSize() > 0u || !m_queue.empty(); });
+    m_waitingConsumers.fetch_sub(1u, std::memory_order_relaxed);
+  }
+
+
+  void BasicMessageQueue::WaitLockFree(const std::chrono::milliseconds& duration)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_waitingConsumers.fetch_add(1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    m_waitForMsgCondition.wait_for(lock, duration, [this]() { return m_ringBuffer->ApproximateSize() > 0u || !m_queue.empty(); });
+    m_waitingConsumers.fetch_sub(1u, std::memory_order_relaxed);
+  }
 }
@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/Exceptions.hpp>
 #include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
@@ -37,8 +38,14 @@
 #include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <map>
+#include <memory>
 #include <set>
+#include <typeinfo>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
 #include "../Provider/ServiceProviderImpl.hpp"
 #include "RegisteredGlobalServiceInfo.hpp"
 #include "TypeServiceMap.hpp"
@@ -65,6 +72,21 @@ namespace Fsl
     }
 
 
+    //! Get a human readable type name for the startup timeline
+    std::string GetReadableTypeName(const std::type_info& typeInfo)
+    {
+#if defined(__GNUG__)
+      int status = 0;
+      const std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(typeInfo.name(), nullptr, nullptr, &status), &std::free);
+      if (status == 0 && demangled)
+      {
+        return {demangled.get()};
+      }
+#endif
+      return {typeInfo.name()};
+    }
+
+
     void CalcInterfaceHitCount(std::map<std::type_index, int32_t>& rInterfaceMap, const RegisteredServiceDeque& services)
     {
       auto itr = services.begin();
@@ -125,7 +147,21 @@ namespace Fsl
 
       assert(!deque.empty());
 
+      // Name the span after the factory until we know the actual service type
+      ScopedStartupTimelineZone timelineZone("Service");
+      const bool isTimelineRecording = StartupTimeline::IsRecording();
+      if (isTimelineRecording)
+      {
+        const IServiceFactory& factory = *record.Factory;
+        timelineZone.SetName(fmt::format("Service {}", GetReadableTypeName(typeid(factory))));
+      }
+
       std::shared_ptr<IService> service(record.Factory->Allocate(provider));
+      if (isTimelineRecording && service)
+      {
+        const IService& rService = *service;
+        timelineZone.SetName(fmt::format("Service {}", GetReadableTypeName(typeid(rService))));
+      }
       if (!service)
       {
         if ((record.Factory->GetFlags() & ServiceCaps::AvailableOnDemand) != 0)
@@ -260,4 +296,10 @@ namespace Fsl
     }
     return std::make_shared<ServiceProviderImpl>(serviceProviderMaps);
   }
+
+
+  std::shared_ptr<IServiceProvider> ServiceLauncher::LaunchPrivate(const RegisteredServiceDeque& services)
+  {
+    return Launch(TypeServiceMaps(), services, true);
+  }
 }
@@ -33,6 +33,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslService/Impl/Foundation/Message/FireAndForgetBasicMessage.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadShutdownBasicMessage.hpp>
 #include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
@@ -91,6 +92,7 @@ namespace Fsl
     }
 
     // Give the various services types a chance to update
+    FSL_PROFILE_SCOPE("Services.Update");
     m_serviceProvider->Update();
   }
 
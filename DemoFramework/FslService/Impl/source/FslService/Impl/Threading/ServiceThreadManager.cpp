@@ -32,11 +32,14 @@
 #include "ServiceThreadManager.hpp"
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
 #include <FslService/Impl/Foundation/Message/BasicMessageQueue.hpp>
+#include <FslService/Impl/Priority.hpp>
 #include <FslService/Impl/Registry/RegisteredServiceGroupDeque.hpp>
 #include <FslService/Impl/ServiceSupportedInterfaceDeque.hpp>
 #include <FslService/Impl/ServiceType/Async/IAsynchronousServiceProxyFactory.hpp>
 // #include <experimental/future>
+#include <algorithm>
 #include <cassert>
 #include <exception>
 #include <memory>
@@ -53,6 +56,15 @@ namespace Fsl
 {
   namespace
   {
+    namespace LocalConfig
+    {
+#ifdef FSLSERVICE_MESSAGE_QUEUE_BACKEND_LOCKFREE
+      constexpr BasicMessageQueueBackend MessageQueueBackend = BasicMessageQueueBackend::LockFree;
+#else
+      constexpr BasicMessageQueueBackend MessageQueueBackend = BasicMessageQueueBackend::Mutex;
+#endif
+    }
+
     std::unique_ptr<ServiceThreadRecord> SpawnThread(const std::shared_ptr<IBasicMessageQueue>& ownerQueue,
                                                      const std::shared_ptr<BasicMessageQueue>& hostReceiveQueue,
                                                      const ThreadLocalServiceConfig& serviceConfig,
@@ -74,12 +86,29 @@ namespace Fsl
     }
 
 
+    //! @brief The priority of the most important service hosted by the group
+    Priority GetHighestStartupPriority(const RegisteredServiceGroupRecord& serviceGroup)
+    {
+      Priority highest = Priority::Min();
+      for (const auto& entry : serviceGroup.AsyncServices)
+      {
+        highest = entry.StartupPriority > highest ? entry.StartupPriority : highest;
+      }
+      for (const auto& entry : serviceGroup.ThreadLocalServices)
+      {
+        highest = entry.StartupPriority > highest ? entry.StartupPriority : highest;
+      }
+      return highest;
+    }
+
+
     CustomServiceHostRecord PrepareMainThread(const ServiceGroupId& id, const std::shared_ptr<BasicMessageQueue>& hostReceiveQueue,
                                               const RegisteredGlobalServiceInfo& globalServiceInfo, const RegisteredServiceGroupRecord& serviceGroup)
     {
       auto asyncLaunchRecords = BuildAsyncServiceImplLaunchFactoryRecordDeque(serviceGroup.AsyncServices);
 
       // Launch the local 'main thread' host instance
+      ScopedStartupTimelineZone timelineZone("ServiceHost main thread");
       ServiceHostContext hostContext(hostReceiveQueue);
       const ThreadLocalServiceConfig serviceConfig(id, globalServiceInfo.GlobalServiceTypeMaps, std::move(asyncLaunchRecords),
                                                    serviceGroup.ThreadLocalServices);
@@ -141,7 +170,7 @@ namespace Fsl
     ServiceSupportedInterfaceDeque serviceInterfaces;
     for (auto& rHostRecord : m_hostRecords)
     {
-      rHostRecord.MessageQueue = std::make_shared<BasicMessageQueue>(rHostRecord.Group.Id);
+      rHostRecord.MessageQueue = std::make_shared<BasicMessageQueue>(rHostRecord.Group.Id, LocalConfig::MessageQueueBackend);
 
       for (auto& rRecord : rHostRecord.Group.AsyncServices)
       {
@@ -183,11 +212,16 @@ namespace Fsl
     const auto mainThreadRecord = m_hostRecords.front();
     m_hostRecords.pop_front();
 
-    auto mainHost = PrepareMainThread(mainThreadRecord.Group.Id, mainThreadRecord.MessageQueue, globalServiceInfo, mainThreadRecord.Group);
-    rCustomHosts.push_back(mainHost);
-
+    // The service groups only depend on the global services and the async proxies which are all ready at this point, so we spawn the
+    // threads before creating the main thread host. This lets every group construct its services concurrently with the main thread.
+    // Nothing waits for a group to finish its startup, a async proxy just queues its messages until the group hosting the service is running,
+    // so only a caller that waits for the result of a async call blocks on that group.
+    // The registry does not record which groups use the async services of another group (the services look them up while they are
+    // constructed), so there is no dependency order to launch the groups in. Instead the groups are spawned in the order of the most
+    // important service they host, so the threads that start the high priority services get a head start when there are few cores.
+    std::stable_sort(m_hostRecords.begin(), m_hostRecords.end(), [](const HostRecord& lhs, const HostRecord& rhs)
+                     { return GetHighestStartupPriority(lhs.Group) > GetHighestStartupPriority(rhs.Group); });
 
-    // Spawn all the required threads
     for (const auto& hostRecord : m_hostRecords)
     {
       auto asyncLaunchRecords = BuildAsyncServiceImplLaunchFactoryRecordDeque(hostRecord.Group.AsyncServices);
@@ -198,7 +232,7 @@ namespace Fsl
       switch (hostRecord.Group.Type)
       {
       case ServiceGroupType::Managed:
-        m_threadRecords.push_back(SpawnThread(mainHost.MessageQueue, hostRecord.MessageQueue, serviceConfig, serviceHostFactory));
+        m_threadRecords.push_back(SpawnThread(mainThreadRecord.MessageQueue, hostRecord.MessageQueue, serviceConfig, serviceHostFactory));
         break;
       case ServiceGroupType::MainThread:
         throw std::runtime_error("we expected the main-thread type to have been removed");
@@ -207,6 +241,9 @@ namespace Fsl
       }
     }
 
+    auto mainHost = PrepareMainThread(mainThreadRecord.Group.Id, mainThreadRecord.MessageQueue, globalServiceInfo, mainThreadRecord.Group);
+    rCustomHosts.push_back(mainHost);
+
     m_hostRecords.clear();
     m_state = State::Running;
   }
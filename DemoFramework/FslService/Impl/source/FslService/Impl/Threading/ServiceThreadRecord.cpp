@@ -31,6 +31,7 @@
 
 #include "ServiceThreadRecord.hpp"
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/StartupTimeline.hpp>
 #include <FslService/Impl/Foundation/Message/BasicMessageQueue.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadInitBasicMessage.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadShutdownBasicMessage.hpp>
@@ -58,8 +59,16 @@ namespace Fsl
       {
         ServiceHostContext hostContext(incomingProvider);
         ServiceHostCreateInfo createInfo(hostContext, serviceConfig);
-        // Allocate the host 'inside' the right thread so it lives it life fully in this thread
-        const auto serviceHost = serviceHostFactory->Allocate(createInfo);
+        std::shared_ptr<IServiceHost> serviceHost;
+        if (StartupTimeline::IsRecording())
+        {
+          StartupTimeline::SetThreadName(fmt::format("ServiceGroup {}", serviceConfig.Id.GetValue()));
+        }
+        {
+          ScopedStartupTimelineZone timelineZone("ServiceHost");
+          // Allocate the host 'inside' the right thread so it lives it life fully in this thread
+          serviceHost = serviceHostFactory->Allocate(createInfo);
+        }
         serviceHost->Run();
 
         // Notify the owner queue that we shutdown
@@ -68,6 +68,7 @@ namespace Fsl
     ScopedProfilerCustomCounterHandle m_hProfileCounterResolve;
     ScopedProfilerCustomCounterHandle m_hProfileCounterDraw;
     ScopedProfilerCustomCounterHandle m_hProfileCounterWin;
+    ScopedProfilerCustomCounterHandle m_hProfileCounterMeasure;
     std::shared_ptr<UI::BaseWindow> m_mainWindow;
 
   public:
@@ -103,6 +103,7 @@ namespace Fsl
     , m_hProfileCounterResolve(m_profilerService, m_profilerService->CreateCustomCounter("resolve", 0, 200, DefaultProfilerColors::UIResolve))
     , m_hProfileCounterDraw(m_profilerService, m_profilerService->CreateCustomCounter("draw", 0, 200, DefaultProfilerColors::UIDraw))
     , m_hProfileCounterWin(m_profilerService, m_profilerService->CreateCustomCounter("win", 0, 200, DefaultProfilerColors::UIWinCount))
+    , m_hProfileCounterMeasure(m_profilerService, m_profilerService->CreateCustomCounter("measure", 0, 200, DefaultProfilerColors::UIMeasure))
   {
     m_activitySystem->RegisterEventListener(eventListener);
   }
@@ -333,6 +334,7 @@ namespace Fsl
     m_profilerService->Set(m_hProfileCounterResolve, UncheckedNumericCast<int32_t>(stats.ResolveCalls));
     m_profilerService->Set(m_hProfileCounterDraw, UncheckedNumericCast<int32_t>(stats.DrawCalls));
     m_profilerService->Set(m_hProfileCounterWin, UncheckedNumericCast<int32_t>(stats.WindowCount));
+    m_profilerService->Set(m_hProfileCounterMeasure, UncheckedNumericCast<int32_t>(stats.MeasureCalls));
   }
 
   bool UIDemoAppExtensionBase::SYS_GetUseYFlipTextureCoordinates() const noexcept
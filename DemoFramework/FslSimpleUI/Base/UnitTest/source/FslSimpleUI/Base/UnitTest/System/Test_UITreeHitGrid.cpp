@@ -0,0 +1,111 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Base/System/UITreeHitGrid.hpp>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_UITreeHitGrid = TestFixtureFslBase;
+
+  int32_t LinearFindTopMost(const std::vector<UI::UITreeInputTargetRecord>& records, const PxPoint2& positionPx)
+  {
+    for (std::size_t i = records.size(); i > 0; --i)
+    {
+      if (records[i - 1].VisibleRectPx.Contains(positionPx))
+      {
+        return static_cast<int32_t>(i - 1);
+      }
+    }
+    return -1;
+  }
+}
+
+
+TEST_F(Test_UITreeHitGrid, Empty)
+{
+  UI::UITreeHitGrid grid;
+  std::vector<UI::UITreeInputTargetRecord> records;
+  grid.Build(SpanUtil::AsReadOnlySpan(records));
+
+  EXPECT_EQ(-1, grid.TryFindTopMost(SpanUtil::AsReadOnlySpan(records), PxPoint2::Create(0, 0)));
+  EXPECT_EQ(0u, grid.GetEntryCount());
+}
+
+
+TEST_F(Test_UITreeHitGrid, TopMost)
+{
+  std::vector<UI::UITreeInputTargetRecord> records;
+  records.emplace_back(PxRectangle::Create(0, 0, 100, 100), nullptr);
+  records.emplace_back(PxRectangle::Create(10, 10, 10, 10), nullptr);
+  // Empty rectangles can never be hit
+  records.emplace_back(PxRectangle::Create(50, 50, 0, 10), nullptr);
+
+  UI::UITreeHitGrid grid;
+  const auto span = SpanUtil::AsReadOnlySpan(records);
+  grid.Build(span);
+
+  EXPECT_EQ(1, grid.TryFindTopMost(span, PxPoint2::Create(15, 15)));
+  EXPECT_EQ(1, grid.TryFindTopMost(span, PxPoint2::Create(10, 10)));
+  EXPECT_EQ(0, grid.TryFindTopMost(span, PxPoint2::Create(20, 20)));
+  EXPECT_EQ(0, grid.TryFindTopMost(span, PxPoint2::Create(50, 50)));
+  EXPECT_EQ(-1, grid.TryFindTopMost(span, PxPoint2::Create(100, 50)));
+  EXPECT_EQ(-1, grid.TryFindTopMost(span, PxPoint2::Create(-1, 50)));
+}
+
+
+TEST_F(Test_UITreeHitGrid, MatchesLinearSearch)
+{
+  std::mt19937 random(1234);
+  std::uniform_int_distribution<int32_t> positionDist(-50, 1050);
+  std::uniform_int_distribution<int32_t> sizeDist(0, 200);
+
+  std::vector<UI::UITreeInputTargetRecord> records;
+  for (int32_t i = 0; i < 2000; ++i)
+  {
+    records.emplace_back(PxRectangle::Create(positionDist(random), positionDist(random), sizeDist(random), sizeDist(random)), nullptr);
+  }
+
+  UI::UITreeHitGrid grid;
+  const auto span = SpanUtil::AsReadOnlySpan(records);
+  grid.Build(span);
+
+  for (int32_t i = 0; i < 5000; ++i)
+  {
+    const auto positionPx = PxPoint2::Create(positionDist(random), positionDist(random));
+    ASSERT_EQ(LinearFindTopMost(records, positionPx), grid.TryFindTopMost(span, positionPx));
+  }
+}
@@ -0,0 +1,164 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslSimpleUI/Base/System/TreeNode.hpp>
+#include <FslSimpleUI/Base/System/WindowToNodeMap.hpp>
+#include <FslSimpleUI/Base/UnitTest/BaseWindowTest.hpp>
+#include <FslSimpleUI/Base/UnitTest/TestFixtureFslSimpleUIUITree.hpp>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class Test_WindowToNodeMap : public TestFixtureFslSimpleUIUITree
+  {
+  protected:
+    std::vector<std::shared_ptr<UI::TreeNode>> CreateNodes(const std::size_t count)
+    {
+      std::vector<std::shared_ptr<UI::TreeNode>> nodes;
+      nodes.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        nodes.push_back(std::make_shared<UI::TreeNode>(std::make_shared<UI::BaseWindowTest>(m_windowContext)));
+      }
+      return nodes;
+    }
+  };
+}
+
+
+TEST_F(Test_WindowToNodeMap, Construct)
+{
+  UI::WindowToNodeMap map;
+
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(0u, map.size());
+  EXPECT_FALSE(map.TryGet(nullptr));
+  EXPECT_FALSE(map.Contains(nullptr));
+}
+
+
+TEST_F(Test_WindowToNodeMap, TryAdd)
+{
+  const auto nodes = CreateNodes(1);
+  UI::WindowToNodeMap map;
+
+  EXPECT_TRUE(map.TryAdd(nodes[0]->GetWindowPointer(), nodes[0]));
+
+  EXPECT_EQ(1u, map.size());
+  EXPECT_TRUE(map.Contains(nodes[0]->GetWindowPointer()));
+  EXPECT_EQ(nodes[0], map.TryGet(nodes[0]->GetWindowPointer()));
+}
+
+
+TEST_F(Test_WindowToNodeMap, TryAdd_Duplicate)
+{
+  const auto nodes = CreateNodes(1);
+  UI::WindowToNodeMap map;
+
+  EXPECT_TRUE(map.TryAdd(nodes[0]->GetWindowPointer(), nodes[0]));
+  EXPECT_FALSE(map.TryAdd(nodes[0]->GetWindowPointer(), nodes[0]));
+  EXPECT_EQ(1u, map.size());
+}
+
+
+TEST_F(Test_WindowToNodeMap, TryAdd_Null)
+{
+  const auto nodes = CreateNodes(1);
+  UI::WindowToNodeMap map;
+
+  EXPECT_THROW(map.TryAdd(nullptr, nodes[0]), std::invalid_argument);
+}
+
+
+TEST_F(Test_WindowToNodeMap, Remove_NotFound)
+{
+  const auto nodes = CreateNodes(2);
+  UI::WindowToNodeMap map;
+  map.TryAdd(nodes[0]->GetWindowPointer(), nodes[0]);
+
+  EXPECT_FALSE(map.Remove(nodes[1]->GetWindowPointer()));
+  EXPECT_FALSE(map.Remove(nullptr));
+  EXPECT_EQ(1u, map.size());
+}
+
+
+TEST_F(Test_WindowToNodeMap, AddRemove_Many)
+{
+  // Enough entries to force the table to grow a couple of times
+  const auto nodes = CreateNodes(1000);
+  UI::WindowToNodeMap map;
+  for (const auto& node : nodes)
+  {
+    EXPECT_TRUE(map.TryAdd(node->GetWindowPointer(), node));
+  }
+  EXPECT_EQ(nodes.size(), map.size());
+
+  for (std::size_t i = 0; i < nodes.size(); i += 2)
+  {
+    EXPECT_TRUE(map.Remove(nodes[i]->GetWindowPointer()));
+  }
+  EXPECT_EQ(nodes.size() / 2, map.size());
+
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+  {
+    if ((i % 2) == 0)
+    {
+      EXPECT_FALSE(map.Contains(nodes[i]->GetWindowPointer()));
+    }
+    else
+    {
+      EXPECT_EQ(nodes[i], map.TryGet(nodes[i]->GetWindowPointer()));
+    }
+  }
+}
+
+
+TEST_F(Test_WindowToNodeMap, Clear)
+{
+  const auto nodes = CreateNodes(10);
+  UI::WindowToNodeMap map;
+  for (const auto& node : nodes)
+  {
+    map.TryAdd(node->GetWindowPointer(), node);
+  }
+
+  map.clear();
+
+  EXPECT_TRUE(map.empty());
+  for (const auto& node : nodes)
+  {
+    EXPECT_FALSE(map.Contains(node->GetWindowPointer()));
+  }
+}
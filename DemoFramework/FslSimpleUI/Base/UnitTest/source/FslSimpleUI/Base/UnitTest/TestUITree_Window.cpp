@@ -29,6 +29,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Math/Dp/DpThicknessF.hpp>
 #include <FslSimpleUI/Base/System/UITree.hpp>
 #include <FslSimpleUI/Base/UnitTest/BaseWindowTest.hpp>
 #include <FslSimpleUI/Base/UnitTest/TestFixtureFslSimpleUIUITree.hpp>
@@ -248,3 +249,79 @@ TEST_F(TestUITree_Window, Window_Draw2x_DrawEnabled)
 
   CheckZeroExcept(callCount, ignoreFlags);
 }
+
+
+TEST_F(TestUITree_Window, Window_Update2X_LayoutStats)
+{
+  auto window = std::make_shared<UI::BaseWindowTest>(m_windowContext);
+  m_tree->Add(window);
+  m_tree->Update(TimeSpan(0));
+
+  // Only the new window needs to be measured and arranged
+  auto stats = m_tree->GetStats();
+  ASSERT_EQ(1u, stats.MeasureCalls);
+  ASSERT_EQ(1u, stats.ArrangeCalls);
+
+  // Nothing changed so the layout should be fully cached
+  m_tree->Update(TimeSpan(0));
+  stats = m_tree->GetStats();
+  ASSERT_EQ(0u, stats.MeasureCalls);
+  ASSERT_EQ(0u, stats.ArrangeCalls);
+}
+
+
+TEST_F(TestUITree_Window, Window_LayoutChanged_DrawRectPatched)
+{
+  const TimeSpan timeSpan(0);
+
+  auto window1 = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags::DrawEnabled);
+  auto window2 = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags::DrawEnabled);
+  PxAreaRectangleF window1RectPx;
+  PxAreaRectangleF window2RectPx;
+  window1->Callbacks.HookWinDraw = [&window1RectPx](const UI::UIDrawContext& context) { window1RectPx = context.TargetRect; };
+  window2->Callbacks.HookWinDraw = [&window2RectPx](const UI::UIDrawContext& context) { window2RectPx = context.TargetRect; };
+  m_tree->Add(window1);
+  m_tree->Add(window2);
+  m_tree->Update(timeSpan);
+  m_tree->Draw(this->m_buffer);
+
+  const PxAreaRectangleF oldWindow1RectPx = window1RectPx;
+  const PxAreaRectangleF oldWindow2RectPx = window2RectPx;
+
+  window1->SetMargin(DpThicknessF(DpValueF(10), DpValueF(20), DpValueF(0), DpValueF(0)));
+  m_tree->Update(timeSpan);
+
+  // Only the modified window and its parent (the root) should be measured
+  const auto stats = m_tree->GetStats();
+  ASSERT_EQ(2u, stats.MeasureCalls);
+  ASSERT_EQ(2u, stats.ArrangeCalls);
+
+  m_tree->Draw(this->m_buffer);
+
+  EXPECT_EQ(2u, window1->GetCallCount().WinDraw);
+  EXPECT_EQ(2u, window2->GetCallCount().WinDraw);
+  EXPECT_EQ(oldWindow1RectPx.Left() + PxValueF(10), window1RectPx.Left());
+  EXPECT_EQ(oldWindow1RectPx.Top() + PxValueF(20), window1RectPx.Top());
+  EXPECT_EQ(oldWindow2RectPx, window2RectPx);
+}
+
+
+TEST_F(TestUITree_Window, Window_VisibilityChanged_DrawCacheRebuilt)
+{
+  const TimeSpan timeSpan(0);
+
+  auto window1 = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags::DrawEnabled);
+  auto window2 = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags::DrawEnabled);
+  m_tree->Add(window1);
+  m_tree->Add(window2);
+  m_tree->Update(timeSpan);
+  m_tree->Draw(this->m_buffer);
+
+  window1->SetVisibility(UI::ItemVisibility::Hidden);
+  m_tree->Update(timeSpan);
+  m_tree->Draw(this->m_buffer);
+
+  EXPECT_EQ(1u, window1->GetCallCount().WinDraw);
+  EXPECT_EQ(2u, window2->GetCallCount().WinDraw);
+  EXPECT_EQ(1u, m_tree->GetStats().DrawCalls);
+}
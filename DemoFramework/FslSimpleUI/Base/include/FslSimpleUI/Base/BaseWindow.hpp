@@ -160,6 +160,15 @@ namespace Fsl
         return m_layoutCache.ContentRectPx;
       }
 
+      //! @brief Called by the UITree to check if a arrange pass was executed since the last call.
+      //! @return true if the window was arranged (the flag is cleared by this call).
+      bool WinConsumeLayoutArranged() noexcept
+      {
+        const bool arranged = m_flags.IsEnabled(BaseWindowFlags::LayoutArranged);
+        m_flags.Disable(BaseWindowFlags::LayoutArranged);
+        return arranged;
+      }
+
       virtual void WinHandleEvent(const RoutedEvent& routedEvent);
 
       //! @note This is only called if enabled.
@@ -60,6 +60,11 @@ namespace Fsl
       SpriteUnitConverter UnitConverter;
       UIColorConverter ColorConverter;
 
+      //! The number of windows that executed a measure pass since the counter was last reset by the window manager
+      uint32_t LayoutMeasureCount{0};
+      //! The number of windows that executed a arrange pass since the counter was last reset by the window manager
+      uint32_t LayoutArrangeCount{0};
+
       explicit BaseWindowContext(const std::shared_ptr<UIContext>& uiContext, const uint32_t densityDpi, const UIColorSpace colorSpace);
       ~BaseWindowContext();
 
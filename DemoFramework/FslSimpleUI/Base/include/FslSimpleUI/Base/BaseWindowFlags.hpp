@@ -55,7 +55,9 @@ namespace Fsl::UI
       InBatchPropertyUpdate = (0x01 << BitShiftBaseWindowFlags),
       InLayoutArrange = (0x02 << BitShiftBaseWindowFlags),
       InLayoutMeasure = (0x04 << BitShiftBaseWindowFlags),
-      CachedEventReady = (0x08 << BitShiftBaseWindowFlags)
+      CachedEventReady = (0x08 << BitShiftBaseWindowFlags),
+      //! Set when a arrange pass was executed, cleared by the UITree once it has patched its cached records for the window
+      LayoutArranged = (0x10 << BitShiftBaseWindowFlags)
     };
 
     uint32_t Value{0};
@@ -0,0 +1,83 @@
+#ifndef FSLSIMPLEUI_BASE_SYSTEM_UITREEHITGRID_HPP
+#define FSLSIMPLEUI_BASE_SYSTEM_UITREEHITGRID_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslBase/Math/Pixel/PxRectangle.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <vector>
+#include <FslSimpleUI/Base/System/UITreeInputTargetRecord.hpp>
+
+namespace Fsl::UI
+{
+  //! @brief A uniform grid over the visible input rectangles which allows the UITree to find the top most hit without testing every
+  //!        rectangle.
+  //! @note  Each cell stores the indices of the records that overlap it in ascending (z) order, so the last match in a cell is the top
+  //!        most hit. The cells are stored in a compact 'offset + entries' form to keep lookups cache friendly.
+  class UITreeHitGrid
+  {
+    //! The union of all the non empty record rectangles
+    PxRectangle m_boundsPx;
+    int32_t m_cellCountX{0};
+    int32_t m_cellCountY{0};
+    int32_t m_cellWidthPx{1};
+    int32_t m_cellHeightPx{1};
+    //! m_cellOffsets[cell] is the first entry of the cell, m_cellOffsets[cell + 1] the end
+    std::vector<uint32_t> m_cellOffsets;
+    std::vector<uint32_t> m_entries;
+    std::vector<uint32_t> m_scratchpad;
+
+  public:
+    //! @brief Rebuild the grid from the given records (the record order defines the z-order, the last record is top most)
+    void Build(const ReadOnlySpan<UITreeInputTargetRecord> records);
+
+    void Clear() noexcept;
+
+    //! @brief Find the top most record that contains the position.
+    //! @param records the records the grid was build from.
+    //! @return the index of the record or -1 if nothing was hit.
+    int32_t TryFindTopMost(const ReadOnlySpan<UITreeInputTargetRecord> records, const PxPoint2& positionPx) const noexcept;
+
+    //! @brief Get the number of cell entries (a record is stored in every cell it overlaps)
+    std::size_t GetEntryCount() const noexcept
+    {
+      return m_entries.size();
+    }
+
+  private:
+    int32_t ToCellX(const int32_t valuePx) const noexcept;
+    int32_t ToCellY(const int32_t valuePx) const noexcept;
+  };
+}
+
+#endif
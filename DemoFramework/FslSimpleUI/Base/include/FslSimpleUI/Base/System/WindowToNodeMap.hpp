@@ -0,0 +1,215 @@
+#ifndef FSLSIMPLEUI_BASE_SYSTEM_WINDOWTONODEMAP_HPP
+#define FSLSIMPLEUI_BASE_SYSTEM_WINDOWTONODEMAP_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Fsl::UI
+{
+  class IWindowId;
+  class TreeNode;
+
+  //! @brief A flat open addressing (linear probing) hash map used for the window -> node lookups of the UITree.
+  //!        The lookups are performed for every input event and window manager request so this avoids the pointer chasing of a std::map.
+  class WindowToNodeMap
+  {
+    static constexpr uint32_t MinCapacityShift = 4;
+
+    struct Record
+    {
+      const IWindowId* pKey{nullptr};
+      std::shared_ptr<TreeNode> Node;
+    };
+
+    //! The capacity is always a power of two
+    std::vector<Record> m_records;
+    std::size_t m_count{0};
+    //! 64 - log2(capacity)
+    uint32_t m_hashShift{64 - MinCapacityShift};
+    //! Returned by TryGet when the key is unknown
+    std::shared_ptr<TreeNode> m_notFound;
+
+  public:
+    WindowToNodeMap()
+      : m_records(std::size_t(1) << MinCapacityShift)
+    {
+    }
+
+    std::size_t size() const noexcept
+    {
+      return m_count;
+    }
+
+    bool empty() const noexcept
+    {
+      return m_count == 0u;
+    }
+
+    void clear() noexcept
+    {
+      for (auto& rRecord : m_records)
+      {
+        rRecord = {};
+      }
+      m_count = 0u;
+    }
+
+    bool Contains(const IWindowId* const pKey) const noexcept
+    {
+      return TryGet(pKey) != nullptr;
+    }
+
+    //! @brief Try to locate the node associated with the key
+    //! @return the node or a empty pointer if not found
+    const std::shared_ptr<TreeNode>& TryGet(const IWindowId* const pKey) const noexcept
+    {
+      if (pKey == nullptr)
+      {
+        return m_notFound;
+      }
+      const std::size_t mask = m_records.size() - 1u;
+      std::size_t index = HashIndex(pKey);
+      while (m_records[index].pKey != nullptr)
+      {
+        if (m_records[index].pKey == pKey)
+        {
+          return m_records[index].Node;
+        }
+        index = (index + 1u) & mask;
+      }
+      return m_notFound;
+    }
+
+    //! @brief Add the key, value pair
+    //! @return true if added, false if the key already existed.
+    bool TryAdd(const IWindowId* const pKey, std::shared_ptr<TreeNode> node)
+    {
+      if (pKey == nullptr)
+      {
+        throw std::invalid_argument("key can not be null");
+      }
+      // Keep the load factor at or below 0.5 to keep the probe sequences short
+      if (((m_count + 1u) * 2u) > m_records.size())
+      {
+        Grow();
+      }
+      const std::size_t mask = m_records.size() - 1u;
+      std::size_t index = HashIndex(pKey);
+      while (m_records[index].pKey != nullptr)
+      {
+        if (m_records[index].pKey == pKey)
+        {
+          return false;
+        }
+        index = (index + 1u) & mask;
+      }
+      m_records[index].pKey = pKey;
+      m_records[index].Node = std::move(node);
+      ++m_count;
+      return true;
+    }
+
+    //! @brief Remove the key
+    //! @return true if it was removed, false if it was not found
+    bool Remove(const IWindowId* const pKey) noexcept
+    {
+      if (pKey == nullptr)
+      {
+        return false;
+      }
+      const std::size_t mask = m_records.size() - 1u;
+      std::size_t index = HashIndex(pKey);
+      while (m_records[index].pKey != pKey)
+      {
+        if (m_records[index].pKey == nullptr)
+        {
+          return false;
+        }
+        index = (index + 1u) & mask;
+      }
+
+      // Backward shift deletion, so we dont need tombstones
+      std::size_t next = (index + 1u) & mask;
+      while (m_records[next].pKey != nullptr)
+      {
+        const std::size_t idealIndex = HashIndex(m_records[next].pKey);
+        if (((next - idealIndex) & mask) >= ((next - index) & mask))
+        {
+          m_records[index] = std::move(m_records[next]);
+          index = next;
+        }
+        next = (next + 1u) & mask;
+      }
+      m_records[index] = {};
+      assert(m_count > 0u);
+      --m_count;
+      return true;
+    }
+
+  private:
+    std::size_t HashIndex(const IWindowId* const pKey) const noexcept
+    {
+      // Fibonacci hashing spreads the (aligned) pointer values over the table
+      const auto value = static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(pKey));
+      return static_cast<std::size_t>((value * 0x9E3779B97F4A7C15ull) >> m_hashShift);
+    }
+
+    void Grow()
+    {
+      std::vector<Record> oldRecords(m_records.size() * 2u);
+      std::swap(oldRecords, m_records);
+      --m_hashShift;
+
+      const std::size_t mask = m_records.size() - 1u;
+      for (auto& rRecord : oldRecords)
+      {
+        if (rRecord.pKey != nullptr)
+        {
+          std::size_t index = HashIndex(rRecord.pKey);
+          while (m_records[index].pKey != nullptr)
+          {
+            index = (index + 1u) & mask;
+          }
+          m_records[index] = std::move(rRecord);
+        }
+      }
+    }
+  };
+}
+
+#endif
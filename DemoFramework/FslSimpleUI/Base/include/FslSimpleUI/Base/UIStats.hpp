@@ -42,15 +42,21 @@ namespace Fsl::UI
     uint32_t PostLayoutCalls{0};
     uint32_t DrawCalls{0};
     uint32_t WindowCount{0};
+    //! The number of windows that were re-measured during the frame
+    uint32_t MeasureCalls{0};
+    //! The number of windows that were re-arranged during the frame
+    uint32_t ArrangeCalls{0};
 
     constexpr UIStats() noexcept = default;
     constexpr UIStats(const uint32_t updateCalls, const uint32_t resolveCalls, const uint32_t postLayoutCalls, const uint32_t drawCalls,
-                      const uint32_t windowCount) noexcept
+                      const uint32_t windowCount, const uint32_t measureCalls = 0, const uint32_t arrangeCalls = 0) noexcept
       : UpdateCalls(updateCalls)
       , ResolveCalls(resolveCalls)
       , PostLayoutCalls(postLayoutCalls)
       , DrawCalls(drawCalls)
       , WindowCount(windowCount)
+      , MeasureCalls(measureCalls)
+      , ArrangeCalls(arrangeCalls)
     {
     }
   };
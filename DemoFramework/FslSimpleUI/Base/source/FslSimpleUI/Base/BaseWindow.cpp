@@ -190,6 +190,8 @@ namespace Fsl::UI
     if (IsLayoutDirty() || finalRectPx != m_layoutCache.ArrangeLastFinalRectPx)
     {
       m_layoutCache.ArrangeLastFinalRectPx = finalRectPx;
+      m_flags.Enable(BaseWindowFlags::LayoutArranged);
+      ++m_context->LayoutArrangeCount;
 
       MarkLayoutArrangeBegin();
       try
@@ -253,6 +255,7 @@ namespace Fsl::UI
     if (IsLayoutDirty() || availableSizePx != m_layoutCache.MeasureLastAvailableSizePx)
     {
       m_layoutCache.MeasureLastAvailableSizePx = availableSizePx;
+      ++m_context->LayoutMeasureCount;
 
       MarkLayoutMeasureBegin();
       try
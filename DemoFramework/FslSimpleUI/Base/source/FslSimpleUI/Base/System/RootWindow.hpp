@@ -63,6 +63,12 @@ namespace Fsl::UI
       return m_densityDpi;
     }
 
+    //! @brief Get the window context shared by the windows in the tree
+    BaseWindowContext& GetWindowContext() const
+    {
+      return *GetContext();
+    }
+
     //! return true if the resolution was modified
     bool SetScreenResolution(const PxExtent2D& valuePx, const uint32_t densityDpi);
 
@@ -44,6 +44,20 @@ namespace Fsl::UI
   struct RoutedEvent;
   struct UIDrawContext;
 
+  //! @brief Information recorded by the UITree during a full cache rebuild, which allows it to patch the cached records in place when only
+  //!        the layout changed.
+  struct TreeNodeLayoutCache
+  {
+    //! The screen space rectangle of the node
+    PxRectangle RectPx;
+    //! The number of draw records produced by this node and its children
+    uint32_t DrawCount{0};
+    //! The number of click input records produced by this node and its children
+    uint32_t ClickInputCount{0};
+    //! The number of mouse over records produced by this node and its children
+    uint32_t MouseOverCount{0};
+  };
+
   class TreeNode
   {
     std::weak_ptr<TreeNode> m_parent;
@@ -53,6 +67,8 @@ namespace Fsl::UI
   public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     std::deque<std::shared_ptr<TreeNode>> m_children;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    TreeNodeLayoutCache m_layoutCache;
 
     explicit TreeNode(const std::shared_ptr<BaseWindow>& window)
       : m_window(window)
@@ -184,6 +200,11 @@ namespace Fsl::UI
       return m_window->WinGetContentRectanglePx();
     }
 
+    inline bool WinConsumeLayoutArranged() noexcept
+    {
+      return m_window->WinConsumeLayoutArranged();
+    }
+
     inline void WinHandleEvent(const RoutedEvent& routedEvent)
     {
       assert(m_flags.IsRunning());
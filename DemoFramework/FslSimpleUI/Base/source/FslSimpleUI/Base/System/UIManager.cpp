@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslSimpleUI/Base/BaseWindowContext.hpp>
 #include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
 #include <FslSimpleUI/Base/Event/WindowEventSender.hpp>
@@ -234,6 +235,7 @@ namespace Fsl::UI
 
   void UIManager::ProcessEvents()
   {
+    FSL_PROFILE_SCOPE("UI.ProcessEvents");
     m_tree->ProcessEvents();
   }
 
@@ -265,6 +267,7 @@ namespace Fsl::UI
 
   void UIManager::Update(const TimeSpan& timespan)
   {
+    FSL_PROFILE_SCOPE("UI.Update");
     m_tree->Update(timespan);
   }
 
@@ -276,8 +279,10 @@ namespace Fsl::UI
 
   void UIManager::Draw(RenderPerformanceCapture* const pPerformanceCapture)
   {
+    FSL_PROFILE_SCOPE("UI.Draw");
     if (!m_useDrawCache || IsRedrawRequired())
     {    // Record the draw command list
+      FSL_PROFILE_SCOPE("UI.RecordDrawCommands");
       UIRenderSystem::ScopedDrawCommandBufferAccess scopedAccess(m_renderSystem);
       m_tree->Draw(scopedAccess.GetDrawCommandBuffer());
     }
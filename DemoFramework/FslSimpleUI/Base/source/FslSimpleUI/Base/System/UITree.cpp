@@ -35,7 +35,9 @@
 #include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/Math/Point2.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
+#include <FslSimpleUI/Base/BaseWindowContext.hpp>
 #include <FslSimpleUI/Base/Event/WindowEvent.hpp>
 #include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
 #include <FslSimpleUI/Base/LayoutHelperPxfConverter.hpp>
@@ -52,6 +54,36 @@ namespace Fsl::UI
   namespace
   {
     constexpr std::size_t MaxEventLoops = 1024;
+    //! Below this number of input targets a linear search is faster than building and using a hit test grid
+    constexpr std::size_t HitGridMinRecords = 32;
+
+    inline std::shared_ptr<TreeNode> TryHitTest(const std::vector<UITreeInputTargetRecord>& records, UITreeHitGrid& rHitGrid,
+                                                bool& rIsHitGridDirty, const PxPoint2& hitPositionPx)
+    {
+      if (records.size() < HitGridMinRecords)
+      {
+        auto itr = records.rbegin();
+        const auto itrEnd = records.rend();
+        while (itr != itrEnd)
+        {
+          if (itr->VisibleRectPx.Contains(hitPositionPx.X, hitPositionPx.Y))
+          {
+            return itr->Node;
+          }
+          ++itr;
+        }
+        return {};
+      }
+
+      const ReadOnlySpan<UITreeInputTargetRecord> recordSpan = SpanUtil::AsReadOnlySpan(records);
+      if (rIsHitGridDirty)
+      {
+        rHitGrid.Build(recordSpan);
+        rIsHitGridDirty = false;
+      }
+      const int32_t index = rHitGrid.TryFindTopMost(recordSpan, hitPositionPx);
+      return index >= 0 ? records[index].Node : std::shared_ptr<TreeNode>();
+    }
 
     inline void MarkWindowAndParentsAsDirty(const std::shared_ptr<TreeNode>& node)
     {
@@ -65,11 +97,7 @@ namespace Fsl::UI
 
     inline void RemoveDictEntry(WindowToNodeMap& rDict, const std::shared_ptr<BaseWindow>& window)
     {
-      auto itrNode = rDict.find(window.get());
-      if (itrNode != rDict.end())
-      {
-        rDict.erase(itrNode);
-      }
+      rDict.Remove(window.get());
     }
 
 
@@ -227,7 +255,7 @@ namespace Fsl::UI
       m_root = std::make_shared<TreeNode>(m_rootWindow);
       m_rootRectPx = PxRectangle(PxValue(0), PxValue(0), res.Width(), res.Height());
 
-      m_dict.emplace(m_root->GetWindowPointer(), m_root);
+      m_dict.TryAdd(m_root->GetWindowPointer(), m_root);
 
       m_state = State::Ready;
 
@@ -313,12 +341,17 @@ namespace Fsl::UI
         m_drawCacheDirty = true;
         m_clickInputCacheDirty = true;
         m_layoutIsDirty = true;
+        m_layoutRecordsDirty = false;
         m_vectorUpdate.clear();
         m_vectorResolve.clear();
         m_vectorPostLayout.clear();
         m_vectorDraw.clear();
         m_vectorClickInputTarget.clear();
         m_vectorMouseOverTarget.clear();
+        m_clickInputHitGrid.Clear();
+        m_mouseOverHitGrid.Clear();
+        m_clickInputHitGridDirty = true;
+        m_mouseOverHitGridDirty = true;
       }
 
       if (m_moduleCallbackRegistry && m_root)
@@ -409,6 +442,9 @@ namespace Fsl::UI
     ScopedContextChange scopedContextChange(this, Context::Internal);
 
     m_stats = {};
+    BaseWindowContext& rWindowContext = m_rootWindow->GetWindowContext();
+    rWindowContext.LayoutMeasureCount = 0;
+    rWindowContext.LayoutArrangeCount = 0;
 
     ProcessEventsPreUpdate();
 
@@ -445,6 +481,8 @@ namespace Fsl::UI
     {
       m_stats.PostLayoutCalls = 0;
     }
+    m_stats.MeasureCalls = rWindowContext.LayoutMeasureCount;
+    m_stats.ArrangeCalls = rWindowContext.LayoutArrangeCount;
   }
 
 
@@ -488,13 +526,13 @@ namespace Fsl::UI
     const IWindowId* const pActualWindow = (pWindow != nullptr ? pWindow : m_rootWindow.get());
 
     // Check if we know the window
-    const auto itr = m_dict.find(pActualWindow);
-    if (itr == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pActualWindow);
+    if (!node)
     {
       FSLLOG3_WARNING("PointFromScreen unknown window");
       return {};
     }
-    PxPoint2 topLeftPx = itr->second->CalcScreenTopLeftCornerPx();
+    PxPoint2 topLeftPx = node->CalcScreenTopLeftCornerPx();
     return (topLeftPx + point);
   }
 
@@ -507,15 +545,15 @@ namespace Fsl::UI
     const IWindowId* const pActualWindow = (pWindow != nullptr ? pWindow : m_rootWindow.get());
 
     // Check if we know the window
-    const auto itr = m_dict.find(pActualWindow);
-    if (itr == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pActualWindow);
+    if (!node)
     {
       FSLLOG3_WARNING("PointFromScreen unknown window");
       return {};
     }
 
     // For now we do the px rounding here
-    PxPoint2 topLeftPx = itr->second->CalcScreenTopLeftCornerPx();
+    PxPoint2 topLeftPx = node->CalcScreenTopLeftCornerPx();
     return (point - topLeftPx);
   }
 
@@ -549,13 +587,14 @@ namespace Fsl::UI
     }
 
     // Locate the parent node
-    const auto itrParent = m_dict.find(parentWindow);
-    if (itrParent == m_dict.end())
+    // Take a copy as adding the window to the dict can relocate the stored node pointers
+    const std::shared_ptr<TreeNode> parentNode = m_dict.TryGet(parentWindow);
+    if (!parentNode)
     {
       throw std::invalid_argument("the parent window is not part of this tree");
     }
 
-    if (m_dict.find(window.get()) != m_dict.end())
+    if (m_dict.Contains(window.get()))
     {
       throw std::invalid_argument("the window is already part of this tree");
     }
@@ -564,11 +603,11 @@ namespace Fsl::UI
 
 
     // We add the element to the lookup dict right away
-    auto node = std::make_shared<TreeNode>(itrParent->second, window);
+    auto node = std::make_shared<TreeNode>(parentNode, window);
     try
     {
-      m_dict.emplace(window.get(), node);
-      m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::AddChild, itrParent->second, node));
+      m_dict.TryAdd(window.get(), node);
+      m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::AddChild, parentNode, node));
 
       if (flags.IsEnabled(WindowFlags::WinInit))
       {
@@ -607,7 +646,7 @@ namespace Fsl::UI
       FSLLOG3_DEBUG_WARNING("A null window will always return false");
       return false;
     }
-    return (m_dict.find(pWindow) != m_dict.end());
+    return m_dict.Contains(pWindow);
   }
 
   bool UITree::Exists(const std::shared_ptr<BaseWindow>& window) const
@@ -617,7 +656,7 @@ namespace Fsl::UI
       throw UsageErrorException("Internal state must be ready");
     }
     // ScopedContextChange scopedContextChange(this, Context::Internal);  --> Nothing here does callbacks, so no need for a context change
-    return (m_dict.find(window.get()) != m_dict.end());
+    return m_dict.Contains(window.get());
   }
 
 
@@ -648,14 +687,14 @@ namespace Fsl::UI
     }
 
     // Locate the parent node
-    const auto itrParent = m_dict.find(tree.get());
-    if (itrParent == m_dict.end())
+    const std::shared_ptr<TreeNode>& parentNode = m_dict.TryGet(tree.get());
+    if (!parentNode)
     {
       FSLLOG3_WARNING("tree window is not a member of the UITree");
       return false;
     }
-    assert(itrParent->second);
-    return IsWindowMemberOfTree(*(itrParent->second), window, considerTreeRootAMember);
+    assert(parentNode);
+    return IsWindowMemberOfTree(*parentNode, window, considerTreeRootAMember);
   }
 
 
@@ -680,20 +719,21 @@ namespace Fsl::UI
     }
 
     // Locate the node
-    const auto itrNode = m_dict.find(window.get());
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(window.get());
+    if (!node)
     {
       FSLLOG3_WARNING("the window is not part of the tree, request ignored.");
       return;
     }
 
-    m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::ScheduleClose, itrNode->second));
+    m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::ScheduleClose, node));
   }
 
   bool UITree::IsIdle() const noexcept
   {
     return (m_state == State::Ready && m_eventQueue->IsEmpty() && !m_updateCacheDirty && !m_resolveCacheDirty && !m_postLayoutCacheIsDirty &&
-            !m_drawCacheDirty && !m_clickInputCacheDirty && !m_layoutIsDirty && m_vectorUpdate.empty()) ||
+            !m_drawCacheDirty && !m_clickInputCacheDirty && !m_layoutIsDirty && !m_layoutRecordsDirty &&
+            m_vectorUpdate.empty()) ||
            (m_state == State::Shutdown);
   }
 
@@ -715,14 +755,14 @@ namespace Fsl::UI
     }
 
     // Locate the node
-    const auto itrNode = m_dict.find(parentWindow.get());
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(parentWindow.get());
+    if (!node)
     {
       FSLLOG3_WARNING("the window is not part of the tree, request ignored.");
       return;
     }
 
-    m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::ScheduleCloseAllChildren, itrNode->second));
+    m_eventQueue->Push(WindowEventQueueRecord(WindowEventQueueRecordType::ScheduleCloseAllChildren, node));
   }
 
 
@@ -749,8 +789,8 @@ namespace Fsl::UI
       return false;
     }
 
-    const auto itrNode = m_dict.find(pWindow);
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pWindow);
+    if (!node)
     {
       return false;
     }
@@ -759,7 +799,7 @@ namespace Fsl::UI
     {
       if (flags.IsEnabled(WindowFlags::LayoutDirty))
       {
-        MarkWindowAndParentsAsDirty(itrNode->second);
+        MarkWindowAndParentsAsDirty(node);
         m_layoutIsDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ContentRenderingDirty))
@@ -768,27 +808,27 @@ namespace Fsl::UI
       }
       if (flags.IsEnabled(WindowFlags::UpdateEnabled))
       {
-        itrNode->second->EnableFlags(TreeNodeFlags::UpdateEnabled);
+        node->EnableFlags(TreeNodeFlags::UpdateEnabled);
         m_updateCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ResolveEnabled))
       {
-        itrNode->second->EnableFlags(TreeNodeFlags::ResolveEnabled);
+        node->EnableFlags(TreeNodeFlags::ResolveEnabled);
         m_resolveCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::PostLayoutEnabled))
       {
-        itrNode->second->EnableFlags(TreeNodeFlags::PostLayoutEnabled);
+        node->EnableFlags(TreeNodeFlags::PostLayoutEnabled);
         m_postLayoutCacheIsDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::DrawEnabled))
       {
-        itrNode->second->EnableFlags(TreeNodeFlags::DrawEnabled);
+        node->EnableFlags(TreeNodeFlags::DrawEnabled);
         m_drawCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ClickInput))
       {
-        itrNode->second->EnableFlags(TreeNodeFlags::ClickInput);
+        node->EnableFlags(TreeNodeFlags::ClickInput);
         m_clickInputCacheDirty = true;
       }
     }
@@ -800,7 +840,7 @@ namespace Fsl::UI
       }
       if (flags.IsEnabled(WindowFlags::UpdateEnabled))
       {
-        itrNode->second->DisableFlags(TreeNodeFlags::UpdateEnabled);
+        node->DisableFlags(TreeNodeFlags::UpdateEnabled);
         m_updateCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ResolveEnabled))
@@ -838,13 +878,18 @@ namespace Fsl::UI
       return false;
     }
 
-    const auto itrNode = m_dict.find(pWindow);
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pWindow);
+    if (!node)
     {
       return false;
     }
 
-    itrNode->second->SetVisibility(visibility);
+    node->SetVisibility(visibility);
+    // The visibility controls which records a node (and its children) contribute, so the cached records can not be patched in place
+    m_resolveCacheDirty = true;
+    m_postLayoutCacheIsDirty = true;
+    m_drawCacheDirty = true;
+    m_clickInputCacheDirty = true;
     return true;
   }
 
@@ -854,13 +899,13 @@ namespace Fsl::UI
     {
       throw UsageErrorException("Internal state must be ready");
     }
-    const auto itrNode = m_dict.find(pSource);
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pSource);
+    if (!node)
     {
       throw std::invalid_argument("The supplied source is not a window known by the window manager");
     }
 
-    pEvent->SYS_SetSource(itrNode->second->GetWindow());
+    pEvent->SYS_SetSource(node->GetWindow());
   }
 
 
@@ -877,12 +922,12 @@ namespace Fsl::UI
       throw UsageErrorException("Internal state must be ready");
     }
     // ScopedContextChange scopedContextChange(this, Context::Internal);  --> Nothing here does callbacks, so no need for a context change
-    auto itr = m_dict.find(pWindowId);
-    if (itr == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pWindowId);
+    if (!node)
     {
       return {};
     }
-    return itr->second;
+    return node;
   }
 
 
@@ -937,18 +982,7 @@ namespace Fsl::UI
     {
       throw UsageErrorException("Internal state must be ready");
     }
-
-    auto itr = m_vectorMouseOverTarget.rbegin();
-    const auto itrEnd = m_vectorMouseOverTarget.rend();
-    while (itr != itrEnd)
-    {
-      if (itr->VisibleRectPx.Contains(hitPositionPx.X, hitPositionPx.Y))
-      {
-        return itr->Node;
-      }
-      ++itr;
-    }
-    return {};
+    return TryHitTest(m_vectorMouseOverTarget, m_mouseOverHitGrid, m_mouseOverHitGridDirty, hitPositionPx);
   }
 
 
@@ -958,17 +992,7 @@ namespace Fsl::UI
     {
       throw UsageErrorException("Internal state must be ready");
     }
-    auto itr = m_vectorClickInputTarget.rbegin();
-    const auto itrEnd = m_vectorClickInputTarget.rend();
-    while (itr != itrEnd)
-    {
-      if (itr->VisibleRectPx.Contains(hitPositionPx.X, hitPositionPx.Y))
-      {
-        return itr->Node;
-      }
-      ++itr;
-    }
-    return {};
+    return TryHitTest(m_vectorClickInputTarget, m_clickInputHitGrid, m_clickInputHitGridDirty, hitPositionPx);
   }
 
   PxRectangle UITree::GetWindowRectanglePx(const IWindowId* const pWindowId) const
@@ -980,13 +1004,13 @@ namespace Fsl::UI
     const IWindowId* const pActualWindowId = (pWindowId != nullptr ? pWindowId : m_rootWindow.get());
 
     // Check if we know the window
-    const auto itr = m_dict.find(pActualWindowId);
-    if (itr == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pActualWindowId);
+    if (!node)
     {
       throw UsageErrorException("GetWindowRectanglePx() Unknown window");
     }
-    PxPoint2 topLeftPx = itr->second->CalcScreenTopLeftCornerPx();
-    PxSize2D renderSizePx = itr->second->GetWindow()->RenderSizePx();
+    PxPoint2 topLeftPx = node->CalcScreenTopLeftCornerPx();
+    PxSize2D renderSizePx = node->GetWindow()->RenderSizePx();
     return {topLeftPx, renderSizePx};
   }
 
@@ -999,13 +1023,13 @@ namespace Fsl::UI
     const IWindowId* const pActualWindowId = (pWindowId != nullptr ? pWindowId : m_rootWindow.get());
 
     // Check if we know the window
-    const auto itr = m_dict.find(pActualWindowId);
-    if (itr == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(pActualWindowId);
+    if (!node)
     {
       return {};
     }
-    PxPoint2 topLeftPx = itr->second->CalcScreenTopLeftCornerPx();
-    PxSize2D renderSizePx = itr->second->GetWindow()->RenderSizePx();
+    PxPoint2 topLeftPx = node->CalcScreenTopLeftCornerPx();
+    PxSize2D renderSizePx = node->GetWindow()->RenderSizePx();
     return {PxRectangle(topLeftPx, renderSizePx)};
   }
 
@@ -1029,8 +1053,8 @@ namespace Fsl::UI
       throw std::invalid_argument("target can not be null");
     }
 
-    const auto itrNode = m_dict.find(target->GetWindow().get());
-    if (itrNode == m_dict.end())
+    const std::shared_ptr<TreeNode>& node = m_dict.TryGet(target->GetWindow().get());
+    if (!node)
     {
       throw UsageErrorException("target is not a member of the tree");
     }
@@ -1068,9 +1092,8 @@ namespace Fsl::UI
     if (m_layoutIsDirty)
     {
       m_layoutIsDirty = false;
-      m_drawCacheDirty = true;
-      m_postLayoutCacheIsDirty = true;
-      m_clickInputCacheDirty = true;
+      // The layout only modifies the window rectangles, so unless the tree structure changed the cached records can be patched in place
+      m_layoutRecordsDirty = true;
 
       const auto sizePx = LayoutHelperPxfConverter::ToPxAvailableSize(m_rootRectPx.GetSize());
       m_rootWindow->Measure(sizePx);
@@ -1091,12 +1114,24 @@ namespace Fsl::UI
   }
 
 
-  // TODO: we need to use a more complex algorithm for rebuilding
   void UITree::RebuildDeques()
   {
     assert(m_state == State::Ready);
     if (!m_updateCacheDirty && !m_resolveCacheDirty && !m_postLayoutCacheIsDirty && !m_drawCacheDirty && !m_clickInputCacheDirty)
     {
+      if (m_layoutRecordsDirty)
+      {
+        // Only the layout changed so we patch the rectangles of the windows that were arranged (and their children)
+        m_layoutRecordsDirty = false;
+        m_clickInputHitGridDirty = true;
+        m_mouseOverHitGridDirty = true;
+        DrawClipContext clipContext(m_clipEnabled, TypeConverter::UncheckedTo<PxAreaRectangleF>(!m_clipEnabled ? m_rootRectPx : m_rootClipRectPx));
+        UITreePatchCursor cursor;
+        PatchDeques(m_root, m_rootRectPx, false, ItemVisibility::Visible, clipContext, cursor);
+        assert(cursor.DrawIndex == m_vectorDraw.size());
+        assert(cursor.ClickInputIndex == m_vectorClickInputTarget.size());
+        assert(cursor.MouseOverIndex == m_vectorMouseOverTarget.size());
+      }
       return;
     }
 
@@ -1105,8 +1140,11 @@ namespace Fsl::UI
     m_postLayoutCacheIsDirty = false;
     m_drawCacheDirty = false;
     m_clickInputCacheDirty = false;
+    m_layoutRecordsDirty = false;
+    m_clickInputHitGridDirty = true;
+    m_mouseOverHitGridDirty = true;
 
-    // Lots of optimization possibilities here
+    // The tree structure changed, so do a full rebuild (which also records the information needed to patch the vectors later)
     m_vectorUpdate.clear();
     m_vectorResolve.clear();
     m_vectorPostLayout.clear();
@@ -1153,6 +1191,10 @@ namespace Fsl::UI
 
     // WARNING: at this point the original parent drawClipContext might have been replaced
 
+    const std::size_t drawStartIndex = m_vectorDraw.size();
+    const std::size_t clickInputStartIndex = m_vectorClickInputTarget.size();
+    const std::size_t mouseOverStartIndex = m_vectorMouseOverTarget.size();
+
     if (flags.IsFlagged(TreeNodeFlags::UpdateEnabled))
     {
       m_vectorUpdate.push_back(node.get());
@@ -1185,6 +1227,87 @@ namespace Fsl::UI
     {
       RebuildDeques(entry, currentRectPx, visibility, drawClipContext);
     }
+
+    // The rebuild captured the current layout
+    node->WinConsumeLayoutArranged();
+    node->m_layoutCache.RectPx = currentRectPx;
+    node->m_layoutCache.DrawCount = UncheckedNumericCast<uint32_t>(m_vectorDraw.size() - drawStartIndex);
+    node->m_layoutCache.ClickInputCount = UncheckedNumericCast<uint32_t>(m_vectorClickInputTarget.size() - clickInputStartIndex);
+    node->m_layoutCache.MouseOverCount = UncheckedNumericCast<uint32_t>(m_vectorMouseOverTarget.size() - mouseOverStartIndex);
+  }
+
+
+  //! @brief Patch the rectangles of the cached records in place.
+  //! @note  This expects that the tree structure, flags and visibility is unchanged since the last full rebuild.
+  //!        Since a window can only be arranged by its parent, a window that was not arranged and whose parent rectangle is unchanged
+  //!        has a unchanged subtree which can be skipped.
+  void UITree::PatchDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const bool parentRectChanged,
+                           const ItemVisibility parentVisibility, DrawClipContext drawClipContext, UITreePatchCursor& rCursor)
+  {
+    assert(m_state == State::Ready);
+    TreeNodeLayoutCache& rLayoutCache = node->m_layoutCache;
+    if (!node->WinConsumeLayoutArranged() && !parentRectChanged)
+    {
+      rCursor.DrawIndex += rLayoutCache.DrawCount;
+      rCursor.ClickInputIndex += rLayoutCache.ClickInputCount;
+      rCursor.MouseOverIndex += rLayoutCache.MouseOverCount;
+      return;
+    }
+
+    PxRectangle currentRectPx = node->WinGetContentRectanglePx();
+    currentRectPx.Add(parentRectPx.Location());
+    // The clip rectangles of the children are derived from the ancestor rectangles, so any change has to be propagated
+    const bool rectChanged = parentRectChanged || currentRectPx != rLayoutCache.RectPx;
+    rLayoutCache.RectPx = currentRectPx;
+
+    PxRectangle currentInputRectPx = currentRectPx;
+
+    const TreeNodeFlags flags = node->GetFlags();
+    ItemVisibility visibility = flags.GetVisibility();
+    visibility = parentVisibility <= visibility ? visibility : parentVisibility;
+
+    if (flags.IsFlagged(WindowFlags::ClipEnabled))
+    {
+      PxAreaRectangleF currentClipRectPxf(TypeConverter::UncheckedTo<PxAreaRectangleF>(currentRectPx));
+      drawClipContext = DrawClipContext(
+        true, !drawClipContext.Enabled ? currentClipRectPxf : PxAreaRectangleF::Intersect(drawClipContext.ClipRectanglePxf, currentClipRectPxf));
+      currentInputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(drawClipContext.ClipRectanglePxf);
+    }
+    else if (drawClipContext.Enabled)
+    {
+      PxAreaRectangleF currentInputRectPxf =
+        PxAreaRectangleF::Intersect(drawClipContext.ClipRectanglePxf, TypeConverter::UncheckedTo<PxAreaRectangleF>(currentInputRectPx));
+      currentInputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(currentInputRectPxf);
+    }
+
+    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::DrawEnabled))
+    {
+      assert(rCursor.DrawIndex < m_vectorDraw.size());
+      assert(m_vectorDraw[rCursor.DrawIndex].pWindow == node->GetWindowPointer());
+      m_vectorDraw[rCursor.DrawIndex].DrawContext =
+        TreeNodeDrawContext(TypeConverter::UncheckedTo<PxAreaRectangleF>(currentRectPx), drawClipContext);
+      ++rCursor.DrawIndex;
+    }
+    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::ClickInput))
+    {
+      assert(rCursor.ClickInputIndex < m_vectorClickInputTarget.size());
+      assert(m_vectorClickInputTarget[rCursor.ClickInputIndex].Node == node);
+      m_vectorClickInputTarget[rCursor.ClickInputIndex].VisibleRectPx = currentInputRectPx;
+      ++rCursor.ClickInputIndex;
+    }
+    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::MouseOver))
+    {
+      assert(rCursor.MouseOverIndex < m_vectorMouseOverTarget.size());
+      assert(m_vectorMouseOverTarget[rCursor.MouseOverIndex].Node == node);
+      m_vectorMouseOverTarget[rCursor.MouseOverIndex].VisibleRectPx = currentInputRectPx;
+      ++rCursor.MouseOverIndex;
+    }
+
+    auto& nodeChildren = node->m_children;
+    for (auto& entry : nodeChildren)
+    {
+      PatchDeques(entry, currentRectPx, rectChanged, visibility, drawClipContext, rCursor);
+    }
   }
 
 
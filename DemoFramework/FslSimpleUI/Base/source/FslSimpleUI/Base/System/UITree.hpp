@@ -37,11 +37,13 @@
 #include <FslSimpleUI/Base/IWindowManager.hpp>
 #include <FslSimpleUI/Base/ItemVisibility.hpp>
 #include <FslSimpleUI/Base/System/Event/IEventHandler.hpp>
+#include <FslSimpleUI/Base/System/UITreeHitGrid.hpp>
+#include <FslSimpleUI/Base/System/UITreeInputTargetRecord.hpp>
+#include <FslSimpleUI/Base/System/WindowToNodeMap.hpp>
 #include <FslSimpleUI/Base/UIDrawContext.hpp>
 #include <FslSimpleUI/Base/UIStats.hpp>
 #include <FslSimpleUI/Render/Base/DrawClipContext.hpp>
 #include <deque>
-#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -70,7 +72,6 @@ namespace Fsl
     class WindowEventPool;
     class WindowEventQueueEx;
 
-    using WindowToNodeMap = std::map<const IWindowId*, std::shared_ptr<TreeNode>>;
     using FastTreeNodeVector = std::vector<TreeNode*>;
 
     struct UITreeDrawRecord
@@ -88,22 +89,16 @@ namespace Fsl
       }
     };
 
-    struct UITreeInputTargetRecord
-    {
-      PxRectangle VisibleRectPx;
-      std::shared_ptr<TreeNode> Node;
-
-      UITreeInputTargetRecord() = default;
+    using UITreeDrawVector = std::vector<UITreeDrawRecord>;
 
-      UITreeInputTargetRecord(const PxRectangle& visibleRectPx, std::shared_ptr<TreeNode> node)
-        : VisibleRectPx(visibleRectPx)
-        , Node(std::move(node))
-      {
-      }
+    //! @brief The current write position in the cached record vectors while patching them in place
+    struct UITreePatchCursor
+    {
+      std::size_t DrawIndex{0};
+      std::size_t ClickInputIndex{0};
+      std::size_t MouseOverIndex{0};
     };
 
-    using UITreeDrawVector = std::vector<UITreeDrawRecord>;
-
 
     //! @note This tree is designed with the assumption that windows will NOT be reused.
     class UITree final
@@ -156,6 +151,8 @@ namespace Fsl
       bool m_drawCacheDirty{true};
       bool m_clickInputCacheDirty{true};
       bool m_layoutIsDirty{true};
+      //! Set when a layout pass modified the window rectangles but not the tree structure, so the cached records can be patched in place
+      bool m_layoutRecordsDirty{false};
       bool m_contentRenderingIsDirty{true};
 
       FastTreeNodeVector m_vectorUpdate;
@@ -164,6 +161,11 @@ namespace Fsl
       UITreeDrawVector m_vectorDraw;
       std::vector<UITreeInputTargetRecord> m_vectorClickInputTarget;
       std::vector<UITreeInputTargetRecord> m_vectorMouseOverTarget;
+      //! The hit test grids are build on demand the first time they are needed after the input target records changed
+      mutable UITreeHitGrid m_clickInputHitGrid;
+      mutable UITreeHitGrid m_mouseOverHitGrid;
+      mutable bool m_clickInputHitGridDirty{true};
+      mutable bool m_mouseOverHitGridDirty{true};
 
       FastTreeNodeVector m_nodeScratchpad;
       FastTreeNodeVector m_nodeScratchpadPostResolve;
@@ -260,6 +262,8 @@ namespace Fsl
       inline void RebuildDeques();
       void RebuildDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
                          DrawClipContext drawClipContext);
+      void PatchDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const bool parentRectChanged,
+                       const ItemVisibility parentVisibility, DrawClipContext drawClipContext, UITreePatchCursor& rCursor);
       inline void ProcessEventsPreUpdate();
       inline void ProcessEventsPostUpdate(const TimeSpan& timespan);
       inline void ProcessEventsPostResolve(const TimeSpan& timespan);
@@ -0,0 +1,188 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Base/System/UITreeHitGrid.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! Caps the memory used by the grid and the number of cells a large rectangle (like a full screen container) is added to
+      constexpr int32_t MaxCellsPerAxis = 128;
+      //! The desired average number of records per cell
+      constexpr uint32_t RecordsPerCell = 4;
+    }
+
+    inline bool IsHitTestable(const PxRectangle& rectPx) noexcept
+    {
+      return rectPx.RawWidth() > 0 && rectPx.RawHeight() > 0;
+    }
+  }
+
+
+  void UITreeHitGrid::Build(const ReadOnlySpan<UITreeInputTargetRecord> records)
+  {
+    Clear();
+
+    // Calculate the bounds, nothing outside these can be hit
+    bool hasBounds = false;
+    for (const auto& record : records)
+    {
+      if (IsHitTestable(record.VisibleRectPx))
+      {
+        m_boundsPx = !hasBounds ? record.VisibleRectPx : PxRectangle::Union(m_boundsPx, record.VisibleRectPx);
+        hasBounds = true;
+      }
+    }
+    if (!hasBounds)
+    {
+      return;
+    }
+
+    {    // Pick a cell count based on the record count and the bounds aspect ratio
+      const auto desiredCellCount = static_cast<float>(std::max(records.size() / LocalConfig::RecordsPerCell, std::size_t(1)));
+      const float aspectRatio = static_cast<float>(m_boundsPx.RawWidth()) / static_cast<float>(m_boundsPx.RawHeight());
+      const auto cellsY = static_cast<int32_t>(std::ceil(std::sqrt(desiredCellCount / aspectRatio)));
+      const auto cellsX = static_cast<int32_t>(std::ceil(desiredCellCount / static_cast<float>(std::max(cellsY, 1))));
+      m_cellCountX = MathHelper::Clamp(cellsX, 1, std::min(LocalConfig::MaxCellsPerAxis, m_boundsPx.RawWidth()));
+      m_cellCountY = MathHelper::Clamp(cellsY, 1, std::min(LocalConfig::MaxCellsPerAxis, m_boundsPx.RawHeight()));
+      m_cellWidthPx = (m_boundsPx.RawWidth() + m_cellCountX - 1) / m_cellCountX;
+      m_cellHeightPx = (m_boundsPx.RawHeight() + m_cellCountY - 1) / m_cellCountY;
+    }
+
+    const auto cellCount = UncheckedNumericCast<std::size_t>(m_cellCountX * m_cellCountY);
+    m_cellOffsets.resize(cellCount + 1u, 0u);
+
+    // Count the entries per cell
+    for (const auto& record : records)
+    {
+      const PxRectangle& rectPx = record.VisibleRectPx;
+      if (IsHitTestable(rectPx))
+      {
+        const int32_t cellX0 = ToCellX(rectPx.RawLeft());
+        const int32_t cellX1 = ToCellX(rectPx.RawRight() - 1);
+        const int32_t cellY0 = ToCellY(rectPx.RawTop());
+        const int32_t cellY1 = ToCellY(rectPx.RawBottom() - 1);
+        for (int32_t y = cellY0; y <= cellY1; ++y)
+        {
+          const int32_t rowOffset = y * m_cellCountX;
+          for (int32_t x = cellX0; x <= cellX1; ++x)
+          {
+            ++m_cellOffsets[rowOffset + x + 1];
+          }
+        }
+      }
+    }
+
+    // Convert the counts to offsets
+    for (std::size_t i = 1; i < m_cellOffsets.size(); ++i)
+    {
+      m_cellOffsets[i] += m_cellOffsets[i - 1];
+    }
+    m_entries.resize(m_cellOffsets.back());
+    m_scratchpad.assign(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+
+    // Fill the cells, since we process the records in order the entries of each cell ends up in ascending z-order
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+      const PxRectangle& rectPx = records[i].VisibleRectPx;
+      if (IsHitTestable(rectPx))
+      {
+        const int32_t cellX0 = ToCellX(rectPx.RawLeft());
+        const int32_t cellX1 = ToCellX(rectPx.RawRight() - 1);
+        const int32_t cellY0 = ToCellY(rectPx.RawTop());
+        const int32_t cellY1 = ToCellY(rectPx.RawBottom() - 1);
+        for (int32_t y = cellY0; y <= cellY1; ++y)
+        {
+          const int32_t rowOffset = y * m_cellCountX;
+          for (int32_t x = cellX0; x <= cellX1; ++x)
+          {
+            m_entries[m_scratchpad[rowOffset + x]++] = UncheckedNumericCast<uint32_t>(i);
+          }
+        }
+      }
+    }
+  }
+
+
+  void UITreeHitGrid::Clear() noexcept
+  {
+    m_boundsPx = {};
+    m_cellCountX = 0;
+    m_cellCountY = 0;
+    m_cellWidthPx = 1;
+    m_cellHeightPx = 1;
+    m_cellOffsets.clear();
+    m_entries.clear();
+  }
+
+
+  int32_t UITreeHitGrid::TryFindTopMost(const ReadOnlySpan<UITreeInputTargetRecord> records, const PxPoint2& positionPx) const noexcept
+  {
+    if (m_cellOffsets.empty() || !m_boundsPx.Contains(positionPx))
+    {
+      return -1;
+    }
+    const int32_t cellIndex = (ToCellY(positionPx.Y.Value) * m_cellCountX) + ToCellX(positionPx.X.Value);
+    const uint32_t startOffset = m_cellOffsets[cellIndex];
+    uint32_t offset = m_cellOffsets[cellIndex + 1];
+    while (offset > startOffset)
+    {
+      --offset;
+      const uint32_t recordIndex = m_entries[offset];
+      assert(recordIndex < records.size());
+      if (records[recordIndex].VisibleRectPx.Contains(positionPx))
+      {
+        return UncheckedNumericCast<int32_t>(recordIndex);
+      }
+    }
+    return -1;
+  }
+
+
+  int32_t UITreeHitGrid::ToCellX(const int32_t valuePx) const noexcept
+  {
+    return MathHelper::Clamp((valuePx - m_boundsPx.RawLeft()) / m_cellWidthPx, 0, m_cellCountX - 1);
+  }
+
+
+  int32_t UITreeHitGrid::ToCellY(const int32_t valuePx) const noexcept
+  {
+    return MathHelper::Clamp((valuePx - m_boundsPx.RawTop()) / m_cellHeightPx, 0, m_cellCountY - 1);
+  }
+}
@@ -37,9 +37,13 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
 #include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
 #include <array>
+#include <deque>
 #include <memory>
+#include <vector>
 
 using namespace Fsl;
 
@@ -88,6 +92,31 @@ namespace
     return CreateDataViewFromSpan(dataBinding, SpanUtil::AsReadOnlySpan(source));
   }
 
+  std::vector<uint32_t> CreateSortedCopy(const std::deque<uint32_t>& window, const std::size_t count)
+  {
+    std::vector<uint32_t> result(window.end() - static_cast<std::ptrdiff_t>(std::min(count, window.size())), window.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  void ExpectSortedEqual(const std::vector<uint32_t>& expected, const UI::ChartSortedDataChannelView& view)
+  {
+    const auto sortedSpan = view.GetChannelViewSpan();
+    ASSERT_EQ(expected.size(), sortedSpan.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_EQ(expected[i], sortedSpan[i]);
+      EXPECT_EQ(expected[i], view.GetSortedValues()[i]);
+    }
+    if (!expected.empty())
+    {
+      EXPECT_EQ(MinMax<uint32_t>(expected.front(), expected.back()), view.GetAxisRange());
+    }
+    if (expected.size() >= UI::BoxPlotHelper::MinimumEntries)
+    {
+      EXPECT_EQ(UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(expected)), view.GetBoxPlot());
+    }
+  }
 }
 
 
@@ -152,3 +181,81 @@ TEST(Test_Data_ChartSortedDataChannelView, ConstructFromUnsorted)
   EXPECT_EQ(4u, sortedSpan[3]);
   EXPECT_EQ(5u, sortedSpan[4]);
 }
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SlidingWindow)
+{
+  constexpr uint32_t Capacity = 64;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, Capacity, 1, UI::ChartData::Constraints());
+  UI::ChartSortedDataChannelView testSortedDataView(std::make_shared<UI::ChartDataView>(chartData), 0);
+
+  std::deque<uint32_t> appended;
+  uint32_t seed = 12345;
+  for (uint32_t i = 0; i < (Capacity * 5); ++i)
+  {
+    // Append a varying amount of entries between each query (including more than the capacity)
+    const uint32_t appendCount = i == 200 ? (Capacity + 7) : ((i % 3) + 1);
+    for (uint32_t j = 0; j < appendCount; ++j)
+    {
+      seed = (seed * 1103515245u) + 12345u;
+      const uint32_t value = (seed >> 16) % 100u;
+      chartData->Append(UI::ChartDataEntry(value));
+      appended.push_back(value);
+    }
+    ExpectSortedEqual(CreateSortedCopy(appended, Capacity), testSortedDataView);
+  }
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SlidingWindow_Clear)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 8, 1, UI::ChartData::Constraints());
+  UI::ChartSortedDataChannelView testSortedDataView(std::make_shared<UI::ChartDataView>(chartData), 0);
+
+  std::deque<uint32_t> appended;
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry(10 - i));
+    appended.push_back(10 - i);
+  }
+  ExpectSortedEqual(CreateSortedCopy(appended, 8), testSortedDataView);
+
+  chartData->Clear();
+  appended.clear();
+  EXPECT_TRUE(testSortedDataView.GetChannelViewSpan().empty());
+  EXPECT_TRUE(testSortedDataView.GetSortedValues().empty());
+
+  for (uint32_t i = 0; i < 6; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry(i * 3));
+    appended.push_back(i * 3);
+  }
+  ExpectSortedEqual(CreateSortedCopy(appended, 8), testSortedDataView);
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SlidingWindow_SetMaxViewEntries)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 16, 1, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  UI::ChartSortedDataChannelView testSortedDataView(dataView, 0);
+
+  std::deque<uint32_t> appended;
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry((i * 7) % 11));
+    appended.push_back((i * 7) % 11);
+  }
+  ExpectSortedEqual(CreateSortedCopy(appended, 16), testSortedDataView);
+
+  // Shrinking the view evicts the oldest entries
+  dataView->SetMaxViewEntries(6);
+  ExpectSortedEqual(CreateSortedCopy(appended, 6), testSortedDataView);
+
+  // Growing the view again makes older entries visible
+  dataView->SetMaxViewEntries(16);
+  ExpectSortedEqual(CreateSortedCopy(appended, 16), testSortedDataView);
+}
@@ -29,6 +29,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Collections/OrderStatisticTree.hpp>
 #include <FslBase/Span/SpanUtil_Array.hpp>
 #include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
 #include <FslUnitTest/TestFixture.hpp>
@@ -39,6 +40,18 @@ using namespace Fsl;
 namespace
 {
   using Test_Util_BoxPlotHelper = TestFixture;
+
+  template <std::size_t TSize>
+  OrderStatisticTree<uint32_t> CreateTree(const std::array<uint32_t, TSize>& values)
+  {
+    OrderStatisticTree<uint32_t> tree;
+    // Insert in a scrambled order to ensure the tree does the sorting
+    for (std::size_t i = 0; i < TSize; ++i)
+    {
+      tree.insert(values[(i * 5) % TSize]);
+    }
+    return tree;
+  }
 }
 
 TEST(Test_Util_BoxPlotHelper, Calculate_ToSmallSpan)
@@ -77,3 +90,40 @@ TEST(Test_Util_BoxPlotHelper, Calculate_Odd)
   EXPECT_EQ(140.0, result.Q3);
   EXPECT_EQ(150.0, result.Max);
 }
+
+
+TEST(Test_Util_BoxPlotHelper, Calculate_Tree_ToSmall)
+{
+  std::array<uint32_t, 4> sortedData = {1, 2, 3, 4};
+  EXPECT_THROW(UI::BoxPlotHelper::Calculate(CreateTree(sortedData)), NotSupportedException);
+}
+
+
+TEST(Test_Util_BoxPlotHelper, Calculate_Tree_Even)
+{
+  std::array<uint32_t, 12> sortedData = {100, 110, 110, 110, 120, 120, 130, 140, 140, 150, 170, 220};
+
+  auto result = UI::BoxPlotHelper::Calculate(CreateTree(sortedData));
+
+  EXPECT_EQ(UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(sortedData)), result);
+  EXPECT_EQ(100.0, result.Min);
+  EXPECT_EQ(110.0, result.Q1);
+  EXPECT_EQ(125.0, result.Q2);
+  EXPECT_EQ(145.0, result.Q3);
+  EXPECT_EQ(170.0, result.Max);
+}
+
+
+TEST(Test_Util_BoxPlotHelper, Calculate_Tree_Odd)
+{
+  std::array<uint32_t, 11> sortedData = {100, 110, 110, 110, 120, 120, 130, 140, 140, 150, 220};
+
+  auto result = UI::BoxPlotHelper::Calculate(CreateTree(sortedData));
+
+  EXPECT_EQ(UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(sortedData)), result);
+  EXPECT_EQ(100.0, result.Min);
+  EXPECT_EQ(110.0, result.Q1);
+  EXPECT_EQ(120.0, result.Q2);
+  EXPECT_EQ(140.0, result.Q3);
+  EXPECT_EQ(150.0, result.Max);
+}
@@ -52,6 +52,11 @@ namespace Fsl::UI
     ~AChartData() override = default;
 
     virtual uint32_t ChangeId() const noexcept = 0;
+    //! The total number of entries that has been appended since the content generation last changed.
+    //! Since the data is a sliding window the entries in a view are always the last 'Count' appended entries.
+    virtual uint64_t AppendCount() const noexcept = 0;
+    //! Changes every time the content is modified in a way that can not be described as a append (like a clear)
+    virtual uint32_t ContentGeneration() const noexcept = 0;
     virtual uint32_t ChannelCount() const noexcept = 0;
     //! Create a view that is a 1:1 mapping of the data
     virtual ChartDataViewConfig CreateViewConfig() = 0;
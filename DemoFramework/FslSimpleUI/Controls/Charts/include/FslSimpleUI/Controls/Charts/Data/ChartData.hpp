@@ -91,6 +91,8 @@ namespace Fsl::UI
     CircularFixedSizeBuffer<ChartDataEntry> m_buffer;
     uint32_t m_dataChannelCount;
     uint32_t m_changeId{0};
+    uint64_t m_appendCount{0};
+    uint32_t m_contentGeneration{0};
 
     Constraints m_constraints;
 
@@ -143,6 +145,16 @@ namespace Fsl::UI
       return m_changeId;
     }
 
+    uint64_t AppendCount() const noexcept final
+    {
+      return m_appendCount;
+    }
+
+    uint32_t ContentGeneration() const noexcept final
+    {
+      return m_contentGeneration;
+    }
+
     ChartDataViewConfig CreateViewConfig() final;
     ChartDataViewConfig CreateViewConfig(const uint32_t maxEntries, const bool allowCapacityToGrow) final;
     ChartDataStats CalculateDataStats(const ChartDataViewConfig viewConfig) const final;
@@ -91,6 +91,10 @@ namespace Fsl::UI
     ~ChartDataView() override;
 
     uint64_t ChangeId() const noexcept;
+    //! The total number of entries appended to the underlying data since its content generation last changed
+    uint64_t AppendCount() const noexcept;
+    //! The content generation of the underlying data (changes when the data is modified by something other than a append)
+    uint32_t ContentGeneration() const noexcept;
 
     void ClearCustomMinMax();
     void SetCustomMinMax(MinMax<value_type> customViewMinMax);
@@ -32,8 +32,11 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/BasicTypes.hpp>
+#include <FslBase/Collections/OrderStatisticTree.hpp>
 #include <FslBase/Math/MinMax.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/BoxPlotData.hpp>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -42,6 +45,9 @@ namespace Fsl::UI
   class ChartDataView;
 
   /// <summary>
+  /// A sorted view of one channel in a ChartDataView.
+  /// The sorted values are maintained incrementally as a sliding window: appended entries are inserted and the entries that fell out of the
+  /// view are evicted, both in O(log n). So the cost of a update is proportional to the number of changed entries and not the window size.
   /// </summary>
   class ChartSortedDataChannelView final
   {
@@ -49,7 +55,16 @@ namespace Fsl::UI
     uint32_t m_dataChannelIndex;
 
     mutable uint64_t m_cachedViewChangeId{0};
+    mutable uint32_t m_cachedContentGeneration{0};
+    mutable uint64_t m_cachedAppendCount{0};
     mutable MinMax<uint32_t> m_cachedAxisRange;
+    //! The values currently in the window in arrival order (oldest first)
+    mutable std::deque<uint32_t> m_cachedWindow;
+    mutable OrderStatisticTree<uint32_t> m_cachedSortedValues;
+    mutable bool m_cachedBoxPlotIsValid{false};
+    mutable BoxPlotData m_cachedBoxPlot;
+    //! Lazily materialized copy of m_cachedSortedValues (only used by GetChannelViewSpan)
+    mutable bool m_cachedSortedDataIsValid{false};
     mutable std::vector<uint32_t> m_cachedSortedData;
 
   public:
@@ -72,10 +87,22 @@ namespace Fsl::UI
     }
 
     MinMax<uint32_t> GetAxisRange() const;
+
+    //! Get the sorted values of the view (low to high).
+    //! @note Prefer GetSortedValues or GetBoxPlot as this needs to materialize a sorted copy of the data once per change.
     ReadOnlySpan<uint32_t> GetChannelViewSpan() const;
 
+    //! Get the sorted values of the view as a order statistic tree (low to high)
+    const OrderStatisticTree<uint32_t>& GetSortedValues() const;
+
+    //! Get the box plot of the current view (cached until the view changes).
+    //! @throws NotSupportedException if the view contains less than BoxPlotHelper::MinimumEntries
+    BoxPlotData GetBoxPlot() const;
+
   private:
     void RefreshCacheIfNecessary() const;
+    void RebuildCache(const ChartDataView& dataView, const uint32_t count) const;
+    void InsertLatestEntries(const ChartDataView& dataView, const uint32_t newEntries) const;
   };
 }
 
@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/BasicTypes.hpp>
+#include <FslBase/Collections/OrderStatisticTree.hpp>
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/BoxPlotData.hpp>
@@ -124,6 +125,51 @@ namespace Fsl::UI::BoxPlotHelper
     return {static_cast<float>(span.front()), static_cast<float>(min), static_cast<float>(q1),         static_cast<float>(q2),
             static_cast<float>(q3),           static_cast<float>(max), static_cast<float>(span.back())};
   }
+
+  //! @brief Calculate the median of the range [offset, offset + count[ in a order statistic tree.
+  template <typename T>
+  inline double CalculateMedian(const OrderStatisticTree<T>& tree, const std::size_t offset, const std::size_t count)
+  {
+    assert(count >= 2);
+    assert(offset <= tree.size() && count <= (tree.size() - offset));
+    const auto halfSize = count / 2;
+    //                          even                                                                  : odd
+    return ((count & 1) == 0) ? (static_cast<double>((tree[offset + halfSize - 1] + tree[offset + halfSize])) / 2.0)
+                              : static_cast<double>(tree[offset + halfSize]);
+  }
+
+  //! @brief Calculate the box plot data from a order statistic tree.
+  //!        This produces the exact same result as the span version but each lookup is O(log n) so no sorted copy of the data is necessary.
+  template <typename T>
+  inline BoxPlotData Calculate(const OrderStatisticTree<T>& tree)
+  {
+    const auto size = tree.size();
+    if (size < MinimumEntries)
+    {
+      throw NotSupportedException("we expect at least five entries");
+    }
+
+    const auto q2 = CalculateMedian(tree, 0, size);
+    const auto halfSize = size / 2;
+    const double q1 = CalculateMedian(tree, 0, halfSize);
+    const double q3 = CalculateMedian(tree, size - halfSize, halfSize);
+
+    assert(q1 <= q3);
+    const double iqr = q3 - q1;
+    const double lowerLimit = q1 - (1.5 * iqr);
+    const double upperLimit = q3 + (1.5 * iqr);
+
+    // The first element that is greater or equal to the lower limit
+    const auto minIndex = tree.lower_bound_index(lowerLimit);
+    // The last element that is less or equal to the upper limit
+    const auto maxEndIndex = tree.upper_bound_index(upperLimit);
+    assert(minIndex < size);
+    assert(maxEndIndex > 0);
+    const double min = tree[minIndex];
+    const double max = tree[maxEndIndex - 1];
+    return {static_cast<float>(tree.front()), static_cast<float>(min), static_cast<float>(q1),          static_cast<float>(q2),
+            static_cast<float>(q3),           static_cast<float>(max), static_cast<float>(tree.back())};
+  }
 }
 
 #endif
@@ -75,6 +75,8 @@ namespace Fsl::UI
   void ChartData::Clear()
   {
     m_buffer.clear();
+    m_appendCount = 0;
+    ++m_contentGeneration;
     MarkAsChanged();
     m_cachedDataStats = {};
     m_viewInfo.Clear();
@@ -107,6 +109,7 @@ namespace Fsl::UI
     }
 
     m_buffer.push_back(value);
+    ++m_appendCount;
     MarkAsChanged();
 
     UpdateCachedValues(MinMax<value_type>(std::min(m_viewInfo.CurrentMin, currentValue), std::max(m_viewInfo.CurrentMax, currentValue)));
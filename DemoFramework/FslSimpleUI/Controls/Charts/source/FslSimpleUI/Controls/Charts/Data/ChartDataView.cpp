@@ -86,6 +86,16 @@ namespace Fsl::UI
     return (dataChangeId | (viewChangeId << 32));
   }
 
+  uint64_t ChartDataView::AppendCount() const noexcept
+  {
+    return m_chartData->AppendCount();
+  }
+
+  uint32_t ChartDataView::ContentGeneration() const noexcept
+  {
+    return m_chartData->ContentGeneration();
+  }
+
   void ChartDataView::ClearCustomMinMax()
   {
     if (m_customViewMinMax.has_value())
@@ -33,8 +33,8 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataEntry.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
-#include <algorithm>
-#include <limits>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
+#include <cassert>
 #include <utility>
 
 namespace Fsl::UI
@@ -48,13 +48,28 @@ namespace Fsl::UI
       m_dataView = std::move(other.m_dataView);
       m_dataChannelIndex = other.m_dataChannelIndex;
       m_cachedViewChangeId = other.m_cachedViewChangeId;
+      m_cachedContentGeneration = other.m_cachedContentGeneration;
+      m_cachedAppendCount = other.m_cachedAppendCount;
       m_cachedAxisRange = other.m_cachedAxisRange;
+      m_cachedWindow = std::move(other.m_cachedWindow);
+      m_cachedSortedValues = std::move(other.m_cachedSortedValues);
+      m_cachedBoxPlotIsValid = other.m_cachedBoxPlotIsValid;
+      m_cachedBoxPlot = other.m_cachedBoxPlot;
+      m_cachedSortedDataIsValid = other.m_cachedSortedDataIsValid;
       m_cachedSortedData = std::move(other.m_cachedSortedData);
 
       // Remove the data from other
       other.m_dataChannelIndex = 0;
       other.m_cachedViewChangeId = 0;
+      other.m_cachedContentGeneration = 0;
+      other.m_cachedAppendCount = 0;
       other.m_cachedAxisRange = {};
+      other.m_cachedWindow.clear();
+      other.m_cachedSortedValues.clear();
+      other.m_cachedBoxPlotIsValid = false;
+      other.m_cachedBoxPlot = {};
+      other.m_cachedSortedDataIsValid = false;
+      other.m_cachedSortedData.clear();
     }
     return *this;
   }
@@ -64,13 +79,28 @@ namespace Fsl::UI
     : m_dataView(std::move(other.m_dataView))
     , m_dataChannelIndex(other.m_dataChannelIndex)
     , m_cachedViewChangeId(other.m_cachedViewChangeId)
+    , m_cachedContentGeneration(other.m_cachedContentGeneration)
+    , m_cachedAppendCount(other.m_cachedAppendCount)
     , m_cachedAxisRange(other.m_cachedAxisRange)
+    , m_cachedWindow(std::move(other.m_cachedWindow))
+    , m_cachedSortedValues(std::move(other.m_cachedSortedValues))
+    , m_cachedBoxPlotIsValid(other.m_cachedBoxPlotIsValid)
+    , m_cachedBoxPlot(other.m_cachedBoxPlot)
+    , m_cachedSortedDataIsValid(other.m_cachedSortedDataIsValid)
     , m_cachedSortedData(std::move(other.m_cachedSortedData))
   {
     // Remove the data from other
     other.m_dataChannelIndex = 0;
     other.m_cachedViewChangeId = 0;
+    other.m_cachedContentGeneration = 0;
+    other.m_cachedAppendCount = 0;
     other.m_cachedAxisRange = {};
+    other.m_cachedWindow.clear();
+    other.m_cachedSortedValues.clear();
+    other.m_cachedBoxPlotIsValid = false;
+    other.m_cachedBoxPlot = {};
+    other.m_cachedSortedDataIsValid = false;
+    other.m_cachedSortedData.clear();
   }
 
 
@@ -87,8 +117,9 @@ namespace Fsl::UI
       throw std::invalid_argument("invalid data channel index");
     }
 
-    // Ensure that we dont have a valid change id
+    // Ensure that we dont have a valid change id or content generation
     m_cachedViewChangeId = m_dataView->ChangeId() - 1;
+    m_cachedContentGeneration = m_dataView->ContentGeneration() - 1;
   }
 
   ChartSortedDataChannelView::~ChartSortedDataChannelView() = default;
@@ -97,10 +128,36 @@ namespace Fsl::UI
   ReadOnlySpan<uint32_t> ChartSortedDataChannelView::GetChannelViewSpan() const
   {
     RefreshCacheIfNecessary();
+    if (!m_cachedSortedDataIsValid)
+    {
+      m_cachedSortedDataIsValid = true;
+      m_cachedSortedData.clear();
+      m_cachedSortedData.reserve(m_cachedSortedValues.size());
+      m_cachedSortedValues.for_each([this](const uint32_t value) { m_cachedSortedData.push_back(value); });
+    }
     return SpanUtil::AsReadOnlySpan(m_cachedSortedData);
   }
 
 
+  const OrderStatisticTree<uint32_t>& ChartSortedDataChannelView::GetSortedValues() const
+  {
+    RefreshCacheIfNecessary();
+    return m_cachedSortedValues;
+  }
+
+
+  BoxPlotData ChartSortedDataChannelView::GetBoxPlot() const
+  {
+    RefreshCacheIfNecessary();
+    if (!m_cachedBoxPlotIsValid)
+    {
+      m_cachedBoxPlot = BoxPlotHelper::Calculate(m_cachedSortedValues);
+      m_cachedBoxPlotIsValid = true;
+    }
+    return m_cachedBoxPlot;
+  }
+
+
   MinMax<uint32_t> ChartSortedDataChannelView::GetAxisRange() const
   {
     RefreshCacheIfNecessary();
@@ -112,39 +169,84 @@ namespace Fsl::UI
   {
     const ChartDataView* pDataView = m_dataView.get();
     assert(pDataView != nullptr);
-    auto currentViewChangeId = m_dataView->ChangeId();
+    auto currentViewChangeId = pDataView->ChangeId();
     if (currentViewChangeId != m_cachedViewChangeId)
     {
-      // Resort the view data
       m_cachedViewChangeId = currentViewChangeId;
-
-      const auto dataInfo = pDataView->DataInfo();
-
-      m_cachedSortedData.clear();
-      m_cachedSortedData.reserve(dataInfo.TotalElementCount);
-      if (dataInfo.SegmentCount > 0)
+      m_cachedBoxPlotIsValid = false;
+      m_cachedSortedDataIsValid = false;
+
+      const uint32_t count = pDataView->Count();
+      const uint32_t contentGeneration = pDataView->ContentGeneration();
+      const uint64_t appendCount = pDataView->AppendCount();
+
+      // The view always contains the last 'count' appended entries, so as long as the content generation is unchanged the new window
+      // can be produced from the old one by evicting the oldest entries and inserting the newly appended ones.
+      const bool canUpdate = contentGeneration == m_cachedContentGeneration && appendCount >= m_cachedAppendCount &&
+                             (appendCount - m_cachedAppendCount) <= count && (m_cachedWindow.size() + (appendCount - m_cachedAppendCount)) >= count;
+      if (canUpdate)
       {
-        auto min = std::numeric_limits<uint32_t>::max();
-        auto max = std::numeric_limits<uint32_t>::min();
-        // Insert all the elements from the view into our cached sorted list (low to high)
-        for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+        const auto newEntries = static_cast<uint32_t>(appendCount - m_cachedAppendCount);
+        const std::size_t keepCount = count - newEntries;
+        while (m_cachedWindow.size() > keepCount)
         {
-          const auto span = pDataView->SegmentDataAsReadOnlySpan(segmentIndex);
-          for (uint32_t spanIndex = 0; spanIndex < span.size(); ++spanIndex)
-          {
-            const auto newValue = span[spanIndex].Values[m_dataChannelIndex];
-            m_cachedSortedData.insert(std::lower_bound(m_cachedSortedData.begin(), m_cachedSortedData.end(), newValue), newValue);
-            min = min <= newValue ? min : newValue;
-            max = max >= newValue ? max : newValue;
-          }
+          [[maybe_unused]] const bool removed = m_cachedSortedValues.erase(m_cachedWindow.front());
+          assert(removed);
+          m_cachedWindow.pop_front();
         }
-        assert(min <= max);
-        m_cachedAxisRange = MinMax<uint32_t>(min, max);
+        InsertLatestEntries(*pDataView, newEntries);
       }
       else
       {
-        m_cachedAxisRange = {};
+        RebuildCache(*pDataView, count);
+      }
+      assert(m_cachedWindow.size() == count);
+      assert(m_cachedSortedValues.size() == count);
+
+      m_cachedContentGeneration = contentGeneration;
+      m_cachedAppendCount = appendCount;
+      m_cachedAxisRange = !m_cachedSortedValues.empty() ? MinMax<uint32_t>(m_cachedSortedValues.front(), m_cachedSortedValues.back())
+                                                        : MinMax<uint32_t>();
+    }
+  }
+
+
+  void ChartSortedDataChannelView::RebuildCache(const ChartDataView& dataView, const uint32_t count) const
+  {
+    m_cachedWindow.clear();
+    m_cachedSortedValues.clear();
+    m_cachedSortedValues.reserve(count);
+    InsertLatestEntries(dataView, count);
+  }
+
+
+  void ChartSortedDataChannelView::InsertLatestEntries(const ChartDataView& dataView, const uint32_t newEntries) const
+  {
+    if (newEntries <= 0u)
+    {
+      return;
+    }
+    const auto dataInfo = dataView.DataInfo();
+    assert(newEntries <= dataInfo.TotalElementCount);
+
+    // Skip the entries that are already in the window
+    uint32_t skipCount = dataInfo.TotalElementCount - newEntries;
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      const auto span = dataView.SegmentDataAsReadOnlySpan(segmentIndex);
+      const auto spanSize = static_cast<uint32_t>(span.size());
+      if (skipCount >= spanSize)
+      {
+        skipCount -= spanSize;
+        continue;
+      }
+      for (uint32_t spanIndex = skipCount; spanIndex < spanSize; ++spanIndex)
+      {
+        const auto newValue = span[spanIndex].Values[m_dataChannelIndex];
+        m_cachedWindow.push_back(newValue);
+        m_cachedSortedValues.insert(newValue);
       }
+      skipCount = 0;
     }
   }
 
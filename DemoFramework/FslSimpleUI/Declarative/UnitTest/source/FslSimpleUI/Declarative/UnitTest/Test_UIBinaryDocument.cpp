@@ -0,0 +1,280 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocument.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocumentWriter.hpp>
+#include <fmt/format.h>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  using Test_UIBinaryDocument = TestFixtureFslBase;
+
+  std::vector<uint8_t> CreateSimpleDocument()
+  {
+    UIBinaryDocumentWriter writer;
+    const uint32_t classLabel = writer.AddClass("Label");
+    const uint32_t propertyContent = writer.AddClassProperty(classLabel, "Content");
+    writer.BeginNode(classLabel);
+    writer.AddProperty(propertyContent, UIBinaryValue::CreateString(writer.AddString("Hello")));
+    writer.EndNode();
+    return writer.ToBytes();
+  }
+
+  void WriteWord(std::vector<uint8_t>& rContent, const std::size_t wordIndex, const uint32_t value)
+  {
+    const std::size_t offset = wordIndex * 4u;
+    rContent[offset + 0] = static_cast<uint8_t>(value & 0xFF);
+    rContent[offset + 1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+    rContent[offset + 2] = static_cast<uint8_t>((value >> 16) & 0xFF);
+    rContent[offset + 3] = static_cast<uint8_t>((value >> 24) & 0xFF);
+  }
+}
+
+
+TEST(Test_UIBinaryDocument, RoundTrip_Simple)
+{
+  const std::vector<uint8_t> content = CreateSimpleDocument();
+  const UIBinaryDocument document(SpanUtil::AsReadOnlySpan(content));
+
+  ASSERT_EQ(1u, document.ClassCount());
+  EXPECT_EQ(StringViewLite("Label"), document.GetControlName(0));
+  ASSERT_EQ(1u, document.GetClassPropertyCount(0));
+  EXPECT_EQ(StringViewLite("Content"), document.GetClassPropertyName(0, 0));
+
+  ASSERT_EQ(1u, document.NodeCount());
+  const UIBinaryNodeRecord& node = document.GetNode(0);
+  EXPECT_EQ(0u, node.ClassIndex);
+  EXPECT_EQ(0u, node.ChildCount);
+  EXPECT_EQ(1u, node.SubtreeEnd);
+  EXPECT_FALSE(node.GridColumn.has_value());
+  EXPECT_FALSE(node.GridRow.has_value());
+
+  const auto properties = document.GetProperties(node);
+  ASSERT_EQ(1u, properties.size());
+  EXPECT_EQ(0u, properties[0].PropertyId);
+  ASSERT_EQ(UIBinaryValueType::String, properties[0].Value.Type());
+  EXPECT_EQ(StringViewLite("Hello"), document.GetString(properties[0].Value.AsStringIndex()));
+}
+
+
+TEST(Test_UIBinaryDocument, RoundTrip_Tree)
+{
+  UIBinaryDocumentWriter writer;
+  const uint32_t classGrid = writer.AddClass("GridLayout");
+  const uint32_t classLabel = writer.AddClass("Label");
+  const uint32_t classSlider = writer.AddClass("SliderFloat");
+  const uint32_t propertyContent = writer.AddClassProperty(classLabel, "Content");
+  const uint32_t propertyValue = writer.AddClassProperty(classSlider, "Value");
+  EXPECT_EQ(propertyContent, writer.AddClassProperty(classLabel, "Content"));
+
+  writer.BeginNode(classGrid);
+  writer.AddColumnDefinition(UI::GridColumnDefinition(UI::GridUnitType::Fixed, 100.0f));
+  writer.AddColumnDefinition(UI::GridColumnDefinition(UI::GridUnitType::Star, 1.0f));
+  writer.AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
+  {
+    const uint32_t sliderNode = writer.BeginNode(classSlider);
+    writer.AddThemeProperty("BarColor", "#FF00FF00");
+    writer.AddProperty(propertyValue, UIBinaryValue::CreateDpSize1DF(DpSize1DF::Create(0.5f)));
+    writer.SetGridColumn(1);
+    writer.EndNode();
+
+    writer.BeginNode(classLabel);
+    writer.AddProperty(propertyContent, UIBinaryValue::CreateBinding(sliderNode, propertyValue));
+    writer.SetGridColumn(0);
+    writer.SetGridRow(0);
+    writer.EndNode();
+  }
+  writer.EndNode();
+
+  const std::vector<uint8_t> content = writer.ToBytes();
+  const UIBinaryDocument document(SpanUtil::AsReadOnlySpan(content));
+
+  ASSERT_EQ(3u, document.ClassCount());
+  ASSERT_EQ(3u, document.NodeCount());
+
+  const UIBinaryNodeRecord& root = document.GetNode(0);
+  EXPECT_EQ(classGrid, root.ClassIndex);
+  EXPECT_EQ(2u, root.ChildCount);
+  EXPECT_EQ(3u, root.SubtreeEnd);
+  const auto columns = document.GetColumnDefinitions(root);
+  ASSERT_EQ(2u, columns.size());
+  EXPECT_EQ(UI::GridColumnDefinition(UI::GridUnitType::Fixed, 100.0f), columns[0]);
+  EXPECT_EQ(UI::GridColumnDefinition(UI::GridUnitType::Star, 1.0f), columns[1]);
+  const auto rows = document.GetRowDefinitions(root);
+  ASSERT_EQ(1u, rows.size());
+  EXPECT_EQ(UI::GridRowDefinition(UI::GridUnitType::Auto), rows[0]);
+
+  const UIBinaryNodeRecord& slider = document.GetNode(1);
+  EXPECT_EQ(classSlider, slider.ClassIndex);
+  EXPECT_EQ(2u, slider.SubtreeEnd);
+  EXPECT_EQ(std::optional<uint32_t>(1u), slider.GridColumn);
+  EXPECT_FALSE(slider.GridRow.has_value());
+  const auto themeProperties = document.GetThemeProperties(slider);
+  ASSERT_EQ(1u, themeProperties.size());
+  EXPECT_EQ(StringViewLite("BarColor"), themeProperties[0].Name);
+  EXPECT_EQ(StringViewLite("#FF00FF00"), themeProperties[0].Value);
+  const auto sliderProperties = document.GetProperties(slider);
+  ASSERT_EQ(1u, sliderProperties.size());
+  EXPECT_EQ(DpSize1DF::Create(0.5f), sliderProperties[0].Value.AsDpSize1DF());
+
+  const UIBinaryNodeRecord& label = document.GetNode(2);
+  EXPECT_EQ(classLabel, label.ClassIndex);
+  EXPECT_EQ(3u, label.SubtreeEnd);
+  EXPECT_EQ(std::optional<uint32_t>(0u), label.GridColumn);
+  EXPECT_EQ(std::optional<uint32_t>(0u), label.GridRow);
+  const auto labelProperties = document.GetProperties(label);
+  ASSERT_EQ(1u, labelProperties.size());
+  ASSERT_EQ(UIBinaryValueType::Binding, labelProperties[0].Value.Type());
+  EXPECT_EQ(1u, labelProperties[0].Value.BindingNodeIndex());
+  EXPECT_EQ(propertyValue, labelProperties[0].Value.BindingPropertyId());
+}
+
+
+TEST(Test_UIBinaryDocument, RoundTrip_Values)
+{
+  const std::vector<UIBinaryValue> values = {
+    UIBinaryValue::CreateBool(true),
+    UIBinaryValue::CreateUInt8(200),
+    UIBinaryValue::CreateInt32(-42),
+    UIBinaryValue::CreateUInt32(0xFFFFFFFFu),
+    UIBinaryValue::CreateDpSize1D(DpSize1D::Create(-7)),
+    UIBinaryValue::CreateDpSize1DF(DpSize1DF::Create(1.25f)),
+    UIBinaryValue::CreateDpThicknessF(DpThicknessF::Create(1.0f, 2.0f, 3.0f, 4.0f)),
+    UIBinaryValue::CreateDpLayoutSize1D(UI::DpLayoutSize1D::Create(32.0f)),
+    UIBinaryValue::CreateItemAlignment(UI::ItemAlignment::Far),
+    UIBinaryValue::CreateLayoutOrientation(UI::LayoutOrientation::Horizontal),
+    UIBinaryValue::CreateScrollModeFlags(UI::ScrollModeFlags::TranslateX),
+    UIBinaryValue::CreateTransitionType(TransitionType::Smooth),
+  };
+
+  UIBinaryDocumentWriter writer;
+  const uint32_t classIndex = writer.AddClass("Control");
+  writer.BeginNode(classIndex);
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    const std::string propertyName = fmt::format("P{}", i);
+    const uint32_t propertyId = writer.AddClassProperty(classIndex, StringViewLite(propertyName));
+    writer.AddProperty(propertyId, values[i]);
+  }
+  writer.EndNode();
+
+  const std::vector<uint8_t> content = writer.ToBytes();
+  const UIBinaryDocument document(SpanUtil::AsReadOnlySpan(content));
+  const auto properties = document.GetProperties(document.GetNode(0));
+  ASSERT_EQ(values.size(), properties.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(i, properties[i].PropertyId);
+    EXPECT_EQ(values[i], properties[i].Value);
+  }
+  EXPECT_EQ(DpThicknessF::Create(1.0f, 2.0f, 3.0f, 4.0f), properties[6].Value.AsDpThicknessF());
+  EXPECT_EQ(-42, properties[2].Value.AsInt32());
+}
+
+
+TEST(Test_UIBinaryDocument, Value_TypeMismatch)
+{
+  EXPECT_THROW(UIBinaryValue::CreateBool(true).AsUInt32(), UsageErrorException);
+  EXPECT_THROW(UIBinaryValue::CreateUInt32(1).BindingNodeIndex(), UsageErrorException);
+}
+
+
+TEST(Test_UIBinaryDocument, Invalid_Empty)
+{
+  const std::vector<uint8_t> content;
+  EXPECT_THROW(UIBinaryDocument(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UIBinaryDocument, Invalid_Magic)
+{
+  std::vector<uint8_t> content = CreateSimpleDocument();
+  WriteWord(content, 0, 0x12345678);
+  EXPECT_THROW(UIBinaryDocument(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UIBinaryDocument, Invalid_Version)
+{
+  std::vector<uint8_t> content = CreateSimpleDocument();
+  WriteWord(content, 1, 0xFFFF);
+  EXPECT_THROW(UIBinaryDocument(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UIBinaryDocument, Invalid_Truncated)
+{
+  const std::vector<uint8_t> content = CreateSimpleDocument();
+  for (std::size_t length = 0; length < content.size(); length += 4)
+  {
+    const std::vector<uint8_t> truncated(content.begin(), content.begin() + static_cast<std::ptrdiff_t>(length));
+    EXPECT_THROW(UIBinaryDocument(SpanUtil::AsReadOnlySpan(truncated)), FormatException);
+  }
+}
+
+
+TEST(Test_UIBinaryDocument, Invalid_TrailingData)
+{
+  std::vector<uint8_t> content = CreateSimpleDocument();
+  content.resize(content.size() + 4u);
+  EXPECT_THROW(UIBinaryDocument(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UIBinaryDocument, Writer_UsageErrors)
+{
+  UIBinaryDocumentWriter writer;
+  EXPECT_THROW(writer.ToBytes(), UsageErrorException);
+  EXPECT_THROW(writer.BeginNode(0), std::invalid_argument);
+  EXPECT_THROW(writer.EndNode(), UsageErrorException);
+
+  const uint32_t classIndex = writer.AddClass("Label");
+  writer.BeginNode(classIndex);
+  // Unknown property id
+  EXPECT_THROW(writer.AddProperty(0, UIBinaryValue::CreateBool(true)), std::invalid_argument);
+  // Binding to a node that does not exist yet
+  const uint32_t propertyId = writer.AddClassProperty(classIndex, "Content");
+  EXPECT_THROW(writer.AddProperty(propertyId, UIBinaryValue::CreateBinding(1, propertyId)), std::invalid_argument);
+  // Still open
+  EXPECT_THROW(writer.ToBytes(), UsageErrorException);
+  writer.EndNode();
+  // Only one root node is allowed
+  EXPECT_THROW(writer.BeginNode(classIndex), UsageErrorException);
+  EXPECT_NO_THROW(writer.ToBytes());
+}
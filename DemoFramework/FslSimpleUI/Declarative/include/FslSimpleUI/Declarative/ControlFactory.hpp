@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Span/Span.hpp>
 #include <FslSimpleUI/Declarative/ADeclarativeControlFactory.hpp>
 #include <FslSimpleUI/Declarative/ControlType.hpp>
 #include <FslSimpleUI/Declarative/PrimitiveTypeRegistry.hpp>
@@ -41,6 +42,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -64,6 +66,8 @@ namespace Fsl::UI::Declarative
     PrimitiveTypeRegistry m_primitiveTypeRegistry;
     std::shared_ptr<Theme::IThemeControlFactory> m_controlFactory;
     std::map<ControlName, std::unique_ptr<ADeclarativeControlFactory>, std::less<>> m_factories;
+    //! The factories in registration order, indexed by control id
+    std::vector<ADeclarativeControlFactory*> m_factoryById;
 
     std::vector<RegisteredPropertyRecord> m_registeredPropertyScratchpad;
     std::vector<PropertyParserRecord> m_createPropertiesScratchpad;
@@ -88,6 +92,14 @@ namespace Fsl::UI::Declarative
     std::shared_ptr<BaseWindow> TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
                                           std::vector<PropertyRecord>& rPropertyRecords);
 
+    //! @brief Lookup the id of a registered control, the id is only valid for this control factory instance.
+    std::optional<uint32_t> TryGetControlId(const std::string_view name) const;
+
+    //! @brief Create a control from a id returned by TryGetControlId.
+    //! @param themeProperties the theme properties, any property used by the control factory will be marked as claimed.
+    std::shared_ptr<BaseWindow> TryCreate(RadioGroupManager& rRadioGroupManager, const uint32_t controlId,
+                                          Span<PropertyParserRecord> themeProperties);
+
     std::vector<ControlName> GetControlNames() const;
     std::span<const ControlPropertyRecord> GetControlThemeProperties(const ControlName& name) const;
     DataBinding::DependencyPropertyDefinitionVector GetControlProperties(const ControlName& name);
@@ -95,6 +107,8 @@ namespace Fsl::UI::Declarative
     ControlType GetControlType(const ControlName& name);
 
   private:
+    std::shared_ptr<BaseWindow> DoCreate(ADeclarativeControlFactory& rFactory, RadioGroupManager& rRadioGroupManager,
+                                         Span<PropertyParserRecord> properties);
     std::shared_ptr<BaseWindow> TryCreateDummyControl(const std::string_view name);
   };
 }
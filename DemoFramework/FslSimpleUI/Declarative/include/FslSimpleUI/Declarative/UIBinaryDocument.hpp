@@ -0,0 +1,159 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYDOCUMENT_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYDOCUMENT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslSimpleUI/Base/Layout/GridRowColumnDefinition.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryValue.hpp>
+#include <optional>
+#include <vector>
+
+namespace Fsl::UI::Declarative
+{
+  struct UIBinaryThemePropertyRecord
+  {
+    StringViewLite Name;
+    StringViewLite Value;
+
+    constexpr UIBinaryThemePropertyRecord() noexcept = default;
+    constexpr UIBinaryThemePropertyRecord(const StringViewLite name, const StringViewLite value) noexcept
+      : Name(name)
+      , Value(value)
+    {
+    }
+  };
+
+  struct UIBinaryPropertyRecord
+  {
+    //! The id of the property (relative to the class of the node)
+    uint32_t PropertyId{0};
+    UIBinaryValue Value;
+
+    constexpr UIBinaryPropertyRecord() noexcept = default;
+    constexpr UIBinaryPropertyRecord(const uint32_t propertyId, const UIBinaryValue& value) noexcept
+      : PropertyId(propertyId)
+      , Value(value)
+    {
+    }
+  };
+
+  struct UIBinaryNodeRecord
+  {
+    uint32_t ClassIndex{0};
+    uint32_t ChildCount{0};
+    //! The index one past the last node in the subtree that starts at this node
+    uint32_t SubtreeEnd{0};
+    std::optional<uint32_t> GridColumn;
+    std::optional<uint32_t> GridRow;
+
+    uint32_t ThemePropertyOffset{0};
+    uint32_t ThemePropertyCount{0};
+    uint32_t PropertyOffset{0};
+    uint32_t PropertyCount{0};
+    uint32_t ColumnDefinitionOffset{0};
+    uint32_t ColumnDefinitionCount{0};
+    uint32_t RowDefinitionOffset{0};
+    uint32_t RowDefinitionCount{0};
+  };
+
+  //! @brief A validated read only view of a binary declarative UI document (see UICompiler).
+  //! @note  String views returned by this object point directly into the content span, so the content must outlive this object.
+  class UIBinaryDocument
+  {
+    struct ClassRecord
+    {
+      uint32_t NameStringIndex{0};
+      uint32_t PropertyOffset{0};
+      uint32_t PropertyCount{0};
+    };
+
+    std::vector<StringViewLite> m_strings;
+    std::vector<ClassRecord> m_classes;
+    std::vector<uint32_t> m_classPropertyNames;
+    std::vector<UIBinaryNodeRecord> m_nodes;
+    std::vector<UIBinaryThemePropertyRecord> m_themeProperties;
+    std::vector<UIBinaryPropertyRecord> m_properties;
+    std::vector<GridColumnDefinition> m_columnDefinitions;
+    std::vector<GridRowDefinition> m_rowDefinitions;
+
+  public:
+    //! @brief Decode and validate the content
+    //! @throws FormatException if the content is not a valid document
+    explicit UIBinaryDocument(const ReadOnlySpan<uint8_t> content);
+
+    uint32_t StringCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_strings.size());
+    }
+
+    StringViewLite GetString(const uint32_t index) const
+    {
+      return m_strings.at(index);
+    }
+
+    uint32_t ClassCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_classes.size());
+    }
+
+    StringViewLite GetControlName(const uint32_t classIndex) const
+    {
+      return m_strings[m_classes.at(classIndex).NameStringIndex];
+    }
+
+    uint32_t GetClassPropertyCount(const uint32_t classIndex) const
+    {
+      return m_classes.at(classIndex).PropertyCount;
+    }
+
+    StringViewLite GetClassPropertyName(const uint32_t classIndex, const uint32_t propertyId) const;
+
+    uint32_t NodeCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_nodes.size());
+    }
+
+    const UIBinaryNodeRecord& GetNode(const uint32_t nodeIndex) const
+    {
+      return m_nodes.at(nodeIndex);
+    }
+
+    ReadOnlySpan<UIBinaryThemePropertyRecord> GetThemeProperties(const UIBinaryNodeRecord& node) const;
+    ReadOnlySpan<UIBinaryPropertyRecord> GetProperties(const UIBinaryNodeRecord& node) const;
+    ReadOnlySpan<GridColumnDefinition> GetColumnDefinitions(const UIBinaryNodeRecord& node) const;
+    ReadOnlySpan<GridRowDefinition> GetRowDefinitions(const UIBinaryNodeRecord& node) const;
+  };
+}
+
+#endif
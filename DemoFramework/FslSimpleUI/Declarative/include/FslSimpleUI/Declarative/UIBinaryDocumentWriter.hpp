@@ -0,0 +1,105 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYDOCUMENTWRITER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYDOCUMENTWRITER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslSimpleUI/Base/Layout/GridRowColumnDefinition.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocument.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryValue.hpp>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Fsl::UI::Declarative
+{
+  //! @brief Build a binary declarative UI document.
+  //!        Nodes are added depth first, a node added while another node is open becomes a child of the open node.
+  class UIBinaryDocumentWriter
+  {
+    struct ClassRecord
+    {
+      uint32_t NameStringIndex{0};
+      std::vector<uint32_t> PropertyNameStringIndices;
+    };
+
+    struct NodeRecord
+    {
+      uint32_t ClassIndex{0};
+      uint32_t ChildCount{0};
+      std::optional<uint32_t> GridColumn;
+      std::optional<uint32_t> GridRow;
+      std::vector<std::pair<uint32_t, uint32_t>> ThemeProperties;
+      std::vector<UIBinaryPropertyRecord> Properties;
+      std::vector<GridRowColumnDefinitionBase> ColumnDefinitions;
+      std::vector<GridRowColumnDefinitionBase> RowDefinitions;
+    };
+
+    std::vector<std::string> m_strings;
+    std::map<std::string, uint32_t, std::less<>> m_stringLookup;
+    std::vector<ClassRecord> m_classes;
+    std::vector<NodeRecord> m_nodes;
+    std::vector<uint32_t> m_openNodes;
+
+  public:
+    //! @brief Add a string to the string table (duplicated strings are only stored once)
+    uint32_t AddString(const StringViewLite value);
+
+    //! @brief Add a control class (duplicated classes are only stored once)
+    uint32_t AddClass(const StringViewLite controlName);
+
+    //! @brief Add a property name to the class and return its property id (duplicated names are only stored once)
+    uint32_t AddClassProperty(const uint32_t classIndex, const StringViewLite propertyName);
+
+    //! @brief Begin a new node, it will be a child of the currently open node (if any).
+    //! @return the index of the node
+    uint32_t BeginNode(const uint32_t classIndex);
+    void EndNode();
+
+    //! @brief The theme properties are passed to the control factory as strings
+    void AddThemeProperty(const StringViewLite name, const StringViewLite value);
+    void AddProperty(const uint32_t propertyId, const UIBinaryValue& value);
+    void SetGridColumn(const uint32_t column);
+    void SetGridRow(const uint32_t row);
+    void AddColumnDefinition(const GridColumnDefinition& definition);
+    void AddRowDefinition(const GridRowDefinition& definition);
+
+    std::vector<uint8_t> ToBytes() const;
+
+  private:
+    NodeRecord& GetOpenNode();
+  };
+}
+
+#endif
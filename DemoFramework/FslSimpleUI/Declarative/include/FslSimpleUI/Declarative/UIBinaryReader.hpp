@@ -0,0 +1,68 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYREADER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYREADER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  namespace DataBinding
+  {
+    class DataBindingService;
+  }
+  namespace IO
+  {
+    class Path;
+  }
+  namespace UI
+  {
+    class BaseWindow;
+  }
+}
+
+
+namespace Fsl::UI::Declarative::UIBinaryReader
+{
+  //! @brief Instantiate the UI stored in a binary document created by UICompiler.
+  //!        Controls and properties are resolved once per control class, values are used as is and bindings are pre-linked.
+  //! @throws FormatException if the content is not a valid binary UI document.
+  std::shared_ptr<UI::BaseWindow> Load(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                       const ReadOnlySpan<uint8_t> content);
+
+  std::shared_ptr<UI::BaseWindow> Load(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                       const IO::Path& filename);
+}
+
+#endif
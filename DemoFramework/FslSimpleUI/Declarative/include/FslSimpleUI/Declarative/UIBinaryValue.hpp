@@ -0,0 +1,300 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYVALUE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYVALUE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Dp/DpSize1D.hpp>
+#include <FslBase/Math/Dp/DpSize1DF.hpp>
+#include <FslBase/Math/Dp/DpThicknessF.hpp>
+#include <FslBase/Transition/TransitionType.hpp>
+#include <FslSimpleUI/Base/Control/ScrollModeFlags.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/ItemAlignment.hpp>
+#include <FslSimpleUI/Base/Layout/LayoutOrientation.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryValueType.hpp>
+#include <array>
+#include <bit>
+
+namespace Fsl::UI::Declarative
+{
+  //! @brief A pre-parsed property value as stored in the binary declarative UI format.
+  //!        Each value is stored as one to four 32bit words.
+  class UIBinaryValue
+  {
+  public:
+    static constexpr uint32_t MaxWords = 4;
+
+  private:
+    UIBinaryValueType m_type{UIBinaryValueType::Bool};
+    std::array<uint32_t, MaxWords> m_words{};
+
+    constexpr UIBinaryValue(const UIBinaryValueType type, const uint32_t word0, const uint32_t word1 = 0, const uint32_t word2 = 0,
+                            const uint32_t word3 = 0) noexcept
+      : m_type(type)
+      , m_words({word0, word1, word2, word3})
+    {
+    }
+
+  public:
+    constexpr UIBinaryValue() noexcept = default;
+
+    constexpr UIBinaryValueType Type() const noexcept
+    {
+      return m_type;
+    }
+
+    constexpr uint32_t WordCount() const noexcept
+    {
+      return GetWordCount(m_type);
+    }
+
+    constexpr uint32_t Word(const uint32_t index) const
+    {
+      if (index >= GetWordCount(m_type))
+      {
+        throw std::invalid_argument("index out of bounds");
+      }
+      return m_words[index];
+    }
+
+    uint32_t AsStringIndex() const
+    {
+      return GetWord(UIBinaryValueType::String);
+    }
+
+    bool AsBool() const
+    {
+      return GetWord(UIBinaryValueType::Bool) != 0u;
+    }
+
+    uint8_t AsUInt8() const
+    {
+      return static_cast<uint8_t>(GetWord(UIBinaryValueType::UInt8));
+    }
+
+    int32_t AsInt32() const
+    {
+      return static_cast<int32_t>(GetWord(UIBinaryValueType::Int32));
+    }
+
+    uint32_t AsUInt32() const
+    {
+      return GetWord(UIBinaryValueType::UInt32);
+    }
+
+    DpSize1D AsDpSize1D() const
+    {
+      return DpSize1D::Create(static_cast<int32_t>(GetWord(UIBinaryValueType::DpSize1D)));
+    }
+
+    DpSize1DF AsDpSize1DF() const
+    {
+      return DpSize1DF::Create(std::bit_cast<float>(GetWord(UIBinaryValueType::DpSize1DF)));
+    }
+
+    DpThicknessF AsDpThicknessF() const
+    {
+      CheckType(UIBinaryValueType::DpThicknessF);
+      return DpThicknessF::Create(std::bit_cast<float>(m_words[0]), std::bit_cast<float>(m_words[1]), std::bit_cast<float>(m_words[2]),
+                                  std::bit_cast<float>(m_words[3]));
+    }
+
+    UI::DpLayoutSize1D AsDpLayoutSize1D() const
+    {
+      return UI::DpLayoutSize1D::Create(std::bit_cast<float>(GetWord(UIBinaryValueType::DpLayoutSize1D)));
+    }
+
+    UI::ItemAlignment AsItemAlignment() const
+    {
+      return static_cast<UI::ItemAlignment>(GetWord(UIBinaryValueType::ItemAlignment));
+    }
+
+    UI::LayoutOrientation AsLayoutOrientation() const
+    {
+      return static_cast<UI::LayoutOrientation>(GetWord(UIBinaryValueType::LayoutOrientation));
+    }
+
+    UI::ScrollModeFlags AsScrollModeFlags() const
+    {
+      return static_cast<UI::ScrollModeFlags>(GetWord(UIBinaryValueType::ScrollModeFlags));
+    }
+
+    TransitionType AsTransitionType() const
+    {
+      return static_cast<TransitionType>(GetWord(UIBinaryValueType::TransitionType));
+    }
+
+    //! @brief The index of the node that is the source of the binding
+    uint32_t BindingNodeIndex() const
+    {
+      return GetWord(UIBinaryValueType::Binding);
+    }
+
+    //! @brief The id of the source property (relative to the class of the source node)
+    uint32_t BindingPropertyId() const
+    {
+      CheckType(UIBinaryValueType::Binding);
+      return m_words[1];
+    }
+
+    constexpr bool operator==(const UIBinaryValue& rhs) const noexcept
+    {
+      return m_type == rhs.m_type && m_words == rhs.m_words;
+    }
+
+    constexpr bool operator!=(const UIBinaryValue& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+
+    static constexpr bool IsValidType(const uint32_t type) noexcept
+    {
+      return type <= static_cast<uint32_t>(UIBinaryValueType::Binding);
+    }
+
+    static constexpr uint32_t GetWordCount(const UIBinaryValueType type) noexcept
+    {
+      switch (type)
+      {
+      case UIBinaryValueType::DpThicknessF:
+        return 4;
+      case UIBinaryValueType::Binding:
+        return 2;
+      default:
+        return 1;
+      }
+    }
+
+    //! @brief Create a value from its raw words (only the first WordCount words are used)
+    static constexpr UIBinaryValue CreateFromWords(const UIBinaryValueType type, const std::array<uint32_t, MaxWords>& words) noexcept
+    {
+      switch (GetWordCount(type))
+      {
+      case 4:
+        return {type, words[0], words[1], words[2], words[3]};
+      case 2:
+        return {type, words[0], words[1]};
+      default:
+        return {type, words[0]};
+      }
+    }
+
+    static constexpr UIBinaryValue CreateString(const uint32_t stringIndex) noexcept
+    {
+      return {UIBinaryValueType::String, stringIndex};
+    }
+
+    static constexpr UIBinaryValue CreateBool(const bool value) noexcept
+    {
+      return {UIBinaryValueType::Bool, value ? 1u : 0u};
+    }
+
+    static constexpr UIBinaryValue CreateUInt8(const uint8_t value) noexcept
+    {
+      return {UIBinaryValueType::UInt8, value};
+    }
+
+    static constexpr UIBinaryValue CreateInt32(const int32_t value) noexcept
+    {
+      return {UIBinaryValueType::Int32, static_cast<uint32_t>(value)};
+    }
+
+    static constexpr UIBinaryValue CreateUInt32(const uint32_t value) noexcept
+    {
+      return {UIBinaryValueType::UInt32, value};
+    }
+
+    static constexpr UIBinaryValue CreateDpSize1D(const DpSize1D value) noexcept
+    {
+      return {UIBinaryValueType::DpSize1D, static_cast<uint32_t>(value.RawValue())};
+    }
+
+    static constexpr UIBinaryValue CreateDpSize1DF(const DpSize1DF value) noexcept
+    {
+      return {UIBinaryValueType::DpSize1DF, std::bit_cast<uint32_t>(value.RawValue())};
+    }
+
+    static constexpr UIBinaryValue CreateDpThicknessF(const DpThicknessF value) noexcept
+    {
+      return {UIBinaryValueType::DpThicknessF, std::bit_cast<uint32_t>(value.RawLeft()), std::bit_cast<uint32_t>(value.RawTop()),
+              std::bit_cast<uint32_t>(value.RawRight()), std::bit_cast<uint32_t>(value.RawBottom())};
+    }
+
+    static constexpr UIBinaryValue CreateDpLayoutSize1D(const UI::DpLayoutSize1D value) noexcept
+    {
+      return {UIBinaryValueType::DpLayoutSize1D, std::bit_cast<uint32_t>(value.RawValue().Value)};
+    }
+
+    static constexpr UIBinaryValue CreateItemAlignment(const UI::ItemAlignment value) noexcept
+    {
+      return {UIBinaryValueType::ItemAlignment, static_cast<uint32_t>(value)};
+    }
+
+    static constexpr UIBinaryValue CreateLayoutOrientation(const UI::LayoutOrientation value) noexcept
+    {
+      return {UIBinaryValueType::LayoutOrientation, static_cast<uint32_t>(value)};
+    }
+
+    static constexpr UIBinaryValue CreateScrollModeFlags(const UI::ScrollModeFlags value) noexcept
+    {
+      return {UIBinaryValueType::ScrollModeFlags, static_cast<uint32_t>(value)};
+    }
+
+    static constexpr UIBinaryValue CreateTransitionType(const TransitionType value) noexcept
+    {
+      return {UIBinaryValueType::TransitionType, static_cast<uint32_t>(value)};
+    }
+
+    static constexpr UIBinaryValue CreateBinding(const uint32_t nodeIndex, const uint32_t propertyId) noexcept
+    {
+      return {UIBinaryValueType::Binding, nodeIndex, propertyId};
+    }
+
+  private:
+    void CheckType(const UIBinaryValueType type) const
+    {
+      if (m_type != type)
+      {
+        throw UsageErrorException("The value is not of the requested type");
+      }
+    }
+
+    uint32_t GetWord(const UIBinaryValueType type) const
+    {
+      CheckType(type);
+      return m_words[0];
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYVALUETYPE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYVALUETYPE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::UI::Declarative
+{
+  //! @brief The value types supported by the binary declarative UI format.
+  //! @note  The values are stored in the binary files so only append new types
+  enum class UIBinaryValueType : uint8_t
+  {
+    //! Index into the string table
+    String = 0,
+    Bool = 1,
+    UInt8 = 2,
+    Int32 = 3,
+    UInt32 = 4,
+    DpSize1D = 5,
+    DpSize1DF = 6,
+    DpThicknessF = 7,
+    DpLayoutSize1D = 8,
+    ItemAlignment = 9,
+    LayoutOrientation = 10,
+    ScrollModeFlags = 11,
+    TransitionType = 12,
+    //! A binding to a property of a node that was created before the node that owns the binding (node index, property id)
+    Binding = 13,
+  };
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UICOMPILER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UICOMPILER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  namespace IO
+  {
+    class Path;
+  }
+}
+
+namespace Fsl::UI::Declarative
+{
+  class ControlFactory;
+}
+
+namespace Fsl::UI::Declarative::UICompiler
+{
+  //! @brief Compile a declarative UI xml document into the binary format loaded by UIBinaryReader.
+  //!        Controls, property names and values are resolved and parsed using the control factory so the loader can skip all string parsing.
+  //! @throws FormatException if the document contains unknown controls or properties, invalid values or unresolved bindings.
+  std::vector<uint8_t> Compile(ControlFactory& controlFactory, const IO::Path& filename);
+
+  //! @brief Compile a declarative UI xml document stored in memory.
+  std::vector<uint8_t> CompileFromString(ControlFactory& controlFactory, const StringViewLite content);
+}
+
+#endif
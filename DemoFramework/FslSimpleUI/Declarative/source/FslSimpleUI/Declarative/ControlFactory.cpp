@@ -35,7 +35,9 @@
 #include <FslSimpleUI/Declarative/ControlInfoUtil.hpp>
 #include <FslSimpleUI/Theme/Base/IThemeControlFactory.hpp>
 #include <fmt/format.h>
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <utility>
 #include "Factories/Control/BackgroundWindowDeclarativeControlFactory.hpp"
 #include "Factories/Control/BottomBarDeclarativeControlFactory.hpp"
@@ -191,6 +193,7 @@ namespace Fsl::UI::Declarative
       throw UsageErrorException(fmt::format("Can not register a factory twice for the same control '{}'", controlName.AsString()));
     }
 
+    m_factoryById.push_back(factory.get());
     m_factories.emplace(controlName, std::move(factory));
   }
 
@@ -198,16 +201,11 @@ namespace Fsl::UI::Declarative
   std::shared_ptr<BaseWindow> ControlFactory::TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
                                                         std::vector<PropertyRecord>& rPropertyRecords)
   {
-    Theme::IThemeControlFactory& uiFactory = *m_controlFactory;
-
     const auto itrFind = m_factories.find(name);
     if (itrFind != m_factories.end())
     {
-      Span<RegisteredPropertyRecord> registeredProperties = FillScratchpad(m_registeredPropertyScratchpad, itrFind->second->Properties());
       Span<PropertyParserRecord> properties = FillScratchpad(m_createPropertiesScratchpad, SpanUtil::AsReadOnlySpan(rPropertyRecords));
-
-      ScopedThemePropertyParser propertyParser(registeredProperties, properties);
-      auto res = itrFind->second->Create(DeclarativeControlFactoryCreateInfo(uiFactory, rRadioGroupManager, propertyParser));
+      auto res = DoCreate(*itrFind->second, rRadioGroupManager, properties);
       EraseClaimed(rPropertyRecords, properties);
       return res;
     }
@@ -216,6 +214,30 @@ namespace Fsl::UI::Declarative
     return {};
   }
 
+
+  std::optional<uint32_t> ControlFactory::TryGetControlId(const std::string_view name) const
+  {
+    const auto itrFind = m_factories.find(name);
+    if (itrFind == m_factories.end())
+    {
+      return {};
+    }
+    const auto itrId = std::find(m_factoryById.begin(), m_factoryById.end(), itrFind->second.get());
+    assert(itrId != m_factoryById.end());
+    return static_cast<uint32_t>(std::distance(m_factoryById.begin(), itrId));
+  }
+
+
+  std::shared_ptr<BaseWindow> ControlFactory::TryCreate(RadioGroupManager& rRadioGroupManager, const uint32_t controlId,
+                                                        Span<PropertyParserRecord> themeProperties)
+  {
+    if (controlId >= m_factoryById.size())
+    {
+      return {};
+    }
+    return DoCreate(*m_factoryById[controlId], rRadioGroupManager, themeProperties);
+  }
+
   std::vector<ControlName> ControlFactory::GetControlNames() const
   {
     std::vector<ControlName> names;
@@ -276,6 +298,15 @@ namespace Fsl::UI::Declarative
   }
 
 
+  std::shared_ptr<BaseWindow> ControlFactory::DoCreate(ADeclarativeControlFactory& rFactory, RadioGroupManager& rRadioGroupManager,
+                                                       Span<PropertyParserRecord> properties)
+  {
+    Span<RegisteredPropertyRecord> registeredProperties = FillScratchpad(m_registeredPropertyScratchpad, rFactory.Properties());
+    ScopedThemePropertyParser propertyParser(registeredProperties, properties);
+    return rFactory.Create(DeclarativeControlFactoryCreateInfo(*m_controlFactory, rRadioGroupManager, propertyParser));
+  }
+
+
   std::shared_ptr<BaseWindow> ControlFactory::TryCreateDummyControl(const std::string_view name)
   {
     const auto itrFind = m_factories.find(name);
@@ -0,0 +1,119 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include "PropertySetter.hpp"
+
+namespace Fsl::UI::Declarative::Internal
+{
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyBool =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<bool, PropertySetter, &PropertySetter::GetBool, &PropertySetter::SetBool>("bool");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyUInt8 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<uint8_t, PropertySetter, &PropertySetter::GetUInt8, &PropertySetter::SetUInt8>(
+      "UInt8");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyInt32 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<int32_t, PropertySetter, &PropertySetter::GetInt32, &PropertySetter::SetInt32>(
+      "Int32");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyUInt32 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<uint32_t, PropertySetter, &PropertySetter::GetUInt32, &PropertySetter::SetUInt32>(
+      "UInt32");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpSize1D =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1D, PropertySetter, &PropertySetter::GetDpSize1D, &PropertySetter::SetDpSize1D>(
+      "DpSize1D");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpSize1DF =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1DF, PropertySetter, &PropertySetter::GetDpSize1DF,
+                                                             &PropertySetter::SetDpSize1DF>("DpSize1DF");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpThicknessF =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpThicknessF, PropertySetter, &PropertySetter::GetDpThicknessF,
+                                                             &PropertySetter::SetDpThicknessF>("DpThicknessF");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpLayoutSize1D =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpLayoutSize1D, PropertySetter, &PropertySetter::GetDpLayoutSize1D,
+                                                             &PropertySetter::SetDpLayoutSize1D>("DpLayoutSize1D");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyItemAlignment =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ItemAlignment, PropertySetter, &PropertySetter::GetItemAlignment,
+                                                             &PropertySetter::SetItemAlignment>("ItemAlignment");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyLayoutOrientation =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::LayoutOrientation, PropertySetter, &PropertySetter::GetLayoutOrientation,
+                                                             &PropertySetter::SetOrientation>("LayoutOrientation");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyScrollModeFlags =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ScrollModeFlags, PropertySetter, &PropertySetter::GetScrollModeFlags,
+                                                             &PropertySetter::SetScrollModeFlags>("ScrollModeFlags");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyTransitionType =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<TransitionType, PropertySetter, &PropertySetter::GetTransitionType,
+                                                             &PropertySetter::SetTransitionType>("TransitionType");
+
+  DataBinding::DependencyPropertyDefinition PropertySetter::PropertyStringView =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<StringViewLite, PropertySetter, &PropertySetter::GetStringView,
+                                                             &PropertySetter::SetStringView>("StringView");
+
+
+  DataBinding::DataBindingInstanceHandle PropertySetter::TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef)
+  {
+    using namespace DataBinding;
+    auto res = DependencyObjectHelper::TryGetPropertyHandle(
+      this, ThisDependencyObject(), sourceDef, PropLinkRefs(PropertyBool, m_propertyBool), PropLinkRefs(PropertyUInt8, m_propertyUInt8),
+      PropLinkRefs(PropertyInt32, m_propertyInt32), PropLinkRefs(PropertyUInt32, m_propertyUInt32),
+      PropLinkRefs(PropertyDpSize1D, m_propertyDpSize1D), PropLinkRefs(PropertyDpSize1DF, m_propertyDpSize1DF),
+      PropLinkRefs(PropertyDpThicknessF, m_propertyDpThicknessF), PropLinkRefs(PropertyDpLayoutSize1D, m_propertyDpLayoutSize1D),
+      PropLinkRefs(PropertyItemAlignment, m_propertyItemAlignment), PropLinkRefs(PropertyLayoutOrientation, m_propertyLayoutOrientation),
+      PropLinkRefs(PropertyScrollModeFlags, m_propertyScrollModeFlags), PropLinkRefs(PropertyTransitionType, m_propertyTransitionType),
+      PropLinkRefs(PropertyStringView, m_propertyStringView));
+    return res.IsValid() ? res : DependencyObject::TryGetPropertyHandleNow(sourceDef);
+  }
+
+
+  DataBinding::PropertySetBindingResult PropertySetter::TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                                         const DataBinding::Binding& binding)
+  {
+    using namespace DataBinding;
+    auto res = DependencyObjectHelper::TrySetBinding(
+      this, ThisDependencyObject(), targetDef, binding, PropLinkRefs(PropertyBool, m_propertyBool),
+      PropLinkRefs(PropertyUInt8, m_propertyUInt8), PropLinkRefs(PropertyInt32, m_propertyInt32), PropLinkRefs(PropertyUInt32, m_propertyUInt32),
+      PropLinkRefs(PropertyDpSize1D, m_propertyDpSize1D), PropLinkRefs(PropertyDpSize1DF, m_propertyDpSize1DF),
+      PropLinkRefs(PropertyDpThicknessF, m_propertyDpThicknessF), PropLinkRefs(PropertyDpLayoutSize1D, m_propertyDpLayoutSize1D),
+      PropLinkRefs(PropertyItemAlignment, m_propertyItemAlignment), PropLinkRefs(PropertyLayoutOrientation, m_propertyLayoutOrientation),
+      PropLinkRefs(PropertyScrollModeFlags, m_propertyScrollModeFlags), PropLinkRefs(PropertyTransitionType, m_propertyTransitionType),
+      PropLinkRefs(PropertyStringView, m_propertyStringView));
+    return res != PropertySetBindingResult::NotFound ? res : DependencyObject::TrySetBindingNow(targetDef, binding);
+  }
+}
@@ -0,0 +1,239 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_PROPERTYSETTER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_PROPERTYSETTER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Dp/DpSize1D.hpp>
+#include <FslBase/Math/Dp/DpSize1DF.hpp>
+#include <FslBase/Math/Dp/DpThicknessF.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslBase/Transition/TransitionType.hpp>
+#include <FslDataBinding/Base/Object/DependencyObject.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
+#include <FslSimpleUI/Base/Control/ScrollModeFlags.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/ItemAlignment.hpp>
+#include <FslSimpleUI/Base/Layout/LayoutOrientation.hpp>
+#include <memory>
+#include <utility>
+
+namespace Fsl::UI::Declarative::Internal
+{
+  //! @brief Quick solution that uses the data binding service as a value setter.
+  //!        Set a value, bind the target property to the matching source property and execute the changes.
+  class PropertySetter final : public DataBinding::DependencyObject
+  {
+    DataBinding::TypedDependencyProperty<bool> m_propertyBool;
+    DataBinding::TypedDependencyProperty<uint8_t> m_propertyUInt8;
+    DataBinding::TypedDependencyProperty<int32_t> m_propertyInt32;
+    DataBinding::TypedDependencyProperty<uint32_t> m_propertyUInt32;
+    DataBinding::TypedDependencyProperty<DpSize1D> m_propertyDpSize1D;
+    DataBinding::TypedDependencyProperty<DpSize1DF> m_propertyDpSize1DF;
+    DataBinding::TypedDependencyProperty<DpThicknessF> m_propertyDpThicknessF;
+    DataBinding::TypedDependencyProperty<UI::DpLayoutSize1D> m_propertyDpLayoutSize1D;
+    DataBinding::TypedDependencyProperty<UI::ItemAlignment> m_propertyItemAlignment;
+    DataBinding::TypedDependencyProperty<UI::LayoutOrientation> m_propertyLayoutOrientation;
+    DataBinding::TypedDependencyProperty<UI::ScrollModeFlags> m_propertyScrollModeFlags;
+    DataBinding::TypedDependencyProperty<TransitionType> m_propertyTransitionType;
+    DataBinding::TypedDependencyProperty<StringViewLite> m_propertyStringView;
+
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyBool;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyUInt8;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyInt32;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyUInt32;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyDpSize1D;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyDpSize1DF;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyDpThicknessF;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyDpLayoutSize1D;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyItemAlignment;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyLayoutOrientation;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyScrollModeFlags;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyTransitionType;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyStringView;
+
+    explicit PropertySetter(std::shared_ptr<DataBinding::DataBindingService> dataBinding)
+      : DataBinding::DependencyObject(std::move(dataBinding))
+    {
+    }
+
+    bool GetBool() const noexcept
+    {
+      return m_propertyBool.Get();
+    }
+
+    bool SetBool(const bool value)
+    {
+      return m_propertyBool.Set(ThisDependencyObject(), value);
+    }
+
+    uint8_t GetUInt8() const noexcept
+    {
+      return m_propertyUInt8.Get();
+    }
+
+    bool SetUInt8(const uint8_t value)
+    {
+      return m_propertyUInt8.Set(ThisDependencyObject(), value);
+    }
+
+    int32_t GetInt32() const noexcept
+    {
+      return m_propertyInt32.Get();
+    }
+
+    bool SetInt32(const int32_t value)
+    {
+      return m_propertyInt32.Set(ThisDependencyObject(), value);
+    }
+
+    uint32_t GetUInt32() const noexcept
+    {
+      return m_propertyUInt32.Get();
+    }
+
+    bool SetUInt32(const uint32_t value)
+    {
+      return m_propertyUInt32.Set(ThisDependencyObject(), value);
+    }
+
+    DpSize1D GetDpSize1D() const noexcept
+    {
+      return m_propertyDpSize1D.Get();
+    }
+
+    bool SetDpSize1D(const DpSize1D value)
+    {
+      return m_propertyDpSize1D.Set(ThisDependencyObject(), value);
+    }
+
+    DpSize1DF GetDpSize1DF() const noexcept
+    {
+      return m_propertyDpSize1DF.Get();
+    }
+
+    bool SetDpSize1DF(const DpSize1DF value)
+    {
+      return m_propertyDpSize1DF.Set(ThisDependencyObject(), value);
+    }
+
+    DpThicknessF GetDpThicknessF() const noexcept
+    {
+      return m_propertyDpThicknessF.Get();
+    }
+
+    bool SetDpThicknessF(const DpThicknessF value)
+    {
+      return m_propertyDpThicknessF.Set(ThisDependencyObject(), value);
+    }
+
+    DpLayoutSize1D GetDpLayoutSize1D() const noexcept
+    {
+      return m_propertyDpLayoutSize1D.Get();
+    }
+
+    bool SetDpLayoutSize1D(const DpLayoutSize1D value)
+    {
+      return m_propertyDpLayoutSize1D.Set(ThisDependencyObject(), value);
+    }
+
+    UI::ItemAlignment GetItemAlignment() const noexcept
+    {
+      return m_propertyItemAlignment.Get();
+    }
+
+    bool SetItemAlignment(const UI::ItemAlignment value)
+    {
+      return m_propertyItemAlignment.Set(ThisDependencyObject(), value);
+    }
+
+    UI::LayoutOrientation GetLayoutOrientation() const noexcept
+    {
+      return m_propertyLayoutOrientation.Get();
+    }
+
+    bool SetOrientation(const UI::LayoutOrientation value)
+    {
+      return m_propertyLayoutOrientation.Set(ThisDependencyObject(), value);
+    }
+
+    UI::ScrollModeFlags GetScrollModeFlags() const noexcept
+    {
+      return m_propertyScrollModeFlags.Get();
+    }
+
+    bool SetScrollModeFlags(const UI::ScrollModeFlags value)
+    {
+      return m_propertyScrollModeFlags.Set(ThisDependencyObject(), value);
+    }
+
+    TransitionType GetTransitionType() const noexcept
+    {
+      return m_propertyTransitionType.Get();
+    }
+
+    bool SetTransitionType(const TransitionType value)
+    {
+      return m_propertyTransitionType.Set(ThisDependencyObject(), value);
+    }
+
+    StringViewLite GetStringView() const noexcept
+    {
+      return m_propertyStringView.Get();
+    }
+
+    bool SetStringView(const StringViewLite value)
+    {
+      return m_propertyStringView.Set(ThisDependencyObject(), value);
+    }
+
+  protected:
+    DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final;
+    DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                           const DataBinding::Binding& binding) final;
+  };
+}
+
+#endif
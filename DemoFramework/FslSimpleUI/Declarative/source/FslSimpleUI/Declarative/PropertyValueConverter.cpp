@@ -0,0 +1,289 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/String/StringParseUtil.hpp>
+#include <cmath>
+#include <exception>
+#include "PropertyValueConverter.hpp"
+
+namespace Fsl::UI::Declarative::Internal::PropertyValueConverter
+{
+  std::optional<GridColumnDefinition> TryParseGridColumnDefinition(const StringViewLite attr)
+  {
+    if (attr == "Auto")
+    {
+      return GridColumnDefinition(GridUnitType::Auto);
+    }
+    if (attr == "*")
+    {
+      return GridColumnDefinition(GridUnitType::Star, 1.0f);
+    }
+
+
+    // Need a try parse for floats
+    try
+    {
+      float value = 0.0f;
+      StringParseUtil::Parse(value, attr);
+      return GridColumnDefinition(GridUnitType::Fixed, value);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    return {};
+  }
+
+
+  std::optional<GridRowDefinition> TryParseGridRowDefinition(const StringViewLite attr)
+  {
+    if (attr == "Auto")
+    {
+      return GridRowDefinition(GridUnitType::Auto);
+    }
+    if (attr == "*")
+    {
+      return GridRowDefinition(GridUnitType::Star, 1.0f);
+    }
+
+
+    // Need a try parse for floats
+    try
+    {
+      float value = NAN;
+      StringParseUtil::Parse(value, attr);
+      return GridRowDefinition(GridUnitType::Fixed, value);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    return {};
+  }
+
+
+  std::optional<UI::ItemAlignment> TryToItemAlignment(const StringViewLite value)
+  {
+    if (value == "Near")
+    {
+      return UI::ItemAlignment::Near;
+    }
+    if (value == "Center")
+    {
+      return UI::ItemAlignment::Center;
+    }
+    if (value == "Far")
+    {
+      return UI::ItemAlignment::Far;
+    }
+    if (value == "Stretch")
+    {
+      return UI::ItemAlignment::Stretch;
+    }
+    return {};
+  }
+
+
+  std::optional<UI::LayoutOrientation> TryToLayoutOrientation(const StringViewLite value)
+  {
+    if (value == "Vertical")
+    {
+      return UI::LayoutOrientation::Vertical;
+    }
+    if (value == "Horizontal")
+    {
+      return UI::LayoutOrientation::Horizontal;
+    }
+    return {};
+  }
+
+
+  std::optional<UI::ScrollModeFlags> TryToScrollModeFlags(const StringViewLite value)
+  {
+    if (value == "TranslateX")
+    {
+      return UI::ScrollModeFlags::TranslateX;
+    }
+    if (value == "TranslateY")
+    {
+      return UI::ScrollModeFlags::TranslateY;
+    }
+    if (value == "Translate")
+    {
+      return UI::ScrollModeFlags::Translate;
+    }
+    return {};
+  }
+
+
+  std::optional<TransitionType> TryToTransitionType(const StringViewLite value)
+  {
+    if (value == "Linear")
+    {
+      return TransitionType::Linear;
+    }
+    if (value == "EaseInSine")
+    {
+      return TransitionType::EaseInSine;
+    }
+    if (value == "EaseOutSine")
+    {
+      return TransitionType::EaseOutSine;
+    }
+    if (value == "EaseInOutSine")
+    {
+      return TransitionType::EaseInOutSine;
+    }
+    if (value == "EaseInQuad")
+    {
+      return TransitionType::EaseInQuad;
+    }
+    if (value == "EaseOutQuad")
+    {
+      return TransitionType::EaseOutQuad;
+    }
+    if (value == "EaseInOutQuad")
+    {
+      return TransitionType::EaseInOutQuad;
+    }
+    if (value == "EaseInCubic")
+    {
+      return TransitionType::EaseInCubic;
+    }
+    if (value == "EaseOutCubic")
+    {
+      return TransitionType::EaseOutCubic;
+    }
+    if (value == "EaseInOutCubic")
+    {
+      return TransitionType::EaseInOutCubic;
+    }
+    if (value == "EaseInQuart")
+    {
+      return TransitionType::EaseInQuart;
+    }
+    if (value == "EaseOutQuart")
+    {
+      return TransitionType::EaseOutQuart;
+    }
+    if (value == "EaseInOutQuart")
+    {
+      return TransitionType::EaseInOutQuart;
+    }
+    if (value == "EaseInQuint")
+    {
+      return TransitionType::EaseInQuint;
+    }
+    if (value == "EaseOutQuint")
+    {
+      return TransitionType::EaseOutQuint;
+    }
+    if (value == "EaseInOutQuint")
+    {
+      return TransitionType::EaseInOutQuint;
+    }
+    if (value == "EaseInExpo")
+    {
+      return TransitionType::EaseInExpo;
+    }
+    if (value == "EaseOutExpo")
+    {
+      return TransitionType::EaseOutExpo;
+    }
+    if (value == "EaseInOutExpo")
+    {
+      return TransitionType::EaseInOutExpo;
+    }
+    if (value == "EaseInCirc")
+    {
+      return TransitionType::EaseInCirc;
+    }
+    if (value == "EaseOutCirc")
+    {
+      return TransitionType::EaseOutCirc;
+    }
+    if (value == "EaseInOutCirc")
+    {
+      return TransitionType::EaseInOutCirc;
+    }
+    if (value == "EaseInBack")
+    {
+      return TransitionType::EaseInBack;
+    }
+    if (value == "EaseOutBack")
+    {
+      return TransitionType::EaseOutBack;
+    }
+    if (value == "EaseInOutBack")
+    {
+      return TransitionType::EaseInOutBack;
+    }
+    if (value == "EaseInElastic")
+    {
+      return TransitionType::EaseInElastic;
+    }
+    if (value == "EaseOutElastic")
+    {
+      return TransitionType::EaseOutElastic;
+    }
+    if (value == "EaseInOutElastic")
+    {
+      return TransitionType::EaseInOutElastic;
+    }
+    if (value == "EaseInBounce")
+    {
+      return TransitionType::EaseInBounce;
+    }
+    if (value == "EaseOutBounce")
+    {
+      return TransitionType::EaseOutBounce;
+    }
+    if (value == "EaseInOutBounce")
+    {
+      return TransitionType::EaseInOutBounce;
+    }
+    return {};
+  }
+
+
+  std::optional<UI::LayoutDirection> TryToLayoutDirection(const StringViewLite value)
+  {
+    if (value == "NearToFar")
+    {
+      return UI::LayoutDirection::NearToFar;
+    }
+    if (value == "FarToNear")
+    {
+      return UI::LayoutDirection::FarToNear;
+    }
+    return {};
+  }
+}
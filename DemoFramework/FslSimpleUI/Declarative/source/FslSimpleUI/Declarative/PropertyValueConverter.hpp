@@ -0,0 +1,56 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_PROPERTYVALUECONVERTER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_PROPERTYVALUECONVERTER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslBase/Transition/TransitionType.hpp>
+#include <FslSimpleUI/Base/Control/ScrollModeFlags.hpp>
+#include <FslSimpleUI/Base/ItemAlignment.hpp>
+#include <FslSimpleUI/Base/Layout/GridRowColumnDefinition.hpp>
+#include <FslSimpleUI/Base/Layout/LayoutOrientation.hpp>
+#include <FslSimpleUI/Base/LayoutDirection.hpp>
+#include <optional>
+
+//! String to value conversions shared by the xml reader and the binary compiler
+namespace Fsl::UI::Declarative::Internal::PropertyValueConverter
+{
+  std::optional<GridColumnDefinition> TryParseGridColumnDefinition(const StringViewLite attr);
+  std::optional<GridRowDefinition> TryParseGridRowDefinition(const StringViewLite attr);
+
+  std::optional<UI::ItemAlignment> TryToItemAlignment(const StringViewLite value);
+  std::optional<UI::LayoutOrientation> TryToLayoutOrientation(const StringViewLite value);
+  std::optional<UI::ScrollModeFlags> TryToScrollModeFlags(const StringViewLite value);
+  std::optional<TransitionType> TryToTransitionType(const StringViewLite value);
+  std::optional<UI::LayoutDirection> TryToLayoutDirection(const StringViewLite value);
+}
+
+#endif
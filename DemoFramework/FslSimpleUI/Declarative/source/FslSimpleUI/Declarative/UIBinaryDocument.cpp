@@ -0,0 +1,351 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteSpanUtil_ReadLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocument.hpp>
+#include <fmt/format.h>
+#include <bit>
+#include "UIBinaryFormat.hpp"
+
+namespace Fsl::UI::Declarative
+{
+  namespace
+  {
+    class WordReader
+    {
+      ReadOnlySpan<uint8_t> m_content;
+      std::size_t m_offset{0};
+
+    public:
+      explicit WordReader(const ReadOnlySpan<uint8_t> content)
+        : m_content(content)
+      {
+      }
+
+      std::size_t Offset() const noexcept
+      {
+        return m_offset;
+      }
+
+      std::size_t Remaining() const noexcept
+      {
+        return m_content.size() - m_offset;
+      }
+
+      uint32_t Read()
+      {
+        if (Remaining() < 4u)
+        {
+          throw FormatException("Unexpected end of content");
+        }
+        const uint32_t value = ByteSpanUtil::ReadUInt32LE(m_content, m_offset);
+        m_offset += 4u;
+        return value;
+      }
+
+      void Skip(const std::size_t byteCount)
+      {
+        if (byteCount > Remaining())
+        {
+          throw FormatException("Unexpected end of content");
+        }
+        m_offset += byteCount;
+      }
+
+      //! @brief Validate that there is room for the given number of entries before we reserve memory for them
+      void CheckRemaining(const uint32_t entryCount, const uint32_t minEntryByteSize) const
+      {
+        if ((static_cast<uint64_t>(entryCount) * minEntryByteSize) > Remaining())
+        {
+          throw FormatException(fmt::format("Invalid entry count {}", entryCount));
+        }
+      }
+    };
+
+
+    uint32_t ReadIndex(WordReader& rReader, const std::size_t count, const char* const pszName)
+    {
+      const uint32_t index = rReader.Read();
+      if (index >= count)
+      {
+        throw FormatException(fmt::format("Invalid {} index {}", pszName, index));
+      }
+      return index;
+    }
+
+
+    GridRowColumnDefinitionBase ReadDefinition(WordReader& rReader)
+    {
+      const uint32_t unit = rReader.Read();
+      const auto size = std::bit_cast<float>(rReader.Read());
+      if (unit > static_cast<uint32_t>(GridUnitType::Star))
+      {
+        throw FormatException(fmt::format("Invalid grid unit type {}", unit));
+      }
+      return {static_cast<GridUnitType>(unit), size};
+    }
+  }
+
+
+  UIBinaryDocument::UIBinaryDocument(const ReadOnlySpan<uint8_t> content)
+  {
+    WordReader reader(content);
+    if (content.size() < (UIBinaryFormat::HeaderWords * 4u) || reader.Read() != UIBinaryFormat::Magic)
+    {
+      throw FormatException("Not a binary UI document");
+    }
+    const uint32_t version = reader.Read();
+    if (version != UIBinaryFormat::Version)
+    {
+      throw FormatException(fmt::format("Unsupported binary UI document version {}", version));
+    }
+    const uint32_t stringCount = reader.Read();
+    const uint32_t classCount = reader.Read();
+    const uint32_t nodeCount = reader.Read();
+    const uint32_t stringDataSize = reader.Read();
+    if (nodeCount == 0u)
+    {
+      throw FormatException("The document does not contain any nodes");
+    }
+
+    {    // Strings
+      reader.CheckRemaining(stringCount, 8u);
+      const std::size_t stringDataOffset = reader.Offset() + (static_cast<std::size_t>(stringCount) * 8u);
+      if ((stringDataSize % 4u) != 0u || stringDataSize > (content.size() - stringDataOffset))
+      {
+        throw FormatException("Invalid string data size");
+      }
+      const auto* const pStringData = reinterpret_cast<const char*>(content.data() + stringDataOffset);
+      m_strings.reserve(stringCount);
+      for (uint32_t i = 0; i < stringCount; ++i)
+      {
+        const uint32_t offset = reader.Read();
+        const uint32_t length = reader.Read();
+        // The string and its zero terminator must be inside the string data
+        if (offset >= stringDataSize || length >= (stringDataSize - offset) || pStringData[offset + length] != 0)
+        {
+          throw FormatException(fmt::format("Invalid string entry {}", i));
+        }
+        m_strings.emplace_back(pStringData + offset, length);
+      }
+      reader.Skip(stringDataSize);
+    }
+
+    {    // Classes
+      reader.CheckRemaining(classCount, 8u);
+      m_classes.reserve(classCount);
+      for (uint32_t i = 0; i < classCount; ++i)
+      {
+        const uint32_t nameStringIndex = ReadIndex(reader, m_strings.size(), "string");
+        const uint32_t propertyCount = reader.Read();
+        reader.CheckRemaining(propertyCount, 4u);
+        m_classes.push_back(ClassRecord{nameStringIndex, static_cast<uint32_t>(m_classPropertyNames.size()), propertyCount});
+        for (uint32_t propertyId = 0; propertyId < propertyCount; ++propertyId)
+        {
+          m_classPropertyNames.push_back(ReadIndex(reader, m_strings.size(), "string"));
+        }
+      }
+    }
+
+    {    // Nodes
+      struct OpenNode
+      {
+        uint32_t NodeIndex;
+        uint32_t RemainingChildren;
+      };
+      std::vector<OpenNode> openNodes;
+
+      reader.CheckRemaining(nodeCount, 36u);
+      m_nodes.reserve(nodeCount);
+      for (uint32_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+      {
+        if (nodeIndex > 0u)
+        {
+          if (openNodes.empty())
+          {
+            throw FormatException("The document contains more than one root node");
+          }
+          --openNodes.back().RemainingChildren;
+        }
+
+        UIBinaryNodeRecord node;
+        node.ClassIndex = ReadIndex(reader, m_classes.size(), "class");
+        const uint32_t flags = reader.Read();
+        const uint32_t gridColumn = reader.Read();
+        const uint32_t gridRow = reader.Read();
+        if ((flags & ~(UIBinaryFormat::NodeFlagGridColumn | UIBinaryFormat::NodeFlagGridRow)) != 0u)
+        {
+          throw FormatException(fmt::format("Invalid node flags {}", flags));
+        }
+        if ((flags & UIBinaryFormat::NodeFlagGridColumn) != 0u)
+        {
+          node.GridColumn = gridColumn;
+        }
+        if ((flags & UIBinaryFormat::NodeFlagGridRow) != 0u)
+        {
+          node.GridRow = gridRow;
+        }
+        node.ChildCount = reader.Read();
+
+        node.ThemePropertyCount = reader.Read();
+        reader.CheckRemaining(node.ThemePropertyCount, 8u);
+        node.ThemePropertyOffset = static_cast<uint32_t>(m_themeProperties.size());
+        for (uint32_t i = 0; i < node.ThemePropertyCount; ++i)
+        {
+          const uint32_t nameIndex = ReadIndex(reader, m_strings.size(), "string");
+          const uint32_t valueIndex = ReadIndex(reader, m_strings.size(), "string");
+          m_themeProperties.emplace_back(m_strings[nameIndex], m_strings[valueIndex]);
+        }
+
+        node.PropertyCount = reader.Read();
+        reader.CheckRemaining(node.PropertyCount, 8u);
+        node.PropertyOffset = static_cast<uint32_t>(m_properties.size());
+        const ClassRecord& nodeClass = m_classes[node.ClassIndex];
+        for (uint32_t i = 0; i < node.PropertyCount; ++i)
+        {
+          const uint32_t entry = reader.Read();
+          const uint32_t propertyId = entry & UIBinaryFormat::PropertyIdMask;
+          const uint32_t rawType = entry >> UIBinaryFormat::PropertyTypeShift;
+          if (propertyId >= nodeClass.PropertyCount)
+          {
+            throw FormatException(fmt::format("Invalid property id {}", propertyId));
+          }
+          if (!UIBinaryValue::IsValidType(rawType))
+          {
+            throw FormatException(fmt::format("Invalid value type {}", rawType));
+          }
+          const auto type = static_cast<UIBinaryValueType>(rawType);
+          std::array<uint32_t, UIBinaryValue::MaxWords> words{};
+          for (uint32_t wordIndex = 0; wordIndex < UIBinaryValue::GetWordCount(type); ++wordIndex)
+          {
+            words[wordIndex] = reader.Read();
+          }
+          const UIBinaryValue value = UIBinaryValue::CreateFromWords(type, words);
+          if (type == UIBinaryValueType::String && value.AsStringIndex() >= m_strings.size())
+          {
+            throw FormatException(fmt::format("Invalid string index {}", value.AsStringIndex()));
+          }
+          if (type == UIBinaryValueType::Binding)
+          {
+            // Bindings are pre-linked to a node that is created before the binding is applied
+            const uint32_t sourceNodeIndex = value.BindingNodeIndex();
+            if (sourceNodeIndex > nodeIndex)
+            {
+              throw FormatException(fmt::format("Invalid binding source node {}", sourceNodeIndex));
+            }
+            const uint32_t sourceClassIndex = sourceNodeIndex < nodeIndex ? m_nodes[sourceNodeIndex].ClassIndex : node.ClassIndex;
+            if (value.BindingPropertyId() >= m_classes[sourceClassIndex].PropertyCount)
+            {
+              throw FormatException(fmt::format("Invalid binding source property id {}", value.BindingPropertyId()));
+            }
+          }
+          m_properties.emplace_back(propertyId, value);
+        }
+
+        node.ColumnDefinitionCount = reader.Read();
+        reader.CheckRemaining(node.ColumnDefinitionCount, 8u);
+        node.ColumnDefinitionOffset = static_cast<uint32_t>(m_columnDefinitions.size());
+        for (uint32_t i = 0; i < node.ColumnDefinitionCount; ++i)
+        {
+          m_columnDefinitions.emplace_back(ReadDefinition(reader));
+        }
+
+        node.RowDefinitionCount = reader.Read();
+        reader.CheckRemaining(node.RowDefinitionCount, 8u);
+        node.RowDefinitionOffset = static_cast<uint32_t>(m_rowDefinitions.size());
+        for (uint32_t i = 0; i < node.RowDefinitionCount; ++i)
+        {
+          m_rowDefinitions.emplace_back(ReadDefinition(reader));
+        }
+
+        // Track the open subtrees so we can validate the tree and record where each subtree ends
+        node.SubtreeEnd = nodeIndex + 1u;
+        const bool hasChildren = node.ChildCount > 0u;
+        m_nodes.push_back(node);
+        if (hasChildren)
+        {
+          openNodes.push_back(OpenNode{nodeIndex, node.ChildCount});
+        }
+        while (!openNodes.empty() && openNodes.back().RemainingChildren == 0u)
+        {
+          m_nodes[openNodes.back().NodeIndex].SubtreeEnd = nodeIndex + 1u;
+          openNodes.pop_back();
+        }
+      }
+      if (!openNodes.empty())
+      {
+        throw FormatException("The document contains fewer nodes than the tree describes");
+      }
+    }
+
+    if (reader.Remaining() != 0u)
+    {
+      throw FormatException("Unexpected data at the end of the document");
+    }
+  }
+
+
+  StringViewLite UIBinaryDocument::GetClassPropertyName(const uint32_t classIndex, const uint32_t propertyId) const
+  {
+    const ClassRecord& record = m_classes.at(classIndex);
+    if (propertyId >= record.PropertyCount)
+    {
+      throw std::invalid_argument(fmt::format("Invalid property id {}", propertyId));
+    }
+    return m_strings[m_classPropertyNames[record.PropertyOffset + propertyId]];
+  }
+
+
+  ReadOnlySpan<UIBinaryThemePropertyRecord> UIBinaryDocument::GetThemeProperties(const UIBinaryNodeRecord& node) const
+  {
+    return SpanUtil::AsReadOnlySpan(m_themeProperties, node.ThemePropertyOffset, node.ThemePropertyCount);
+  }
+
+
+  ReadOnlySpan<UIBinaryPropertyRecord> UIBinaryDocument::GetProperties(const UIBinaryNodeRecord& node) const
+  {
+    return SpanUtil::AsReadOnlySpan(m_properties, node.PropertyOffset, node.PropertyCount);
+  }
+
+
+  ReadOnlySpan<GridColumnDefinition> UIBinaryDocument::GetColumnDefinitions(const UIBinaryNodeRecord& node) const
+  {
+    return SpanUtil::AsReadOnlySpan(m_columnDefinitions, node.ColumnDefinitionOffset, node.ColumnDefinitionCount);
+  }
+
+
+  ReadOnlySpan<GridRowDefinition> UIBinaryDocument::GetRowDefinitions(const UIBinaryNodeRecord& node) const
+  {
+    return SpanUtil::AsReadOnlySpan(m_rowDefinitions, node.RowDefinitionOffset, node.RowDefinitionCount);
+  }
+}
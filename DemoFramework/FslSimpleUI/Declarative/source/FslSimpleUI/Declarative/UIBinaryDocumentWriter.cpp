@@ -0,0 +1,316 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteSpanUtil_WriteLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocumentWriter.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include "UIBinaryFormat.hpp"
+
+namespace Fsl::UI::Declarative
+{
+  namespace
+  {
+    void Append(std::vector<uint8_t>& rDst, const uint32_t value)
+    {
+      const std::size_t offset = rDst.size();
+      rDst.resize(offset + 4u);
+      ByteSpanUtil::WriteUInt32LE(SpanUtil::AsSpan(rDst), offset, value);
+    }
+
+    void Append(std::vector<uint8_t>& rDst, const std::vector<GridRowColumnDefinitionBase>& definitions)
+    {
+      Append(rDst, static_cast<uint32_t>(definitions.size()));
+      for (const auto& entry : definitions)
+      {
+        Append(rDst, static_cast<uint32_t>(entry.Unit));
+        Append(rDst, std::bit_cast<uint32_t>(entry.Size));
+      }
+    }
+
+    uint32_t ToUInt32Count(const std::size_t count)
+    {
+      if (count > std::numeric_limits<uint32_t>::max())
+      {
+        throw NotSupportedException("Too many entries");
+      }
+      return static_cast<uint32_t>(count);
+    }
+  }
+
+
+  uint32_t UIBinaryDocumentWriter::AddString(const StringViewLite value)
+  {
+    const auto itrFind = m_stringLookup.find(value);
+    if (itrFind != m_stringLookup.end())
+    {
+      return itrFind->second;
+    }
+    const uint32_t index = ToUInt32Count(m_strings.size());
+    m_strings.emplace_back(value);
+    m_stringLookup.emplace(m_strings.back(), index);
+    return index;
+  }
+
+
+  uint32_t UIBinaryDocumentWriter::AddClass(const StringViewLite controlName)
+  {
+    const uint32_t nameStringIndex = AddString(controlName);
+    const auto itrFind = std::find_if(m_classes.begin(), m_classes.end(),
+                                      [nameStringIndex](const ClassRecord& record) { return record.NameStringIndex == nameStringIndex; });
+    if (itrFind != m_classes.end())
+    {
+      return static_cast<uint32_t>(std::distance(m_classes.begin(), itrFind));
+    }
+    m_classes.push_back(ClassRecord{nameStringIndex, {}});
+    return static_cast<uint32_t>(m_classes.size() - 1u);
+  }
+
+
+  uint32_t UIBinaryDocumentWriter::AddClassProperty(const uint32_t classIndex, const StringViewLite propertyName)
+  {
+    if (classIndex >= m_classes.size())
+    {
+      throw std::invalid_argument(fmt::format("Invalid class index {}", classIndex));
+    }
+    const uint32_t nameStringIndex = AddString(propertyName);
+    std::vector<uint32_t>& rProperties = m_classes[classIndex].PropertyNameStringIndices;
+    const auto itrFind = std::find(rProperties.begin(), rProperties.end(), nameStringIndex);
+    if (itrFind != rProperties.end())
+    {
+      return static_cast<uint32_t>(std::distance(rProperties.begin(), itrFind));
+    }
+    if (rProperties.size() >= UIBinaryFormat::PropertyIdMask)
+    {
+      throw NotSupportedException("Too many properties");
+    }
+    rProperties.push_back(nameStringIndex);
+    return static_cast<uint32_t>(rProperties.size() - 1u);
+  }
+
+
+  uint32_t UIBinaryDocumentWriter::BeginNode(const uint32_t classIndex)
+  {
+    if (classIndex >= m_classes.size())
+    {
+      throw std::invalid_argument(fmt::format("Invalid class index {}", classIndex));
+    }
+    if (m_openNodes.empty())
+    {
+      if (!m_nodes.empty())
+      {
+        throw UsageErrorException("A document can only contain one root node");
+      }
+    }
+    else
+    {
+      ++m_nodes[m_openNodes.back()].ChildCount;
+    }
+    const uint32_t nodeIndex = ToUInt32Count(m_nodes.size());
+    NodeRecord record;
+    record.ClassIndex = classIndex;
+    m_nodes.push_back(std::move(record));
+    m_openNodes.push_back(nodeIndex);
+    return nodeIndex;
+  }
+
+
+  void UIBinaryDocumentWriter::EndNode()
+  {
+    if (m_openNodes.empty())
+    {
+      throw UsageErrorException("No node is open");
+    }
+    m_openNodes.pop_back();
+  }
+
+
+  void UIBinaryDocumentWriter::AddThemeProperty(const StringViewLite name, const StringViewLite value)
+  {
+    NodeRecord& rNode = GetOpenNode();
+    const uint32_t nameStringIndex = AddString(name);
+    const uint32_t valueStringIndex = AddString(value);
+    rNode.ThemeProperties.emplace_back(nameStringIndex, valueStringIndex);
+  }
+
+
+  void UIBinaryDocumentWriter::AddProperty(const uint32_t propertyId, const UIBinaryValue& value)
+  {
+    NodeRecord& rNode = GetOpenNode();
+    if (propertyId >= m_classes[rNode.ClassIndex].PropertyNameStringIndices.size())
+    {
+      throw std::invalid_argument(fmt::format("Invalid property id {}", propertyId));
+    }
+    if (value.Type() == UIBinaryValueType::String && value.AsStringIndex() >= m_strings.size())
+    {
+      throw std::invalid_argument(fmt::format("Invalid string index {}", value.AsStringIndex()));
+    }
+    if (value.Type() == UIBinaryValueType::Binding)
+    {
+      if (value.BindingNodeIndex() >= m_nodes.size())
+      {
+        throw std::invalid_argument(fmt::format("Invalid binding source node {}", value.BindingNodeIndex()));
+      }
+      const ClassRecord& sourceClass = m_classes[m_nodes[value.BindingNodeIndex()].ClassIndex];
+      if (value.BindingPropertyId() >= sourceClass.PropertyNameStringIndices.size())
+      {
+        throw std::invalid_argument(fmt::format("Invalid binding source property id {}", value.BindingPropertyId()));
+      }
+    }
+    rNode.Properties.emplace_back(propertyId, value);
+  }
+
+
+  void UIBinaryDocumentWriter::SetGridColumn(const uint32_t column)
+  {
+    GetOpenNode().GridColumn = column;
+  }
+
+
+  void UIBinaryDocumentWriter::SetGridRow(const uint32_t row)
+  {
+    GetOpenNode().GridRow = row;
+  }
+
+
+  void UIBinaryDocumentWriter::AddColumnDefinition(const GridColumnDefinition& definition)
+  {
+    GetOpenNode().ColumnDefinitions.push_back(definition);
+  }
+
+
+  void UIBinaryDocumentWriter::AddRowDefinition(const GridRowDefinition& definition)
+  {
+    GetOpenNode().RowDefinitions.push_back(definition);
+  }
+
+
+  std::vector<uint8_t> UIBinaryDocumentWriter::ToBytes() const
+  {
+    if (m_nodes.empty())
+    {
+      throw UsageErrorException("The document does not contain any nodes");
+    }
+    if (!m_openNodes.empty())
+    {
+      throw UsageErrorException("All nodes must be closed");
+    }
+
+    // Calculate the string data layout (each string is zero terminated)
+    std::size_t stringDataSize = 0;
+    for (const auto& entry : m_strings)
+    {
+      stringDataSize += entry.size() + 1u;
+    }
+    stringDataSize = (stringDataSize + 3u) & ~static_cast<std::size_t>(3u);
+
+    std::vector<uint8_t> result;
+    Append(result, UIBinaryFormat::Magic);
+    Append(result, UIBinaryFormat::Version);
+    Append(result, ToUInt32Count(m_strings.size()));
+    Append(result, ToUInt32Count(m_classes.size()));
+    Append(result, ToUInt32Count(m_nodes.size()));
+    Append(result, ToUInt32Count(stringDataSize));
+
+    {    // Strings
+      uint32_t offset = 0;
+      for (const auto& entry : m_strings)
+      {
+        Append(result, offset);
+        Append(result, static_cast<uint32_t>(entry.size()));
+        offset += static_cast<uint32_t>(entry.size() + 1u);
+      }
+      const std::size_t stringDataOffset = result.size();
+      result.resize(stringDataOffset + stringDataSize, 0u);
+      auto itrDst = result.begin() + static_cast<std::ptrdiff_t>(stringDataOffset);
+      for (const auto& entry : m_strings)
+      {
+        itrDst = std::copy(entry.begin(), entry.end(), itrDst) + 1;
+      }
+    }
+
+    for (const auto& entry : m_classes)
+    {
+      Append(result, entry.NameStringIndex);
+      Append(result, static_cast<uint32_t>(entry.PropertyNameStringIndices.size()));
+      for (const uint32_t nameStringIndex : entry.PropertyNameStringIndices)
+      {
+        Append(result, nameStringIndex);
+      }
+    }
+
+    for (const auto& node : m_nodes)
+    {
+      const uint32_t flags = (node.GridColumn.has_value() ? UIBinaryFormat::NodeFlagGridColumn : 0u) |
+                             (node.GridRow.has_value() ? UIBinaryFormat::NodeFlagGridRow : 0u);
+      Append(result, node.ClassIndex);
+      Append(result, flags);
+      Append(result, node.GridColumn.value_or(0u));
+      Append(result, node.GridRow.value_or(0u));
+      Append(result, node.ChildCount);
+
+      Append(result, static_cast<uint32_t>(node.ThemeProperties.size()));
+      for (const auto& entry : node.ThemeProperties)
+      {
+        Append(result, entry.first);
+        Append(result, entry.second);
+      }
+
+      Append(result, static_cast<uint32_t>(node.Properties.size()));
+      for (const auto& entry : node.Properties)
+      {
+        Append(result, entry.PropertyId | (static_cast<uint32_t>(entry.Value.Type()) << UIBinaryFormat::PropertyTypeShift));
+        for (uint32_t i = 0; i < entry.Value.WordCount(); ++i)
+        {
+          Append(result, entry.Value.Word(i));
+        }
+      }
+
+      Append(result, node.ColumnDefinitions);
+      Append(result, node.RowDefinitions);
+    }
+    return result;
+  }
+
+
+  UIBinaryDocumentWriter::NodeRecord& UIBinaryDocumentWriter::GetOpenNode()
+  {
+    if (m_openNodes.empty())
+    {
+      throw UsageErrorException("No node is open");
+    }
+    return m_nodes[m_openNodes.back()];
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UIBINARYFORMAT_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UIBINARYFORMAT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::UI::Declarative::UIBinaryFormat
+{
+  // All values are stored as little endian uint32_t words
+  //
+  // Header
+  //   uint32_t Magic
+  //   uint32_t Version
+  //   uint32_t StringCount
+  //   uint32_t ClassCount
+  //   uint32_t NodeCount
+  //   uint32_t StringDataSize (in bytes, a multiple of four)
+  // String entries (StringCount)
+  //   uint32_t Offset (relative to the string data)
+  //   uint32_t Length (excluding the zero terminator)
+  // String data (UTF8, each string is zero terminated)
+  // Class entries (ClassCount)
+  //   uint32_t NameStringIndex
+  //   uint32_t PropertyCount
+  //   uint32_t PropertyNameStringIndex[PropertyCount] (the index in this list is the property id)
+  // Node entries (NodeCount, stored depth first in pre-order so the first node is the root)
+  //   uint32_t ClassIndex
+  //   uint32_t Flags
+  //   uint32_t GridColumn
+  //   uint32_t GridRow
+  //   uint32_t ChildCount
+  //   uint32_t ThemePropertyCount
+  //     uint32_t NameStringIndex
+  //     uint32_t ValueStringIndex
+  //   uint32_t PropertyCount
+  //     uint32_t PropertyId | (ValueType << PropertyTypeShift)
+  //     uint32_t Value[UIBinaryValue::GetWordCount(ValueType)]
+  //   uint32_t ColumnDefinitionCount
+  //     uint32_t GridUnitType
+  //     float    Size
+  //   uint32_t RowDefinitionCount
+  //     uint32_t GridUnitType
+  //     float    Size
+
+  // 'FUIB'
+  constexpr uint32_t Magic = 0x42495546;
+  constexpr uint32_t Version = 1;
+
+  constexpr uint32_t HeaderWords = 6;
+
+  constexpr uint32_t NodeFlagGridColumn = 0x01;
+  constexpr uint32_t NodeFlagGridRow = 0x02;
+
+  constexpr uint32_t PropertyTypeShift = 24;
+  constexpr uint32_t PropertyIdMask = (1u << PropertyTypeShift) - 1u;
+}
+
+#endif
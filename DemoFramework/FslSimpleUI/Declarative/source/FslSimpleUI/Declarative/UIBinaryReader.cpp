@@ -0,0 +1,420 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Log/String/FmtStringViewLite.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Base/Control/ContentControl.hpp>
+#include <FslSimpleUI/Base/Layout/GridLayout.hpp>
+#include <FslSimpleUI/Base/Layout/Layout.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/PropertyRecord.hpp>
+#include <FslSimpleUI/Declarative/RadioGroupManager.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocument.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryReader.hpp>
+#include <algorithm>
+#include <optional>
+#include <typeindex>
+#include <utility>
+#include <vector>
+#include "PropertySetter.hpp"
+
+namespace Fsl::UI::Declarative::UIBinaryReader
+{
+  namespace
+  {
+    struct ClassRecord
+    {
+      bool Resolved{false};
+      std::optional<uint32_t> ControlId;
+      bool PropertiesResolved{false};
+      DataBinding::DependencyPropertyDefinitionVector Definitions;
+      //! Maps the property ids of the class to the property definitions of the control (nullptr if the control does not have the property)
+      std::vector<const DataBinding::DependencyPropertyDefinition*> Properties;
+    };
+
+
+    class Instantiator
+    {
+      ControlFactory& m_controlFactory;
+      RadioGroupManager& m_radioGroupManager;
+      const std::shared_ptr<DataBinding::DataBindingService>& m_dataBinding;
+      const UIBinaryDocument& m_document;
+      std::vector<ClassRecord> m_classes;
+      //! The created controls indexed by node index (used by the pre-linked bindings)
+      std::vector<std::shared_ptr<UI::BaseWindow>> m_nodes;
+      //! One value source per property that is set on a node, this allows us to set all values of a node with one ExecuteChanges call
+      std::vector<std::unique_ptr<Internal::PropertySetter>> m_valueSources;
+      std::vector<PropertyParserRecord> m_themePropertyScratchpad;
+      std::vector<const DataBinding::DependencyPropertyDefinition*> m_boundScratchpad;
+
+    public:
+      Instantiator(ControlFactory& controlFactory, RadioGroupManager& radioGroupManager,
+                   const std::shared_ptr<DataBinding::DataBindingService>& dataBinding, const UIBinaryDocument& document)
+        : m_controlFactory(controlFactory)
+        , m_radioGroupManager(radioGroupManager)
+        , m_dataBinding(dataBinding)
+        , m_document(document)
+        , m_classes(document.ClassCount())
+        , m_nodes(document.NodeCount())
+      {
+      }
+
+      std::shared_ptr<UI::BaseWindow> TryCreateNode(const uint32_t nodeIndex)
+      {
+        const UIBinaryNodeRecord& node = m_document.GetNode(nodeIndex);
+        ClassRecord& rClass = m_classes[node.ClassIndex];
+        if (!rClass.Resolved)
+        {
+          rClass.ControlId = m_controlFactory.TryGetControlId(m_document.GetControlName(node.ClassIndex));
+          rClass.Resolved = true;
+        }
+        if (!rClass.ControlId.has_value())
+        {
+          FSLLOG3_ERROR("Could not create a control for class: '{}'", m_document.GetControlName(node.ClassIndex));
+          return {};
+        }
+
+        auto current = TryCreateControl(rClass.ControlId.value(), m_document.GetThemeProperties(node));
+        if (!current)
+        {
+          FSLLOG3_ERROR("Could not create a control for class: '{}'", m_document.GetControlName(node.ClassIndex));
+          return {};
+        }
+        m_nodes[nodeIndex] = current;
+
+        if (!rClass.PropertiesResolved)
+        {
+          ResolveProperties(rClass, node.ClassIndex, *current);
+        }
+        ApplyProperties(*current, rClass, m_document.GetProperties(node));
+        current->FinishAnimation();
+
+        auto* const pLayout = dynamic_cast<UI::Layout*>(current.get());
+        auto* const pGrid = pLayout != nullptr ? dynamic_cast<UI::GridLayout*>(pLayout) : nullptr;
+        if (pGrid != nullptr)
+        {
+          for (const auto& definition : m_document.GetColumnDefinitions(node))
+          {
+            pGrid->AddColumnDefinition(definition);
+          }
+          for (const auto& definition : m_document.GetRowDefinitions(node))
+          {
+            pGrid->AddRowDefinition(definition);
+          }
+        }
+        else if (node.ColumnDefinitionCount > 0u || node.RowDefinitionCount > 0u)
+        {
+          FSLLOG3_ERROR("Ignoring grid definitions as the node is not a grid");
+        }
+
+        if (node.ChildCount > 0u)
+        {
+          auto* const pContentControl = pLayout == nullptr ? dynamic_cast<UI::ContentControl*>(current.get()) : nullptr;
+          uint32_t childIndex = nodeIndex + 1u;
+          for (uint32_t i = 0; i < node.ChildCount; ++i)
+          {
+            const UIBinaryNodeRecord& childNode = m_document.GetNode(childIndex);
+            auto childControl = TryCreateNode(childIndex);
+            if (childControl)
+            {
+              if (pLayout != nullptr)
+              {
+                pLayout->AddChild(childControl);
+                if (pGrid != nullptr)
+                {
+                  if (childNode.GridColumn.has_value())
+                  {
+                    pGrid->SetColumn(childControl, childNode.GridColumn.value());
+                  }
+                  if (childNode.GridRow.has_value())
+                  {
+                    pGrid->SetRow(childControl, childNode.GridRow.value());
+                  }
+                  current->FinishAnimation();
+                }
+              }
+              else if (pContentControl != nullptr)
+              {
+                pContentControl->SetContent(childControl);
+              }
+              else
+              {
+                FSLLOG3_ERROR("Ignoring child as node is not a container");
+              }
+            }
+            childIndex = childNode.SubtreeEnd;
+          }
+        }
+        return current;
+      }
+
+    private:
+      std::shared_ptr<UI::BaseWindow> TryCreateControl(const uint32_t controlId, const ReadOnlySpan<UIBinaryThemePropertyRecord> themeProperties)
+      {
+        m_themePropertyScratchpad.clear();
+        for (const auto& entry : themeProperties)
+        {
+          m_themePropertyScratchpad.emplace_back(entry.Name, entry.Value);
+        }
+        auto control = m_controlFactory.TryCreate(m_radioGroupManager, controlId, SpanUtil::AsSpan(m_themePropertyScratchpad));
+        for (const auto& entry : m_themePropertyScratchpad)
+        {
+          if (!entry.Claimed)
+          {
+            FSLLOG3_ERROR("Unknown property: '{}'='{}'", entry.Name, entry.Value);
+          }
+        }
+        return control;
+      }
+
+
+      void ResolveProperties(ClassRecord& rClass, const uint32_t classIndex, UI::BaseWindow& window)
+      {
+        window.ExtractProperties(rClass.Definitions);
+        const uint32_t propertyCount = m_document.GetClassPropertyCount(classIndex);
+        rClass.Properties.resize(propertyCount, nullptr);
+        for (uint32_t propertyId = 0; propertyId < propertyCount; ++propertyId)
+        {
+          const StringViewLite name = m_document.GetClassPropertyName(classIndex, propertyId);
+          const auto itrFind = std::find_if(rClass.Definitions.begin(), rClass.Definitions.end(),
+                                            [name](const DataBinding::DependencyPropertyDefinition& def) { return def.Name() == name; });
+          if (itrFind != rClass.Definitions.end())
+          {
+            rClass.Properties[propertyId] = &(*itrFind);
+          }
+        }
+        rClass.PropertiesResolved = true;
+      }
+
+
+      void ApplyProperties(UI::BaseWindow& window, const ClassRecord& nodeClass, const ReadOnlySpan<UIBinaryPropertyRecord> properties)
+      {
+        m_boundScratchpad.clear();
+        for (const auto& entry : properties)
+        {
+          const DataBinding::DependencyPropertyDefinition* const pTargetDef = nodeClass.Properties[entry.PropertyId];
+          if (pTargetDef == nullptr)
+          {
+            FSLLOG3_ERROR("Unknown property id: {}", entry.PropertyId);
+            continue;
+          }
+          if (entry.Value.Type() == UIBinaryValueType::Binding)
+          {
+            ApplyBinding(window, *pTargetDef, entry.Value);
+            continue;
+          }
+
+          const std::size_t sourceIndex = m_boundScratchpad.size();
+          if (sourceIndex >= m_valueSources.size())
+          {
+            m_valueSources.push_back(std::make_unique<Internal::PropertySetter>(m_dataBinding));
+          }
+          Internal::PropertySetter& rValueSource = *m_valueSources[sourceIndex];
+          const DataBinding::DependencyPropertyDefinition* const pSourceDef = TrySetValue(rValueSource, pTargetDef->Type(), entry.Value);
+          if (pSourceDef == nullptr)
+          {
+            FSLLOG3_ERROR("The stored value type does not match the property '{}'", pTargetDef->Name());
+            continue;
+          }
+          window.SetBinding(*pTargetDef, rValueSource.GetPropertyHandle(*pSourceDef));
+          m_boundScratchpad.push_back(pTargetDef);
+        }
+
+        if (!m_boundScratchpad.empty())
+        {
+          // Propagate all values of the node at once, then release the bindings so the values stay as set
+          m_dataBinding->ExecuteChanges();
+          for (const auto* pTargetDef : m_boundScratchpad)
+          {
+            window.ClearBinding(*pTargetDef);
+          }
+          m_dataBinding->ExecuteChanges();
+        }
+      }
+
+
+      void ApplyBinding(UI::BaseWindow& window, const DataBinding::DependencyPropertyDefinition& targetDef, const UIBinaryValue& value)
+      {
+        const uint32_t sourceNodeIndex = value.BindingNodeIndex();
+        const std::shared_ptr<UI::BaseWindow>& sourceControl = m_nodes[sourceNodeIndex];
+        if (!sourceControl)
+        {
+          FSLLOG3_ERROR("The binding source control was not created");
+          return;
+        }
+        const ClassRecord& sourceClass = m_classes[m_document.GetNode(sourceNodeIndex).ClassIndex];
+        const DataBinding::DependencyPropertyDefinition* const pSourceDef = sourceClass.Properties[value.BindingPropertyId()];
+        if (pSourceDef == nullptr)
+        {
+          FSLLOG3_ERROR("Could not find the binding source property");
+          return;
+        }
+        window.SetBinding(targetDef, sourceControl->GetPropertyHandle(*pSourceDef));
+      }
+
+
+      const DataBinding::DependencyPropertyDefinition* TrySetValue(Internal::PropertySetter& rValueSource, const std::type_index targetType,
+                                                                   const UIBinaryValue& value)
+      {
+        using PropertySetter = Internal::PropertySetter;
+        switch (value.Type())
+        {
+        case UIBinaryValueType::String:
+          if (targetType != typeid(StringViewLite))
+          {
+            return nullptr;
+          }
+          rValueSource.SetStringView(m_document.GetString(value.AsStringIndex()));
+          return &PropertySetter::PropertyStringView;
+        case UIBinaryValueType::Bool:
+          if (targetType != typeid(bool))
+          {
+            return nullptr;
+          }
+          rValueSource.SetBool(value.AsBool());
+          return &PropertySetter::PropertyBool;
+        case UIBinaryValueType::UInt8:
+          if (targetType != typeid(uint8_t))
+          {
+            return nullptr;
+          }
+          rValueSource.SetUInt8(value.AsUInt8());
+          return &PropertySetter::PropertyUInt8;
+        case UIBinaryValueType::Int32:
+          if (targetType != typeid(int32_t))
+          {
+            return nullptr;
+          }
+          rValueSource.SetInt32(value.AsInt32());
+          return &PropertySetter::PropertyInt32;
+        case UIBinaryValueType::UInt32:
+          if (targetType != typeid(uint32_t))
+          {
+            return nullptr;
+          }
+          rValueSource.SetUInt32(value.AsUInt32());
+          return &PropertySetter::PropertyUInt32;
+        case UIBinaryValueType::DpSize1D:
+          if (targetType != typeid(DpSize1D))
+          {
+            return nullptr;
+          }
+          rValueSource.SetDpSize1D(value.AsDpSize1D());
+          return &PropertySetter::PropertyDpSize1D;
+        case UIBinaryValueType::DpSize1DF:
+          if (targetType != typeid(DpSize1DF))
+          {
+            return nullptr;
+          }
+          rValueSource.SetDpSize1DF(value.AsDpSize1DF());
+          return &PropertySetter::PropertyDpSize1DF;
+        case UIBinaryValueType::DpThicknessF:
+          if (targetType != typeid(DpThicknessF))
+          {
+            return nullptr;
+          }
+          rValueSource.SetDpThicknessF(value.AsDpThicknessF());
+          return &PropertySetter::PropertyDpThicknessF;
+        case UIBinaryValueType::DpLayoutSize1D:
+          if (targetType != typeid(UI::DpLayoutSize1D))
+          {
+            return nullptr;
+          }
+          rValueSource.SetDpLayoutSize1D(value.AsDpLayoutSize1D());
+          return &PropertySetter::PropertyDpLayoutSize1D;
+        case UIBinaryValueType::ItemAlignment:
+          if (targetType != typeid(UI::ItemAlignment))
+          {
+            return nullptr;
+          }
+          rValueSource.SetItemAlignment(value.AsItemAlignment());
+          return &PropertySetter::PropertyItemAlignment;
+        case UIBinaryValueType::LayoutOrientation:
+          if (targetType != typeid(UI::LayoutOrientation))
+          {
+            return nullptr;
+          }
+          rValueSource.SetOrientation(value.AsLayoutOrientation());
+          return &PropertySetter::PropertyLayoutOrientation;
+        case UIBinaryValueType::ScrollModeFlags:
+          if (targetType != typeid(UI::ScrollModeFlags))
+          {
+            return nullptr;
+          }
+          rValueSource.SetScrollModeFlags(value.AsScrollModeFlags());
+          return &PropertySetter::PropertyScrollModeFlags;
+        case UIBinaryValueType::TransitionType:
+          if (targetType != typeid(TransitionType))
+          {
+            return nullptr;
+          }
+          rValueSource.SetTransitionType(value.AsTransitionType());
+          return &PropertySetter::PropertyTransitionType;
+        default:
+          return nullptr;
+        }
+      }
+    };
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> Load(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                       const ReadOnlySpan<uint8_t> content)
+  {
+    const UIBinaryDocument document(content);
+    RadioGroupManager radioGroupManager;
+
+    Instantiator instantiator(controlFactory, radioGroupManager, dataBinding, document);
+    auto main = instantiator.TryCreateNode(0);
+    if (!main)
+    {
+      // Match the xml reader and fall back to a empty label
+      std::vector<PropertyRecord> propertyRecords;
+      main = controlFactory.TryCreate(radioGroupManager, "Label", propertyRecords);
+    }
+    return main;
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> Load(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                       const IO::Path& filename)
+  {
+    const std::vector<uint8_t> content = IO::File::ReadAllBytes(filename);
+    return Load(controlFactory, dataBinding, SpanUtil::AsReadOnlySpan(content));
+  }
+}
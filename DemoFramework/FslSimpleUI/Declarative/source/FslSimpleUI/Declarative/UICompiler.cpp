@@ -0,0 +1,424 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/String/FmtStringViewLite.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/String/StringParseUtil.hpp>
+#include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/ControlType.hpp>
+#include <FslSimpleUI/Declarative/ThemeProperties/ParseHelper.hpp>
+#include <FslSimpleUI/Declarative/UIBinaryDocumentWriter.hpp>
+#include <FslSimpleUI/Declarative/UICompiler.hpp>
+#include <fmt/format.h>
+#include <pugixml.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include "PropertyValueConverter.hpp"
+
+namespace Fsl::UI::Declarative::UICompiler
+{
+  namespace
+  {
+    template <typename T>
+    T ParseEnum(const std::optional<T>& value, const char* const pszTypeName, const StringViewLite strValue)
+    {
+      if (!value.has_value())
+      {
+        throw FormatException(fmt::format("Unsupported {} value: '{}'", pszTypeName, strValue));
+      }
+      return value.value();
+    }
+
+
+    struct ClassInfo
+    {
+      uint32_t ClassIndex{0};
+      ControlType Type{ControlType::Normal};
+      std::vector<std::string> ThemePropertyNames;
+      DataBinding::DependencyPropertyDefinitionVector Properties;
+
+      const DataBinding::DependencyPropertyDefinition* TryFindProperty(const StringViewLite name) const
+      {
+        const auto itrFind = std::find_if(Properties.begin(), Properties.end(),
+                                          [name](const DataBinding::DependencyPropertyDefinition& def) { return def.Name() == name; });
+        return itrFind != Properties.end() ? &(*itrFind) : nullptr;
+      }
+    };
+
+
+    class Compiler
+    {
+      ControlFactory& m_controlFactory;
+      UIBinaryDocumentWriter m_writer;
+      std::map<std::string, ClassInfo, std::less<>> m_classes;
+      //! The class of each node in the order they were added (used to resolve bindings)
+      std::vector<const ClassInfo*> m_nodeClasses;
+      std::map<std::string, uint32_t, std::less<>> m_namedNodes;
+
+      std::array<char, 256> m_scratchpad{};
+
+    public:
+      explicit Compiler(ControlFactory& controlFactory)
+        : m_controlFactory(controlFactory)
+      {
+      }
+
+      std::vector<uint8_t> Compile(const pugi::xml_document& doc)
+      {
+        pugi::xml_node root = doc.child("DeclarativeUITest");
+        if (!root)
+        {
+          throw FormatException("RootNode not found");
+        }
+        if (std::distance(root.children().begin(), root.children().end()) != 1u)
+        {
+          throw FormatException("Root node did not contain the expected amount of children");
+        }
+        ProcessNode(*root.children().begin(), false);
+        return m_writer.ToBytes();
+      }
+
+    private:
+      const ClassInfo& GetClassInfo(const StringViewLite className)
+      {
+        const auto itrFind = m_classes.find(className);
+        if (itrFind != m_classes.end())
+        {
+          return itrFind->second;
+        }
+        if (!m_controlFactory.TryGetControlId(className).has_value())
+        {
+          throw FormatException(fmt::format("Unknown control: '{}'", className));
+        }
+
+        const ControlName controlName(className);
+        ClassInfo info;
+        info.ClassIndex = m_writer.AddClass(className);
+        info.Type = m_controlFactory.GetControlType(controlName);
+        for (const auto& entry : m_controlFactory.GetControlThemeProperties(controlName))
+        {
+          info.ThemePropertyNames.push_back(entry.Property->GetName().AsString());
+        }
+        info.Properties = m_controlFactory.GetControlProperties(controlName);
+        return m_classes.emplace(std::string(className), std::move(info)).first->second;
+      }
+
+
+      void ProcessNode(const pugi::xml_node node, const bool parentIsGrid)
+      {
+        const StringViewLite className(node.name());
+        const ClassInfo& classInfo = GetClassInfo(className);
+        const uint32_t nodeIndex = m_writer.BeginNode(classInfo.ClassIndex);
+        m_nodeClasses.push_back(&classInfo);
+
+        for (pugi::xml_attribute attr : node.attributes())
+        {
+          ProcessAttribute(classInfo, nodeIndex, StringViewLite(attr.name()), StringViewLite(attr.value()), parentIsGrid);
+        }
+
+        switch (classInfo.Type)
+        {
+        case ControlType::Layout:
+          {
+            const bool isGrid = className == "GridLayout";
+            for (pugi::xml_node child : node.children())
+            {
+              if (!isGrid || !TryProcessGridDefinitions(child))
+              {
+                ProcessNode(child, isGrid);
+              }
+            }
+            break;
+          }
+        case ControlType::Content:
+          {
+            const auto childCount = std::distance(node.children().begin(), node.children().end());
+            if (childCount > 1)
+            {
+              throw FormatException(fmt::format("The content control '{}' can only contain one child", className));
+            }
+            if (childCount == 1)
+            {
+              ProcessNode(*node.children().begin(), false);
+            }
+            break;
+          }
+        default:
+          if (node.first_child())
+          {
+            throw FormatException(fmt::format("The control '{}' can not contain children", className));
+          }
+          break;
+        }
+        m_writer.EndNode();
+      }
+
+
+      void ProcessAttribute(const ClassInfo& classInfo, const uint32_t nodeIndex, const StringViewLite name, const StringViewLite value,
+                            const bool parentIsGrid)
+      {
+        if (std::find(classInfo.ThemePropertyNames.begin(), classInfo.ThemePropertyNames.end(), name) != classInfo.ThemePropertyNames.end())
+        {
+          // Theme properties are parsed by the control factory when the control is created
+          m_writer.AddThemeProperty(name, value);
+          return;
+        }
+
+        const DataBinding::DependencyPropertyDefinition* const pProperty = classInfo.TryFindProperty(name);
+        if (pProperty != nullptr)
+        {
+          const uint32_t propertyId = m_writer.AddClassProperty(classInfo.ClassIndex, name);
+          const bool isBinding = value.starts_with("{Binding") && value.ends_with("}");
+          m_writer.AddProperty(propertyId, isBinding ? ResolveBinding(value) : ParseValue(*pProperty, value));
+        }
+        else if (parentIsGrid && name == "GridLayout.Column")
+        {
+          uint32_t index{};
+          StringParseUtil::Parse(index, value);
+          m_writer.SetGridColumn(index);
+        }
+        else if (parentIsGrid && name == "GridLayout.Row")
+        {
+          uint32_t index{};
+          StringParseUtil::Parse(index, value);
+          m_writer.SetGridRow(index);
+        }
+        else if (name == "Name")
+        {
+          if (!m_namedNodes.emplace(std::string(value), nodeIndex).second)
+          {
+            throw FormatException(fmt::format("A control with that name already exist '{}'", value));
+          }
+        }
+        else
+        {
+          throw FormatException(fmt::format("Unknown property: '{}'='{}'", name, value));
+        }
+      }
+
+
+      bool TryProcessGridDefinitions(const pugi::xml_node node)
+      {
+        const StringViewLite name(node.name());
+        if (name == "GridLayout.ColumnDefinitions")
+        {
+          for (pugi::xml_node child : node.children("GridColumnDefinition"))
+          {
+            for (pugi::xml_attribute attr : child.attributes())
+            {
+              const StringViewLite attrName(attr.name());
+              if (attrName != "Width")
+              {
+                throw FormatException(fmt::format("Unknown attribute: '{}'", attrName));
+              }
+              const auto result = Internal::PropertyValueConverter::TryParseGridColumnDefinition(StringViewLite(attr.value()));
+              if (!result.has_value())
+              {
+                throw FormatException(fmt::format("Failed to parse GridColumnDefinition: '{}'", attr.value()));
+              }
+              m_writer.AddColumnDefinition(result.value());
+            }
+          }
+          return true;
+        }
+        if (name == "GridLayout.RowDefinitions")
+        {
+          for (pugi::xml_node child : node.children("GridRowDefinition"))
+          {
+            for (pugi::xml_attribute attr : child.attributes())
+            {
+              const StringViewLite attrName(attr.name());
+              if (attrName != "Height")
+              {
+                throw FormatException(fmt::format("Unknown attribute: '{}'", attrName));
+              }
+              const auto result = Internal::PropertyValueConverter::TryParseGridRowDefinition(StringViewLite(attr.value()));
+              if (!result.has_value())
+              {
+                throw FormatException(fmt::format("Failed to parse GridRowDefinition: '{}'", attr.value()));
+              }
+              m_writer.AddRowDefinition(result.value());
+            }
+          }
+          return true;
+        }
+        return false;
+      }
+
+
+      //! Pre-link the binding to the source node and property
+      UIBinaryValue ResolveBinding(const StringViewLite strValue)
+      {
+        // Expected string format {Binding ElementName=,Path=}
+        auto res = strValue.substr(9);
+        res = res.substr(0, res.size() - 1);
+
+        const auto splitIndex = res.find(',');
+        auto elementName = res.substr(0, splitIndex < res.size() ? splitIndex : res.size());
+        auto path = splitIndex < res.size() ? res.substr(splitIndex + 1) : StringViewLite();
+        //                            123456789012
+        if (!elementName.starts_with("ElementName=") || !path.starts_with("Path="))
+        {
+          throw FormatException(fmt::format("Unsupported binding: '{}'", strValue));
+        }
+        elementName = elementName.substr(12);
+        path = path.substr(5);
+
+        const auto itrFind = m_namedNodes.find(elementName);
+        if (itrFind == m_namedNodes.end())
+        {
+          throw FormatException(fmt::format("Could not find a named control called: '{}'", elementName));
+        }
+        const uint32_t sourceNodeIndex = itrFind->second;
+        const ClassInfo& sourceClass = *m_nodeClasses[sourceNodeIndex];
+        if (sourceClass.TryFindProperty(path) == nullptr)
+        {
+          throw FormatException(fmt::format("Could not find a src property called: '{}'", path));
+        }
+        return UIBinaryValue::CreateBinding(sourceNodeIndex, m_writer.AddClassProperty(sourceClass.ClassIndex, path));
+      }
+
+
+      UIBinaryValue ParseValue(const DataBinding::DependencyPropertyDefinition& propertyDef, const StringViewLite strValue)
+      {
+        const auto setType = propertyDef.Type();
+        if (setType == typeid(StringViewLite))
+        {
+          return UIBinaryValue::CreateString(m_writer.AddString(strValue));
+        }
+        if (setType == typeid(bool))
+        {
+          bool value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateBool(value);
+        }
+        if (setType == typeid(uint8_t))
+        {
+          uint8_t value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateUInt8(value);
+        }
+        if (setType == typeid(int32_t))
+        {
+          int32_t value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateInt32(value);
+        }
+        if (setType == typeid(uint32_t))
+        {
+          uint32_t value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateUInt32(value);
+        }
+        if (setType == typeid(DpSize1D))
+        {
+          int32_t value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateDpSize1D(DpSize1D::Create(value));
+        }
+        if (setType == typeid(DpSize1DF))
+        {
+          float value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateDpSize1DF(DpSize1DF::Create(value));
+        }
+        if (setType == typeid(DpThicknessF))
+        {
+          std::array<float, 4> value{};
+          StringParseUtil::ParseArray(SpanUtil::AsSpan(value), ParseHelper::WrapAsArray(m_scratchpad, strValue));
+          return UIBinaryValue::CreateDpThicknessF(DpThicknessF::Create(value[0], value[1], value[2], value[3]));
+        }
+        if (setType == typeid(UI::DpLayoutSize1D))
+        {
+          float value{};
+          StringParseUtil::Parse(value, strValue);
+          return UIBinaryValue::CreateDpLayoutSize1D(UI::DpLayoutSize1D::Create(value));
+        }
+        if (setType == typeid(UI::ItemAlignment))
+        {
+          return UIBinaryValue::CreateItemAlignment(
+            ParseEnum(Internal::PropertyValueConverter::TryToItemAlignment(strValue), "ItemAlignment", strValue));
+        }
+        if (setType == typeid(UI::LayoutOrientation))
+        {
+          return UIBinaryValue::CreateLayoutOrientation(
+            ParseEnum(Internal::PropertyValueConverter::TryToLayoutOrientation(strValue), "LayoutOrientation", strValue));
+        }
+        if (setType == typeid(UI::ScrollModeFlags))
+        {
+          return UIBinaryValue::CreateScrollModeFlags(
+            ParseEnum(Internal::PropertyValueConverter::TryToScrollModeFlags(strValue), "ScrollModeFlags", strValue));
+        }
+        if (setType == typeid(TransitionType))
+        {
+          return UIBinaryValue::CreateTransitionType(
+            ParseEnum(Internal::PropertyValueConverter::TryToTransitionType(strValue), "TransitionType", strValue));
+        }
+        throw NotSupportedException(fmt::format("Unknown property value type: '{}'", propertyDef.Type().name()));
+      }
+    };
+  }
+
+
+  std::vector<uint8_t> Compile(ControlFactory& controlFactory, const IO::Path& filename)
+  {
+    pugi::xml_document doc;
+    const pugi::xml_parse_result result = doc.load_file(filename.AsUTF8String().AsString().c_str());
+    if (!result)
+    {
+      throw FormatException(fmt::format("Failed to parse '{}': {}", filename.AsUTF8String().AsString(), result.description()));
+    }
+    Compiler compiler(controlFactory);
+    return compiler.Compile(doc);
+  }
+
+
+  std::vector<uint8_t> CompileFromString(ControlFactory& controlFactory, const StringViewLite content)
+  {
+    pugi::xml_document doc;
+    const pugi::xml_parse_result result = doc.load_buffer(content.data(), content.size());
+    if (!result)
+    {
+      throw FormatException(fmt::format("Failed to parse xml: {}", result.description()));
+    }
+    Compiler compiler(controlFactory);
+    return compiler.Compile(doc);
+  }
+}
@@ -40,11 +40,8 @@
 #include <FslBase/String/StringParseUtil.hpp>
 #include <FslDataBinding/Base/DataBindingService.hpp>
 #include <FslDataBinding/Base/Exceptions.hpp>
-#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
 #include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
 #include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
-#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
-#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
 #include <FslSimpleUI/Base/BaseWindow.hpp>
 #include <FslSimpleUI/Base/Control/ContentControl.hpp>
 #include <FslSimpleUI/Base/Control/ScrollModeFlags.hpp>
@@ -53,7 +50,6 @@
 #include <FslSimpleUI/Base/Layout/GridLayout.hpp>
 #include <FslSimpleUI/Base/Layout/Layout.hpp>
 #include <FslSimpleUI/Base/Layout/LayoutOrientation.hpp>
-#include <FslSimpleUI/Base/LayoutDirection.hpp>
 #include <FslSimpleUI/Declarative/ControlFactory.hpp>
 #include <FslSimpleUI/Declarative/ControlInfoUtil.hpp>
 #include <FslSimpleUI/Declarative/PropertyName.hpp>
@@ -68,281 +64,19 @@
 #include <optional>
 #include <stack>
 #include <utility>
+#include "PropertySetter.hpp"
+#include "PropertyValueConverter.hpp"
 
 namespace Fsl::UI::Declarative::UIReader
 {
   namespace
   {
-
-    class PropertySetter final : public DataBinding::DependencyObject
-    {
-      DataBinding::TypedDependencyProperty<bool> m_propertyBool;
-      DataBinding::TypedDependencyProperty<uint8_t> m_propertyUInt8;
-      DataBinding::TypedDependencyProperty<int32_t> m_propertyInt32;
-      DataBinding::TypedDependencyProperty<uint32_t> m_propertyUInt32;
-      DataBinding::TypedDependencyProperty<DpSize1D> m_propertyDpSize1D;
-      DataBinding::TypedDependencyProperty<DpSize1DF> m_propertyDpSize1DF;
-      DataBinding::TypedDependencyProperty<DpThicknessF> m_propertyDpThicknessF;
-      DataBinding::TypedDependencyProperty<UI::DpLayoutSize1D> m_propertyDpLayoutSize1D;
-      DataBinding::TypedDependencyProperty<UI::ItemAlignment> m_propertyItemAlignment;
-      DataBinding::TypedDependencyProperty<UI::LayoutOrientation> m_propertyLayoutOrientation;
-      DataBinding::TypedDependencyProperty<UI::ScrollModeFlags> m_propertyScrollModeFlags;
-      DataBinding::TypedDependencyProperty<TransitionType> m_propertyTransitionType;
-      DataBinding::TypedDependencyProperty<StringViewLite> m_propertyStringView;
-
-    public:
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyBool;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyUInt8;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyInt32;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyUInt32;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyDpSize1D;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyDpSize1DF;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyDpThicknessF;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyDpLayoutSize1D;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyItemAlignment;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyLayoutOrientation;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyScrollModeFlags;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyTransitionType;
-      // NOLINTNEXTLINE(readability-identifier-naming)
-      static DataBinding::DependencyPropertyDefinition PropertyStringView;
-
-      explicit PropertySetter(std::shared_ptr<DataBinding::DataBindingService> dataBinding)
-        : DataBinding::DependencyObject(std::move(dataBinding))
-      {
-      }
-
-      bool GetBool() const noexcept
-      {
-        return m_propertyBool.Get();
-      }
-
-      bool SetBool(const bool value)
-      {
-        return m_propertyBool.Set(ThisDependencyObject(), value);
-      }
-
-      uint8_t GetUInt8() const noexcept
-      {
-        return m_propertyUInt8.Get();
-      }
-
-      bool SetUInt8(const uint8_t value)
-      {
-        return m_propertyUInt8.Set(ThisDependencyObject(), value);
-      }
-
-      int32_t GetInt32() const noexcept
-      {
-        return m_propertyInt32.Get();
-      }
-
-      bool SetInt32(const int32_t value)
-      {
-        return m_propertyInt32.Set(ThisDependencyObject(), value);
-      }
-
-      uint32_t GetUInt32() const noexcept
-      {
-        return m_propertyUInt32.Get();
-      }
-
-      bool SetUInt32(const uint32_t value)
-      {
-        return m_propertyUInt32.Set(ThisDependencyObject(), value);
-      }
-
-      DpSize1D GetDpSize1D() const noexcept
-      {
-        return m_propertyDpSize1D.Get();
-      }
-
-      bool SetDpSize1D(const DpSize1D value)
-      {
-        return m_propertyDpSize1D.Set(ThisDependencyObject(), value);
-      }
-
-      DpSize1DF GetDpSize1DF() const noexcept
-      {
-        return m_propertyDpSize1DF.Get();
-      }
-
-      bool SetDpSize1DF(const DpSize1DF value)
-      {
-        return m_propertyDpSize1DF.Set(ThisDependencyObject(), value);
-      }
-
-      DpThicknessF GetDpThicknessF() const noexcept
-      {
-        return m_propertyDpThicknessF.Get();
-      }
-
-      bool SetDpThicknessF(const DpThicknessF value)
-      {
-        return m_propertyDpThicknessF.Set(ThisDependencyObject(), value);
-      }
-
-      DpLayoutSize1D GetDpLayoutSize1D() const noexcept
-      {
-        return m_propertyDpLayoutSize1D.Get();
-      }
-
-      bool SetDpLayoutSize1D(const DpLayoutSize1D value)
-      {
-        return m_propertyDpLayoutSize1D.Set(ThisDependencyObject(), value);
-      }
-
-      UI::ItemAlignment GetItemAlignment() const noexcept
-      {
-        return m_propertyItemAlignment.Get();
-      }
-
-      bool SetItemAlignment(const UI::ItemAlignment value)
-      {
-        return m_propertyItemAlignment.Set(ThisDependencyObject(), value);
-      }
-
-      UI::LayoutOrientation GetLayoutOrientation() const noexcept
-      {
-        return m_propertyLayoutOrientation.Get();
-      }
-
-      bool SetOrientation(const UI::LayoutOrientation value)
-      {
-        return m_propertyLayoutOrientation.Set(ThisDependencyObject(), value);
-      }
-
-      UI::ScrollModeFlags GetScrollModeFlags() const noexcept
-      {
-        return m_propertyScrollModeFlags.Get();
-      }
-
-      bool SetScrollModeFlags(const UI::ScrollModeFlags value)
-      {
-        return m_propertyScrollModeFlags.Set(ThisDependencyObject(), value);
-      }
-
-      TransitionType GetTransitionType() const noexcept
-      {
-        return m_propertyTransitionType.Get();
-      }
-
-      bool SetTransitionType(const TransitionType value)
-      {
-        return m_propertyTransitionType.Set(ThisDependencyObject(), value);
-      }
-
-      StringViewLite GetStringView() const noexcept
-      {
-        return m_propertyStringView.Get();
-      }
-
-      bool SetStringView(const StringViewLite value)
-      {
-        return m_propertyStringView.Set(ThisDependencyObject(), value);
-      }
-
-    protected:
-      DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final
-      {
-        using namespace DataBinding;
-        auto res = DependencyObjectHelper::TryGetPropertyHandle(
-          this, ThisDependencyObject(), sourceDef, PropLinkRefs(PropertyBool, m_propertyBool), PropLinkRefs(PropertyUInt8, m_propertyUInt8),
-          PropLinkRefs(PropertyInt32, m_propertyInt32), PropLinkRefs(PropertyUInt32, m_propertyUInt32),
-          PropLinkRefs(PropertyDpSize1D, m_propertyDpSize1D), PropLinkRefs(PropertyDpSize1DF, m_propertyDpSize1DF),
-          PropLinkRefs(PropertyDpThicknessF, m_propertyDpThicknessF), PropLinkRefs(PropertyDpLayoutSize1D, m_propertyDpLayoutSize1D),
-          PropLinkRefs(PropertyItemAlignment, m_propertyItemAlignment), PropLinkRefs(PropertyLayoutOrientation, m_propertyLayoutOrientation),
-          PropLinkRefs(PropertyScrollModeFlags, m_propertyScrollModeFlags), PropLinkRefs(PropertyTransitionType, m_propertyTransitionType),
-          PropLinkRefs(PropertyStringView, m_propertyStringView));
-        return res.IsValid() ? res : DependencyObject::TryGetPropertyHandleNow(sourceDef);
-      }
-
-      DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
-                                                             const DataBinding::Binding& binding) final
-      {
-        using namespace DataBinding;
-        auto res = DependencyObjectHelper::TrySetBinding(
-          this, ThisDependencyObject(), targetDef, binding, PropLinkRefs(PropertyBool, m_propertyBool), PropLinkRefs(PropertyUInt8, m_propertyUInt8),
-          PropLinkRefs(PropertyInt32, m_propertyInt32), PropLinkRefs(PropertyUInt32, m_propertyUInt32),
-          PropLinkRefs(PropertyDpSize1D, m_propertyDpSize1D), PropLinkRefs(PropertyDpSize1DF, m_propertyDpSize1DF),
-          PropLinkRefs(PropertyDpThicknessF, m_propertyDpThicknessF), PropLinkRefs(PropertyDpLayoutSize1D, m_propertyDpLayoutSize1D),
-          PropLinkRefs(PropertyItemAlignment, m_propertyItemAlignment), PropLinkRefs(PropertyLayoutOrientation, m_propertyLayoutOrientation),
-          PropLinkRefs(PropertyScrollModeFlags, m_propertyScrollModeFlags), PropLinkRefs(PropertyTransitionType, m_propertyTransitionType),
-          PropLinkRefs(PropertyStringView, m_propertyStringView));
-        return res != PropertySetBindingResult::NotFound ? res : DependencyObject::TrySetBindingNow(targetDef, binding);
-      }
-    };
-
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyBool =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<bool, PropertySetter, &PropertySetter::GetBool, &PropertySetter::SetBool>("bool");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyUInt8 =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<uint8_t, PropertySetter, &PropertySetter::GetUInt8, &PropertySetter::SetUInt8>(
-        "UInt8");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyInt32 =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<int32_t, PropertySetter, &PropertySetter::GetInt32, &PropertySetter::SetInt32>(
-        "Int32");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyUInt32 =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<uint32_t, PropertySetter, &PropertySetter::GetUInt32, &PropertySetter::SetUInt32>(
-        "UInt32");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpSize1D =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1D, PropertySetter, &PropertySetter::GetDpSize1D, &PropertySetter::SetDpSize1D>(
-        "DpSize1D");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpSize1DF =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1DF, PropertySetter, &PropertySetter::GetDpSize1DF,
-                                                               &PropertySetter::SetDpSize1DF>("DpSize1DF");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpThicknessF =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<DpThicknessF, PropertySetter, &PropertySetter::GetDpThicknessF,
-                                                               &PropertySetter::SetDpThicknessF>("DpThicknessF");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyDpLayoutSize1D =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<DpLayoutSize1D, PropertySetter, &PropertySetter::GetDpLayoutSize1D,
-                                                               &PropertySetter::SetDpLayoutSize1D>("DpLayoutSize1D");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyItemAlignment =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ItemAlignment, PropertySetter, &PropertySetter::GetItemAlignment,
-                                                               &PropertySetter::SetItemAlignment>("ItemAlignment");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyLayoutOrientation =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<UI::LayoutOrientation, PropertySetter, &PropertySetter::GetLayoutOrientation,
-                                                               &PropertySetter::SetOrientation>("LayoutOrientation");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyScrollModeFlags =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ScrollModeFlags, PropertySetter, &PropertySetter::GetScrollModeFlags,
-                                                               &PropertySetter::SetScrollModeFlags>("ScrollModeFlags");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyTransitionType =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<TransitionType, PropertySetter, &PropertySetter::GetTransitionType,
-                                                               &PropertySetter::SetTransitionType>("TransitionType");
-
-    DataBinding::DependencyPropertyDefinition PropertySetter::PropertyStringView =
-      DataBinding::DependencyPropertyDefinitionFactory::Create<StringViewLite, PropertySetter, &PropertySetter::GetStringView,
-                                                               &PropertySetter::SetStringView>("StringView");
-
-
     class Walker
     {
       ControlFactory& m_controlFactory;
       RadioGroupManager& m_radioGroupManager;
       const std::shared_ptr<DataBinding::DataBindingService>& m_dataBinding;
-      PropertySetter m_valueSource;
+      Internal::PropertySetter m_valueSource;
       std::map<std::string, std::shared_ptr<UI::BaseWindow>> m_namedControls;
 
       std::array<char, 256> m_scratchpad{};
@@ -519,7 +253,7 @@ namespace Fsl::UI::Declarative::UIReader
               std::string attrName(attr.name());
               if (attrName == "Width")
               {
-                auto result = TryParseGridColumnDefinition(attr.value());
+                auto result = Internal::PropertyValueConverter::TryParseGridColumnDefinition(StringViewLite(attr.value()));
                 if (result.has_value())
                 {
                   rGrid.AddColumnDefinition(result.value());
@@ -546,7 +280,7 @@ namespace Fsl::UI::Declarative::UIReader
               std::string attrName(attr.name());
               if (attrName == "Height")
               {
-                auto result = TryParseGridRowDefinition(attr.value());
+                auto result = Internal::PropertyValueConverter::TryParseGridRowDefinition(StringViewLite(attr.value()));
                 if (result.has_value())
                 {
                   rGrid.AddRowDefinition(result.value());
@@ -567,58 +301,6 @@ namespace Fsl::UI::Declarative::UIReader
         return false;
       }
 
-      std::optional<GridColumnDefinition> TryParseGridColumnDefinition(const std::string& attr)
-      {
-        if (attr == "Auto")
-        {
-          return GridColumnDefinition(GridUnitType::Auto);
-        }
-        if (attr == "*")
-        {
-          return GridColumnDefinition(GridUnitType::Star, 1.0f);
-        }
-
-
-        // Need a try parse for floats
-        try
-        {
-          float value = 0.0f;
-          StringParseUtil::Parse(value, StringViewLite(attr));
-          return GridColumnDefinition(GridUnitType::Fixed, value);
-        }
-        catch (const std::exception&)
-        {
-        }
-
-        return {};
-      }
-
-      std::optional<GridRowDefinition> TryParseGridRowDefinition(const std::string& attr)
-      {
-        if (attr == "Auto")
-        {
-          return GridRowDefinition(GridUnitType::Auto);
-        }
-        if (attr == "*")
-        {
-          return GridRowDefinition(GridUnitType::Star, 1.0f);
-        }
-
-
-        // Need a try parse for floats
-        try
-        {
-          float value = NAN;
-          StringParseUtil::Parse(value, StringViewLite(attr));
-          return GridRowDefinition(GridUnitType::Fixed, value);
-        }
-        catch (const std::exception&)
-        {
-        }
-
-        return {};
-      }
-
       void ExtractAttributes(std::vector<PropertyRecord>& rDstAttributes, pugi::xml_node node)
       {
         for (pugi::xml_attribute attr : node.attributes())
@@ -765,7 +447,7 @@ namespace Fsl::UI::Declarative::UIReader
         {
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetStringView(strValue);
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyStringView);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyStringView);
           }
         }
         else if (setType == typeid(bool))
@@ -775,7 +457,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetBool(value);
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyBool);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyBool);
           }
         }
         else if (setType == typeid(uint8_t))
@@ -785,7 +467,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetUInt8(value);
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyUInt8);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyUInt8);
           }
         }
         else if (setType == typeid(int32_t))
@@ -795,7 +477,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetInt32(value);
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyInt32);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyInt32);
           }
         }
         else if (setType == typeid(uint32_t))
@@ -805,7 +487,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetUInt32(value);
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyUInt32);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyUInt32);
           }
         }
         else if (setType == typeid(DpSize1D))
@@ -815,7 +497,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetDpSize1D(DpSize1D::Create(value));
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyDpSize1D);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyDpSize1D);
           }
         }
         else if (setType == typeid(DpSize1DF))
@@ -825,7 +507,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetDpSize1DF(DpSize1DF::Create(value));
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyDpSize1DF);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyDpSize1DF);
           }
         }
         else if (setType == typeid(DpThicknessF))
@@ -835,7 +517,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetDpThicknessF(DpThicknessF::Create(value[0], value[1], value[2], value[3]));
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyDpThicknessF);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyDpThicknessF);
           }
         }
         else if (setType == typeid(DpLayoutSize1D))
@@ -845,7 +527,7 @@ namespace Fsl::UI::Declarative::UIReader
 
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetDpLayoutSize1D(UI::DpLayoutSize1D::Create(value));
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyDpLayoutSize1D);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyDpLayoutSize1D);
           }
         }
         // else if (setType == typeid(DpSize2DF))
@@ -856,16 +538,16 @@ namespace Fsl::UI::Declarative::UIReader
 
         //  {    // Quick solution, use the data binding service as a setter
         //    m_valueSource.SetDpSize2DF(DpSize2DF::Create(value));
-        //    ExecuteChanges(window, propertyDef, PropertySetter::PropertyDpSize2DF);
+        //    ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyDpSize2DF);
         //  }
         //}
         else if (setType == typeid(UI::ItemAlignment))
         {
-          auto result = TryToItemAlignment(strValue);
+          auto result = Internal::PropertyValueConverter::TryToItemAlignment(strValue);
           if (result.has_value())
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetItemAlignment(result.value());
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyItemAlignment);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyItemAlignment);
           }
           else
           {
@@ -874,11 +556,11 @@ namespace Fsl::UI::Declarative::UIReader
         }
         else if (setType == typeid(UI::LayoutOrientation))
         {
-          auto result = TryToLayoutOrientation(strValue);
+          auto result = Internal::PropertyValueConverter::TryToLayoutOrientation(strValue);
           if (result.has_value())
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetOrientation(result.value());
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyLayoutOrientation);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyLayoutOrientation);
           }
           else
           {
@@ -887,11 +569,11 @@ namespace Fsl::UI::Declarative::UIReader
         }
         else if (setType == typeid(UI::ScrollModeFlags))
         {
-          auto result = TryToScrollModeFlags(strValue);
+          auto result = Internal::PropertyValueConverter::TryToScrollModeFlags(strValue);
           if (result.has_value())
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetScrollModeFlags(result.value());
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyScrollModeFlags);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyScrollModeFlags);
           }
           else
           {
@@ -900,11 +582,11 @@ namespace Fsl::UI::Declarative::UIReader
         }
         else if (setType == typeid(TransitionType))
         {
-          auto result = TryToTransitionType(strValue);
+          auto result = Internal::PropertyValueConverter::TryToTransitionType(strValue);
           if (result.has_value())
           {    // Quick solution, use the data binding service as a setter
             m_valueSource.SetTransitionType(result.value());
-            ExecuteChanges(window, propertyDef, PropertySetter::PropertyTransitionType);
+            ExecuteChanges(window, propertyDef, Internal::PropertySetter::PropertyTransitionType);
           }
           else
           {
@@ -950,200 +632,6 @@ namespace Fsl::UI::Declarative::UIReader
         }
         return false;
       }
-
-      std::optional<UI::ItemAlignment> TryToItemAlignment(const StringViewLite value)
-      {
-        if (value == "Near")
-        {
-          return UI::ItemAlignment::Near;
-        }
-        if (value == "Center")
-        {
-          return UI::ItemAlignment::Center;
-        }
-        if (value == "Far")
-        {
-          return UI::ItemAlignment::Far;
-        }
-        if (value == "Stretch")
-        {
-          return UI::ItemAlignment::Stretch;
-        }
-        return {};
-      }
-
-      std::optional<UI::LayoutOrientation> TryToLayoutOrientation(const StringViewLite value)
-      {
-        if (value == "Vertical")
-        {
-          return UI::LayoutOrientation::Vertical;
-        }
-        if (value == "Horizontal")
-        {
-          return UI::LayoutOrientation::Horizontal;
-        }
-        return {};
-      }
-
-      std::optional<UI::ScrollModeFlags> TryToScrollModeFlags(const StringViewLite value)
-      {
-        if (value == "TranslateX")
-        {
-          return UI::ScrollModeFlags::TranslateX;
-        }
-        if (value == "TranslateY")
-        {
-          return UI::ScrollModeFlags::TranslateY;
-        }
-        if (value == "Translate")
-        {
-          return UI::ScrollModeFlags::Translate;
-        }
-        return {};
-      }
-
-      std::optional<TransitionType> TryToTransitionType(const StringViewLite value)
-      {
-        if (value == "Linear")
-        {
-          return TransitionType::Linear;
-        }
-        if (value == "EaseInSine")
-        {
-          return TransitionType::EaseInSine;
-        }
-        if (value == "EaseOutSine")
-        {
-          return TransitionType::EaseOutSine;
-        }
-        if (value == "EaseInOutSine")
-        {
-          return TransitionType::EaseInOutSine;
-        }
-        if (value == "EaseInQuad")
-        {
-          return TransitionType::EaseInQuad;
-        }
-        if (value == "EaseOutQuad")
-        {
-          return TransitionType::EaseOutQuad;
-        }
-        if (value == "EaseInOutQuad")
-        {
-          return TransitionType::EaseInOutQuad;
-        }
-        if (value == "EaseInCubic")
-        {
-          return TransitionType::EaseInCubic;
-        }
-        if (value == "EaseOutCubic")
-        {
-          return TransitionType::EaseOutCubic;
-        }
-        if (value == "EaseInOutCubic")
-        {
-          return TransitionType::EaseInOutCubic;
-        }
-        if (value == "EaseInQuart")
-        {
-          return TransitionType::EaseInQuart;
-        }
-        if (value == "EaseOutQuart")
-        {
-          return TransitionType::EaseOutQuart;
-        }
-        if (value == "EaseInOutQuart")
-        {
-          return TransitionType::EaseInOutQuart;
-        }
-        if (value == "EaseInQuint")
-        {
-          return TransitionType::EaseInQuint;
-        }
-        if (value == "EaseOutQuint")
-        {
-          return TransitionType::EaseOutQuint;
-        }
-        if (value == "EaseInOutQuint")
-        {
-          return TransitionType::EaseInOutQuint;
-        }
-        if (value == "EaseInExpo")
-        {
-          return TransitionType::EaseInExpo;
-        }
-        if (value == "EaseOutExpo")
-        {
-          return TransitionType::EaseOutExpo;
-        }
-        if (value == "EaseInOutExpo")
-        {
-          return TransitionType::EaseInOutExpo;
-        }
-        if (value == "EaseInCirc")
-        {
-          return TransitionType::EaseInCirc;
-        }
-        if (value == "EaseOutCirc")
-        {
-          return TransitionType::EaseOutCirc;
-        }
-        if (value == "EaseInOutCirc")
-        {
-          return TransitionType::EaseInOutCirc;
-        }
-        if (value == "EaseInBack")
-        {
-          return TransitionType::EaseInBack;
-        }
-        if (value == "EaseOutBack")
-        {
-          return TransitionType::EaseOutBack;
-        }
-        if (value == "EaseInOutBack")
-        {
-          return TransitionType::EaseInOutBack;
-        }
-        if (value == "EaseInElastic")
-        {
-          return TransitionType::EaseInElastic;
-        }
-        if (value == "EaseOutElastic")
-        {
-          return TransitionType::EaseOutElastic;
-        }
-        if (value == "EaseInOutElastic")
-        {
-          return TransitionType::EaseInOutElastic;
-        }
-        if (value == "EaseInBounce")
-        {
-          return TransitionType::EaseInBounce;
-        }
-        if (value == "EaseOutBounce")
-        {
-          return TransitionType::EaseOutBounce;
-        }
-        if (value == "EaseInOutBounce")
-        {
-          return TransitionType::EaseInOutBounce;
-        }
-        return {};
-      }
-
-
-      std::optional<UI::LayoutDirection> TryToLayoutDirection(const StringViewLite value)
-      {
-        if (value == "NearToFar")
-        {
-          return UI::LayoutDirection::NearToFar;
-        }
-        if (value == "FarToNear")
-        {
-          return UI::LayoutDirection::FarToNear;
-        }
-        return {};
-      }
     };
   }
 
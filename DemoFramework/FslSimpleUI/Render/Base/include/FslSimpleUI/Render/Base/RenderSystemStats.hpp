@@ -45,11 +45,16 @@ namespace Fsl::UI
     uint32_t DrawIndexCalls{0};
     uint32_t VertexBufferCount{0};
     uint32_t IndexBufferCount{0};
+    //! The number of vertices that were kept from the previous mesh generation
+    uint32_t ReusedVertexCount{0};
+    //! The number of vertices that had to be generated
+    uint32_t RebuiltVertexCount{0};
 
     constexpr RenderSystemStats() noexcept = default;
     constexpr RenderSystemStats(const uint32_t meshCount, const uint32_t batchCount, const uint32_t vertexCount, const uint32_t indexCount,
                                 const uint32_t drawCalls, const uint32_t drawIndexCalls, const uint32_t vertexBufferCount,
-                                const uint32_t indexBufferCount) noexcept
+                                const uint32_t indexBufferCount, const uint32_t reusedVertexCount = 0,
+                                const uint32_t rebuiltVertexCount = 0) noexcept
       : MeshCount(meshCount)
       , BatchCount(batchCount)
       , VertexCount(vertexCount)
@@ -58,6 +63,8 @@ namespace Fsl::UI
       , DrawIndexCalls(drawIndexCalls)
       , VertexBufferCount(vertexBufferCount)
       , IndexBufferCount(indexBufferCount)
+      , ReusedVertexCount(reusedVertexCount)
+      , RebuiltVertexCount(rebuiltVertexCount)
     {
     }
   };
@@ -43,6 +43,8 @@
 #include <FslGraphics/Sprite/NineSliceSprite.hpp>
 #include <FslGraphics/Sprite/OptimizedNineSliceSprite.hpp>
 #include <FslSimpleUI/Render/Builder/UITextMeshBuilder.hpp>
+#include <algorithm>
+#include <cassert>
 #include "HandleCoding.hpp"
 #include "Log/FmtRenderDrawSpriteType.hpp"
 #include "MeshManager.hpp"
@@ -75,6 +77,9 @@ namespace Fsl::UI::RenderIMBatch
       constexpr uint32_t InitialFontScratchpadCapacity = 256;
 
       constexpr uint32_t SpriteMaterialIndex0 = 0u;
+
+      //! The max number of modified meshes we track between two draws, if more are modified we consider all meshes modified
+      constexpr uint32_t ModifiedMeshCapacity = 1024;
     }
 
     namespace LocalCapacity
@@ -374,6 +379,8 @@ namespace Fsl::UI::RenderIMBatch
     : m_materialLookup(defaultMaterialInfo)
     , m_textMeshBuilder(std::make_shared<UITextMeshBuilder>(LocalConfig::InitialFontScratchpadCapacity))
   {
+    // Reserve the full capacity up front so MarkModified never needs to allocate
+    m_modifiedMeshes.reserve(LocalConfig::ModifiedMeshCapacity);
   }
 
   MeshManager::~MeshManager()
@@ -402,6 +409,23 @@ namespace Fsl::UI::RenderIMBatch
     UpdateConfiguration(m_materialLookup, m_meshesNineSliceSprite);
     UpdateConfiguration(m_materialLookup, m_meshesOptimizedNineSliceSprite);
     UpdateConfiguration(m_materialLookup, m_meshesSpriteFont);
+    m_allMeshesModified = true;
+  }
+
+
+  void MeshManager::SortModifiedMeshes() noexcept
+  {
+    std::sort(m_modifiedMeshes.begin(), m_modifiedMeshes.end(), [](const MeshHandle lhs, const MeshHandle rhs) { return lhs.Value < rhs.Value; });
+  }
+
+
+  bool MeshManager::IsMeshModified(const MeshHandle hMesh) const noexcept
+  {
+    assert(std::is_sorted(m_modifiedMeshes.begin(), m_modifiedMeshes.end(),
+                          [](const MeshHandle lhs, const MeshHandle rhs) { return lhs.Value < rhs.Value; }));
+    return m_allMeshesModified ||
+           std::binary_search(m_modifiedMeshes.begin(), m_modifiedMeshes.end(), hMesh,
+                              [](const MeshHandle lhs, const MeshHandle rhs) { return lhs.Value < rhs.Value; });
   }
 
 
@@ -429,7 +453,9 @@ namespace Fsl::UI::RenderIMBatch
       m_capacity.VertexCapacity += result.VertexCapacity;
 
       SANITY_CHECK_ALL();
-      return HandleCoding::EncodeHandle(result.DrawSpriteType, result.MeshValue);
+      const MeshHandle hMesh = HandleCoding::EncodeHandle(result.DrawSpriteType, result.MeshValue);
+      MarkModified(hMesh);
+      return hMesh;
     }
     catch (const std::exception& ex)
     {
@@ -478,7 +504,9 @@ namespace Fsl::UI::RenderIMBatch
       m_capacity.VertexCapacity += result.VertexCapacity;
       m_capacity.IndexCapacity += result.IndexCapacity;
       SANITY_CHECK_ALL();
-      return HandleCoding::EncodeHandle(result.DrawSpriteType, result.MeshValue);
+      const MeshHandle hMesh = HandleCoding::EncodeHandle(result.DrawSpriteType, result.MeshValue);
+      MarkModified(hMesh);
+      return hMesh;
     }
     catch (const std::exception& ex)
     {
@@ -520,7 +548,9 @@ namespace Fsl::UI::RenderIMBatch
       m_capacity.VertexCapacity += finalVertexCapacity;
       m_capacity.IndexCapacity += finalIndexCapacity;
       SANITY_CHECK_ALL();
-      return HandleCoding::EncodeHandle(RenderDrawSpriteType::SpriteFont, hMeshValue);
+      const MeshHandle hMesh = HandleCoding::EncodeHandle(RenderDrawSpriteType::SpriteFont, hMeshValue);
+      MarkModified(hMesh);
+      return hMesh;
     }
     catch (const std::exception& ex)
     {
@@ -560,6 +590,10 @@ namespace Fsl::UI::RenderIMBatch
       FSLLOG3_ERROR("Handle has unknown/unsupported mesh type");
       break;
     }
+    if (found)
+    {
+      MarkModified(hMesh);
+    }
     SANITY_CHECK_ALL();
     return found;
   }
@@ -617,6 +651,7 @@ namespace Fsl::UI::RenderIMBatch
     assert(m_capacity.IndexCapacity >= rMeshRecord.Primitive.MeshIndexCapacity);
 
     // Since we just change between two font materials the required vertex and index capacity should not change!
+    MarkModified(hMesh);
     SANITY_CHECK_ALL();
     return hMesh;
   }
@@ -633,7 +668,10 @@ namespace Fsl::UI::RenderIMBatch
     }
     SpriteFontMeshRecord& rMeshRecord = m_meshesSpriteFont.Get(HandleCoding::GetOriginalHandle(hMesh));
 
-    rMeshRecord.SetText(text);
+    if (rMeshRecord.SetText(text))
+    {
+      MarkModified(hMesh);
+    }
 
     SANITY_CHECK_ALL();
     return hMesh;
@@ -666,6 +704,8 @@ namespace Fsl::UI::RenderIMBatch
       FSLLOG3_ERROR("Handle has unknown/unsupported mesh type");
       break;
     }
+    // The capacity affects how the mesh is batched
+    MarkModified(hMesh);
     SANITY_CHECK_ALL();
   }
 
@@ -813,6 +853,24 @@ namespace Fsl::UI::RenderIMBatch
     }
   }
 
+  void MeshManager::MarkModified(const MeshHandle hMesh) noexcept
+  {
+    if (!m_allMeshesModified)
+    {
+      if (m_modifiedMeshes.size() < m_modifiedMeshes.capacity())
+      {
+        m_modifiedMeshes.push_back(hMesh);
+      }
+      else
+      {
+        // Out of capacity, so just consider everything modified
+        m_modifiedMeshes.clear();
+        m_allMeshesModified = true;
+      }
+    }
+  }
+
+
   void MeshManager::SanityCheckAll() noexcept
   {
 #ifdef LOCAL_SANITY_CHECK
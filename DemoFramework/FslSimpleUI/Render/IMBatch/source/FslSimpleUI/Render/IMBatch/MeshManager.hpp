@@ -289,6 +289,10 @@ namespace Fsl::UI::RenderIMBatch
     HandleVector<SpriteFontMeshRecord> m_meshesSpriteFont;
     Capacity m_capacity;
     std::shared_ptr<UITextMeshBuilder> m_textMeshBuilder;
+    //! The meshes that were created, destroyed or modified since the last ClearModifiedMeshes call
+    std::vector<MeshHandle> m_modifiedMeshes;
+    //! If true the modified mesh tracking ran out of capacity (or was reset) so all meshes must be considered modified
+    bool m_allMeshesModified{true};
 
   public:
     explicit MeshManager(const SpriteMaterialInfo& defaultMaterialInfo);
@@ -346,6 +350,24 @@ namespace Fsl::UI::RenderIMBatch
 
     void OnConfigurationChanged();
 
+    //! @brief Prepare the modified mesh tracking for queries using IsMeshModified.
+    void SortModifiedMeshes() noexcept;
+
+    //! @brief Check if the mesh was created, destroyed or modified since the last ClearModifiedMeshes call.
+    //! @note  SortModifiedMeshes must be called before this.
+    bool IsMeshModified(const MeshHandle hMesh) const noexcept;
+
+    bool IsAllMeshesModified() const noexcept
+    {
+      return m_allMeshesModified;
+    }
+
+    void ClearModifiedMeshes() noexcept
+    {
+      m_modifiedMeshes.clear();
+      m_allMeshesModified = false;
+    }
+
     // IMeshManager
     [[nodiscard]] MeshHandle CreateBasicMesh(const std::shared_ptr<ISprite>& sprite) final;
     [[nodiscard]] MeshHandle CreateBasicMesh(const std::shared_ptr<ISprite>& sprite, const uint32_t vertexCapacity) final;
@@ -368,6 +390,7 @@ namespace Fsl::UI::RenderIMBatch
                                      const uint32_t spriteMaterialIndex, const bool isOpaque, const uint32_t vertexCapacity);
     AddMeshResult AddSpriteMesh(const std::shared_ptr<ISprite>& sprite, const BatchMaterialHandle batchMaterialHandle,
                                 const uint32_t spriteMaterialIndex, const bool isOpaque, const uint32_t vertexCapacity, const uint32_t indexCapacity);
+    void MarkModified(const MeshHandle hMesh) noexcept;
     void SanityCheckAll() noexcept;
     void SanityCheck() noexcept;
     void SanityCheckMats() noexcept;
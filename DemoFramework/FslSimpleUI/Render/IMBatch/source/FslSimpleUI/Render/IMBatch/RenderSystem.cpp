@@ -31,6 +31,7 @@
 
 #include "RenderSystem.hpp"
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Profiler/ScopeProfiler.hpp>
 #include <FslGraphics/Render/Basic/BasicCameraInfo.hpp>
 #include <FslGraphics/Render/Basic/IBasicRenderSystem.hpp>
 #include <FslGraphics/Sprite/BasicImageSprite.hpp>
@@ -57,6 +58,7 @@
 #include "MeshManager.hpp"
 #include "Preprocess/Basic/BasicPreprocessor.hpp"
 #include "RenderDrawCommandType.hpp"
+#include "RetainedCommandCache.hpp"
 
 
 namespace Fsl::UI::RenderIMBatch
@@ -569,166 +571,225 @@ namespace Fsl::UI::RenderIMBatch
     // Process
     // -----------------------------------------------------------------------------------------------------------------------------------------------
 
+    inline bool IsRetainable(const EncodedCommand& command) noexcept
+    {
+      // Custom draw functions can generate anything, so we always regenerate them
+      switch (command.State.Type())
+      {
+      case DrawCommandType::DrawAtOffsetAndSize:
+      case DrawCommandType::DrawRot90CWAtOffsetAndSize:
+        return true;
+      default:
+        return false;
+      }
+    }
+
+
     template <typename TBatcher>
-    void ProcessDrawCommands(TBatcher& rBatcher, const MeshManager& meshManager, UITextMeshBuilder& rTextMeshBuilder,
-                             const ReadOnlySpan<ProcessedCommandRecord> orderedSpan, const ReadOnlySpan<EncodedCommand> commandSpan,
-                             const DrawCommandBufferEx& commandBuffer)
+    void ProcessDrawCommand(TBatcher& rBatcher, const MeshManager& meshManager, UITextMeshBuilder& rTextMeshBuilder,
+                            const ProcessedCommandRecord& record, const EncodedCommand& command, const DrawCommandBufferEx& commandBuffer)
     {
-      const std::size_t count = orderedSpan.size();
-      for (std::size_t i = 0; i < count; ++i)
+      const auto hMesh = HandleCoding::GetOriginalHandle(command.Mesh);
+      if (!command.State.IsClipEnabled())
       {
-        const ProcessedCommandRecord& record = orderedSpan[i];
-        const EncodedCommand& command = commandSpan[record.LegacyCommandSpanIndex];
-        const auto hMesh = HandleCoding::GetOriginalHandle(command.Mesh);
-        if (!command.State.IsClipEnabled())
+        switch (ToRenderDrawCommandType(HandleCoding::GetType(command.Mesh), command.State.Type()))
         {
-          switch (ToRenderDrawCommandType(HandleCoding::GetType(command.Mesh), command.State.Type()))
+        case RenderDrawCommandType::BasicImageSprite_DrawAtOffsetAndSize:
+        case RenderDrawCommandType::ImageSprite_DrawAtOffsetAndSize:
+          AddImageMesh(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh));
+          break;
+        case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
           {
-          case RenderDrawCommandType::BasicImageSprite_DrawAtOffsetAndSize:
-          case RenderDrawCommandType::ImageSprite_DrawAtOffsetAndSize:
-            AddImageMesh(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh));
-            break;
-          case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
+            CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
+            const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
-              const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddBasicImageSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh), {});
-              }
-              break;
+              AddBasicImageSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh), {});
             }
-          case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
+            break;
+          }
+        case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
+          {
+            CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
+            const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
+              commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
-              const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
-                commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddBasicImageSpriteMesh(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh), {});
-              }
-              break;
+              AddBasicImageSpriteMesh(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh), {});
             }
-          case RenderDrawCommandType::BasicNineSliceSprite_DrawAtOffsetAndSize:
-          case RenderDrawCommandType::NineSliceSprite_DrawAtOffsetAndSize:
-            AddNineSliceSprite(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh));
-            break;
-          case RenderDrawCommandType::NineSliceSprite_DrawRot90CWAtOffsetAndSize:
-            AddNineSliceSpriteRot90(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh));
             break;
-          case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
+          }
+        case RenderDrawCommandType::BasicNineSliceSprite_DrawAtOffsetAndSize:
+        case RenderDrawCommandType::NineSliceSprite_DrawAtOffsetAndSize:
+          AddNineSliceSprite(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh));
+          break;
+        case RenderDrawCommandType::NineSliceSprite_DrawRot90CWAtOffsetAndSize:
+          AddNineSliceSpriteRot90(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh));
+          break;
+        case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
+          {
+            CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
+            const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
-              const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddNineSliceSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetNineSliceSprite(hMesh), {});
-              }
-              break;
+              AddNineSliceSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetNineSliceSprite(hMesh), {});
             }
-          case RenderDrawCommandType::OptimizedNineSliceSprite_DrawAtOffsetAndSize:
-            AddOptimizedNineSliceSprite(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh));
-            break;
-          case RenderDrawCommandType::OptimizedNineSliceSprite_DrawRot90CWAtOffsetAndSize:
-            AddOptimizedNineSliceSpriteRot90(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh));
             break;
-          case RenderDrawCommandType::SpriteFont_DrawAtOffsetAndSize:
-            AddSpriteFont(rBatcher, record, rTextMeshBuilder, CommandDrawAtOffsetAndSize(command), meshManager.UncheckedGetSpriteFont(hMesh));
-            break;
-          case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
+          }
+        case RenderDrawCommandType::OptimizedNineSliceSprite_DrawAtOffsetAndSize:
+          AddOptimizedNineSliceSprite(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh));
+          break;
+        case RenderDrawCommandType::OptimizedNineSliceSprite_DrawRot90CWAtOffsetAndSize:
+          AddOptimizedNineSliceSpriteRot90(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh));
+          break;
+        case RenderDrawCommandType::SpriteFont_DrawAtOffsetAndSize:
+          AddSpriteFont(rBatcher, record, rTextMeshBuilder, CommandDrawAtOffsetAndSize(command), meshManager.UncheckedGetSpriteFont(hMesh));
+          break;
+        case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
+          {
+            CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
+            const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
-              const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddSpriteFont(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh));
-              }
-              break;
+              AddSpriteFont(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh));
             }
-          default:
-            FSLLOG3_ERROR("Not a valid draw command '{}' for for the given mesh type {}", command.State.Type(), HandleCoding::GetType(command.Mesh));
             break;
           }
+        default:
+          FSLLOG3_ERROR("Not a valid draw command '{}' for for the given mesh type {}", command.State.Type(), HandleCoding::GetType(command.Mesh));
+          break;
         }
-        else
+      }
+      else
+      {
+        switch (ToRenderDrawCommandType(HandleCoding::GetType(command.Mesh), command.State.Type()))
         {
-          switch (ToRenderDrawCommandType(HandleCoding::GetType(command.Mesh), command.State.Type()))
+        case RenderDrawCommandType::BasicImageSprite_DrawAtOffsetAndSize:
+        case RenderDrawCommandType::ImageSprite_DrawAtOffsetAndSize:
+          AddImageMeshWithClipping(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh), command.ClipRectanglePxf);
+          break;
+        case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
           {
-          case RenderDrawCommandType::BasicImageSprite_DrawAtOffsetAndSize:
-          case RenderDrawCommandType::ImageSprite_DrawAtOffsetAndSize:
-            AddImageMeshWithClipping(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh), command.ClipRectanglePxf);
-            break;
-          case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
+            CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
+            const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
-              const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddBasicImageSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
-                                    DrawClipContext(true, command.ClipRectanglePxf));
-              }
-              break;
+              AddBasicImageSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
+                                  DrawClipContext(true, command.ClipRectanglePxf));
             }
-          case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
+            break;
+          }
+        case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
+          {
+            CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
+            const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
+              commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
-              const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
-                commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddBasicImageSpriteMesh(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
-                                        DrawClipContext(true, command.ClipRectanglePxf));
-              }
-              break;
+              AddBasicImageSpriteMesh(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
+                                      DrawClipContext(true, command.ClipRectanglePxf));
             }
-          case RenderDrawCommandType::BasicNineSliceSprite_DrawAtOffsetAndSize:
-          case RenderDrawCommandType::NineSliceSprite_DrawAtOffsetAndSize:
-            AddNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
             break;
-          case RenderDrawCommandType::NineSliceSprite_DrawRot90CWAtOffsetAndSize:
-            AddNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
-            break;
-          case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
+          }
+        case RenderDrawCommandType::BasicNineSliceSprite_DrawAtOffsetAndSize:
+        case RenderDrawCommandType::NineSliceSprite_DrawAtOffsetAndSize:
+          AddNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
+          break;
+        case RenderDrawCommandType::NineSliceSprite_DrawRot90CWAtOffsetAndSize:
+          AddNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
+          break;
+        case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
+          {
+            CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
+            const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
-              const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddNineSliceSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetNineSliceSprite(hMesh),
-                                   DrawClipContext(true, command.ClipRectanglePxf));
-              }
-              break;
+              AddNineSliceSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetNineSliceSprite(hMesh),
+                                 DrawClipContext(true, command.ClipRectanglePxf));
             }
-          case RenderDrawCommandType::OptimizedNineSliceSprite_DrawAtOffsetAndSize:
-            AddOptimizedNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
-                                                    command.ClipRectanglePxf);
             break;
-          case RenderDrawCommandType::OptimizedNineSliceSprite_DrawRot90CWAtOffsetAndSize:
-            AddOptimizedNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
-                                                         command.ClipRectanglePxf);
-            break;
-          case RenderDrawCommandType::SpriteFont_DrawAtOffsetAndSize:
-            AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, CommandDrawAtOffsetAndSize(command),
-                                      meshManager.UncheckedGetSpriteFont(hMesh));
-            break;
-          case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
+          }
+        case RenderDrawCommandType::OptimizedNineSliceSprite_DrawAtOffsetAndSize:
+          AddOptimizedNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
+                                                  command.ClipRectanglePxf);
+          break;
+        case RenderDrawCommandType::OptimizedNineSliceSprite_DrawRot90CWAtOffsetAndSize:
+          AddOptimizedNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
+                                                       command.ClipRectanglePxf);
+          break;
+        case RenderDrawCommandType::SpriteFont_DrawAtOffsetAndSize:
+          AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, CommandDrawAtOffsetAndSize(command),
+                                    meshManager.UncheckedGetSpriteFont(hMesh));
+          break;
+        case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
+          {
+            CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
+            const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
+            if (customDrawInfo.FnDraw != nullptr)
             {
-              CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
-              const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
-              if (customDrawInfo.FnDraw != nullptr)
-              {
-                AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh));
-              }
-              break;
+              AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh));
             }
-          default:
-            FSLLOG3_ERROR("Not a valid draw command '{}' for for the given mesh type {}", command.State.Type(), HandleCoding::GetType(command.Mesh));
             break;
           }
+        default:
+          FSLLOG3_ERROR("Not a valid draw command '{}' for for the given mesh type {}", command.State.Type(), HandleCoding::GetType(command.Mesh));
+          break;
         }
       }
     }
 
+
+    struct RetainedProcessState
+    {
+      //! True while the generated output matches the output retained from the previous generation
+      bool InSync{false};
+      //! True if commands were skipped, which means the batcher must be resumed before anything can be generated
+      bool ResumeRequired{false};
+      uint32_t RebuiltVertexCount{0};
+    };
+
+
+    template <typename TBatcher>
+    void ProcessDrawCommands(TBatcher& rBatcher, RetainedProcessState& rState, RetainedCommandCache& rRetainedCommands,
+                             const MeshManager& meshManager, UITextMeshBuilder& rTextMeshBuilder,
+                             const ReadOnlySpan<ProcessedCommandRecord> orderedSpan, const ReadOnlySpan<EncodedCommand> commandSpan,
+                             const DrawCommandBufferEx& commandBuffer, const uint32_t retainedOffset)
+    {
+      const uint32_t retainedCount = rRetainedCommands.Count();
+      const auto count = UncheckedNumericCast<uint32_t>(orderedSpan.size());
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        const uint32_t retainedIndex = retainedOffset + i;
+        const ProcessedCommandRecord& record = orderedSpan[i];
+        const EncodedCommand& command = commandSpan[record.LegacyCommandSpanIndex];
+        if (rState.InSync && retainedIndex < retainedCount && IsRetainable(command) &&
+            rRetainedCommands[retainedIndex].IsSameMeshInput(command, record) && !meshManager.IsMeshModified(command.Mesh))
+        {
+          // Neither the command nor anything before it changed, so the vertices and indices from the last generation are reused as is
+          rState.ResumeRequired = true;
+          continue;
+        }
+
+        if (rState.ResumeRequired)
+        {
+          assert(rState.InSync);
+          rBatcher.ResumeBatch(rRetainedCommands.GetStatusBefore(retainedIndex));
+          rState.ResumeRequired = false;
+        }
+
+        const ImmediateModeBatcherTypes::BatchBuildStatus statusBefore = rBatcher.GetBuildStatus();
+        ProcessDrawCommand(rBatcher, meshManager, rTextMeshBuilder, record, command, commandBuffer);
+        const ImmediateModeBatcherTypes::BatchBuildStatus& statusAfter = rBatcher.GetBuildStatus();
+
+        // If the regenerated mesh did not end up with the exact same vertex, index and batch layout as before then everything after it
+        // needs to be regenerated as well
+        rState.InSync = rState.InSync && retainedIndex < retainedCount && statusAfter == rRetainedCommands.GetStatusBefore(retainedIndex + 1);
+        rState.RebuiltVertexCount += statusAfter.VertexCount - statusBefore.VertexCount;
+        rRetainedCommands.Set(retainedIndex, RetainedCommandCache::Record(command, record, statusBefore));
+      }
+    }
+
+
     template <typename TBatcher>
     UploadStats UploadMeshChanges(std::vector<RenderSystemBufferRecord>& rBuffers, IBasicRenderSystem& renderSystem, const TBatcher& batcher)
     {
@@ -888,7 +949,7 @@ namespace Fsl::UI::RenderIMBatch
 
     template <typename TBatcher>
     inline void UpdateStats(RenderSystemStats& rStats, const TBatcher& batcher, const MeshManager& meshManager, const UploadStats& uploadStats,
-                            const DrawStats& drawStats)
+                            const DrawStats& drawStats, const uint32_t rebuiltVertexCount)
     {    // Update the stats
       auto batcherStats = batcher.GetStats();
       rStats.MeshCount = meshManager.GetMeshCount();
@@ -899,23 +960,30 @@ namespace Fsl::UI::RenderIMBatch
       rStats.IndexBufferCount = uploadStats.IndexBufferCount;
       rStats.DrawCalls = drawStats.DrawCalls;
       rStats.DrawIndexCalls = drawStats.DrawIndexCalls;
+      assert(rebuiltVertexCount <= batcherStats.VertexCount);
+      rStats.ReusedVertexCount = batcherStats.VertexCount - rebuiltVertexCount;
+      rStats.RebuiltVertexCount = rebuiltVertexCount;
     }
 
     template <typename TBatcher>
     void DrawNow(RenderSystemStats& rStats, IBasicRenderSystem& renderSystem, MeshManager& meshManager,
                  std::vector<RenderSystemBufferRecord>& rBuffers, const TBatcher& batcher, const BasicCameraInfo& cameraInfo,
-                 RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
+                 RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isUploadRequired,
+                 const uint32_t rebuiltVertexCount)
     {
       UploadStats uploadStats;
 
-      if (isNewCommandBuffer)
+      if (isUploadRequired)
       {
         if (pPerformanceCapture != nullptr)
         {
           pPerformanceCapture->Begin(RenderPerformanceCaptureId::UpdateBuffers);
         }
 
-        uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher);
+        {
+          FSL_PROFILE_SCOPE("UI.Render.UploadBuffers");
+          uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher);
+        }
 
         if (pPerformanceCapture != nullptr)
         {
@@ -934,6 +1002,7 @@ namespace Fsl::UI::RenderIMBatch
       }
 
       DrawStats drawStats;
+      FSL_PROFILE_SCOPE("UI.Render.DrawMeshes");
       DrawMeshes(renderSystem, drawStats, batcher, meshManager, SpanUtil::UncheckedAsReadOnlySpan(rBuffers, 0, batcher.GetSegmentCount()), cameraInfo,
                  maxDrawCalls);
 
@@ -943,16 +1012,18 @@ namespace Fsl::UI::RenderIMBatch
         pPerformanceCapture->End(RenderPerformanceCaptureId::ScheduleDraw);
       }
 
-      UpdateStats(rStats, batcher, meshManager, uploadStats, drawStats);
+      UpdateStats(rStats, batcher, meshManager, uploadStats, drawStats, rebuiltVertexCount);
     }
 
 
     template <typename TBatcher, typename TPreprocessor>
     void DoDraw(RenderSystemStats& rStats, IBasicRenderSystem& renderSystem, MeshManager& rMeshManager,
-                std::vector<RenderSystemBufferRecord>& rBuffers, std::vector<ProcessedCommandRecord>& rProcessedCommandRecords, TBatcher& rBatcher,
-                DrawCommandBufferEx& rCommandBuffer, const BasicCameraInfo& cameraInfo, TPreprocessor& rPreprocessor,
-                RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
+                std::vector<RenderSystemBufferRecord>& rBuffers, std::vector<ProcessedCommandRecord>& rProcessedCommandRecords,
+                RetainedCommandCache& rRetainedCommands, TBatcher& rBatcher, DrawCommandBufferEx& rCommandBuffer,
+                const BasicCameraInfo& cameraInfo, TPreprocessor& rPreprocessor, RenderPerformanceCapture* const pPerformanceCapture,
+                const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
     {
+      FSL_PROFILE_SCOPE("UI.Render.Draw");
       if (isNewCommandBuffer)
       {
         auto capacity = rMeshManager.GetCapacity();
@@ -963,9 +1034,12 @@ namespace Fsl::UI::RenderIMBatch
       {
         UITextMeshBuilder& rTextMeshBuilder = rMeshManager.GetTextMeshBuilder();
 
+        bool isUploadRequired = isNewCommandBuffer;
+        uint32_t rebuiltVertexCount = 0;
         if (isNewCommandBuffer)
         {
           // Process the draw commands which generate all the meshes using a given 'batch' strategy.
+          // Meshes generated by the previous frame are reused for all draw commands that did not change.
           rBatcher.BeginBatch();
           {
             auto commandSpan = rCommandBuffer.AsReadOnlySpan();
@@ -976,7 +1050,10 @@ namespace Fsl::UI::RenderIMBatch
                 pPerformanceCapture->Begin(RenderPerformanceCaptureId::PreprocessDrawCommands);
               }
 
-              rPreprocessor.Process(rProcessedCommandRecords, commandSpan, rMeshManager);
+              {
+                FSL_PROFILE_SCOPE("UI.Render.Preprocess");
+                rPreprocessor.Process(rProcessedCommandRecords, commandSpan, rMeshManager);
+              }
 
               if (pPerformanceCapture != nullptr)
               {
@@ -984,9 +1061,34 @@ namespace Fsl::UI::RenderIMBatch
               }
 
               ReadOnlySpan<ProcessedCommandRecord> opaqueSpan = rPreprocessor.GetOpaqueSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer);
               ReadOnlySpan<ProcessedCommandRecord> transparentSpan = rPreprocessor.GetTransparentSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan, rCommandBuffer);
+              const auto opaqueCount = UncheckedNumericCast<uint32_t>(opaqueSpan.size());
+              const auto commandCount = UncheckedNumericCast<uint32_t>(opaqueSpan.size() + transparentSpan.size());
+              const uint32_t retainedCount = rRetainedCommands.Count();
+
+              FSL_PROFILE_SCOPE("UI.Render.GenerateMeshes");
+              rMeshManager.SortModifiedMeshes();
+
+              RetainedProcessState retainedState;
+              retainedState.InSync = !rMeshManager.IsAllMeshesModified() && rRetainedCommands.IsValid() &&
+                                     rBatcher.GetBuildStatus() == rRetainedCommands.GetStatusBefore(0);
+
+              rRetainedCommands.BeginUpdate(commandCount);
+              ProcessDrawCommands(rBatcher, retainedState, rRetainedCommands, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer,
+                                  0u);
+              ProcessDrawCommands(rBatcher, retainedState, rRetainedCommands, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan,
+                                  rCommandBuffer, opaqueCount);
+              if (retainedState.ResumeRequired)
+              {
+                // The trailing commands were all reused
+                rBatcher.ResumeBatch(rRetainedCommands.GetStatusBefore(commandCount));
+              }
+              rRetainedCommands.EndUpdate(commandCount, rBatcher.GetBuildStatus());
+              rMeshManager.ClearModifiedMeshes();
+
+              // If everything was reused the buffers already contain the exact content
+              isUploadRequired = !retainedState.InSync || commandCount != retainedCount || retainedState.RebuiltVertexCount > 0u;
+              rebuiltVertexCount = retainedState.RebuiltVertexCount;
 
               // FSLLOG3_INFO("commandSpan:{} Opaque:{} Transparent:{}", commandSpan.size(), opaqueSpan.size(), transparentSpan.size());
 
@@ -995,6 +1097,10 @@ namespace Fsl::UI::RenderIMBatch
                 pPerformanceCapture->End(RenderPerformanceCaptureId::GenerateMeshes);
               }
             }
+            else
+            {
+              rRetainedCommands.Invalidate();
+            }
           }
           rBatcher.EndBatch();
         }
@@ -1006,11 +1112,13 @@ namespace Fsl::UI::RenderIMBatch
         }
 
         // Time to upload and draw the meshes
-        DrawNow(rStats, renderSystem, rMeshManager, rBuffers, rBatcher, cameraInfo, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+        DrawNow(rStats, renderSystem, rMeshManager, rBuffers, rBatcher, cameraInfo, pPerformanceCapture, maxDrawCalls, isUploadRequired,
+                rebuiltVertexCount);
       }
       catch (std::exception& ex)
       {
         rBatcher.ForceEndBatch();
+        rRetainedCommands.Invalidate();
         FSLLOG3_ERROR("Exception {}", ex.what());
         throw;
       }
@@ -1040,8 +1148,8 @@ namespace Fsl::UI::RenderIMBatch
 
     m_preprocessor.SetAllowDepthBuffer(GetAllowDepthBuffer());
 
-    DoDraw(DoGetStats(), GetRenderSystem(), DoGetMeshManager(), GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-           m_preprocessor, pPerformanceCapture, 0xFFFFFFFF, isNewCommandBuffer);
+    DoDraw(DoGetStats(), GetRenderSystem(), DoGetMeshManager(), GetBuffers(), m_processedCommandRecords, m_retainedCommands, m_batcher,
+           GetCommandBuffer(), cameraInfo, m_preprocessor, pPerformanceCapture, 0xFFFFFFFF, isNewCommandBuffer);
   }
 
 
@@ -1064,8 +1172,8 @@ namespace Fsl::UI::RenderIMBatch
     const BasicCameraInfo cameraInfo(GetMatrixProjection());
 
     MeshManager& rMeshManager = DoGetMeshManager();
-    DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-           m_preprocessor, pPerformanceCapture, m_maxDrawCalls, isNewCommandBuffer);
+    DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_retainedCommands, m_batcher,
+           GetCommandBuffer(), cameraInfo, m_preprocessor, pPerformanceCapture, m_maxDrawCalls, isNewCommandBuffer);
   }
 
 
@@ -1100,22 +1208,22 @@ namespace Fsl::UI::RenderIMBatch
     if (m_config.ReorderMethod == DrawReorderMethod::Disabled)
     {
       BasicPreprocessor preprocessor(allowDepthBuffer, GetWindowMetrics().GetSizePx());
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_retainedCommands, m_batcher,
+             GetCommandBuffer(), cameraInfo, preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
     else if (m_config.ReorderMethod == DrawReorderMethod::LinearConstrained)
     {
       m_preprocessor.SetAllowDepthBuffer(allowDepthBuffer);
 
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             m_preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_retainedCommands, m_batcher,
+             GetCommandBuffer(), cameraInfo, m_preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
     else if (m_config.ReorderMethod == DrawReorderMethod::SpatialGrid)
     {
       m_spatialGridPreprocessor.SetAllowDepthBuffer(allowDepthBuffer);
 
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             m_spatialGridPreprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_retainedCommands, m_batcher,
+             GetCommandBuffer(), cameraInfo, m_spatialGridPreprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
   }
 }
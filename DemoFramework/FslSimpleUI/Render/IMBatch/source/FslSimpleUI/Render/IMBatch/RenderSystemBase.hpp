@@ -47,6 +47,7 @@
 #include <utility>
 #include "Preprocess/ProcessedCommandRecord.hpp"
 #include "RenderSystemBufferRecord.hpp"
+#include "RetainedCommandCache.hpp"
 
 namespace Fsl
 {
@@ -82,6 +83,7 @@ namespace Fsl::UI::RenderIMBatch
 
   protected:
     std::vector<ProcessedCommandRecord> m_processedCommandRecords;
+    RetainedCommandCache m_retainedCommands;
 
     bool GetAllowDepthBuffer() const noexcept
     {
@@ -168,6 +170,7 @@ namespace Fsl::UI::RenderIMBatch
     void InvalidateDrawCache() noexcept
     {
       m_commandBufferSizeLastFrame = 0;
+      m_retainedCommands.Invalidate();
     }
   };
 }
@@ -0,0 +1,137 @@
+#ifndef FSLSIMPLEUI_RENDER_IMBATCH_RETAINEDCOMMANDCACHE_HPP
+#define FSLSIMPLEUI_RENDER_IMBATCH_RETAINEDCOMMANDCACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics2D/Procedural/Batcher/ImmediateModeBatcherTypes.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <cassert>
+#include <vector>
+#include "Preprocess/ProcessedCommandRecord.hpp"
+
+namespace Fsl::UI::RenderIMBatch
+{
+  //! Remembers the draw commands used by the last mesh generation and the batcher state right before each of them was processed.
+  //! This allows the next generation to skip all commands that did not change and only regenerate the vertex ranges of the dirty ones.
+  class RetainedCommandCache
+  {
+  public:
+    struct Record
+    {
+      EncodedCommand Command;
+      ProcessedCommandRecord Processed;
+      ImmediateModeBatcherTypes::BatchBuildStatus StatusBefore;
+
+      constexpr Record() noexcept = default;
+      constexpr Record(const EncodedCommand& command, const ProcessedCommandRecord& processed,
+                       const ImmediateModeBatcherTypes::BatchBuildStatus& statusBefore) noexcept
+        : Command(command)
+        , Processed(processed)
+        , StatusBefore(statusBefore)
+      {
+      }
+
+      //! @brief Check if the command would generate exactly the same mesh as the one stored in this record
+      constexpr bool IsSameMeshInput(const EncodedCommand& command, const ProcessedCommandRecord& processed) const noexcept
+      {
+        // OriginalCommandIndex is not used during mesh generation
+        return Command == command && Processed.MaterialId == processed.MaterialId &&
+               Processed.DstAreaRectanglePxf == processed.DstAreaRectanglePxf && Processed.FinalColor == processed.FinalColor &&
+               Processed.LegacyCommandSpanIndex == processed.LegacyCommandSpanIndex && Processed.Flags == processed.Flags;
+      }
+    };
+
+  private:
+    std::vector<Record> m_records;
+    ImmediateModeBatcherTypes::BatchBuildStatus m_endStatus;
+    uint32_t m_count{0};
+    bool m_isValid{false};
+
+  public:
+    bool IsValid() const noexcept
+    {
+      return m_isValid;
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return m_isValid ? m_count : 0u;
+    }
+
+    void Invalidate() noexcept
+    {
+      m_isValid = false;
+      m_count = 0;
+    }
+
+    //! @brief Prepare to record up to 'count' commands while keeping the existing records available
+    void BeginUpdate(const uint32_t count)
+    {
+      if (count > m_records.size())
+      {
+        m_records.resize(count);
+      }
+    }
+
+    //! @brief Finish the update by storing the new command count and the final build status
+    void EndUpdate(const uint32_t count, const ImmediateModeBatcherTypes::BatchBuildStatus& endStatus) noexcept
+    {
+      assert(count <= m_records.size());
+      m_count = count;
+      m_endStatus = endStatus;
+      m_isValid = true;
+    }
+
+    const Record& operator[](const uint32_t index) const noexcept
+    {
+      assert(index < m_records.size());
+      return m_records[index];
+    }
+
+    void Set(const uint32_t index, const Record& record) noexcept
+    {
+      assert(index < m_records.size());
+      m_records[index] = record;
+    }
+
+    //! @brief Get the batcher status right before the command at the given index was processed.
+    //!        Using index == Count() returns the status after the last command was processed.
+    const ImmediateModeBatcherTypes::BatchBuildStatus& GetStatusBefore(const uint32_t index) const noexcept
+    {
+      assert(m_isValid);
+      assert(index <= m_count);
+      return index < m_count ? m_records[index].StatusBefore : m_endStatus;
+    }
+  };
+}
+
+#endif